@@ -0,0 +1,134 @@
+/// @file bench_perception.cpp
+/// @brief Perception system update vs a per-perceiver scan over every source
+///
+/// The system update hashes the stimulus sources, senses on workers and
+/// resolves line of sight in one batch. The reference gives every perceiver
+/// the full target list and checks line of sight per ray. Known targets of
+/// both must match after the timed updates.
+
+#include <void_engine/ai/perception.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace void_ai;
+using void_math::Vec3;
+
+namespace {
+
+constexpr int k_perceivers = 500;
+constexpr int k_sources = 2000;
+constexpr float k_world_extent = 250.0f;
+constexpr float k_dt = 0.1f;
+
+using TargetList = std::vector<std::pair<PerceptionTargetId, Vec3>>;
+
+/// Walls every 40 units along x block rays that cross them
+bool clear_line(const Vec3& from, const Vec3& to) {
+    return std::floor(from.x / 40.0f) == std::floor(to.x / 40.0f);
+}
+
+std::unique_ptr<SightSense> make_sight() {
+    SightConfig config;
+    config.view_distance = 20.0f;
+    config.peripheral_distance = 10.0f;
+    auto sight = std::make_unique<SightSense>(config);
+    sight->set_los_check(clear_line);
+    return sight;
+}
+
+std::vector<std::uint32_t> known_ids(const PerceptionComponent& perceiver) {
+    std::vector<std::uint32_t> ids;
+    for (const auto& target : perceiver.known_targets()) {
+        ids.push_back(target.target_id.value);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+template<typename Fn>
+double time_updates(int iterations, Fn&& update) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        update();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 20;
+    std::uint32_t workers = argc > 2 ? static_cast<std::uint32_t>(std::max(0, std::atoi(argv[2]))) : 0;
+
+    PerceptionSystemConfig config;
+    config.max_workers = workers;
+    PerceptionSystem system(config);
+    system.set_los_batch_check([](std::span<const LineOfSightRay> rays, std::span<std::uint8_t> visible) {
+        for (std::size_t i = 0; i < rays.size(); ++i) {
+            visible[i] = clear_line(rays[i].from, rays[i].to) ? 1 : 0;
+        }
+    });
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(-k_world_extent, k_world_extent);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+    TargetList targets;
+    for (int i = 0; i < k_sources; ++i) {
+        StimulusSource* source = system.create_stimulus_source();
+        source->set_position({coord(rng), 0.0f, coord(rng)});
+        targets.emplace_back(system.register_target(source), source->position());
+    }
+
+    std::vector<PerceptionComponent*> perceivers;
+    std::vector<std::unique_ptr<PerceptionComponent>> references;
+    for (int i = 0; i < k_perceivers; ++i) {
+        Vec3 position{coord(rng), 0.0f, coord(rng)};
+        float a = angle(rng);
+        Vec3 forward{std::cos(a), 0.0f, std::sin(a)};
+
+        PerceptionComponent* perceiver = system.create_perceiver();
+        perceiver->add_sense(make_sight());
+        perceiver->set_position(position);
+        perceiver->set_forward(forward);
+        perceivers.push_back(perceiver);
+
+        auto reference = std::make_unique<PerceptionComponent>();
+        reference->add_sense(make_sight());
+        reference->set_position(position);
+        reference->set_forward(forward);
+        references.push_back(std::move(reference));
+    }
+
+    double system_ms = time_updates(iterations, [&] { system.update(k_dt); });
+    double scan_ms = time_updates(iterations, [&] {
+        for (auto& reference : references) {
+            reference->update(k_dt, targets);
+        }
+    });
+
+    std::size_t mismatches = 0;
+    std::size_t known = 0;
+    for (std::size_t i = 0; i < perceivers.size(); ++i) {
+        auto ids = known_ids(*perceivers[i]);
+        if (ids != known_ids(*references[i])) ++mismatches;
+        known += ids.size();
+    }
+
+    std::printf("%d perceivers, %d sources, %d updates\n", k_perceivers, k_sources, iterations);
+    std::printf("%-16s %12s %8s\n", "update", "ms", "speedup");
+    std::printf("%-16s %12.3f\n", "scan", scan_ms);
+    std::printf("%-16s %12.3f %7.2fx\n", "system", system_ms,
+                system_ms > 0.0 ? scan_ms / system_ms : 0.0);
+    std::printf("known targets: %zu, mismatched perceivers: %zu\n", known, mismatches);
+
+    return mismatches ? 1 : 0;
+}
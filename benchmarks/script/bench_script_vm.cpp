@@ -0,0 +1,192 @@
+/// @file bench_script_vm.cpp
+/// @brief Bytecode VM vs tree-walking interpreter on typical gameplay scripts
+///
+/// Each script is parsed once and then executed repeatedly in a fresh
+/// Interpreter per mode. The printed output of both modes must match.
+
+#include "script/interpreter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace void_script;
+
+namespace {
+
+struct Script {
+    const char* name;
+    const char* source;
+};
+
+// Scripts avoid postfix ++/-- and '..' ranges, which the parser does not accept
+const Script k_scripts[] = {
+    {"fib", R"(
+        fn fib(n) {
+            if (n < 2) { return n; }
+            return fib(n - 1) + fib(n - 2);
+        }
+        print(fib(20));
+    )"},
+
+    {"entity_update", R"(
+        var entities = [];
+        for (var i = 0; i < 200; i = i + 1) {
+            push(entities, {x: i, y: 0, vx: 1.5, vy: -0.5, hp: 100});
+        }
+
+        fn update(e, dt) {
+            var x = get(e, "x") + get(e, "vx") * dt;
+            var y = get(e, "y") + get(e, "vy") * dt;
+            if (x > 100) { x = 0; }
+            if (y < -100) { y = 0; }
+            set(e, "x", x);
+            set(e, "y", y);
+            var d = sqrt(x * x + y * y);
+            if (d < 10) { set(e, "hp", get(e, "hp") - 1); }
+        }
+
+        for (var frame = 0; frame < 50; frame = frame + 1) {
+            for (e in entities) { update(e, 0.016); }
+        }
+
+        var total = 0;
+        for (e in entities) { total += get(e, "hp"); }
+        print(total);
+    )"},
+
+    {"npc_fields", R"(
+        class Npc {
+            fn init(i) { this.x = i; this.y = 0; this.vx = 1.5; this.vy = -0.5; this.hp = 100; }
+            fn alive() { return this.hp > 0; }
+        }
+        class Prop {
+            fn init(i) { this.id = i; this.x = 0; this.y = i; this.vx = 0; this.vy = 1; this.hp = 1; }
+            fn alive() { return true; }
+        }
+
+        fn update(list, dt) {
+            for (n in list) {
+                n.x += n.vx * dt;
+                n.y += n.vy * dt;
+                if (n.x > 100) { n.x = 0; }
+                if (n.y < -100) { n.y = 0; }
+                if (n.x * n.x + n.y * n.y < 100) { n.hp -= 1; }
+            }
+        }
+
+        fn count(list) {
+            var alive = 0;
+            for (n in list) { if (n.alive()) { alive += 1; } }
+            return alive;
+        }
+
+        var list = [];
+        for (var i = 0; i < 200; i = i + 1) {
+            if (i % 4 == 0) { push(list, Prop(i)); } else { push(list, Npc(i)); }
+        }
+        for (var frame = 0; frame < 50; frame = frame + 1) { update(list, 0.016); }
+        print(count(list));
+    )"},
+
+    {"state_machine", R"(
+        var state = 0;
+        var ticks = 0;
+        var transitions = 0;
+        var hp = 100;
+
+        fn step() {
+            match (state) {
+                0 => { if (ticks > 3) { state = 1; transitions += 1; ticks = 0; } }
+                1 if hp < 50 => { state = 2; transitions += 1; }
+                1 => { hp -= 3; if (ticks > 5) { state = 0; transitions += 1; ticks = 0; } }
+                2 => { hp += 10; if (hp >= 100) { state = 0; transitions += 1; ticks = 0; } }
+            }
+            ticks += 1;
+        }
+
+        for (var i = 0; i < 20000; i = i + 1) { step(); }
+        print(transitions);
+    )"},
+
+    {"functional", R"(
+        fn run() {
+            var data = [];
+            for (var i = 0; i < 500; i = i + 1) { push(data, i); }
+            var total = 0;
+            for (var pass = 0; pass < 20; pass = pass + 1) {
+                var doubled = map(data, fn(v) => v * 2);
+                var even = filter(doubled, fn(v) => v % 4 == 0);
+                total += reduce(even, fn(acc, v) => acc + v, 0);
+            }
+            return total;
+        }
+        print(run());
+    )"},
+
+    {"string_build", R"(
+        var out = "";
+        for (var i = 0; i < 2000; i = i + 1) {
+            out = out + "e" + str(i % 10);
+            if (len(out) > 200) { out = ""; }
+        }
+        print(len(out));
+    )"},
+};
+
+struct Result {
+    double ms = 0.0;
+    std::string output;
+};
+
+Result run(const Program& program, bool bytecode, int iterations) {
+    Result result;
+    Interpreter interp;
+    interp.set_bytecode_enabled(bytecode);
+    interp.set_print_callback([&](const std::string& text) {
+        result.output += text;
+        result.output += '\n';
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        interp.execute(program);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    result.ms = std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+    return result;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 10;
+    bool mismatch = false;
+
+    std::printf("%-16s %12s %12s %8s\n", "script", "tree (ms)", "vm (ms)", "speedup");
+    for (const auto& script : k_scripts) {
+        Parser parser(script.source, script.name);
+        auto program = parser.parse_program();
+        if (parser.has_errors()) {
+            std::printf("%-16s parse error: %s\n", script.name, parser.errors().front().what());
+            mismatch = true;
+            continue;
+        }
+
+        Result tree = run(*program, false, iterations);
+        Result vm = run(*program, true, iterations);
+
+        std::printf("%-16s %12.3f %12.3f %7.2fx\n", script.name, tree.ms, vm.ms,
+                    vm.ms > 0.0 ? tree.ms / vm.ms : 0.0);
+        if (tree.output != vm.output) {
+            std::printf("  output mismatch:\n  tree: %s  vm:   %s", tree.output.c_str(), vm.output.c_str());
+            mismatch = true;
+        }
+    }
+
+    return mismatch ? 1 : 0;
+}
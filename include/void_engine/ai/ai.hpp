@@ -14,7 +14,8 @@
 /// - Decorator nodes: Inverter, Repeater, Cooldown, Timeout, Conditional
 /// - Leaf nodes: Action, Condition, Wait, SubTree
 /// - Fluent builder API for easy tree construction
-/// - Blackboard data sharing system
+/// - Flattened tree assets shared by many agents, ticked in batches
+/// - Blackboard data sharing system, with schema-compiled typed slots
 ///
 /// ## Navigation
 /// Production-quality pathfinding system:
@@ -31,6 +32,7 @@
 /// - Avoidance: Obstacle avoidance with raycasting
 /// - Flocking: Separation, Alignment, Cohesion
 /// - Path following integration with navigation
+/// - Crowds: spatial-hash neighbours and ORCA reciprocal avoidance
 ///
 /// ## Perception
 /// AI sensing system:
@@ -140,11 +142,15 @@
 // Subsystems
 #include "blackboard.hpp"
 #include "behavior_tree.hpp"
+#include "behavior_tree_asset.hpp"
 #include "navmesh.hpp"
 #include "steering.hpp"
+#include "crowd.hpp"
 #include "perception.hpp"
 #include "state_machine.hpp"
 
+#include <void_engine/core/tick_lod.hpp>
+
 namespace void_ai {
 
 // =============================================================================
@@ -173,6 +179,10 @@ public:
     void unregister_tree(BehaviorTreeId id);
     BehaviorTree* get_tree(BehaviorTreeId id);
 
+    // Shared behavior trees, ticked per batch
+    BehaviorTreeBatch* create_tree_batch(std::shared_ptr<const BehaviorTreeAsset> asset);
+    void destroy_tree_batch(BehaviorTreeBatch* batch);
+
     // Blackboard management
     BlackboardId create_blackboard();
     void destroy_blackboard(BlackboardId id);
@@ -211,6 +221,7 @@ private:
     std::unique_ptr<PerceptionSystem> m_perception;
 
     std::unordered_map<BehaviorTreeId, std::unique_ptr<BehaviorTree>> m_trees;
+    std::vector<std::unique_ptr<BehaviorTreeBatch>> m_tree_batches;
     std::unordered_map<BlackboardId, std::unique_ptr<Blackboard>> m_blackboards;
 
     std::uint32_t m_next_tree_id{1};
@@ -263,6 +274,10 @@ public:
     void set_forward(const void_math::Vec3& forward);
     const void_math::Vec3& forward() const { return m_forward; }
 
+    // Update rate
+    /// @brief Tick the blackboard and tree at the rate the scheduler assigns to @p entity
+    void set_tick_lod(const void_core::TickLodScheduler* scheduler, void_core::EntityId entity);
+
     // Update all controlled systems
     void update(float dt);
 
@@ -278,6 +293,8 @@ private:
     NavAgent* m_nav_agent{nullptr};
     SteeringAgent* m_steering_agent{nullptr};
     PerceptionComponent* m_perception{nullptr};
+    const void_core::TickLodScheduler* m_tick_lod{nullptr};
+    void_core::EntityId m_tick_entity{};
 
     void_math::Vec3 m_position{};
     void_math::Vec3 m_forward{0, 0, 1};
@@ -300,6 +317,10 @@ namespace prelude {
     using void_ai::BehaviorTree;
     using void_ai::BehaviorTreeBuilder;
     using void_ai::BehaviorTreeId;
+    using void_ai::BehaviorTreeAsset;
+    using void_ai::BehaviorTreeAssetBuilder;
+    using void_ai::BehaviorTreeBatch;
+    using void_ai::BehaviorContext;
     using void_ai::IBehaviorNode;
     using void_ai::ActionNode;
     using void_ai::ConditionNode;
@@ -310,6 +331,9 @@ namespace prelude {
     using void_ai::IBlackboard;
     using void_ai::Blackboard;
     using void_ai::BlackboardKey;
+    using void_ai::BlackboardSchema;
+    using void_ai::BlackboardSlot;
+    using void_ai::CompiledBlackboard;
     using void_ai::BlackboardId;
     using void_ai::BlackboardValue;
 
@@ -0,0 +1,233 @@
+/// @file behavior_tree_asset.hpp
+/// @brief Flattened behavior trees shared by many agents
+
+#pragma once
+
+#include "fwd.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace void_ai {
+
+// =============================================================================
+// Behavior Tree Asset
+// =============================================================================
+
+/// @brief Node of a flattened behavior tree
+///
+/// Nodes are stored in depth-first order: the first child of node i is i + 1,
+/// and the next sibling of a child c is c.end.
+struct FlatBehaviorNode {
+    static constexpr std::uint32_t k_none = 0xFFFFFFFFu;
+
+    NodeType type{NodeType::Sequence};
+    AbortType abort{AbortType::None};
+    ParallelPolicy success_policy{ParallelPolicy::RequireAll};
+    ParallelPolicy failure_policy{ParallelPolicy::RequireOne};
+    std::uint32_t end{0};               ///< One past the last descendant
+    std::uint32_t child_count{0};
+    std::uint32_t callback{k_none};     ///< Index into the action or condition table
+    std::uint32_t extra{0};             ///< Offset of per-agent child slots (parallel, random)
+    std::uint32_t count{0};             ///< Repeater count (0 = infinite)
+    float param0{0};                    ///< Duration, cooldown, timeout or parallel threshold
+    float param1{0};                    ///< Maximum wait duration
+    std::uint32_t name{k_none};         ///< Index into the name table
+};
+
+/// @brief Immutable, flattened behavior tree
+///
+/// Built once by BehaviorTreeAssetBuilder and shared by every agent running
+/// it; all per-agent state lives in BehaviorTreeBatch. Callbacks receive the
+/// agent's BehaviorContext instead of capturing their own agent.
+class BehaviorTreeAsset {
+public:
+    std::size_t node_count() const { return m_nodes.size(); }
+    const FlatBehaviorNode& node(std::size_t index) const { return m_nodes[index]; }
+    const std::vector<FlatBehaviorNode>& nodes() const { return m_nodes; }
+
+    /// @brief Per-agent child slots needed by parallel and random composites
+    std::size_t extra_count() const { return m_extra_count; }
+
+    std::string_view node_name(std::size_t index) const;
+
+    const BehaviorActionFn& action(std::uint32_t index) const { return m_actions[index]; }
+    const BehaviorConditionFn& condition(std::uint32_t index) const { return m_conditions[index]; }
+
+private:
+    friend class BehaviorTreeAssetBuilder;
+
+    std::vector<FlatBehaviorNode> m_nodes;
+    std::vector<BehaviorActionFn> m_actions;
+    std::vector<BehaviorConditionFn> m_conditions;
+    std::vector<std::string> m_names;
+    std::size_t m_extra_count{0};
+};
+
+// =============================================================================
+// Behavior Tree Asset Builder
+// =============================================================================
+
+/// @brief Fluent builder for flattened behavior trees
+///
+/// Mirrors BehaviorTreeBuilder: composites stay open until end(), decorators
+/// close once their child is complete. Subtrees are inlined.
+class BehaviorTreeAssetBuilder {
+public:
+    BehaviorTreeAssetBuilder();
+
+    // Composites
+    BehaviorTreeAssetBuilder& sequence();
+    BehaviorTreeAssetBuilder& selector();
+    BehaviorTreeAssetBuilder& parallel(ParallelPolicy success = ParallelPolicy::RequireAll,
+                                       ParallelPolicy failure = ParallelPolicy::RequireOne,
+                                       float threshold = 0.5f);
+    BehaviorTreeAssetBuilder& random_selector();
+    BehaviorTreeAssetBuilder& random_sequence();
+
+    // Decorators
+    BehaviorTreeAssetBuilder& inverter();
+    BehaviorTreeAssetBuilder& repeater(std::uint32_t count = 0);
+    BehaviorTreeAssetBuilder& repeat_until_fail();
+    BehaviorTreeAssetBuilder& succeeder();
+    BehaviorTreeAssetBuilder& failer();
+    BehaviorTreeAssetBuilder& cooldown(float time);
+    BehaviorTreeAssetBuilder& timeout(float time);
+    BehaviorTreeAssetBuilder& conditional(BehaviorConditionFn cond,
+                                          AbortType abort = AbortType::None);
+
+    // Leaf nodes
+    BehaviorTreeAssetBuilder& action(BehaviorActionFn callback);
+    BehaviorTreeAssetBuilder& action(std::string_view name, BehaviorActionFn callback);
+    BehaviorTreeAssetBuilder& condition(BehaviorConditionFn callback);
+    BehaviorTreeAssetBuilder& condition(std::string_view name, BehaviorConditionFn callback);
+    BehaviorTreeAssetBuilder& wait(float duration);
+    BehaviorTreeAssetBuilder& wait(float min_duration, float max_duration);
+    BehaviorTreeAssetBuilder& subtree(const BehaviorTreeAsset& tree);
+
+    // Structure
+    BehaviorTreeAssetBuilder& end();  ///< End current composite/decorator
+    BehaviorTreeAssetBuilder& name(std::string_view name);
+
+    // Build
+    std::shared_ptr<const BehaviorTreeAsset> build();
+
+private:
+    struct OpenNode {
+        std::uint32_t index;
+        bool is_composite;
+    };
+
+    std::unique_ptr<BehaviorTreeAsset> m_asset;
+    std::vector<OpenNode> m_stack;
+    std::string m_pending_name;
+
+    std::uint32_t add_node(NodeType type);
+    void open_node(std::uint32_t index, bool is_composite);
+    void close_node(std::uint32_t index);
+};
+
+// =============================================================================
+// Behavior Tree Batch
+// =============================================================================
+
+/// @brief Runs one BehaviorTreeAsset for many agents
+///
+/// Per-agent node state is a fixed-size block in one contiguous array, so
+/// tick_all() walks the agents sharing a tree back to back without any
+/// per-node allocation or virtual dispatch.
+///
+/// Ticking is event driven. A running agent resumes at its running branch:
+/// finished siblings are skipped, and conditionals guarding a running child
+/// are only re-checked when their abort type includes Self. Conditionals with
+/// a LowerPriority abort, placed before the running branch of a selector, are
+/// re-checked only after notify(), e.g. from a blackboard observer; if one
+/// passes, the running branch is aborted and the selector switches to it.
+class BehaviorTreeBatch {
+public:
+    explicit BehaviorTreeBatch(std::shared_ptr<const BehaviorTreeAsset> asset,
+                               std::uint32_t seed = 0);
+    ~BehaviorTreeBatch();
+
+    const BehaviorTreeAsset& asset() const { return *m_asset; }
+
+    // Agent management
+    BehaviorAgentId add_agent(IBlackboard* blackboard = nullptr, void* user_data = nullptr);
+    void remove_agent(BehaviorAgentId id);
+    void clear();
+
+    bool is_valid(BehaviorAgentId id) const;
+    std::size_t agent_count() const { return m_active_count; }
+
+    const BehaviorContext* context(BehaviorAgentId id) const;
+
+    /// @brief Reset an agent's tree to its initial state
+    void reset(BehaviorAgentId id);
+
+    /// @brief Re-check lower priority aborts of the agent on its next tick
+    void notify(BehaviorAgentId id);
+    void notify_all();
+
+    /// @brief Tick one agent
+    NodeStatus tick(BehaviorAgentId id, float dt);
+
+    /// @brief Tick every agent
+    void tick_all(float dt);
+
+    // Status
+    NodeStatus status(BehaviorAgentId id) const;
+    NodeStatus node_status(BehaviorAgentId id, std::size_t node) const;
+
+private:
+    /// Per-node state of one agent
+    struct NodeState {
+        NodeStatus status{NodeStatus::Invalid};
+        std::uint8_t flag{0};           ///< Conditional was true / cooldown active / slots ready
+        std::uint16_t index{0};         ///< Current child
+        std::uint32_t count{0};         ///< Repeat count
+        float time{0};                  ///< Elapsed or remaining time
+        float target{0};                ///< Wait duration
+    };
+
+    struct Agent {
+        BehaviorContext context;
+        std::uint32_t rng{0};
+        bool dirty{false};
+        bool active{false};
+    };
+
+    static constexpr std::uint32_t k_slot_bits = 20;
+    static constexpr std::uint32_t k_slot_mask = (1u << k_slot_bits) - 1;
+
+    BehaviorAgentId id_of(std::uint32_t slot) const;
+    std::uint32_t slot_of(BehaviorAgentId id) const;
+    NodeStatus tick_node(std::uint32_t slot, std::uint32_t node, float dt);
+    NodeStatus tick_composite(std::uint32_t slot, std::uint32_t node, NodeState& state, float dt);
+    NodeStatus tick_parallel(std::uint32_t slot, std::uint32_t node, NodeState& state, float dt);
+    bool check_lower_priority_aborts(std::uint32_t slot, std::uint32_t node, NodeState& state);
+    void reset_range(std::uint32_t slot, std::uint32_t begin, std::uint32_t end);
+    std::uint32_t child_at(std::uint32_t node, std::uint32_t child) const;
+    std::uint32_t next_random(std::uint32_t slot);
+
+    NodeState* states(std::uint32_t slot) {
+        return m_states.data() + static_cast<std::size_t>(slot) * m_asset->node_count();
+    }
+    std::uint16_t* extras(std::uint32_t slot) {
+        return m_extras.data() + static_cast<std::size_t>(slot) * m_asset->extra_count();
+    }
+
+    std::shared_ptr<const BehaviorTreeAsset> m_asset;
+    std::vector<Agent> m_agents;
+    std::vector<NodeState> m_states;
+    std::vector<std::uint16_t> m_extras;
+    std::vector<std::uint32_t> m_free_slots;
+    std::vector<std::uint32_t> m_slot_generation;  ///< Upper bits of ids issued for a slot
+    std::size_t m_active_count{0};
+    std::uint32_t m_seed{0};
+};
+
+} // namespace void_ai
@@ -6,11 +6,16 @@
 #include "fwd.hpp"
 #include "types.hpp"
 
+#include <algorithm>
 #include <any>
+#include <cstddef>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -157,10 +162,297 @@ private:
     std::unique_ptr<Blackboard> m_scoped;
 };
 
+// =============================================================================
+// Blackboard Schema
+// =============================================================================
+
+/// @brief Value type of a schema slot
+enum class BlackboardSlotType : std::uint8_t {
+    Bool,
+    Int,
+    Float,
+    Vec3,
+    String
+};
+
+/// @brief Precompiled key of a schema slot
+///
+/// Resolved once from the schema; reads and writes through it are an offset
+/// into the blackboard's slot data, with no hashing.
+template<typename T>
+struct BlackboardSlot {
+    static constexpr std::uint32_t k_invalid = 0xFFFFFFFFu;
+
+    std::uint32_t index{k_invalid};     ///< Slot index (change mask bit)
+    std::uint32_t offset{0};            ///< Byte offset, or string index for strings
+
+    explicit operator bool() const { return index != k_invalid; }
+};
+
+/// @brief Set of schema slots, one bit per slot
+class BlackboardMask {
+public:
+    void set(std::uint32_t slot) {
+        if (slot / 64 >= m_words.size()) {
+            m_words.resize(slot / 64 + 1, 0);
+        }
+        m_words[slot / 64] |= std::uint64_t{1} << (slot % 64);
+    }
+
+    void reset(std::uint32_t slot) {
+        if (slot / 64 < m_words.size()) {
+            m_words[slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+        }
+    }
+
+    /// @brief Preallocate room for @p slot_count slots
+    void resize(std::size_t slot_count) { m_words.resize((slot_count + 63) / 64, 0); }
+
+    bool test(std::uint32_t slot) const {
+        return slot / 64 < m_words.size() && (m_words[slot / 64] >> (slot % 64)) & 1;
+    }
+
+    bool intersects(const BlackboardMask& other) const {
+        std::size_t count = std::min(m_words.size(), other.m_words.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            if (m_words[i] & other.m_words[i]) return true;
+        }
+        return false;
+    }
+
+    bool any() const {
+        for (auto word : m_words) {
+            if (word) return true;
+        }
+        return false;
+    }
+
+    void clear() { std::fill(m_words.begin(), m_words.end(), 0); }
+
+    const std::vector<std::uint64_t>& words() const { return m_words; }
+
+private:
+    std::vector<std::uint64_t> m_words;
+};
+
+/// @brief Key layout shared by all blackboards of a tree or agent type
+///
+/// Each key gets a dense slot index. Bool, int, float and Vec3 slots are
+/// packed into one byte block; string slots are stored separately.
+class BlackboardSchema {
+public:
+    struct SlotInfo {
+        std::string name;
+        BlackboardSlotType type{BlackboardSlotType::Bool};
+        std::uint32_t offset{0};        ///< Byte offset, or string index for strings
+    };
+
+    /// @brief Add a slot (returns the existing slot if the name is taken with the same type)
+    template<typename T>
+    BlackboardSlot<T> add(std::string_view name, const T& default_value = T{});
+
+    /// @brief Resolve a slot by name; invalid if missing or of another type
+    template<typename T>
+    BlackboardSlot<T> find(std::string_view name) const;
+
+    std::uint32_t find_index(std::string_view name) const;
+
+    std::size_t slot_count() const { return m_slots.size(); }
+    const SlotInfo& slot(std::uint32_t index) const { return m_slots[index]; }
+
+    /// @brief Size of the packed bool/int/float/Vec3 block
+    std::size_t data_size() const { return m_defaults.size(); }
+    std::size_t string_count() const { return m_string_defaults.size(); }
+
+    /// @brief Fingerprint of the layout, for validating snapshots
+    std::uint64_t layout_hash() const;
+
+    const std::vector<std::byte>& default_data() const { return m_defaults; }
+    const std::vector<std::string>& default_strings() const { return m_string_defaults; }
+
+    template<typename T>
+    static constexpr BlackboardSlotType slot_type_of();
+
+private:
+    std::uint32_t add_slot(std::string_view name, BlackboardSlotType type,
+                           std::size_t size, std::size_t align, const void* default_value);
+
+    /// Lets find_index look up a string_view without building a string
+    struct NameHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const noexcept {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    std::vector<SlotInfo> m_slots;
+    std::unordered_map<std::string, std::uint32_t, NameHash, std::equal_to<>> m_lookup;
+    std::vector<std::byte> m_defaults;
+    std::vector<std::string> m_string_defaults;
+};
+
+// =============================================================================
+// Compiled Blackboard
+// =============================================================================
+
+/// @brief Blackboard laid out by a BlackboardSchema
+///
+/// Gameplay code and behavior tree callbacks use the typed slot accessors.
+/// Writes set a bit in the change mask, which systems poll to wake up
+/// observers (for example BehaviorTreeBatch::notify). All non-string slots
+/// live in one block, so a snapshot is a single memcpy.
+///
+/// The IBlackboard string interface remains as a slow path for tools and
+/// scripts: known names map to their slot, unknown names go to an overflow
+/// map, and string observers are called only for observed slots.
+class CompiledBlackboard : public IBlackboard {
+public:
+    explicit CompiledBlackboard(std::shared_ptr<const BlackboardSchema> schema,
+                                IBlackboard* parent = nullptr);
+    ~CompiledBlackboard() override;
+
+    const BlackboardSchema& schema() const { return *m_schema; }
+
+    using IBlackboard::get;
+    using IBlackboard::set;
+
+    // Typed slot access
+    template<typename T>
+    T get(BlackboardSlot<T> slot) const;
+    const std::string& get(BlackboardSlot<std::string> slot) const { return m_strings[slot.offset]; }
+
+    template<typename T>
+    void set(BlackboardSlot<T> slot, const std::type_identity_t<T>& value);
+
+    // Change tracking
+    bool is_changed(std::uint32_t slot) const { return m_changed.test(slot); }
+    bool any_changed(const BlackboardMask& watched) const { return m_changed.intersects(watched); }
+    const BlackboardMask& changes() const { return m_changed; }
+    void clear_changes() { m_changed.clear(); }
+
+    // Raw slot data
+    std::span<const std::byte> data() const { return m_data; }
+
+    /// @brief Copy all non-string slots into @p out, and string slots into @p out_strings
+    /// @return The schema's layout hash, to be stored with the snapshot
+    std::uint64_t write_snapshot(std::vector<std::uint8_t>& out,
+                                 std::vector<std::string>* out_strings = nullptr) const;
+
+    /// @brief Restore slots from a snapshot taken with the same layout
+    ///
+    /// Fails without touching any slot if @p layout_hash is not this schema's
+    /// layout hash or the sizes do not match, since the bytes of another
+    /// layout would land in the wrong slots.
+    bool read_snapshot(std::uint64_t layout_hash,
+                       std::span<const std::uint8_t> in,
+                       std::span<const std::string> strings = {});
+
+    // IBlackboard interface (slow path)
+    void set_value(std::string_view key, const BlackboardValue& value) override;
+    bool get_value(std::string_view key, BlackboardValue& out_value) const override;
+    bool has_key(std::string_view key) const override;
+    void remove_key(std::string_view key) override;
+    void clear() override;
+
+    void set_bool(std::string_view key, bool value) override;
+    void set_int(std::string_view key, int value) override;
+    void set_float(std::string_view key, float value) override;
+    void set_string(std::string_view key, std::string_view value) override;
+    void set_vec3(std::string_view key, const void_math::Vec3& value) override;
+
+    bool get_bool(std::string_view key, bool default_value = false) const override;
+    int get_int(std::string_view key, int default_value = 0) const override;
+    float get_float(std::string_view key, float default_value = 0) const override;
+    std::string get_string(std::string_view key, std::string_view default_value = "") const override;
+    void_math::Vec3 get_vec3(std::string_view key, const void_math::Vec3& default_value = {}) const override;
+
+    void observe(std::string_view key, ChangeCallback callback) override;
+    void unobserve(std::string_view key) override;
+
+    IBlackboard* parent() const override { return m_parent; }
+    void set_parent(IBlackboard* parent) override { m_parent = parent; }
+
+    std::vector<std::pair<std::string, BlackboardValue>> get_all() const override;
+    void merge(const IBlackboard& other) override;
+
+private:
+    BlackboardValue slot_value(std::uint32_t slot) const;
+    bool assign_slot(std::uint32_t slot, const BlackboardValue& value);
+    void reset_slot(std::uint32_t slot);
+    void mark_changed(std::uint32_t slot);
+    Blackboard& overflow();
+
+    std::shared_ptr<const BlackboardSchema> m_schema;
+    std::vector<std::byte> m_data;
+    std::vector<std::string> m_strings;
+    BlackboardMask m_changed;
+
+    // Slow path state
+    BlackboardMask m_observed;
+    std::vector<std::pair<std::uint32_t, ChangeCallback>> m_observers;
+    std::unique_ptr<Blackboard> m_overflow;
+    IBlackboard* m_parent{nullptr};
+};
+
 // =============================================================================
 // Template Implementations
 // =============================================================================
 
+template<typename T>
+constexpr BlackboardSlotType BlackboardSchema::slot_type_of() {
+    if constexpr (std::is_same_v<T, bool>) {
+        return BlackboardSlotType::Bool;
+    } else if constexpr (std::is_same_v<T, int>) {
+        return BlackboardSlotType::Int;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return BlackboardSlotType::Float;
+    } else if constexpr (std::is_same_v<T, void_math::Vec3>) {
+        return BlackboardSlotType::Vec3;
+    } else {
+        static_assert(std::is_same_v<T, std::string>, "Unsupported blackboard slot type");
+        return BlackboardSlotType::String;
+    }
+}
+
+template<typename T>
+BlackboardSlot<T> BlackboardSchema::add(std::string_view name, const T& default_value) {
+    std::uint32_t index = add_slot(name, slot_type_of<T>(), sizeof(T), alignof(T), &default_value);
+    if (index == BlackboardSlot<T>::k_invalid) {
+        return {};
+    }
+    return {index, m_slots[index].offset};
+}
+
+template<typename T>
+BlackboardSlot<T> BlackboardSchema::find(std::string_view name) const {
+    std::uint32_t index = find_index(name);
+    if (index == BlackboardSlot<T>::k_invalid || m_slots[index].type != slot_type_of<T>()) {
+        return {};
+    }
+    return {index, m_slots[index].offset};
+}
+
+template<typename T>
+T CompiledBlackboard::get(BlackboardSlot<T> slot) const {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    std::memcpy(&value, m_data.data() + slot.offset, sizeof(T));
+    return value;
+}
+
+template<typename T>
+void CompiledBlackboard::set(BlackboardSlot<T> slot, const std::type_identity_t<T>& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        if (m_strings[slot.offset] == value) return;
+        m_strings[slot.offset] = value;
+    } else {
+        std::byte* dst = m_data.data() + slot.offset;
+        if (std::memcmp(dst, &value, sizeof(T)) == 0) return;
+        std::memcpy(dst, &value, sizeof(T));
+    }
+    mark_changed(slot.index);
+}
+
 template<typename T>
 void IBlackboard::set(const BlackboardKey<T>& key, const T& value) {
     if constexpr (std::is_same_v<T, bool>) {
@@ -0,0 +1,116 @@
+/// @file crowd.hpp
+/// @brief Crowd simulation with spatial-hash neighbours and ORCA avoidance
+
+#pragma once
+
+#include "fwd.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace void_ai {
+
+// =============================================================================
+// Crowd System
+// =============================================================================
+
+/// @brief Reciprocal collision avoidance for large groups of agents
+///
+/// Each update rebuilds a spatial hash of all agents, gathers the closest
+/// neighbours of every agent and picks a collision-free velocity with ORCA
+/// (optimal reciprocal collision avoidance). Agent data is stored as
+/// structure-of-arrays on the XZ plane, and the per-agent passes run on
+/// worker threads.
+///
+/// Agents either follow a preferred velocity set by the caller and are moved
+/// by the crowd, or are bound to a NavAgent: the crowd then steers toward the
+/// agent's path corridor and hands the avoidance velocity back to the agent,
+/// which still moves itself.
+class CrowdSystem {
+public:
+    CrowdSystem();
+    explicit CrowdSystem(const CrowdConfig& config);
+    ~CrowdSystem();
+
+    // Configuration
+    void set_config(const CrowdConfig& config) { m_config = config; }
+    const CrowdConfig& config() const { return m_config; }
+
+    // Agent management
+    CrowdAgentId add_agent(const void_math::Vec3& position,
+                           const CrowdAgentParams& params = CrowdAgentParams{});
+    CrowdAgentId add_agent(NavAgent* agent);
+    void remove_agent(CrowdAgentId id);
+    void remove_agent(const NavAgent* agent);
+    void clear();
+
+    bool is_valid(CrowdAgentId id) const;
+    std::size_t agent_count() const { return m_active_count; }
+
+    // Agent state
+    void set_preferred_velocity(CrowdAgentId id, const void_math::Vec3& velocity);
+    void set_position(CrowdAgentId id, const void_math::Vec3& position);
+    void set_params(CrowdAgentId id, const CrowdAgentParams& params);
+    void_math::Vec3 position(CrowdAgentId id) const;
+    void_math::Vec3 velocity(CrowdAgentId id) const;
+
+    // Neighbours found by the last update, closest first
+    std::vector<CrowdAgentId> neighbors(CrowdAgentId id) const;
+
+    /// @brief Neighbour states for the flocking behaviours' NeighborQuery
+    std::vector<KinematicState> neighbor_states(CrowdAgentId id) const;
+
+    /// @brief Simulate one step
+    void update(float dt);
+
+private:
+    static constexpr std::uint32_t k_slot_bits = 20;
+    static constexpr std::uint32_t k_slot_mask = (1u << k_slot_bits) - 1;
+
+    std::uint32_t allocate_slot();
+    CrowdAgentId id_of(std::uint32_t slot) const;
+    std::uint32_t slot_of(CrowdAgentId id) const;
+
+    void gather_agents();
+    void build_spatial_hash();
+    void find_neighbors(std::uint32_t agent);
+    void compute_velocity(std::uint32_t agent, float dt);
+    void integrate(float dt);
+
+    template<typename Fn>
+    void for_each_active_parallel(Fn&& fn);
+
+    CrowdConfig m_config;
+
+    // Agent data, one entry per slot
+    std::vector<float> m_pos_x;
+    std::vector<float> m_pos_y;
+    std::vector<float> m_pos_z;
+    std::vector<float> m_vel_x;
+    std::vector<float> m_vel_z;
+    std::vector<float> m_pref_x;
+    std::vector<float> m_pref_z;
+    std::vector<float> m_new_x;
+    std::vector<float> m_new_z;
+    std::vector<float> m_radius;
+    std::vector<float> m_max_speed;
+    std::vector<NavAgent*> m_nav_agents;
+    std::vector<std::uint8_t> m_active;
+    std::vector<std::uint32_t> m_free_slots;
+    std::vector<std::uint32_t> m_slot_generation;  ///< Upper bits of ids issued for a slot
+    std::size_t m_active_count{0};
+
+    // Spatial hash rebuilt every update (counting sort by cell)
+    std::vector<std::uint32_t> m_cell_start;
+    std::vector<std::uint32_t> m_cell_agents;
+    std::vector<std::uint32_t> m_agent_cell;
+    float m_cell_size{1.0f};
+
+    // Closest neighbours, max_neighbors per slot
+    std::vector<std::uint32_t> m_neighbors;
+    std::vector<std::uint32_t> m_neighbor_count;
+    std::uint32_t m_neighbor_stride{0};
+};
+
+} // namespace void_ai
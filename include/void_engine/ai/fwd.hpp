@@ -20,6 +20,14 @@ struct BehaviorTreeId {
     auto operator<=>(const BehaviorTreeId&) const = default;
 };
 
+/// @brief Strongly-typed agent ID within a behavior tree batch
+struct BehaviorAgentId {
+    std::uint32_t value{0};
+    explicit operator bool() const { return value != 0; }
+    bool operator==(const BehaviorAgentId&) const = default;
+    auto operator<=>(const BehaviorAgentId&) const = default;
+};
+
 /// @brief Strongly-typed blackboard ID
 struct BlackboardId {
     std::uint32_t value{0};
@@ -52,6 +60,14 @@ struct AgentId {
     auto operator<=>(const AgentId&) const = default;
 };
 
+/// @brief Strongly-typed crowd agent ID
+struct CrowdAgentId {
+    std::uint32_t value{0};
+    explicit operator bool() const { return value != 0; }
+    bool operator==(const CrowdAgentId&) const = default;
+    auto operator<=>(const CrowdAgentId&) const = default;
+};
+
 /// @brief Strongly-typed perception target ID
 struct PerceptionTargetId {
     std::uint32_t value{0};
@@ -67,6 +83,9 @@ struct PerceptionTargetId {
 class IBehaviorNode;
 class BehaviorTree;
 class BehaviorTreeBuilder;
+class BehaviorTreeAsset;
+class BehaviorTreeAssetBuilder;
+class BehaviorTreeBatch;
 
 // Composites
 class SequenceNode;
@@ -98,6 +117,8 @@ class SubTreeNode;
 class IBlackboard;
 class Blackboard;
 class BlackboardScope;
+class BlackboardSchema;
+class CompiledBlackboard;
 class BlackboardObserver;
 
 // =============================================================================
@@ -107,7 +128,10 @@ class BlackboardObserver;
 class INavMesh;
 class NavMesh;
 class NavMeshBuilder;
+class NavClusterGraph;
+class NavCorridorCache;
 class NavMeshQuery;
+class NavPathQueue;
 class NavPath;
 class NavAgent;
 class NavigationSystem;
@@ -119,6 +143,7 @@ class NavigationSystem;
 class ISteeringBehavior;
 class SteeringAgent;
 class SteeringSystem;
+class CrowdSystem;
 
 // Behaviors
 class SeekBehavior;
@@ -168,6 +193,11 @@ namespace std {
             return std::hash<std::uint32_t>{}(id.value);
         }
     };
+    template<> struct hash<void_ai::BehaviorAgentId> {
+        std::size_t operator()(const void_ai::BehaviorAgentId& id) const noexcept {
+            return std::hash<std::uint32_t>{}(id.value);
+        }
+    };
     template<> struct hash<void_ai::BlackboardId> {
         std::size_t operator()(const void_ai::BlackboardId& id) const noexcept {
             return std::hash<std::uint32_t>{}(id.value);
@@ -188,6 +218,11 @@ namespace std {
             return std::hash<std::uint32_t>{}(id.value);
         }
     };
+    template<> struct hash<void_ai::CrowdAgentId> {
+        std::size_t operator()(const void_ai::CrowdAgentId& id) const noexcept {
+            return std::hash<std::uint32_t>{}(id.value);
+        }
+    };
     template<> struct hash<void_ai::PerceptionTargetId> {
         std::size_t operator()(const void_ai::PerceptionTargetId& id) const noexcept {
             return std::hash<std::uint32_t>{}(id.value);
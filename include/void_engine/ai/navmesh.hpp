@@ -7,11 +7,16 @@
 #include "types.hpp"
 
 #include <functional>
+#include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <queue>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace void_ai {
@@ -71,6 +76,42 @@ public:
     virtual void_math::Vec3 bounds_max() const = 0;
 };
 
+// =============================================================================
+// Navigation Mesh Tile
+// =============================================================================
+
+/// @brief Polygons generated for one fixed-size tile
+///
+/// Vertex and neighbor indices are local to the tile. NavMesh::set_tile()
+/// remaps them and links the tile to its neighbors through border_edges.
+struct NavMeshTile {
+    /// @brief Polygon edge lying on the tile border
+    struct BorderEdge {
+        std::uint32_t polygon{0};
+        std::uint8_t side{0};          ///< 0: -x, 1: +z, 2: +x, 3: -z
+        float min{0};                  ///< Extent along the border
+        float max{0};
+        float height{0};
+    };
+
+    std::int32_t x{0};
+    std::int32_t z{0};
+    void_math::Vec3 bounds_min{};
+    void_math::Vec3 bounds_max{};
+    float link_climb{0.9f};            ///< Max height difference for cross-tile links
+    std::vector<void_math::Vec3> vertices;
+    std::vector<NavPolygon> polygons;
+    std::vector<std::vector<void_math::Vec3>> detail;  ///< Detail triangles per polygon
+    std::vector<BorderEdge> border_edges;
+};
+
+/// @brief Result of one query in a batched nearest-polygon lookup
+struct NearestPolygonResult {
+    void_math::Vec3 point{};
+    std::uint32_t polygon{0};
+    bool found{false};
+};
+
 // =============================================================================
 // Navigation Mesh Implementation
 // =============================================================================
@@ -87,6 +128,24 @@ public:
     void build_connectivity();
     void calculate_polygon_data();
 
+    // Tiles
+    void set_tile(NavMeshTile tile);
+    bool remove_tile(std::int32_t x, std::int32_t z);
+    bool has_tile(std::int32_t x, std::int32_t z) const;
+    std::size_t tile_count() const { return m_tiles.size(); }
+
+    /// @brief Surface height of a polygon at a point, using detail triangles when present
+    float polygon_height(std::uint32_t polygon, const void_math::Vec3& point) const;
+
+    // Spatial index
+    /// @brief (Re)build the polygon grid; a cell_size of 0 derives one from polygon sizes
+    void build_spatial_index(float cell_size = 0);
+    bool has_spatial_index() const { return m_grid_cell_size > 0; }
+
+    /// @brief Nearest point for many positions at once (e.g. every agent in a frame)
+    void find_nearest_points(std::span<const void_math::Vec3> positions,
+                             std::span<NearestPolygonResult> out) const;
+
     // INavMesh interface
     std::size_t polygon_count() const override { return m_polygons.size(); }
     const NavPolygon* polygon(std::uint32_t index) const override;
@@ -131,14 +190,40 @@ public:
     bool deserialize(const std::vector<std::uint8_t>& data);
 
 private:
+    struct TileRecord {
+        std::int32_t x{0};
+        std::int32_t z{0};
+        void_math::Vec3 bounds_min{};
+        void_math::Vec3 bounds_max{};
+        float link_climb{0};
+        std::vector<std::uint32_t> polygons;
+        std::vector<std::uint32_t> vertices;
+        std::vector<NavMeshTile::BorderEdge> border_edges;  ///< polygon is a mesh index
+    };
+
+    static std::uint64_t tile_key(std::int32_t x, std::int32_t z);
+
     void update_bounds();
+    void expand_bounds(const void_math::Vec3& position);
+    void compute_polygon_data(NavPolygon& poly) const;
+    void link_tiles(const TileRecord& a, const TileRecord& b);
+    bool polygon_cells(std::uint32_t polygon, std::int32_t& x0, std::int32_t& z0,
+                       std::int32_t& x1, std::int32_t& z1) const;
+    void index_polygon(std::uint32_t polygon);
+    void unindex_polygon(std::uint32_t polygon);
     float point_to_polygon_distance(const void_math::Vec3& point,
                                     std::uint32_t polygon_index) const;
 
     std::vector<NavVertex> m_vertices;
     std::vector<NavPolygon> m_polygons;
+    std::vector<std::vector<void_math::Vec3>> m_detail;
     std::vector<OffMeshConnection> m_off_mesh_connections;
     std::unordered_map<std::uint8_t, float> m_area_costs;
+    std::unordered_map<std::uint64_t, TileRecord> m_tiles;
+    std::vector<std::uint32_t> m_free_vertices;
+    std::vector<std::uint32_t> m_free_polygons;
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_poly_grid;
+    float m_grid_cell_size{0};
     void_math::Vec3 m_bounds_min{};
     void_math::Vec3 m_bounds_max{};
     float m_total_area{0};
@@ -181,9 +266,21 @@ public:
                           float max_height,
                           AreaType area);
 
+    void clear_obstacles() { m_obstacles.clear(); }
+
     // Build
     std::unique_ptr<NavMesh> build();
 
+    /// @brief Voxelize and polygonize a single tile
+    NavMeshTile build_tile(std::int32_t tile_x, std::int32_t tile_z) const;
+
+    /// @brief Regenerate one tile of a built mesh, e.g. after obstacles changed
+    void rebuild_tile(NavMesh& mesh, std::int32_t tile_x, std::int32_t tile_z) const;
+
+    /// @brief Tiles whose area overlaps the given bounds
+    std::vector<std::pair<std::int32_t, std::int32_t>> tiles_overlapping(
+        const void_math::Vec3& min, const void_math::Vec3& max) const;
+
     // Configuration
     void set_config(const NavMeshBuildConfig& config) { m_config = config; }
     const NavMeshBuildConfig& config() const { return m_config; }
@@ -202,18 +299,124 @@ private:
         float height{0};
     };
 
+    struct AreaVolume {
+        std::vector<void_math::Vec3> vertices;  ///< Convex footprint, or min/max for boxes
+        float min_height{0};
+        float max_height{0};
+        AreaType area{AreaType::Ground};
+        bool box{false};
+    };
+
+    NavMeshTile build_tile(std::int32_t tile_x, std::int32_t tile_z,
+                           const std::vector<std::uint32_t>& triangles) const;
+    std::vector<std::uint32_t> triangles_in_tile(std::int32_t tile_x, std::int32_t tile_z) const;
+    float tile_world_size() const;
+
     NavMeshBuildConfig m_config;
     std::vector<InputTriangle> m_triangles;
     std::vector<Obstacle> m_obstacles;
+    std::vector<AreaVolume> m_area_volumes;
+    void_math::Vec3 m_bounds_min{};
+    void_math::Vec3 m_bounds_max{};
+};
+
+// =============================================================================
+// Hierarchical Pathfinding
+// =============================================================================
+
+/// @brief Cluster abstraction of a navmesh used for hierarchical pathfinding
+///
+/// Polygons are grouped into square clusters by their center. Polygons with a
+/// neighbor in another cluster are portals, and the cost between every pair
+/// of portals inside a cluster is precomputed, so a corridor search only
+/// visits portals instead of every polygon.
+class NavClusterGraph {
+public:
+    static constexpr std::uint32_t k_invalid = std::numeric_limits<std::uint32_t>::max();
+
+    explicit NavClusterGraph(float cluster_size = 16.0f);
+
+    /// @brief Rebuild every cluster from the mesh
+    void build(const INavMesh& mesh);
+
+    /// @brief Refresh clusters within one cluster of a changed region
+    /// (e.g. after NavMesh::set_tile or NavMeshBuilder::rebuild_tile)
+    void update_region(const INavMesh& mesh,
+                       const void_math::Vec3& min,
+                       const void_math::Vec3& max);
+
+    /// @brief Ordered clusters a path from start to goal passes through
+    /// @return Empty if the goal is unreachable
+    std::vector<std::uint32_t> find_corridor(const INavMesh& mesh,
+                                             std::uint32_t start_polygon,
+                                             std::uint32_t goal_polygon) const;
+
+    std::uint32_t cluster_of(std::uint32_t polygon) const {
+        return polygon < m_polygon_cluster.size() ? m_polygon_cluster[polygon] : k_invalid;
+    }
+
+    std::size_t cluster_count() const { return m_clusters.size(); }
+    std::size_t portal_count() const;
+    float cluster_size() const { return m_cluster_size; }
+
+private:
+    struct Cluster {
+        std::vector<std::uint32_t> polygons;
+        std::vector<std::uint32_t> portals;
+        std::vector<float> portal_costs;  ///< portals x portals, row-major
+    };
+
+    std::uint32_t cluster_at(const void_math::Vec3& position);
+    void assign_polygons(const INavMesh& mesh);
+    void compute_portals(const INavMesh& mesh, std::uint32_t cluster);
+    std::vector<float> local_costs(const INavMesh& mesh,
+                                   std::uint32_t cluster,
+                                   std::uint32_t source) const;
+
+    float m_cluster_size;
+    std::unordered_map<std::uint64_t, std::uint32_t> m_cells;
+    std::vector<Cluster> m_clusters;
+    std::vector<std::uint32_t> m_polygon_cluster;
+    std::vector<std::uint32_t> m_portal_index;
+};
+
+/// @brief LRU cache of cluster corridors keyed by (start cluster, goal cluster)
+///
+/// Thread-safe; shared by all searches of a NavPathQueue.
+class NavCorridorCache {
+public:
+    explicit NavCorridorCache(std::size_t capacity = 256);
+
+    bool find(std::uint32_t start_cluster,
+              std::uint32_t goal_cluster,
+              std::vector<std::uint32_t>& out_corridor);
+    void store(std::uint32_t start_cluster,
+               std::uint32_t goal_cluster,
+               std::vector<std::uint32_t> corridor);
+    void clear();
+
+    void set_capacity(std::size_t capacity);
+    std::size_t capacity() const;
+    std::size_t size() const;
+
+    // Statistics
+    std::size_t hits() const;
+    std::size_t misses() const;
+
+private:
+    struct Entry {
+        std::uint64_t key{0};
+        std::vector<std::uint32_t> corridor;
+    };
+
+    void trim();
 
-    // Build phases
-    void rasterize_triangles(std::vector<std::vector<float>>& heightfield);
-    void filter_walkable(std::vector<std::vector<float>>& heightfield);
-    void build_regions(std::vector<std::vector<std::uint32_t>>& regions);
-    void build_contours(const std::vector<std::vector<std::uint32_t>>& regions,
-                        std::vector<std::vector<void_math::Vec3>>& contours);
-    void triangulate_contours(const std::vector<std::vector<void_math::Vec3>>& contours,
-                              NavMesh& mesh);
+    mutable std::mutex m_mutex;
+    std::list<Entry> m_entries;  ///< Most recently used first
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> m_index;
+    std::size_t m_capacity;
+    std::size_t m_hits{0};
+    std::size_t m_misses{0};
 };
 
 // =============================================================================
@@ -221,21 +424,51 @@ private:
 // =============================================================================
 
 /// @brief A* pathfinding query on navigation mesh
+///
+/// With a cluster graph attached, searches are first restricted to the
+/// clusters of a corridor found on the cluster graph (or taken from the
+/// corridor cache) and widen only if that fails.
 class NavMeshQuery {
 public:
     explicit NavMeshQuery(const INavMesh* navmesh);
 
+    /// @brief Resumable search state, advanced by continue_search()
+    struct Search;
+    struct SearchDeleter {
+        void operator()(Search* search) const;
+    };
+    using SearchHandle = std::unique_ptr<Search, SearchDeleter>;
+
     /// @brief Find path between two points
     PathResult find_path(const void_math::Vec3& start,
                          const void_math::Vec3& end,
                          const NavAgentConfig& agent = NavAgentConfig{}) const;
 
     /// @brief Find partial path (useful for very long paths)
+    ///
+    /// Stops after max_nodes expansions and returns the path to the polygon
+    /// closest to the goal.
     PathResult find_partial_path(const void_math::Vec3& start,
                                   const void_math::Vec3& end,
                                   std::size_t max_nodes,
                                   const NavAgentConfig& agent = NavAgentConfig{}) const;
 
+    // Time-sliced search
+    /// @brief Start a search; pass a finished handle as reuse to keep its node storage
+    SearchHandle begin_search(const void_math::Vec3& start,
+                              const void_math::Vec3& end,
+                              std::size_t max_nodes = 0,
+                              SearchHandle reuse = {}) const;
+
+    /// @brief Expand at most max_iterations nodes
+    /// @return True once the search has finished
+    bool continue_search(Search& search,
+                         std::size_t max_iterations,
+                         std::size_t* out_iterations = nullptr) const;
+
+    /// @brief Build the result of a finished search
+    PathResult finish_search(const Search& search) const;
+
     /// @brief Smooth path using string-pulling algorithm
     void smooth_path(PathResult& path) const;
 
@@ -253,32 +486,92 @@ public:
     using PolygonFilter = std::function<bool(std::uint32_t polygon_index)>;
     void set_filter(PolygonFilter filter) { m_filter = std::move(filter); }
 
-private:
-    struct AStarNode {
-        std::uint32_t polygon{0};
-        std::uint32_t parent{0};
-        float g_cost{0};
-        float h_cost{0};
-        float f_cost() const { return g_cost + h_cost; }
-
-        bool operator>(const AStarNode& other) const {
-            return f_cost() > other.f_cost();
-        }
-    };
+    // Hierarchical pathfinding
+    void set_cluster_graph(const NavClusterGraph* graph) { m_clusters = graph; }
+    void set_corridor_cache(NavCorridorCache* cache) { m_corridor_cache = cache; }
+    const NavClusterGraph* cluster_graph() const { return m_clusters; }
 
+private:
     const INavMesh* m_navmesh;
     PolygonFilter m_filter;
+    const NavClusterGraph* m_clusters{nullptr};
+    NavCorridorCache* m_corridor_cache{nullptr};
 
     float heuristic(const void_math::Vec3& from, const void_math::Vec3& to) const;
-    std::vector<std::uint32_t> reconstruct_path(
-        const std::unordered_map<std::uint32_t, std::uint32_t>& came_from,
-        std::uint32_t current) const;
+    void select_corridor(Search& search) const;
+    void restart_search(Search& search) const;
+    std::vector<std::uint32_t> reconstruct_path(const Search& search,
+                                                std::uint32_t current) const;
     void string_pull(const std::vector<std::uint32_t>& polygon_path,
                     const void_math::Vec3& start,
                     const void_math::Vec3& end,
                     PathResult& result) const;
 };
 
+// =============================================================================
+// Path Request Queue
+// =============================================================================
+
+/// @brief Time-sliced queue of asynchronous path requests
+///
+/// process() spends a fixed budget of node expansions per call, spread over
+/// worker threads, so a burst of requests is answered over several frames
+/// instead of stalling one. Finished results are smoothed and kept until
+/// poll() takes them.
+class NavPathQueue {
+public:
+    NavPathQueue();
+    ~NavPathQueue();
+
+    NavPathQueue(const NavPathQueue&) = delete;
+    NavPathQueue& operator=(const NavPathQueue&) = delete;
+
+    /// @brief Set the mesh and hierarchy searched; restarts pending searches if they change
+    void bind(const INavMesh* navmesh,
+              const NavClusterGraph* clusters = nullptr,
+              NavCorridorCache* cache = nullptr);
+
+    PathId request(const void_math::Vec3& start, const void_math::Vec3& end);
+    void cancel(PathId id);
+    void clear();
+
+    /// @brief Advance pending searches by about max_iterations node expansions in total
+    /// @return Number of requests finished by this call
+    std::size_t process(std::size_t max_iterations);
+
+    /// @brief Take the result of a finished request
+    bool poll(PathId id, PathResult& out_result);
+    bool is_pending(PathId id) const;
+
+    // Worker threads used by process() (0 = hardware concurrency)
+    void set_max_workers(std::size_t count) { m_max_workers = count; }
+    std::size_t max_workers() const { return m_max_workers; }
+
+    // Statistics
+    std::size_t pending_count() const { return m_pending.size(); }
+    std::size_t completed_count() const { return m_completed.size(); }
+
+private:
+    struct Request {
+        PathId id;
+        void_math::Vec3 start{};
+        void_math::Vec3 end{};
+        NavMeshQuery::SearchHandle search;
+        bool started{false};
+        bool done{false};
+        PathResult result;
+    };
+
+    NavMeshQuery m_query{nullptr};
+    const INavMesh* m_navmesh{nullptr};
+    const NavClusterGraph* m_clusters{nullptr};
+    std::vector<Request> m_pending;
+    std::vector<NavMeshQuery::SearchHandle> m_spare_searches;
+    std::unordered_map<PathId, PathResult> m_completed;
+    std::uint32_t m_next_id{1};
+    std::size_t m_max_workers{0};
+};
+
 // =============================================================================
 // Navigation Path
 // =============================================================================
@@ -337,6 +630,24 @@ public:
     // Update
     void update(float dt, NavMeshQuery& query);
 
+    /// @brief Move along the current path without querying for a new one
+    void update_movement(float dt);
+
+    /// @brief Velocity toward the current path target at full speed
+    void_math::Vec3 desired_velocity() const;
+
+    /// @brief Steer toward this velocity instead of the path on the next update
+    /// (set by CrowdSystem after collision avoidance)
+    void set_avoidance_velocity(const void_math::Vec3& velocity) {
+        m_avoidance_velocity = velocity;
+        m_has_avoidance_velocity = true;
+    }
+
+    // Asynchronous path requests (driven by NavigationSystem)
+    bool path_pending() const { return m_path_pending; }
+    void mark_path_requested() { m_path_pending = false; }
+    void receive_path(PathResult result);
+
     // State
     bool has_path() const { return m_path.is_valid(); }
     bool reached_destination() const { return m_path.reached_end(); }
@@ -386,6 +697,8 @@ private:
     float m_stopping_distance{0.1f};
     bool m_stopped{true};
     bool m_path_pending{false};
+    void_math::Vec3 m_avoidance_velocity{};
+    bool m_has_avoidance_velocity{false};
 
     PathCallback m_on_path_found;
     PathCallback m_on_path_failed;
@@ -417,6 +730,23 @@ public:
     // Queries
     NavMeshQuery create_query(NavMeshId mesh_id) const;
 
+    /// @brief Collision avoidance between agents; add agents with crowd().add_agent()
+    CrowdSystem& crowd() { return *m_crowd; }
+
+    // Hierarchical pathfinding
+    const NavClusterGraph* cluster_graph(NavMeshId mesh_id) const;
+    NavCorridorCache& corridor_cache() { return m_corridor_cache; }
+    NavPathQueue& path_queue() { return m_path_queue; }
+
+    /// @brief Refresh pathfinding data after part of a navmesh changed
+    void invalidate_region(NavMeshId mesh_id,
+                           const void_math::Vec3& min,
+                           const void_math::Vec3& max);
+
+    /// @brief Node expansions spent on queued path requests per update
+    void set_path_budget(std::size_t iterations) { m_path_budget = iterations; }
+    std::size_t path_budget() const { return m_path_budget; }
+
     // Update
     void update(float dt);
 
@@ -428,6 +758,12 @@ private:
     std::unordered_map<NavMeshId, std::unique_ptr<NavMesh>> m_navmeshes;
     std::unordered_map<std::string, NavMeshId> m_navmesh_names;
     std::unordered_map<AgentId, std::unique_ptr<NavAgent>> m_agents;
+    std::unordered_map<NavMeshId, std::unique_ptr<NavClusterGraph>> m_cluster_graphs;
+    NavCorridorCache m_corridor_cache;
+    NavPathQueue m_path_queue;
+    std::unordered_map<AgentId, PathId> m_path_requests;
+    std::unique_ptr<CrowdSystem> m_crowd;
+    std::size_t m_path_budget{4096};
     std::uint32_t m_next_navmesh_id{1};
     std::uint32_t m_next_agent_id{1};
     NavMeshId m_default_navmesh{};
@@ -7,7 +7,9 @@
 #include "types.hpp"
 
 #include <functional>
+#include <limits>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -37,6 +39,33 @@ public:
         const void_math::Vec3& perceiver_forward,
         const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) = 0;
 
+    /// @brief Update without running line of sight tests
+    ///
+    /// Stimuli that still need a clear line of sight are returned together
+    /// with a ray in @p out_rays and their index in @p out_ray_stimuli; the
+    /// caller removes those whose ray is blocked. Senses overriding this must
+    /// not invoke callbacks, so it can run on worker threads.
+    virtual std::vector<Stimulus> update_deferred(
+        const void_math::Vec3& perceiver_position,
+        const void_math::Vec3& perceiver_forward,
+        const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+        std::vector<LineOfSightRay>& out_rays,
+        std::vector<std::uint32_t>& out_ray_stimuli);
+
+    /// @brief Whether update_deferred() is overridden
+    virtual bool supports_deferred() const { return false; }
+
+    /// @brief Line of sight test used for deferred rays when no batch check is set
+    virtual bool line_of_sight(const void_math::Vec3& /*from*/, const void_math::Vec3& /*to*/) const {
+        return true;
+    }
+
+    /// @brief Farthest target distance the sense reacts to (bounds target gathering)
+    virtual float query_radius() const { return std::numeric_limits<float>::infinity(); }
+
+    /// @brief Whether updates may be skipped and the last results reused
+    virtual bool is_staggered() const { return false; }
+
     /// @brief Enable/disable the sense
     void set_enabled(bool enabled) { m_enabled = enabled; }
     bool is_enabled() const { return m_enabled; }
@@ -68,6 +97,18 @@ public:
         const void_math::Vec3& perceiver_forward,
         const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) override;
 
+    std::vector<Stimulus> update_deferred(
+        const void_math::Vec3& perceiver_position,
+        const void_math::Vec3& perceiver_forward,
+        const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+        std::vector<LineOfSightRay>& out_rays,
+        std::vector<std::uint32_t>& out_ray_stimuli) override;
+
+    bool supports_deferred() const override { return true; }
+    bool line_of_sight(const void_math::Vec3& from, const void_math::Vec3& to) const override;
+    float query_radius() const override;
+    bool is_staggered() const override { return true; }
+
     // Configuration
     void set_config(const SightConfig& config) { m_config = config; }
     const SightConfig& config() const { return m_config; }
@@ -104,6 +145,8 @@ public:
         const void_math::Vec3& perceiver_forward,
         const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) override;
 
+    float query_radius() const override { return 0.0f; }
+
     // Sound events
     void add_sound_event(const void_math::Vec3& position,
                         float loudness,
@@ -151,6 +194,8 @@ public:
         const void_math::Vec3& perceiver_forward,
         const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) override;
 
+    float query_radius() const override { return 0.0f; }
+
     // Damage events
     void register_damage(const void_math::Vec3& damage_position,
                         const void_math::Vec3& damage_direction,
@@ -193,6 +238,17 @@ public:
         const void_math::Vec3& perceiver_forward,
         const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) override;
 
+    std::vector<Stimulus> update_deferred(
+        const void_math::Vec3& perceiver_position,
+        const void_math::Vec3& perceiver_forward,
+        const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+        std::vector<LineOfSightRay>& out_rays,
+        std::vector<std::uint32_t>& out_ray_stimuli) override;
+
+    bool supports_deferred() const override { return true; }
+    bool line_of_sight(const void_math::Vec3& from, const void_math::Vec3& to) const override;
+    float query_radius() const override { return m_config.range * m_range_multiplier; }
+
     // Configuration
     void set_config(const ProximityConfig& config) { m_config = config; }
     const ProximityConfig& config() const { return m_config; }
@@ -238,6 +294,30 @@ public:
     // Update perception
     void update(float dt, const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets);
 
+    /// @brief First half of a split update: run the deferrable senses
+    ///
+    /// Thread-safe with respect to other components. Line of sight tests are
+    /// collected in pending_rays() instead of being run.
+    /// @param refresh_staggered Re-evaluate staggered senses rather than reusing their last results
+    void begin_update(const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+                      bool refresh_staggered);
+
+    /// @brief Line of sight rays collected by the last begin_update()
+    const std::vector<LineOfSightRay>& pending_rays() const { return m_pending_rays; }
+
+    /// @brief Second half of a split update: apply ray results, run the remaining senses
+    /// @param ray_visible One entry per pending ray, or empty to use each sense's own LOS check
+    void finish_update(float dt,
+                       const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+                       std::span<const std::uint8_t> ray_visible);
+
+    /// @brief Largest query radius of the enabled senses
+    float query_radius() const;
+
+    // Scheduling priority (higher refreshes staggered senses more often)
+    void set_priority(float priority) { m_priority = priority; }
+    float priority() const { return m_priority; }
+
     // Known targets
     const std::vector<KnownTarget>& known_targets() const { return m_known_targets; }
     bool knows_target(PerceptionTargetId id) const;
@@ -278,6 +358,20 @@ private:
     PerceptionCallback m_on_gained;
     PerceptionCallback m_on_lost;
 
+    // Split update state: stimuli per sense (kept across updates for
+    // staggered senses) and the deferred rays with their owning stimulus
+    std::vector<std::vector<Stimulus>> m_sense_stimuli;
+    std::vector<std::uint8_t> m_sense_fresh;
+    std::vector<LineOfSightRay> m_pending_rays;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> m_pending_ray_owners;
+    std::vector<std::uint32_t> m_ray_scratch;
+
+    // Scheduling state owned by PerceptionSystem
+    friend class PerceptionSystem;
+    float m_priority{1.0f};
+    float m_stagger_elapsed{0};
+    std::vector<std::pair<PerceptionTargetId, void_math::Vec3>> m_candidates;
+
     void process_stimuli(const std::vector<Stimulus>& stimuli, float dt);
     void update_known_targets(float dt);
     void fire_gained_event(const KnownTarget& target, const Stimulus& stimulus);
@@ -341,11 +435,35 @@ private:
 // =============================================================================
 
 /// @brief High-level perception management system
+///
+/// Each update rebuilds a spatial hash of the stimulus sources, so every
+/// perceiver only receives the targets within its senses' query radius.
+/// Deferrable senses run on worker threads, and their line of sight rays are
+/// resolved together through the batch LOS check. Sight is staggered: with a
+/// focus point set (usually the player), perceivers further away refresh it
+/// less often, scaled by their priority.
 class PerceptionSystem {
 public:
     PerceptionSystem();
+    explicit PerceptionSystem(const PerceptionSystemConfig& config);
     ~PerceptionSystem();
 
+    // Configuration
+    void set_config(const PerceptionSystemConfig& config) { m_config = config; }
+    const PerceptionSystemConfig& config() const { return m_config; }
+
+    // Staggering focus
+    void set_focus(const void_math::Vec3& position) { m_focus = position; m_has_focus = true; }
+    void clear_focus() { m_has_focus = false; }
+
+    /// @brief Resolve all line of sight rays of an update in one call
+    ///
+    /// Writes 1 (clear) or 0 (blocked) per ray, e.g. from a batched physics
+    /// raycast. Without it, each sense's own LOS callback is used.
+    using LOSBatchCheck = std::function<void(std::span<const LineOfSightRay> rays,
+                                             std::span<std::uint8_t> out_visible)>;
+    void set_los_batch_check(LOSBatchCheck check) { m_los_batch_check = std::move(check); }
+
     // Perceiver management
     PerceptionComponent* create_perceiver();
     void destroy_perceiver(PerceptionComponent* perceiver);
@@ -359,7 +477,11 @@ public:
     // Update all perceivers
     void update(float dt);
 
-    // Query
+    /// @brief Sources within radius
+    ///
+    /// Uses the spatial hash built by the last update(), so sources are found
+    /// by the cell they occupied then. Falls back to a linear scan while no
+    /// hash is available.
     std::vector<StimulusSource*> get_sources_in_radius(const void_math::Vec3& center,
                                                        float radius) const;
 
@@ -378,6 +500,7 @@ public:
                         float duration = 1.0f);
 
 private:
+    PerceptionSystemConfig m_config;
     std::vector<std::unique_ptr<PerceptionComponent>> m_perceivers;
     std::vector<std::unique_ptr<StimulusSource>> m_sources;
     std::unordered_map<PerceptionTargetId, StimulusSource*> m_target_map;
@@ -386,8 +509,29 @@ private:
     // Team relations (pair of team IDs -> hostile)
     std::unordered_map<std::uint64_t, bool> m_team_relations;
 
+    // Source spatial hash on the XZ plane (counting sort by cell)
+    std::vector<std::uint32_t> m_cell_start;
+    std::vector<std::uint32_t> m_cell_sources;
+    std::vector<std::uint32_t> m_source_cell;
+    float m_cell_size{1.0f};
+    bool m_index_valid{false};
+
+    // Staggering and batched line of sight
+    void_math::Vec3 m_focus{};
+    bool m_has_focus{false};
+    LOSBatchCheck m_los_batch_check;
+    std::vector<std::uint8_t> m_refresh;
+    std::vector<LineOfSightRay> m_rays;
+    std::vector<std::uint8_t> m_ray_visible;
+    std::vector<std::size_t> m_ray_offsets;
+
     std::uint64_t make_team_key(std::uint32_t a, std::uint32_t b) const;
-    std::vector<std::pair<PerceptionTargetId, void_math::Vec3>> gather_targets() const;
+
+    void build_source_index();
+    template<typename Fn>
+    void for_each_source_in_radius(const void_math::Vec3& center, float radius, Fn&& fn) const;
+    void gather_candidates(PerceptionComponent& perceiver) const;
+    float sight_interval(const PerceptionComponent& perceiver) const;
 };
 
 // =============================================================================
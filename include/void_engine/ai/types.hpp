@@ -77,6 +77,19 @@ using ActionCallback = std::function<NodeStatus(float dt)>;
 /// @brief Callback for condition nodes
 using ConditionCallback = std::function<bool()>;
 
+/// @brief Agent a shared behavior tree is being ticked for
+struct BehaviorContext {
+    BehaviorAgentId agent{};
+    IBlackboard* blackboard{nullptr};
+    void* user_data{nullptr};
+};
+
+/// @brief Callback for action nodes of shared (flattened) trees
+using BehaviorActionFn = std::function<NodeStatus(const BehaviorContext& context, float dt)>;
+
+/// @brief Callback for condition nodes of shared (flattened) trees
+using BehaviorConditionFn = std::function<bool(const BehaviorContext& context)>;
+
 /// @brief Blackboard value variant
 using BlackboardValue = std::variant<
     bool,
@@ -188,6 +201,8 @@ struct NavMeshBuildConfig {
     float detail_sample_max_error{1.0f};
     bool partition_monotone{false};
     bool keep_inter_results{false};
+    std::uint32_t tile_size{64};           ///< Tile edge length in cells
+    std::uint32_t max_build_threads{0};    ///< Tile build workers (0 = hardware concurrency)
 };
 
 // =============================================================================
@@ -270,6 +285,20 @@ struct FlockingParams {
     float separation_radius{1.0f};
 };
 
+/// @brief Crowd simulation settings
+struct CrowdConfig {
+    float neighbor_radius{5.0f};        ///< Range of neighbours considered for avoidance
+    std::uint32_t max_neighbors{10};    ///< Closest neighbours kept per agent
+    float time_horizon{2.0f};           ///< Seconds ahead collisions are avoided
+    std::size_t max_workers{0};         ///< Worker threads (0 = hardware concurrency)
+};
+
+/// @brief Per-agent crowd parameters
+struct CrowdAgentParams {
+    float radius{0.5f};
+    float max_speed{3.5f};
+};
+
 // =============================================================================
 // Perception Types
 // =============================================================================
@@ -359,6 +388,23 @@ struct KnownTarget {
     std::uint32_t team{0};
 };
 
+/// @brief Line of sight test collected for a batched raycast
+struct LineOfSightRay {
+    void_math::Vec3 from{};
+    void_math::Vec3 to{};
+    std::uint32_t collision_mask{0xFFFFFFFF};
+};
+
+/// @brief Perception system update configuration
+struct PerceptionSystemConfig {
+    float cell_size{10.0f};             ///< Stimulus source hash cell size
+    float near_distance{30.0f};         ///< Distance from the focus refreshed at near_interval
+    float far_distance{120.0f};         ///< Distance from the focus refreshed at far_interval
+    float near_interval{0.0f};          ///< Seconds between sight refreshes (0 = every update)
+    float far_interval{0.5f};
+    std::uint32_t max_workers{0};       ///< Sensing threads (0 = hardware concurrency)
+};
+
 // =============================================================================
 // AI System Configuration
 // =============================================================================
@@ -15,10 +15,12 @@
 /// - TTL support for forced revalidation
 /// - Prefetch hints for predictive loading
 
+#include <void_engine/asset/mapped_file.hpp>
 #include <void_engine/core/id.hpp>
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
@@ -29,6 +31,7 @@
 #include <optional>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -277,108 +280,93 @@ private:
 // Warm Cache (Disk-Based)
 // =============================================================================
 
-/// Disk-based cache with content-addressable storage
-class WarmCache {
-public:
-    /// Create warm cache at the specified directory
-    explicit WarmCache(std::filesystem::path cache_dir)
-        : m_cache_dir(std::move(cache_dir)) {
-        std::filesystem::create_directories(m_cache_dir);
-        std::filesystem::create_directories(m_cache_dir / "data");
-        std::filesystem::create_directories(m_cache_dir / "meta");
-        load_index();
-    }
+/// Configuration for the warm (disk) cache
+struct WarmCacheConfig {
+    /// Write on a background thread (false = put() writes synchronously)
+    bool write_behind = true;
+    /// Maximum number of queued operations written per batch
+    std::size_t write_batch_size = 64;
+    /// How long the writer waits for more operations before writing a batch
+    std::chrono::milliseconds flush_interval{2};
+    /// Compact once the log holds at least this many records...
+    std::size_t compaction_min_records = 4096;
+    /// ...and at least this fraction of the snapshot's entry count
+    float compaction_ratio = 0.5f;
 
-    /// Get entry from disk cache
-    [[nodiscard]] std::shared_ptr<CacheEntry> get(const std::string& key) {
-        std::shared_lock lock(m_mutex);
-
-        auto it = m_index.find(key);
-        if (it == m_index.end()) {
-            return nullptr;
-        }
+    WarmCacheConfig& with_write_behind(bool enabled) {
+        write_behind = enabled;
+        return *this;
+    }
 
-        // Load from disk
-        auto entry = load_entry(key, it->second);
-        if (entry) {
-            ++m_read_count;
-        }
-        return entry;
+    WarmCacheConfig& with_write_batch_size(std::size_t count) {
+        write_batch_size = count;
+        return *this;
     }
 
-    /// Put entry to disk cache
-    void put(const std::string& key, std::shared_ptr<CacheEntry> entry) {
-        std::unique_lock lock(m_mutex);
+    WarmCacheConfig& with_flush_interval(std::chrono::milliseconds interval) {
+        flush_interval = interval;
+        return *this;
+    }
 
-        if (save_entry(key, entry)) {
-            m_index[key] = entry->meta;
-            m_total_bytes += entry->meta.size_bytes;
-            ++m_write_count;
-        }
+    WarmCacheConfig& with_compaction_min_records(std::size_t count) {
+        compaction_min_records = count;
+        return *this;
     }
+};
 
-    /// Remove entry from disk cache
-    bool remove(const std::string& key) {
-        std::unique_lock lock(m_mutex);
+/// Disk-based cache with content-addressable storage
+///
+/// Layout under the cache directory:
+/// - blobs/xx/<hash>.bin  Payloads keyed by content hash; identical payloads
+///                        stored under different keys share one blob
+/// - index.snap           Compacted index: an open-addressing hash table
+///                        over key records, queried in place through mmap
+/// - index.log            Append-only log of puts/removes since the snapshot
+///
+/// Opening the cache maps the snapshot (no parsing) and replays only the
+/// log tail. put()/remove() update the in-memory view immediately and queue
+/// the disk work for a writer thread, which writes blobs and appends index
+/// records in batches. Once the log grows large enough the writer rewrites
+/// the snapshot, truncates the log and deletes unreferenced blobs.
+class WarmCache {
+public:
+    /// Create warm cache at the specified directory
+    explicit WarmCache(std::filesystem::path cache_dir, WarmCacheConfig config = {});
+    ~WarmCache();
 
-        auto it = m_index.find(key);
-        if (it == m_index.end()) {
-            return false;
-        }
+    WarmCache(const WarmCache&) = delete;
+    WarmCache& operator=(const WarmCache&) = delete;
 
-        auto data_path = get_data_path(key);
-        auto meta_path = get_meta_path(key);
+    /// Get entry from disk cache
+    [[nodiscard]] std::shared_ptr<CacheEntry> get(const std::string& key);
 
-        std::error_code ec;
-        std::filesystem::remove(data_path, ec);
-        std::filesystem::remove(meta_path, ec);
+    /// Put entry to disk cache (written by the background writer)
+    /// The entry is shared with the writer and must not be modified afterwards.
+    void put(const std::string& key, std::shared_ptr<CacheEntry> entry);
 
-        m_total_bytes -= it->second.size_bytes;
-        m_index.erase(it);
-        return true;
-    }
+    /// Remove entry from disk cache
+    bool remove(const std::string& key);
 
     /// Check if key exists
-    [[nodiscard]] bool contains(const std::string& key) const {
-        std::shared_lock lock(m_mutex);
-        return m_index.find(key) != m_index.end();
-    }
+    [[nodiscard]] bool contains(const std::string& key) const;
 
     /// Get metadata without loading data
-    [[nodiscard]] std::optional<CacheEntryMeta> get_meta(const std::string& key) const {
-        std::shared_lock lock(m_mutex);
-        auto it = m_index.find(key);
-        if (it == m_index.end()) {
-            return std::nullopt;
-        }
-        return it->second;
-    }
+    [[nodiscard]] std::optional<CacheEntryMeta> get_meta(const std::string& key) const;
 
     /// Clear all entries
-    void clear() {
-        std::unique_lock lock(m_mutex);
+    void clear();
 
-        std::error_code ec;
-        std::filesystem::remove_all(m_cache_dir / "data", ec);
-        std::filesystem::remove_all(m_cache_dir / "meta", ec);
-        std::filesystem::create_directories(m_cache_dir / "data");
-        std::filesystem::create_directories(m_cache_dir / "meta");
+    /// Block until all queued writes are on disk
+    void flush();
 
-        m_index.clear();
-        m_total_bytes = 0;
-    }
+    /// Rewrite the index snapshot and delete unreferenced blobs
+    void compact();
 
-    /// Get total size in bytes
-    [[nodiscard]] std::size_t size_bytes() const {
-        std::shared_lock lock(m_mutex);
-        return m_total_bytes;
-    }
+    /// Get total size in bytes (logical, before deduplication)
+    [[nodiscard]] std::size_t size_bytes() const;
 
     /// Get entry count
-    [[nodiscard]] std::size_t count() const {
-        std::shared_lock lock(m_mutex);
-        return m_index.size();
-    }
+    [[nodiscard]] std::size_t count() const;
 
     /// Get read count
     [[nodiscard]] std::uint64_t read_count() const { return m_read_count; }
@@ -386,124 +374,79 @@ public:
     /// Get write count
     [[nodiscard]] std::uint64_t write_count() const { return m_write_count; }
 
-private:
-    [[nodiscard]] std::filesystem::path get_data_path(const std::string& key) const {
-        // Use hash-based subdirectories to avoid too many files in one dir
-        auto hash = std::hash<std::string>{}(key);
-        auto subdir = std::to_string(hash % 256);
-        return m_cache_dir / "data" / subdir / (key + ".bin");
-    }
-
-    [[nodiscard]] std::filesystem::path get_meta_path(const std::string& key) const {
-        auto hash = std::hash<std::string>{}(key);
-        auto subdir = std::to_string(hash % 256);
-        return m_cache_dir / "meta" / subdir / (key + ".json");
-    }
+    /// Get number of writes whose payload was already stored
+    [[nodiscard]] std::uint64_t dedup_count() const { return m_dedup_count; }
 
-    void load_index() {
-        // Scan meta directory to rebuild index
-        std::error_code ec;
-        for (const auto& entry : std::filesystem::recursive_directory_iterator(m_cache_dir / "meta", ec)) {
-            if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                auto key = entry.path().stem().string();
-                auto meta = load_meta(entry.path());
-                if (meta) {
-                    m_index[key] = *meta;
-                    m_total_bytes += meta->size_bytes;
-                }
-            }
-        }
-    }
+    /// Get number of records in the log since the last compaction
+    [[nodiscard]] std::size_t log_record_count() const;
 
-    [[nodiscard]] std::optional<CacheEntryMeta> load_meta(const std::filesystem::path& path) const {
-        // Simplified JSON parsing - in production use a proper JSON library
-        std::ifstream file(path);
-        if (!file) return std::nullopt;
+    /// Get configuration
+    [[nodiscard]] const WarmCacheConfig& config() const { return m_config; }
 
+private:
+    struct IndexRecord {
         CacheEntryMeta meta;
-        std::string line;
-        while (std::getline(file, line)) {
-            // Parse simple key: value format
-            auto pos = line.find(':');
-            if (pos == std::string::npos) continue;
-
-            auto key = line.substr(0, pos);
-            auto value = line.substr(pos + 1);
-            // Trim whitespace
-            while (!key.empty() && std::isspace(key.back())) key.pop_back();
-            while (!value.empty() && std::isspace(value.front())) value.erase(0, 1);
-
-            if (key == "content_hash") meta.content_hash = value;
-            else if (key == "etag") meta.etag = value;
-            else if (key == "last_modified") meta.last_modified = value;
-            else if (key == "size_bytes") meta.size_bytes = std::stoull(value);
-            else if (key == "priority") meta.priority = static_cast<CachePriority>(std::stoi(value));
-            else if (key == "source_url") meta.source_url = value;
-            else if (key == "asset_type") meta.asset_type = value;
-        }
-
-        return meta;
-    }
-
-    bool save_meta(const std::filesystem::path& path, const CacheEntryMeta& meta) const {
-        std::filesystem::create_directories(path.parent_path());
-        std::ofstream file(path);
-        if (!file) return false;
-
-        file << "content_hash: " << meta.content_hash << "\n";
-        file << "etag: " << meta.etag << "\n";
-        file << "last_modified: " << meta.last_modified << "\n";
-        file << "size_bytes: " << meta.size_bytes << "\n";
-        file << "priority: " << static_cast<int>(meta.priority) << "\n";
-        file << "source_url: " << meta.source_url << "\n";
-        file << "asset_type: " << meta.asset_type << "\n";
-
-        return true;
-    }
-
-    [[nodiscard]] std::shared_ptr<CacheEntry> load_entry(
-        const std::string& key, const CacheEntryMeta& meta) const {
-
-        auto data_path = get_data_path(key);
-        std::ifstream file(data_path, std::ios::binary);
-        if (!file) return nullptr;
-
-        auto entry = std::make_shared<CacheEntry>();
-        entry->meta = meta;
-        entry->meta.last_access = std::chrono::steady_clock::now();
+        std::string blob;
+    };
 
-        file.seekg(0, std::ios::end);
-        auto size = file.tellg();
-        file.seekg(0, std::ios::beg);
+    // entry == nullptr marks a queued removal
+    struct PendingOp {
+        std::shared_ptr<CacheEntry> entry;
+        std::uint64_t seq = 0;
+    };
 
-        entry->data.resize(static_cast<std::size_t>(size));
-        file.read(reinterpret_cast<char*>(entry->data.data()), size);
+    struct QueuedOp {
+        std::string key;
+        std::shared_ptr<CacheEntry> entry;
+        std::uint64_t seq = 0;
+    };
 
-        return entry;
-    }
+    [[nodiscard]] std::filesystem::path blob_path(const std::string& hash) const;
 
-    bool save_entry(const std::string& key, std::shared_ptr<CacheEntry> entry) {
-        auto data_path = get_data_path(key);
-        auto meta_path = get_meta_path(key);
+    void open_index();
+    void replay_log();
+    void reset_log();
 
-        std::filesystem::create_directories(data_path.parent_path());
+    [[nodiscard]] std::optional<IndexRecord> find_snapshot(const std::string& key) const;
+    [[nodiscard]] std::optional<IndexRecord> find_flushed(const std::string& key) const;
+    [[nodiscard]] std::optional<CacheEntryMeta> find_meta_unlocked(const std::string& key) const;
+    void track_unlocked(const std::string& key, const CacheEntryMeta* meta);
 
-        // Save data
-        std::ofstream data_file(data_path, std::ios::binary);
-        if (!data_file) return false;
-        data_file.write(reinterpret_cast<const char*>(entry->data.data()),
-                        static_cast<std::streamsize>(entry->data.size()));
+    void enqueue_unlocked(const std::string& key, std::shared_ptr<CacheEntry> entry);
+    void writer_loop();
+    void write_batch(std::vector<QueuedOp>& batch, std::uint64_t generation);
+    void compact_locked();
 
-        // Save metadata
-        return save_meta(meta_path, entry->meta);
-    }
+    WarmCacheConfig m_config;
+    std::filesystem::path m_cache_dir;
 
+    // Index state (m_mutex)
     mutable std::shared_mutex m_mutex;
-    std::filesystem::path m_cache_dir;
-    std::unordered_map<std::string, CacheEntryMeta> m_index;
+    MappedFile m_snapshot;
+    std::size_t m_snapshot_buckets = 0;
+    std::unordered_map<std::string, std::optional<IndexRecord>> m_log_index;  // nullopt = removed
+    std::unordered_map<std::string, PendingOp> m_pending;
+    std::size_t m_count = 0;
     std::size_t m_total_bytes = 0;
+    std::size_t m_log_records = 0;
+    std::uint64_t m_next_seq = 1;
+
+    // Writer state (m_queue_mutex); m_io_mutex is held while touching files
+    std::mutex m_io_mutex;
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_cv;
+    std::condition_variable m_idle_cv;
+    std::vector<QueuedOp> m_queue;
+    std::uint64_t m_generation = 0;
+    bool m_writer_busy = false;
+    bool m_flush_requested = false;
+    bool m_stop = false;
+    std::thread m_writer;
+    std::ofstream m_log;
+
     std::atomic<std::uint64_t> m_read_count{0};
     std::atomic<std::uint64_t> m_write_count{0};
+    std::atomic<std::uint64_t> m_dedup_count{0};
 };
 
 // =============================================================================
@@ -522,6 +465,8 @@ struct TieredCacheConfig {
     std::chrono::seconds default_ttl{0};
     /// Auto-promote from warm to hot on access
     bool auto_promote = true;
+    /// Disk cache settings
+    WarmCacheConfig warm_cache;
 };
 
 /// Three-tier cache: Hot (memory) → Warm (disk) → Cold (remote)
@@ -530,7 +475,7 @@ public:
     explicit TieredCache(TieredCacheConfig config = {})
         : m_config(std::move(config))
         , m_hot_cache(m_config.hot_cache_bytes)
-        , m_warm_cache(m_config.disk_cache_dir)
+        , m_warm_cache(m_config.disk_cache_dir, m_config.warm_cache)
     {
         // Set up eviction callback to persist to disk
         if (m_config.enable_disk_cache) {
@@ -0,0 +1,137 @@
+#pragma once
+
+/// @file dependency_graph.hpp
+/// @brief Persistent asset dependency graph for minimal cascading reloads
+///
+/// Loaders report what they depend on through LoadContext::add_dependency.
+/// The AssetServer records those edges here after every successful load or
+/// reload, so the graph always reflects the most recent version of each
+/// asset. Two kinds of edges are kept:
+/// - Asset edges (material -> texture asset)
+/// - File edges (shader -> included source that is not itself an asset)
+///
+/// Given a set of changed assets and files, plan() returns the minimal set
+/// of assets that must be reloaded, grouped into waves. Every asset in a
+/// wave depends only on assets from earlier waves, so a wave can be
+/// reloaded in parallel once the previous one has finished.
+
+#include "fwd.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace void_asset {
+
+// =============================================================================
+// AssetReloadPlan
+// =============================================================================
+
+/// Ordered reload schedule produced by AssetDependencyGraph::plan()
+struct AssetReloadPlan {
+    /// Topologically ordered waves; assets within a wave are independent
+    std::vector<std::vector<AssetId>> waves;
+    /// Assets that were changed directly (as opposed to cascaded)
+    std::unordered_set<AssetId> roots;
+    /// True if a dependency cycle was found; cyclic assets form the last wave
+    bool has_cycle = false;
+
+    /// Total number of assets to reload
+    [[nodiscard]] std::size_t size() const noexcept {
+        std::size_t count = 0;
+        for (const auto& wave : waves) {
+            count += wave.size();
+        }
+        return count;
+    }
+
+    /// Check if nothing needs reloading
+    [[nodiscard]] bool empty() const noexcept {
+        return waves.empty();
+    }
+
+    /// Check if an asset was changed directly
+    [[nodiscard]] bool is_root(AssetId id) const {
+        return roots.count(id) != 0;
+    }
+};
+
+// =============================================================================
+// AssetDependencyGraph
+// =============================================================================
+
+/// Thread-safe dependency DAG over loaded assets
+class AssetDependencyGraph {
+public:
+    /// Constructor
+    AssetDependencyGraph() = default;
+
+    /// Replace the outgoing edges of an asset
+    /// @param id Asset that was (re)loaded
+    /// @param path Path of that asset
+    /// @param deps Assets it depends on
+    /// @param file_deps Files it depends on that may not be assets themselves
+    void set_dependencies(AssetId id, const AssetPath& path,
+                          const std::vector<AssetId>& deps,
+                          const std::vector<AssetPath>& file_deps);
+
+    /// Remove an asset and its outgoing edges
+    void remove(AssetId id);
+
+    /// Remove everything
+    void clear();
+
+    /// Check if an asset is tracked
+    [[nodiscard]] bool contains(AssetId id) const;
+
+    /// Get number of tracked assets
+    [[nodiscard]] std::size_t node_count() const;
+
+    /// Get number of edges (asset and file)
+    [[nodiscard]] std::size_t edge_count() const;
+
+    /// Get direct dependencies of an asset (file edges resolved where possible)
+    [[nodiscard]] std::vector<AssetId> dependencies(AssetId id) const;
+
+    /// Get assets that directly depend on an asset
+    [[nodiscard]] std::vector<AssetId> dependents(AssetId id) const;
+
+    /// Get assets that directly depend on a file
+    [[nodiscard]] std::vector<AssetId> file_dependents(const AssetPath& path) const;
+
+    /// Compute the minimal invalidation set (changed assets plus everything
+    /// that transitively depends on them or on the changed files)
+    [[nodiscard]] std::unordered_set<AssetId> invalidation_set(
+        const std::vector<AssetId>& changed,
+        const std::vector<AssetPath>& changed_files = {}) const;
+
+    /// Compute a topologically ordered reload plan for a change set
+    /// @param cascade If false, only the directly changed assets are planned
+    [[nodiscard]] AssetReloadPlan plan(
+        const std::vector<AssetId>& changed,
+        const std::vector<AssetPath>& changed_files = {},
+        bool cascade = true) const;
+
+private:
+    struct Node {
+        AssetPath path;
+        std::vector<AssetId> deps;
+        std::vector<std::string> file_deps;
+    };
+
+    void unlink(AssetId id, const Node& node);
+    void collect_dependents(AssetId id, std::vector<AssetId>& out) const;
+    void collect_dependencies(const Node& node, std::vector<AssetId>& out) const;
+
+    std::unordered_map<AssetId, Node> m_nodes;
+    std::unordered_map<AssetId, std::unordered_set<AssetId>> m_dependents;
+    std::unordered_map<std::string, std::unordered_set<AssetId>> m_file_dependents;
+    std::unordered_map<std::string, AssetId> m_path_to_id;
+    mutable std::shared_mutex m_mutex;
+};
+
+} // namespace void_asset
@@ -41,6 +41,18 @@ struct AssetEvent;
 struct AssetChange;
 class AssetWatcher;
 class AssetHotReloadManager;
+struct AssetReloadBatch;
+
+// Dependencies
+struct AssetReloadPlan;
+class AssetDependencyGraph;
+
+// Streaming
+enum class StreamingCategory : std::uint8_t;
+struct StreamableDesc;
+struct ResidencyRequest;
+struct ResidencyEvent;
+class ResidencyManager;
 
 // Injector
 struct InjectorConfig;
@@ -7,6 +7,8 @@
 #include "types.hpp"
 #include "server.hpp"
 #include <void_engine/core/hot_reload.hpp>
+#include <void_engine/core/file_watcher.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -123,6 +125,35 @@ struct AssetReloadResult {
     }
 };
 
+// =============================================================================
+// AssetReloadBatch
+// =============================================================================
+
+/// All reloads triggered by one frame's worth of file changes
+struct AssetReloadBatch {
+    std::vector<AssetChangeEvent> changes;
+    std::vector<AssetReloadResult> results;
+    std::size_t wave_count = 0;
+    std::size_t cascaded_count = 0;
+    bool has_cycle = false;
+    std::chrono::milliseconds duration{0};
+
+    /// Check if the batch did anything
+    [[nodiscard]] bool empty() const noexcept {
+        return changes.empty() && results.empty();
+    }
+
+    /// Check if every reload succeeded
+    [[nodiscard]] bool all_succeeded() const noexcept {
+        for (const auto& result : results) {
+            if (!result.success) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
 // =============================================================================
 // FileModificationTracker
 // =============================================================================
@@ -398,11 +429,12 @@ private:
 
             {
                 std::lock_guard lock(m_events_mutex);
-                for (auto& event : new_events) {
-                    m_events.push_back(event);
-                    if (callback) {
-                        callback(event);
-                    }
+                m_events.insert(m_events.end(), new_events.begin(), new_events.end());
+            }
+
+            if (callback) {
+                for (const auto& event : new_events) {
+                    callback(event);
                 }
             }
         }
@@ -440,6 +472,187 @@ private:
     mutable std::mutex m_callback_mutex;
 };
 
+// =============================================================================
+// NativeAssetWatcher
+// =============================================================================
+
+/// Event-driven asset watcher on top of void_core::FileWatchService
+///
+/// All instances share the service's single OS handle and dispatch thread;
+/// changes are already coalesced and debounced when they arrive here.
+class NativeAssetWatcher : public AssetWatcher {
+public:
+    /// Constructor
+    NativeAssetWatcher()
+        : m_shared(std::make_shared<Shared>()) {}
+
+    /// Destructor
+    ~NativeAssetWatcher() override {
+        stop();
+    }
+
+    /// Start watching
+    void start() override {
+        if (m_watching.exchange(true)) {
+            return;
+        }
+
+        std::lock_guard lock(m_paths_mutex);
+        for (const auto& path : m_watch_paths) {
+            subscribe_unlocked(path);
+        }
+    }
+
+    /// Stop watching
+    void stop() override {
+        if (!m_watching.exchange(false)) {
+            return;
+        }
+
+        std::lock_guard lock(m_paths_mutex);
+        for (const auto& [path, id] : m_subscriptions) {
+            void_core::FileWatchService::instance().unsubscribe(id);
+        }
+        m_subscriptions.clear();
+    }
+
+    /// Check if watching
+    [[nodiscard]] bool is_watching() const override {
+        return m_watching.load();
+    }
+
+    /// Poll for changes
+    std::vector<AssetChangeEvent> poll() override {
+        std::lock_guard lock(m_shared->mutex);
+        std::vector<AssetChangeEvent> events;
+        std::swap(events, m_shared->events);
+        return events;
+    }
+
+    /// Add watch path
+    void add_path(const std::string& path) override {
+        std::lock_guard lock(m_paths_mutex);
+        if (!m_watch_paths.insert(path).second) {
+            return;
+        }
+        if (m_watching.load()) {
+            subscribe_unlocked(path);
+        }
+    }
+
+    /// Remove watch path
+    void remove_path(const std::string& path) override {
+        std::lock_guard lock(m_paths_mutex);
+        m_watch_paths.erase(path);
+
+        auto it = m_subscriptions.find(path);
+        if (it != m_subscriptions.end()) {
+            void_core::FileWatchService::instance().unsubscribe(it->second);
+            m_subscriptions.erase(it);
+        }
+    }
+
+    /// Add extension filter
+    void add_extension(const std::string& ext) override {
+        std::lock_guard lock(m_shared->mutex);
+        m_shared->extensions.insert(ext);
+    }
+
+    /// Set change callback
+    void set_callback(AssetChangeCallback callback) override {
+        std::lock_guard lock(m_shared->mutex);
+        m_shared->callback = std::move(callback);
+    }
+
+private:
+    /// State reachable from the dispatch thread
+    struct Shared {
+        std::mutex mutex;
+        std::set<std::string> extensions;
+        std::vector<AssetChangeEvent> events;
+        AssetChangeCallback callback;
+
+        [[nodiscard]] bool should_watch(const std::string& path) const {
+            if (extensions.empty()) {
+                return true;
+            }
+            auto pos = path.rfind('.');
+            if (pos == std::string::npos) {
+                return false;
+            }
+            return extensions.find(path.substr(pos + 1)) != extensions.end();
+        }
+
+        void deliver(const std::vector<void_core::ReloadEvent>& batch) {
+            // Queue under the lock, call back outside it so the callback may
+            // poll() or change subscriptions
+            std::vector<AssetChangeEvent> delivered;
+            AssetChangeCallback cb;
+            {
+                std::lock_guard lock(mutex);
+                for (const auto& raw : batch) {
+                    if (!should_watch(raw.path)) {
+                        continue;
+                    }
+
+                    AssetChangeEvent event;
+                    switch (raw.type) {
+                        case void_core::ReloadEventType::FileCreated:
+                            event = AssetChangeEvent::created(AssetPath(raw.path));
+                            break;
+                        case void_core::ReloadEventType::FileDeleted:
+                            event = AssetChangeEvent::deleted(AssetPath(raw.path));
+                            break;
+                        case void_core::ReloadEventType::FileRenamed:
+                            event = AssetChangeEvent::renamed(AssetPath(raw.old_path), AssetPath(raw.path));
+                            break;
+                        default:
+                            event = AssetChangeEvent::modified(AssetPath(raw.path));
+                            break;
+                    }
+
+                    events.push_back(event);
+                    delivered.push_back(std::move(event));
+                }
+                cb = callback;
+            }
+
+            if (cb) {
+                for (const auto& event : delivered) {
+                    cb(event);
+                }
+            }
+        }
+    };
+
+    void subscribe_unlocked(const std::string& path) {
+        auto shared = m_shared;
+        auto result = void_core::FileWatchService::instance().subscribe(path,
+            [shared](const std::vector<void_core::ReloadEvent>& batch) {
+                shared->deliver(batch);
+            });
+        if (result) {
+            m_subscriptions[path] = result.value();
+        }
+    }
+
+    std::shared_ptr<Shared> m_shared;
+    std::atomic<bool> m_watching{false};
+
+    std::set<std::string> m_watch_paths;
+    std::map<std::string, void_core::FileWatchService::SubscriptionId> m_subscriptions;
+    mutable std::mutex m_paths_mutex;
+};
+
+/// Create the preferred asset watcher for this platform
+[[nodiscard]] inline std::unique_ptr<AssetWatcher> create_asset_watcher(
+    std::chrono::milliseconds poll_interval = std::chrono::milliseconds{100}) {
+    if (void_core::FileWatchService::is_supported()) {
+        return std::make_unique<NativeAssetWatcher>();
+    }
+    return std::make_unique<PollingAssetWatcher>(poll_interval);
+}
+
 // =============================================================================
 // AssetHotReloadConfig
 // =============================================================================
@@ -485,6 +698,9 @@ struct AssetHotReloadConfig {
 /// Callback for reload events
 using ReloadCallback = std::function<void(const AssetReloadResult&)>;
 
+/// Callback for a frame's batch of reloads
+using ReloadBatchCallback = std::function<void(const AssetReloadBatch&)>;
+
 /// Manages hot-reloading of assets
 class AssetHotReloadManager {
 public:
@@ -492,7 +708,7 @@ public:
     explicit AssetHotReloadManager(AssetServer& server, AssetHotReloadConfig config = {})
         : m_server(server)
         , m_config(std::move(config))
-        , m_watcher(std::make_unique<PollingAssetWatcher>(m_config.poll_interval))
+        , m_watcher(create_asset_watcher(m_config.poll_interval))
     {
         // Add asset directory to watch
         m_watcher->add_path(m_server.config().asset_dir);
@@ -529,6 +745,11 @@ public:
     }
 
     /// Process pending changes
+    ///
+    /// All changes seen since the last call are handled as one batch: the
+    /// dependency graph yields the minimal set of affected assets, which
+    /// are reloaded in topological order on the calling thread, and a
+    /// single AssetReloadBatch is reported.
     void process() {
         if (!m_running.load()) {
             return;
@@ -537,6 +758,9 @@ public:
         auto changes = m_watcher->poll();
         auto now = std::chrono::steady_clock::now();
 
+        AssetReloadBatch batch;
+        std::vector<AssetPath> changed_files;
+
         for (const auto& change : changes) {
             // Debounce: skip if too recent
             auto it = m_last_change.find(change.path.str());
@@ -549,8 +773,18 @@ public:
             }
             m_last_change[change.path.str()] = now;
 
-            handle_change(change);
+            handle_change(change, changed_files);
+            batch.changes.push_back(change);
+        }
+
+        std::vector<AssetId> changed_ids;
+        {
+            std::lock_guard lock(m_pending_mutex);
+            changed_ids.assign(m_pending_reloads.begin(), m_pending_reloads.end());
+            m_pending_reloads.clear();
         }
+
+        run_batch(batch, changed_ids, changed_files);
     }
 
     /// Manually trigger reload for path
@@ -564,17 +798,29 @@ public:
         return reload_asset(*id);
     }
 
-    /// Manually trigger reload for ID
+    /// Manually trigger reload for ID (dependents are queued for the next process())
     AssetReloadResult reload(AssetId id) {
         return reload_asset(id);
     }
 
+    /// Queue an asset for reload on the next process() call
+    void queue_reload(AssetId id) {
+        std::lock_guard lock(m_pending_mutex);
+        m_pending_reloads.insert(id);
+    }
+
     /// Set reload callback
     void set_callback(ReloadCallback callback) {
         std::lock_guard lock(m_callback_mutex);
         m_callback = std::move(callback);
     }
 
+    /// Set batch callback (invoked once per process() that reloaded anything)
+    void set_batch_callback(ReloadBatchCallback callback) {
+        std::lock_guard lock(m_callback_mutex);
+        m_batch_callback = std::move(callback);
+    }
+
     /// Get reload history
     [[nodiscard]] std::vector<AssetReloadResult> drain_results() {
         std::lock_guard lock(m_results_mutex);
@@ -600,20 +846,15 @@ public:
     }
 
 private:
-    void handle_change(const AssetChangeEvent& change) {
+    void handle_change(const AssetChangeEvent& change, std::vector<AssetPath>& changed_files) {
         switch (change.type) {
             case FileChangeType::Modified:
-            case FileChangeType::Created: {
-                // Find asset by path and reload
-                auto id = m_server.get_id(change.path.str());
-                if (id) {
-                    queue_reload(*id);
-                }
+            case FileChangeType::Created:
+                // The path may be an asset or a file that assets depend on
+                changed_files.push_back(to_asset_path(change.path));
                 break;
-            }
             case FileChangeType::Deleted: {
-                // Optionally handle deleted files
-                auto id = m_server.get_id(change.path.str());
+                auto id = m_server.get_id(to_asset_path(change.path).str());
                 if (id) {
                     // Mark as failed or unload
                     m_server.unload(*id);
@@ -622,21 +863,119 @@ private:
             }
             case FileChangeType::Renamed: {
                 // Handle rename as delete old + create new
-                auto old_id = m_server.get_id(change.old_path.str());
+                auto old_id = m_server.get_id(to_asset_path(change.old_path).str());
                 if (old_id) {
                     m_server.unload(*old_id);
                 }
+                changed_files.push_back(to_asset_path(change.path));
                 break;
             }
         }
     }
 
-    void queue_reload(AssetId id) {
-        std::lock_guard lock(m_pending_mutex);
-        m_pending_reloads.insert(id);
+    /// Map a watcher path (under asset_dir) to the server's relative asset path
+    [[nodiscard]] AssetPath to_asset_path(const AssetPath& path) const {
+        namespace fs = std::filesystem;
+
+        std::error_code full_ec;
+        std::error_code root_ec;
+        auto full = fs::absolute(fs::path(path.str()), full_ec).lexically_normal();
+        auto root = fs::absolute(fs::path(m_server.config().asset_dir), root_ec).lexically_normal();
+        if (full_ec || root_ec) {
+            return path;
+        }
+
+        auto relative = full.lexically_relative(root);
+        if (relative.empty() || *relative.begin() == "..") {
+            return path;
+        }
+        return AssetPath(relative.generic_string());
     }
 
     AssetReloadResult reload_asset(AssetId id) {
+        auto result = reload_one(id);
+        record_result(result);
+
+        // Dependents follow on the next process(), as one ordered batch
+        if (m_config.reload_dependencies && result.success) {
+            std::lock_guard lock(m_pending_mutex);
+            for (const auto& dependent : m_server.dependency_graph().dependents(id)) {
+                m_pending_reloads.insert(dependent);
+            }
+        }
+
+        return result;
+    }
+
+    void run_batch(AssetReloadBatch& batch,
+                   const std::vector<AssetId>& changed_ids,
+                   const std::vector<AssetPath>& changed_files) {
+        if (changed_ids.empty() && changed_files.empty() && batch.changes.empty()) {
+            return;
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+
+        auto plan = m_server.dependency_graph().plan(
+            changed_ids, changed_files, m_config.reload_dependencies);
+        batch.wave_count = plan.waves.size();
+        batch.has_cycle = plan.has_cycle;
+
+        std::set<AssetId> failed;
+        for (const auto& wave : plan.waves) {
+            // Cascaded reloads are skipped when something they depend on
+            // failed, so they keep using the last good version
+            std::vector<AssetId> runnable;
+            runnable.reserve(wave.size());
+            for (const auto& id : wave) {
+                if (!plan.is_root(id) && depends_on_any(id, failed)) {
+                    auto path = m_server.get_path(id);
+                    auto skipped = AssetReloadResult::failed(id, path.value_or(AssetPath()),
+                                                             "Dependency failed to reload");
+                    failed.insert(id);
+                    record_result(skipped);
+                    batch.results.push_back(std::move(skipped));
+                    continue;
+                }
+                runnable.push_back(id);
+            }
+
+            // Serial: AssetServer::reload and the loaders are not thread-safe
+            for (const auto& id : runnable) {
+                auto result = reload_one(id);
+                if (!result.success) {
+                    failed.insert(result.id);
+                }
+                if (!plan.is_root(result.id)) {
+                    batch.cascaded_count++;
+                }
+                record_result(result);
+                batch.results.push_back(std::move(result));
+            }
+        }
+
+        batch.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time);
+
+        std::lock_guard lock(m_callback_mutex);
+        if (m_batch_callback && !batch.empty()) {
+            m_batch_callback(batch);
+        }
+    }
+
+    [[nodiscard]] bool depends_on_any(AssetId id, const std::set<AssetId>& ids) const {
+        if (ids.empty()) {
+            return false;
+        }
+        for (const auto& dep : m_server.dependency_graph().dependencies(id)) {
+            if (ids.count(dep) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    AssetReloadResult reload_one(AssetId id) {
         auto start_time = std::chrono::steady_clock::now();
 
         auto path = m_server.get_path(id);
@@ -650,40 +989,23 @@ private:
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
             end_time - start_time);
 
-        AssetReloadResult reload_result;
         if (result) {
             const auto* meta = m_server.get_metadata(id);
-            reload_result = AssetReloadResult::ok(id, *path,
-                meta ? meta->generation : 0, duration);
-        } else {
-            reload_result = AssetReloadResult::failed(id, *path, result.error().message());
+            return AssetReloadResult::ok(id, *path, meta ? meta->generation : 0, duration);
         }
+        return AssetReloadResult::failed(id, *path, result.error().message());
+    }
 
-        // Store result
+    void record_result(const AssetReloadResult& result) {
         {
             std::lock_guard lock(m_results_mutex);
-            m_results.push_back(reload_result);
-        }
-
-        // Call callback
-        {
-            std::lock_guard lock(m_callback_mutex);
-            if (m_callback) {
-                m_callback(reload_result);
-            }
+            m_results.push_back(result);
         }
 
-        // Reload dependents if enabled
-        if (m_config.reload_dependencies && reload_result.success) {
-            const auto* meta = m_server.get_metadata(id);
-            if (meta) {
-                for (const auto& dep_id : meta->dependents) {
-                    queue_reload(dep_id);
-                }
-            }
+        std::lock_guard lock(m_callback_mutex);
+        if (m_callback) {
+            m_callback(result);
         }
-
-        return reload_result;
     }
 
     AssetServer& m_server;
@@ -701,6 +1023,7 @@ private:
     mutable std::mutex m_results_mutex;
 
     ReloadCallback m_callback;
+    ReloadBatchCallback m_batch_callback;
     mutable std::mutex m_callback_mutex;
 };
 
@@ -764,7 +1087,7 @@ public:
     void register_loader(std::unique_ptr<AssetLoader<T>> loader) {
         // Add extension to watcher
         for (const auto& ext : loader->extensions()) {
-            dynamic_cast<PollingAssetWatcher&>(m_reload_manager.watcher()).add_extension(ext);
+            m_reload_manager.watcher().add_extension(ext);
         }
         m_server.register_loader(std::move(loader));
     }
@@ -0,0 +1,302 @@
+#pragma once
+
+/// @file gltf_reader.hpp
+/// @brief Zero-copy glTF 2.0 / GLB reader
+///
+/// GltfDocument parses only the JSON part of a glTF file into small
+/// descriptor tables. Binary buffers are never copied: accessors resolve to
+/// GltfAccessorViews that point straight into the GLB BIN chunk (or into
+/// externally provided buffers, typically memory-mapped with MappedFile).
+/// Vertex data is converted to the caller's layout in a single pass with
+/// the gltf_unpack_* helpers.
+///
+/// Peak memory for a GLB is therefore the file bytes (as handed over by the
+/// asset server) plus the converted output, instead of file + DOM buffers +
+/// output. External .bin buffers can be mapped rather than read.
+///
+/// Limitations: sparse accessors are rejected, and only data: URIs are
+/// decoded into owned memory (they cannot be referenced in place).
+
+#include <void_engine/asset/mapped_file.hpp>
+#include <void_engine/core/error.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace void_asset {
+
+// =============================================================================
+// Accessor Views
+// =============================================================================
+
+/// glTF accessor component type (values match the glTF specification)
+enum class GltfComponentType : std::uint16_t {
+    Byte = 5120,
+    UnsignedByte = 5121,
+    Short = 5122,
+    UnsignedShort = 5123,
+    UnsignedInt = 5125,
+    Float = 5126,
+};
+
+/// Get component size in bytes (0 for unknown types)
+[[nodiscard]] std::size_t gltf_component_size(GltfComponentType type) noexcept;
+
+/// Non-owning view of accessor data inside a buffer
+struct GltfAccessorView {
+    const std::uint8_t* data = nullptr;  ///< nullptr when the accessor has no buffer view (all zeros)
+    std::size_t count = 0;
+    std::size_t stride = 0;              ///< Bytes between consecutive elements
+    GltfComponentType component_type = GltfComponentType::Float;
+    std::uint32_t components = 1;        ///< 1 (SCALAR) .. 16 (MAT4)
+    bool normalized = false;
+    std::vector<float> min_values;
+    std::vector<float> max_values;
+
+    /// Size of one element in bytes
+    [[nodiscard]] std::size_t element_size() const noexcept {
+        return gltf_component_size(component_type) * components;
+    }
+
+    /// Check if the elements are tightly packed floats
+    [[nodiscard]] bool is_packed_float() const noexcept {
+        return component_type == GltfComponentType::Float && stride == element_size();
+    }
+};
+
+/// Convert accessor elements to floats
+/// Writes min(view.components, dst_components) floats per element, elements
+/// `dst_stride` bytes apart. Normalized integers are mapped to [0,1]/[-1,1].
+void gltf_unpack_floats(const GltfAccessorView& view, float* dst,
+                        std::size_t dst_stride, std::uint32_t dst_components);
+
+/// Convert an index accessor to 32-bit indices
+void gltf_unpack_indices(const GltfAccessorView& view, std::uint32_t* dst);
+
+/// Convert a JOINTS accessor to 16-bit joint indices (4 per vertex, missing components zeroed)
+void gltf_unpack_joints(const GltfAccessorView& view, std::uint16_t* dst);
+
+// =============================================================================
+// Document Descriptors
+// =============================================================================
+
+/// Primitive inside a mesh
+struct GltfPrimitiveDesc {
+    std::int32_t mode = 4;  // TRIANGLES
+    std::int32_t material = -1;
+    std::int32_t indices = -1;
+    std::vector<std::pair<std::string, std::int32_t>> attributes;
+
+    /// Get accessor index for an attribute (-1 if absent)
+    [[nodiscard]] std::int32_t attribute(std::string_view name) const {
+        for (const auto& [attr_name, accessor] : attributes) {
+            if (attr_name == name) {
+                return accessor;
+            }
+        }
+        return -1;
+    }
+};
+
+/// Mesh
+struct GltfMeshDesc {
+    std::string name;
+    std::vector<GltfPrimitiveDesc> primitives;
+};
+
+/// Texture reference from a material
+struct GltfTextureRef {
+    std::int32_t index = -1;
+    std::int32_t tex_coord = 0;
+    float scale = 1.0f;  ///< normalTexture.scale or occlusionTexture.strength
+};
+
+/// Material (metallic-roughness plus common KHR extensions)
+struct GltfMaterialDesc {
+    std::string name;
+    std::array<float, 4> base_color_factor = {1.0f, 1.0f, 1.0f, 1.0f};
+    float metallic_factor = 1.0f;
+    float roughness_factor = 1.0f;
+    std::array<float, 3> emissive_factor = {0.0f, 0.0f, 0.0f};
+    GltfTextureRef base_color_texture;
+    GltfTextureRef metallic_roughness_texture;
+    GltfTextureRef normal_texture;
+    GltfTextureRef occlusion_texture;
+    GltfTextureRef emissive_texture;
+    std::string alpha_mode = "OPAQUE";
+    float alpha_cutoff = 0.5f;
+    bool double_sided = false;
+
+    // KHR_materials_*
+    std::optional<float> clearcoat;
+    std::optional<float> clearcoat_roughness;
+    std::optional<float> transmission;
+    std::optional<float> ior;
+    std::optional<std::array<float, 3>> sheen_color;
+    std::optional<float> sheen_roughness;
+    bool unlit = false;
+};
+
+/// Image (external URI or embedded buffer view)
+struct GltfImageDesc {
+    std::string name;
+    std::string uri;
+    std::string mime_type;
+    std::int32_t buffer_view = -1;
+};
+
+/// Texture
+struct GltfTextureDesc {
+    std::string name;
+    std::int32_t source = -1;
+    std::int32_t sampler = -1;
+};
+
+/// Sampler (GL enum values; -1 = unspecified filter)
+struct GltfSamplerDesc {
+    std::int32_t mag_filter = -1;
+    std::int32_t min_filter = -1;
+    std::int32_t wrap_s = 10497;  // REPEAT
+    std::int32_t wrap_t = 10497;
+};
+
+/// Scene graph node
+struct GltfNodeDesc {
+    std::string name;
+    std::int32_t mesh = -1;
+    std::int32_t skin = -1;
+    std::int32_t camera = -1;
+    std::vector<std::int32_t> children;
+    std::array<float, 3> translation = {0.0f, 0.0f, 0.0f};
+    std::array<float, 4> rotation = {0.0f, 0.0f, 0.0f, 1.0f};
+    std::array<float, 3> scale = {1.0f, 1.0f, 1.0f};
+    std::optional<std::array<float, 16>> matrix;
+};
+
+/// Skin
+struct GltfSkinDesc {
+    std::string name;
+    std::vector<std::int32_t> joints;
+    std::int32_t inverse_bind_matrices = -1;
+    std::int32_t skeleton = -1;
+};
+
+/// Animation sampler
+struct GltfAnimationSamplerDesc {
+    std::int32_t input = -1;
+    std::int32_t output = -1;
+    std::string interpolation = "LINEAR";
+};
+
+/// Animation channel
+struct GltfAnimationChannelDesc {
+    std::int32_t sampler = -1;
+    std::int32_t target_node = -1;
+    std::string target_path;
+};
+
+/// Animation
+struct GltfAnimationDesc {
+    std::string name;
+    std::vector<GltfAnimationSamplerDesc> samplers;
+    std::vector<GltfAnimationChannelDesc> channels;
+};
+
+/// Scene
+struct GltfSceneDesc {
+    std::string name;
+    std::vector<std::int32_t> nodes;
+};
+
+// =============================================================================
+// GltfDocument
+// =============================================================================
+
+/// Parsed glTF document whose buffers reference caller-owned memory
+class GltfDocument {
+public:
+    /// Resolves an external buffer URI to bytes that outlive the document
+    using BufferResolver =
+        std::function<std::optional<std::span<const std::uint8_t>>(const std::string& uri)>;
+
+    /// Parse a .glb container or a .gltf JSON file
+    /// The bytes (and anything returned by the resolver) must outlive the
+    /// document and every view obtained from it.
+    [[nodiscard]] static void_core::Result<GltfDocument> parse(
+        std::span<const std::uint8_t> bytes,
+        const BufferResolver& resolver = {});
+
+    /// Check for the GLB magic
+    [[nodiscard]] static bool is_glb(std::span<const std::uint8_t> bytes) noexcept;
+
+    /// Get accessor view (bounds-checked against its buffer)
+    [[nodiscard]] void_core::Result<GltfAccessorView> accessor(std::int32_t index) const;
+
+    /// Get raw bytes of a buffer view
+    [[nodiscard]] std::span<const std::uint8_t> buffer_view(std::int32_t index) const;
+
+    /// Get number of accessors
+    [[nodiscard]] std::size_t accessor_count() const noexcept { return m_accessors.size(); }
+
+    /// Get external buffer URIs that were resolved (for dependency tracking)
+    [[nodiscard]] const std::vector<std::string>& external_uris() const noexcept { return m_external_uris; }
+
+    [[nodiscard]] const std::vector<GltfMeshDesc>& meshes() const noexcept { return m_meshes; }
+    [[nodiscard]] const std::vector<GltfMaterialDesc>& materials() const noexcept { return m_materials; }
+    [[nodiscard]] const std::vector<GltfImageDesc>& images() const noexcept { return m_images; }
+    [[nodiscard]] const std::vector<GltfTextureDesc>& textures() const noexcept { return m_textures; }
+    [[nodiscard]] const std::vector<GltfSamplerDesc>& samplers() const noexcept { return m_samplers; }
+    [[nodiscard]] const std::vector<GltfNodeDesc>& nodes() const noexcept { return m_nodes; }
+    [[nodiscard]] const std::vector<GltfSkinDesc>& skins() const noexcept { return m_skins; }
+    [[nodiscard]] const std::vector<GltfAnimationDesc>& animations() const noexcept { return m_animations; }
+    [[nodiscard]] const std::vector<GltfSceneDesc>& scenes() const noexcept { return m_scenes; }
+    [[nodiscard]] std::int32_t default_scene() const noexcept { return m_default_scene; }
+
+private:
+    struct BufferViewDesc {
+        std::int32_t buffer = -1;
+        std::size_t offset = 0;
+        std::size_t length = 0;
+        std::size_t stride = 0;
+    };
+
+    struct AccessorDesc {
+        std::int32_t buffer_view = -1;
+        std::size_t offset = 0;
+        std::size_t count = 0;
+        GltfComponentType component_type = GltfComponentType::Float;
+        std::uint32_t components = 1;
+        bool normalized = false;
+        bool sparse = false;
+        std::vector<float> min_values;
+        std::vector<float> max_values;
+    };
+
+    friend struct GltfDocumentParser;
+
+    std::vector<std::span<const std::uint8_t>> m_buffers;
+    std::vector<std::vector<std::uint8_t>> m_owned_buffers;  // Decoded data: URIs
+    std::vector<std::string> m_external_uris;
+    std::vector<BufferViewDesc> m_buffer_views;
+    std::vector<AccessorDesc> m_accessors;
+
+    std::vector<GltfMeshDesc> m_meshes;
+    std::vector<GltfMaterialDesc> m_materials;
+    std::vector<GltfImageDesc> m_images;
+    std::vector<GltfTextureDesc> m_textures;
+    std::vector<GltfSamplerDesc> m_samplers;
+    std::vector<GltfNodeDesc> m_nodes;
+    std::vector<GltfSkinDesc> m_skins;
+    std::vector<GltfAnimationDesc> m_animations;
+    std::vector<GltfSceneDesc> m_scenes;
+    std::int32_t m_default_scene = -1;
+};
+
+} // namespace void_asset
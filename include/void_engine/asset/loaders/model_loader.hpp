@@ -47,7 +47,7 @@ struct MeshPrimitive {
     std::vector<float> texcoords0;      // vec2
     std::vector<float> texcoords1;      // vec2
     std::vector<float> colors0;         // vec4
-    std::vector<std::uint8_t> joints0;  // uvec4 as bytes
+    std::vector<std::uint16_t> joints0; // u16vec4
     std::vector<float> weights0;        // vec4
     std::vector<std::uint32_t> indices;
 
@@ -0,0 +1,52 @@
+#pragma once
+
+/// @file mapped_file.hpp
+/// @brief Read-only memory-mapped files
+
+#include <void_engine/core/error.hpp>
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace void_asset {
+
+// =============================================================================
+// MappedFile
+// =============================================================================
+
+/// Read-only memory-mapped file (falls back to reading into memory where
+/// mapping is unavailable)
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Map a file
+    [[nodiscard]] static void_core::Result<MappedFile> open(const std::string& path);
+
+    /// Get mapped bytes
+    [[nodiscard]] const std::uint8_t* data() const noexcept { return m_data; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] std::span<const std::uint8_t> bytes() const noexcept { return {m_data, m_size}; }
+
+    /// Check if a file is mapped
+    [[nodiscard]] bool is_open() const noexcept { return m_open; }
+
+private:
+    void reset() noexcept;
+
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_open = false;
+    bool m_mapped = false;
+    std::vector<std::uint8_t> m_fallback;
+};
+
+} // namespace void_asset
@@ -8,6 +8,7 @@
 #include "handle.hpp"
 #include "loader.hpp"
 #include "storage.hpp"
+#include "dependency_graph.hpp"
 #include <void_engine/core/error.hpp>
 #include <cstdint>
 #include <string>
@@ -231,6 +232,7 @@ public:
 
         // Load
         LoadContext ctx(*data, meta->path, id);
+        ctx.set_metadata("source_file", full_path);
         auto result = loader->load_erased(ctx);
 
         if (!result) {
@@ -242,6 +244,7 @@ public:
         // Store
         m_storage.store_erased(id, result.value(), loader->type_id(),
             [loader](void* ptr) { loader->delete_asset(ptr); });
+        record_dependencies(id, meta->path, ctx);
 
         queue_event(AssetEvent::reloaded(id, meta->path, meta->generation + 1));
 
@@ -254,6 +257,7 @@ public:
         if (meta) {
             queue_event(AssetEvent::unloaded(id, meta->path));
         }
+        m_dependencies.remove(id);
         return m_storage.remove(id);
     }
 
@@ -326,6 +330,10 @@ public:
     [[nodiscard]] AssetStorage& storage() { return m_storage; }
     [[nodiscard]] const AssetStorage& storage() const { return m_storage; }
 
+    /// Get dependency graph
+    [[nodiscard]] AssetDependencyGraph& dependency_graph() { return m_dependencies; }
+    [[nodiscard]] const AssetDependencyGraph& dependency_graph() const { return m_dependencies; }
+
     /// Get loader registry
     [[nodiscard]] LoaderRegistry& loaders() { return m_loaders; }
     [[nodiscard]] const LoaderRegistry& loaders() const { return m_loaders; }
@@ -345,6 +353,7 @@ private:
         }
 
         LoadContext ctx(*data, pending.path, pending.id);
+        ctx.set_metadata("source_file", full_path);
         auto result = pending.loader->load_erased(ctx);
 
         if (!result) {
@@ -355,10 +364,26 @@ private:
 
         m_storage.store_erased(pending.id, result.value(), pending.loader->type_id(),
             [loader = pending.loader](void* ptr) { loader->delete_asset(ptr); });
+        record_dependencies(pending.id, pending.path, ctx);
 
         queue_event(AssetEvent::loaded(pending.id, pending.path));
     }
 
+    void record_dependencies(AssetId id, const AssetPath& path, const LoadContext& ctx) {
+        // Path dependencies that are already assets become asset edges; all
+        // of them are also kept as file edges so includes that are not
+        // assets (or not loaded yet) still cascade
+        std::vector<AssetId> deps = ctx.dependency_ids();
+        for (const auto& dep_path : ctx.dependencies()) {
+            if (auto dep_id = m_storage.get_id(dep_path)) {
+                deps.push_back(*dep_id);
+            }
+        }
+
+        m_dependencies.set_dependencies(id, path, deps, ctx.dependencies());
+        m_storage.set_dependencies(id, deps);
+    }
+
     void queue_event(AssetEvent event) {
         std::lock_guard lock(m_events_mutex);
         m_events.push_back(std::move(event));
@@ -382,8 +407,9 @@ private:
     }
 
     AssetServerConfig m_config;
+    LoaderRegistry m_loaders;  // Declared before storage: stored assets use loader deleters
     AssetStorage m_storage;
-    LoaderRegistry m_loaders;
+    AssetDependencyGraph m_dependencies;
 
     std::queue<PendingLoad> m_pending;
     mutable std::mutex m_pending_mutex;
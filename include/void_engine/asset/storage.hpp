@@ -6,6 +6,7 @@
 #include "fwd.hpp"
 #include "types.hpp"
 #include "handle.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <map>
@@ -201,6 +202,36 @@ public:
         }
     }
 
+    /// Replace the recorded dependencies of an asset (keeps dependents in sync)
+    void set_dependencies(AssetId id, std::vector<AssetId> deps) {
+        std::unique_lock lock(m_mutex);
+
+        auto it = m_entries.find(id);
+        if (it == m_entries.end()) {
+            return;
+        }
+
+        auto& meta = it->second.metadata;
+        for (const auto& old_dep : meta.dependencies) {
+            auto dep_it = m_entries.find(old_dep);
+            if (dep_it != m_entries.end()) {
+                auto& dependents = dep_it->second.metadata.dependents;
+                dependents.erase(std::remove(dependents.begin(), dependents.end(), id),
+                                 dependents.end());
+            }
+        }
+
+        std::sort(deps.begin(), deps.end());
+        deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+        for (const auto& dep : deps) {
+            auto dep_it = m_entries.find(dep);
+            if (dep_it != m_entries.end() && dep != id) {
+                dep_it->second.metadata.add_dependent(id);
+            }
+        }
+        meta.dependencies = std::move(deps);
+    }
+
     /// Get handle for existing asset
     template<typename T>
     [[nodiscard]] Handle<T> get_handle(AssetId id) {
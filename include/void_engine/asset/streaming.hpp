@@ -0,0 +1,382 @@
+#pragma once
+
+/// @file streaming.hpp
+/// @brief Residency manager for streamed asset LODs and texture mips
+///
+/// The residency manager decides, once per frame, which level of detail of
+/// each streamable asset should be resident in memory:
+/// - Callers submit ResidencyRequests (distance to camera, wanted LOD, pins)
+/// - Requests are ranked by priority and fitted into per-category budgets
+/// - Levels are streamed in coarse-to-fine, one level per step
+/// - Levels that no longer fit are streamed out, least important first
+/// - Refinement/degradation is reported through ResidencyEvents so the
+///   renderer can swap to finer data as soon as it arrives
+///
+/// Level 0 is always the finest level (mip 0 / LOD 0). Residency is a
+/// contiguous tail: when level N is resident, every coarser level is too.
+///
+/// The manager does not perform I/O itself. A stream-in callback starts the
+/// load of one level (typically through AssetServer) and the loader reports
+/// back with complete_stream_in(), from any thread.
+
+#include "fwd.hpp"
+#include "types.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace void_asset {
+
+// =============================================================================
+// StreamingCategory
+// =============================================================================
+
+/// Budget category of a streamable asset
+enum class StreamingCategory : std::uint8_t {
+    Texture,    ///< Texture mip chains
+    Mesh,       ///< Mesh LOD chains
+    Audio,      ///< Streamed audio banks
+    Other,      ///< Anything else with levels
+};
+
+/// Number of streaming categories
+inline constexpr std::size_t k_streaming_category_count = 4;
+
+/// Get streaming category name
+[[nodiscard]] inline const char* streaming_category_name(StreamingCategory category) {
+    switch (category) {
+        case StreamingCategory::Texture: return "Texture";
+        case StreamingCategory::Mesh: return "Mesh";
+        case StreamingCategory::Audio: return "Audio";
+        case StreamingCategory::Other: return "Other";
+        default: return "Unknown";
+    }
+}
+
+/// Sentinel level meaning "nothing resident"
+inline constexpr std::uint32_t k_not_resident = std::numeric_limits<std::uint32_t>::max();
+
+// =============================================================================
+// ResidencyManagerConfig
+// =============================================================================
+
+/// Configuration for the residency manager
+struct ResidencyManagerConfig {
+    /// Memory budget per category in bytes
+    std::array<std::size_t, k_streaming_category_count> budgets{
+        512ull * 1024 * 1024,   // Texture
+        256ull * 1024 * 1024,   // Mesh
+        64ull * 1024 * 1024,    // Audio
+        64ull * 1024 * 1024,    // Other
+    };
+    /// Maximum number of level loads started per frame
+    std::size_t max_stream_ins_per_frame = 8;
+    /// Maximum bytes of level loads started per frame (0 = unlimited)
+    std::size_t max_stream_in_bytes_per_frame = 32ull * 1024 * 1024;
+    /// Frames an asset stays wanted after its last request
+    std::uint32_t request_linger_frames = 30;
+    /// Distance at which an unpinned request's priority is halved
+    float priority_half_distance = 50.0f;
+
+    /// Default constructor
+    ResidencyManagerConfig() = default;
+
+    /// Builder pattern
+    ResidencyManagerConfig& with_budget(StreamingCategory category, std::size_t bytes) {
+        budgets[static_cast<std::size_t>(category)] = bytes;
+        return *this;
+    }
+
+    ResidencyManagerConfig& with_max_stream_ins_per_frame(std::size_t count) {
+        max_stream_ins_per_frame = count;
+        return *this;
+    }
+
+    ResidencyManagerConfig& with_max_stream_in_bytes_per_frame(std::size_t bytes) {
+        max_stream_in_bytes_per_frame = bytes;
+        return *this;
+    }
+
+    ResidencyManagerConfig& with_request_linger_frames(std::uint32_t frames) {
+        request_linger_frames = frames;
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t budget(StreamingCategory category) const {
+        return budgets[static_cast<std::size_t>(category)];
+    }
+};
+
+// =============================================================================
+// StreamableDesc / ResidencyRequest
+// =============================================================================
+
+/// Description of a streamable asset's levels
+struct StreamableDesc {
+    AssetId id;
+    StreamingCategory category = StreamingCategory::Other;
+    /// Size of each level in bytes, index 0 = finest
+    std::vector<std::size_t> level_bytes;
+
+    /// Number of levels
+    [[nodiscard]] std::uint32_t level_count() const {
+        return static_cast<std::uint32_t>(level_bytes.size());
+    }
+
+    /// Coarsest level index
+    [[nodiscard]] std::uint32_t coarsest_level() const {
+        return level_bytes.empty() ? 0 : level_count() - 1;
+    }
+
+    /// Bytes needed to hold `level` and every coarser level
+    [[nodiscard]] std::size_t resident_bytes(std::uint32_t level) const {
+        std::size_t total = 0;
+        for (std::uint32_t l = level; l < level_count(); ++l) {
+            total += level_bytes[l];
+        }
+        return total;
+    }
+
+    /// Build a texture description from base dimensions (full mip chain)
+    [[nodiscard]] static StreamableDesc texture(AssetId id, std::uint32_t width,
+                                                std::uint32_t height,
+                                                std::uint32_t bytes_per_pixel);
+
+    /// Build a mesh description from per-LOD sizes (index 0 = finest)
+    [[nodiscard]] static StreamableDesc mesh(AssetId id, std::vector<std::size_t> lod_bytes);
+};
+
+/// Per-frame residency request for one asset
+struct ResidencyRequest {
+    AssetId id;
+    /// Distance from the viewer (world units)
+    float distance = 0.0f;
+    /// Finest level wanted (0 = full detail)
+    std::uint32_t level = 0;
+    /// Gameplay importance multiplier
+    float importance = 1.0f;
+    /// Pinned requests are always honoured, even over budget
+    bool pinned = false;
+
+    /// Factory methods
+    [[nodiscard]] static ResidencyRequest at_distance(AssetId id, float distance,
+                                                      std::uint32_t level = 0) {
+        ResidencyRequest req;
+        req.id = id;
+        req.distance = distance;
+        req.level = level;
+        return req;
+    }
+
+    [[nodiscard]] static ResidencyRequest pin(AssetId id, std::uint32_t level = 0) {
+        ResidencyRequest req;
+        req.id = id;
+        req.level = level;
+        req.pinned = true;
+        return req;
+    }
+
+    /// Merge another request for the same asset (keeps the most demanding)
+    void merge(const ResidencyRequest& other) {
+        if (other.distance < distance) distance = other.distance;
+        if (other.level < level) level = other.level;
+        if (other.importance > importance) importance = other.importance;
+        pinned = pinned || other.pinned;
+    }
+};
+
+// =============================================================================
+// ResidencyEvent
+// =============================================================================
+
+/// Type of residency change
+enum class ResidencyEventType : std::uint8_t {
+    Refined,    ///< A finer level became resident
+    Degraded,   ///< Finer levels were streamed out
+    Evicted,    ///< Asset is no longer resident at all
+    Failed,     ///< A level failed to stream in
+};
+
+/// Get residency event type name
+[[nodiscard]] inline const char* residency_event_type_name(ResidencyEventType type) {
+    switch (type) {
+        case ResidencyEventType::Refined: return "Refined";
+        case ResidencyEventType::Degraded: return "Degraded";
+        case ResidencyEventType::Evicted: return "Evicted";
+        case ResidencyEventType::Failed: return "Failed";
+        default: return "Unknown";
+    }
+}
+
+/// Residency change notification
+struct ResidencyEvent {
+    ResidencyEventType type = ResidencyEventType::Refined;
+    AssetId id;
+    StreamingCategory category = StreamingCategory::Other;
+    /// Finest resident level after the change (k_not_resident if evicted)
+    std::uint32_t level = k_not_resident;
+    /// Finest resident level before the change
+    std::uint32_t previous_level = k_not_resident;
+};
+
+// =============================================================================
+// StreamingStats
+// =============================================================================
+
+/// Residency statistics
+struct StreamingStats {
+    std::array<std::size_t, k_streaming_category_count> resident_bytes{};
+    std::array<std::size_t, k_streaming_category_count> in_flight_bytes{};
+    std::array<std::size_t, k_streaming_category_count> budget_bytes{};
+    std::size_t tracked_assets = 0;
+    std::size_t resident_assets = 0;
+    std::size_t in_flight = 0;
+    std::uint64_t stream_ins = 0;
+    std::uint64_t stream_outs = 0;
+    std::uint64_t failures = 0;
+    std::uint64_t frames = 0;
+    /// Frames where pinned assets pushed a category over budget
+    std::uint64_t over_budget_frames = 0;
+};
+
+// =============================================================================
+// ResidencyManager
+// =============================================================================
+
+/// Per-frame, budget-driven residency manager for streamable assets
+class ResidencyManager {
+public:
+    /// Start loading one level; return false if the load could not be started
+    using StreamInFunc = std::function<bool(AssetId id, std::uint32_t level)>;
+    /// Drop every level finer than `keep_level` (k_not_resident drops all)
+    using StreamOutFunc = std::function<void(AssetId id, std::uint32_t keep_level)>;
+    /// Residency change callback (called from update())
+    using EventCallback = std::function<void(const ResidencyEvent&)>;
+
+    explicit ResidencyManager(ResidencyManagerConfig config = {});
+
+    // Non-copyable
+    ResidencyManager(const ResidencyManager&) = delete;
+    ResidencyManager& operator=(const ResidencyManager&) = delete;
+
+    /// Set stream callbacks
+    void set_stream_in(StreamInFunc func) { m_stream_in = std::move(func); }
+    void set_stream_out(StreamOutFunc func) { m_stream_out = std::move(func); }
+
+    /// Set residency change callback
+    void set_event_callback(EventCallback cb) { m_on_event = std::move(cb); }
+
+    /// Register a streamable asset (replaces an existing registration)
+    void register_asset(StreamableDesc desc);
+
+    /// Unregister an asset, streaming it out if resident
+    bool unregister_asset(AssetId id);
+
+    /// Check if an asset is registered
+    [[nodiscard]] bool is_registered(AssetId id) const;
+
+    /// Submit a request for this frame (thread-safe, merged per asset)
+    void request(const ResidencyRequest& req);
+
+    /// Submit a batch of requests for this frame
+    void request(const std::vector<ResidencyRequest>& reqs);
+
+    /// Report a finished level load (thread-safe)
+    void complete_stream_in(AssetId id, std::uint32_t level, bool success = true);
+
+    /// Run one residency pass (call once per frame from Stage::Streaming)
+    void update(float dt);
+
+    /// Finest resident level of an asset (k_not_resident if none)
+    [[nodiscard]] std::uint32_t resident_level(AssetId id) const;
+
+    /// Level the manager is currently aiming for (k_not_resident if none)
+    [[nodiscard]] std::uint32_t target_level(AssetId id) const;
+
+    /// Check if a level load is in flight for an asset
+    [[nodiscard]] bool is_streaming(AssetId id) const;
+
+    /// Drain residency events
+    [[nodiscard]] std::vector<ResidencyEvent> drain_events();
+
+    /// Change a category budget at runtime
+    void set_budget(StreamingCategory category, std::size_t bytes);
+
+    /// Get statistics
+    [[nodiscard]] StreamingStats stats() const;
+
+    /// Get config
+    [[nodiscard]] const ResidencyManagerConfig& config() const { return m_config; }
+
+private:
+    struct Entry {
+        StreamableDesc desc;
+        ResidencyRequest last_request;
+        std::uint64_t last_request_frame = 0;
+        bool ever_requested = false;
+        std::uint32_t resident = k_not_resident;
+        std::uint32_t target = k_not_resident;
+        std::uint32_t in_flight = k_not_resident;
+        float priority = 0.0f;
+    };
+
+    struct Completion {
+        AssetId id;
+        std::uint32_t level = k_not_resident;
+        bool success = false;
+    };
+
+    struct StreamOp {
+        AssetId id;
+        std::uint32_t level = k_not_resident;
+    };
+
+    [[nodiscard]] float compute_priority(const Entry& entry) const;
+    [[nodiscard]] bool is_wanted(const Entry& entry) const;
+    void merge_requests_unlocked(std::unordered_map<AssetId, ResidencyRequest>& requests);
+    void apply_completions_unlocked(const std::vector<Completion>& completions,
+                                    std::vector<ResidencyEvent>& events);
+    void assign_targets_unlocked();
+    void plan_stream_out_unlocked(std::vector<StreamOp>& ops, std::vector<ResidencyEvent>& events);
+    void plan_stream_in_unlocked(std::vector<StreamOp>& ops);
+
+    ResidencyManagerConfig m_config;
+    StreamInFunc m_stream_in;
+    StreamOutFunc m_stream_out;
+    EventCallback m_on_event;
+
+    std::unordered_map<AssetId, Entry> m_entries;
+    std::vector<ResidencyEvent> m_events;
+
+    std::uint64_t m_frame = 0;
+    std::uint64_t m_stream_ins = 0;
+    std::uint64_t m_stream_outs = 0;
+    std::uint64_t m_failures = 0;
+    std::uint64_t m_over_budget_frames = 0;
+    mutable std::mutex m_mutex;
+
+    std::unordered_map<AssetId, ResidencyRequest> m_pending_requests;
+    std::mutex m_request_mutex;
+
+    std::vector<Completion> m_completions;
+    std::mutex m_completion_mutex;
+};
+
+// =============================================================================
+// Debug Utilities (Implemented in streaming.cpp)
+// =============================================================================
+
+namespace debug {
+
+/// Format streaming statistics for debugging
+std::string format_streaming_stats(const StreamingStats& stats);
+
+} // namespace debug
+
+} // namespace void_asset
@@ -93,6 +93,8 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -174,12 +176,37 @@ private:
 // =============================================================================
 
 /// @brief Manages active projectiles
+///
+/// Projectiles are stored as structure-of-arrays in dense, swap-removed
+/// arrays; ids address pooled slots with a generation, so destroyed slots
+/// are recycled without invalidating stale ids. Configurations are shared:
+/// each projectile keeps a ProjectileConfigId, with gravity and drag copied
+/// next to the motion data so integration runs as plain float loops.
+///
+/// Collision is one batched query per update: every projectile's swept
+/// segment for the frame goes to the BatchRaycastFunc in a single call.
 class ProjectileSystem {
 public:
     ProjectileSystem();
     ~ProjectileSystem();
 
-    /// @brief Spawn a projectile
+    /// @brief Register a shared projectile configuration
+    ProjectileConfigId register_config(const ProjectileConfig& config);
+
+    /// @brief Get a shared configuration
+    const ProjectileConfig* get_config(ProjectileConfigId id) const;
+
+    /// @brief Get the configuration a projectile was spawned with
+    ///
+    /// Ids of configurations registered on first use stay valid while a
+    /// projectile still references them.
+    ProjectileConfigId config_of(ProjectileId id) const;
+
+    /// @brief Spawn a projectile with a shared configuration
+    ProjectileId spawn(ProjectileConfigId config, const void_math::Vec3& origin,
+                       const void_math::Vec3& direction, EntityId owner);
+
+    /// @brief Spawn a projectile (the configuration is registered on first use)
     ProjectileId spawn(const ProjectileConfig& config, const void_math::Vec3& origin,
                        const void_math::Vec3& direction, EntityId owner);
 
@@ -187,12 +214,20 @@ public:
     void destroy(ProjectileId id);
 
     /// @brief Get projectile state
-    const ProjectileState* get_state(ProjectileId id) const;
+    std::optional<ProjectileState> get_state(ProjectileId id) const;
 
     /// @brief Update all projectiles
     void update(float dt);
 
-    /// @brief Set physics raycast function
+    /// @brief Set batched physics sweep function
+    ///
+    /// Called once per update with every projectile's segment; fills one
+    /// ProjectileHit per sweep.
+    using BatchRaycastFunc = std::function<void(std::span<const ProjectileSweep> sweeps,
+                                                std::span<ProjectileHit> hits)>;
+    void set_batch_raycast_func(BatchRaycastFunc func) { m_batch_raycast = std::move(func); }
+
+    /// @brief Set physics raycast function (used per projectile when no batch function is set)
     using RaycastFunc = std::function<bool(
         const void_math::Vec3& from,
         const void_math::Vec3& to,
@@ -207,7 +242,12 @@ public:
                                            const void_math::Vec3& hit_point, float damage)>;
     void on_hit(HitCallback callback) { m_on_hit = std::move(callback); }
 
-    /// @brief Set target position callback (for homing projectiles)
+    /// @brief Set batched target position function (for homing projectiles)
+    using GetTargetPositionsFunc = std::function<void(std::span<const EntityId> targets,
+                                                      std::span<void_math::Vec3> positions)>;
+    void set_target_positions_func(GetTargetPositionsFunc func) { m_get_target_positions = std::move(func); }
+
+    /// @brief Set target position callback (used when no batched function is set)
     using GetTargetPositionFunc = std::function<void_math::Vec3(EntityId target)>;
     void set_target_position_func(GetTargetPositionFunc func) { m_get_target_position = std::move(func); }
 
@@ -215,22 +255,68 @@ public:
     void set_projectile_target(ProjectileId projectile, EntityId target);
 
     /// @brief Get active projectile count
-    std::size_t active_count() const { return m_projectiles.size(); }
+    std::size_t active_count() const { return m_ids.size(); }
 
     /// @brief Clear all projectiles
     void clear();
 
 private:
-    struct ProjectileData {
-        ProjectileId id;
-        ProjectileConfig config;
-        ProjectileState state;
-    };
-
-    std::vector<ProjectileData> m_projectiles;
-    std::uint32_t m_next_id{1};
+    static constexpr std::uint32_t k_slot_bits = 20;
+    static constexpr std::uint32_t k_slot_mask = (1u << k_slot_bits) - 1;
+    static constexpr std::uint32_t k_no_index = 0xFFFFFFFFu;
+
+    std::uint32_t dense_index(ProjectileId id) const;
+    void remove_at(std::uint32_t index);
+    std::uint32_t allocate_config(const ProjectileConfig& config, bool registered);
+    ProjectileConfigId config_id(std::uint32_t index) const;
+    std::uint32_t config_index(ProjectileConfigId id) const;
+    void release_config(std::uint32_t config);
+    ProjectileId spawn_at(std::uint32_t config_index, const void_math::Vec3& origin,
+                          const void_math::Vec3& direction, EntityId owner);
+    void integrate(float dt);
+    void sweep();
+    void apply_hits();
+    void update_homing(float dt);
+
+    // Shared configurations, ProjectileConfigId = (generation << k_slot_bits) | index
+    std::vector<ProjectileConfig> m_configs;
+    std::vector<std::uint32_t> m_config_refs;
+    std::vector<std::uint8_t> m_config_registered;
+    std::vector<std::uint32_t> m_config_generation;
+    std::vector<std::uint32_t> m_free_configs;
+    std::uint32_t m_last_config{k_no_index};
+
+    // Active projectiles, dense
+    std::vector<ProjectileId> m_ids;
+    std::vector<std::uint32_t> m_config_index;
+    std::vector<float> m_pos_x, m_pos_y, m_pos_z;
+    std::vector<float> m_prev_x, m_prev_y, m_prev_z;
+    std::vector<float> m_vel_x, m_vel_y, m_vel_z;
+    std::vector<float> m_gravity;
+    std::vector<float> m_drag;
+    std::vector<float> m_lifetime;
+    std::vector<EntityId> m_owner;
+    std::vector<EntityId> m_target;
+    std::vector<std::uint32_t> m_penetrations;
+
+    // Slot pool: slot -> dense index, generation per slot
+    std::vector<std::uint32_t> m_slot_index;
+    std::vector<std::uint32_t> m_slot_generation;
+    std::vector<std::uint32_t> m_free_slots;
+
+    // Per-update scratch
+    std::vector<ProjectileSweep> m_sweeps;
+    std::vector<ProjectileHit> m_hits;
+    std::vector<std::uint32_t> m_homing;
+    std::vector<EntityId> m_homing_targets;
+    std::vector<void_math::Vec3> m_homing_positions;
+    std::vector<ProjectileId> m_pending_destroy;
+    bool m_updating{false};
+
+    BatchRaycastFunc m_batch_raycast;
     RaycastFunc m_raycast;
     HitCallback m_on_hit;
+    GetTargetPositionsFunc m_get_target_positions;
     GetTargetPositionFunc m_get_target_position;
 };
 
@@ -448,6 +534,7 @@ namespace prelude {
     using void_combat::DamageTypeId;
     using void_combat::StatusEffectId;
     using void_combat::ProjectileId;
+    using void_combat::ProjectileConfigId;
     using void_combat::EntityId;
 
     // Types
@@ -48,6 +48,14 @@ struct ProjectileId {
     auto operator<=>(const ProjectileId&) const = default;
 };
 
+/// @brief Strongly-typed shared projectile configuration ID
+struct ProjectileConfigId {
+    std::uint32_t value{0};
+    explicit operator bool() const { return value != 0; }
+    bool operator==(const ProjectileConfigId&) const = default;
+    auto operator<=>(const ProjectileConfigId&) const = default;
+};
+
 
 // =============================================================================
 // Forward Declarations - Health
@@ -138,9 +146,9 @@ namespace std {
             return std::hash<std::uint32_t>{}(id.value);
         }
     };
-    template<> struct hash<void_combat::EntityId> {
-        std::size_t operator()(const void_combat::EntityId& id) const noexcept {
-            return std::hash<std::uint64_t>{}(id.value);
+    template<> struct hash<void_combat::ProjectileConfigId> {
+        std::size_t operator()(const void_combat::ProjectileConfigId& id) const noexcept {
+            return std::hash<std::uint32_t>{}(id.value);
         }
     };
 }
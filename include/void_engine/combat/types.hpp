@@ -199,6 +199,7 @@ struct WeaponState {
 struct ProjectileConfig {
     float speed{50.0f};
     float gravity{0};
+    float drag{0};                   ///< Velocity damping per second
     float lifetime{5.0f};
     float radius{0.1f};
     float damage{10.0f};
@@ -209,6 +210,8 @@ struct ProjectileConfig {
     std::uint32_t max_penetrations{0};
     bool homing{false};
     float homing_strength{0};
+
+    bool operator==(const ProjectileConfig&) const = default;
 };
 
 /// @brief Projectile state
@@ -223,6 +226,22 @@ struct ProjectileState {
     bool active{true};
 };
 
+/// @brief Swept segment of one projectile for a frame's batched collision query
+struct ProjectileSweep {
+    void_math::Vec3 from{};
+    void_math::Vec3 to{};
+    float radius{0};
+    EntityId owner{};
+};
+
+/// @brief Result of a projectile sweep
+struct ProjectileHit {
+    bool hit{false};
+    void_math::Vec3 point{};
+    void_math::Vec3 normal{};
+    EntityId entity{};
+};
+
 // =============================================================================
 // Status Effect Types
 // =============================================================================
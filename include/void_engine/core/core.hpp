@@ -23,6 +23,9 @@
 // Hot-reload infrastructure
 #include "hot_reload.hpp"
 
+// Update scheduling
+#include "tick_lod.hpp"
+
 /// @namespace void_core
 /// @brief Core engine infrastructure module
 ///
@@ -36,6 +39,7 @@
 /// - **Type Registry**: Runtime type information and dynamic types
 /// - **Plugin System**: Plugin lifecycle management
 /// - **Hot-Reload**: State preservation across code reloads
+/// - **Tick LOD**: Distance-based update rates for gameplay systems
 ///
 /// Example usage:
 /// @code
@@ -0,0 +1,117 @@
+#pragma once
+
+/// @file file_watcher.hpp
+/// @brief Event-driven file watching shared by every hot-reload consumer
+///
+/// FileWatchService owns a single OS notification handle (inotify on Linux)
+/// and a single dispatch thread. Consumers subscribe to files or directory
+/// trees and receive coalesced, debounced ReloadEvents:
+/// - Directory subscriptions are recursive; new subdirectories are picked up
+/// - File subscriptions watch the parent directory, so atomic saves
+///   (write temp file, rename over target) are reported as modifications
+/// - Bursts of writes/renames on one path within the debounce window are
+///   merged into a single event
+///
+/// NativeFileWatcher adapts the service to the FileWatcher interface. Use
+/// create_file_watcher() to get the native watcher where supported and
+/// PollingFileWatcher elsewhere.
+
+#include "fwd.hpp"
+#include "error.hpp"
+#include "hot_reload.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace void_core {
+
+// =============================================================================
+// FileWatchService
+// =============================================================================
+
+/// Statistics for the shared watch service
+struct FileWatchStats {
+    std::size_t subscriptions = 0;
+    std::size_t os_watches = 0;
+    std::uint64_t raw_events = 0;
+    std::uint64_t dispatched_events = 0;
+    std::uint64_t overflows = 0;
+};
+
+/// Process-wide event-driven file watch service
+class FileWatchService {
+public:
+    /// Receives a batch of debounced events on the dispatch thread
+    using Listener = std::function<void(const std::vector<ReloadEvent>&)>;
+    using SubscriptionId = std::uint64_t;
+
+    /// Get the shared service (created on first use)
+    [[nodiscard]] static FileWatchService& instance();
+
+    /// Check if native notifications are available on this platform
+    [[nodiscard]] static bool is_supported();
+
+    ~FileWatchService();
+
+    FileWatchService(const FileWatchService&) = delete;
+    FileWatchService& operator=(const FileWatchService&) = delete;
+
+    /// Watch a file or a directory tree; events are reported with `path`
+    /// as given (directory events as `path` + "/" + relative path)
+    [[nodiscard]] Result<SubscriptionId> subscribe(const std::string& path, Listener listener);
+
+    /// Remove a subscription
+    void unsubscribe(SubscriptionId id);
+
+    /// Set debounce window (quiet time before a path's events are dispatched)
+    void set_debounce(std::chrono::milliseconds window);
+
+    /// Get debounce window
+    [[nodiscard]] std::chrono::milliseconds debounce() const;
+
+    /// Get statistics
+    [[nodiscard]] FileWatchStats stats() const;
+
+private:
+    FileWatchService();
+
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+// =============================================================================
+// NativeFileWatcher
+// =============================================================================
+
+/// FileWatcher backed by the shared FileWatchService
+class NativeFileWatcher : public FileWatcher {
+public:
+    NativeFileWatcher();
+    ~NativeFileWatcher() override;
+
+    Result<void> watch(const std::string& path) override;
+    Result<void> unwatch(const std::string& path) override;
+    std::vector<ReloadEvent> poll() override;
+    bool is_watching(const std::string& path) const override;
+    std::size_t watched_count() const override;
+    void clear() override;
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::vector<ReloadEvent> events;
+    };
+
+    std::shared_ptr<Queue> m_queue;
+    std::unordered_map<std::string, FileWatchService::SubscriptionId> m_watches;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace void_core
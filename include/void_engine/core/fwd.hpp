@@ -80,4 +80,13 @@ class HotReloadManager;
 class FileWatcher;
 class MemoryFileWatcher;
 
+// =============================================================================
+// Update Scheduling
+// =============================================================================
+
+struct TickLodConfig;
+struct TickLodEntity;
+struct TickLodDecision;
+class TickLodScheduler;
+
 } // namespace void_core
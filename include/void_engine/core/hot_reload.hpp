@@ -720,6 +720,16 @@ private:
     std::chrono::steady_clock::time_point m_last_poll;
 };
 
+// =============================================================================
+// File Watcher Factory (Implemented in file_watcher.cpp)
+// =============================================================================
+
+/// Create the preferred watcher for this platform: an event-driven
+/// NativeFileWatcher where OS notifications exist, otherwise a
+/// PollingFileWatcher with the given interval
+std::unique_ptr<FileWatcher> create_file_watcher(
+    std::chrono::milliseconds poll_interval = std::chrono::milliseconds(100));
+
 // =============================================================================
 // HotReloadSystem
 // =============================================================================
@@ -731,9 +741,9 @@ public:
     explicit HotReloadSystem(std::unique_ptr<FileWatcher> watcher)
         : m_watcher(std::move(watcher)) {}
 
-    /// Constructor with default polling watcher
+    /// Constructor with the platform's default watcher
     HotReloadSystem()
-        : m_watcher(std::make_unique<PollingFileWatcher>()) {}
+        : m_watcher(create_file_watcher()) {}
 
     /// Register object with file watching
     Result<void> register_watched(
@@ -0,0 +1,128 @@
+#pragma once
+
+/// @file tick_lod.hpp
+/// @brief Significance-based update rate scheduling for void_core
+
+#include "fwd.hpp"
+#include "id.hpp"
+#include <void_engine/math/types.hpp>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace void_core {
+
+// =============================================================================
+// Tick LOD Types
+// =============================================================================
+
+/// Tick LOD configuration
+struct TickLodConfig {
+    /// Upper distance of each tier; entities beyond the last one use the last tier
+    std::vector<float> tier_distances{15.0f, 40.0f, 100.0f, 250.0f};
+
+    /// Frames between ticks per tier (one more entry than tier_distances)
+    std::vector<std::uint32_t> tier_intervals{1, 2, 4, 8, 16};
+
+    /// Distance multiplier for entities no observer can see
+    float hidden_distance_scale = 2.0f;
+
+    /// Fraction an entity must move past a tier boundary before it drops to a slower tier
+    float hysteresis = 0.1f;
+};
+
+/// Per-entity significance inputs
+struct TickLodEntity {
+    void_math::Vec3 position{};
+    float importance = 1.0f;        ///< Divides the observer distance; higher ticks more often
+    bool visible = true;
+    bool always_tick = false;       ///< Pin to the every-frame tier
+};
+
+/// Tick decision for one entity this frame
+struct TickLodDecision {
+    bool tick = true;               ///< Whether to update the entity this frame
+    float dt = 0.0f;                ///< Time since the entity last ticked, including this frame
+    std::uint32_t tier = 0;
+};
+
+// =============================================================================
+// TickLodScheduler
+// =============================================================================
+
+/// Shared update-rate scheduler for gameplay systems
+///
+/// Each frame, begin_frame() scores registered entities by their distance to
+/// the nearest observer (usually players), scaled by importance and
+/// visibility, and assigns a tier with an update interval. Entities in a
+/// tier tick on different frames, offset by a per-entity phase, so work is
+/// spread evenly. Systems then ask decision() whether to update an entity
+/// and with which accumulated dt; all systems get the same answer for an
+/// entity within a frame.
+///
+/// Without observers every entity ticks every frame.
+class TickLodScheduler {
+public:
+    TickLodScheduler() = default;
+    explicit TickLodScheduler(TickLodConfig config);
+
+    // Configuration
+    void set_config(TickLodConfig config);
+    [[nodiscard]] const TickLodConfig& config() const noexcept { return m_config; }
+
+    // Observers
+    void set_observers(std::span<const void_math::Vec3> positions);
+    void clear_observers() { m_observers.clear(); }
+
+    // Entity registration
+    void add_entity(EntityId entity, const TickLodEntity& desc = TickLodEntity{});
+    void remove_entity(EntityId entity);
+    void clear();
+
+    [[nodiscard]] bool contains(EntityId entity) const;
+    [[nodiscard]] std::size_t entity_count() const noexcept { return m_entities.size(); }
+
+    // Significance inputs
+    void set_position(EntityId entity, const void_math::Vec3& position);
+    void set_visible(EntityId entity, bool visible);
+    void set_importance(EntityId entity, float importance);
+    void set_always_tick(EntityId entity, bool always_tick);
+
+    /// Score entities and advance to the next frame
+    void begin_frame(float dt);
+
+    /// Tick decision for an entity this frame (unregistered entities always tick with the frame dt)
+    [[nodiscard]] TickLodDecision decision(EntityId entity) const;
+
+    /// Shorthand for decision(entity).tick
+    [[nodiscard]] bool should_tick(EntityId entity) const { return decision(entity).tick; }
+
+    // Statistics
+    [[nodiscard]] std::uint64_t frame() const noexcept { return m_frame; }
+    [[nodiscard]] std::size_t ticking_count() const noexcept { return m_ticking_count; }
+    [[nodiscard]] const std::vector<std::size_t>& tier_counts() const noexcept { return m_tier_counts; }
+
+private:
+    [[nodiscard]] std::uint32_t tier_for(float distance, float scale) const;
+    [[nodiscard]] std::uint32_t interval_of(std::uint32_t tier) const;
+
+    TickLodConfig m_config;
+    std::vector<void_math::Vec3> m_observers;
+
+    // Entity data, dense (swap-removed)
+    std::vector<EntityId> m_entities;
+    std::vector<TickLodEntity> m_descs;
+    std::vector<std::uint32_t> m_tiers;
+    std::vector<std::uint32_t> m_phases;
+    std::vector<float> m_accumulated;
+    std::vector<std::uint8_t> m_ticking;
+    std::unordered_map<EntityId, std::uint32_t> m_index;
+
+    std::uint64_t m_frame = 0;
+    float m_frame_dt = 0.0f;
+    std::size_t m_ticking_count = 0;
+    std::vector<std::size_t> m_tier_counts;
+};
+
+} // namespace void_core
@@ -270,7 +270,7 @@ private:
         // Group SetField patches by entity+component
         struct Key {
             std::uint64_t entity_id;
-            std::string component_type;
+            Symbol component_type;
 
             bool operator==(const Key& other) const {
                 return entity_id == other.entity_id &&
@@ -281,7 +281,7 @@ private:
         struct KeyHash {
             std::size_t operator()(const Key& k) const {
                 return std::hash<std::uint64_t>{}(k.entity_id) ^
-                       (std::hash<std::string>{}(k.component_type) << 1);
+                       (std::hash<Symbol>{}(k.component_type) << 1);
             }
         };
 
@@ -305,7 +305,7 @@ private:
             Value combined = Value::empty_object();
 
             EntityRef entity;
-            std::string component_type;
+            Symbol component_type;
 
             for (std::size_t idx : indices) {
                 const auto& cp = patches[idx].as<ComponentPatch>();
@@ -434,10 +434,10 @@ private:
 
         // Add type-specific hash
         if (const auto* cp = patch.try_as<ComponentPatch>()) {
-            h ^= std::hash<std::string>{}(cp->component_type) << 3;
+            h ^= std::hash<Symbol>{}(cp->component_type) << 3;
             h ^= static_cast<std::size_t>(cp->operation) << 4;
             if (!cp->field_path.empty()) {
-                h ^= std::hash<std::string>{}(cp->field_path) << 5;
+                h ^= std::hash<Symbol>{}(cp->field_path) << 5;
             }
         }
 
@@ -6,16 +6,24 @@
 #include "fwd.hpp"
 #include "patch.hpp"
 #include "transaction.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
-#include <vector>
-#include <queue>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
-#include <condition_variable>
-#include <functional>
+#include <span>
+#include <string>
+#include <thread>
 #include <unordered_map>
-#include <atomic>
-#include <optional>
+#include <vector>
 
 namespace void_ir {
 
@@ -57,7 +65,7 @@ struct PatchFilter {
     std::optional<EntityRef> entity;
 
     /// Filter by component type (empty = all)
-    std::vector<std::string> component_types;
+    std::vector<Symbol> component_types;
 
     /// Create filter for all patches
     [[nodiscard]] static PatchFilter all() {
@@ -86,7 +94,7 @@ struct PatchFilter {
     }
 
     /// Create filter for component patches
-    [[nodiscard]] static PatchFilter for_components(std::vector<std::string> types) {
+    [[nodiscard]] static PatchFilter for_components(std::vector<Symbol> types) {
         PatchFilter f;
         f.kinds = {PatchKind::Component};
         f.component_types = std::move(types);
@@ -146,6 +154,8 @@ struct PatchFilter {
 // =============================================================================
 
 /// Event containing a patch and metadata
+///
+/// Owns its patch; used where events outlive the publish call (AsyncPatchBus).
 struct PatchEvent {
     Patch patch;
     NamespaceId namespace_id;
@@ -159,14 +169,53 @@ struct PatchEvent {
         , sequence_number(seq) {}
 };
 
+/// Event referring to a patch owned by the publisher
+///
+/// Delivered by PatchBus; only valid for the duration of the callback.
+/// Use to_event() to keep a copy.
+struct PatchEventRef {
+    const Patch& patch;
+    NamespaceId namespace_id;
+    TransactionId transaction_id;
+    std::size_t sequence_number = 0;
+
+    /// Copy into an owning event
+    [[nodiscard]] PatchEvent to_event() const {
+        return PatchEvent(patch, namespace_id, transaction_id, sequence_number);
+    }
+};
+
+/// Run of consecutive published patches delivered to batch subscribers
+///
+/// The span points into the publisher's batch and is only valid for the
+/// duration of the callback. Patch i has sequence number first_sequence + i.
+struct PatchBatchEvent {
+    std::span<const Patch> patches;
+    NamespaceId namespace_id;
+    TransactionId transaction_id;
+    std::size_t first_sequence = 0;
+};
+
 // =============================================================================
 // PatchBus
 // =============================================================================
 
 /// Thread-safe patch event bus
+///
+/// Subscriptions are routed through index tables rather than filtered one by
+/// one: each subscription is filed under the most selective key of its
+/// filter (entity, component type, patch kind, namespace, or none), and a
+/// published patch only visits the buckets for its own keys. Filters are
+/// still checked on the visited candidates, so routing never changes which
+/// subscriptions match.
+///
+/// Patches are delivered by reference, never copied. Batch subscribers
+/// receive each run of consecutive matching patches of a batch as one span.
+/// The order in which different subscriptions see a patch is unspecified.
 class PatchBus {
 public:
-    using Callback = std::function<void(const PatchEvent&)>;
+    using Callback = std::function<void(const PatchEventRef&)>;
+    using BatchCallback = std::function<void(const PatchBatchEvent&)>;
 
     /// Default constructor
     PatchBus() = default;
@@ -185,10 +234,21 @@ public:
         std::unique_lock lock(m_mutex);
 
         SubscriptionId id(m_next_subscription_id++);
-        m_subscriptions.emplace(id.value, Subscription{
-            std::move(filter),
-            std::move(callback)
-        });
+        auto sub = std::make_unique<Subscription>(Subscription{id, std::move(filter), std::move(callback), {}});
+        bucket_for(sub->filter).push_back(sub.get());
+        m_subscriptions.emplace(id.value, std::move(sub));
+
+        return id;
+    }
+
+    /// Subscribe to runs of patches with filter
+    [[nodiscard]] SubscriptionId subscribe_batch(PatchFilter filter, BatchCallback callback) {
+        std::unique_lock lock(m_mutex);
+
+        SubscriptionId id(m_next_subscription_id++);
+        auto sub = std::make_unique<Subscription>(Subscription{id, std::move(filter), {}, std::move(callback)});
+        m_batch_subscriptions.push_back(sub.get());
+        m_subscriptions.emplace(id.value, std::move(sub));
 
         return id;
     }
@@ -196,38 +256,52 @@ public:
     /// Unsubscribe
     bool unsubscribe(SubscriptionId id) {
         std::unique_lock lock(m_mutex);
-        return m_subscriptions.erase(id.value) > 0;
+
+        auto it = m_subscriptions.find(id.value);
+        if (it == m_subscriptions.end()) {
+            return false;
+        }
+
+        Subscription* sub = it->second.get();
+        auto& bucket = sub->batch_callback ? m_batch_subscriptions : bucket_for(sub->filter);
+        std::erase(bucket, sub);
+        m_subscriptions.erase(it);
+        return true;
     }
 
     /// Publish a single patch
-    void publish(Patch patch, NamespaceId ns, TransactionId tx = TransactionId::invalid()) {
+    void publish(const Patch& patch, NamespaceId ns, TransactionId tx = TransactionId::invalid()) {
         std::shared_lock lock(m_mutex);
 
         std::size_t seq = m_sequence_number.fetch_add(1, std::memory_order_relaxed);
-        PatchEvent event(std::move(patch), ns, tx, seq);
-
-        for (auto& [id, sub] : m_subscriptions) {
-            if (sub.filter.matches(event.patch, ns)) {
-                sub.callback(event);
-            }
-        }
+        route(PatchEventRef{patch, ns, tx, seq});
+        deliver_runs(std::span<const Patch>(&patch, 1), ns, tx, seq);
     }
 
     /// Publish a batch of patches
-    void publish_batch(const PatchBatch& batch, NamespaceId ns,
+    void publish_batch(std::span<const Patch> patches, NamespaceId ns,
                        TransactionId tx = TransactionId::invalid()) {
+        if (patches.empty()) {
+            return;
+        }
+
         std::shared_lock lock(m_mutex);
 
-        for (const auto& patch : batch) {
-            std::size_t seq = m_sequence_number.fetch_add(1, std::memory_order_relaxed);
-            PatchEvent event(Patch(patch), ns, tx, seq);
+        std::size_t first = m_sequence_number.fetch_add(patches.size(), std::memory_order_relaxed);
+        if (m_subscriptions.empty()) {
+            return;
+        }
 
-            for (auto& [id, sub] : m_subscriptions) {
-                if (sub.filter.matches(event.patch, ns)) {
-                    sub.callback(event);
-                }
-            }
+        for (std::size_t i = 0; i < patches.size(); ++i) {
+            route(PatchEventRef{patches[i], ns, tx, first + i});
         }
+        deliver_runs(patches, ns, tx, first);
+    }
+
+    /// Publish a batch of patches
+    void publish_batch(const PatchBatch& batch, NamespaceId ns,
+                       TransactionId tx = TransactionId::invalid()) {
+        publish_batch(std::span<const Patch>(batch.patches()), ns, tx);
     }
 
     /// Publish a transaction (all patches in order)
@@ -249,19 +323,123 @@ public:
     /// Shutdown the bus
     void shutdown() {
         std::unique_lock lock(m_mutex);
+        m_entity_routes.clear();
+        m_component_routes.clear();
+        for (auto& bucket : m_kind_routes) {
+            bucket.clear();
+        }
+        m_namespace_routes.clear();
+        m_unfiltered.clear();
+        m_batch_subscriptions.clear();
         m_subscriptions.clear();
     }
 
 private:
+    static constexpr std::size_t k_kind_count = static_cast<std::size_t>(PatchKind::Custom) + 1;
+
     struct Subscription {
+        SubscriptionId id;
         PatchFilter filter;
         Callback callback;
+        BatchCallback batch_callback;
     };
 
+    using Bucket = std::vector<Subscription*>;
+
+    /// Bucket a per-patch subscription is filed under
+    Bucket& bucket_for(const PatchFilter& filter) {
+        if (filter.entity) {
+            return m_entity_routes[*filter.entity];
+        }
+
+        // Component types only restrict component patches, so they can only
+        // key the route when nothing else is accepted
+        bool components_only = filter.kinds.size() == 1 && filter.kinds[0] == PatchKind::Component;
+        if (components_only && filter.component_types.size() == 1) {
+            return m_component_routes[filter.component_types[0]];
+        }
+
+        if (filter.kinds.size() == 1) {
+            return m_kind_routes[static_cast<std::size_t>(filter.kinds[0])];
+        }
+        if (filter.namespace_id) {
+            return m_namespace_routes[*filter.namespace_id];
+        }
+        return m_unfiltered;
+    }
+
+    /// Deliver one patch to the per-patch subscriptions routed to it
+    void route(const PatchEventRef& event) const {
+        const Patch& patch = event.patch;
+
+        if (!m_entity_routes.empty()) {
+            if (auto target = patch.target_entity()) {
+                if (auto it = m_entity_routes.find(*target); it != m_entity_routes.end()) {
+                    deliver(it->second, event);
+                }
+            }
+        }
+
+        if (!m_component_routes.empty()) {
+            if (const auto* cp = patch.try_as<ComponentPatch>()) {
+                if (auto it = m_component_routes.find(cp->component_type); it != m_component_routes.end()) {
+                    deliver(it->second, event);
+                }
+            }
+        }
+
+        deliver(m_kind_routes[static_cast<std::size_t>(patch.kind())], event);
+
+        if (!m_namespace_routes.empty()) {
+            if (auto it = m_namespace_routes.find(event.namespace_id); it != m_namespace_routes.end()) {
+                deliver(it->second, event);
+            }
+        }
+
+        deliver(m_unfiltered, event);
+    }
+
+    static void deliver(const Bucket& bucket, const PatchEventRef& event) {
+        for (const Subscription* sub : bucket) {
+            if (sub->filter.matches(event.patch, event.namespace_id)) {
+                sub->callback(event);
+            }
+        }
+    }
+
+    /// Deliver runs of consecutive matching patches to batch subscribers
+    void deliver_runs(std::span<const Patch> patches, NamespaceId ns, TransactionId tx,
+                      std::size_t first) const {
+        for (const Subscription* sub : m_batch_subscriptions) {
+            std::size_t i = 0;
+            while (i < patches.size()) {
+                while (i < patches.size() && !sub->filter.matches(patches[i], ns)) {
+                    ++i;
+                }
+                std::size_t start = i;
+                while (i < patches.size() && sub->filter.matches(patches[i], ns)) {
+                    ++i;
+                }
+                if (i > start) {
+                    sub->batch_callback(PatchBatchEvent{patches.subspan(start, i - start), ns, tx, first + start});
+                }
+            }
+        }
+    }
+
     mutable std::shared_mutex m_mutex;
-    std::unordered_map<std::uint64_t, Subscription> m_subscriptions;
+    std::unordered_map<std::uint64_t, std::unique_ptr<Subscription>> m_subscriptions;
     std::uint64_t m_next_subscription_id = 0;
     std::atomic<std::size_t> m_sequence_number{0};
+
+    // Routing tables for per-patch subscriptions; each is in exactly one
+    std::unordered_map<EntityRef, Bucket> m_entity_routes;
+    std::unordered_map<Symbol, Bucket> m_component_routes;
+    std::array<Bucket, k_kind_count> m_kind_routes;
+    std::unordered_map<NamespaceId, Bucket> m_namespace_routes;
+    Bucket m_unfiltered;
+
+    Bucket m_batch_subscriptions;
 };
 
 // =============================================================================
@@ -269,10 +447,30 @@ private:
 // =============================================================================
 
 /// Async patch bus with queue for decoupled consumption
+///
+/// Events go through a bounded lock-free ring: publishers claim slots with a
+/// compare-and-swap on the tail and never take a lock. Consumption is
+/// single-consumer; only one thread may consume at a time. A consumer that
+/// blocks registers itself as waiting, and publishers only touch the wakeup
+/// mutex while one is.
+///
+/// When the ring is full, publishers spill into a mutex-protected overflow
+/// queue instead of waiting, so a thread may publish any number of events
+/// before the consumer runs. While the overflow holds events every publisher
+/// appends to it, which keeps each publisher's events in order; the consumer
+/// drains the ring before the overflow.
 class AsyncPatchBus {
 public:
-    /// Default constructor
-    AsyncPatchBus() = default;
+    static constexpr std::size_t k_default_capacity = 8192;
+
+    /// Construct with ring capacity (rounded up to a power of two)
+    explicit AsyncPatchBus(std::size_t capacity = k_default_capacity)
+        : m_capacity(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+        , m_cells(std::make_unique<Cell[]>(m_capacity)) {
+        for (std::size_t i = 0; i < m_capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
 
     /// Destructor
     ~AsyncPatchBus() {
@@ -283,128 +481,256 @@ public:
     AsyncPatchBus(const AsyncPatchBus&) = delete;
     AsyncPatchBus& operator=(const AsyncPatchBus&) = delete;
 
-    /// Publish a patch (non-blocking)
+    /// Publish a patch (never blocks on the consumer)
     void publish(Patch patch, NamespaceId ns, TransactionId tx = TransactionId::invalid()) {
         std::size_t seq = m_sequence_number.fetch_add(1, std::memory_order_relaxed);
+        enqueue(std::move(patch), ns, tx, seq);
+        wake_consumer();
+    }
 
-        {
-            std::lock_guard lock(m_queue_mutex);
-            m_queue.emplace(std::move(patch), ns, tx, seq);
+    /// Publish a batch
+    void publish_batch(std::span<const Patch> patches, NamespaceId ns,
+                       TransactionId tx = TransactionId::invalid()) {
+        std::size_t first = m_sequence_number.fetch_add(patches.size(), std::memory_order_relaxed);
+        for (std::size_t i = 0; i < patches.size(); ++i) {
+            enqueue(patches[i], ns, tx, first + i);
         }
-
-        m_condition.notify_one();
+        wake_consumer();
     }
 
     /// Publish a batch
     void publish_batch(const PatchBatch& batch, NamespaceId ns,
                        TransactionId tx = TransactionId::invalid()) {
-        {
-            std::lock_guard lock(m_queue_mutex);
-            for (const auto& patch : batch) {
-                std::size_t seq = m_sequence_number.fetch_add(1, std::memory_order_relaxed);
-                m_queue.emplace(Patch(patch), ns, tx, seq);
-            }
-        }
+        publish_batch(std::span<const Patch>(batch.patches()), ns, tx);
+    }
 
-        m_condition.notify_all();
+    /// Publish a batch, moving its patches
+    void publish_batch(PatchBatch&& batch, NamespaceId ns,
+                       TransactionId tx = TransactionId::invalid()) {
+        auto& patches = batch.patches();
+        std::size_t first = m_sequence_number.fetch_add(patches.size(), std::memory_order_relaxed);
+        for (std::size_t i = 0; i < patches.size(); ++i) {
+            enqueue(std::move(patches[i]), ns, tx, first + i);
+        }
+        batch.clear();
+        wake_consumer();
     }
 
     /// Try to consume a patch (non-blocking)
     [[nodiscard]] std::optional<PatchEvent> try_consume() {
-        std::lock_guard lock(m_queue_mutex);
-
-        if (m_queue.empty()) {
-            return std::nullopt;
-        }
-
-        PatchEvent event = std::move(m_queue.front());
-        m_queue.pop();
-        return event;
+        return dequeue();
     }
 
     /// Consume a patch (blocking)
     [[nodiscard]] std::optional<PatchEvent> consume() {
-        std::unique_lock lock(m_queue_mutex);
-
-        m_condition.wait(lock, [this] {
-            return !m_queue.empty() || m_shutdown;
-        });
+        while (true) {
+            if (auto event = dequeue()) {
+                return event;
+            }
+            if (m_shutdown.load(std::memory_order_acquire)) {
+                return dequeue();
+            }
 
-        if (m_shutdown && m_queue.empty()) {
-            return std::nullopt;
+            std::unique_lock lock(m_wait_mutex);
+            if (!begin_wait()) {
+                continue;
+            }
+            m_condition.wait(lock, [this] {
+                return !empty() || m_shutdown.load(std::memory_order_acquire);
+            });
+            m_waiting.fetch_sub(1, std::memory_order_relaxed);
         }
-
-        PatchEvent event = std::move(m_queue.front());
-        m_queue.pop();
-        return event;
     }
 
     /// Consume with timeout
     [[nodiscard]] std::optional<PatchEvent> consume_timeout(
         std::chrono::milliseconds timeout) {
-        std::unique_lock lock(m_queue_mutex);
+        auto deadline = std::chrono::steady_clock::now() + timeout;
 
-        bool ready = m_condition.wait_for(lock, timeout, [this] {
-            return !m_queue.empty() || m_shutdown;
-        });
+        while (true) {
+            if (auto event = dequeue()) {
+                return event;
+            }
+            if (m_shutdown.load(std::memory_order_acquire)) {
+                return std::nullopt;
+            }
 
-        if (!ready || (m_shutdown && m_queue.empty())) {
-            return std::nullopt;
-        }
+            std::unique_lock lock(m_wait_mutex);
+            if (!begin_wait()) {
+                continue;
+            }
+            bool ready = m_condition.wait_until(lock, deadline, [this] {
+                return !empty() || m_shutdown.load(std::memory_order_acquire);
+            });
+            m_waiting.fetch_sub(1, std::memory_order_relaxed);
 
-        PatchEvent event = std::move(m_queue.front());
-        m_queue.pop();
-        return event;
+            if (!ready) {
+                return std::nullopt;
+            }
+        }
     }
 
     /// Consume all available patches
     [[nodiscard]] std::vector<PatchEvent> consume_all() {
-        std::lock_guard lock(m_queue_mutex);
-
         std::vector<PatchEvent> events;
-        events.reserve(m_queue.size());
+        events.reserve(queue_size());
 
-        while (!m_queue.empty()) {
-            events.push_back(std::move(m_queue.front()));
-            m_queue.pop();
+        while (auto event = dequeue()) {
+            events.push_back(std::move(*event));
         }
 
         return events;
     }
 
-    /// Get queue size
+    /// Get queue size (approximate while publishers are active)
     [[nodiscard]] std::size_t queue_size() const {
-        std::lock_guard lock(m_queue_mutex);
-        return m_queue.size();
+        std::size_t head = m_head.load(std::memory_order_acquire);
+        std::size_t tail = m_tail.load(std::memory_order_acquire);
+        return (tail > head ? tail - head : 0) + m_overflow_size.load(std::memory_order_acquire);
+    }
+
+    /// Total number of events that did not fit in the ring
+    [[nodiscard]] std::size_t overflow_count() const noexcept {
+        return m_overflow_count.load(std::memory_order_relaxed);
+    }
+
+    /// Get ring capacity
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return m_capacity;
     }
 
     /// Check if queue is empty
     [[nodiscard]] bool empty() const {
-        std::lock_guard lock(m_queue_mutex);
-        return m_queue.empty();
+        std::size_t head = m_head.load(std::memory_order_acquire);
+        const Cell& cell = m_cells[head & (m_capacity - 1)];
+        return cell.sequence.load(std::memory_order_acquire) != head + 1 &&
+               m_overflow_size.load(std::memory_order_acquire) == 0;
     }
 
     /// Shutdown the bus (wake up waiting consumers)
     void shutdown() {
-        {
-            std::lock_guard lock(m_queue_mutex);
-            m_shutdown = true;
-        }
+        m_shutdown.store(true, std::memory_order_release);
+        std::lock_guard lock(m_wait_mutex);
         m_condition.notify_all();
     }
 
     /// Check if shutdown
     [[nodiscard]] bool is_shutdown() const {
-        std::lock_guard lock(m_queue_mutex);
-        return m_shutdown;
+        return m_shutdown.load(std::memory_order_acquire);
     }
 
 private:
-    mutable std::mutex m_queue_mutex;
+    /// Ring slot; sequence == index when free, index + 1 when filled
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        std::optional<PatchEvent> event;
+    };
+
+    template<typename P>
+    void enqueue(P&& patch, NamespaceId ns, TransactionId tx, std::size_t seq) {
+        // Once anything has spilled, later events must follow it there
+        if (m_overflow_size.load(std::memory_order_acquire) == 0) {
+            if (Cell* cell = claim_cell()) {
+                cell->event.emplace(Patch(std::forward<P>(patch)), ns, tx, seq);
+                cell->sequence.fetch_add(1, std::memory_order_release);
+                return;
+            }
+        }
+
+        std::lock_guard lock(m_overflow_mutex);
+        m_overflow.emplace_back(Patch(std::forward<P>(patch)), ns, tx, seq);
+        m_overflow_size.store(m_overflow.size(), std::memory_order_release);
+        m_overflow_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Claim the tail slot of the ring; nullptr when it is full
+    Cell* claim_cell() {
+        std::size_t pos = m_tail.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell* cell = &m_cells[pos & (m_capacity - 1)];
+            std::size_t cell_seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(cell_seq) - static_cast<std::ptrdiff_t>(pos);
+
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::optional<PatchEvent> dequeue() {
+        std::size_t head = m_head.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[head & (m_capacity - 1)];
+
+        if (cell.sequence.load(std::memory_order_acquire) != head + 1) {
+            return dequeue_overflow();
+        }
+
+        std::optional<PatchEvent> event = std::move(cell.event);
+        cell.event.reset();
+        cell.sequence.store(head + m_capacity, std::memory_order_release);
+        m_head.store(head + 1, std::memory_order_release);
+        return event;
+    }
+
+    std::optional<PatchEvent> dequeue_overflow() {
+        if (m_overflow_size.load(std::memory_order_acquire) == 0) {
+            return std::nullopt;
+        }
+
+        std::lock_guard lock(m_overflow_mutex);
+        if (m_overflow.empty()) {
+            return std::nullopt;
+        }
+        std::optional<PatchEvent> event = std::move(m_overflow.front());
+        m_overflow.pop_front();
+        m_overflow_size.store(m_overflow.size(), std::memory_order_release);
+        return event;
+    }
+
+    /// Register the consumer as waiting; false if an event arrived meanwhile
+    bool begin_wait() {
+        m_waiting.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!empty() || m_shutdown.load(std::memory_order_acquire)) {
+            m_waiting.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    void wake_consumer() {
+        // Pairs with the fence in begin_wait: either the consumer sees the
+        // new event or we see it waiting
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiting.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard lock(m_wait_mutex);
+            m_condition.notify_all();
+        }
+    }
+
+    const std::size_t m_capacity;
+    std::unique_ptr<Cell[]> m_cells;
+
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+    alignas(64) std::atomic<std::size_t> m_head{0};
+    alignas(64) std::atomic<std::size_t> m_sequence_number{0};
+
+    std::mutex m_overflow_mutex;
+    std::deque<PatchEvent> m_overflow;
+    std::atomic<std::size_t> m_overflow_size{0};
+    std::atomic<std::size_t> m_overflow_count{0};
+
+    std::atomic<std::uint32_t> m_waiting{0};
+    std::atomic<bool> m_shutdown{false};
+    std::mutex m_wait_mutex;
     std::condition_variable m_condition;
-    std::queue<PatchEvent> m_queue;
-    std::atomic<std::size_t> m_sequence_number{0};
-    bool m_shutdown = false;
 };
 
 } // namespace void_ir
@@ -17,6 +17,9 @@ struct NamespaceId;
 /// Reference to an entity within a namespace
 struct EntityRef;
 
+/// Interned string identifier
+class Symbol;
+
 /// Unique transaction identifier
 struct TransactionId;
 
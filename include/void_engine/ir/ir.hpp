@@ -54,7 +54,7 @@
 /// // Subscribe to component changes
 /// auto sub_id = bus.subscribe(
 ///     PatchFilter::for_kinds({PatchKind::Component}),
-///     [](const PatchEvent& event) {
+///     [](const PatchEventRef& event) {
 ///         // Handle patch...
 ///     }
 /// );
@@ -123,6 +123,7 @@
 /// @endcode
 
 #include "fwd.hpp"
+#include "symbol.hpp"
 #include "namespace.hpp"
 #include "value.hpp"
 #include "patch.hpp"
@@ -100,31 +100,30 @@ enum class ComponentOp : std::uint8_t {
 /// Patch for component modifications
 struct ComponentPatch {
     EntityRef entity;
-    std::string component_type;
+    Symbol component_type;
     ComponentOp operation = ComponentOp::Set;
-    std::string field_path;  // For SetField operation
+    Symbol field_path;       // For SetField operation
     Value value;             // New value (for Add, Set, SetField)
 
     /// Add component to entity
-    [[nodiscard]] static ComponentPatch add(EntityRef ref, std::string type, Value val) {
-        return ComponentPatch{ref, std::move(type), ComponentOp::Add, "", std::move(val)};
+    [[nodiscard]] static ComponentPatch add(EntityRef ref, Symbol type, Value val) {
+        return ComponentPatch{ref, type, ComponentOp::Add, Symbol(), std::move(val)};
     }
 
     /// Remove component from entity
-    [[nodiscard]] static ComponentPatch remove(EntityRef ref, std::string type) {
-        return ComponentPatch{ref, std::move(type), ComponentOp::Remove, "", Value::null()};
+    [[nodiscard]] static ComponentPatch remove(EntityRef ref, Symbol type) {
+        return ComponentPatch{ref, type, ComponentOp::Remove, Symbol(), Value::null()};
     }
 
     /// Set entire component value
-    [[nodiscard]] static ComponentPatch set(EntityRef ref, std::string type, Value val) {
-        return ComponentPatch{ref, std::move(type), ComponentOp::Set, "", std::move(val)};
+    [[nodiscard]] static ComponentPatch set(EntityRef ref, Symbol type, Value val) {
+        return ComponentPatch{ref, type, ComponentOp::Set, Symbol(), std::move(val)};
     }
 
     /// Set single field
     [[nodiscard]] static ComponentPatch set_field(
-        EntityRef ref, std::string type, std::string field, Value val) {
-        return ComponentPatch{ref, std::move(type), ComponentOp::SetField,
-                              std::move(field), std::move(val)};
+        EntityRef ref, Symbol type, Symbol field, Value val) {
+        return ComponentPatch{ref, type, ComponentOp::SetField, field, std::move(val)};
     }
 };
 
@@ -240,41 +239,41 @@ enum class AssetOp : std::uint8_t {
 /// Patch for asset references
 struct AssetPatch {
     EntityRef entity;
-    std::string component_type;  // Component that holds the asset ref
-    std::string field_path;      // Field path to the asset ref
+    Symbol component_type;       // Component that holds the asset ref
+    Symbol field_path;           // Field path to the asset ref
     AssetOp operation = AssetOp::SetRef;
     AssetRef asset;
 
     /// Load asset
-    [[nodiscard]] static AssetPatch load(EntityRef ref, std::string comp,
-                                          std::string field, AssetRef asset) {
+    [[nodiscard]] static AssetPatch load(EntityRef ref, Symbol comp,
+                                          Symbol field, AssetRef asset) {
         AssetPatch p;
         p.entity = ref;
-        p.component_type = std::move(comp);
-        p.field_path = std::move(field);
+        p.component_type = comp;
+        p.field_path = field;
         p.operation = AssetOp::Load;
         p.asset = std::move(asset);
         return p;
     }
 
     /// Unload asset
-    [[nodiscard]] static AssetPatch unload(EntityRef ref, std::string comp,
-                                            std::string field) {
+    [[nodiscard]] static AssetPatch unload(EntityRef ref, Symbol comp,
+                                            Symbol field) {
         AssetPatch p;
         p.entity = ref;
-        p.component_type = std::move(comp);
-        p.field_path = std::move(field);
+        p.component_type = comp;
+        p.field_path = field;
         p.operation = AssetOp::Unload;
         return p;
     }
 
     /// Set asset reference
-    [[nodiscard]] static AssetPatch set_ref(EntityRef ref, std::string comp,
-                                             std::string field, AssetRef asset) {
+    [[nodiscard]] static AssetPatch set_ref(EntityRef ref, Symbol comp,
+                                             Symbol field, AssetRef asset) {
         AssetPatch p;
         p.entity = ref;
-        p.component_type = std::move(comp);
-        p.field_path = std::move(field);
+        p.component_type = comp;
+        p.field_path = field;
         p.operation = AssetOp::SetRef;
         p.asset = std::move(asset);
         return p;
@@ -7,9 +7,11 @@
 #include "namespace.hpp"
 #include "value.hpp"
 #include "patch.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <optional>
@@ -29,15 +31,15 @@ struct EntitySnapshot {
     EntityRef entity;
     std::string name;
     bool enabled = true;
-    std::unordered_map<std::string, Value> components;
+    std::unordered_map<Symbol, Value> components;
 
     /// Check if entity has component
-    [[nodiscard]] bool has_component(const std::string& type) const {
+    [[nodiscard]] bool has_component(Symbol type) const {
         return components.find(type) != components.end();
     }
 
     /// Get component value
-    [[nodiscard]] const Value* get_component(const std::string& type) const {
+    [[nodiscard]] const Value* get_component(Symbol type) const {
         auto it = components.find(type);
         if (it == components.end()) {
             return nullptr;
@@ -240,6 +242,9 @@ private:
 // SnapshotDelta
 // =============================================================================
 
+class BinaryWriter;
+class BinaryReader;
+
 /// Difference between two snapshots
 class SnapshotDelta {
 public:
@@ -254,7 +259,7 @@ public:
     /// Component changes
     struct ComponentChange {
         EntityRef entity;
-        std::string component_type;
+        Symbol component_type;
         enum class Type { Added, Removed, Modified } type;
         std::optional<Value> old_value;
         std::optional<Value> new_value;
@@ -386,6 +391,19 @@ public:
         return delta;
     }
 
+    /// Encode in compact binary form
+    ///
+    /// Entity ids are varint-encoded relative to the previous change and
+    /// component types and keys are written once per stream, then by index.
+    /// Modified values are written as field diffs against their old value.
+    /// Old values that match the baseline (the snapshot the delta was
+    /// computed from) are omitted.
+    void encode(BinaryWriter& writer, const Snapshot* baseline = nullptr) const;
+
+    /// Decode a delta written by encode(), given the same baseline
+    [[nodiscard]] static std::optional<SnapshotDelta> decode(
+        BinaryReader& reader, const Snapshot* baseline = nullptr);
+
 private:
     std::vector<EntityChange> m_entity_changes;
     std::vector<ComponentChange> m_component_changes;
@@ -574,6 +592,32 @@ public:
         m_buffer.insert(m_buffer.end(), data.begin(), data.end());
     }
 
+    /// Write LEB128 varint
+    void write_varint(std::uint64_t v) {
+        while (v >= 0x80) {
+            m_buffer.push_back(static_cast<std::uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        m_buffer.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    /// Write signed varint (zigzag)
+    void write_zigzag(std::int64_t v) {
+        write_varint((static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+    }
+
+    /// Write string with varint length
+    void write_compact_string(std::string_view s) {
+        write_varint(s.size());
+        m_buffer.insert(m_buffer.end(), s.begin(), s.end());
+    }
+
+    /// Write bytes with varint length
+    void write_compact_bytes(const std::vector<std::uint8_t>& data) {
+        write_varint(data.size());
+        m_buffer.insert(m_buffer.end(), data.begin(), data.end());
+    }
+
     /// Get the buffer
     [[nodiscard]] std::vector<std::uint8_t> take() {
         return std::move(m_buffer);
@@ -597,6 +641,10 @@ public:
         return m_offset + bytes <= m_data.size();
     }
 
+    [[nodiscard]] std::size_t remaining() const {
+        return m_offset < m_data.size() ? m_data.size() - m_offset : 0;
+    }
+
     [[nodiscard]] std::uint8_t read_u8() {
         if (!has_remaining(1)) return 0;
         return m_data[m_offset++];
@@ -654,11 +702,62 @@ public:
         return data;
     }
 
-    [[nodiscard]] bool valid() const { return m_offset <= m_data.size(); }
+    /// Read LEB128 varint
+    [[nodiscard]] std::uint64_t read_varint() {
+        std::uint64_t v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (!has_remaining(1)) {
+                m_overrun = true;
+                return 0;
+            }
+            std::uint8_t byte = m_data[m_offset++];
+            v |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return v;
+            }
+        }
+        m_overrun = true;
+        return 0;
+    }
+
+    /// Read signed varint (zigzag)
+    [[nodiscard]] std::int64_t read_zigzag() {
+        std::uint64_t v = read_varint();
+        return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+    }
+
+    /// Read string with varint length
+    [[nodiscard]] std::string read_compact_string() {
+        std::uint64_t len = read_varint();
+        if (len > m_data.size() - m_offset) {
+            m_overrun = true;
+            return "";
+        }
+        auto first = m_data.begin() + static_cast<std::ptrdiff_t>(m_offset);
+        std::string s(first, first + static_cast<std::ptrdiff_t>(len));
+        m_offset += len;
+        return s;
+    }
+
+    /// Read bytes with varint length
+    [[nodiscard]] std::vector<std::uint8_t> read_compact_bytes() {
+        std::uint64_t len = read_varint();
+        if (len > m_data.size() - m_offset) {
+            m_overrun = true;
+            return {};
+        }
+        auto first = m_data.begin() + static_cast<std::ptrdiff_t>(m_offset);
+        std::vector<std::uint8_t> data(first, first + static_cast<std::ptrdiff_t>(len));
+        m_offset += len;
+        return data;
+    }
+
+    [[nodiscard]] bool valid() const { return !m_overrun && m_offset <= m_data.size(); }
 
 private:
     const std::vector<std::uint8_t>& m_data;
     std::size_t m_offset;
+    bool m_overrun = false;
 };
 
 /// Serialize a Value to binary
@@ -726,7 +825,7 @@ inline void serialize_value(BinaryWriter& writer, const Value& value) {
                 const auto& obj = value.as_object();
                 writer.write_u32(static_cast<std::uint32_t>(obj.size()));
                 for (const auto& [key, val] : obj) {
-                    writer.write_string(key);
+                    writer.write_string(key.str());
                     serialize_value(writer, val);
                 }
             }
@@ -794,11 +893,11 @@ inline void serialize_value(BinaryWriter& writer, const Value& value) {
         case ValueType::Object:
             {
                 std::uint32_t count = reader.read_u32();
-                std::unordered_map<std::string, Value> obj;
+                ValueObject obj;
                 for (std::uint32_t i = 0; i < count; ++i) {
-                    std::string key = reader.read_string();
+                    Symbol key(reader.read_string());
                     Value val = deserialize_value(reader);
-                    obj.emplace(std::move(key), std::move(val));
+                    obj.emplace(key, std::move(val));
                 }
                 return Value(std::move(obj));
             }
@@ -843,7 +942,7 @@ inline void serialize_value(BinaryWriter& writer, const Value& value) {
         // Components
         writer.write_u32(static_cast<std::uint32_t>(entity.components.size()));
         for (const auto& [type, value] : entity.components) {
-            writer.write_string(type);
+            writer.write_string(type.str());
             serialize_value(writer, value);
         }
     }
@@ -923,9 +1022,9 @@ inline void serialize_value(BinaryWriter& writer, const Value& value) {
         // Components
         std::uint32_t comp_count = reader.read_u32();
         for (std::uint32_t j = 0; j < comp_count; ++j) {
-            std::string type = reader.read_string();
+            Symbol type(reader.read_string());
             Value value = deserialize_value(reader);
-            entity.components.emplace(std::move(type), std::move(value));
+            entity.components.emplace(type, std::move(value));
         }
 
         snapshot.add_entity(std::move(entity));
@@ -984,6 +1083,21 @@ inline void serialize_value(BinaryWriter& writer, const Value& value) {
     return snapshot;
 }
 
+/// Serialize a SnapshotDelta in compact binary form
+[[nodiscard]] inline std::vector<std::uint8_t> serialize_delta(
+    const SnapshotDelta& delta, const Snapshot* baseline = nullptr) {
+    BinaryWriter writer;
+    delta.encode(writer, baseline);
+    return writer.take();
+}
+
+/// Deserialize a SnapshotDelta written by serialize_delta
+[[nodiscard]] inline std::optional<SnapshotDelta> deserialize_delta(
+    const std::vector<std::uint8_t>& data, const Snapshot* baseline = nullptr) {
+    BinaryReader reader(data);
+    return SnapshotDelta::decode(reader, baseline);
+}
+
 /// Convenience functions for hot-reload workflow
 [[nodiscard]] inline std::vector<std::uint8_t> take_ir_snapshot(
     const SnapshotManager& manager) {
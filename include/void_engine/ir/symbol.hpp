@@ -0,0 +1,173 @@
+#pragma once
+
+/// @file symbol.hpp
+/// @brief Interned string identifiers for void_ir
+
+#include "fwd.hpp"
+#include <array>
+#include <atomic>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace void_ir {
+
+// =============================================================================
+// SymbolTable
+// =============================================================================
+
+/// Process-wide string interner
+///
+/// Maps each distinct string to a dense 32-bit id. Id 0 is the empty
+/// string. Interned strings are never freed and never move, so looking up
+/// the text of an id takes no lock.
+class SymbolTable {
+public:
+    /// Get the global table
+    [[nodiscard]] static SymbolTable& instance();
+
+    /// Get the id of text, interning it if new
+    [[nodiscard]] std::uint32_t intern(std::string_view text);
+
+    /// Get the id of text if it has been interned
+    [[nodiscard]] std::optional<std::uint32_t> find(std::string_view text) const;
+
+    /// Check if id has been handed out by intern()
+    [[nodiscard]] bool contains(std::uint32_t id) const noexcept {
+        return id < m_count.load(std::memory_order_acquire);
+    }
+
+    /// Get the text of an interned id; ids never interned read as empty
+    [[nodiscard]] const std::string& text(std::uint32_t id) const noexcept {
+        if (!contains(id)) {
+            id = 0;
+        }
+        return m_chunks[id >> k_chunk_bits].load(std::memory_order_acquire)[id & (k_chunk_size - 1)];
+    }
+
+    /// Get number of interned strings
+    [[nodiscard]] std::size_t size() const noexcept {
+        return m_count.load(std::memory_order_acquire);
+    }
+
+private:
+    SymbolTable();
+
+    static constexpr std::uint32_t k_chunk_bits = 10;
+    static constexpr std::uint32_t k_chunk_size = 1u << k_chunk_bits;
+    static constexpr std::uint32_t k_max_chunks = 1u << 14;
+
+    std::array<std::atomic<std::string*>, k_max_chunks> m_chunks{};
+    std::atomic<std::uint32_t> m_count{0};
+
+    mutable std::shared_mutex m_mutex;
+    std::unordered_map<std::string_view, std::uint32_t> m_index;
+};
+
+// =============================================================================
+// Symbol
+// =============================================================================
+
+/// Interned string identifier
+///
+/// Used for component types, field paths and object keys. Comparing and
+/// hashing a symbol only touches its id; the text is looked up on demand,
+/// typically at serialization boundaries. Constructing from a string interns
+/// it, so keep symbols for names used on hot paths.
+class Symbol {
+public:
+    /// Empty symbol
+    constexpr Symbol() noexcept = default;
+
+    /// Intern text
+    Symbol(std::string_view text)
+        : m_id(text.empty() ? 0 : SymbolTable::instance().intern(text)) {}
+
+    /// Intern text
+    Symbol(const std::string& text) : Symbol(std::string_view(text)) {}
+
+    /// Intern text
+    Symbol(const char* text) : Symbol(std::string_view(text)) {}
+
+    /// Create from an id returned by id(); nullopt if it was never interned
+    [[nodiscard]] static std::optional<Symbol> from_id(std::uint32_t id) noexcept {
+        if (!SymbolTable::instance().contains(id)) {
+            return std::nullopt;
+        }
+        return Symbol(IdTag{}, id);
+    }
+
+    /// Get the symbol if text has been interned
+    [[nodiscard]] static std::optional<Symbol> find(std::string_view text) {
+        if (text.empty()) {
+            return Symbol();
+        }
+        auto id = SymbolTable::instance().find(text);
+        if (!id) {
+            return std::nullopt;
+        }
+        return Symbol(IdTag{}, *id);
+    }
+
+    /// Get id
+    [[nodiscard]] constexpr std::uint32_t id() const noexcept {
+        return m_id;
+    }
+
+    /// Check if empty string
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return m_id == 0;
+    }
+
+    /// Get text
+    [[nodiscard]] const std::string& str() const {
+        return SymbolTable::instance().text(m_id);
+    }
+
+    /// Get text
+    [[nodiscard]] std::string_view view() const {
+        return str();
+    }
+
+    /// Get text
+    operator const std::string&() const {
+        return str();
+    }
+
+    constexpr bool operator==(const Symbol& other) const noexcept = default;
+    constexpr auto operator<=>(const Symbol& other) const noexcept = default;
+
+    bool operator==(std::string_view text) const {
+        return view() == text;
+    }
+
+    bool operator==(const std::string& text) const {
+        return view() == text;
+    }
+
+    bool operator==(const char* text) const {
+        return view() == text;
+    }
+
+private:
+    struct IdTag {};
+
+    constexpr Symbol(IdTag, std::uint32_t id) noexcept : m_id(id) {}
+
+    std::uint32_t m_id = 0;
+};
+
+} // namespace void_ir
+
+// Hash specialization
+template<>
+struct std::hash<void_ir::Symbol> {
+    std::size_t operator()(const void_ir::Symbol& symbol) const noexcept {
+        return std::hash<std::uint32_t>{}(symbol.id());
+    }
+};
@@ -584,7 +584,7 @@ struct Conflict {
     TransactionId tx_a;
     TransactionId tx_b;
     std::optional<EntityRef> entity;
-    std::optional<std::string> component_type;
+    std::optional<Symbol> component_type;
     std::optional<LayerId> layer;
     std::optional<AssetRef> asset;
 
@@ -607,13 +607,13 @@ struct Conflict {
     }
 
     [[nodiscard]] static Conflict component_conflict(
-        TransactionId a, TransactionId b, EntityRef e, std::string comp) {
+        TransactionId a, TransactionId b, EntityRef e, Symbol comp) {
         Conflict c;
         c.type = ConflictType::Component;
         c.tx_a = a;
         c.tx_b = b;
         c.entity = e;
-        c.component_type = std::move(comp);
+        c.component_type = comp;
         return c;
     }
 
@@ -819,9 +819,117 @@ public:
 
 private:
     std::unordered_map<std::uint64_t, std::vector<TransactionId>> m_modified_entities;
-    std::map<std::pair<std::uint64_t, std::string>, std::vector<TransactionId>> m_modified_components;
+    std::map<std::pair<std::uint64_t, Symbol>, std::vector<TransactionId>> m_modified_components;
     std::unordered_map<std::uint32_t, std::vector<TransactionId>> m_modified_layers;
     std::unordered_map<std::uint64_t, std::vector<TransactionId>> m_modified_assets;
 };
 
+// =============================================================================
+// TransactionApplier
+// =============================================================================
+
+/// Patches of a transaction grouped for parallel application
+///
+/// Phases run one after another. A parallel phase holds partitions whose
+/// patches touch disjoint entities and layers; a partition keeps its patches
+/// in transaction order. Structural patches (entity create and delete,
+/// component add and remove, layer create and delete) and patches with no
+/// target change storage shared by every entity, so consecutive runs of
+/// them form serial phases with a single partition.
+///
+/// A transaction made mostly of creates and component adds, such as a
+/// streamed-in level, therefore runs almost entirely serially unless the
+/// apply handler supports concurrent_structural.
+struct ApplyPlan {
+    struct Phase {
+        std::vector<std::vector<std::size_t>> partitions;
+        bool serial = false;
+    };
+
+    std::vector<Phase> phases;
+
+    /// Get total partition count
+    [[nodiscard]] std::size_t partition_count() const noexcept {
+        std::size_t count = 0;
+        for (const auto& phase : phases) {
+            count += phase.partitions.size();
+        }
+        return count;
+    }
+
+    /// Get size of the largest partition
+    [[nodiscard]] std::size_t largest_partition() const noexcept {
+        std::size_t largest = 0;
+        for (const auto& phase : phases) {
+            for (const auto& partition : phase.partitions) {
+                largest = std::max(largest, partition.size());
+            }
+        }
+        return largest;
+    }
+};
+
+/// TransactionApplier configuration
+struct TransactionApplierConfig {
+    /// Worker threads (0 = hardware concurrency)
+    std::size_t max_workers = 0;
+
+    /// Transactions with fewer patches are applied on the calling thread
+    std::size_t min_parallel_patches = 4096;
+
+    /// Set when the apply handler can create entities and add or remove
+    /// components for different entities concurrently (for example by
+    /// staging them per thread). Those patches are then partitioned by
+    /// entity; entity deletes and layer create and delete stay serial.
+    bool concurrent_structural = false;
+
+    /// Runs fn(i) for every i in [0, count) concurrently and returns once all
+    /// have finished; when empty, each parallel phase starts max_workers threads
+    std::function<void(std::size_t count, const std::function<void(std::size_t)>& fn)> parallel_for;
+};
+
+/// Applies independent partitions of a transaction in parallel
+///
+/// The apply handler may run concurrently, but never for two patches that
+/// share an entity or layer. If any patch fails, the remaining partitions
+/// stop, each applied patch is passed to the undo handler (latest first
+/// within its partition) and the transaction is rolled back.
+///
+/// void_ir does not know the scene graph, so hierarchy patches can only be
+/// partitioned when the caller says where each entity is parented before the
+/// transaction; without a parent lookup they run in serial phases.
+class TransactionApplier {
+public:
+    using ApplyHandler = std::function<bool(const Patch&)>;
+    using UndoHandler = std::function<void(const Patch&)>;
+    using ParentLookup = std::function<std::optional<EntityRef>(EntityRef)>;
+
+    TransactionApplier() = default;
+
+    explicit TransactionApplier(TransactionApplierConfig config)
+        : m_config(config) {}
+
+    /// Get configuration
+    [[nodiscard]] const TransactionApplierConfig& config() const noexcept {
+        return m_config;
+    }
+
+    /// Partition patches by the entities and layers they read or write
+    ///
+    /// A hierarchy patch also touches the entity's old parent, found through
+    /// parent_of or an earlier patch of the batch, and its new parent. See
+    /// TransactionApplierConfig::concurrent_structural.
+    [[nodiscard]] static ApplyPlan plan(const PatchBatch& patches,
+                                        const ParentLookup& parent_of = {},
+                                        bool concurrent_structural = false);
+
+    /// Apply a pending transaction, committing or rolling it back
+    TransactionResult apply(Transaction& tx, const ApplyHandler& apply,
+                            const UndoHandler& undo,
+                            const ParentLookup& parent_of = {}) const;
+
+private:
+    TransactionApplierConfig m_config;
+};
+
 } // namespace void_ir
@@ -343,6 +343,40 @@ struct ValidationResult {
     }
 };
 
+// =============================================================================
+// FieldAccessor
+// =============================================================================
+
+/// Schema field resolved ahead of time
+///
+/// Holds the interned field key and its slot in the schema layout, so
+/// reading, writing and validating the field takes no string work. Only
+/// valid while the schema it came from is not modified.
+struct FieldAccessor {
+    Symbol key;
+    std::size_t index = SIZE_MAX;
+    const FieldDescriptor* descriptor = nullptr;
+
+    /// Check if the field was found
+    [[nodiscard]] bool is_valid() const noexcept {
+        return descriptor != nullptr;
+    }
+
+    explicit operator bool() const noexcept {
+        return is_valid();
+    }
+
+    /// Get field value from a component object (nullptr if absent)
+    [[nodiscard]] const Value* get(const Value& component) const {
+        return component.get(key);
+    }
+
+    /// Set field value in a component object
+    void set(Value& component, Value value) const {
+        component.as_object_mut()[key] = std::move(value);
+    }
+};
+
 // =============================================================================
 // ComponentSchema
 // =============================================================================
@@ -352,15 +386,24 @@ class ComponentSchema {
 public:
     /// Construct with component type name
     explicit ComponentSchema(std::string type_name)
-        : m_type_name(std::move(type_name)) {}
+        : m_type_name(std::move(type_name))
+        , m_type(m_type_name) {}
 
     /// Get type name
     [[nodiscard]] const std::string& type_name() const noexcept {
         return m_type_name;
     }
 
+    /// Get interned type name
+    [[nodiscard]] Symbol type() const noexcept {
+        return m_type;
+    }
+
     /// Add field
     ComponentSchema& field(FieldDescriptor descriptor) {
+        Symbol key(descriptor.name);
+        m_field_index[key] = m_fields.size();
+        m_field_keys.push_back(key);
         m_fields.push_back(std::move(descriptor));
         return *this;
     }
@@ -370,14 +413,35 @@ public:
         return m_fields;
     }
 
+    /// Find field by name
+    [[nodiscard]] const FieldDescriptor* find_field(Symbol name) const {
+        auto it = m_field_index.find(name);
+        return it != m_field_index.end() ? &m_fields[it->second] : nullptr;
+    }
+
     /// Find field by name
     [[nodiscard]] const FieldDescriptor* find_field(std::string_view name) const {
-        for (const auto& f : m_fields) {
-            if (f.name == name) {
-                return &f;
-            }
+        auto symbol = Symbol::find(name);
+        return symbol ? find_field(*symbol) : nullptr;
+    }
+
+    /// Find field by name
+    [[nodiscard]] const FieldDescriptor* find_field(const char* name) const {
+        return find_field(std::string_view(name));
+    }
+
+    /// Find field by name
+    [[nodiscard]] const FieldDescriptor* find_field(const std::string& name) const {
+        return find_field(std::string_view(name));
+    }
+
+    /// Resolve a field for repeated access
+    [[nodiscard]] FieldAccessor accessor(Symbol name) const {
+        auto it = m_field_index.find(name);
+        if (it == m_field_index.end()) {
+            return FieldAccessor{name, SIZE_MAX, nullptr};
         }
-        return nullptr;
+        return FieldAccessor{name, it->second, &m_fields[it->second]};
     }
 
     /// Validate a value against this schema
@@ -390,8 +454,9 @@ public:
         const auto& obj = value.as_object();
 
         // Check required fields
-        for (const auto& field : m_fields) {
-            auto it = obj.find(field.name);
+        for (std::size_t i = 0; i < m_fields.size(); ++i) {
+            const auto& field = m_fields[i];
+            auto it = obj.find(m_field_keys[i]);
 
             if (it == obj.end()) {
                 if (field.required) {
@@ -489,7 +554,10 @@ public:
 
 private:
     std::string m_type_name;
+    Symbol m_type;
     std::vector<FieldDescriptor> m_fields;
+    std::vector<Symbol> m_field_keys;
+    std::unordered_map<Symbol, std::size_t> m_field_index;
 };
 
 // =============================================================================
@@ -501,21 +569,38 @@ class SchemaRegistry {
 public:
     /// Register a schema
     void register_schema(ComponentSchema schema) {
-        m_schemas.emplace(schema.type_name(), std::move(schema));
+        Symbol type = schema.type();
+        m_schemas.emplace(type, std::move(schema));
     }
 
-    /// Get schema by type name
-    [[nodiscard]] const ComponentSchema* get(std::string_view type_name) const {
-        auto it = m_schemas.find(std::string(type_name));
+    /// Get schema by type
+    [[nodiscard]] const ComponentSchema* get(Symbol type) const {
+        auto it = m_schemas.find(type);
         if (it == m_schemas.end()) {
             return nullptr;
         }
         return &it->second;
     }
 
+    /// Get schema by type name
+    [[nodiscard]] const ComponentSchema* get(std::string_view type_name) const {
+        auto type = Symbol::find(type_name);
+        return type ? get(*type) : nullptr;
+    }
+
+    /// Get schema by type name
+    [[nodiscard]] const ComponentSchema* get(const char* type_name) const {
+        return get(std::string_view(type_name));
+    }
+
+    /// Get schema by type name
+    [[nodiscard]] const ComponentSchema* get(const std::string& type_name) const {
+        return get(std::string_view(type_name));
+    }
+
     /// Check if schema exists
     [[nodiscard]] bool has(std::string_view type_name) const {
-        return m_schemas.find(std::string(type_name)) != m_schemas.end();
+        return get(type_name) != nullptr;
     }
 
     /// Validate a component patch
@@ -532,11 +617,11 @@ public:
         }
 
         if (patch.operation == ComponentOp::SetField) {
-            const FieldDescriptor* field = schema->find_field(patch.field_path);
+            FieldAccessor field = schema->accessor(patch.field_path);
             if (!field) {
-                return ValidationResult::field_error(patch.field_path, "Unknown field");
+                return ValidationResult::field_error(patch.field_path.str(), "Unknown field");
             }
-            return schema->validate_field(*field, patch.value, patch.field_path);
+            return schema->validate_field(*field.descriptor, patch.value, patch.field_path.str());
         }
 
         // Add or Set - validate entire value
@@ -547,8 +632,8 @@ public:
     [[nodiscard]] std::vector<std::string> type_names() const {
         std::vector<std::string> names;
         names.reserve(m_schemas.size());
-        for (const auto& [name, _] : m_schemas) {
-            names.push_back(name);
+        for (const auto& [type, _] : m_schemas) {
+            names.push_back(type.str());
         }
         return names;
     }
@@ -564,7 +649,7 @@ public:
     }
 
 private:
-    std::unordered_map<std::string, ComponentSchema> m_schemas;
+    std::unordered_map<Symbol, ComponentSchema> m_schemas;
 };
 
 // =============================================================================
@@ -600,7 +685,7 @@ public:
                 if (!permissions.can_modify_components) {
                     result.add_error("", "Permission denied: cannot modify components");
                 }
-                if (!permissions.is_component_allowed(p.component_type)) {
+                if (!permissions.is_component_allowed(p.component_type.view())) {
                     result.add_error("", "Permission denied: component type not allowed");
                 }
 
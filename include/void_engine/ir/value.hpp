@@ -4,6 +4,7 @@
 /// @brief Dynamic value type for void_ir patches
 
 #include "fwd.hpp"
+#include "symbol.hpp"
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -133,8 +134,8 @@ class Value;
 /// Array of values
 using ValueArray = std::vector<Value>;
 
-/// Object (key-value map)
-using ValueObject = std::unordered_map<std::string, Value>;
+/// Object (key-value map keyed by interned names)
+using ValueObject = std::unordered_map<Symbol, Value>;
 
 /// Binary data
 using ValueBytes = std::vector<std::uint8_t>;
@@ -500,17 +501,17 @@ public:
     }
 
     /// Object key access (throws if not object)
-    [[nodiscard]] const Value& operator[](const std::string& key) const {
+    [[nodiscard]] const Value& operator[](Symbol key) const {
         return std::get<ValueObject>(m_data).at(key);
     }
 
     /// Object key access mutable (inserts if not found)
-    [[nodiscard]] Value& operator[](const std::string& key) {
+    [[nodiscard]] Value& operator[](Symbol key) {
         return std::get<ValueObject>(m_data)[key];
     }
 
     /// Check if object contains key
-    [[nodiscard]] bool contains(const std::string& key) const {
+    [[nodiscard]] bool contains(Symbol key) const {
         if (auto* obj = std::get_if<ValueObject>(&m_data)) {
             return obj->find(key) != obj->end();
         }
@@ -518,7 +519,7 @@ public:
     }
 
     /// Get value from object (returns null if not found)
-    [[nodiscard]] const Value* get(const std::string& key) const {
+    [[nodiscard]] const Value* get(Symbol key) const {
         if (auto* obj = std::get_if<ValueObject>(&m_data)) {
             auto it = obj->find(key);
             if (it != obj->end()) {
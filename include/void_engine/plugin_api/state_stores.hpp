@@ -138,6 +138,12 @@ struct BlackboardData {
     std::unordered_map<std::string, EntityId> entity_values;
     std::unordered_map<std::string, std::any> custom_values;
 
+    /// Slots of a schema-compiled blackboard, copied as one block. The
+    /// schema hash is checked by CompiledBlackboard::read_snapshot().
+    std::uint64_t schema_hash{0};
+    std::vector<std::uint8_t> slot_data;
+    std::vector<std::string> slot_strings;
+
     double last_modified{0};
 };
 
@@ -47,6 +47,7 @@ namespace void_kernel { class Kernel; }
 namespace void_event { class EventBus; }
 namespace void_ecs { class World; }
 namespace void_scene { class World; }
+namespace void_asset { class ResidencyManager; }
 namespace void_package {
     class PackageRegistry;
     class LoadContext;
@@ -265,6 +266,13 @@ public:
     /// @brief Get the platform interface
     [[nodiscard]] IPlatform* platform() const;
 
+    /// @brief Get the asset residency manager
+    /// Systems submit per-frame residency requests here; the manager runs
+    /// in the Streaming stage
+    [[nodiscard]] void_asset::ResidencyManager* residency_manager() const {
+        return m_residency.get();
+    }
+
     // -------------------------------------------------------------------------
     // Configuration
     // -------------------------------------------------------------------------
@@ -299,6 +307,7 @@ private:
     void_core::Result<void> init_render();
     void_core::Result<void> init_io();
     void_core::Result<void> init_simulation();
+    void_core::Result<void> init_streaming();
 
     // Frame execution
     void execute_frame(float dt);
@@ -307,6 +316,7 @@ private:
     void handle_platform_event(const PlatformEvent& evt);
 
     // Shutdown phases
+    void shutdown_streaming();
     void shutdown_simulation();
     void shutdown_io();
     void shutdown_render();
@@ -331,6 +341,7 @@ private:
     // Core subsystems (owned)
     std::unique_ptr<void_kernel::Kernel> m_kernel;
     std::unique_ptr<void_event::EventBus> m_event_bus;
+    std::unique_ptr<void_asset::ResidencyManager> m_residency;
 
     // Package system (owns world lifecycle)
     struct PackageContext;
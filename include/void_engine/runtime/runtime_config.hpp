@@ -136,6 +136,12 @@ struct RuntimeConfig {
     /// Render scale (1.0 = native resolution)
     float render_scale{1.0f};
 
+    /// Resident texture memory budget for streaming (MB)
+    std::uint32_t texture_streaming_budget_mb{512};
+
+    /// Resident mesh memory budget for streaming (MB)
+    std::uint32_t mesh_streaming_budget_mb{256};
+
     // -------------------------------------------------------------------------
     // Hot-Reload
     // -------------------------------------------------------------------------
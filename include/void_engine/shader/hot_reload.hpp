@@ -102,7 +102,8 @@ public:
 
     /// Configuration
     struct Config {
-        std::chrono::milliseconds debounce_interval{100};
+        std::chrono::milliseconds poll_interval{100};      ///< Stat interval of the polling fallback
+        std::chrono::milliseconds debounce_interval{100};  ///< Quiet time before a change is reported
         std::vector<std::string> watch_extensions{".wgsl", ".glsl", ".vert", ".frag", ".comp"};
         bool recursive = true;
 
@@ -110,8 +111,8 @@ public:
     };
 
     /// Constructor
-    ShaderWatcher() : m_config(Config{}), m_watcher(std::make_unique<void_core::PollingFileWatcher>(m_config.debounce_interval)) {}
-    explicit ShaderWatcher(const Config& config) : m_config(config), m_watcher(std::make_unique<void_core::PollingFileWatcher>(config.debounce_interval)) {}
+    ShaderWatcher() : m_config(Config{}), m_watcher(void_core::create_file_watcher(m_config.poll_interval)) {}
+    explicit ShaderWatcher(const Config& config) : m_config(config), m_watcher(void_core::create_file_watcher(config.poll_interval)) {}
 
     /// Start watching a directory
     void_core::Result<void> watch_directory(const std::string& path) {
@@ -166,9 +167,25 @@ public:
         return m_watcher->unwatch(path);
     }
 
-    /// Poll for changes
+    /// Poll for changes that have been quiet for the debounce interval
     std::vector<void_core::ReloadEvent> poll() {
-        return m_watcher->poll();
+        auto now = std::chrono::steady_clock::now();
+        for (auto& event : m_watcher->poll()) {
+            auto& pending = m_pending[event.path];
+            pending.event = std::move(event);
+            pending.last_change = now;
+        }
+
+        std::vector<void_core::ReloadEvent> events;
+        for (auto it = m_pending.begin(); it != m_pending.end();) {
+            if (now - it->second.last_change >= m_config.debounce_interval) {
+                events.push_back(std::move(it->second.event));
+                it = m_pending.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return events;
     }
 
     /// Set callback for events
@@ -180,6 +197,7 @@ public:
     void clear() {
         m_watcher->clear();
         m_watched_directories.clear();
+        m_pending.clear();
     }
 
     /// Check if path is shader file
@@ -195,9 +213,15 @@ public:
     }
 
 private:
+    struct PendingChange {
+        void_core::ReloadEvent event;
+        std::chrono::steady_clock::time_point last_change;
+    };
+
     Config m_config;
     std::unique_ptr<void_core::FileWatcher> m_watcher;
     std::set<std::string> m_watched_directories;
+    std::map<std::string, PendingChange> m_pending;
     Callback m_callback;
 };
 
@@ -12,6 +12,7 @@
 
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -208,6 +209,11 @@ private:
 ///
 /// Legacy callbacks are still supported for internal wiring and
 /// non-plugin code, but event bus emission is always performed.
+///
+/// Trigger volumes are bucketed by bounds in a uniform XZ grid, so an
+/// entity update only tests the triggers of the cell it is in. Bounds are
+/// re-read once per frame; call refresh_spatial_index() after moving a
+/// volume if entities are updated again in the same frame.
 class TriggerSystem {
 public:
     TriggerSystem();
@@ -258,6 +264,19 @@ public:
     /// @brief Notify system of entity position update
     void update_entity(EntityId entity, const Vec3& position);
 
+    /// @brief Entity position for batched updates
+    struct EntityUpdate {
+        EntityId entity;
+        Vec3 position;
+    };
+
+    /// @brief Notify system of many entity position updates
+    ///
+    /// Volume tests run on worker threads; enter/exit processing, filters and
+    /// callbacks run on the calling thread in input order (exits before
+    /// enters, by trigger id), independent of the worker count.
+    void update_entities(std::span<const EntityUpdate> updates);
+
     /// @brief Remove entity from tracking
     void remove_entity(EntityId entity);
 
@@ -267,6 +286,9 @@ public:
     /// @brief Get triggers containing entity
     std::vector<TriggerId> triggers_containing(EntityId entity) const;
 
+    /// @brief Re-read all trigger volume bounds into the spatial grid
+    void refresh_spatial_index();
+
     // Manual triggering
     /// @brief Manually fire a trigger
     bool fire_trigger(TriggerId trigger, const TriggerEvent& event);
@@ -327,6 +349,20 @@ public:
     void clear();
 
 private:
+    /// Membership changes of one entity, sorted by trigger id
+    struct EntityTransitions {
+        std::vector<TriggerId> exits;
+        std::vector<TriggerId> enters;
+    };
+
+    void sync_spatial_index();
+    void insert_spatial(TriggerId id, const ITriggerVolume* volume, const AABB& bounds);
+    void remove_spatial(TriggerId id);
+    std::uint64_t find_transitions(const Vec3& position, const std::vector<TriggerId>& inside,
+                                   std::vector<TriggerId>& candidates,
+                                   EntityTransitions& out) const;
+    void apply_transitions(EntityId entity, const EntityTransitions& transitions);
+
     void process_entity_enter(EntityId entity, Trigger& trigger);
     void process_entity_exit(EntityId entity, Trigger& trigger);
     void process_entity_stay(EntityId entity, Trigger& trigger, float dt);
@@ -354,7 +390,7 @@ private:
 
     // Entity tracking
     std::unordered_map<EntityId, Vec3> m_entity_positions;
-    std::unordered_map<EntityId, std::unordered_set<TriggerId>> m_entity_triggers;
+    std::unordered_map<EntityId, std::vector<TriggerId>> m_entity_triggers;  ///< Sorted by id
 
     // Per-entity per-trigger stay time tracking (for TriggerStayEvent.time_inside)
     struct EntityTriggerKey {
@@ -374,8 +410,25 @@ private:
     // Spatial acceleration
     struct SpatialCell {
         std::vector<TriggerId> triggers;
+        std::vector<AABB> bounds;
+    };
+    struct SpatialEntry {
+        const ITriggerVolume* volume{nullptr};
+        AABB bounds;
+        bool oversized{false};          ///< Too large for the grid, tested for every entity
     };
     std::unordered_map<std::int64_t, SpatialCell> m_spatial_grid;
+    std::unordered_map<TriggerId, SpatialEntry> m_spatial_entries;
+    SpatialCell m_oversized_triggers;
+    float m_spatial_cell_size{0};
+    double m_spatial_sync_time{-1};
+    bool m_spatial_dirty{true};
+
+    // Scratch buffers for entity updates
+    std::vector<TriggerId> m_scratch_candidates;
+    EntityTransitions m_scratch_transitions;
+    std::vector<EntityTransitions> m_batch_transitions;
+    std::vector<const std::vector<TriggerId>*> m_batch_inside;
 
     EntityPositionCallback m_position_getter;
     EntityTagsCallback m_tags_getter;
@@ -306,6 +306,7 @@ struct TriggerSystemConfig {
     float update_frequency{60.0f};      ///< Updates per second
     bool spatial_hashing{true};
     float spatial_cell_size{10.0f};
+    std::uint32_t max_workers{0};       ///< Entity update threads (0 = hardware concurrency)
     bool debug_rendering{false};
 };
 
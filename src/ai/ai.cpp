@@ -3,6 +3,7 @@
 
 #include <void_engine/ai/ai.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace void_ai {
@@ -56,6 +57,18 @@ BehaviorTree* AISystem::get_tree(BehaviorTreeId id) {
     return it != m_trees.end() ? it->second.get() : nullptr;
 }
 
+BehaviorTreeBatch* AISystem::create_tree_batch(std::shared_ptr<const BehaviorTreeAsset> asset) {
+    m_tree_batches.push_back(std::make_unique<BehaviorTreeBatch>(std::move(asset)));
+    return m_tree_batches.back().get();
+}
+
+void AISystem::destroy_tree_batch(BehaviorTreeBatch* batch) {
+    m_tree_batches.erase(
+        std::remove_if(m_tree_batches.begin(), m_tree_batches.end(),
+            [batch](const auto& b) { return b.get() == batch; }),
+        m_tree_batches.end());
+}
+
 BlackboardId AISystem::create_blackboard() {
     BlackboardId id{m_next_blackboard_id++};
     m_blackboards[id] = std::make_unique<Blackboard>();
@@ -76,6 +89,9 @@ void AISystem::update(float dt) {
     for (auto& [id, tree] : m_trees) {
         tree->tick(dt);
     }
+    for (auto& batch : m_tree_batches) {
+        batch->tick_all(dt);
+    }
 
     // Update navigation
     m_navigation->update(dt);
@@ -199,16 +215,32 @@ void AIController::set_forward(const void_math::Vec3& forward) {
     }
 }
 
+void AIController::set_tick_lod(const void_core::TickLodScheduler* scheduler, void_core::EntityId entity) {
+    m_tick_lod = scheduler;
+    m_tick_entity = entity;
+}
+
 void AIController::update(float dt) {
     // Sync positions from external source
     sync_positions();
 
-    // Update blackboard with common values
-    update_blackboard();
+    // Skip frames the scheduler assigns to other entities; the next tick gets the elapsed time
+    float tick_dt = dt;
+    bool tick = true;
+    if (m_tick_lod) {
+        auto decision = m_tick_lod->decision(m_tick_entity);
+        tick = decision.tick;
+        tick_dt = decision.dt;
+    }
 
-    // Tick behavior tree
-    if (m_tree) {
-        m_tree->tick(dt);
+    if (tick) {
+        // Update blackboard with common values
+        update_blackboard();
+
+        // Tick behavior tree
+        if (m_tree) {
+            m_tree->tick(tick_dt);
+        }
     }
 
     // Steering agent updates itself via system
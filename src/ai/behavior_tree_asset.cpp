@@ -0,0 +1,761 @@
+/// @file behavior_tree_asset.cpp
+/// @brief Flattened behavior tree implementation for void_ai module
+
+#include <void_engine/ai/behavior_tree_asset.hpp>
+
+#include <algorithm>
+#include <random>
+
+namespace void_ai {
+
+namespace {
+
+constexpr std::uint32_t k_none = FlatBehaviorNode::k_none;
+constexpr std::uint32_t k_invalid_slot = 0xFFFFFFFFu;
+
+} // anonymous namespace
+
+// =============================================================================
+// BehaviorTreeAsset Implementation
+// =============================================================================
+
+std::string_view BehaviorTreeAsset::node_name(std::size_t index) const {
+    std::uint32_t name = m_nodes[index].name;
+    return name != k_none ? std::string_view(m_names[name]) : std::string_view();
+}
+
+// =============================================================================
+// BehaviorTreeAssetBuilder Implementation
+// =============================================================================
+
+BehaviorTreeAssetBuilder::BehaviorTreeAssetBuilder()
+    : m_asset(std::make_unique<BehaviorTreeAsset>()) {
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::sequence() {
+    open_node(add_node(NodeType::Sequence), true);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::selector() {
+    open_node(add_node(NodeType::Selector), true);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::parallel(ParallelPolicy success,
+                                                             ParallelPolicy failure,
+                                                             float threshold) {
+    std::uint32_t index = add_node(NodeType::Parallel);
+    auto& node = m_asset->m_nodes[index];
+    node.success_policy = success;
+    node.failure_policy = failure;
+    node.param0 = threshold;
+    open_node(index, true);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::random_selector() {
+    open_node(add_node(NodeType::RandomSelector), true);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::random_sequence() {
+    open_node(add_node(NodeType::RandomSequence), true);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::inverter() {
+    open_node(add_node(NodeType::Inverter), false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::repeater(std::uint32_t count) {
+    std::uint32_t index = add_node(NodeType::Repeater);
+    m_asset->m_nodes[index].count = count;
+    open_node(index, false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::repeat_until_fail() {
+    open_node(add_node(NodeType::RepeatUntilFail), false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::succeeder() {
+    open_node(add_node(NodeType::Succeeder), false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::failer() {
+    open_node(add_node(NodeType::Failer), false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::cooldown(float time) {
+    std::uint32_t index = add_node(NodeType::Cooldown);
+    m_asset->m_nodes[index].param0 = time;
+    open_node(index, false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::timeout(float time) {
+    std::uint32_t index = add_node(NodeType::Timeout);
+    m_asset->m_nodes[index].param0 = time;
+    open_node(index, false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::conditional(BehaviorConditionFn cond,
+                                                                AbortType abort) {
+    std::uint32_t index = add_node(NodeType::Conditional);
+    auto& node = m_asset->m_nodes[index];
+    node.abort = abort;
+    if (cond) {
+        node.callback = static_cast<std::uint32_t>(m_asset->m_conditions.size());
+        m_asset->m_conditions.push_back(std::move(cond));
+    }
+    open_node(index, false);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::action(BehaviorActionFn callback) {
+    std::uint32_t index = add_node(NodeType::Action);
+    if (callback) {
+        m_asset->m_nodes[index].callback = static_cast<std::uint32_t>(m_asset->m_actions.size());
+        m_asset->m_actions.push_back(std::move(callback));
+    }
+    close_node(index);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::action(std::string_view name,
+                                                           BehaviorActionFn callback) {
+    m_pending_name = std::string(name);
+    return action(std::move(callback));
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::condition(BehaviorConditionFn callback) {
+    std::uint32_t index = add_node(NodeType::Condition);
+    if (callback) {
+        m_asset->m_nodes[index].callback = static_cast<std::uint32_t>(m_asset->m_conditions.size());
+        m_asset->m_conditions.push_back(std::move(callback));
+    }
+    close_node(index);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::condition(std::string_view name,
+                                                              BehaviorConditionFn callback) {
+    m_pending_name = std::string(name);
+    return condition(std::move(callback));
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::wait(float duration) {
+    return wait(duration, duration);
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::wait(float min_duration, float max_duration) {
+    std::uint32_t index = add_node(NodeType::Wait);
+    auto& node = m_asset->m_nodes[index];
+    node.param0 = min_duration;
+    node.param1 = max_duration;
+    close_node(index);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::subtree(const BehaviorTreeAsset& tree) {
+    if (tree.m_nodes.empty()) return *this;
+
+    auto& asset = *m_asset;
+    const auto base = static_cast<std::uint32_t>(asset.m_nodes.size());
+    const auto action_base = static_cast<std::uint32_t>(asset.m_actions.size());
+    const auto condition_base = static_cast<std::uint32_t>(asset.m_conditions.size());
+    const auto name_base = static_cast<std::uint32_t>(asset.m_names.size());
+
+    if (!m_stack.empty()) {
+        ++asset.m_nodes[m_stack.back().index].child_count;
+    }
+
+    // Inline the nodes, rebasing their indices into this asset's tables
+    for (FlatBehaviorNode node : tree.m_nodes) {
+        node.end += base;
+        if (node.callback != k_none) {
+            node.callback += node.type == NodeType::Action ? action_base : condition_base;
+        }
+        if (node.name != k_none) {
+            node.name += name_base;
+        }
+        asset.m_nodes.push_back(node);
+    }
+    asset.m_actions.insert(asset.m_actions.end(), tree.m_actions.begin(), tree.m_actions.end());
+    asset.m_conditions.insert(asset.m_conditions.end(), tree.m_conditions.begin(), tree.m_conditions.end());
+    asset.m_names.insert(asset.m_names.end(), tree.m_names.begin(), tree.m_names.end());
+
+    if (!m_pending_name.empty()) {
+        asset.m_nodes[base].name = static_cast<std::uint32_t>(asset.m_names.size());
+        asset.m_names.push_back(std::move(m_pending_name));
+        m_pending_name.clear();
+    }
+
+    close_node(base);
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::end() {
+    if (!m_stack.empty()) {
+        std::uint32_t index = m_stack.back().index;
+        m_stack.pop_back();
+        close_node(index);
+    }
+    return *this;
+}
+
+BehaviorTreeAssetBuilder& BehaviorTreeAssetBuilder::name(std::string_view name) {
+    m_pending_name = std::string(name);
+    return *this;
+}
+
+std::shared_ptr<const BehaviorTreeAsset> BehaviorTreeAssetBuilder::build() {
+    // Close all open scopes
+    while (!m_stack.empty()) {
+        end();
+    }
+
+    // Reserve per-agent child slots for parallel and random composites
+    std::size_t extra = 0;
+    for (auto& node : m_asset->m_nodes) {
+        if (node.type == NodeType::Parallel || node.type == NodeType::RandomSelector ||
+            node.type == NodeType::RandomSequence) {
+            node.extra = static_cast<std::uint32_t>(extra);
+            extra += node.child_count;
+        }
+    }
+    m_asset->m_extra_count = extra;
+
+    std::shared_ptr<const BehaviorTreeAsset> asset(std::move(m_asset));
+    m_asset = std::make_unique<BehaviorTreeAsset>();
+    return asset;
+}
+
+std::uint32_t BehaviorTreeAssetBuilder::add_node(NodeType type) {
+    auto& asset = *m_asset;
+    const auto index = static_cast<std::uint32_t>(asset.m_nodes.size());
+
+    FlatBehaviorNode node;
+    node.type = type;
+    node.end = index + 1;
+
+    if (!m_pending_name.empty()) {
+        node.name = static_cast<std::uint32_t>(asset.m_names.size());
+        asset.m_names.push_back(std::move(m_pending_name));
+        m_pending_name.clear();
+    }
+
+    if (!m_stack.empty()) {
+        ++asset.m_nodes[m_stack.back().index].child_count;
+    }
+
+    asset.m_nodes.push_back(node);
+    return index;
+}
+
+void BehaviorTreeAssetBuilder::open_node(std::uint32_t index, bool is_composite) {
+    m_stack.push_back({index, is_composite});
+}
+
+void BehaviorTreeAssetBuilder::close_node(std::uint32_t index) {
+    m_asset->m_nodes[index].end = static_cast<std::uint32_t>(m_asset->m_nodes.size());
+
+    // A decorator is complete once its child is
+    if (!m_stack.empty() && !m_stack.back().is_composite) {
+        std::uint32_t parent = m_stack.back().index;
+        m_stack.pop_back();
+        close_node(parent);
+    }
+}
+
+// =============================================================================
+// BehaviorTreeBatch Implementation
+// =============================================================================
+
+BehaviorTreeBatch::BehaviorTreeBatch(std::shared_ptr<const BehaviorTreeAsset> asset,
+                                     std::uint32_t seed)
+    : m_asset(std::move(asset))
+    , m_seed(seed ? seed : std::random_device{}()) {
+}
+
+BehaviorTreeBatch::~BehaviorTreeBatch() = default;
+
+BehaviorAgentId BehaviorTreeBatch::add_agent(IBlackboard* blackboard, void* user_data) {
+    std::uint32_t slot;
+    if (!m_free_slots.empty()) {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(m_agents.size());
+        if (slot > k_slot_mask) {
+            return BehaviorAgentId{};
+        }
+        if (slot == m_slot_generation.size()) {
+            m_slot_generation.push_back(1);
+        }
+        m_agents.emplace_back();
+        m_states.resize(m_states.size() + m_asset->node_count());
+        m_extras.resize(m_extras.size() + m_asset->extra_count());
+    }
+
+    auto& agent = m_agents[slot];
+    agent.context = BehaviorContext{id_of(slot), blackboard, user_data};
+    agent.dirty = false;
+    agent.active = true;
+
+    // Distinct, non-zero xorshift state per slot
+    std::uint32_t rng = m_seed ^ (slot * 0x9E3779B9u);
+    agent.rng = rng ? rng : 0x6D2B79F5u;
+
+    reset_range(slot, 0, static_cast<std::uint32_t>(m_asset->node_count()));
+    ++m_active_count;
+    return agent.context.agent;
+}
+
+void BehaviorTreeBatch::remove_agent(BehaviorAgentId id) {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return;
+
+    // The new generation invalidates outstanding ids for this slot
+    std::uint32_t generation = (m_slot_generation[slot] + 1) & (0xFFFFFFFFu >> k_slot_bits);
+    m_slot_generation[slot] = generation ? generation : 1;
+
+    m_agents[slot].active = false;
+    m_free_slots.push_back(slot);
+    --m_active_count;
+}
+
+void BehaviorTreeBatch::clear() {
+    m_agents.clear();
+    m_states.clear();
+    m_extras.clear();
+    m_free_slots.clear();
+    m_active_count = 0;
+
+    // Generations survive so ids issued before the clear stay invalid
+    for (auto& generation : m_slot_generation) {
+        std::uint32_t next = (generation + 1) & (0xFFFFFFFFu >> k_slot_bits);
+        generation = next ? next : 1;
+    }
+}
+
+bool BehaviorTreeBatch::is_valid(BehaviorAgentId id) const {
+    return slot_of(id) != k_invalid_slot;
+}
+
+const BehaviorContext* BehaviorTreeBatch::context(BehaviorAgentId id) const {
+    std::uint32_t slot = slot_of(id);
+    return slot != k_invalid_slot ? &m_agents[slot].context : nullptr;
+}
+
+void BehaviorTreeBatch::reset(BehaviorAgentId id) {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return;
+
+    reset_range(slot, 0, static_cast<std::uint32_t>(m_asset->node_count()));
+}
+
+void BehaviorTreeBatch::notify(BehaviorAgentId id) {
+    std::uint32_t slot = slot_of(id);
+    if (slot != k_invalid_slot) {
+        m_agents[slot].dirty = true;
+    }
+}
+
+void BehaviorTreeBatch::notify_all() {
+    for (auto& agent : m_agents) {
+        agent.dirty = agent.active;
+    }
+}
+
+NodeStatus BehaviorTreeBatch::tick(BehaviorAgentId id, float dt) {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot || m_asset->node_count() == 0) {
+        return NodeStatus::Invalid;
+    }
+
+    NodeStatus status = tick_node(slot, 0, dt);
+    m_agents[slot].dirty = false;
+    return status;
+}
+
+void BehaviorTreeBatch::tick_all(float dt) {
+    if (m_asset->node_count() == 0) return;
+
+    const auto slots = static_cast<std::uint32_t>(m_agents.size());
+    for (std::uint32_t slot = 0; slot < slots; ++slot) {
+        if (!m_agents[slot].active) continue;
+        tick_node(slot, 0, dt);
+        m_agents[slot].dirty = false;
+    }
+}
+
+NodeStatus BehaviorTreeBatch::status(BehaviorAgentId id) const {
+    return node_status(id, 0);
+}
+
+NodeStatus BehaviorTreeBatch::node_status(BehaviorAgentId id, std::size_t node) const {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot || node >= m_asset->node_count()) {
+        return NodeStatus::Invalid;
+    }
+    return m_states[static_cast<std::size_t>(slot) * m_asset->node_count() + node].status;
+}
+
+BehaviorAgentId BehaviorTreeBatch::id_of(std::uint32_t slot) const {
+    return BehaviorAgentId{(m_slot_generation[slot] << k_slot_bits) | slot};
+}
+
+std::uint32_t BehaviorTreeBatch::slot_of(BehaviorAgentId id) const {
+    std::uint32_t slot = id.value & k_slot_mask;
+    if (!id || slot >= m_agents.size() || !m_agents[slot].active ||
+        m_slot_generation[slot] != (id.value >> k_slot_bits)) {
+        return k_invalid_slot;
+    }
+    return slot;
+}
+
+NodeStatus BehaviorTreeBatch::tick_node(std::uint32_t slot, std::uint32_t index, float dt) {
+    const FlatBehaviorNode& node = m_asset->node(index);
+    NodeState& state = states(slot)[index];
+    const BehaviorContext& context = m_agents[slot].context;
+    const std::uint32_t child = index + 1;
+    const bool has_child = node.child_count > 0;
+
+    NodeStatus result = NodeStatus::Failure;
+
+    switch (node.type) {
+        case NodeType::Sequence:
+        case NodeType::Selector:
+        case NodeType::RandomSelector:
+        case NodeType::RandomSequence:
+            result = tick_composite(slot, index, state, dt);
+            break;
+
+        case NodeType::Parallel:
+            result = tick_parallel(slot, index, state, dt);
+            break;
+
+        case NodeType::Inverter:
+            if (has_child) {
+                result = tick_node(slot, child, dt);
+                if (result == NodeStatus::Success) {
+                    result = NodeStatus::Failure;
+                } else if (result == NodeStatus::Failure) {
+                    result = NodeStatus::Success;
+                }
+            }
+            break;
+
+        case NodeType::Repeater: {
+            if (!has_child) break;
+            NodeStatus child_status = tick_node(slot, child, dt);
+            if (child_status == NodeStatus::Running) {
+                result = NodeStatus::Running;
+                break;
+            }
+
+            // Child finished, count it and start over
+            ++state.count;
+            reset_range(slot, child, node.end);
+            if (node.count > 0 && state.count >= node.count) {
+                state.count = 0;
+                result = NodeStatus::Success;
+            } else {
+                result = NodeStatus::Running;
+            }
+            break;
+        }
+
+        case NodeType::RepeatUntilFail: {
+            if (!has_child) break;
+            NodeStatus child_status = tick_node(slot, child, dt);
+            if (child_status == NodeStatus::Failure) {
+                result = NodeStatus::Success;
+            } else {
+                if (child_status == NodeStatus::Success) {
+                    reset_range(slot, child, node.end);
+                }
+                result = NodeStatus::Running;
+            }
+            break;
+        }
+
+        case NodeType::Succeeder:
+        case NodeType::Failer: {
+            NodeStatus child_status = has_child ? tick_node(slot, child, dt) : NodeStatus::Success;
+            if (child_status == NodeStatus::Running) {
+                result = NodeStatus::Running;
+            } else {
+                result = node.type == NodeType::Succeeder ? NodeStatus::Success : NodeStatus::Failure;
+            }
+            break;
+        }
+
+        case NodeType::Cooldown:
+            if (state.flag) {
+                state.time -= dt;
+                if (state.time > 0) break;
+                state.flag = 0;
+            }
+            if (!has_child) break;
+
+            result = tick_node(slot, child, dt);
+            if (result != NodeStatus::Running) {
+                // Start cooldown after child finishes
+                state.flag = 1;
+                state.time = node.param0;
+            }
+            break;
+
+        case NodeType::Timeout:
+            if (!has_child) break;
+
+            state.time += dt;
+            if (state.time >= node.param0) {
+                reset_range(slot, child, node.end);
+                state.time = 0;
+                break;
+            }
+
+            result = tick_node(slot, child, dt);
+            if (result != NodeStatus::Running) {
+                state.time = 0;
+            }
+            break;
+
+        case NodeType::Conditional: {
+            if (node.callback == k_none) {
+                // No condition, just run child
+                if (has_child) {
+                    result = tick_node(slot, child, dt);
+                }
+                break;
+            }
+
+            // A running child is only re-checked by conditionals aborting themselves
+            const bool child_running = has_child && states(slot)[child].status == NodeStatus::Running;
+            const bool self_abort = node.abort == AbortType::Self || node.abort == AbortType::Both;
+            if (child_running && !self_abort) {
+                result = tick_node(slot, child, dt);
+                break;
+            }
+
+            bool is_true = m_asset->condition(node.callback)(context);
+
+            if (node.abort != AbortType::None && state.flag && !is_true) {
+                if (child_running) {
+                    reset_range(slot, child, node.end);
+                }
+                state.flag = 0;
+                break;
+            }
+
+            state.flag = is_true ? 1 : 0;
+            if (is_true) {
+                result = has_child ? tick_node(slot, child, dt) : NodeStatus::Success;
+            }
+            break;
+        }
+
+        case NodeType::Action:
+            if (node.callback != k_none) {
+                result = m_asset->action(node.callback)(context, dt);
+            }
+            break;
+
+        case NodeType::Condition:
+            if (node.callback != k_none) {
+                result = m_asset->condition(node.callback)(context) ? NodeStatus::Success
+                                                                    : NodeStatus::Failure;
+            }
+            break;
+
+        case NodeType::Wait:
+            if (state.status != NodeStatus::Running) {
+                state.time = 0;
+                state.target = node.param0;
+                if (node.param1 > node.param0) {
+                    float unit = static_cast<float>(next_random(slot) >> 8) * (1.0f / 16777216.0f);
+                    state.target += (node.param1 - node.param0) * unit;
+                }
+            }
+            state.time += dt;
+            result = state.time >= state.target ? NodeStatus::Success : NodeStatus::Running;
+            break;
+
+        default:
+            break;
+    }
+
+    state.status = result;
+    return result;
+}
+
+NodeStatus BehaviorTreeBatch::tick_composite(std::uint32_t slot,
+                                             std::uint32_t index,
+                                             NodeState& state,
+                                             float dt) {
+    const FlatBehaviorNode& node = m_asset->node(index);
+    const bool is_selector = node.type == NodeType::Selector ||
+                             node.type == NodeType::RandomSelector;
+    const bool is_random = node.type == NodeType::RandomSelector ||
+                           node.type == NodeType::RandomSequence;
+
+    // Status that ends the composite early
+    const NodeStatus stop = is_selector ? NodeStatus::Success : NodeStatus::Failure;
+
+    std::uint16_t* order = nullptr;
+    if (is_random) {
+        order = extras(slot) + node.extra;
+        if (!state.flag) {
+            for (std::uint32_t i = 0; i < node.child_count; ++i) {
+                order[i] = static_cast<std::uint16_t>(i);
+            }
+            for (std::uint32_t i = node.child_count; i > 1; --i) {
+                std::swap(order[i - 1], order[next_random(slot) % i]);
+            }
+            state.flag = 1;
+        }
+    } else if (is_selector && state.index > 0 && m_agents[slot].dirty) {
+        check_lower_priority_aborts(slot, index, state);
+    }
+
+    std::uint32_t child = state.index < node.child_count && !is_random
+        ? child_at(index, state.index) : 0;
+
+    while (state.index < node.child_count) {
+        if (is_random) {
+            child = child_at(index, order[state.index]);
+        }
+
+        NodeStatus status = tick_node(slot, child, dt);
+        if (status == NodeStatus::Running) {
+            return NodeStatus::Running;
+        }
+        if (status == stop) {
+            break;
+        }
+
+        ++state.index;
+        child = m_asset->node(child).end;
+    }
+
+    NodeStatus result = state.index < node.child_count ? stop
+        : (is_selector ? NodeStatus::Failure : NodeStatus::Success);
+
+    // Random composites reshuffle their whole subtree next time
+    if (is_random) {
+        reset_range(slot, index, node.end);
+    } else {
+        state.index = 0;
+    }
+    return result;
+}
+
+NodeStatus BehaviorTreeBatch::tick_parallel(std::uint32_t slot,
+                                            std::uint32_t index,
+                                            NodeState& state,
+                                            float dt) {
+    const FlatBehaviorNode& node = m_asset->node(index);
+    std::uint16_t* child_status = extras(slot) + node.extra;
+
+    if (!state.flag) {
+        std::fill(child_status, child_status + node.child_count,
+                  static_cast<std::uint16_t>(NodeStatus::Invalid));
+        state.flag = 1;
+    }
+
+    std::size_t success_count = 0;
+    std::size_t failure_count = 0;
+
+    std::uint32_t child = index + 1;
+    for (std::uint32_t i = 0; i < node.child_count; ++i, child = m_asset->node(child).end) {
+        auto status = static_cast<NodeStatus>(child_status[i]);
+
+        // Only tick children that aren't finished
+        if (status == NodeStatus::Invalid || status == NodeStatus::Running) {
+            status = tick_node(slot, child, dt);
+            child_status[i] = static_cast<std::uint16_t>(status);
+        }
+
+        if (status == NodeStatus::Success) {
+            ++success_count;
+        } else if (status == NodeStatus::Failure) {
+            ++failure_count;
+        }
+    }
+
+    auto satisfied = [&](ParallelPolicy policy, std::size_t count) {
+        switch (policy) {
+            case ParallelPolicy::RequireOne:
+                return count > 0;
+            case ParallelPolicy::RequireAll:
+                return count == node.child_count;
+            case ParallelPolicy::RequirePercent:
+                return node.child_count > 0 &&
+                       static_cast<float>(count) / static_cast<float>(node.child_count) >= node.param0;
+        }
+        return false;
+    };
+
+    if (satisfied(node.failure_policy, failure_count)) {
+        reset_range(slot, index, node.end);
+        return NodeStatus::Failure;
+    }
+    if (satisfied(node.success_policy, success_count)) {
+        reset_range(slot, index, node.end);
+        return NodeStatus::Success;
+    }
+    return NodeStatus::Running;
+}
+
+bool BehaviorTreeBatch::check_lower_priority_aborts(std::uint32_t slot,
+                                                    std::uint32_t index,
+                                                    NodeState& state) {
+    const BehaviorContext& context = m_agents[slot].context;
+
+    std::uint32_t child = index + 1;
+    for (std::uint32_t i = 0; i < state.index; ++i, child = m_asset->node(child).end) {
+        const FlatBehaviorNode& guard = m_asset->node(child);
+        if (guard.type != NodeType::Conditional || guard.callback == k_none) continue;
+        if (guard.abort != AbortType::LowerPriority && guard.abort != AbortType::Both) continue;
+        if (!m_asset->condition(guard.callback)(context)) continue;
+
+        // Abort the running branch and resume at the higher priority child
+        reset_range(slot, index + 1, m_asset->node(index).end);
+        state.index = static_cast<std::uint16_t>(i);
+        return true;
+    }
+    return false;
+}
+
+void BehaviorTreeBatch::reset_range(std::uint32_t slot, std::uint32_t begin, std::uint32_t end) {
+    NodeState* block = states(slot);
+    std::fill(block + begin, block + end, NodeState{});
+}
+
+std::uint32_t BehaviorTreeBatch::child_at(std::uint32_t index, std::uint32_t child) const {
+    std::uint32_t node = index + 1;
+    for (std::uint32_t i = 0; i < child; ++i) {
+        node = m_asset->node(node).end;
+    }
+    return node;
+}
+
+std::uint32_t BehaviorTreeBatch::next_random(std::uint32_t slot) {
+    std::uint32_t x = m_agents[slot].rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    m_agents[slot].rng = x;
+    return x;
+}
+
+} // namespace void_ai
@@ -158,7 +158,9 @@ void Blackboard::notify_observers(std::string_view key, const BlackboardValue& v
     std::string key_str(key);
     auto it = m_observers.find(key_str);
     if (it != m_observers.end()) {
-        for (const auto& callback : it->second) {
+        // Callbacks may observe or unobserve, so call a copy of the list
+        auto callbacks = it->second;
+        for (const auto& callback : callbacks) {
             callback(key, value);
         }
     }
@@ -174,4 +176,398 @@ BlackboardScope::BlackboardScope(IBlackboard& parent)
 
 BlackboardScope::~BlackboardScope() = default;
 
+// =============================================================================
+// BlackboardSchema Implementation
+// =============================================================================
+
+std::uint32_t BlackboardSchema::add_slot(std::string_view name, BlackboardSlotType type,
+                                         std::size_t size, std::size_t align,
+                                         const void* default_value) {
+    std::uint32_t existing = find_index(name);
+    if (existing != BlackboardSlot<int>::k_invalid) {
+        return m_slots[existing].type == type ? existing : BlackboardSlot<int>::k_invalid;
+    }
+
+    SlotInfo info;
+    info.name = std::string(name);
+    info.type = type;
+
+    if (type == BlackboardSlotType::String) {
+        info.offset = static_cast<std::uint32_t>(m_string_defaults.size());
+        m_string_defaults.push_back(*static_cast<const std::string*>(default_value));
+    } else {
+        std::size_t offset = (m_defaults.size() + align - 1) / align * align;
+        m_defaults.resize(offset + size);
+        std::memcpy(m_defaults.data() + offset, default_value, size);
+        info.offset = static_cast<std::uint32_t>(offset);
+    }
+
+    auto index = static_cast<std::uint32_t>(m_slots.size());
+    m_lookup.emplace(info.name, index);
+    m_slots.push_back(std::move(info));
+    return index;
+}
+
+std::uint32_t BlackboardSchema::find_index(std::string_view name) const {
+    auto it = m_lookup.find(name);
+    return it != m_lookup.end() ? it->second : BlackboardSlot<int>::k_invalid;
+}
+
+std::uint64_t BlackboardSchema::layout_hash() const {
+    // FNV-1a over slot names, types and offsets
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+
+    for (const auto& slot : m_slots) {
+        mix(slot.name.data(), slot.name.size());
+        mix(&slot.type, sizeof(slot.type));
+        mix(&slot.offset, sizeof(slot.offset));
+    }
+    std::uint64_t size = m_defaults.size();
+    mix(&size, sizeof(size));
+    return hash;
+}
+
+// =============================================================================
+// CompiledBlackboard Implementation
+// =============================================================================
+
+CompiledBlackboard::CompiledBlackboard(std::shared_ptr<const BlackboardSchema> schema,
+                                       IBlackboard* parent)
+    : m_schema(std::move(schema))
+    , m_data(m_schema->default_data())
+    , m_strings(m_schema->default_strings())
+    , m_parent(parent) {
+    m_changed.resize(m_schema->slot_count());
+    m_observed.resize(m_schema->slot_count());
+}
+
+CompiledBlackboard::~CompiledBlackboard() = default;
+
+void CompiledBlackboard::mark_changed(std::uint32_t slot) {
+    m_changed.set(slot);
+    if (!m_observed.test(slot)) {
+        return;
+    }
+
+    // Callbacks may observe or unobserve, so call a copy of the list
+    std::vector<ChangeCallback> callbacks;
+    for (const auto& [observed, callback] : m_observers) {
+        if (observed == slot) {
+            callbacks.push_back(callback);
+        }
+    }
+
+    const auto& name = m_schema->slot(slot).name;
+    BlackboardValue value = slot_value(slot);
+    for (const auto& callback : callbacks) {
+        callback(name, value);
+    }
+}
+
+BlackboardValue CompiledBlackboard::slot_value(std::uint32_t slot) const {
+    const auto& info = m_schema->slot(slot);
+    switch (info.type) {
+        case BlackboardSlotType::Bool:
+            return get(BlackboardSlot<bool>{slot, info.offset});
+        case BlackboardSlotType::Int:
+            return get(BlackboardSlot<int>{slot, info.offset});
+        case BlackboardSlotType::Float:
+            return get(BlackboardSlot<float>{slot, info.offset});
+        case BlackboardSlotType::Vec3:
+            return get(BlackboardSlot<void_math::Vec3>{slot, info.offset});
+        case BlackboardSlotType::String:
+            return m_strings[info.offset];
+    }
+    return {};
+}
+
+bool CompiledBlackboard::assign_slot(std::uint32_t slot, const BlackboardValue& value) {
+    const auto& info = m_schema->slot(slot);
+
+    // Numeric values convert between numeric slots; other mismatches are rejected
+    auto as_number = [&value](double& out) {
+        if (auto* v = std::get_if<bool>(&value)) { out = *v ? 1.0 : 0.0; return true; }
+        if (auto* v = std::get_if<int>(&value)) { out = *v; return true; }
+        if (auto* v = std::get_if<float>(&value)) { out = *v; return true; }
+        if (auto* v = std::get_if<double>(&value)) { out = *v; return true; }
+        return false;
+    };
+
+    double number = 0;
+    switch (info.type) {
+        case BlackboardSlotType::Bool:
+            if (!as_number(number)) return false;
+            set(BlackboardSlot<bool>{slot, info.offset}, number != 0.0);
+            return true;
+        case BlackboardSlotType::Int:
+            if (!as_number(number)) return false;
+            set(BlackboardSlot<int>{slot, info.offset}, static_cast<int>(number));
+            return true;
+        case BlackboardSlotType::Float:
+            if (!as_number(number)) return false;
+            set(BlackboardSlot<float>{slot, info.offset}, static_cast<float>(number));
+            return true;
+        case BlackboardSlotType::Vec3:
+            if (auto* v = std::get_if<void_math::Vec3>(&value)) {
+                set(BlackboardSlot<void_math::Vec3>{slot, info.offset}, *v);
+                return true;
+            }
+            return false;
+        case BlackboardSlotType::String:
+            if (auto* v = std::get_if<std::string>(&value)) {
+                set(BlackboardSlot<std::string>{slot, info.offset}, *v);
+                return true;
+            }
+            return false;
+    }
+    return false;
+}
+
+void CompiledBlackboard::reset_slot(std::uint32_t slot) {
+    const auto& info = m_schema->slot(slot);
+    if (info.type == BlackboardSlotType::String) {
+        set(BlackboardSlot<std::string>{slot, info.offset}, m_schema->default_strings()[info.offset]);
+        return;
+    }
+
+    std::size_t size = info.type == BlackboardSlotType::Bool ? sizeof(bool)
+                     : info.type == BlackboardSlotType::Vec3 ? sizeof(void_math::Vec3)
+                     : sizeof(std::int32_t);
+    const std::byte* src = m_schema->default_data().data() + info.offset;
+    std::byte* dst = m_data.data() + info.offset;
+    if (std::memcmp(dst, src, size) != 0) {
+        std::memcpy(dst, src, size);
+        mark_changed(slot);
+    }
+}
+
+Blackboard& CompiledBlackboard::overflow() {
+    if (!m_overflow) {
+        m_overflow = std::make_unique<Blackboard>();
+    }
+    return *m_overflow;
+}
+
+std::uint64_t CompiledBlackboard::write_snapshot(std::vector<std::uint8_t>& out,
+                                                 std::vector<std::string>* out_strings) const {
+    out.resize(m_data.size());
+    if (!m_data.empty()) {
+        std::memcpy(out.data(), m_data.data(), m_data.size());
+    }
+    if (out_strings) {
+        *out_strings = m_strings;
+    }
+    return m_schema->layout_hash();
+}
+
+bool CompiledBlackboard::read_snapshot(std::uint64_t layout_hash,
+                                       std::span<const std::uint8_t> in,
+                                       std::span<const std::string> strings) {
+    if (layout_hash != m_schema->layout_hash() ||
+        in.size() != m_data.size() ||
+        (!strings.empty() && strings.size() != m_strings.size())) {
+        return false;
+    }
+
+    if (!m_data.empty()) {
+        std::memcpy(m_data.data(), in.data(), in.size());
+    }
+    std::copy(strings.begin(), strings.end(), m_strings.begin());
+
+    for (std::uint32_t i = 0; i < m_schema->slot_count(); ++i) {
+        if (m_schema->slot(i).type != BlackboardSlotType::String || !strings.empty()) {
+            mark_changed(i);
+        }
+    }
+    return true;
+}
+
+void CompiledBlackboard::set_value(std::string_view key, const BlackboardValue& value) {
+    std::uint32_t slot = m_schema->find_index(key);
+    if (slot != BlackboardSlot<int>::k_invalid) {
+        assign_slot(slot, value);
+        return;
+    }
+    overflow().set_value(key, value);
+}
+
+bool CompiledBlackboard::get_value(std::string_view key, BlackboardValue& out_value) const {
+    std::uint32_t slot = m_schema->find_index(key);
+    if (slot != BlackboardSlot<int>::k_invalid) {
+        out_value = slot_value(slot);
+        return true;
+    }
+
+    if (m_overflow && m_overflow->get_value(key, out_value)) {
+        return true;
+    }
+
+    if (m_parent) {
+        return m_parent->get_value(key, out_value);
+    }
+
+    return false;
+}
+
+bool CompiledBlackboard::has_key(std::string_view key) const {
+    if (m_schema->find_index(key) != BlackboardSlot<int>::k_invalid) {
+        return true;
+    }
+
+    if (m_overflow && m_overflow->has_key(key)) {
+        return true;
+    }
+
+    if (m_parent) {
+        return m_parent->has_key(key);
+    }
+
+    return false;
+}
+
+void CompiledBlackboard::remove_key(std::string_view key) {
+    std::uint32_t slot = m_schema->find_index(key);
+    if (slot != BlackboardSlot<int>::k_invalid) {
+        // Schema slots always exist; removing restores the default
+        reset_slot(slot);
+        return;
+    }
+    if (m_overflow) {
+        m_overflow->remove_key(key);
+    }
+}
+
+void CompiledBlackboard::clear() {
+    for (std::uint32_t i = 0; i < m_schema->slot_count(); ++i) {
+        reset_slot(i);
+    }
+    if (m_overflow) {
+        m_overflow->clear();
+    }
+}
+
+void CompiledBlackboard::set_bool(std::string_view key, bool value) {
+    set_value(key, BlackboardValue{value});
+}
+
+void CompiledBlackboard::set_int(std::string_view key, int value) {
+    set_value(key, BlackboardValue{value});
+}
+
+void CompiledBlackboard::set_float(std::string_view key, float value) {
+    set_value(key, BlackboardValue{value});
+}
+
+void CompiledBlackboard::set_string(std::string_view key, std::string_view value) {
+    set_value(key, BlackboardValue{std::string(value)});
+}
+
+void CompiledBlackboard::set_vec3(std::string_view key, const void_math::Vec3& value) {
+    set_value(key, BlackboardValue{value});
+}
+
+bool CompiledBlackboard::get_bool(std::string_view key, bool default_value) const {
+    BlackboardValue value;
+    if (get_value(key, value)) {
+        if (auto* v = std::get_if<bool>(&value)) {
+            return *v;
+        }
+    }
+    return default_value;
+}
+
+int CompiledBlackboard::get_int(std::string_view key, int default_value) const {
+    BlackboardValue value;
+    if (get_value(key, value)) {
+        if (auto* v = std::get_if<int>(&value)) {
+            return *v;
+        }
+    }
+    return default_value;
+}
+
+float CompiledBlackboard::get_float(std::string_view key, float default_value) const {
+    BlackboardValue value;
+    if (get_value(key, value)) {
+        if (auto* v = std::get_if<float>(&value)) {
+            return *v;
+        }
+        if (auto* v = std::get_if<double>(&value)) {
+            return static_cast<float>(*v);
+        }
+    }
+    return default_value;
+}
+
+std::string CompiledBlackboard::get_string(std::string_view key, std::string_view default_value) const {
+    BlackboardValue value;
+    if (get_value(key, value)) {
+        if (auto* v = std::get_if<std::string>(&value)) {
+            return *v;
+        }
+    }
+    return std::string(default_value);
+}
+
+void_math::Vec3 CompiledBlackboard::get_vec3(std::string_view key, const void_math::Vec3& default_value) const {
+    BlackboardValue value;
+    if (get_value(key, value)) {
+        if (auto* v = std::get_if<void_math::Vec3>(&value)) {
+            return *v;
+        }
+    }
+    return default_value;
+}
+
+void CompiledBlackboard::observe(std::string_view key, ChangeCallback callback) {
+    std::uint32_t slot = m_schema->find_index(key);
+    if (slot == BlackboardSlot<int>::k_invalid) {
+        overflow().observe(key, std::move(callback));
+        return;
+    }
+    m_observed.set(slot);
+    m_observers.emplace_back(slot, std::move(callback));
+}
+
+void CompiledBlackboard::unobserve(std::string_view key) {
+    std::uint32_t slot = m_schema->find_index(key);
+    if (slot == BlackboardSlot<int>::k_invalid) {
+        if (m_overflow) {
+            m_overflow->unobserve(key);
+        }
+        return;
+    }
+    m_observed.reset(slot);
+    m_observers.erase(std::remove_if(m_observers.begin(), m_observers.end(),
+                                     [slot](const auto& entry) { return entry.first == slot; }),
+                      m_observers.end());
+}
+
+std::vector<std::pair<std::string, BlackboardValue>> CompiledBlackboard::get_all() const {
+    std::vector<std::pair<std::string, BlackboardValue>> result;
+    result.reserve(m_schema->slot_count());
+    for (std::uint32_t i = 0; i < m_schema->slot_count(); ++i) {
+        result.emplace_back(m_schema->slot(i).name, slot_value(i));
+    }
+    if (m_overflow) {
+        auto extra = m_overflow->get_all();
+        result.insert(result.end(), std::make_move_iterator(extra.begin()),
+                      std::make_move_iterator(extra.end()));
+    }
+    return result;
+}
+
+void CompiledBlackboard::merge(const IBlackboard& other) {
+    auto all_data = other.get_all();
+    for (const auto& [key, value] : all_data) {
+        set_value(key, value);
+    }
+}
+
 } // namespace void_ai
@@ -0,0 +1,608 @@
+/// @file crowd.cpp
+/// @brief Crowd simulation implementation for void_ai module
+///
+/// Velocity selection follows ORCA (van den Berg et al., "Reciprocal n-Body
+/// Collision Avoidance"): every neighbour contributes a half-plane of
+/// permitted velocities, and a 2D linear program picks the permitted velocity
+/// closest to the preferred one. When the half-planes leave no room, a 3D
+/// program minimises the largest violation instead.
+
+#include <void_engine/ai/crowd.hpp>
+#include <void_engine/ai/navmesh.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace void_ai {
+
+namespace {
+
+constexpr float k_epsilon = 1e-5f;
+constexpr std::uint32_t k_invalid_slot = std::numeric_limits<std::uint32_t>::max();
+
+// Agents handed to a worker at a time
+constexpr std::uint32_t k_chunk = 64;
+
+struct Vec2 {
+    float x{0};
+    float z{0};
+};
+
+Vec2 operator+(Vec2 a, Vec2 b) { return {a.x + b.x, a.z + b.z}; }
+Vec2 operator-(Vec2 a, Vec2 b) { return {a.x - b.x, a.z - b.z}; }
+Vec2 operator-(Vec2 a) { return {-a.x, -a.z}; }
+Vec2 operator*(Vec2 a, float s) { return {a.x * s, a.z * s}; }
+float dot2(Vec2 a, Vec2 b) { return a.x * b.x + a.z * b.z; }
+float det2(Vec2 a, Vec2 b) { return a.x * b.z - a.z * b.x; }
+float length_sq2(Vec2 a) { return dot2(a, a); }
+
+Vec2 normalize2(Vec2 a) {
+    float len = std::sqrt(length_sq2(a));
+    return len > k_epsilon ? a * (1.0f / len) : Vec2{};
+}
+
+/// @brief Half-plane of permitted velocities (left of direction through point)
+struct OrcaLine {
+    Vec2 point;
+    Vec2 direction;
+};
+
+/// @brief Solve on one line, subject to the lines before it and the speed circle
+bool linear_program1(const std::vector<OrcaLine>& lines, std::size_t line_no, float radius,
+                     Vec2 opt_velocity, bool direction_opt, Vec2& result) {
+    const OrcaLine& line = lines[line_no];
+    float dot_product = dot2(line.point, line.direction);
+    float discriminant = dot_product * dot_product + radius * radius - length_sq2(line.point);
+    if (discriminant < 0.0f) {
+        // Speed circle misses the line entirely
+        return false;
+    }
+
+    float sqrt_discriminant = std::sqrt(discriminant);
+    float t_left = -dot_product - sqrt_discriminant;
+    float t_right = -dot_product + sqrt_discriminant;
+
+    for (std::size_t i = 0; i < line_no; ++i) {
+        float denominator = det2(line.direction, lines[i].direction);
+        float numerator = det2(lines[i].direction, line.point - lines[i].point);
+
+        if (std::abs(denominator) <= k_epsilon) {
+            // Parallel lines
+            if (numerator < 0.0f) return false;
+            continue;
+        }
+
+        float t = numerator / denominator;
+        if (denominator >= 0.0f) {
+            t_right = std::min(t_right, t);
+        } else {
+            t_left = std::max(t_left, t);
+        }
+        if (t_left > t_right) return false;
+    }
+
+    if (direction_opt) {
+        result = dot2(opt_velocity, line.direction) > 0.0f
+            ? line.point + line.direction * t_right
+            : line.point + line.direction * t_left;
+    } else {
+        float t = dot2(line.direction, opt_velocity - line.point);
+        t = std::clamp(t, t_left, t_right);
+        result = line.point + line.direction * t;
+    }
+    return true;
+}
+
+/// @return Number of lines satisfied; lines.size() on success
+std::size_t linear_program2(const std::vector<OrcaLine>& lines, float radius,
+                            Vec2 opt_velocity, bool direction_opt, Vec2& result) {
+    if (direction_opt) {
+        result = opt_velocity * radius;
+    } else if (length_sq2(opt_velocity) > radius * radius) {
+        result = normalize2(opt_velocity) * radius;
+    } else {
+        result = opt_velocity;
+    }
+
+    for (std::size_t i = 0; i < lines.size(); ++i) {
+        if (det2(lines[i].direction, lines[i].point - result) > 0.0f) {
+            Vec2 previous = result;
+            if (!linear_program1(lines, i, radius, opt_velocity, direction_opt, result)) {
+                result = previous;
+                return i;
+            }
+        }
+    }
+    return lines.size();
+}
+
+/// @brief Minimise the largest violation once the constraints are infeasible
+void linear_program3(const std::vector<OrcaLine>& lines, std::size_t begin_line,
+                     float radius, Vec2& result, std::vector<OrcaLine>& projected) {
+    float distance = 0.0f;
+
+    for (std::size_t i = begin_line; i < lines.size(); ++i) {
+        if (det2(lines[i].direction, lines[i].point - result) <= distance) continue;
+
+        projected.clear();
+        for (std::size_t j = 0; j < i; ++j) {
+            OrcaLine line;
+            float determinant = det2(lines[i].direction, lines[j].direction);
+
+            if (std::abs(determinant) <= k_epsilon) {
+                if (dot2(lines[i].direction, lines[j].direction) > 0.0f) {
+                    // Same direction
+                    continue;
+                }
+                line.point = (lines[i].point + lines[j].point) * 0.5f;
+            } else {
+                line.point = lines[i].point + lines[i].direction *
+                    (det2(lines[j].direction, lines[i].point - lines[j].point) / determinant);
+            }
+            line.direction = normalize2(lines[j].direction - lines[i].direction);
+            projected.push_back(line);
+        }
+
+        Vec2 previous = result;
+        if (linear_program2(projected, radius, Vec2{-lines[i].direction.z, lines[i].direction.x},
+                            true, result) < projected.size()) {
+            // Only rounding error can fail here; keep the previous result
+            result = previous;
+        }
+        distance = det2(lines[i].direction, lines[i].point - result);
+    }
+}
+
+std::uint32_t hash_cell(std::int32_t x, std::int32_t z, std::uint32_t mask) {
+    return (static_cast<std::uint32_t>(x) * 73856093u ^ static_cast<std::uint32_t>(z) * 19349663u) & mask;
+}
+
+std::int32_t cell_coord(float value, float cell_size) {
+    return static_cast<std::int32_t>(std::floor(value / cell_size));
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// CrowdSystem Implementation
+// =============================================================================
+
+CrowdSystem::CrowdSystem() = default;
+
+CrowdSystem::CrowdSystem(const CrowdConfig& config)
+    : m_config(config) {
+}
+
+CrowdSystem::~CrowdSystem() = default;
+
+CrowdAgentId CrowdSystem::add_agent(const void_math::Vec3& position,
+                                    const CrowdAgentParams& params) {
+    std::uint32_t slot = allocate_slot();
+    if (slot == k_invalid_slot) return CrowdAgentId{};
+
+    m_pos_x[slot] = position.x;
+    m_pos_y[slot] = position.y;
+    m_pos_z[slot] = position.z;
+    m_radius[slot] = params.radius;
+    m_max_speed[slot] = params.max_speed;
+    return id_of(slot);
+}
+
+CrowdAgentId CrowdSystem::add_agent(NavAgent* agent) {
+    if (!agent) return CrowdAgentId{};
+
+    CrowdAgentId id = add_agent(agent->position(),
+                                CrowdAgentParams{agent->config().radius, agent->speed()});
+    if (id) {
+        m_nav_agents[id.value & k_slot_mask] = agent;
+    }
+    return id;
+}
+
+void CrowdSystem::remove_agent(CrowdAgentId id) {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return;
+
+    // The new generation invalidates outstanding ids for this slot
+    std::uint32_t generation = (m_slot_generation[slot] + 1) & (0xFFFFFFFFu >> k_slot_bits);
+    m_slot_generation[slot] = generation ? generation : 1;
+
+    m_active[slot] = 0;
+    m_nav_agents[slot] = nullptr;
+    m_neighbor_count[slot] = 0;
+    m_free_slots.push_back(slot);
+    --m_active_count;
+}
+
+void CrowdSystem::remove_agent(const NavAgent* agent) {
+    for (std::uint32_t slot = 0; slot < m_nav_agents.size(); ++slot) {
+        if (m_active[slot] && m_nav_agents[slot] == agent) {
+            remove_agent(id_of(slot));
+            return;
+        }
+    }
+}
+
+void CrowdSystem::clear() {
+    for (auto* array : {&m_pos_x, &m_pos_y, &m_pos_z, &m_vel_x, &m_vel_z, &m_pref_x, &m_pref_z,
+                        &m_new_x, &m_new_z, &m_radius, &m_max_speed}) {
+        array->clear();
+    }
+    m_nav_agents.clear();
+    m_active.clear();
+    m_free_slots.clear();
+
+    // Generations survive so ids issued before the clear stay invalid
+    for (auto& generation : m_slot_generation) {
+        std::uint32_t next = (generation + 1) & (0xFFFFFFFFu >> k_slot_bits);
+        generation = next ? next : 1;
+    }
+    m_neighbors.clear();
+    m_neighbor_count.clear();
+    m_agent_cell.clear();
+    m_active_count = 0;
+}
+
+bool CrowdSystem::is_valid(CrowdAgentId id) const {
+    return slot_of(id) != k_invalid_slot;
+}
+
+void CrowdSystem::set_preferred_velocity(CrowdAgentId id, const void_math::Vec3& velocity) {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return;
+    m_pref_x[slot] = velocity.x;
+    m_pref_z[slot] = velocity.z;
+}
+
+void CrowdSystem::set_position(CrowdAgentId id, const void_math::Vec3& position) {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return;
+    m_pos_x[slot] = position.x;
+    m_pos_y[slot] = position.y;
+    m_pos_z[slot] = position.z;
+}
+
+void CrowdSystem::set_params(CrowdAgentId id, const CrowdAgentParams& params) {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return;
+    m_radius[slot] = params.radius;
+    m_max_speed[slot] = params.max_speed;
+}
+
+void_math::Vec3 CrowdSystem::position(CrowdAgentId id) const {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return {};
+    return {m_pos_x[slot], m_pos_y[slot], m_pos_z[slot]};
+}
+
+void_math::Vec3 CrowdSystem::velocity(CrowdAgentId id) const {
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot) return {};
+    return {m_vel_x[slot], 0.0f, m_vel_z[slot]};
+}
+
+std::vector<CrowdAgentId> CrowdSystem::neighbors(CrowdAgentId id) const {
+    std::vector<CrowdAgentId> result;
+    std::uint32_t slot = slot_of(id);
+    if (slot == k_invalid_slot || slot >= m_neighbor_count.size()) return result;
+
+    const std::uint32_t* list = m_neighbors.data() + static_cast<std::size_t>(slot) * m_neighbor_stride;
+    for (std::uint32_t k = 0; k < m_neighbor_count[slot]; ++k) {
+        result.push_back(id_of(list[k]));
+    }
+    return result;
+}
+
+std::vector<KinematicState> CrowdSystem::neighbor_states(CrowdAgentId id) const {
+    std::vector<KinematicState> states;
+    for (CrowdAgentId neighbor : neighbors(id)) {
+        std::uint32_t slot = neighbor.value & k_slot_mask;
+        KinematicState state;
+        state.position = {m_pos_x[slot], m_pos_y[slot], m_pos_z[slot]};
+        state.velocity = {m_vel_x[slot], 0.0f, m_vel_z[slot]};
+        state.max_speed = m_max_speed[slot];
+        state.radius = m_radius[slot];
+        states.push_back(state);
+    }
+    return states;
+}
+
+template<typename Fn>
+void CrowdSystem::for_each_active_parallel(Fn&& fn) {
+    const auto slots = static_cast<std::uint32_t>(m_active.size());
+    std::atomic<std::uint32_t> next{0};
+
+    auto worker = [&]() {
+        for (;;) {
+            std::uint32_t begin = next.fetch_add(k_chunk);
+            if (begin >= slots) return;
+            std::uint32_t end = std::min(begin + k_chunk, slots);
+            for (std::uint32_t slot = begin; slot < end; ++slot) {
+                if (m_active[slot]) {
+                    fn(slot);
+                }
+            }
+        }
+    };
+
+    // Small crowds stay on the calling thread
+    std::size_t worker_count = std::min<std::size_t>(
+        m_config.max_workers > 0 ? m_config.max_workers
+                                 : std::max(1u, std::thread::hardware_concurrency()),
+        slots / (k_chunk * 4));
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 1; t < worker_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void CrowdSystem::update(float dt) {
+    if (m_active_count == 0 || dt <= 0.0f) return;
+
+    gather_agents();
+    build_spatial_hash();
+
+    m_neighbor_stride = std::max<std::uint32_t>(m_config.max_neighbors, 1);
+    m_neighbors.resize(m_active.size() * m_neighbor_stride);
+    m_neighbor_count.assign(m_active.size(), 0);
+
+    for_each_active_parallel([this, dt](std::uint32_t agent) {
+        find_neighbors(agent);
+        compute_velocity(agent, dt);
+    });
+
+    integrate(dt);
+}
+
+std::uint32_t CrowdSystem::allocate_slot() {
+    std::uint32_t slot;
+    if (!m_free_slots.empty()) {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(m_active.size());
+        if (slot > k_slot_mask) {
+            return k_invalid_slot;
+        }
+        if (slot == m_slot_generation.size()) {
+            m_slot_generation.push_back(1);
+        }
+        for (auto* array : {&m_pos_x, &m_pos_y, &m_pos_z, &m_vel_x, &m_vel_z, &m_pref_x, &m_pref_z,
+                            &m_new_x, &m_new_z, &m_radius, &m_max_speed}) {
+            array->push_back(0.0f);
+        }
+        m_nav_agents.push_back(nullptr);
+        m_active.push_back(0);
+        m_neighbor_count.push_back(0);
+    }
+
+    m_vel_x[slot] = m_vel_z[slot] = 0.0f;
+    m_pref_x[slot] = m_pref_z[slot] = 0.0f;
+    m_new_x[slot] = m_new_z[slot] = 0.0f;
+    m_nav_agents[slot] = nullptr;
+    m_active[slot] = 1;
+    ++m_active_count;
+    return slot;
+}
+
+CrowdAgentId CrowdSystem::id_of(std::uint32_t slot) const {
+    return CrowdAgentId{(m_slot_generation[slot] << k_slot_bits) | slot};
+}
+
+std::uint32_t CrowdSystem::slot_of(CrowdAgentId id) const {
+    std::uint32_t slot = id.value & k_slot_mask;
+    if (!id || slot >= m_active.size() || !m_active[slot] ||
+        m_slot_generation[slot] != (id.value >> k_slot_bits)) {
+        return k_invalid_slot;
+    }
+    return slot;
+}
+
+void CrowdSystem::gather_agents() {
+    // Bound agents own their state; copy it in and steer along their path
+    for (std::uint32_t slot = 0; slot < m_nav_agents.size(); ++slot) {
+        NavAgent* agent = m_nav_agents[slot];
+        if (!m_active[slot] || !agent) continue;
+
+        const auto& position = agent->position();
+        const auto& velocity = agent->velocity();
+        auto preferred = agent->desired_velocity();
+        m_pos_x[slot] = position.x;
+        m_pos_y[slot] = position.y;
+        m_pos_z[slot] = position.z;
+        m_vel_x[slot] = velocity.x;
+        m_vel_z[slot] = velocity.z;
+        m_pref_x[slot] = preferred.x;
+        m_pref_z[slot] = preferred.z;
+        m_radius[slot] = agent->config().radius;
+        m_max_speed[slot] = agent->speed();
+    }
+}
+
+void CrowdSystem::build_spatial_hash() {
+    // Cells as wide as the query radius, so a query touches a 3x3 block
+    m_cell_size = std::max(m_config.neighbor_radius, 0.01f);
+
+    std::uint32_t table_size = 1;
+    while (table_size < m_active_count * 2) {
+        table_size <<= 1;
+    }
+    const std::uint32_t mask = table_size - 1;
+
+    const std::size_t slots = m_active.size();
+    m_agent_cell.resize(slots);
+    m_cell_start.assign(table_size + 1, 0);
+
+    for (std::uint32_t slot = 0; slot < slots; ++slot) {
+        if (!m_active[slot]) continue;
+        std::uint32_t cell = hash_cell(cell_coord(m_pos_x[slot], m_cell_size),
+                                       cell_coord(m_pos_z[slot], m_cell_size), mask);
+        m_agent_cell[slot] = cell;
+        ++m_cell_start[cell + 1];
+    }
+    for (std::uint32_t c = 0; c < table_size; ++c) {
+        m_cell_start[c + 1] += m_cell_start[c];
+    }
+
+    m_cell_agents.resize(m_active_count);
+    std::vector<std::uint32_t> fill(m_cell_start.begin(), m_cell_start.end() - 1);
+    for (std::uint32_t slot = 0; slot < slots; ++slot) {
+        if (!m_active[slot]) continue;
+        m_cell_agents[fill[m_agent_cell[slot]]++] = slot;
+    }
+}
+
+void CrowdSystem::find_neighbors(std::uint32_t agent) {
+    const float px = m_pos_x[agent];
+    const float pz = m_pos_z[agent];
+    const float range_sq = m_config.neighbor_radius * m_config.neighbor_radius;
+    const std::uint32_t mask = static_cast<std::uint32_t>(m_cell_start.size() - 2);
+    const std::int32_t cx = cell_coord(px, m_cell_size);
+    const std::int32_t cz = cell_coord(pz, m_cell_size);
+
+    std::uint32_t* list = m_neighbors.data() + static_cast<std::size_t>(agent) * m_neighbor_stride;
+    thread_local std::vector<float> distances;
+    distances.resize(m_neighbor_stride);
+    std::uint32_t count = 0;
+
+    // Distinct cells can share a bucket; visit each bucket once
+    std::uint32_t visited[9];
+    std::uint32_t visited_count = 0;
+
+    for (std::int32_t dz = -1; dz <= 1; ++dz) {
+        for (std::int32_t dx = -1; dx <= 1; ++dx) {
+            std::uint32_t bucket = hash_cell(cx + dx, cz + dz, mask);
+            if (std::find(visited, visited + visited_count, bucket) != visited + visited_count) {
+                continue;
+            }
+            visited[visited_count++] = bucket;
+
+            for (std::uint32_t i = m_cell_start[bucket]; i < m_cell_start[bucket + 1]; ++i) {
+                std::uint32_t other = m_cell_agents[i];
+                if (other == agent) continue;
+
+                float ox = m_pos_x[other] - px;
+                float oz = m_pos_z[other] - pz;
+                float d = ox * ox + oz * oz;
+                if (d >= range_sq) continue;
+                if (count == m_neighbor_stride && d >= distances[count - 1]) continue;
+
+                // Insertion into the sorted list of closest neighbours
+                std::uint32_t k = count < m_neighbor_stride ? count++ : count - 1;
+                while (k > 0 && distances[k - 1] > d) {
+                    distances[k] = distances[k - 1];
+                    list[k] = list[k - 1];
+                    --k;
+                }
+                distances[k] = d;
+                list[k] = other;
+            }
+        }
+    }
+
+    m_neighbor_count[agent] = count;
+}
+
+void CrowdSystem::compute_velocity(std::uint32_t agent, float dt) {
+    thread_local std::vector<OrcaLine> lines;
+    thread_local std::vector<OrcaLine> projected;
+    lines.clear();
+
+    const Vec2 position{m_pos_x[agent], m_pos_z[agent]};
+    const Vec2 velocity{m_vel_x[agent], m_vel_z[agent]};
+    const float radius = m_radius[agent];
+    const float inv_time_horizon = 1.0f / std::max(m_config.time_horizon, k_epsilon);
+    const float inv_time_step = 1.0f / dt;
+
+    const std::uint32_t* list = m_neighbors.data() + static_cast<std::size_t>(agent) * m_neighbor_stride;
+    for (std::uint32_t k = 0; k < m_neighbor_count[agent]; ++k) {
+        std::uint32_t other = list[k];
+        const Vec2 relative_position = Vec2{m_pos_x[other], m_pos_z[other]} - position;
+        const Vec2 relative_velocity = velocity - Vec2{m_vel_x[other], m_vel_z[other]};
+        const float dist_sq = length_sq2(relative_position);
+        const float combined_radius = radius + m_radius[other];
+        const float combined_radius_sq = combined_radius * combined_radius;
+
+        OrcaLine line;
+        Vec2 u;
+
+        if (dist_sq > combined_radius_sq) {
+            // No collision: vector from cutoff center to relative velocity
+            const Vec2 w = relative_velocity - relative_position * inv_time_horizon;
+            const float w_length_sq = length_sq2(w);
+            const float dot_product = dot2(w, relative_position);
+
+            if (dot_product < 0.0f && dot_product * dot_product > combined_radius_sq * w_length_sq) {
+                // Project on the cutoff circle
+                const float w_length = std::sqrt(w_length_sq);
+                const Vec2 unit_w = w * (1.0f / w_length);
+                line.direction = {unit_w.z, -unit_w.x};
+                u = unit_w * (combined_radius * inv_time_horizon - w_length);
+            } else {
+                // Project on the nearer leg of the velocity obstacle
+                const float leg = std::sqrt(dist_sq - combined_radius_sq);
+                if (det2(relative_position, w) > 0.0f) {
+                    line.direction = Vec2{
+                        relative_position.x * leg - relative_position.z * combined_radius,
+                        relative_position.x * combined_radius + relative_position.z * leg} *
+                        (1.0f / dist_sq);
+                } else {
+                    line.direction = -(Vec2{
+                        relative_position.x * leg + relative_position.z * combined_radius,
+                        -relative_position.x * combined_radius + relative_position.z * leg} *
+                        (1.0f / dist_sq));
+                }
+                u = line.direction * dot2(relative_velocity, line.direction) - relative_velocity;
+            }
+        } else {
+            // Already overlapping: separate within one step
+            const Vec2 w = relative_velocity - relative_position * inv_time_step;
+            const float w_length = std::sqrt(length_sq2(w));
+            const Vec2 unit_w = w_length > k_epsilon ? w * (1.0f / w_length) : Vec2{1.0f, 0.0f};
+            line.direction = {unit_w.z, -unit_w.x};
+            u = unit_w * (combined_radius * inv_time_step - w_length);
+        }
+
+        // Each agent takes half of the responsibility
+        line.point = velocity + u * 0.5f;
+        lines.push_back(line);
+    }
+
+    const float max_speed = m_max_speed[agent];
+    const Vec2 preferred{m_pref_x[agent], m_pref_z[agent]};
+    Vec2 result;
+    std::size_t line_fail = linear_program2(lines, max_speed, preferred, false, result);
+    if (line_fail < lines.size()) {
+        linear_program3(lines, line_fail, max_speed, result, projected);
+    }
+
+    m_new_x[agent] = result.x;
+    m_new_z[agent] = result.z;
+}
+
+void CrowdSystem::integrate(float dt) {
+    const std::size_t slots = m_active.size();
+    for (std::size_t slot = 0; slot < slots; ++slot) {
+        if (!m_active[slot]) continue;
+
+        m_vel_x[slot] = m_new_x[slot];
+        m_vel_z[slot] = m_new_z[slot];
+
+        if (NavAgent* agent = m_nav_agents[slot]) {
+            agent->set_avoidance_velocity({m_new_x[slot], 0.0f, m_new_z[slot]});
+        } else {
+            m_pos_x[slot] += m_vel_x[slot] * dt;
+            m_pos_z[slot] += m_vel_z[slot] * dt;
+        }
+    }
+}
+
+} // namespace void_ai
@@ -2,12 +2,17 @@
 /// @brief Navigation mesh implementation for void_ai module
 
 #include <void_engine/ai/navmesh.hpp>
+#include <void_engine/ai/crowd.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstring>
 #include <limits>
+#include <numeric>
 #include <queue>
 #include <random>
+#include <thread>
 
 namespace void_ai {
 
@@ -102,6 +107,15 @@ float triangle_area(const void_math::Vec3& a, const void_math::Vec3& b, const vo
     return vec3_length(cross) * 0.5f;
 }
 
+std::uint64_t cell_key(std::int32_t x, std::int32_t z) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+           static_cast<std::uint32_t>(z);
+}
+
+std::int32_t cell_coord(float value, float cell_size) {
+    return static_cast<std::int32_t>(std::floor(value / cell_size));
+}
+
 } // anonymous namespace
 
 // =============================================================================
@@ -121,102 +135,245 @@ void NavMesh::add_vertex(const void_math::Vec3& position) {
     vertex.position = position;
     vertex.index = static_cast<std::uint32_t>(m_vertices.size());
     m_vertices.push_back(vertex);
-    update_bounds();
+    expand_bounds(position);
 }
 
 void NavMesh::add_polygon(const std::vector<std::uint32_t>& vertices, std::uint32_t flags) {
     NavPolygon poly;
     poly.vertices = vertices;
     poly.flags = flags;
-
-    // Calculate center
-    void_math::Vec3 center{};
-    for (std::uint32_t vi : vertices) {
-        if (vi < m_vertices.size()) {
-            center.x += m_vertices[vi].position.x;
-            center.y += m_vertices[vi].position.y;
-            center.z += m_vertices[vi].position.z;
-        }
-    }
-    if (!vertices.empty()) {
-        float inv_count = 1.0f / static_cast<float>(vertices.size());
-        center.x *= inv_count;
-        center.y *= inv_count;
-        center.z *= inv_count;
-    }
-    poly.center = center;
-
-    // Calculate area (sum of triangle areas)
-    if (vertices.size() >= 3) {
-        const auto& v0 = m_vertices[vertices[0]].position;
-        for (std::size_t i = 2; i < vertices.size(); ++i) {
-            const auto& v1 = m_vertices[vertices[i - 1]].position;
-            const auto& v2 = m_vertices[vertices[i]].position;
-            poly.area += triangle_area(v0, v1, v2);
-        }
-    }
+    compute_polygon_data(poly);
 
     m_total_area += poly.area;
     m_polygons.push_back(poly);
+    m_detail.emplace_back();
+
+    if (m_grid_cell_size > 0) {
+        index_polygon(static_cast<std::uint32_t>(m_polygons.size() - 1));
+    }
 }
 
 void NavMesh::build_connectivity() {
-    // Build neighbor connections based on shared edges
-    for (std::size_t i = 0; i < m_polygons.size(); ++i) {
-        m_polygons[i].neighbors.clear();
-
-        for (std::size_t j = 0; j < m_polygons.size(); ++j) {
-            if (i == j) continue;
-
-            // Check for shared edge (2 shared vertices)
-            int shared_count = 0;
-            for (std::uint32_t vi : m_polygons[i].vertices) {
-                for (std::uint32_t vj : m_polygons[j].vertices) {
-                    if (vi == vj) {
-                        shared_count++;
-                        if (shared_count >= 2) {
-                            m_polygons[i].neighbors.push_back(static_cast<std::uint32_t>(j));
-                            break;
-                        }
-                    }
-                }
-                if (shared_count >= 2) break;
+    // Hash every edge by its sorted vertex pair; polygons meeting on a key are neighbors
+    std::unordered_map<std::uint64_t, std::uint32_t> open_edges;
+    open_edges.reserve(m_polygons.size() * 3);
+
+    for (auto& poly : m_polygons) {
+        poly.neighbors.clear();
+    }
+
+    auto link = [this](std::uint32_t a, std::uint32_t b) {
+        auto& na = m_polygons[a].neighbors;
+        if (a == b || std::find(na.begin(), na.end(), b) != na.end()) return;
+        na.push_back(b);
+        m_polygons[b].neighbors.push_back(a);
+    };
+
+    for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
+        const auto& verts = m_polygons[pi].vertices;
+        for (std::size_t i = 0; i < verts.size(); ++i) {
+            std::uint32_t va = verts[i];
+            std::uint32_t vb = verts[(i + 1) % verts.size()];
+            std::uint64_t key = (static_cast<std::uint64_t>(std::min(va, vb)) << 32) |
+                                std::max(va, vb);
+
+            auto [it, inserted] = open_edges.try_emplace(key, pi);
+            if (!inserted) {
+                link(it->second, pi);
             }
         }
     }
+
+    build_spatial_index(m_grid_cell_size);
 }
 
 void NavMesh::calculate_polygon_data() {
     m_total_area = 0;
     for (auto& poly : m_polygons) {
-        // Recalculate center and area
-        void_math::Vec3 center{};
-        for (std::uint32_t vi : poly.vertices) {
-            if (vi < m_vertices.size()) {
-                center.x += m_vertices[vi].position.x;
-                center.y += m_vertices[vi].position.y;
-                center.z += m_vertices[vi].position.z;
+        compute_polygon_data(poly);
+        m_total_area += poly.area;
+    }
+}
+
+// =============================================================================
+// Tiles
+// =============================================================================
+
+std::uint64_t NavMesh::tile_key(std::int32_t x, std::int32_t z) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+           static_cast<std::uint32_t>(z);
+}
+
+void NavMesh::set_tile(NavMeshTile tile) {
+    remove_tile(tile.x, tile.z);
+
+    TileRecord record;
+    record.x = tile.x;
+    record.z = tile.z;
+    record.bounds_min = tile.bounds_min;
+    record.bounds_max = tile.bounds_max;
+    record.link_climb = tile.link_climb;
+
+    // Reuse slots freed by earlier tiles so indices held elsewhere stay stable
+    record.vertices.reserve(tile.vertices.size());
+    for (const auto& position : tile.vertices) {
+        std::uint32_t index;
+        if (!m_free_vertices.empty()) {
+            index = m_free_vertices.back();
+            m_free_vertices.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(m_vertices.size());
+            m_vertices.emplace_back();
+        }
+        m_vertices[index].position = position;
+        m_vertices[index].index = index;
+        expand_bounds(position);
+        record.vertices.push_back(index);
+    }
+
+    record.polygons.reserve(tile.polygons.size());
+    for (std::size_t i = 0; i < tile.polygons.size(); ++i) {
+        std::uint32_t index;
+        if (!m_free_polygons.empty()) {
+            index = m_free_polygons.back();
+            m_free_polygons.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(m_polygons.size());
+            m_polygons.emplace_back();
+            m_detail.emplace_back();
+        }
+        record.polygons.push_back(index);
+    }
+
+    for (std::size_t i = 0; i < tile.polygons.size(); ++i) {
+        NavPolygon& poly = tile.polygons[i];
+        for (auto& vi : poly.vertices) {
+            vi = record.vertices[vi];
+        }
+        for (auto& ni : poly.neighbors) {
+            ni = record.polygons[ni];
+        }
+        compute_polygon_data(poly);
+        m_total_area += poly.area;
+
+        std::uint32_t index = record.polygons[i];
+        m_polygons[index] = std::move(poly);
+        m_detail[index] = i < tile.detail.size() ? std::move(tile.detail[i])
+                                                 : std::vector<void_math::Vec3>{};
+    }
+
+    if (m_grid_cell_size > 0) {
+        for (std::uint32_t index : record.polygons) {
+            index_polygon(index);
+        }
+    } else {
+        build_spatial_index(std::max((tile.bounds_max.x - tile.bounds_min.x) / 8.0f, 0.5f));
+    }
+
+    record.border_edges = std::move(tile.border_edges);
+    for (auto& edge : record.border_edges) {
+        edge.polygon = record.polygons[edge.polygon];
+    }
+
+    static constexpr std::int32_t k_side_x[4] = {-1, 0, 1, 0};
+    static constexpr std::int32_t k_side_z[4] = {0, 1, 0, -1};
+    for (int side = 0; side < 4; ++side) {
+        auto it = m_tiles.find(tile_key(record.x + k_side_x[side], record.z + k_side_z[side]));
+        if (it != m_tiles.end()) {
+            link_tiles(record, it->second);
+        }
+    }
+
+    m_tiles.insert_or_assign(tile_key(record.x, record.z), std::move(record));
+}
+
+bool NavMesh::remove_tile(std::int32_t x, std::int32_t z) {
+    auto it = m_tiles.find(tile_key(x, z));
+    if (it == m_tiles.end()) return false;
+
+    for (std::uint32_t pi : it->second.polygons) {
+        unindex_polygon(pi);
+        for (std::uint32_t ni : m_polygons[pi].neighbors) {
+            auto& back = m_polygons[ni].neighbors;
+            back.erase(std::remove(back.begin(), back.end(), pi), back.end());
+        }
+        m_total_area -= m_polygons[pi].area;
+        m_polygons[pi] = NavPolygon{};
+        m_detail[pi].clear();
+        m_free_polygons.push_back(pi);
+    }
+    m_free_vertices.insert(m_free_vertices.end(),
+                           it->second.vertices.begin(), it->second.vertices.end());
+
+    m_tiles.erase(it);
+    return true;
+}
+
+bool NavMesh::has_tile(std::int32_t x, std::int32_t z) const {
+    return m_tiles.find(tile_key(x, z)) != m_tiles.end();
+}
+
+void NavMesh::link_tiles(const TileRecord& a, const TileRecord& b) {
+    // Tiles are matched by coordinate hash; their facing border edges link when they
+    // overlap along the shared border and sit within climbing distance of each other.
+    float climb = std::max(a.link_climb, b.link_climb);
+    int side = b.x > a.x ? 2 : b.x < a.x ? 0 : b.z > a.z ? 1 : 3;
+    int opposite = (side + 2) & 3;
+
+    for (const auto& ea : a.border_edges) {
+        if (ea.side != side) continue;
+        for (const auto& eb : b.border_edges) {
+            if (eb.side != opposite) continue;
+            float overlap = std::min(ea.max, eb.max) - std::max(ea.min, eb.min);
+            if (overlap <= 1e-3f || std::abs(ea.height - eb.height) > climb) continue;
+
+            auto& na = m_polygons[ea.polygon].neighbors;
+            if (std::find(na.begin(), na.end(), eb.polygon) == na.end()) {
+                na.push_back(eb.polygon);
+                m_polygons[eb.polygon].neighbors.push_back(ea.polygon);
             }
         }
-        if (!poly.vertices.empty()) {
-            float inv_count = 1.0f / static_cast<float>(poly.vertices.size());
-            center.x *= inv_count;
-            center.y *= inv_count;
-            center.z *= inv_count;
-        }
-        poly.center = center;
-
-        poly.area = 0;
-        if (poly.vertices.size() >= 3) {
-            const auto& v0 = m_vertices[poly.vertices[0]].position;
-            for (std::size_t i = 2; i < poly.vertices.size(); ++i) {
-                const auto& v1 = m_vertices[poly.vertices[i - 1]].position;
-                const auto& v2 = m_vertices[poly.vertices[i]].position;
-                poly.area += triangle_area(v0, v1, v2);
+    }
+}
+
+float NavMesh::polygon_height(std::uint32_t polygon, const void_math::Vec3& point) const {
+    if (polygon >= m_polygons.size()) return point.y;
+
+    auto height_in = [&point](const void_math::Vec3& a, const void_math::Vec3& b,
+                              const void_math::Vec3& c, float& out) {
+        float v0x = c.x - a.x, v0z = c.z - a.z;
+        float v1x = b.x - a.x, v1z = b.z - a.z;
+        float v2x = point.x - a.x, v2z = point.z - a.z;
+        float denom = v0x * v1z - v0z * v1x;
+        if (std::abs(denom) < 1e-9f) return false;
+        float u = (v2x * v1z - v2z * v1x) / denom;
+        float v = (v0x * v2z - v0z * v2x) / denom;
+        const float eps = 1e-4f;
+        if (u < -eps || v < -eps || u + v > 1.0f + eps) return false;
+        out = a.y + (c.y - a.y) * u + (b.y - a.y) * v;
+        return true;
+    };
+
+    float height = 0;
+    const auto& detail = m_detail[polygon];
+    for (std::size_t i = 0; i + 2 < detail.size(); i += 3) {
+        if (height_in(detail[i], detail[i + 1], detail[i + 2], height)) {
+            return height;
+        }
+    }
+
+    const auto& poly = m_polygons[polygon];
+    if (poly.vertices.size() >= 3) {
+        const auto& v0 = m_vertices[poly.vertices[0]].position;
+        for (std::size_t i = 2; i < poly.vertices.size(); ++i) {
+            if (height_in(v0, m_vertices[poly.vertices[i - 1]].position,
+                          m_vertices[poly.vertices[i]].position, height)) {
+                return height;
             }
         }
-        m_total_area += poly.area;
     }
+
+    return poly.center.y;
 }
 
 const NavPolygon* NavMesh::polygon(std::uint32_t index) const {
@@ -235,13 +392,50 @@ bool NavMesh::find_nearest_point(const void_math::Vec3& position,
     float best_dist = std::numeric_limits<float>::max();
     bool found = false;
 
-    for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
+    auto consider = [&](std::uint32_t pi) {
         float dist = point_to_polygon_distance(position, pi);
         if (dist < best_dist) {
             best_dist = dist;
             out_polygon = pi;
             found = true;
         }
+    };
+
+    if (m_grid_cell_size > 0) {
+        // Search rings of grid cells outwards until no closer polygon can exist
+        const float cs = m_grid_cell_size;
+        std::int32_t cx = cell_coord(position.x, cs);
+        std::int32_t cz = cell_coord(position.z, cs);
+        std::int32_t max_ring = std::max({std::abs(cx - cell_coord(m_bounds_min.x, cs)),
+                                          std::abs(cx - cell_coord(m_bounds_max.x, cs)),
+                                          std::abs(cz - cell_coord(m_bounds_min.z, cs)),
+                                          std::abs(cz - cell_coord(m_bounds_max.z, cs))});
+
+        auto visit = [&](std::int32_t x, std::int32_t z) {
+            auto it = m_poly_grid.find(cell_key(x, z));
+            if (it == m_poly_grid.end()) return;
+            for (std::uint32_t pi : it->second) {
+                consider(pi);
+            }
+        };
+
+        for (std::int32_t ring = 0; ring <= max_ring; ++ring) {
+            if (found && static_cast<float>(ring - 1) * cs > best_dist) break;
+            for (std::int32_t dz = -ring; dz <= ring; ++dz) {
+                if (dz == -ring || dz == ring) {
+                    for (std::int32_t dx = -ring; dx <= ring; ++dx) {
+                        visit(cx + dx, cz + dz);
+                    }
+                } else {
+                    visit(cx - ring, cz + dz);
+                    visit(cx + ring, cz + dz);
+                }
+            }
+        }
+    } else {
+        for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
+            consider(pi);
+        }
     }
 
     if (found) {
@@ -250,10 +444,9 @@ bool NavMesh::find_nearest_point(const void_math::Vec3& position,
 
         // Check if point is inside polygon
         if (is_point_in_polygon(position, out_polygon)) {
-            // Just project Y to the polygon plane
+            // Project Y onto the polygon surface
             out_nearest = position;
-            // Simple Y projection using polygon center
-            out_nearest.y = poly.center.y;
+            out_nearest.y = polygon_height(out_polygon, position);
         } else {
             // Find closest point on polygon edges
             float closest_dist = std::numeric_limits<float>::max();
@@ -370,12 +563,33 @@ bool NavMesh::is_point_in_polygon(const void_math::Vec3& point,
 }
 
 std::int32_t NavMesh::find_polygon_containing(const void_math::Vec3& point) const {
-    for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
-        if (is_point_in_polygon(point, pi)) {
-            return static_cast<std::int32_t>(pi);
+    // Where layers overlap, prefer the polygon whose surface is closest in height
+    std::int32_t best = -1;
+    float best_dy = std::numeric_limits<float>::max();
+    auto consider = [&](std::uint32_t pi) {
+        if (!is_point_in_polygon(point, pi)) return;
+        float dy = std::abs(polygon_height(pi, point) - point.y);
+        if (dy < best_dy) {
+            best_dy = dy;
+            best = static_cast<std::int32_t>(pi);
+        }
+    };
+
+    if (m_grid_cell_size > 0) {
+        auto it = m_poly_grid.find(cell_key(cell_coord(point.x, m_grid_cell_size),
+                                            cell_coord(point.z, m_grid_cell_size)));
+        if (it != m_poly_grid.end()) {
+            for (std::uint32_t pi : it->second) {
+                consider(pi);
+            }
+        }
+    } else {
+        for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
+            consider(pi);
         }
     }
-    return -1;
+
+    return best;
 }
 
 bool NavMesh::raycast(const void_math::Vec3& start,
@@ -390,7 +604,7 @@ bool NavMesh::raycast(const void_math::Vec3& start,
     float ray_length = vec3_length(dir);
     if (ray_length < 1e-6f) return false;
 
-    for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
+    auto test_polygon = [&](std::uint32_t pi) {
         const auto& poly = m_polygons[pi];
 
         for (std::size_t i = 0; i < poly.vertices.size(); ++i) {
@@ -421,11 +635,183 @@ bool NavMesh::raycast(const void_math::Vec3& start,
                 }
             }
         }
+    };
+
+    if (m_grid_cell_size <= 0) {
+        for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
+            test_polygon(pi);
+        }
+        return hit;
+    }
+
+    // Walk the grid cells the segment crosses; any edge it intersects belongs
+    // to a polygon indexed in one of them. Stop once a hit lies in a cell
+    // that has already been tested.
+    const float cs = m_grid_cell_size;
+    std::int32_t x = cell_coord(start.x, cs);
+    std::int32_t z = cell_coord(start.z, cs);
+    const std::int32_t end_x = cell_coord(end.x, cs);
+    const std::int32_t end_z = cell_coord(end.z, cs);
+    const std::int32_t step_x = dir.x > 0 ? 1 : -1;
+    const std::int32_t step_z = dir.z > 0 ? 1 : -1;
+    const float inf = std::numeric_limits<float>::max();
+    const float delta_x = std::abs(dir.x) > 1e-9f ? cs / std::abs(dir.x) : inf;
+    const float delta_z = std::abs(dir.z) > 1e-9f ? cs / std::abs(dir.z) : inf;
+    float next_x = std::abs(dir.x) > 1e-9f
+        ? ((step_x > 0 ? static_cast<float>(x + 1) * cs : static_cast<float>(x) * cs) - start.x) / dir.x : inf;
+    float next_z = std::abs(dir.z) > 1e-9f
+        ? ((step_z > 0 ? static_cast<float>(z + 1) * cs : static_cast<float>(z) * cs) - start.z) / dir.z : inf;
+
+    for (;;) {
+        auto it = m_poly_grid.find(cell_key(x, z));
+        if (it != m_poly_grid.end()) {
+            for (std::uint32_t pi : it->second) {
+                test_polygon(pi);
+            }
+        }
+
+        float cell_exit = std::min(next_x, next_z);
+        if (hit && closest_t <= cell_exit) break;
+        if ((x == end_x && z == end_z) || cell_exit > 1.0f) break;
+
+        if (next_x < next_z) {
+            x += step_x;
+            next_x += delta_x;
+        } else {
+            z += step_z;
+            next_z += delta_z;
+        }
     }
 
     return hit;
 }
 
+// =============================================================================
+// Spatial Index
+// =============================================================================
+
+void NavMesh::build_spatial_index(float cell_size) {
+    m_poly_grid.clear();
+
+    if (cell_size <= 0) {
+        // Aim for a handful of polygons per cell
+        float area = 0;
+        std::size_t live = 0;
+        for (const auto& poly : m_polygons) {
+            if (poly.vertices.size() >= 3) {
+                area += poly.area;
+                ++live;
+            }
+        }
+        cell_size = live > 0 ? std::max(std::sqrt(area / static_cast<float>(live)) * 2.0f, 0.5f) : 0.0f;
+    }
+
+    m_grid_cell_size = cell_size;
+    if (m_grid_cell_size <= 0) return;
+
+    for (std::uint32_t pi = 0; pi < m_polygons.size(); ++pi) {
+        index_polygon(pi);
+    }
+}
+
+bool NavMesh::polygon_cells(std::uint32_t polygon, std::int32_t& x0, std::int32_t& z0,
+                            std::int32_t& x1, std::int32_t& z1) const {
+    const auto& poly = m_polygons[polygon];
+    if (poly.vertices.empty()) return false;
+
+    const auto& first = m_vertices[poly.vertices[0]].position;
+    float min_x = first.x, max_x = first.x, min_z = first.z, max_z = first.z;
+    for (std::uint32_t vi : poly.vertices) {
+        const auto& p = m_vertices[vi].position;
+        min_x = std::min(min_x, p.x);
+        max_x = std::max(max_x, p.x);
+        min_z = std::min(min_z, p.z);
+        max_z = std::max(max_z, p.z);
+    }
+
+    x0 = cell_coord(min_x, m_grid_cell_size);
+    z0 = cell_coord(min_z, m_grid_cell_size);
+    x1 = cell_coord(max_x, m_grid_cell_size);
+    z1 = cell_coord(max_z, m_grid_cell_size);
+    return true;
+}
+
+void NavMesh::index_polygon(std::uint32_t polygon) {
+    std::int32_t x0, z0, x1, z1;
+    if (!polygon_cells(polygon, x0, z0, x1, z1)) return;
+
+    for (std::int32_t z = z0; z <= z1; ++z) {
+        for (std::int32_t x = x0; x <= x1; ++x) {
+            m_poly_grid[cell_key(x, z)].push_back(polygon);
+        }
+    }
+}
+
+void NavMesh::unindex_polygon(std::uint32_t polygon) {
+    std::int32_t x0, z0, x1, z1;
+    if (m_grid_cell_size <= 0 || !polygon_cells(polygon, x0, z0, x1, z1)) return;
+
+    for (std::int32_t z = z0; z <= z1; ++z) {
+        for (std::int32_t x = x0; x <= x1; ++x) {
+            auto it = m_poly_grid.find(cell_key(x, z));
+            if (it == m_poly_grid.end()) continue;
+
+            auto& cell = it->second;
+            auto pos = std::find(cell.begin(), cell.end(), polygon);
+            if (pos != cell.end()) {
+                *pos = cell.back();
+                cell.pop_back();
+            }
+            if (cell.empty()) {
+                m_poly_grid.erase(it);
+            }
+        }
+    }
+}
+
+void NavMesh::find_nearest_points(std::span<const void_math::Vec3> positions,
+                                  std::span<NearestPolygonResult> out) const {
+    const std::size_t count = std::min(positions.size(), out.size());
+
+    // Visit queries in grid order so neighboring agents reuse warm cells
+    std::vector<std::uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+    if (m_grid_cell_size > 0) {
+        std::vector<std::uint64_t> keys(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            keys[i] = cell_key(cell_coord(positions[i].z, m_grid_cell_size),
+                               cell_coord(positions[i].x, m_grid_cell_size));
+        }
+        std::sort(order.begin(), order.end(),
+                  [&keys](std::uint32_t a, std::uint32_t b) { return keys[a] < keys[b]; });
+    }
+
+    constexpr std::size_t k_chunk = 64;
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for (std::size_t begin = next.fetch_add(k_chunk); begin < count; begin = next.fetch_add(k_chunk)) {
+            std::size_t end = std::min(begin + k_chunk, count);
+            for (std::size_t k = begin; k < end; ++k) {
+                auto& result = out[order[k]];
+                result.found = find_nearest_point(positions[order[k]], result.point, result.polygon);
+            }
+        }
+    };
+
+    // Small batches stay on the calling thread
+    std::size_t worker_count = std::min<std::size_t>(
+        std::max(1u, std::thread::hardware_concurrency()), count / (k_chunk * 4));
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 1; t < worker_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
 void NavMesh::add_off_mesh_connection(const OffMeshConnection& connection) {
     m_off_mesh_connections.push_back(connection);
 }
@@ -449,7 +835,13 @@ float NavMesh::area_cost(AreaType area) const {
 void NavMesh::clear() {
     m_vertices.clear();
     m_polygons.clear();
+    m_detail.clear();
     m_off_mesh_connections.clear();
+    m_tiles.clear();
+    m_free_vertices.clear();
+    m_free_polygons.clear();
+    m_poly_grid.clear();
+    m_grid_cell_size = 0;
     m_total_area = 0;
     m_bounds_min = {};
     m_bounds_max = {};
@@ -474,7 +866,7 @@ std::vector<std::uint8_t> NavMesh::serialize() const {
 
     // Magic number and version
     write_u32(0x4E41564D); // "NAVM"
-    write_u32(1);          // Version
+    write_u32(2);          // Version
 
     // Bounds
     write_vec3(m_bounds_min);
@@ -507,6 +899,14 @@ std::vector<std::uint8_t> NavMesh::serialize() const {
         write_float(poly.cost);
     }
 
+    // Detail triangles
+    for (const auto& detail : m_detail) {
+        write_u32(static_cast<std::uint32_t>(detail.size()));
+        for (const auto& v : detail) {
+            write_vec3(v);
+        }
+    }
+
     // Off-mesh connections
     write_u32(static_cast<std::uint32_t>(m_off_mesh_connections.size()));
     for (const auto& conn : m_off_mesh_connections) {
@@ -529,6 +929,40 @@ std::vector<std::uint8_t> NavMesh::serialize() const {
     // Total area
     write_float(m_total_area);
 
+    // Tiles
+    write_u32(static_cast<std::uint32_t>(m_tiles.size()));
+    for (const auto& [key, tile] : m_tiles) {
+        write_u32(static_cast<std::uint32_t>(tile.x));
+        write_u32(static_cast<std::uint32_t>(tile.z));
+        write_vec3(tile.bounds_min);
+        write_vec3(tile.bounds_max);
+        write_float(tile.link_climb);
+        write_u32(static_cast<std::uint32_t>(tile.polygons.size()));
+        for (auto pi : tile.polygons) {
+            write_u32(pi);
+        }
+        write_u32(static_cast<std::uint32_t>(tile.vertices.size()));
+        for (auto vi : tile.vertices) {
+            write_u32(vi);
+        }
+        write_u32(static_cast<std::uint32_t>(tile.border_edges.size()));
+        for (const auto& edge : tile.border_edges) {
+            write_u32(edge.polygon);
+            write_u32(edge.side);
+            write_float(edge.min);
+            write_float(edge.max);
+            write_float(edge.height);
+        }
+    }
+    write_u32(static_cast<std::uint32_t>(m_free_vertices.size()));
+    for (auto vi : m_free_vertices) {
+        write_u32(vi);
+    }
+    write_u32(static_cast<std::uint32_t>(m_free_polygons.size()));
+    for (auto pi : m_free_polygons) {
+        write_u32(pi);
+    }
+
     return data;
 }
 
@@ -564,7 +998,7 @@ bool NavMesh::deserialize(const std::vector<std::uint8_t>& data) {
     if (magic != 0x4E41564D) return false; // "NAVM"
 
     std::uint32_t version = read_u32();
-    if (version != 1) return false;
+    if (version != 1 && version != 2) return false;
 
     // Clear existing data
     clear();
@@ -612,6 +1046,19 @@ bool NavMesh::deserialize(const std::vector<std::uint8_t>& data) {
         m_polygons.push_back(std::move(poly));
     }
 
+    // Detail triangles
+    m_detail.resize(poly_count);
+    if (version >= 2) {
+        for (auto& detail : m_detail) {
+            std::uint32_t detail_count = read_u32();
+            if (offset + static_cast<std::size_t>(detail_count) * 12 > data.size()) return false;
+            detail.reserve(detail_count);
+            for (std::uint32_t d = 0; d < detail_count; ++d) {
+                detail.push_back(read_vec3());
+            }
+        }
+    }
+
     // Off-mesh connections
     std::uint32_t conn_count = read_u32();
     m_off_mesh_connections.reserve(conn_count);
@@ -639,6 +1086,48 @@ bool NavMesh::deserialize(const std::vector<std::uint8_t>& data) {
     // Total area
     m_total_area = read_float();
 
+    // Tiles
+    if (version >= 2) {
+        std::uint32_t tile_count = read_u32();
+        for (std::uint32_t t = 0; t < tile_count && offset < data.size(); ++t) {
+            TileRecord tile;
+            tile.x = static_cast<std::int32_t>(read_u32());
+            tile.z = static_cast<std::int32_t>(read_u32());
+            tile.bounds_min = read_vec3();
+            tile.bounds_max = read_vec3();
+            tile.link_climb = read_float();
+            std::uint32_t count = read_u32();
+            for (std::uint32_t i = 0; i < count && offset < data.size(); ++i) {
+                tile.polygons.push_back(read_u32());
+            }
+            count = read_u32();
+            for (std::uint32_t i = 0; i < count && offset < data.size(); ++i) {
+                tile.vertices.push_back(read_u32());
+            }
+            count = read_u32();
+            for (std::uint32_t i = 0; i < count && offset < data.size(); ++i) {
+                NavMeshTile::BorderEdge edge;
+                edge.polygon = read_u32();
+                edge.side = static_cast<std::uint8_t>(read_u32());
+                edge.min = read_float();
+                edge.max = read_float();
+                edge.height = read_float();
+                tile.border_edges.push_back(edge);
+            }
+            m_tiles.insert_or_assign(tile_key(tile.x, tile.z), std::move(tile));
+        }
+        std::uint32_t count = read_u32();
+        for (std::uint32_t i = 0; i < count && offset < data.size(); ++i) {
+            m_free_vertices.push_back(read_u32());
+        }
+        count = read_u32();
+        for (std::uint32_t i = 0; i < count && offset < data.size(); ++i) {
+            m_free_polygons.push_back(read_u32());
+        }
+    }
+
+    build_spatial_index();
+
     return offset <= data.size();
 }
 
@@ -662,13 +1151,57 @@ void NavMesh::update_bounds() {
     }
 }
 
+void NavMesh::expand_bounds(const void_math::Vec3& position) {
+    if (m_vertices.size() <= 1 && m_tiles.empty()) {
+        m_bounds_min = position;
+        m_bounds_max = position;
+        return;
+    }
+
+    m_bounds_min.x = std::min(m_bounds_min.x, position.x);
+    m_bounds_min.y = std::min(m_bounds_min.y, position.y);
+    m_bounds_min.z = std::min(m_bounds_min.z, position.z);
+    m_bounds_max.x = std::max(m_bounds_max.x, position.x);
+    m_bounds_max.y = std::max(m_bounds_max.y, position.y);
+    m_bounds_max.z = std::max(m_bounds_max.z, position.z);
+}
+
+void NavMesh::compute_polygon_data(NavPolygon& poly) const {
+    void_math::Vec3 center{};
+    for (std::uint32_t vi : poly.vertices) {
+        if (vi < m_vertices.size()) {
+            center.x += m_vertices[vi].position.x;
+            center.y += m_vertices[vi].position.y;
+            center.z += m_vertices[vi].position.z;
+        }
+    }
+    if (!poly.vertices.empty()) {
+        float inv_count = 1.0f / static_cast<float>(poly.vertices.size());
+        center.x *= inv_count;
+        center.y *= inv_count;
+        center.z *= inv_count;
+    }
+    poly.center = center;
+
+    // Area is the sum of the fan triangle areas
+    poly.area = 0;
+    if (poly.vertices.size() >= 3) {
+        const auto& v0 = m_vertices[poly.vertices[0]].position;
+        for (std::size_t i = 2; i < poly.vertices.size(); ++i) {
+            const auto& v1 = m_vertices[poly.vertices[i - 1]].position;
+            const auto& v2 = m_vertices[poly.vertices[i]].position;
+            poly.area += triangle_area(v0, v1, v2);
+        }
+    }
+}
+
 float NavMesh::point_to_polygon_distance(const void_math::Vec3& point,
                                          std::uint32_t polygon_index) const {
     const auto& poly = m_polygons[polygon_index];
 
     // If inside polygon, distance is Y difference
     if (is_point_in_polygon(point, polygon_index)) {
-        return std::abs(point.y - poly.center.y);
+        return std::abs(point.y - polygon_height(polygon_index, point));
     }
 
     // Otherwise, find closest edge
@@ -687,137 +1220,50 @@ float NavMesh::point_to_polygon_distance(const void_math::Vec3& point,
 }
 
 // =============================================================================
-// NavMeshBuilder Implementation
+// NavMeshQuery Implementation
 // =============================================================================
 
-NavMeshBuilder::NavMeshBuilder()
-    : m_config() {
-}
-
-NavMeshBuilder::NavMeshBuilder(const NavMeshBuildConfig& config)
-    : m_config(config) {
-}
-
-void NavMeshBuilder::add_triangle(const void_math::Vec3& a,
-                                  const void_math::Vec3& b,
-                                  const void_math::Vec3& c,
-                                  AreaType area) {
-    InputTriangle tri;
-    tri.v[0] = a;
-    tri.v[1] = b;
-    tri.v[2] = c;
-    tri.area = area;
-    m_triangles.push_back(tri);
-}
+struct NavMeshQuery::Search {
+    enum class State : std::uint8_t { Searching, Found, Exhausted, Limited, Invalid };
 
-void NavMeshBuilder::add_mesh(const std::vector<void_math::Vec3>& vertices,
-                              const std::vector<std::uint32_t>& indices,
-                              AreaType area) {
-    for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
-        add_triangle(vertices[indices[i]],
-                    vertices[indices[i + 1]],
-                    vertices[indices[i + 2]],
-                    area);
-    }
-}
-
-void NavMeshBuilder::add_box_obstacle(const void_math::Vec3& min,
-                                      const void_math::Vec3& max) {
-    Obstacle obs;
-    obs.type = Obstacle::Type::Box;
-    obs.min = min;
-    obs.max = max;
-    m_obstacles.push_back(obs);
-}
-
-void NavMeshBuilder::add_cylinder_obstacle(const void_math::Vec3& center,
-                                           float radius,
-                                           float height) {
-    Obstacle obs;
-    obs.type = Obstacle::Type::Cylinder;
-    obs.min = center;
-    obs.radius = radius;
-    obs.height = height;
-    m_obstacles.push_back(obs);
-}
-
-void NavMeshBuilder::mark_area(const void_math::Vec3& /*min*/,
-                               const void_math::Vec3& /*max*/,
-                               AreaType /*area*/) {
-    // Mark triangles in area with specific type
-    // Implementation would modify triangle areas
-}
-
-void NavMeshBuilder::mark_convex_area(const std::vector<void_math::Vec3>& /*vertices*/,
-                                      float /*min_height*/,
-                                      float /*max_height*/,
-                                      AreaType /*area*/) {
-    // Mark triangles in convex volume
-}
-
-std::unique_ptr<NavMesh> NavMeshBuilder::build() {
-    auto mesh = std::make_unique<NavMesh>();
-
-    if (m_triangles.empty()) {
-        return mesh;
-    }
-
-    // Simple navmesh building: use input triangles directly
-    // In production, would do proper voxelization and mesh simplification
-
-    // Add vertices (deduplicate)
-    std::vector<void_math::Vec3> unique_verts;
-    auto find_or_add_vertex = [&](const void_math::Vec3& v) -> std::uint32_t {
-        const float epsilon = 0.001f;
-        for (std::size_t i = 0; i < unique_verts.size(); ++i) {
-            if (std::abs(unique_verts[i].x - v.x) < epsilon &&
-                std::abs(unique_verts[i].y - v.y) < epsilon &&
-                std::abs(unique_verts[i].z - v.z) < epsilon) {
-                return static_cast<std::uint32_t>(i);
-            }
-        }
-        unique_verts.push_back(v);
-        return static_cast<std::uint32_t>(unique_verts.size() - 1);
+    struct Node {
+        float g_cost{0};
+        std::uint32_t parent{NavClusterGraph::k_invalid};
+        bool closed{false};
     };
 
-    for (const auto& v : unique_verts) {
-        mesh->add_vertex(v);
-    }
-
-    // Add triangles as polygons
-    for (const auto& tri : m_triangles) {
-        // Check slope
-        auto ab = vec3_subtract(tri.v[1], tri.v[0]);
-        auto ac = vec3_subtract(tri.v[2], tri.v[0]);
-        auto normal = vec3_normalize(vec3_cross(ab, ac));
+    struct OpenEntry {
+        float f_cost{0};
+        float g_cost{0};
+        std::uint32_t polygon{0};
 
-        float slope_angle = std::acos(std::abs(normal.y)) * (180.0f / 3.14159f);
-        if (slope_angle > m_config.agent_max_slope) {
-            continue;  // Skip steep triangles
+        bool operator>(const OpenEntry& other) const {
+            return f_cost > other.f_cost;
         }
+    };
 
-        std::uint32_t i0 = find_or_add_vertex(tri.v[0]);
-        std::uint32_t i1 = find_or_add_vertex(tri.v[1]);
-        std::uint32_t i2 = find_or_add_vertex(tri.v[2]);
+    void_math::Vec3 start{};
+    void_math::Vec3 end{};
+    std::uint32_t start_poly{0};
+    std::uint32_t end_poly{0};
+    std::size_t max_nodes{0};
+    std::size_t expanded{0};
+    State state{State::Invalid};
 
-        // Re-add vertices if mesh is empty
-        while (mesh->vertex_count() < unique_verts.size()) {
-            mesh->add_vertex(unique_verts[mesh->vertex_count()]);
-        }
+    // Clusters the search may enter (sorted); empty = whole mesh
+    std::vector<std::uint32_t> corridor;
+    bool corridor_cached{false};
 
-        mesh->add_polygon({i0, i1, i2}, static_cast<std::uint32_t>(tri.area));
-    }
+    std::vector<OpenEntry> open;
+    std::unordered_map<std::uint32_t, Node> nodes;
+    std::uint32_t closest_poly{0};
+    float closest_h{std::numeric_limits<float>::max()};
+};
 
-    mesh->build_connectivity();
-    mesh->calculate_polygon_data();
-
-    return mesh;
+void NavMeshQuery::SearchDeleter::operator()(Search* search) const {
+    delete search;
 }
 
-// =============================================================================
-// NavMeshQuery Implementation
-// =============================================================================
-
 NavMeshQuery::NavMeshQuery(const INavMesh* navmesh)
     : m_navmesh(navmesh) {
 }
@@ -825,43 +1271,114 @@ NavMeshQuery::NavMeshQuery(const INavMesh* navmesh)
 PathResult NavMeshQuery::find_path(const void_math::Vec3& start,
                                    const void_math::Vec3& end,
                                    const NavAgentConfig& /*agent*/) const {
-    PathResult result;
+    // Node storage is kept per thread so repeated queries don't reallocate
+    thread_local SearchHandle scratch;
 
-    if (!m_navmesh) {
-        return result;
-    }
+    scratch = begin_search(start, end, 0, std::move(scratch));
+    continue_search(*scratch, std::numeric_limits<std::size_t>::max());
+    return finish_search(*scratch);
+}
 
-    // Find start and end polygons
-    void_math::Vec3 start_nearest, end_nearest;
-    std::uint32_t start_poly, end_poly;
+PathResult NavMeshQuery::find_partial_path(const void_math::Vec3& start,
+                                           const void_math::Vec3& end,
+                                           std::size_t max_nodes,
+                                           const NavAgentConfig& /*agent*/) const {
+    thread_local SearchHandle scratch;
+
+    scratch = begin_search(start, end, max_nodes, std::move(scratch));
+    continue_search(*scratch, std::numeric_limits<std::size_t>::max());
+    return finish_search(*scratch);
+}
+
+NavMeshQuery::SearchHandle NavMeshQuery::begin_search(const void_math::Vec3& start,
+                                                      const void_math::Vec3& end,
+                                                      std::size_t max_nodes,
+                                                      SearchHandle reuse) const {
+    SearchHandle search = reuse ? std::move(reuse) : SearchHandle(new Search());
+    search->max_nodes = max_nodes;
+    search->corridor.clear();
+    search->corridor_cached = false;
+    search->state = Search::State::Invalid;
+    search->open.clear();
+    search->nodes.clear();
+
+    if (!m_navmesh ||
+        !m_navmesh->find_nearest_point(start, search->start, search->start_poly) ||
+        !m_navmesh->find_nearest_point(end, search->end, search->end_poly)) {
+        return search;
+    }
 
-    if (!m_navmesh->find_nearest_point(start, start_nearest, start_poly) ||
-        !m_navmesh->find_nearest_point(end, end_nearest, end_poly)) {
-        return result;
+    select_corridor(*search);
+    if (search->state == Search::State::Exhausted) {
+        return search;
     }
 
-    // A* search
-    std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> open_set;
-    std::unordered_map<std::uint32_t, float> g_score;
-    std::unordered_map<std::uint32_t, std::uint32_t> came_from;
+    restart_search(*search);
+    return search;
+}
 
-    AStarNode start_node;
-    start_node.polygon = start_poly;
-    start_node.g_cost = 0;
-    start_node.h_cost = heuristic(start_nearest, end_nearest);
-    open_set.push(start_node);
-    g_score[start_poly] = 0;
+bool NavMeshQuery::continue_search(Search& search,
+                                   std::size_t max_iterations,
+                                   std::size_t* out_iterations) const {
+    std::size_t iterations = 0;
 
-    while (!open_set.empty()) {
-        AStarNode current = open_set.top();
-        open_set.pop();
+    while (search.state == Search::State::Searching && iterations < max_iterations) {
+        if (search.open.empty()) {
+            if (search.corridor.empty()) {
+                search.state = Search::State::Exhausted;
+                break;
+            }
 
-        if (current.polygon == end_poly) {
-            // Reconstruct path
-            auto polygon_path = reconstruct_path(came_from, current.polygon);
-            string_pull(polygon_path, start_nearest, end_nearest, result);
-            result.complete = true;
-            return result;
+            // The corridor didn't connect start and goal: a cached corridor may
+            // belong to another part of the start cluster, and filters can
+            // block it. Retry with a fresh corridor, then with the whole mesh.
+            if (search.corridor_cached && m_clusters) {
+                auto fresh = m_clusters->find_corridor(*m_navmesh, search.start_poly, search.end_poly);
+                if (fresh.empty()) {
+                    search.state = Search::State::Exhausted;
+                    break;
+                }
+                if (m_corridor_cache) {
+                    m_corridor_cache->store(m_clusters->cluster_of(search.start_poly),
+                                            m_clusters->cluster_of(search.end_poly), fresh);
+                }
+                std::sort(fresh.begin(), fresh.end());
+                search.corridor = fresh == search.corridor
+                    ? std::vector<std::uint32_t>{} : std::move(fresh);
+                search.corridor_cached = false;
+            } else {
+                search.corridor.clear();
+            }
+            restart_search(search);
+            continue;
+        }
+
+        std::pop_heap(search.open.begin(), search.open.end(), std::greater<>{});
+        Search::OpenEntry current = search.open.back();
+        search.open.pop_back();
+
+        auto& node = search.nodes[current.polygon];
+        if (node.closed || current.g_cost > node.g_cost) {
+            continue;
+        }
+        node.closed = true;
+        ++iterations;
+        ++search.expanded;
+
+        if (current.polygon == search.end_poly) {
+            search.state = Search::State::Found;
+            break;
+        }
+
+        float h_cost = current.f_cost - current.g_cost;
+        if (h_cost < search.closest_h) {
+            search.closest_h = h_cost;
+            search.closest_poly = current.polygon;
+        }
+
+        if (search.max_nodes > 0 && search.expanded >= search.max_nodes) {
+            search.state = Search::State::Limited;
+            break;
         }
 
         const NavPolygon* poly = m_navmesh->polygon(current.polygon);
@@ -869,6 +1386,11 @@ PathResult NavMeshQuery::find_path(const void_math::Vec3& start,
 
         for (std::uint32_t neighbor : poly->neighbors) {
             if (m_filter && !m_filter(neighbor)) continue;
+            if (!search.corridor.empty() &&
+                !std::binary_search(search.corridor.begin(), search.corridor.end(),
+                                    m_clusters->cluster_of(neighbor))) {
+                continue;
+            }
 
             const NavPolygon* neighbor_poly = m_navmesh->polygon(neighbor);
             if (!neighbor_poly) continue;
@@ -878,35 +1400,92 @@ PathResult NavMeshQuery::find_path(const void_math::Vec3& start,
 
             float tentative_g = current.g_cost + edge_cost;
 
-            auto it = g_score.find(neighbor);
-            if (it == g_score.end() || tentative_g < it->second) {
-                came_from[neighbor] = current.polygon;
-                g_score[neighbor] = tentative_g;
-
-                AStarNode next;
-                next.polygon = neighbor;
-                next.parent = current.polygon;
-                next.g_cost = tentative_g;
-                next.h_cost = heuristic(neighbor_poly->center, end_nearest);
-                open_set.push(next);
+            auto [it, inserted] = search.nodes.try_emplace(neighbor);
+            if (!inserted && (it->second.closed || tentative_g >= it->second.g_cost)) {
+                continue;
             }
+            it->second.g_cost = tentative_g;
+            it->second.parent = current.polygon;
+
+            search.open.push_back({tentative_g + heuristic(neighbor_poly->center, search.end),
+                                   tentative_g, neighbor});
+            std::push_heap(search.open.begin(), search.open.end(), std::greater<>{});
         }
     }
 
-    // No path found
-    result.partial = true;
-    return result;
+    if (out_iterations) {
+        *out_iterations = iterations;
+    }
+    return search.state != Search::State::Searching;
 }
 
-PathResult NavMeshQuery::find_partial_path(const void_math::Vec3& start,
-                                           const void_math::Vec3& end,
-                                           std::size_t max_nodes,
-                                           const NavAgentConfig& agent) const {
-    // Same as find_path but with node limit
+PathResult NavMeshQuery::finish_search(const Search& search) const {
     PathResult result;
-    // Implementation similar to find_path with iteration limit
-    (void)max_nodes;
-    return find_path(start, end, agent);
+
+    switch (search.state) {
+        case Search::State::Found: {
+            auto polygon_path = reconstruct_path(search, search.end_poly);
+            string_pull(polygon_path, search.start, search.end, result);
+            result.complete = true;
+            break;
+        }
+        case Search::State::Limited: {
+            auto polygon_path = reconstruct_path(search, search.closest_poly);
+            const NavPolygon* closest = m_navmesh->polygon(search.closest_poly);
+            string_pull(polygon_path, search.start,
+                        closest ? closest->center : search.start, result);
+            result.partial = true;
+            break;
+        }
+        case Search::State::Exhausted:
+            // No path found
+            result.partial = true;
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+void NavMeshQuery::select_corridor(Search& search) const {
+    search.state = Search::State::Searching;
+    if (!m_clusters) return;
+
+    std::uint32_t start_cluster = m_clusters->cluster_of(search.start_poly);
+    std::uint32_t goal_cluster = m_clusters->cluster_of(search.end_poly);
+    if (start_cluster == NavClusterGraph::k_invalid ||
+        goal_cluster == NavClusterGraph::k_invalid ||
+        start_cluster == goal_cluster) {
+        return;
+    }
+
+    if (m_corridor_cache &&
+        m_corridor_cache->find(start_cluster, goal_cluster, search.corridor)) {
+        search.corridor_cached = true;
+    } else {
+        search.corridor = m_clusters->find_corridor(*m_navmesh, search.start_poly, search.end_poly);
+        if (search.corridor.empty()) {
+            search.state = Search::State::Exhausted;
+            return;
+        }
+        if (m_corridor_cache) {
+            m_corridor_cache->store(start_cluster, goal_cluster, search.corridor);
+        }
+    }
+    std::sort(search.corridor.begin(), search.corridor.end());
+}
+
+void NavMeshQuery::restart_search(Search& search) const {
+    search.open.clear();
+    search.nodes.clear();
+    search.expanded = 0;
+    search.closest_poly = search.start_poly;
+    search.closest_h = std::numeric_limits<float>::max();
+    search.state = Search::State::Searching;
+
+    search.nodes[search.start_poly] = Search::Node{};
+    search.open.push_back({heuristic(search.start, search.end), 0.0f, search.start_poly});
 }
 
 void NavMeshQuery::smooth_path(PathResult& path) const {
@@ -973,14 +1552,15 @@ float NavMeshQuery::heuristic(const void_math::Vec3& from, const void_math::Vec3
     return vec3_distance(from, to);
 }
 
-std::vector<std::uint32_t> NavMeshQuery::reconstruct_path(
-    const std::unordered_map<std::uint32_t, std::uint32_t>& came_from,
-    std::uint32_t current) const {
+std::vector<std::uint32_t> NavMeshQuery::reconstruct_path(const Search& search,
+                                                         std::uint32_t current) const {
     std::vector<std::uint32_t> path;
     path.push_back(current);
 
-    while (came_from.find(current) != came_from.end()) {
-        current = came_from.at(current);
+    for (auto it = search.nodes.find(current);
+         it != search.nodes.end() && it->second.parent != NavClusterGraph::k_invalid;
+         it = search.nodes.find(current)) {
+        current = it->second.parent;
         path.push_back(current);
     }
 
@@ -1167,17 +1747,44 @@ void NavAgent::update(float dt, NavMeshQuery& query) {
         auto result = query.find_path(m_position, m_destination, m_config);
         if (result.complete || result.partial) {
             query.smooth_path(result);
-            m_path.set_result(std::move(result));
-            if (m_on_path_found) {
-                m_on_path_found(true);
-            }
-        } else {
-            if (m_on_path_failed) {
-                m_on_path_failed(false);
-            }
         }
-        m_path_pending = false;
+        receive_path(std::move(result));
+    }
+
+    update_movement(dt);
+}
+
+void NavAgent::receive_path(PathResult result) {
+    m_path_pending = false;
+
+    if (result.complete || result.partial) {
+        m_path.set_result(std::move(result));
+        if (m_on_path_found) {
+            m_on_path_found(true);
+        }
+    } else {
+        if (m_on_path_failed) {
+            m_on_path_failed(false);
+        }
     }
+}
+
+void_math::Vec3 NavAgent::desired_velocity() const {
+    if (m_stopped || !m_path.is_valid()) {
+        return {};
+    }
+
+    auto to_target = vec3_subtract(m_path.current_target(), m_position);
+    if (vec3_length(to_target) <= 1e-6f) {
+        return {};
+    }
+    return vec3_scale(vec3_normalize(to_target), m_speed);
+}
+
+void NavAgent::update_movement(float dt) {
+    // Avoidance applies to one update only
+    bool avoid = m_has_avoidance_velocity;
+    m_has_avoidance_velocity = false;
 
     if (m_stopped || !m_path.is_valid()) {
         return;
@@ -1208,6 +1815,11 @@ void NavAgent::update(float dt, NavMeshQuery& query) {
 
     if (dist > 1e-6f) {
         auto desired = vec3_scale(vec3_normalize(to_target), m_speed);
+        if (avoid) {
+            // Avoidance works on the ground plane; keep following the path's slope
+            desired.x = m_avoidance_velocity.x;
+            desired.z = m_avoidance_velocity.z;
+        }
 
         // Accelerate toward desired velocity
         auto accel = vec3_subtract(desired, m_velocity);
@@ -1232,7 +1844,10 @@ void NavAgent::update(float dt, NavMeshQuery& query) {
 // NavigationSystem Implementation
 // =============================================================================
 
-NavigationSystem::NavigationSystem() = default;
+NavigationSystem::NavigationSystem()
+    : m_crowd(std::make_unique<CrowdSystem>()) {
+}
+
 NavigationSystem::~NavigationSystem() = default;
 
 NavMeshId NavigationSystem::add_navmesh(std::unique_ptr<NavMesh> mesh, std::string_view name) {
@@ -1248,7 +1863,16 @@ NavMeshId NavigationSystem::add_navmesh(std::unique_ptr<NavMesh> mesh, std::stri
 }
 
 void NavigationSystem::remove_navmesh(NavMeshId id) {
+    if (id == m_default_navmesh) {
+        // Pending searches reference the mesh being removed
+        m_path_queue.clear();
+        m_path_queue.bind(nullptr);
+        m_path_requests.clear();
+        m_corridor_cache.clear();
+    }
+
     m_navmeshes.erase(id);
+    m_cluster_graphs.erase(id);
     for (auto it = m_navmesh_names.begin(); it != m_navmesh_names.end(); ) {
         if (it->second == id) {
             it = m_navmesh_names.erase(it);
@@ -1286,7 +1910,16 @@ AgentId NavigationSystem::create_agent(const NavAgentConfig& config) {
 }
 
 void NavigationSystem::destroy_agent(AgentId id) {
-    m_agents.erase(id);
+    auto it = m_path_requests.find(id);
+    if (it != m_path_requests.end()) {
+        m_path_queue.cancel(it->second);
+        m_path_requests.erase(it);
+    }
+    auto agent = m_agents.find(id);
+    if (agent != m_agents.end()) {
+        m_crowd->remove_agent(agent->second.get());
+        m_agents.erase(agent);
+    }
 }
 
 NavAgent* NavigationSystem::get_agent(AgentId id) {
@@ -1295,17 +1928,88 @@ NavAgent* NavigationSystem::get_agent(AgentId id) {
 }
 
 NavMeshQuery NavigationSystem::create_query(NavMeshId mesh_id) const {
-    return NavMeshQuery(get_navmesh(mesh_id));
+    NavMeshQuery query(get_navmesh(mesh_id));
+    query.set_cluster_graph(cluster_graph(mesh_id));
+    return query;
+}
+
+const NavClusterGraph* NavigationSystem::cluster_graph(NavMeshId mesh_id) const {
+    auto it = m_cluster_graphs.find(mesh_id);
+    return it != m_cluster_graphs.end() ? it->second.get() : nullptr;
+}
+
+void NavigationSystem::invalidate_region(NavMeshId mesh_id,
+                                         const void_math::Vec3& min,
+                                         const void_math::Vec3& max) {
+    auto* mesh = get_navmesh(mesh_id);
+    auto it = m_cluster_graphs.find(mesh_id);
+    if (mesh && it != m_cluster_graphs.end()) {
+        it->second->update_region(*mesh, min, max);
+    }
+
+    // Cached corridors may cross the changed region
+    m_corridor_cache.clear();
+
+    // Agents whose path crosses the region repath on the next update
+    for (auto& [id, agent] : m_agents) {
+        if (agent->is_stopped() || !agent->has_path()) continue;
+        for (const auto& point : agent->path().points()) {
+            if (point.position.x >= min.x && point.position.x <= max.x &&
+                point.position.z >= min.z && point.position.z <= max.z) {
+                agent->set_destination(agent->destination());
+                break;
+            }
+        }
+    }
 }
 
 void NavigationSystem::update(float dt) {
     auto* default_mesh = get_navmesh(m_default_navmesh);
     if (!default_mesh) return;
 
-    NavMeshQuery query(default_mesh);
+    auto& graph = m_cluster_graphs[m_default_navmesh];
+    if (!graph) {
+        graph = std::make_unique<NavClusterGraph>();
+        graph->build(*default_mesh);
+    }
+    m_path_queue.bind(default_mesh, graph.get(), &m_corridor_cache);
+
+    // Post requests for agents with a new destination; the previous request
+    // is superseded and the agent keeps following its old path meanwhile
+    for (auto& [id, agent] : m_agents) {
+        if (!agent->path_pending()) continue;
+
+        auto it = m_path_requests.find(id);
+        if (it != m_path_requests.end()) {
+            m_path_queue.cancel(it->second);
+        }
+        m_path_requests[id] = m_path_queue.request(agent->position(), agent->destination());
+        agent->mark_path_requested();
+    }
+
+    if (!m_path_requests.empty()) {
+        m_path_queue.process(m_path_budget);
+
+        for (auto it = m_path_requests.begin(); it != m_path_requests.end(); ) {
+            PathResult result;
+            if (!m_path_queue.poll(it->second, result)) {
+                ++it;
+                continue;
+            }
+            auto agent = m_agents.find(it->first);
+            if (agent != m_agents.end()) {
+                agent->second->receive_path(std::move(result));
+            }
+            it = m_path_requests.erase(it);
+        }
+    }
+
+    if (m_crowd->agent_count() > 0) {
+        m_crowd->update(dt);
+    }
 
     for (auto& [id, agent] : m_agents) {
-        agent->update(dt, query);
+        agent->update_movement(dt);
     }
 }
 
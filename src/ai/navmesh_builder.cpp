@@ -0,0 +1,1519 @@
+/// @file navmesh_builder.cpp
+/// @brief Tiled navigation mesh generation for void_ai module
+///
+/// Every tile runs the same voxel pipeline: rasterize input triangles into a
+/// heightfield, filter spans an agent cannot stand on, build the open-span
+/// heightfield, erode it by the agent radius, partition it into monotone
+/// regions, trace and simplify region contours, triangulate and merge them
+/// into convex polygons, and sample a detail mesh for accurate heights.
+/// Tiles carry a border of extra cells so erosion and contours line up with
+/// their neighbors, and they are built independently on worker threads.
+
+#include <void_engine/ai/navmesh.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+
+namespace void_ai {
+
+namespace {
+
+constexpr std::uint8_t k_null_area = static_cast<std::uint8_t>(AreaType::NotWalkable);
+constexpr std::uint16_t k_border_region = 0x8000;
+constexpr std::uint16_t k_null_neighbor = 0xFFFF;
+constexpr std::int32_t k_not_connected = -1;
+constexpr int k_max_height = 0xFFFF;
+constexpr std::size_t k_max_detail_samples = 16;
+constexpr int k_dir_x[4] = {-1, 0, 1, 0};
+constexpr int k_dir_z[4] = {0, 1, 0, -1};
+
+// =============================================================================
+// Heightfield
+// =============================================================================
+
+struct Span {
+    std::uint16_t smin{0};
+    std::uint16_t smax{0};
+    std::uint8_t area{k_null_area};
+};
+
+struct Heightfield {
+    int width{0};
+    int depth{0};
+    float origin_x{0};
+    float origin_y{0};
+    float origin_z{0};
+    float cs{0};
+    float ch{0};
+    std::vector<std::vector<Span>> columns;  ///< Solid spans per cell, sorted by smin
+};
+
+std::uint8_t merge_area(std::uint8_t a, std::uint8_t b) {
+    if (a == k_null_area) return b;
+    if (b == k_null_area) return a;
+    return std::max(a, b);
+}
+
+void add_span(Heightfield& hf, int x, int z, int smin, int smax,
+              std::uint8_t area, int merge_threshold) {
+    auto& column = hf.columns[static_cast<std::size_t>(x + z * hf.width)];
+    Span span{static_cast<std::uint16_t>(smin), static_cast<std::uint16_t>(smax), area};
+
+    std::size_t i = 0;
+    while (i < column.size()) {
+        const Span& cur = column[i];
+        if (cur.smin > span.smax) break;
+        if (cur.smax < span.smin) {
+            ++i;
+            continue;
+        }
+
+        // Overlapping spans merge; the surface on top decides the area
+        int top_delta = static_cast<int>(cur.smax) - static_cast<int>(span.smax);
+        if (std::abs(top_delta) <= merge_threshold) {
+            span.area = merge_area(span.area, cur.area);
+        } else if (top_delta > 0) {
+            span.area = cur.area;
+        }
+        span.smin = std::min(span.smin, cur.smin);
+        span.smax = std::max(span.smax, cur.smax);
+        column.erase(column.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    column.insert(column.begin() + static_cast<std::ptrdiff_t>(i), span);
+}
+
+// Sutherland-Hodgman clip against an axis-aligned plane (axis 0 = x, 2 = z)
+void clip_polygon(const std::vector<void_math::Vec3>& in,
+                  std::vector<void_math::Vec3>& out,
+                  int axis, float value, bool keep_above) {
+    out.clear();
+    float sign = keep_above ? 1.0f : -1.0f;
+    auto distance = [&](const void_math::Vec3& v) {
+        return ((axis == 0 ? v.x : v.z) - value) * sign;
+    };
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        const auto& a = in[i];
+        const auto& b = in[(i + 1) % in.size()];
+        float da = distance(a);
+        float db = distance(b);
+
+        if (da >= 0) {
+            out.push_back(a);
+        }
+        if ((da >= 0) != (db >= 0)) {
+            float t = da / (da - db);
+            out.push_back({a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t});
+        }
+    }
+}
+
+void rasterize_triangle(Heightfield& hf, const void_math::Vec3* v,
+                        std::uint8_t area, int merge_threshold) {
+    float min_x = std::min({v[0].x, v[1].x, v[2].x});
+    float max_x = std::max({v[0].x, v[1].x, v[2].x});
+    float min_z = std::min({v[0].z, v[1].z, v[2].z});
+    float max_z = std::max({v[0].z, v[1].z, v[2].z});
+
+    float extent_x = static_cast<float>(hf.width) * hf.cs;
+    float extent_z = static_cast<float>(hf.depth) * hf.cs;
+    if (max_x < hf.origin_x || min_x > hf.origin_x + extent_x ||
+        max_z < hf.origin_z || min_z > hf.origin_z + extent_z) {
+        return;
+    }
+
+    int z0 = std::clamp(static_cast<int>(std::floor((min_z - hf.origin_z) / hf.cs)), 0, hf.depth - 1);
+    int z1 = std::clamp(static_cast<int>(std::floor((max_z - hf.origin_z) / hf.cs)), 0, hf.depth - 1);
+
+    std::vector<void_math::Vec3> tri{v[0], v[1], v[2]};
+    std::vector<void_math::Vec3> tmp, row, cell;
+    float height_limit = k_max_height * hf.ch;
+
+    for (int z = z0; z <= z1; ++z) {
+        float cz = hf.origin_z + static_cast<float>(z) * hf.cs;
+        clip_polygon(tri, tmp, 2, cz, true);
+        clip_polygon(tmp, row, 2, cz + hf.cs, false);
+        if (row.size() < 3) continue;
+
+        float row_min_x = row[0].x;
+        float row_max_x = row[0].x;
+        for (const auto& p : row) {
+            row_min_x = std::min(row_min_x, p.x);
+            row_max_x = std::max(row_max_x, p.x);
+        }
+        int x0 = std::clamp(static_cast<int>(std::floor((row_min_x - hf.origin_x) / hf.cs)), 0, hf.width - 1);
+        int x1 = std::clamp(static_cast<int>(std::floor((row_max_x - hf.origin_x) / hf.cs)), 0, hf.width - 1);
+
+        for (int x = x0; x <= x1; ++x) {
+            float cx = hf.origin_x + static_cast<float>(x) * hf.cs;
+            clip_polygon(row, tmp, 0, cx, true);
+            clip_polygon(tmp, cell, 0, cx + hf.cs, false);
+            if (cell.size() < 3) continue;
+
+            float ymin = cell[0].y;
+            float ymax = cell[0].y;
+            for (const auto& p : cell) {
+                ymin = std::min(ymin, p.y);
+                ymax = std::max(ymax, p.y);
+            }
+            ymin -= hf.origin_y;
+            ymax -= hf.origin_y;
+            if (ymax < 0 || ymin > height_limit) continue;
+
+            int smin = std::clamp(static_cast<int>(std::floor(ymin / hf.ch)), 0, k_max_height - 1);
+            int smax = std::clamp(static_cast<int>(std::ceil(ymax / hf.ch)), smin + 1, k_max_height);
+            add_span(hf, x, z, smin, smax, area, merge_threshold);
+        }
+    }
+}
+
+// Removes spans with too little headroom, on ledges, or on steep steps
+void filter_walkable_spans(Heightfield& hf, int walkable_height, int walkable_climb) {
+    for (int z = 0; z < hf.depth; ++z) {
+        for (int x = 0; x < hf.width; ++x) {
+            auto& column = hf.columns[static_cast<std::size_t>(x + z * hf.width)];
+            for (std::size_t s = 0; s < column.size(); ++s) {
+                Span& span = column[s];
+                if (span.area == k_null_area) continue;
+
+                int bot = span.smax;
+                int top = s + 1 < column.size() ? column[s + 1].smin : k_max_height;
+                if (top - bot < walkable_height) {
+                    span.area = k_null_area;
+                    continue;
+                }
+
+                int min_drop = k_max_height;
+                int reach_min = bot;
+                int reach_max = bot;
+                for (int dir = 0; dir < 4; ++dir) {
+                    int nx = x + k_dir_x[dir];
+                    int nz = z + k_dir_z[dir];
+                    if (nx < 0 || nz < 0 || nx >= hf.width || nz >= hf.depth) {
+                        min_drop = std::min(min_drop, -walkable_climb - 1);
+                        continue;
+                    }
+
+                    const auto& neighbor = hf.columns[static_cast<std::size_t>(nx + nz * hf.width)];
+                    int nbot = -walkable_climb;
+                    int ntop = neighbor.empty() ? k_max_height : neighbor[0].smin;
+                    if (std::min(top, ntop) - std::max(bot, nbot) > walkable_height) {
+                        min_drop = std::min(min_drop, nbot - bot);
+                    }
+
+                    for (std::size_t n = 0; n < neighbor.size(); ++n) {
+                        nbot = neighbor[n].smax;
+                        ntop = n + 1 < neighbor.size() ? neighbor[n + 1].smin : k_max_height;
+                        if (std::min(top, ntop) - std::max(bot, nbot) > walkable_height) {
+                            min_drop = std::min(min_drop, nbot - bot);
+                            if (std::abs(nbot - bot) <= walkable_climb) {
+                                reach_min = std::min(reach_min, nbot);
+                                reach_max = std::max(reach_max, nbot);
+                            }
+                        }
+                    }
+                }
+
+                if (min_drop < -walkable_climb || reach_max - reach_min > walkable_climb) {
+                    span.area = k_null_area;
+                }
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Compact (open span) heightfield
+// =============================================================================
+
+struct CompactSpan {
+    std::uint16_t y{0};     ///< Floor
+    std::uint16_t h{0};     ///< Headroom
+    std::int32_t con[4]{k_not_connected, k_not_connected, k_not_connected, k_not_connected};
+};
+
+struct CompactHeightfield {
+    int width{0};
+    int depth{0};
+    int border{0};
+    float origin_x{0};
+    float origin_y{0};
+    float origin_z{0};
+    float cs{0};
+    float ch{0};
+    std::vector<std::uint32_t> cell_index;
+    std::vector<std::uint32_t> cell_count;
+    std::vector<CompactSpan> spans;
+    std::vector<std::uint8_t> areas;
+    std::vector<std::uint16_t> regions;
+};
+
+CompactHeightfield build_compact(const Heightfield& hf, int walkable_height, int walkable_climb) {
+    CompactHeightfield chf;
+    chf.width = hf.width;
+    chf.depth = hf.depth;
+    chf.origin_x = hf.origin_x;
+    chf.origin_y = hf.origin_y;
+    chf.origin_z = hf.origin_z;
+    chf.cs = hf.cs;
+    chf.ch = hf.ch;
+
+    std::size_t cells = static_cast<std::size_t>(hf.width * hf.depth);
+    chf.cell_index.resize(cells);
+    chf.cell_count.resize(cells);
+
+    for (std::size_t c = 0; c < cells; ++c) {
+        const auto& column = hf.columns[c];
+        chf.cell_index[c] = static_cast<std::uint32_t>(chf.spans.size());
+        for (std::size_t s = 0; s < column.size(); ++s) {
+            if (column[s].area == k_null_area) continue;
+            int top = s + 1 < column.size() ? column[s + 1].smin : k_max_height;
+            CompactSpan span;
+            span.y = column[s].smax;
+            span.h = static_cast<std::uint16_t>(std::clamp(top - static_cast<int>(column[s].smax), 0, k_max_height));
+            chf.spans.push_back(span);
+            chf.areas.push_back(column[s].area);
+        }
+        chf.cell_count[c] = static_cast<std::uint32_t>(chf.spans.size()) - chf.cell_index[c];
+    }
+    chf.regions.assign(chf.spans.size(), 0);
+
+    for (int z = 0; z < chf.depth; ++z) {
+        for (int x = 0; x < chf.width; ++x) {
+            std::size_t c = static_cast<std::size_t>(x + z * chf.width);
+            for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                CompactSpan& span = chf.spans[i];
+                for (int dir = 0; dir < 4; ++dir) {
+                    int nx = x + k_dir_x[dir];
+                    int nz = z + k_dir_z[dir];
+                    if (nx < 0 || nz < 0 || nx >= chf.width || nz >= chf.depth) continue;
+
+                    std::size_t nc = static_cast<std::size_t>(nx + nz * chf.width);
+                    for (std::uint32_t k = chf.cell_index[nc]; k < chf.cell_index[nc] + chf.cell_count[nc]; ++k) {
+                        const CompactSpan& other = chf.spans[k];
+                        int bot = std::max(span.y, other.y);
+                        int top = std::min(span.y + span.h, other.y + other.h);
+                        if (top - bot >= walkable_height &&
+                            std::abs(static_cast<int>(other.y) - static_cast<int>(span.y)) <= walkable_climb) {
+                            span.con[dir] = static_cast<std::int32_t>(k);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return chf;
+}
+
+// Shrinks the walkable area so agent centers keep their radius from walls
+void erode_walkable_area(CompactHeightfield& chf, int radius) {
+    std::vector<std::uint16_t> dist(chf.spans.size(), 0xFFFF);
+
+    for (std::size_t i = 0; i < chf.spans.size(); ++i) {
+        if (chf.areas[i] == k_null_area) {
+            dist[i] = 0;
+            continue;
+        }
+        int walkable_neighbors = 0;
+        for (int dir = 0; dir < 4; ++dir) {
+            std::int32_t n = chf.spans[i].con[dir];
+            if (n != k_not_connected && chf.areas[static_cast<std::size_t>(n)] != k_null_area) {
+                ++walkable_neighbors;
+            }
+        }
+        if (walkable_neighbors != 4) {
+            dist[i] = 0;
+        }
+    }
+
+    // Two chamfer passes: 2 per straight step, 3 per diagonal
+    auto relax = [&dist](std::size_t i, std::int32_t n, int cost) {
+        if (n == k_not_connected) return;
+        int nd = dist[static_cast<std::size_t>(n)] + cost;
+        if (nd < dist[i]) dist[i] = static_cast<std::uint16_t>(nd);
+    };
+    auto diagonal = [&chf](std::int32_t n, int dir) -> std::int32_t {
+        return n == k_not_connected ? k_not_connected : chf.spans[static_cast<std::size_t>(n)].con[dir];
+    };
+
+    for (int z = 0; z < chf.depth; ++z) {
+        for (int x = 0; x < chf.width; ++x) {
+            std::size_t c = static_cast<std::size_t>(x + z * chf.width);
+            for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                const CompactSpan& span = chf.spans[i];
+                relax(i, span.con[0], 2);
+                relax(i, diagonal(span.con[0], 3), 3);
+                relax(i, span.con[3], 2);
+                relax(i, diagonal(span.con[3], 2), 3);
+            }
+        }
+    }
+
+    for (int z = chf.depth - 1; z >= 0; --z) {
+        for (int x = chf.width - 1; x >= 0; --x) {
+            std::size_t c = static_cast<std::size_t>(x + z * chf.width);
+            for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                const CompactSpan& span = chf.spans[i];
+                relax(i, span.con[2], 2);
+                relax(i, diagonal(span.con[2], 1), 3);
+                relax(i, span.con[1], 2);
+                relax(i, diagonal(span.con[1], 0), 3);
+            }
+        }
+    }
+
+    int threshold = radius * 2;
+    for (std::size_t i = 0; i < chf.spans.size(); ++i) {
+        if (dist[i] < threshold) {
+            chf.areas[i] = k_null_area;
+        }
+    }
+}
+
+// =============================================================================
+// Regions
+// =============================================================================
+
+// Monotone sweep partitioning: each row run continues the region above it when
+// that region is its only neighbor, which keeps regions free of holes.
+void build_regions(CompactHeightfield& chf, int min_region_area) {
+    auto& regions = chf.regions;
+    int w = chf.width;
+    int d = chf.depth;
+    int b = chf.border;
+
+    // Each side of the border gets its own id so tile corners survive simplification
+    for (int z = 0; z < d; ++z) {
+        for (int x = 0; x < w; ++x) {
+            std::uint16_t side = x < b ? 1 : x >= w - b ? 2 : z < b ? 3 : z >= d - b ? 4 : 0;
+            if (side == 0) continue;
+            std::size_t c = static_cast<std::size_t>(x + z * w);
+            for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                if (chf.areas[i] != k_null_area) {
+                    regions[i] = k_border_region | side;
+                }
+            }
+        }
+    }
+
+    struct Sweep {
+        std::uint16_t id{0};
+        std::uint16_t ns{0};
+        std::uint16_t nei{0};
+    };
+    std::vector<Sweep> sweeps;
+    std::vector<std::uint16_t> prev;
+    std::uint16_t next_id = 1;
+
+    for (int z = b; z < d - b; ++z) {
+        prev.assign(next_id + 1u, 0);
+        sweeps.assign(1, Sweep{});
+        std::uint16_t rid = 1;
+
+        for (int x = b; x < w - b; ++x) {
+            std::size_t c = static_cast<std::size_t>(x + z * w);
+            for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                if (chf.areas[i] == k_null_area) continue;
+                const CompactSpan& span = chf.spans[i];
+
+                std::uint16_t previd = 0;
+                if (span.con[0] != k_not_connected) {
+                    auto ai = static_cast<std::size_t>(span.con[0]);
+                    if (!(regions[ai] & k_border_region) && chf.areas[ai] == chf.areas[i]) {
+                        previd = regions[ai];
+                    }
+                }
+                if (previd == 0) {
+                    previd = rid++;
+                    sweeps.emplace_back();
+                }
+                regions[i] = previd;
+
+                if (span.con[3] != k_not_connected) {
+                    auto ai = static_cast<std::size_t>(span.con[3]);
+                    std::uint16_t nr = regions[ai];
+                    if (nr != 0 && !(nr & k_border_region) && chf.areas[ai] == chf.areas[i]) {
+                        Sweep& sweep = sweeps[previd];
+                        if (sweep.nei == 0 || sweep.nei == nr) {
+                            sweep.nei = nr;
+                            ++sweep.ns;
+                            ++prev[nr];
+                        } else {
+                            sweep.nei = k_null_neighbor;
+                        }
+                    }
+                }
+            }
+        }
+
+        for (std::uint16_t i = 1; i < rid; ++i) {
+            Sweep& sweep = sweeps[i];
+            if (sweep.nei != k_null_neighbor && sweep.nei != 0 && prev[sweep.nei] == sweep.ns) {
+                sweep.id = sweep.nei;
+            } else {
+                sweep.id = next_id++;
+            }
+        }
+
+        for (int x = b; x < w - b; ++x) {
+            std::size_t c = static_cast<std::size_t>(x + z * w);
+            for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                if (regions[i] > 0 && regions[i] < rid) {
+                    regions[i] = sweeps[regions[i]].id;
+                }
+            }
+        }
+    }
+
+    // Drop specks that neither reach the minimum size nor continue into a neighbor tile
+    std::vector<int> counts(next_id, 0);
+    std::vector<bool> reaches_border(next_id, false);
+    for (std::size_t i = 0; i < chf.spans.size(); ++i) {
+        std::uint16_t r = regions[i];
+        if (r == 0 || (r & k_border_region)) continue;
+        ++counts[r];
+        for (int dir = 0; dir < 4; ++dir) {
+            std::int32_t n = chf.spans[i].con[dir];
+            if (n != k_not_connected && (regions[static_cast<std::size_t>(n)] & k_border_region)) {
+                reaches_border[r] = true;
+            }
+        }
+    }
+    for (auto& r : regions) {
+        if (r != 0 && !(r & k_border_region) && counts[r] < min_region_area && !reaches_border[r]) {
+            r = 0;
+        }
+    }
+}
+
+// =============================================================================
+// Contours
+// =============================================================================
+
+struct ContourVertex {
+    int x{0};
+    int y{0};
+    int z{0};
+    std::uint16_t region{0};  ///< Region across the edge starting here
+    std::size_t raw{0};       ///< Index into the raw contour after simplification
+};
+
+struct Contour {
+    std::vector<ContourVertex> vertices;
+    std::uint16_t region{0};
+    std::uint8_t area{0};
+};
+
+int corner_height(const CompactHeightfield& chf, std::uint32_t i, int dir) {
+    const CompactSpan& span = chf.spans[i];
+    int height = span.y;
+    int dirp = (dir + 1) & 3;
+
+    if (span.con[dir] != k_not_connected) {
+        const CompactSpan& a = chf.spans[static_cast<std::size_t>(span.con[dir])];
+        height = std::max(height, static_cast<int>(a.y));
+        if (a.con[dirp] != k_not_connected) {
+            height = std::max(height, static_cast<int>(chf.spans[static_cast<std::size_t>(a.con[dirp])].y));
+        }
+    }
+    if (span.con[dirp] != k_not_connected) {
+        const CompactSpan& a = chf.spans[static_cast<std::size_t>(span.con[dirp])];
+        height = std::max(height, static_cast<int>(a.y));
+        if (a.con[dir] != k_not_connected) {
+            height = std::max(height, static_cast<int>(chf.spans[static_cast<std::size_t>(a.con[dir])].y));
+        }
+    }
+    return height;
+}
+
+void walk_contour(const CompactHeightfield& chf, int x, int z, std::uint32_t i,
+                  std::vector<std::uint8_t>& flags, std::vector<ContourVertex>& out) {
+    int dir = 0;
+    while (!(flags[i] & (1 << dir))) {
+        ++dir;
+    }
+
+    const int start_dir = dir;
+    const std::uint32_t start = i;
+
+    for (int iter = 0; iter < 40000; ++iter) {
+        if (flags[i] & (1 << dir)) {
+            ContourVertex v;
+            v.x = x;
+            v.y = corner_height(chf, i, dir);
+            v.z = z;
+            switch (dir) {
+                case 0: v.z++; break;
+                case 1: v.x++; v.z++; break;
+                case 2: v.x++; break;
+                default: break;
+            }
+            std::int32_t n = chf.spans[i].con[dir];
+            v.region = n != k_not_connected ? chf.regions[static_cast<std::size_t>(n)] : 0;
+            out.push_back(v);
+
+            flags[i] &= static_cast<std::uint8_t>(~(1 << dir));
+            dir = (dir + 1) & 3;
+        } else {
+            std::int32_t n = chf.spans[i].con[dir];
+            if (n == k_not_connected) return;
+            x += k_dir_x[dir];
+            z += k_dir_z[dir];
+            i = static_cast<std::uint32_t>(n);
+            dir = (dir + 3) & 3;
+        }
+
+        if (i == start && dir == start_dir) break;
+    }
+}
+
+float distance_to_segment_sq(int x, int z, int px, int pz, int qx, int qz) {
+    float dx = static_cast<float>(qx - px);
+    float dz = static_cast<float>(qz - pz);
+    float len = dx * dx + dz * dz;
+    float t = len > 0 ? (static_cast<float>(x - px) * dx + static_cast<float>(z - pz) * dz) / len : 0.0f;
+    t = std::clamp(t, 0.0f, 1.0f);
+    float ex = t * dx - static_cast<float>(x - px);
+    float ez = t * dz - static_cast<float>(z - pz);
+    return ex * ex + ez * ez;
+}
+
+std::vector<ContourVertex> simplify_contour(const std::vector<ContourVertex>& raw,
+                                            float max_error, int max_edge_len) {
+    std::vector<ContourVertex> out;
+    const std::size_t pn = raw.size();
+
+    // Keep every vertex where the neighboring region changes
+    for (std::size_t i = 0; i < pn; ++i) {
+        if (raw[i].region != raw[(i + 1) % pn].region) {
+            ContourVertex v = raw[i];
+            v.raw = i;
+            out.push_back(v);
+        }
+    }
+
+    if (out.empty()) {
+        // Isolated region: seed with its lower-left and upper-right corners
+        std::size_t ll = 0;
+        std::size_t ur = 0;
+        for (std::size_t i = 1; i < pn; ++i) {
+            if (raw[i].x < raw[ll].x || (raw[i].x == raw[ll].x && raw[i].z < raw[ll].z)) ll = i;
+            if (raw[i].x > raw[ur].x || (raw[i].x == raw[ur].x && raw[i].z > raw[ur].z)) ur = i;
+        }
+        ContourVertex a = raw[ll];
+        a.raw = ll;
+        ContourVertex b = raw[ur];
+        b.raw = ur;
+        out.push_back(a);
+        out.push_back(b);
+    }
+
+    // Douglas-Peucker refinement of wall edges
+    float max_error_sq = max_error * max_error;
+    for (std::size_t i = 0; i < out.size();) {
+        const ContourVertex& a = out[i];
+        const ContourVertex& b = out[(i + 1) % out.size()];
+        int ax = a.x, az = a.z, bx = b.x, bz = b.z;
+        std::size_t ci, end, step;
+
+        // Walk the segment in a fixed order so both sides of a seam agree
+        if (bx > ax || (bx == ax && bz > az)) {
+            step = 1;
+            ci = (a.raw + step) % pn;
+            end = b.raw;
+        } else {
+            step = pn - 1;
+            ci = (b.raw + step) % pn;
+            end = a.raw;
+            std::swap(ax, bx);
+            std::swap(az, bz);
+        }
+
+        float max_d = 0;
+        std::size_t max_i = pn;
+        if (raw[ci].region == 0) {
+            while (ci != end) {
+                float dist = distance_to_segment_sq(raw[ci].x, raw[ci].z, ax, az, bx, bz);
+                if (dist > max_d) {
+                    max_d = dist;
+                    max_i = ci;
+                }
+                ci = (ci + step) % pn;
+            }
+        }
+
+        if (max_i != pn && max_d > max_error_sq) {
+            ContourVertex v = raw[max_i];
+            v.raw = max_i;
+            out.insert(out.begin() + static_cast<std::ptrdiff_t>(i + 1), v);
+        } else {
+            ++i;
+        }
+    }
+
+    // Split long wall edges
+    if (max_edge_len > 0) {
+        for (std::size_t i = 0; i < out.size();) {
+            const ContourVertex& a = out[i];
+            const ContourVertex& b = out[(i + 1) % out.size()];
+            std::size_t max_i = pn;
+            std::size_t ci = (a.raw + 1) % pn;
+
+            if (raw[ci].region == 0) {
+                int dx = b.x - a.x;
+                int dz = b.z - a.z;
+                if (dx * dx + dz * dz > max_edge_len * max_edge_len) {
+                    std::size_t n = b.raw < a.raw ? b.raw + pn - a.raw : b.raw - a.raw;
+                    if (n > 1) {
+                        if (b.x > a.x || (b.x == a.x && b.z > a.z)) {
+                            max_i = (a.raw + n / 2) % pn;
+                        } else {
+                            max_i = (a.raw + (n + 1) / 2) % pn;
+                        }
+                    }
+                }
+            }
+
+            if (max_i != pn) {
+                ContourVertex v = raw[max_i];
+                v.raw = max_i;
+                out.insert(out.begin() + static_cast<std::ptrdiff_t>(i + 1), v);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    // Edge regions now describe the simplified edge starting at each vertex
+    for (auto& v : out) {
+        v.region = raw[(v.raw + 1) % pn].region;
+    }
+
+    // Remove zero-length segments
+    for (std::size_t i = 0; i < out.size() && out.size() > 3;) {
+        const ContourVertex& a = out[i];
+        const ContourVertex& b = out[(i + 1) % out.size()];
+        if (a.x == b.x && a.z == b.z) {
+            out.erase(out.begin() + static_cast<std::ptrdiff_t>(i));
+        } else {
+            ++i;
+        }
+    }
+
+    return out;
+}
+
+std::int64_t contour_area2(const std::vector<ContourVertex>& verts) {
+    std::int64_t area = 0;
+    for (std::size_t i = 0, j = verts.size() - 1; i < verts.size(); j = i++) {
+        area += static_cast<std::int64_t>(verts[j].x) * verts[i].z -
+                static_cast<std::int64_t>(verts[i].x) * verts[j].z;
+    }
+    return area;
+}
+
+std::vector<Contour> build_contours(const CompactHeightfield& chf, float max_error, int max_edge_len) {
+    std::vector<std::uint8_t> flags(chf.spans.size(), 0);
+    for (std::size_t i = 0; i < chf.spans.size(); ++i) {
+        std::uint16_t r = chf.regions[i];
+        if (r == 0 || (r & k_border_region)) continue;
+        for (int dir = 0; dir < 4; ++dir) {
+            std::int32_t n = chf.spans[i].con[dir];
+            std::uint16_t nr = n != k_not_connected ? chf.regions[static_cast<std::size_t>(n)] : 0;
+            if (nr != r) {
+                flags[i] |= static_cast<std::uint8_t>(1 << dir);
+            }
+        }
+    }
+
+    std::vector<Contour> contours;
+    std::vector<ContourVertex> raw;
+    for (int z = 0; z < chf.depth; ++z) {
+        for (int x = 0; x < chf.width; ++x) {
+            std::size_t c = static_cast<std::size_t>(x + z * chf.width);
+            for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                if (flags[i] == 0 || flags[i] == 0xF) {
+                    flags[i] = 0;
+                    continue;
+                }
+
+                raw.clear();
+                walk_contour(chf, x, z, i, flags, raw);
+                if (raw.size() < 3) continue;
+
+                Contour contour;
+                contour.region = chf.regions[i];
+                contour.area = chf.areas[i];
+                contour.vertices = simplify_contour(raw, max_error, max_edge_len);
+                if (contour.vertices.size() >= 3) {
+                    contours.push_back(std::move(contour));
+                }
+            }
+        }
+    }
+
+    // A region's outline winds opposite to any holes left by removed specks;
+    // drop the holes so every remaining contour is a simple outer boundary.
+    std::unordered_map<std::uint16_t, std::int64_t> outer_area;
+    for (const auto& contour : contours) {
+        std::int64_t area = contour_area2(contour.vertices);
+        auto [it, inserted] = outer_area.try_emplace(contour.region, area);
+        if (!inserted && std::abs(area) > std::abs(it->second)) {
+            it->second = area;
+        }
+    }
+    contours.erase(std::remove_if(contours.begin(), contours.end(), [&](const Contour& contour) {
+        std::int64_t area = contour_area2(contour.vertices);
+        return area == 0 || (area > 0) != (outer_area[contour.region] > 0);
+    }), contours.end());
+
+    return contours;
+}
+
+// =============================================================================
+// Polygonization
+// =============================================================================
+
+struct GridVertex {
+    int x{0};
+    int y{0};
+    int z{0};
+};
+
+template<typename A, typename B, typename C>
+std::int64_t cross2(const A& a, const B& b, const C& c) {
+    return static_cast<std::int64_t>(b.x - a.x) * (c.z - a.z) -
+           static_cast<std::int64_t>(b.z - a.z) * (c.x - a.x);
+}
+
+// Ear clipping; emits triangles as indices into verts
+void triangulate(const std::vector<ContourVertex>& verts, std::vector<std::array<std::size_t, 3>>& tris) {
+    std::vector<std::size_t> indices(verts.size());
+    for (std::size_t i = 0; i < verts.size(); ++i) {
+        indices[i] = i;
+    }
+    std::int64_t sign = contour_area2(verts) > 0 ? 1 : -1;
+
+    auto same_position = [&](std::size_t a, std::size_t b) {
+        return verts[a].x == verts[b].x && verts[a].z == verts[b].z;
+    };
+
+    while (indices.size() > 3) {
+        std::size_t m = indices.size();
+        bool clipped = false;
+
+        for (std::size_t k = 0; k < m && !clipped; ++k) {
+            std::size_t p = indices[(k + m - 1) % m];
+            std::size_t c = indices[k];
+            std::size_t n = indices[(k + 1) % m];
+            if (cross2(verts[p], verts[c], verts[n]) * sign <= 0) continue;
+
+            bool blocked = false;
+            for (std::size_t j : indices) {
+                if (j == p || j == c || j == n) continue;
+                if (same_position(j, p) || same_position(j, c) || same_position(j, n)) continue;
+                if (cross2(verts[p], verts[c], verts[j]) * sign >= 0 &&
+                    cross2(verts[c], verts[n], verts[j]) * sign >= 0 &&
+                    cross2(verts[n], verts[p], verts[j]) * sign >= 0) {
+                    blocked = true;
+                    break;
+                }
+            }
+            if (blocked) continue;
+
+            tris.push_back({p, c, n});
+            indices.erase(indices.begin() + static_cast<std::ptrdiff_t>(k));
+            clipped = true;
+        }
+
+        if (!clipped) {
+            // Degenerate outline: discard a collinear vertex if there is one, else give up
+            bool removed = false;
+            for (std::size_t k = 0; k < m; ++k) {
+                if (cross2(verts[indices[(k + m - 1) % m]], verts[indices[k]], verts[indices[(k + 1) % m]]) == 0) {
+                    indices.erase(indices.begin() + static_cast<std::ptrdiff_t>(k));
+                    removed = true;
+                    break;
+                }
+            }
+            if (!removed) return;
+        }
+    }
+
+    if (indices.size() == 3 && cross2(verts[indices[0]], verts[indices[1]], verts[indices[2]]) != 0) {
+        tris.push_back({indices[0], indices[1], indices[2]});
+    }
+}
+
+bool is_convex(const std::vector<std::uint32_t>& poly, const std::vector<GridVertex>& verts) {
+    std::size_t n = poly.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        if (cross2(verts[poly[(i + n - 1) % n]], verts[poly[i]], verts[poly[(i + 1) % n]]) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Greedily merges polygons across their longest shared edge while they stay convex
+void merge_polygons(std::vector<std::vector<std::uint32_t>>& polys,
+                    const std::vector<GridVertex>& verts, std::size_t max_verts) {
+    std::vector<std::uint32_t> merged;
+    std::vector<std::uint32_t> best_merged;
+
+    while (polys.size() > 1) {
+        std::int64_t best_len = -1;
+        std::size_t best_a = 0;
+        std::size_t best_b = 0;
+
+        for (std::size_t a = 0; a < polys.size(); ++a) {
+            const auto& pa = polys[a];
+            for (std::size_t b = a + 1; b < polys.size(); ++b) {
+                const auto& pb = polys[b];
+                if (pa.size() + pb.size() - 2 > max_verts) continue;
+
+                for (std::size_t ea = 0; ea < pa.size(); ++ea) {
+                    std::uint32_t va0 = pa[ea];
+                    std::uint32_t va1 = pa[(ea + 1) % pa.size()];
+                    for (std::size_t eb = 0; eb < pb.size(); ++eb) {
+                        if (pb[eb] != va1 || pb[(eb + 1) % pb.size()] != va0) continue;
+
+                        std::int64_t dx = verts[va1].x - verts[va0].x;
+                        std::int64_t dz = verts[va1].z - verts[va0].z;
+                        std::int64_t len = dx * dx + dz * dz;
+                        if (len <= best_len) continue;
+
+                        merged.clear();
+                        for (std::size_t k = 0; k + 1 < pa.size(); ++k) {
+                            merged.push_back(pa[(ea + 1 + k) % pa.size()]);
+                        }
+                        for (std::size_t k = 0; k + 1 < pb.size(); ++k) {
+                            merged.push_back(pb[(eb + 1 + k) % pb.size()]);
+                        }
+                        if (!is_convex(merged, verts)) continue;
+
+                        best_len = len;
+                        best_a = a;
+                        best_b = b;
+                        best_merged = merged;
+                    }
+                }
+            }
+        }
+
+        if (best_len < 0) break;
+        polys[best_a] = best_merged;
+        polys.erase(polys.begin() + static_cast<std::ptrdiff_t>(best_b));
+    }
+}
+
+// =============================================================================
+// Detail mesh
+// =============================================================================
+
+bool sample_height(const CompactHeightfield& chf, float x, float z, float approx, float& out) {
+    int cx = static_cast<int>(std::floor((x - chf.origin_x) / chf.cs));
+    int cz = static_cast<int>(std::floor((z - chf.origin_z) / chf.cs));
+    if (cx < 0 || cz < 0 || cx >= chf.width || cz >= chf.depth) return false;
+
+    std::size_t c = static_cast<std::size_t>(cx + cz * chf.width);
+    float best = std::numeric_limits<float>::max();
+    for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+        float y = chf.origin_y + chf.spans[i].y * chf.ch;
+        if (std::abs(y - approx) < best) {
+            best = std::abs(y - approx);
+            out = y;
+        }
+    }
+    return best != std::numeric_limits<float>::max();
+}
+
+bool triangle_height(const void_math::Vec3& a, const void_math::Vec3& b,
+                     const void_math::Vec3& c, float x, float z, float& out) {
+    float v0x = c.x - a.x, v0z = c.z - a.z;
+    float v1x = b.x - a.x, v1z = b.z - a.z;
+    float v2x = x - a.x, v2z = z - a.z;
+    float denom = v0x * v1z - v0z * v1x;
+    if (std::abs(denom) < 1e-9f) return false;
+    float u = (v2x * v1z - v2z * v1x) / denom;
+    float v = (v0x * v2z - v0z * v2x) / denom;
+    if (u < 1e-4f || v < 1e-4f || u + v > 1.0f - 1e-4f) return false;
+    out = a.y + (c.y - a.y) * u + (b.y - a.y) * v;
+    return true;
+}
+
+// Inserts height samples that deviate from the polygon surface into its fan
+// triangulation; returns a flat triangle list, or nothing if the polygon is flat enough.
+std::vector<void_math::Vec3> build_detail(const CompactHeightfield& chf,
+                                          const std::vector<void_math::Vec3>& poly,
+                                          float sample_dist, float max_error) {
+    if (sample_dist <= 0 || poly.size() < 3) return {};
+
+    std::vector<void_math::Vec3> verts = poly;
+    std::vector<std::array<std::size_t, 3>> tris;
+    for (std::size_t i = 2; i < poly.size(); ++i) {
+        tris.push_back({0, i - 1, i});
+    }
+
+    auto surface_height = [&](float x, float z, std::size_t& out_tri, float& out) {
+        for (std::size_t t = 0; t < tris.size(); ++t) {
+            if (triangle_height(verts[tris[t][0]], verts[tris[t][1]], verts[tris[t][2]], x, z, out)) {
+                out_tri = t;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    float min_x = poly[0].x, max_x = poly[0].x, min_z = poly[0].z, max_z = poly[0].z;
+    for (const auto& p : poly) {
+        min_x = std::min(min_x, p.x);
+        max_x = std::max(max_x, p.x);
+        min_z = std::min(min_z, p.z);
+        max_z = std::max(max_z, p.z);
+    }
+
+    std::vector<void_math::Vec3> samples;
+    for (float z = min_z + sample_dist * 0.5f; z < max_z; z += sample_dist) {
+        for (float x = min_x + sample_dist * 0.5f; x < max_x; x += sample_dist) {
+            std::size_t tri = 0;
+            float base = 0;
+            float height = 0;
+            if (!surface_height(x, z, tri, base)) continue;
+            if (!sample_height(chf, x, z, base, height)) continue;
+            samples.push_back({x, height, z});
+        }
+    }
+
+    for (std::size_t round = 0; round < k_max_detail_samples && !samples.empty(); ++round) {
+        float best_error = max_error;
+        std::size_t best = samples.size();
+        std::size_t best_tri = 0;
+        for (std::size_t s = 0; s < samples.size(); ++s) {
+            std::size_t tri = 0;
+            float base = 0;
+            if (!surface_height(samples[s].x, samples[s].z, tri, base)) continue;
+            float error = std::abs(samples[s].y - base);
+            if (error > best_error) {
+                best_error = error;
+                best = s;
+                best_tri = tri;
+            }
+        }
+        if (best == samples.size()) break;
+
+        std::size_t vi = verts.size();
+        verts.push_back(samples[best]);
+        samples.erase(samples.begin() + static_cast<std::ptrdiff_t>(best));
+
+        auto [a, b, c] = tris[best_tri];
+        tris[best_tri] = {a, b, vi};
+        tris.push_back({b, c, vi});
+        tris.push_back({c, a, vi});
+    }
+
+    if (verts.size() == poly.size()) return {};
+
+    std::vector<void_math::Vec3> out;
+    out.reserve(tris.size() * 3);
+    for (const auto& tri : tris) {
+        out.push_back(verts[tri[0]]);
+        out.push_back(verts[tri[1]]);
+        out.push_back(verts[tri[2]]);
+    }
+    return out;
+}
+
+int border_cells(const NavMeshBuildConfig& config) {
+    return static_cast<int>(std::ceil(config.agent_radius / std::max(config.cell_size, 0.01f))) + 3;
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// NavMeshBuilder Implementation
+// =============================================================================
+
+NavMeshBuilder::NavMeshBuilder()
+    : m_config() {
+}
+
+NavMeshBuilder::NavMeshBuilder(const NavMeshBuildConfig& config)
+    : m_config(config) {
+}
+
+void NavMeshBuilder::add_triangle(const void_math::Vec3& a,
+                                  const void_math::Vec3& b,
+                                  const void_math::Vec3& c,
+                                  AreaType area) {
+    InputTriangle tri;
+    tri.v[0] = a;
+    tri.v[1] = b;
+    tri.v[2] = c;
+    tri.area = area;
+
+    if (m_triangles.empty()) {
+        m_bounds_min = a;
+        m_bounds_max = a;
+    }
+    for (const auto& v : tri.v) {
+        m_bounds_min.x = std::min(m_bounds_min.x, v.x);
+        m_bounds_min.y = std::min(m_bounds_min.y, v.y);
+        m_bounds_min.z = std::min(m_bounds_min.z, v.z);
+        m_bounds_max.x = std::max(m_bounds_max.x, v.x);
+        m_bounds_max.y = std::max(m_bounds_max.y, v.y);
+        m_bounds_max.z = std::max(m_bounds_max.z, v.z);
+    }
+
+    m_triangles.push_back(tri);
+}
+
+void NavMeshBuilder::add_mesh(const std::vector<void_math::Vec3>& vertices,
+                              const std::vector<std::uint32_t>& indices,
+                              AreaType area) {
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+        add_triangle(vertices[indices[i]],
+                    vertices[indices[i + 1]],
+                    vertices[indices[i + 2]],
+                    area);
+    }
+}
+
+void NavMeshBuilder::add_box_obstacle(const void_math::Vec3& min,
+                                      const void_math::Vec3& max) {
+    Obstacle obs;
+    obs.type = Obstacle::Type::Box;
+    obs.min = min;
+    obs.max = max;
+    m_obstacles.push_back(obs);
+}
+
+void NavMeshBuilder::add_cylinder_obstacle(const void_math::Vec3& center,
+                                           float radius,
+                                           float height) {
+    Obstacle obs;
+    obs.type = Obstacle::Type::Cylinder;
+    obs.min = center;
+    obs.radius = radius;
+    obs.height = height;
+    m_obstacles.push_back(obs);
+}
+
+void NavMeshBuilder::mark_area(const void_math::Vec3& min,
+                               const void_math::Vec3& max,
+                               AreaType area) {
+    AreaVolume volume;
+    volume.vertices = {min, max};
+    volume.min_height = min.y;
+    volume.max_height = max.y;
+    volume.area = area;
+    volume.box = true;
+    m_area_volumes.push_back(std::move(volume));
+}
+
+void NavMeshBuilder::mark_convex_area(const std::vector<void_math::Vec3>& vertices,
+                                      float min_height,
+                                      float max_height,
+                                      AreaType area) {
+    if (vertices.size() < 3) return;
+
+    AreaVolume volume;
+    volume.vertices = vertices;
+    volume.min_height = min_height;
+    volume.max_height = max_height;
+    volume.area = area;
+    m_area_volumes.push_back(std::move(volume));
+}
+
+float NavMeshBuilder::tile_world_size() const {
+    return static_cast<float>(std::max<std::uint32_t>(m_config.tile_size, 8)) *
+           std::max(m_config.cell_size, 0.01f);
+}
+
+std::vector<std::pair<std::int32_t, std::int32_t>> NavMeshBuilder::tiles_overlapping(
+    const void_math::Vec3& min, const void_math::Vec3& max) const {
+    std::vector<std::pair<std::int32_t, std::int32_t>> tiles;
+    if (m_triangles.empty()) return tiles;
+
+    float tile_world = tile_world_size();
+    auto tiles_x = static_cast<std::int32_t>(std::ceil((m_bounds_max.x - m_bounds_min.x) / tile_world));
+    auto tiles_z = static_cast<std::int32_t>(std::ceil((m_bounds_max.z - m_bounds_min.z) / tile_world));
+    tiles_x = std::max(tiles_x, 1);
+    tiles_z = std::max(tiles_z, 1);
+
+    auto x0 = static_cast<std::int32_t>(std::floor((min.x - m_bounds_min.x) / tile_world));
+    auto x1 = static_cast<std::int32_t>(std::floor((max.x - m_bounds_min.x) / tile_world));
+    auto z0 = static_cast<std::int32_t>(std::floor((min.z - m_bounds_min.z) / tile_world));
+    auto z1 = static_cast<std::int32_t>(std::floor((max.z - m_bounds_min.z) / tile_world));
+
+    for (std::int32_t z = std::max(z0, 0); z <= std::min(z1, tiles_z - 1); ++z) {
+        for (std::int32_t x = std::max(x0, 0); x <= std::min(x1, tiles_x - 1); ++x) {
+            tiles.emplace_back(x, z);
+        }
+    }
+    return tiles;
+}
+
+std::vector<std::uint32_t> NavMeshBuilder::triangles_in_tile(std::int32_t tile_x,
+                                                             std::int32_t tile_z) const {
+    float tile_world = tile_world_size();
+    float pad = static_cast<float>(border_cells(m_config)) * std::max(m_config.cell_size, 0.01f);
+    float min_x = m_bounds_min.x + static_cast<float>(tile_x) * tile_world - pad;
+    float min_z = m_bounds_min.z + static_cast<float>(tile_z) * tile_world - pad;
+    float max_x = min_x + tile_world + 2 * pad;
+    float max_z = min_z + tile_world + 2 * pad;
+
+    std::vector<std::uint32_t> triangles;
+    for (std::uint32_t ti = 0; ti < m_triangles.size(); ++ti) {
+        const auto& v = m_triangles[ti].v;
+        if (std::max({v[0].x, v[1].x, v[2].x}) < min_x || std::min({v[0].x, v[1].x, v[2].x}) > max_x ||
+            std::max({v[0].z, v[1].z, v[2].z}) < min_z || std::min({v[0].z, v[1].z, v[2].z}) > max_z) {
+            continue;
+        }
+        triangles.push_back(ti);
+    }
+    return triangles;
+}
+
+NavMeshTile NavMeshBuilder::build_tile(std::int32_t tile_x, std::int32_t tile_z) const {
+    return build_tile(tile_x, tile_z, triangles_in_tile(tile_x, tile_z));
+}
+
+NavMeshTile NavMeshBuilder::build_tile(std::int32_t tile_x, std::int32_t tile_z,
+                                       const std::vector<std::uint32_t>& triangles) const {
+    const auto& cfg = m_config;
+    const float cs = std::max(cfg.cell_size, 0.01f);
+    const float ch = std::max(cfg.cell_height, 0.01f);
+    const int tile_cells = static_cast<int>(std::max<std::uint32_t>(cfg.tile_size, 8));
+    const int border = border_cells(cfg);
+    const int walkable_height = static_cast<int>(std::ceil(cfg.agent_height / ch));
+    const int walkable_climb = static_cast<int>(std::floor(cfg.agent_max_climb / ch));
+    const int walkable_radius = static_cast<int>(std::ceil(cfg.agent_radius / cs));
+    const float tile_world = tile_world_size();
+
+    NavMeshTile tile;
+    tile.x = tile_x;
+    tile.z = tile_z;
+    tile.bounds_min = {m_bounds_min.x + static_cast<float>(tile_x) * tile_world, m_bounds_min.y,
+                       m_bounds_min.z + static_cast<float>(tile_z) * tile_world};
+    tile.bounds_max = {tile.bounds_min.x + tile_world, m_bounds_max.y,
+                       tile.bounds_min.z + tile_world};
+    tile.link_climb = cfg.agent_max_climb;
+
+    // Voxelize geometry and obstacles
+    Heightfield hf;
+    hf.width = tile_cells + 2 * border;
+    hf.depth = tile_cells + 2 * border;
+    hf.origin_x = tile.bounds_min.x - static_cast<float>(border) * cs;
+    hf.origin_y = m_bounds_min.y;
+    hf.origin_z = tile.bounds_min.z - static_cast<float>(border) * cs;
+    hf.cs = cs;
+    hf.ch = ch;
+    hf.columns.resize(static_cast<std::size_t>(hf.width * hf.depth));
+
+    const float walkable_cos = std::cos(cfg.agent_max_slope * (3.14159265f / 180.0f));
+    for (std::uint32_t ti : triangles) {
+        const auto& tri = m_triangles[ti];
+        float ax = tri.v[1].x - tri.v[0].x, ay = tri.v[1].y - tri.v[0].y, az = tri.v[1].z - tri.v[0].z;
+        float bx = tri.v[2].x - tri.v[0].x, by = tri.v[2].y - tri.v[0].y, bz = tri.v[2].z - tri.v[0].z;
+        float nx = ay * bz - az * by;
+        float ny = az * bx - ax * bz;
+        float nz = ax * by - ay * bx;
+        float len = std::sqrt(nx * nx + ny * ny + nz * nz);
+        bool walkable = len > 1e-12f && std::abs(ny) / len >= walkable_cos;
+        rasterize_triangle(hf, tri.v, walkable ? static_cast<std::uint8_t>(tri.area) : k_null_area,
+                           walkable_climb);
+    }
+
+    auto cell_range = [&](float lo, float hi, float origin, int limit, int& c0, int& c1) {
+        c0 = std::max(static_cast<int>(std::ceil((lo - origin) / cs - 0.5f)), 0);
+        c1 = std::min(static_cast<int>(std::floor((hi - origin) / cs - 0.5f)), limit - 1);
+        return c0 <= c1;
+    };
+    auto height_range = [&](float lo, float hi, int& smin, int& smax) {
+        smin = std::clamp(static_cast<int>(std::floor((lo - hf.origin_y) / ch)), 0, k_max_height - 1);
+        smax = std::clamp(static_cast<int>(std::ceil((hi - hf.origin_y) / ch)), smin + 1, k_max_height);
+    };
+
+    for (const auto& obs : m_obstacles) {
+        int x0, x1, z0, z1, smin, smax;
+        if (obs.type == Obstacle::Type::Box) {
+            if (!cell_range(obs.min.x, obs.max.x, hf.origin_x, hf.width, x0, x1) ||
+                !cell_range(obs.min.z, obs.max.z, hf.origin_z, hf.depth, z0, z1)) {
+                continue;
+            }
+            height_range(obs.min.y, obs.max.y, smin, smax);
+            for (int z = z0; z <= z1; ++z) {
+                for (int x = x0; x <= x1; ++x) {
+                    add_span(hf, x, z, smin, smax, k_null_area, walkable_climb);
+                }
+            }
+        } else {
+            const auto& c = obs.min;
+            if (!cell_range(c.x - obs.radius, c.x + obs.radius, hf.origin_x, hf.width, x0, x1) ||
+                !cell_range(c.z - obs.radius, c.z + obs.radius, hf.origin_z, hf.depth, z0, z1)) {
+                continue;
+            }
+            height_range(c.y, c.y + obs.height, smin, smax);
+            for (int z = z0; z <= z1; ++z) {
+                for (int x = x0; x <= x1; ++x) {
+                    float dx = hf.origin_x + (static_cast<float>(x) + 0.5f) * cs - c.x;
+                    float dz = hf.origin_z + (static_cast<float>(z) + 0.5f) * cs - c.z;
+                    if (dx * dx + dz * dz <= obs.radius * obs.radius) {
+                        add_span(hf, x, z, smin, smax, k_null_area, walkable_climb);
+                    }
+                }
+            }
+        }
+    }
+
+    filter_walkable_spans(hf, walkable_height, walkable_climb);
+
+    CompactHeightfield chf = build_compact(hf, walkable_height, walkable_climb);
+    chf.border = border;
+    hf.columns.clear();
+
+    erode_walkable_area(chf, walkable_radius);
+
+    // Apply marked area volumes to the surviving floor
+    for (const auto& volume : m_area_volumes) {
+        void_math::Vec3 vmin = volume.vertices[0];
+        void_math::Vec3 vmax = volume.vertices[0];
+        for (const auto& v : volume.vertices) {
+            vmin.x = std::min(vmin.x, v.x);
+            vmin.z = std::min(vmin.z, v.z);
+            vmax.x = std::max(vmax.x, v.x);
+            vmax.z = std::max(vmax.z, v.z);
+        }
+
+        int x0, x1, z0, z1;
+        if (!cell_range(vmin.x, vmax.x, chf.origin_x, chf.width, x0, x1) ||
+            !cell_range(vmin.z, vmax.z, chf.origin_z, chf.depth, z0, z1)) {
+            continue;
+        }
+
+        for (int z = z0; z <= z1; ++z) {
+            for (int x = x0; x <= x1; ++x) {
+                void_math::Vec3 p{chf.origin_x + (static_cast<float>(x) + 0.5f) * cs, 0.0f,
+                                  chf.origin_z + (static_cast<float>(z) + 0.5f) * cs};
+                if (!volume.box) {
+                    bool inside = false;
+                    const auto& vs = volume.vertices;
+                    for (std::size_t i = 0, j = vs.size() - 1; i < vs.size(); j = i++) {
+                        if (((vs[i].z > p.z) != (vs[j].z > p.z)) &&
+                            (p.x < (vs[j].x - vs[i].x) * (p.z - vs[i].z) / (vs[j].z - vs[i].z) + vs[i].x)) {
+                            inside = !inside;
+                        }
+                    }
+                    if (!inside) continue;
+                }
+
+                std::size_t c = static_cast<std::size_t>(x + z * chf.width);
+                for (std::uint32_t i = chf.cell_index[c]; i < chf.cell_index[c] + chf.cell_count[c]; ++i) {
+                    float y = chf.origin_y + chf.spans[i].y * ch;
+                    if (chf.areas[i] != k_null_area && y >= volume.min_height && y <= volume.max_height) {
+                        chf.areas[i] = static_cast<std::uint8_t>(volume.area);
+                    }
+                }
+            }
+        }
+    }
+
+    int min_region = static_cast<int>(cfg.region_min_size * cfg.region_min_size);
+    build_regions(chf, min_region);
+
+    int max_edge_len = static_cast<int>(cfg.edge_max_len / cs);
+    std::vector<Contour> contours = build_contours(chf, cfg.edge_max_error, max_edge_len);
+
+    // Triangulate each contour, weld shared corners and merge into convex polygons
+    std::vector<GridVertex> grid_verts;
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> vertex_lookup;
+    auto weld = [&](const ContourVertex& v) -> std::uint32_t {
+        auto& bucket = vertex_lookup[(static_cast<std::uint32_t>(v.x) << 16) | static_cast<std::uint32_t>(v.z)];
+        for (std::uint32_t index : bucket) {
+            if (std::abs(grid_verts[index].y - v.y) <= 2) {
+                return index;
+            }
+        }
+        auto index = static_cast<std::uint32_t>(grid_verts.size());
+        grid_verts.push_back({v.x, v.y, v.z});
+        bucket.push_back(index);
+        return index;
+    };
+
+    std::size_t max_verts = std::clamp(static_cast<std::size_t>(cfg.verts_per_poly), std::size_t{3}, std::size_t{12});
+    std::vector<std::array<std::size_t, 3>> tris;
+    std::vector<std::vector<std::uint32_t>> polys;
+
+    for (const auto& contour : contours) {
+        tris.clear();
+        triangulate(contour.vertices, tris);
+
+        polys.clear();
+        for (const auto& tri : tris) {
+            std::uint32_t a = weld(contour.vertices[tri[0]]);
+            std::uint32_t b = weld(contour.vertices[tri[1]]);
+            std::uint32_t c = weld(contour.vertices[tri[2]]);
+            if (a == b || b == c || a == c) continue;
+
+            std::int64_t winding = cross2(grid_verts[a], grid_verts[b], grid_verts[c]);
+            if (winding == 0) continue;
+            if (winding < 0) std::swap(b, c);
+            polys.push_back({a, b, c});
+        }
+
+        merge_polygons(polys, grid_verts, max_verts);
+
+        for (auto& verts : polys) {
+            NavPolygon poly;
+            poly.vertices = std::move(verts);
+            poly.flags = contour.area;
+            tile.polygons.push_back(std::move(poly));
+        }
+    }
+
+    tile.vertices.reserve(grid_verts.size());
+    for (const auto& v : grid_verts) {
+        tile.vertices.push_back({chf.origin_x + static_cast<float>(v.x) * cs,
+                                 chf.origin_y + static_cast<float>(v.y) * ch,
+                                 chf.origin_z + static_cast<float>(v.z) * cs});
+    }
+
+    // Connect polygons inside the tile and collect edges on the tile border
+    std::unordered_map<std::uint64_t, std::uint32_t> open_edges;
+    const int far_x = chf.width - border;
+    const int far_z = chf.depth - border;
+    for (std::uint32_t pi = 0; pi < tile.polygons.size(); ++pi) {
+        const auto& verts = tile.polygons[pi].vertices;
+        for (std::size_t i = 0; i < verts.size(); ++i) {
+            std::uint32_t va = verts[i];
+            std::uint32_t vb = verts[(i + 1) % verts.size()];
+            std::uint64_t key = (static_cast<std::uint64_t>(std::min(va, vb)) << 32) | std::max(va, vb);
+
+            auto [it, inserted] = open_edges.try_emplace(key, pi);
+            if (!inserted && it->second != pi) {
+                tile.polygons[it->second].neighbors.push_back(pi);
+                tile.polygons[pi].neighbors.push_back(it->second);
+            }
+
+            const GridVertex& a = grid_verts[va];
+            const GridVertex& b = grid_verts[vb];
+            int side = -1;
+            if (a.x == b.x && a.x == border) side = 0;
+            else if (a.z == b.z && a.z == far_z) side = 1;
+            else if (a.x == b.x && a.x == far_x) side = 2;
+            else if (a.z == b.z && a.z == border) side = 3;
+            if (side < 0) continue;
+
+            const auto& wa = tile.vertices[va];
+            const auto& wb = tile.vertices[vb];
+            NavMeshTile::BorderEdge edge;
+            edge.polygon = pi;
+            edge.side = static_cast<std::uint8_t>(side);
+            edge.min = (side & 1) ? std::min(wa.x, wb.x) : std::min(wa.z, wb.z);
+            edge.max = (side & 1) ? std::max(wa.x, wb.x) : std::max(wa.z, wb.z);
+            edge.height = (wa.y + wb.y) * 0.5f;
+            tile.border_edges.push_back(edge);
+        }
+    }
+
+    // Detail triangles for polygons whose floor strays from their outline
+    float sample_dist = cfg.detail_sample_dist < 0.9f ? 0.0f : cs * cfg.detail_sample_dist;
+    float sample_error = ch * cfg.detail_sample_max_error;
+    tile.detail.resize(tile.polygons.size());
+    std::vector<void_math::Vec3> outline;
+    for (std::size_t pi = 0; pi < tile.polygons.size(); ++pi) {
+        outline.clear();
+        for (std::uint32_t vi : tile.polygons[pi].vertices) {
+            outline.push_back(tile.vertices[vi]);
+        }
+        tile.detail[pi] = build_detail(chf, outline, sample_dist, sample_error);
+    }
+
+    return tile;
+}
+
+std::unique_ptr<NavMesh> NavMeshBuilder::build() {
+    auto mesh = std::make_unique<NavMesh>();
+
+    if (m_triangles.empty()) {
+        return mesh;
+    }
+
+    float tile_world = tile_world_size();
+    auto tiles_x = std::max(static_cast<std::int32_t>(std::ceil((m_bounds_max.x - m_bounds_min.x) / tile_world)), 1);
+    auto tiles_z = std::max(static_cast<std::int32_t>(std::ceil((m_bounds_max.z - m_bounds_min.z) / tile_world)), 1);
+    std::size_t tile_count = static_cast<std::size_t>(tiles_x) * static_cast<std::size_t>(tiles_z);
+
+    // Bucket triangles by every tile (including its border) their bounds touch
+    float pad = static_cast<float>(border_cells(m_config)) * std::max(m_config.cell_size, 0.01f);
+    std::vector<std::vector<std::uint32_t>> buckets(tile_count);
+    for (std::uint32_t ti = 0; ti < m_triangles.size(); ++ti) {
+        const auto& v = m_triangles[ti].v;
+        auto tile_of = [&](float value, float origin, std::int32_t limit) {
+            return std::clamp(static_cast<std::int32_t>(std::floor((value - origin) / tile_world)), 0, limit - 1);
+        };
+        std::int32_t x0 = tile_of(std::min({v[0].x, v[1].x, v[2].x}) - pad, m_bounds_min.x, tiles_x);
+        std::int32_t x1 = tile_of(std::max({v[0].x, v[1].x, v[2].x}) + pad, m_bounds_min.x, tiles_x);
+        std::int32_t z0 = tile_of(std::min({v[0].z, v[1].z, v[2].z}) - pad, m_bounds_min.z, tiles_z);
+        std::int32_t z1 = tile_of(std::max({v[0].z, v[1].z, v[2].z}) + pad, m_bounds_min.z, tiles_z);
+        for (std::int32_t z = z0; z <= z1; ++z) {
+            for (std::int32_t x = x0; x <= x1; ++x) {
+                buckets[static_cast<std::size_t>(x + z * tiles_x)].push_back(ti);
+            }
+        }
+    }
+
+    // Tiles are independent; workers pull the next unbuilt tile until none remain
+    std::vector<NavMeshTile> tiles(tile_count);
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for (std::size_t i = next.fetch_add(1); i < tile_count; i = next.fetch_add(1)) {
+            auto x = static_cast<std::int32_t>(i % static_cast<std::size_t>(tiles_x));
+            auto z = static_cast<std::int32_t>(i / static_cast<std::size_t>(tiles_x));
+            tiles[i] = build_tile(x, z, buckets[i]);
+        }
+    };
+
+    std::size_t worker_count = m_config.max_build_threads > 0
+        ? m_config.max_build_threads
+        : std::max(1u, std::thread::hardware_concurrency());
+    worker_count = std::min(worker_count, tile_count);
+
+    std::vector<std::thread> threads;
+    threads.reserve(worker_count - 1);
+    for (std::size_t t = 1; t < worker_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& tile : tiles) {
+        if (!tile.polygons.empty()) {
+            mesh->set_tile(std::move(tile));
+        }
+    }
+
+    return mesh;
+}
+
+void NavMeshBuilder::rebuild_tile(NavMesh& mesh, std::int32_t tile_x, std::int32_t tile_z) const {
+    NavMeshTile tile = build_tile(tile_x, tile_z);
+    if (tile.polygons.empty()) {
+        mesh.remove_tile(tile_x, tile_z);
+    } else {
+        mesh.set_tile(std::move(tile));
+    }
+}
+
+} // namespace void_ai
@@ -0,0 +1,575 @@
+/// @file navmesh_path.cpp
+/// @brief Hierarchical and time-sliced pathfinding for void_ai module
+///
+/// The cluster graph partitions the navmesh into square clusters and keeps
+/// the cost between every pair of portal polygons inside each cluster. A
+/// corridor search runs over portals only; NavMeshQuery then runs its polygon
+/// A* restricted to the clusters of that corridor. NavPathQueue spreads many
+/// such searches over frames and worker threads.
+
+#include <void_engine/ai/navmesh.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace void_ai {
+
+namespace {
+
+constexpr float k_unreachable = std::numeric_limits<float>::infinity();
+
+// Node expansions granted to a worker at a time
+constexpr std::int64_t k_slice_iterations = 64;
+// Budget below which process() stays on the calling thread
+constexpr std::size_t k_parallel_iterations = 1024;
+// Finished searches kept for their node storage
+constexpr std::size_t k_max_spare_searches = 64;
+
+float center_distance(const NavPolygon& a, const NavPolygon& b) {
+    float dx = b.center.x - a.center.x;
+    float dy = b.center.y - a.center.y;
+    float dz = b.center.z - a.center.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+float point_distance(const void_math::Vec3& a, const void_math::Vec3& b) {
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float dz = b.z - a.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+std::uint64_t cluster_key(std::int32_t x, std::int32_t z) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+           static_cast<std::uint32_t>(z);
+}
+
+std::int32_t cluster_coord(float value, float cluster_size) {
+    return static_cast<std::int32_t>(std::floor(value / cluster_size));
+}
+
+std::uint64_t corridor_key(std::uint32_t start_cluster, std::uint32_t goal_cluster) {
+    return (static_cast<std::uint64_t>(start_cluster) << 32) | goal_cluster;
+}
+
+struct OpenEntry {
+    float f_cost{0};
+    float g_cost{0};
+    std::uint32_t polygon{0};
+
+    bool operator>(const OpenEntry& other) const {
+        return f_cost > other.f_cost;
+    }
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// NavClusterGraph Implementation
+// =============================================================================
+
+NavClusterGraph::NavClusterGraph(float cluster_size)
+    : m_cluster_size(cluster_size > 0 ? cluster_size : 16.0f) {
+}
+
+void NavClusterGraph::build(const INavMesh& mesh) {
+    m_cells.clear();
+    m_clusters.clear();
+    m_polygon_cluster.clear();
+    m_portal_index.clear();
+
+    assign_polygons(mesh);
+    for (std::uint32_t c = 0; c < m_clusters.size(); ++c) {
+        compute_portals(mesh, c);
+    }
+}
+
+void NavClusterGraph::update_region(const INavMesh& mesh,
+                                    const void_math::Vec3& min,
+                                    const void_math::Vec3& max) {
+    // Neighbors of changed polygons lie at most one cluster outside the region
+    std::vector<bool> dirty(m_clusters.size(), false);
+    std::int32_t x0 = cluster_coord(min.x - m_cluster_size, m_cluster_size);
+    std::int32_t z0 = cluster_coord(min.z - m_cluster_size, m_cluster_size);
+    std::int32_t x1 = cluster_coord(max.x + m_cluster_size, m_cluster_size);
+    std::int32_t z1 = cluster_coord(max.z + m_cluster_size, m_cluster_size);
+    for (std::int32_t z = z0; z <= z1; ++z) {
+        for (std::int32_t x = x0; x <= x1; ++x) {
+            auto it = m_cells.find(cluster_key(x, z));
+            if (it != m_cells.end()) {
+                dirty[it->second] = true;
+            }
+        }
+    }
+
+    // Membership is cheap to recompute; polygon slots may have been reused
+    auto previous = std::move(m_polygon_cluster);
+    assign_polygons(mesh);
+    dirty.resize(m_clusters.size(), true);
+    for (std::size_t p = 0; p < m_polygon_cluster.size(); ++p) {
+        std::uint32_t before = p < previous.size() ? previous[p] : k_invalid;
+        if (before == m_polygon_cluster[p]) continue;
+        if (before != k_invalid) dirty[before] = true;
+        if (m_polygon_cluster[p] != k_invalid) dirty[m_polygon_cluster[p]] = true;
+    }
+    for (std::size_t p = m_polygon_cluster.size(); p < previous.size(); ++p) {
+        if (previous[p] != k_invalid) dirty[previous[p]] = true;
+    }
+
+    // Clear every stale portal first; slots may have moved between clusters
+    for (std::uint32_t c = 0; c < m_clusters.size(); ++c) {
+        if (!dirty[c]) continue;
+        for (std::uint32_t portal : m_clusters[c].portals) {
+            if (portal < m_portal_index.size()) {
+                m_portal_index[portal] = k_invalid;
+            }
+        }
+        m_clusters[c].portals.clear();
+    }
+    for (std::uint32_t c = 0; c < m_clusters.size(); ++c) {
+        if (dirty[c]) {
+            compute_portals(mesh, c);
+        }
+    }
+}
+
+std::size_t NavClusterGraph::portal_count() const {
+    std::size_t count = 0;
+    for (const auto& cluster : m_clusters) {
+        count += cluster.portals.size();
+    }
+    return count;
+}
+
+std::uint32_t NavClusterGraph::cluster_at(const void_math::Vec3& position) {
+    std::uint64_t key = cluster_key(cluster_coord(position.x, m_cluster_size),
+                                    cluster_coord(position.z, m_cluster_size));
+    auto [it, inserted] = m_cells.try_emplace(key, static_cast<std::uint32_t>(m_clusters.size()));
+    if (inserted) {
+        m_clusters.emplace_back();
+    }
+    return it->second;
+}
+
+void NavClusterGraph::assign_polygons(const INavMesh& mesh) {
+    for (auto& cluster : m_clusters) {
+        cluster.polygons.clear();
+    }
+
+    std::size_t count = mesh.polygon_count();
+    m_polygon_cluster.assign(count, k_invalid);
+    m_portal_index.resize(count, k_invalid);
+
+    for (std::uint32_t p = 0; p < count; ++p) {
+        const NavPolygon* poly = mesh.polygon(p);
+        // Free tile slots are kept as empty polygons
+        if (!poly || poly->vertices.empty()) continue;
+
+        std::uint32_t c = cluster_at(poly->center);
+        m_polygon_cluster[p] = c;
+        m_clusters[c].polygons.push_back(p);
+    }
+}
+
+void NavClusterGraph::compute_portals(const INavMesh& mesh, std::uint32_t cluster) {
+    Cluster& data = m_clusters[cluster];
+    data.portals.clear();
+
+    for (std::uint32_t p : data.polygons) {
+        const NavPolygon* poly = mesh.polygon(p);
+        for (std::uint32_t neighbor : poly->neighbors) {
+            std::uint32_t other = cluster_of(neighbor);
+            if (other != k_invalid && other != cluster) {
+                m_portal_index[p] = static_cast<std::uint32_t>(data.portals.size());
+                data.portals.push_back(p);
+                break;
+            }
+        }
+    }
+
+    std::size_t n = data.portals.size();
+    data.portal_costs.assign(n * n, k_unreachable);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto costs = local_costs(mesh, cluster, data.portals[i]);
+        std::copy(costs.begin(), costs.end(), data.portal_costs.begin() + static_cast<std::ptrdiff_t>(i * n));
+    }
+}
+
+std::vector<float> NavClusterGraph::local_costs(const INavMesh& mesh,
+                                                std::uint32_t cluster,
+                                                std::uint32_t source) const {
+    const Cluster& data = m_clusters[cluster];
+    std::vector<float> costs(data.portals.size(), k_unreachable);
+
+    // Dijkstra over the polygons of one cluster
+    std::unordered_map<std::uint32_t, float> distance;
+    distance.reserve(data.polygons.size());
+    std::vector<OpenEntry> open;
+
+    distance[source] = 0;
+    open.push_back({0, 0, source});
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), std::greater<>{});
+        OpenEntry current = open.back();
+        open.pop_back();
+        if (current.g_cost > distance[current.polygon]) continue;
+
+        std::uint32_t portal = m_portal_index[current.polygon];
+        if (portal != k_invalid) {
+            costs[portal] = current.g_cost;
+        }
+
+        const NavPolygon* poly = mesh.polygon(current.polygon);
+        for (std::uint32_t neighbor : poly->neighbors) {
+            if (cluster_of(neighbor) != cluster) continue;
+
+            const NavPolygon* neighbor_poly = mesh.polygon(neighbor);
+            float g = current.g_cost + center_distance(*poly, *neighbor_poly) * neighbor_poly->cost;
+
+            auto [it, inserted] = distance.try_emplace(neighbor, g);
+            if (!inserted) {
+                if (g >= it->second) continue;
+                it->second = g;
+            }
+            open.push_back({g, g, neighbor});
+            std::push_heap(open.begin(), open.end(), std::greater<>{});
+        }
+    }
+
+    return costs;
+}
+
+std::vector<std::uint32_t> NavClusterGraph::find_corridor(const INavMesh& mesh,
+                                                          std::uint32_t start_polygon,
+                                                          std::uint32_t goal_polygon) const {
+    std::uint32_t start_cluster = cluster_of(start_polygon);
+    std::uint32_t goal_cluster = cluster_of(goal_polygon);
+    if (start_cluster == k_invalid || goal_cluster == k_invalid) {
+        return {};
+    }
+    if (start_cluster == goal_cluster) {
+        return {start_cluster};
+    }
+
+    const Cluster& goal_data = m_clusters[goal_cluster];
+    auto start_costs = local_costs(mesh, start_cluster, start_polygon);
+    auto goal_costs = local_costs(mesh, goal_cluster, goal_polygon);
+    const void_math::Vec3 goal_center = mesh.polygon(goal_polygon)->center;
+
+    struct Node {
+        float g_cost{0};
+        std::uint32_t parent{k_invalid};
+        bool closed{false};
+    };
+    std::unordered_map<std::uint32_t, Node> nodes;
+    std::vector<OpenEntry> open;
+
+    auto relax = [&](std::uint32_t polygon, float g, std::uint32_t parent) {
+        auto [it, inserted] = nodes.try_emplace(polygon);
+        if (!inserted && (it->second.closed || g >= it->second.g_cost)) return;
+        it->second.g_cost = g;
+        it->second.parent = parent;
+        open.push_back({g + point_distance(mesh.polygon(polygon)->center, goal_center), g, polygon});
+        std::push_heap(open.begin(), open.end(), std::greater<>{});
+    };
+
+    const Cluster& start_data = m_clusters[start_cluster];
+    for (std::size_t i = 0; i < start_data.portals.size(); ++i) {
+        if (start_costs[i] < k_unreachable) {
+            relax(start_data.portals[i], start_costs[i], k_invalid);
+        }
+    }
+
+    // Portal-level A*; the goal is entered through any portal of its cluster
+    float best_cost = k_unreachable;
+    std::uint32_t best_portal = k_invalid;
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), std::greater<>{});
+        OpenEntry current = open.back();
+        open.pop_back();
+
+        if (current.f_cost >= best_cost) break;
+
+        Node& node = nodes[current.polygon];
+        if (node.closed || current.g_cost > node.g_cost) continue;
+        node.closed = true;
+
+        std::uint32_t cluster = m_polygon_cluster[current.polygon];
+        std::uint32_t local = m_portal_index[current.polygon];
+        if (cluster == goal_cluster && goal_costs[local] < k_unreachable) {
+            float total = current.g_cost + goal_costs[local];
+            if (total < best_cost) {
+                best_cost = total;
+                best_portal = current.polygon;
+            }
+        }
+
+        const Cluster& data = m_clusters[cluster];
+        std::size_t n = data.portals.size();
+        for (std::size_t j = 0; j < n; ++j) {
+            float cost = data.portal_costs[local * n + j];
+            if (j != local && cost < k_unreachable) {
+                relax(data.portals[j], current.g_cost + cost, current.polygon);
+            }
+        }
+
+        const NavPolygon* poly = mesh.polygon(current.polygon);
+        for (std::uint32_t neighbor : poly->neighbors) {
+            std::uint32_t other = cluster_of(neighbor);
+            if (other == k_invalid || other == cluster) continue;
+
+            const NavPolygon* neighbor_poly = mesh.polygon(neighbor);
+            relax(neighbor, current.g_cost + center_distance(*poly, *neighbor_poly) * neighbor_poly->cost,
+                  current.polygon);
+        }
+    }
+
+    if (best_portal == k_invalid || goal_data.polygons.empty()) {
+        return {};
+    }
+
+    std::vector<std::uint32_t> corridor;
+    for (std::uint32_t p = best_portal; p != k_invalid; p = nodes[p].parent) {
+        std::uint32_t cluster = m_polygon_cluster[p];
+        if (corridor.empty() || corridor.back() != cluster) {
+            corridor.push_back(cluster);
+        }
+    }
+    std::reverse(corridor.begin(), corridor.end());
+    return corridor;
+}
+
+// =============================================================================
+// NavCorridorCache Implementation
+// =============================================================================
+
+NavCorridorCache::NavCorridorCache(std::size_t capacity)
+    : m_capacity(capacity) {
+}
+
+bool NavCorridorCache::find(std::uint32_t start_cluster,
+                            std::uint32_t goal_cluster,
+                            std::vector<std::uint32_t>& out_corridor) {
+    std::lock_guard lock(m_mutex);
+
+    auto it = m_index.find(corridor_key(start_cluster, goal_cluster));
+    if (it == m_index.end()) {
+        ++m_misses;
+        return false;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    out_corridor = it->second->corridor;
+    ++m_hits;
+    return true;
+}
+
+void NavCorridorCache::store(std::uint32_t start_cluster,
+                             std::uint32_t goal_cluster,
+                             std::vector<std::uint32_t> corridor) {
+    std::lock_guard lock(m_mutex);
+    if (m_capacity == 0) return;
+
+    std::uint64_t key = corridor_key(start_cluster, goal_cluster);
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        it->second->corridor = std::move(corridor);
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    m_entries.push_front(Entry{key, std::move(corridor)});
+    m_index[key] = m_entries.begin();
+    trim();
+}
+
+void NavCorridorCache::clear() {
+    std::lock_guard lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+}
+
+void NavCorridorCache::set_capacity(std::size_t capacity) {
+    std::lock_guard lock(m_mutex);
+    m_capacity = capacity;
+    trim();
+}
+
+std::size_t NavCorridorCache::capacity() const {
+    std::lock_guard lock(m_mutex);
+    return m_capacity;
+}
+
+std::size_t NavCorridorCache::size() const {
+    std::lock_guard lock(m_mutex);
+    return m_entries.size();
+}
+
+std::size_t NavCorridorCache::hits() const {
+    std::lock_guard lock(m_mutex);
+    return m_hits;
+}
+
+std::size_t NavCorridorCache::misses() const {
+    std::lock_guard lock(m_mutex);
+    return m_misses;
+}
+
+void NavCorridorCache::trim() {
+    while (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+}
+
+// =============================================================================
+// NavPathQueue Implementation
+// =============================================================================
+
+NavPathQueue::NavPathQueue() = default;
+NavPathQueue::~NavPathQueue() = default;
+
+void NavPathQueue::bind(const INavMesh* navmesh,
+                        const NavClusterGraph* clusters,
+                        NavCorridorCache* cache) {
+    if (navmesh != m_navmesh || clusters != m_clusters) {
+        // Searches in flight hold polygon indices of the previous mesh
+        for (auto& request : m_pending) {
+            request.started = false;
+        }
+    }
+
+    m_navmesh = navmesh;
+    m_clusters = clusters;
+    m_query = NavMeshQuery(navmesh);
+    m_query.set_cluster_graph(clusters);
+    m_query.set_corridor_cache(cache);
+}
+
+PathId NavPathQueue::request(const void_math::Vec3& start, const void_math::Vec3& end) {
+    Request request;
+    request.id = PathId{m_next_id++};
+    request.start = start;
+    request.end = end;
+    m_pending.push_back(std::move(request));
+    return m_pending.back().id;
+}
+
+void NavPathQueue::cancel(PathId id) {
+    m_completed.erase(id);
+
+    auto it = std::find_if(m_pending.begin(), m_pending.end(),
+        [id](const Request& request) { return request.id == id; });
+    if (it == m_pending.end()) return;
+
+    if (it->search && m_spare_searches.size() < k_max_spare_searches) {
+        m_spare_searches.push_back(std::move(it->search));
+    }
+    m_pending.erase(it);
+}
+
+void NavPathQueue::clear() {
+    m_pending.clear();
+    m_completed.clear();
+}
+
+std::size_t NavPathQueue::process(std::size_t max_iterations) {
+    if (m_pending.empty() || max_iterations == 0) return 0;
+
+    // Hand out recycled node storage before the workers start
+    for (auto& request : m_pending) {
+        if (!request.search && !m_spare_searches.empty()) {
+            request.search = std::move(m_spare_searches.back());
+            m_spare_searches.pop_back();
+        }
+    }
+
+    // Requests are served oldest first; each worker keeps drawing slices from
+    // the shared budget until its request finishes or the budget runs out
+    std::atomic<std::int64_t> budget{static_cast<std::int64_t>(
+        std::min<std::size_t>(max_iterations, std::numeric_limits<std::int64_t>::max()))};
+    std::atomic<std::size_t> next{0};
+
+    auto worker = [&]() {
+        for (;;) {
+            std::size_t index = next.fetch_add(1);
+            if (index >= m_pending.size()) return;
+
+            Request& request = m_pending[index];
+            if (request.done) continue;
+
+            for (;;) {
+                std::int64_t available = budget.fetch_sub(k_slice_iterations);
+                if (available <= 0) return;
+                auto grant = static_cast<std::size_t>(std::min(available, k_slice_iterations));
+
+                if (!request.started) {
+                    request.search = m_query.begin_search(request.start, request.end, 0,
+                                                          std::move(request.search));
+                    request.started = true;
+                }
+
+                std::size_t used = 0;
+                bool finished = m_query.continue_search(*request.search, grant, &used);
+                budget.fetch_add(static_cast<std::int64_t>(grant - used));
+
+                if (finished) {
+                    request.result = m_query.finish_search(*request.search);
+                    if (request.result.complete || request.result.partial) {
+                        m_query.smooth_path(request.result);
+                    }
+                    request.done = true;
+                    break;
+                }
+            }
+        }
+    };
+
+    std::size_t worker_count = std::min<std::size_t>(
+        m_max_workers > 0 ? m_max_workers : std::max(1u, std::thread::hardware_concurrency()),
+        std::min(m_pending.size(), max_iterations / k_parallel_iterations));
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 1; t < worker_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::size_t finished = 0;
+    for (auto& request : m_pending) {
+        if (!request.done) continue;
+
+        m_completed[request.id] = std::move(request.result);
+        if (m_spare_searches.size() < k_max_spare_searches) {
+            m_spare_searches.push_back(std::move(request.search));
+        }
+        ++finished;
+    }
+    m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(),
+                                   [](const Request& request) { return request.done; }),
+                    m_pending.end());
+    return finished;
+}
+
+bool NavPathQueue::poll(PathId id, PathResult& out_result) {
+    auto it = m_completed.find(id);
+    if (it == m_completed.end()) return false;
+
+    out_result = std::move(it->second);
+    m_completed.erase(it);
+    return true;
+}
+
+bool NavPathQueue::is_pending(PathId id) const {
+    return std::any_of(m_pending.begin(), m_pending.end(),
+        [id](const Request& request) { return request.id == id; });
+}
+
+} // namespace void_ai
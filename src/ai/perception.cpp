@@ -4,7 +4,9 @@
 #include <void_engine/ai/perception.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <thread>
 
 namespace void_ai {
 
@@ -44,6 +46,77 @@ float vec3_distance(const void_math::Vec3& a, const void_math::Vec3& b) {
 constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
 constexpr float RAD_TO_DEG = 180.0f / 3.14159265358979f;
 
+// Perceivers handed to a worker at a time
+constexpr std::size_t k_chunk = 16;
+
+std::uint32_t hash_cell(std::int32_t x, std::int32_t z, std::uint32_t mask) {
+    return (static_cast<std::uint32_t>(x) * 73856093u ^ static_cast<std::uint32_t>(z) * 19349663u) & mask;
+}
+
+std::int32_t cell_coord(float value, float cell_size) {
+    return static_cast<std::int32_t>(std::floor(value / cell_size));
+}
+
+/// Remove the flagged stimuli, keeping the order of the rest
+void erase_flagged(std::vector<Stimulus>& stimuli, const std::vector<std::uint8_t>& flagged) {
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < stimuli.size(); ++i) {
+        if (flagged[i]) continue;
+        if (out != i) {
+            stimuli[out] = std::move(stimuli[i]);
+        }
+        ++out;
+    }
+    stimuli.resize(out);
+}
+
+/// Run deferred rays through the sense's own line of sight check
+void resolve_rays(const ISense& sense,
+                  std::vector<Stimulus>& stimuli,
+                  const std::vector<LineOfSightRay>& rays,
+                  const std::vector<std::uint32_t>& ray_stimuli) {
+    if (rays.empty()) return;
+
+    std::vector<std::uint8_t> blocked(stimuli.size(), 0);
+    for (std::size_t r = 0; r < rays.size(); ++r) {
+        if (!sense.line_of_sight(rays[r].from, rays[r].to)) {
+            blocked[ray_stimuli[r]] = 1;
+        }
+    }
+    erase_flagged(stimuli, blocked);
+}
+
+/// Call fn(index) for [0, count), splitting the range across worker threads
+template<typename Fn>
+void parallel_for(std::size_t count, std::uint32_t max_workers, Fn&& fn) {
+    std::atomic<std::size_t> next{0};
+
+    auto worker = [&]() {
+        for (;;) {
+            std::size_t begin = next.fetch_add(k_chunk);
+            if (begin >= count) return;
+            std::size_t end = std::min(begin + k_chunk, count);
+            for (std::size_t i = begin; i < end; ++i) {
+                fn(i);
+            }
+        }
+    };
+
+    // Few perceivers stay on the calling thread
+    std::size_t worker_count = std::min<std::size_t>(
+        max_workers > 0 ? max_workers : std::max(1u, std::thread::hardware_concurrency()),
+        count / (k_chunk * 4));
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 1; t < worker_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
 } // anonymous namespace
 
 bool is_in_fov(const void_math::Vec3& forward,
@@ -77,6 +150,19 @@ float attenuate_sound(float loudness, float distance, float max_range) {
     return loudness * attenuation * attenuation;
 }
 
+// =============================================================================
+// ISense Implementation
+// =============================================================================
+
+std::vector<Stimulus> ISense::update_deferred(
+    const void_math::Vec3& perceiver_position,
+    const void_math::Vec3& perceiver_forward,
+    const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+    std::vector<LineOfSightRay>& /*out_rays*/,
+    std::vector<std::uint32_t>& /*out_ray_stimuli*/) {
+    return update(perceiver_position, perceiver_forward, targets);
+}
+
 // =============================================================================
 // SightSense Implementation
 // =============================================================================
@@ -92,16 +178,29 @@ std::vector<Stimulus> SightSense::update(
     const void_math::Vec3& perceiver_forward,
     const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) {
 
+    std::vector<LineOfSightRay> rays;
+    std::vector<std::uint32_t> ray_stimuli;
+    auto stimuli = update_deferred(perceiver_position, perceiver_forward, targets, rays, ray_stimuli);
+    resolve_rays(*this, stimuli, rays, ray_stimuli);
+    return stimuli;
+}
+
+std::vector<Stimulus> SightSense::update_deferred(
+    const void_math::Vec3& perceiver_position,
+    const void_math::Vec3& perceiver_forward,
+    const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+    std::vector<LineOfSightRay>& out_rays,
+    std::vector<std::uint32_t>& out_ray_stimuli) {
+
     std::vector<Stimulus> stimuli;
 
     for (const auto& [target_id, target_pos] : targets) {
         float strength = 0;
         if (is_in_view(perceiver_position, perceiver_forward, target_pos, strength)) {
-            // Check line of sight if enabled
-            if (m_config.use_los_check && m_los_check) {
-                if (!m_los_check(perceiver_position, target_pos)) {
-                    continue;  // LOS blocked
-                }
+            // Line of sight is resolved by the caller
+            if (m_config.use_los_check) {
+                out_ray_stimuli.push_back(static_cast<std::uint32_t>(stimuli.size()));
+                out_rays.push_back({perceiver_position, target_pos, m_config.los_collision_mask});
             }
 
             Stimulus stim;
@@ -118,12 +217,27 @@ std::vector<Stimulus> SightSense::update(
     return stimuli;
 }
 
+bool SightSense::line_of_sight(const void_math::Vec3& from, const void_math::Vec3& to) const {
+    return !m_los_check || m_los_check(from, to);
+}
+
+float SightSense::query_radius() const {
+    return std::max(m_config.view_distance, m_config.peripheral_distance);
+}
+
 bool SightSense::is_in_view(const void_math::Vec3& perceiver_pos,
                            const void_math::Vec3& perceiver_fwd,
                            const void_math::Vec3& target_pos,
                            float& out_strength) const {
     auto to_target = vec3_sub(target_pos, perceiver_pos);
-    float dist = vec3_length(to_target);
+
+    // Reject out of range targets before the angle math
+    float max_dist = query_radius();
+    float dist_sq = vec3_dot(to_target, to_target);
+    if (dist_sq > max_dist * max_dist) {
+        return false;
+    }
+    float dist = std::sqrt(dist_sq);
 
     if (dist < 1e-6f) {
         out_strength = 1.0f;
@@ -281,9 +395,23 @@ ProximitySense::ProximitySense(const ProximityConfig& config)
 
 std::vector<Stimulus> ProximitySense::update(
     const void_math::Vec3& perceiver_position,
-    const void_math::Vec3& /*perceiver_forward*/,
+    const void_math::Vec3& perceiver_forward,
     const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) {
 
+    std::vector<LineOfSightRay> rays;
+    std::vector<std::uint32_t> ray_stimuli;
+    auto stimuli = update_deferred(perceiver_position, perceiver_forward, targets, rays, ray_stimuli);
+    resolve_rays(*this, stimuli, rays, ray_stimuli);
+    return stimuli;
+}
+
+std::vector<Stimulus> ProximitySense::update_deferred(
+    const void_math::Vec3& perceiver_position,
+    const void_math::Vec3& /*perceiver_forward*/,
+    const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+    std::vector<LineOfSightRay>& out_rays,
+    std::vector<std::uint32_t>& out_ray_stimuli) {
+
     std::vector<Stimulus> stimuli;
     float range = m_config.range * m_range_multiplier;
 
@@ -291,11 +419,10 @@ std::vector<Stimulus> ProximitySense::update(
         float dist = vec3_distance(perceiver_position, target_pos);
 
         if (dist <= range) {
-            // Check LOS if required
-            if (m_config.los_required && m_los_check) {
-                if (!m_los_check(perceiver_position, target_pos)) {
-                    continue;
-                }
+            // LOS, if required, is resolved by the caller
+            if (m_config.los_required) {
+                out_ray_stimuli.push_back(static_cast<std::uint32_t>(stimuli.size()));
+                out_rays.push_back({perceiver_position, target_pos});
             }
 
             Stimulus stim;
@@ -311,6 +438,10 @@ std::vector<Stimulus> ProximitySense::update(
     return stimuli;
 }
 
+bool ProximitySense::line_of_sight(const void_math::Vec3& from, const void_math::Vec3& to) const {
+    return !m_los_check || m_los_check(from, to);
+}
+
 // =============================================================================
 // PerceptionComponent Implementation
 // =============================================================================
@@ -327,6 +458,10 @@ void PerceptionComponent::remove_sense(SenseType type) {
         std::remove_if(m_senses.begin(), m_senses.end(),
             [type](const auto& s) { return s->type() == type; }),
         m_senses.end());
+
+    // Cached results are indexed by sense
+    m_sense_stimuli.clear();
+    m_sense_fresh.clear();
 }
 
 ISense* PerceptionComponent::get_sense(SenseType type) {
@@ -340,6 +475,8 @@ ISense* PerceptionComponent::get_sense(SenseType type) {
 
 void PerceptionComponent::clear_senses() {
     m_senses.clear();
+    m_sense_stimuli.clear();
+    m_sense_fresh.clear();
 }
 
 void PerceptionComponent::setup_default_senses() {
@@ -351,14 +488,84 @@ void PerceptionComponent::setup_default_senses() {
 
 void PerceptionComponent::update(float dt,
                                   const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets) {
+    begin_update(targets, true);
+    finish_update(dt, targets, {});
+}
+
+void PerceptionComponent::begin_update(
+    const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+    bool refresh_staggered) {
+
+    m_sense_stimuli.resize(m_senses.size());
+    m_sense_fresh.resize(m_senses.size(), 0);
+    m_pending_rays.clear();
+    m_pending_ray_owners.clear();
+
+    for (std::uint32_t i = 0; i < m_senses.size(); ++i) {
+        ISense& sense = *m_senses[i];
+        if (!sense.is_enabled()) {
+            m_sense_stimuli[i].clear();
+            m_sense_fresh[i] = 0;
+            continue;
+        }
+
+        // Senses that may call back into the game run in finish_update()
+        if (!sense.supports_deferred()) continue;
+
+        // Staggered senses keep their last results between refreshes
+        if (sense.is_staggered() && !refresh_staggered && m_sense_fresh[i]) continue;
+
+        m_ray_scratch.clear();
+        m_sense_stimuli[i] = sense.update_deferred(m_position, m_forward, targets,
+                                                   m_pending_rays, m_ray_scratch);
+        for (std::uint32_t stimulus : m_ray_scratch) {
+            m_pending_ray_owners.emplace_back(i, stimulus);
+        }
+        m_sense_fresh[i] = 1;
+    }
+}
+
+void PerceptionComponent::finish_update(
+    float dt,
+    const std::vector<std::pair<PerceptionTargetId, void_math::Vec3>>& targets,
+    std::span<const std::uint8_t> ray_visible) {
+
+    // Drop stimuli whose line of sight is blocked; rays are grouped by sense
+    std::size_t r = 0;
+    while (r < m_pending_rays.size()) {
+        const std::uint32_t sense_index = m_pending_ray_owners[r].first;
+        auto& stimuli = m_sense_stimuli[sense_index];
+        std::vector<std::uint8_t> blocked(stimuli.size(), 0);
+        bool any_blocked = false;
+
+        for (; r < m_pending_rays.size() && m_pending_ray_owners[r].first == sense_index; ++r) {
+            const auto& ray = m_pending_rays[r];
+            bool visible = ray_visible.empty()
+                ? m_senses[sense_index]->line_of_sight(ray.from, ray.to)
+                : ray_visible[r] != 0;
+            if (!visible) {
+                blocked[m_pending_ray_owners[r].second] = 1;
+                any_blocked = true;
+            }
+        }
+
+        if (any_blocked) {
+            erase_flagged(stimuli, blocked);
+        }
+    }
+    m_pending_rays.clear();
+    m_pending_ray_owners.clear();
+
     std::vector<Stimulus> all_stimuli;
 
-    // Update all senses
-    for (auto& sense : m_senses) {
-        if (!sense->is_enabled()) continue;
+    for (std::uint32_t i = 0; i < m_senses.size(); ++i) {
+        ISense& sense = *m_senses[i];
+        if (!sense.is_enabled()) continue;
 
-        auto stimuli = sense->update(m_position, m_forward, targets);
-        all_stimuli.insert(all_stimuli.end(), stimuli.begin(), stimuli.end());
+        if (!sense.supports_deferred()) {
+            m_sense_stimuli[i] = sense.update(m_position, m_forward, targets);
+        }
+        all_stimuli.insert(all_stimuli.end(), m_sense_stimuli[i].begin(), m_sense_stimuli[i].end());
     }
 
     // Process stimuli
@@ -368,6 +575,16 @@ void PerceptionComponent::update(float dt,
     update_known_targets(dt);
 }
 
+float PerceptionComponent::query_radius() const {
+    float radius = 0;
+    for (const auto& sense : m_senses) {
+        if (sense->is_enabled()) {
+            radius = std::max(radius, sense->query_radius());
+        }
+    }
+    return radius;
+}
+
 bool PerceptionComponent::knows_target(PerceptionTargetId id) const {
     for (const auto& target : m_known_targets) {
         if (target.target_id == id) {
@@ -561,10 +778,21 @@ bool StimulusSource::has_tag(std::string_view tag) const {
 // =============================================================================
 
 PerceptionSystem::PerceptionSystem() = default;
+
+PerceptionSystem::PerceptionSystem(const PerceptionSystemConfig& config)
+    : m_config(config) {
+}
+
 PerceptionSystem::~PerceptionSystem() = default;
 
 PerceptionComponent* PerceptionSystem::create_perceiver() {
-    m_perceivers.push_back(std::make_unique<PerceptionComponent>());
+    auto perceiver = std::make_unique<PerceptionComponent>();
+
+    // Spread staggered refreshes of new perceivers over the longest interval
+    float phase = std::fmod(static_cast<float>(m_perceivers.size()) * 0.618034f, 1.0f);
+    perceiver->m_stagger_elapsed = phase * m_config.far_interval;
+
+    m_perceivers.push_back(std::move(perceiver));
     return m_perceivers.back().get();
 }
 
@@ -577,6 +805,7 @@ void PerceptionSystem::destroy_perceiver(PerceptionComponent* perceiver) {
 
 StimulusSource* PerceptionSystem::create_stimulus_source() {
     m_sources.push_back(std::make_unique<StimulusSource>());
+    m_index_valid = false;
     return m_sources.back().get();
 }
 
@@ -590,6 +819,7 @@ void PerceptionSystem::destroy_stimulus_source(StimulusSource* source) {
         std::remove_if(m_sources.begin(), m_sources.end(),
             [source](const auto& s) { return s.get() == source; }),
         m_sources.end());
+    m_index_valid = false;
 }
 
 PerceptionTargetId PerceptionSystem::register_target(StimulusSource* source) {
@@ -608,10 +838,52 @@ void PerceptionSystem::unregister_target(PerceptionTargetId id) {
 }
 
 void PerceptionSystem::update(float dt) {
-    auto targets = gather_targets();
+    build_source_index();
+
+    // Pick the perceivers whose staggered senses refresh this update
+    const std::size_t count = m_perceivers.size();
+    m_refresh.assign(count, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& perceiver = *m_perceivers[i];
+        perceiver.m_stagger_elapsed += dt;
+        if (perceiver.m_stagger_elapsed >= sight_interval(perceiver)) {
+            perceiver.m_stagger_elapsed = 0;
+            m_refresh[i] = 1;
+        }
+    }
 
-    for (auto& perceiver : m_perceivers) {
-        perceiver->update(dt, targets);
+    // Gather nearby targets and run the deferrable senses on workers
+    parallel_for(count, m_config.max_workers, [this](std::size_t i) {
+        auto& perceiver = *m_perceivers[i];
+        gather_candidates(perceiver);
+        perceiver.begin_update(perceiver.m_candidates, m_refresh[i] != 0);
+    });
+
+    // Resolve every line of sight ray in one batch
+    m_rays.clear();
+    m_ray_offsets.resize(count + 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        m_ray_offsets[i] = m_rays.size();
+        const auto& rays = m_perceivers[i]->pending_rays();
+        m_rays.insert(m_rays.end(), rays.begin(), rays.end());
+    }
+    m_ray_offsets[count] = m_rays.size();
+
+    const bool batched = m_los_batch_check && !m_rays.empty();
+    if (batched) {
+        m_ray_visible.assign(m_rays.size(), 1);
+        m_los_batch_check(m_rays, m_ray_visible);
+    }
+
+    // Remaining senses and perception events run on the calling thread
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& perceiver = *m_perceivers[i];
+        std::span<const std::uint8_t> visible;
+        if (batched) {
+            visible = std::span<const std::uint8_t>(m_ray_visible)
+                .subspan(m_ray_offsets[i], m_ray_offsets[i + 1] - m_ray_offsets[i]);
+        }
+        perceiver.finish_update(dt, perceiver.m_candidates, visible);
     }
 }
 
@@ -620,12 +892,9 @@ std::vector<StimulusSource*> PerceptionSystem::get_sources_in_radius(
     float radius) const {
     std::vector<StimulusSource*> result;
 
-    for (const auto& source : m_sources) {
-        float dist = vec3_distance(center, source->position());
-        if (dist <= radius) {
-            result.push_back(source.get());
-        }
-    }
+    for_each_source_in_radius(center, radius, [&](std::uint32_t source) {
+        result.push_back(m_sources[source].get());
+    });
 
     return result;
 }
@@ -661,17 +930,117 @@ std::uint64_t PerceptionSystem::make_team_key(std::uint32_t a, std::uint32_t b)
     return (static_cast<std::uint64_t>(a) << 32) | b;
 }
 
-std::vector<std::pair<PerceptionTargetId, void_math::Vec3>> PerceptionSystem::gather_targets() const {
-    std::vector<std::pair<PerceptionTargetId, void_math::Vec3>> targets;
-    targets.reserve(m_sources.size());
+void PerceptionSystem::build_source_index() {
+    m_cell_size = std::max(m_config.cell_size, 0.01f);
+
+    const auto count = static_cast<std::uint32_t>(m_sources.size());
+    std::uint32_t table_size = 1;
+    while (table_size < count * 2) {
+        table_size <<= 1;
+    }
+    const std::uint32_t mask = table_size - 1;
+
+    m_source_cell.resize(count);
+    m_cell_start.assign(table_size + 1, 0);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const auto& pos = m_sources[i]->position();
+        std::uint32_t cell = hash_cell(cell_coord(pos.x, m_cell_size),
+                                       cell_coord(pos.z, m_cell_size), mask);
+        m_source_cell[i] = cell;
+        ++m_cell_start[cell + 1];
+    }
+    for (std::uint32_t c = 0; c < table_size; ++c) {
+        m_cell_start[c + 1] += m_cell_start[c];
+    }
+
+    m_cell_sources.resize(count);
+    std::vector<std::uint32_t> fill(m_cell_start.begin(), m_cell_start.end() - 1);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        m_cell_sources[fill[m_source_cell[i]]++] = i;
+    }
+
+    m_index_valid = true;
+}
+
+template<typename Fn>
+void PerceptionSystem::for_each_source_in_radius(const void_math::Vec3& center,
+                                                 float radius,
+                                                 Fn&& fn) const {
+    const float radius_sq = radius * radius;
+    auto visit = [&](std::uint32_t source) {
+        auto offset = vec3_sub(m_sources[source]->position(), center);
+        if (vec3_dot(offset, offset) <= radius_sq) {
+            fn(source);
+        }
+    };
+
+    const auto count = static_cast<std::uint32_t>(m_sources.size());
+    const auto table_size = static_cast<std::uint32_t>(m_cell_start.size()) - 1;
+
+    // Without a hash, or when the radius covers more cells than buckets, scan everything
+    bool scan_all = !m_index_valid || !std::isfinite(radius);
+    std::int32_t x0 = 0, x1 = 0, z0 = 0, z1 = 0;
+    if (!scan_all) {
+        x0 = cell_coord(center.x - radius, m_cell_size);
+        x1 = cell_coord(center.x + radius, m_cell_size);
+        z0 = cell_coord(center.z - radius, m_cell_size);
+        z1 = cell_coord(center.z + radius, m_cell_size);
+        scan_all = static_cast<std::int64_t>(x1 - x0 + 1) * (z1 - z0 + 1) >= table_size;
+    }
+    if (scan_all) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            visit(i);
+        }
+        return;
+    }
+
+    // Distinct cells can share a bucket; visit each bucket once
+    thread_local std::vector<std::uint32_t> visited;
+    visited.clear();
+    const std::uint32_t mask = table_size - 1;
+
+    for (std::int32_t z = z0; z <= z1; ++z) {
+        for (std::int32_t x = x0; x <= x1; ++x) {
+            std::uint32_t bucket = hash_cell(x, z, mask);
+            if (std::find(visited.begin(), visited.end(), bucket) != visited.end()) {
+                continue;
+            }
+            visited.push_back(bucket);
+
+            for (std::uint32_t i = m_cell_start[bucket]; i < m_cell_start[bucket + 1]; ++i) {
+                visit(m_cell_sources[i]);
+            }
+        }
+    }
+}
+
+void PerceptionSystem::gather_candidates(PerceptionComponent& perceiver) const {
+    perceiver.m_candidates.clear();
+
+    float radius = perceiver.query_radius();
+    if (radius <= 0) return;
 
-    for (const auto& source : m_sources) {
-        if (source->target_id() && source->is_visible()) {
-            targets.emplace_back(source->target_id(), source->position());
+    for_each_source_in_radius(perceiver.position(), radius, [&](std::uint32_t index) {
+        const StimulusSource& source = *m_sources[index];
+        if (source.target_id() && source.is_visible()) {
+            perceiver.m_candidates.emplace_back(source.target_id(), source.position());
         }
+    });
+}
+
+float PerceptionSystem::sight_interval(const PerceptionComponent& perceiver) const {
+    float interval = m_config.near_interval;
+
+    if (m_has_focus) {
+        float dist = vec3_distance(perceiver.position(), m_focus);
+        float span = m_config.far_distance - m_config.near_distance;
+        float t = span > 0 ? std::clamp((dist - m_config.near_distance) / span, 0.0f, 1.0f)
+                           : (dist > m_config.near_distance ? 1.0f : 0.0f);
+        interval += (m_config.far_interval - m_config.near_interval) * t;
     }
 
-    return targets;
+    return interval / std::max(perceiver.priority(), 0.01f);
 }
 
 } // namespace void_ai
@@ -1,7 +1,7 @@
 /// @file asset_registry.cpp
 /// @brief Hot-reloadable asset registry implementation
 ///
-/// Uses existing void_core hot-reload infrastructure (HotReloadSystem, PollingFileWatcher)
+/// Uses existing void_core hot-reload infrastructure (HotReloadSystem, FileWatcher)
 /// and void_asset server infrastructure (AssetServer, AssetStorage).
 
 #include <void_engine/asset/asset_registry.hpp>
@@ -30,7 +30,7 @@ public:
     bool hot_reload_enabled = true;
 
     // Hot-reload system using existing void_core infrastructure
-    std::unique_ptr<void_core::PollingFileWatcher> file_watcher;
+    std::unique_ptr<void_core::FileWatcher> file_watcher;
 
     // Path to asset ID mapping for hot-reload
     std::map<std::string, AssetId> watched_paths;
@@ -182,9 +182,9 @@ void_core::Result<void> AssetRegistry::initialize(const std::string& asset_root)
 
     // Set up file watcher for hot-reload using existing void_core infrastructure
     if (m_impl->config.hot_reload_enabled) {
-        // Use PollingFileWatcher from void_core::hot_reload.hpp
+        // Event-driven where supported, polling fallback otherwise
         auto poll_interval = std::chrono::milliseconds(m_impl->config.hot_reload_poll_ms);
-        m_impl->file_watcher = std::make_unique<void_core::PollingFileWatcher>(poll_interval);
+        m_impl->file_watcher = void_core::create_file_watcher(poll_interval);
         spdlog::info("Asset hot-reload enabled for: {} (poll interval: {}ms)",
                      asset_root, m_impl->config.hot_reload_poll_ms);
     }
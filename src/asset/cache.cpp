@@ -1,15 +1,18 @@
 /// @file cache.cpp
 /// @brief void_asset cache implementation
 ///
-/// Provides non-template implementations for the tiered cache system.
-/// Core cache functionality is header-only, this file adds utilities.
+/// Provides the disk-backed WarmCache (content-addressed blobs, log-structured
+/// index, write-behind) and non-template utilities for the tiered cache.
+/// The hot cache and tiered cache remain header-only.
 
 #include <void_engine/asset/cache.hpp>
 
 #include <algorithm>
 #include <cstring>
 #include <iomanip>
+#include <span>
 #include <sstream>
+#include <unordered_set>
 
 namespace void_asset {
 
@@ -102,6 +105,793 @@ CacheEntry create_cache_entry(
     return entry;
 }
 
+// =============================================================================
+// Warm Cache Index Encoding
+// =============================================================================
+
+namespace {
+
+constexpr std::uint32_t k_log_magic = 0x4C435756;       // "VWCL"
+constexpr std::uint32_t k_snapshot_magic = 0x53435756;  // "VWCS"
+constexpr std::uint32_t k_index_version = 2;
+constexpr std::size_t k_log_header_size = 8;
+constexpr std::size_t k_snapshot_header_size = 32;
+constexpr std::size_t k_bucket_size = 16;  // key hash + record offset
+
+constexpr std::uint8_t k_op_put = 1;
+constexpr std::uint8_t k_op_remove = 2;
+
+std::uint64_t key_hash(const std::string& key) {
+    return fnv1a_hash(reinterpret_cast<const std::uint8_t*>(key.data()), key.size());
+}
+
+template<typename T>
+T load_pod(const std::uint8_t* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+template<typename T>
+void append_pod(std::vector<std::uint8_t>& out, T value) {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void append_string(std::vector<std::uint8_t>& out, const std::string& value) {
+    append_pod(out, static_cast<std::uint32_t>(value.size()));
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+/// Check that a stored blob holds exactly `data`
+bool blob_matches(const std::filesystem::path& path, const std::vector<std::uint8_t>& data) {
+    std::error_code ec;
+    if (std::filesystem::file_size(path, ec) != data.size() || ec) {
+        return false;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<char> chunk(64 * 1024);
+    std::size_t offset = 0;
+    while (offset < data.size()) {
+        auto want = std::min(chunk.size(), data.size() - offset);
+        if (!in.read(chunk.data(), static_cast<std::streamsize>(want)) ||
+            std::memcmp(chunk.data(), data.data() + offset, want) != 0) {
+            return false;
+        }
+        offset += want;
+    }
+    return true;
+}
+
+/// Bounds-checked reader over one record body
+struct RecordReader {
+    const std::uint8_t* p;
+    const std::uint8_t* end;
+    bool ok = true;
+
+    template<typename T>
+    T read() {
+        if (!ok || static_cast<std::size_t>(end - p) < sizeof(T)) {
+            ok = false;
+            return T{};
+        }
+        T value = load_pod<T>(p);
+        p += sizeof(T);
+        return value;
+    }
+
+    std::string read_string() {
+        auto length = read<std::uint32_t>();
+        if (!ok || static_cast<std::size_t>(end - p) < length) {
+            ok = false;
+            return {};
+        }
+        std::string value(reinterpret_cast<const char*>(p), length);
+        p += length;
+        return value;
+    }
+};
+
+struct DecodedRecord {
+    std::uint8_t op = 0;
+    std::string key;
+    CacheEntryMeta meta;
+    std::string blob;
+    std::size_t size = 0;  // Encoded size including framing
+};
+
+/// Frame: u32 body length, body, u32 checksum of body
+void encode_record(std::vector<std::uint8_t>& out, std::uint8_t op, const std::string& key,
+                   const CacheEntryMeta* meta, const std::string& blob) {
+    std::size_t start = out.size();
+    append_pod<std::uint32_t>(out, 0);
+
+    append_pod(out, op);
+    append_string(out, key);
+    if (op == k_op_put && meta) {
+        append_string(out, blob);
+        append_pod<std::uint64_t>(out, meta->size_bytes);
+        append_pod<std::uint8_t>(out, static_cast<std::uint8_t>(meta->priority));
+        append_pod<std::int64_t>(out, meta->ttl.count());
+        append_string(out, meta->content_hash);
+        append_string(out, meta->etag);
+        append_string(out, meta->last_modified);
+        append_string(out, meta->source_url);
+        append_string(out, meta->asset_type);
+    }
+
+    auto body_size = static_cast<std::uint32_t>(out.size() - start - sizeof(std::uint32_t));
+    std::memcpy(out.data() + start, &body_size, sizeof(body_size));
+    append_pod(out, static_cast<std::uint32_t>(fnv1a_hash(out.data() + start + sizeof(std::uint32_t), body_size)));
+}
+
+/// Decode the record at `offset`; nullopt if it is truncated or corrupt
+std::optional<DecodedRecord> decode_record(std::span<const std::uint8_t> bytes, std::size_t offset) {
+    if (offset + sizeof(std::uint32_t) > bytes.size()) {
+        return std::nullopt;
+    }
+    auto body_size = load_pod<std::uint32_t>(bytes.data() + offset);
+    std::size_t total = sizeof(std::uint32_t) + body_size + sizeof(std::uint32_t);
+    if (body_size == 0 || offset + total > bytes.size()) {
+        return std::nullopt;
+    }
+
+    const std::uint8_t* body = bytes.data() + offset + sizeof(std::uint32_t);
+    auto checksum = load_pod<std::uint32_t>(body + body_size);
+    if (checksum != static_cast<std::uint32_t>(fnv1a_hash(body, body_size))) {
+        return std::nullopt;
+    }
+
+    RecordReader reader{body, body + body_size};
+    DecodedRecord record;
+    record.size = total;
+    record.op = reader.read<std::uint8_t>();
+    record.key = reader.read_string();
+    if (record.op == k_op_put) {
+        record.blob = reader.read_string();
+        record.meta.size_bytes = reader.read<std::uint64_t>();
+        record.meta.priority = static_cast<CachePriority>(reader.read<std::uint8_t>());
+        record.meta.ttl = std::chrono::seconds(reader.read<std::int64_t>());
+        record.meta.content_hash = reader.read_string();
+        record.meta.etag = reader.read_string();
+        record.meta.last_modified = reader.read_string();
+        record.meta.source_url = reader.read_string();
+        record.meta.asset_type = reader.read_string();
+    } else if (record.op != k_op_remove) {
+        return std::nullopt;
+    }
+
+    if (!reader.ok) {
+        return std::nullopt;
+    }
+    return record;
+}
+
+std::vector<std::uint8_t> index_header(std::uint32_t magic) {
+    std::vector<std::uint8_t> header;
+    append_pod(header, magic);
+    append_pod(header, k_index_version);
+    return header;
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// WarmCache
+// =============================================================================
+
+WarmCache::WarmCache(std::filesystem::path cache_dir, WarmCacheConfig config)
+    : m_config(std::move(config))
+    , m_cache_dir(std::move(cache_dir))
+{
+    open_index();
+    if (m_config.write_behind) {
+        m_writer = std::thread([this] { writer_loop(); });
+    }
+}
+
+WarmCache::~WarmCache() {
+    {
+        std::lock_guard lock(m_queue_mutex);
+        m_stop = true;
+    }
+    m_queue_cv.notify_all();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    } else {
+        flush();
+    }
+}
+
+std::filesystem::path WarmCache::blob_path(const std::string& hash) const {
+    // Two-character fan-out keeps directories small
+    return m_cache_dir / "blobs" / hash.substr(0, 2) / (hash + ".bin");
+}
+
+// -----------------------------------------------------------------------------
+// Index loading
+// -----------------------------------------------------------------------------
+
+void WarmCache::open_index() {
+    std::error_code ec;
+    std::filesystem::create_directories(m_cache_dir / "blobs", ec);
+
+    // Entries from the old one-file-per-key layout are not migrated
+    std::filesystem::remove_all(m_cache_dir / "data", ec);
+    std::filesystem::remove_all(m_cache_dir / "meta", ec);
+
+    // The snapshot is used in place: validate the header, nothing else
+    auto snapshot_path = m_cache_dir / "index.snap";
+    if (std::filesystem::exists(snapshot_path, ec)) {
+        auto mapped = MappedFile::open(snapshot_path.string());
+        if (mapped && mapped.value().size() >= k_snapshot_header_size) {
+            const std::uint8_t* header = mapped.value().data();
+            auto buckets = load_pod<std::uint64_t>(header + 24);
+            bool valid = load_pod<std::uint32_t>(header) == k_snapshot_magic &&
+                         load_pod<std::uint32_t>(header + 4) == k_index_version &&
+                         buckets > 0 && (buckets & (buckets - 1)) == 0 &&
+                         k_snapshot_header_size + buckets * k_bucket_size <= mapped.value().size();
+            if (valid) {
+                m_count = load_pod<std::uint64_t>(header + 8);
+                m_total_bytes = load_pod<std::uint64_t>(header + 16);
+                m_snapshot_buckets = buckets;
+                m_snapshot = std::move(mapped).value();
+            }
+        }
+    }
+
+    replay_log();
+}
+
+void WarmCache::replay_log() {
+    auto log_path = m_cache_dir / "index.log";
+    std::size_t valid_end = 0;
+
+    std::error_code ec;
+    if (std::filesystem::exists(log_path, ec)) {
+        auto mapped = MappedFile::open(log_path.string());
+        if (mapped && mapped.value().size() >= k_log_header_size &&
+            load_pod<std::uint32_t>(mapped.value().data()) == k_log_magic &&
+            load_pod<std::uint32_t>(mapped.value().data() + 4) == k_index_version) {
+
+            auto bytes = mapped.value().bytes();
+            std::size_t offset = k_log_header_size;
+            while (auto record = decode_record(bytes, offset)) {
+                if (record->op == k_op_put) {
+                    track_unlocked(record->key, &record->meta);
+                    m_log_index[record->key] = IndexRecord{std::move(record->meta), std::move(record->blob)};
+                } else {
+                    track_unlocked(record->key, nullptr);
+                    m_log_index[record->key] = std::nullopt;
+                }
+                ++m_log_records;
+                offset += record->size;
+            }
+            valid_end = offset;
+
+            // Drop a torn tail left by a crash mid-append
+            if (valid_end < bytes.size()) {
+                mapped = MappedFile();
+                std::filesystem::resize_file(log_path, valid_end, ec);
+            }
+        }
+    }
+
+    if (valid_end == 0) {
+        reset_log();
+    } else {
+        m_log.open(log_path, std::ios::binary | std::ios::app);
+    }
+}
+
+void WarmCache::reset_log() {
+    m_log.close();
+    m_log.clear();
+    m_log.open(m_cache_dir / "index.log", std::ios::binary | std::ios::trunc);
+    auto header = index_header(k_log_magic);
+    m_log.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    m_log.flush();
+}
+
+// -----------------------------------------------------------------------------
+// Lookup
+// -----------------------------------------------------------------------------
+
+std::optional<WarmCache::IndexRecord> WarmCache::find_snapshot(const std::string& key) const {
+    if (m_snapshot_buckets == 0) {
+        return std::nullopt;
+    }
+
+    auto bytes = m_snapshot.bytes();
+    const std::uint8_t* buckets = bytes.data() + k_snapshot_header_size;
+    std::uint64_t hash = key_hash(key);
+    std::size_t mask = m_snapshot_buckets - 1;
+
+    // Linear probing; an empty bucket (offset 0) ends the chain
+    for (std::size_t probe = 0; probe < m_snapshot_buckets; ++probe) {
+        const std::uint8_t* bucket = buckets + ((hash + probe) & mask) * k_bucket_size;
+        auto offset = load_pod<std::uint64_t>(bucket + 8);
+        if (offset == 0) {
+            return std::nullopt;
+        }
+        if (load_pod<std::uint64_t>(bucket) != hash) {
+            continue;
+        }
+
+        auto record = decode_record(bytes, offset);
+        if (record && record->key == key) {
+            return IndexRecord{std::move(record->meta), std::move(record->blob)};
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<WarmCache::IndexRecord> WarmCache::find_flushed(const std::string& key) const {
+    auto it = m_log_index.find(key);
+    if (it != m_log_index.end()) {
+        return it->second;
+    }
+    return find_snapshot(key);
+}
+
+std::optional<CacheEntryMeta> WarmCache::find_meta_unlocked(const std::string& key) const {
+    auto pending = m_pending.find(key);
+    if (pending != m_pending.end()) {
+        if (!pending->second.entry) {
+            return std::nullopt;
+        }
+        return pending->second.entry->meta;
+    }
+
+    auto record = find_flushed(key);
+    if (!record) {
+        return std::nullopt;
+    }
+    return std::move(record->meta);
+}
+
+void WarmCache::track_unlocked(const std::string& key, const CacheEntryMeta* meta) {
+    if (auto existing = find_meta_unlocked(key)) {
+        --m_count;
+        m_total_bytes -= existing->size_bytes;
+    }
+    if (meta) {
+        ++m_count;
+        m_total_bytes += meta->size_bytes;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Public API
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<CacheEntry> WarmCache::get(const std::string& key) {
+    std::optional<IndexRecord> record;
+    {
+        std::shared_lock lock(m_mutex);
+
+        // Not yet written: serve the queued entry itself
+        auto pending = m_pending.find(key);
+        if (pending != m_pending.end()) {
+            return pending->second.entry;
+        }
+
+        record = find_flushed(key);
+        if (!record) {
+            return nullptr;
+        }
+    }
+
+    std::ifstream file(blob_path(record->blob), std::ios::binary | std::ios::ate);
+    if (!file) {
+        return nullptr;
+    }
+
+    auto entry = std::make_shared<CacheEntry>();
+    entry->meta = std::move(record->meta);
+    entry->meta.last_access = std::chrono::steady_clock::now();
+
+    auto size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    entry->data.resize(static_cast<std::size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(entry->data.data()), size)) {
+        return nullptr;
+    }
+
+    ++m_read_count;
+    return entry;
+}
+
+void WarmCache::put(const std::string& key, std::shared_ptr<CacheEntry> entry) {
+    if (!entry) {
+        return;
+    }
+
+    {
+        std::unique_lock lock(m_mutex);
+        track_unlocked(key, &entry->meta);
+        enqueue_unlocked(key, std::move(entry));
+    }
+
+    if (!m_config.write_behind) {
+        flush();
+    }
+}
+
+bool WarmCache::remove(const std::string& key) {
+    {
+        std::unique_lock lock(m_mutex);
+        if (!find_meta_unlocked(key)) {
+            return false;
+        }
+        track_unlocked(key, nullptr);
+        enqueue_unlocked(key, nullptr);
+    }
+
+    if (!m_config.write_behind) {
+        flush();
+    }
+    return true;
+}
+
+bool WarmCache::contains(const std::string& key) const {
+    std::shared_lock lock(m_mutex);
+    return find_meta_unlocked(key).has_value();
+}
+
+std::optional<CacheEntryMeta> WarmCache::get_meta(const std::string& key) const {
+    std::shared_lock lock(m_mutex);
+    return find_meta_unlocked(key);
+}
+
+void WarmCache::clear() {
+    std::lock_guard io_lock(m_io_mutex);
+    std::unique_lock lock(m_mutex);
+    {
+        std::lock_guard queue_lock(m_queue_mutex);
+        m_queue.clear();
+        ++m_generation;
+    }
+    m_idle_cv.notify_all();
+
+    m_pending.clear();
+    m_log_index.clear();
+    m_snapshot = MappedFile();
+    m_snapshot_buckets = 0;
+    m_count = 0;
+    m_total_bytes = 0;
+    m_log_records = 0;
+
+    std::error_code ec;
+    std::filesystem::remove(m_cache_dir / "index.snap", ec);
+    std::filesystem::remove_all(m_cache_dir / "blobs", ec);
+    std::filesystem::create_directories(m_cache_dir / "blobs", ec);
+    reset_log();
+}
+
+void WarmCache::flush() {
+    if (!m_config.write_behind || !m_writer.joinable()) {
+        std::lock_guard io_lock(m_io_mutex);
+        std::vector<QueuedOp> batch;
+        std::uint64_t generation = 0;
+        {
+            std::lock_guard lock(m_queue_mutex);
+            batch.swap(m_queue);
+            generation = m_generation;
+        }
+        if (!batch.empty()) {
+            write_batch(batch, generation);
+        }
+        return;
+    }
+
+    std::unique_lock lock(m_queue_mutex);
+    m_flush_requested = true;
+    m_queue_cv.notify_one();
+    m_idle_cv.wait(lock, [this] { return m_queue.empty() && !m_writer_busy; });
+    m_flush_requested = false;
+}
+
+void WarmCache::compact() {
+    flush();
+    std::lock_guard io_lock(m_io_mutex);
+    compact_locked();
+}
+
+std::size_t WarmCache::size_bytes() const {
+    std::shared_lock lock(m_mutex);
+    return m_total_bytes;
+}
+
+std::size_t WarmCache::count() const {
+    std::shared_lock lock(m_mutex);
+    return m_count;
+}
+
+std::size_t WarmCache::log_record_count() const {
+    std::shared_lock lock(m_mutex);
+    return m_log_records;
+}
+
+// -----------------------------------------------------------------------------
+// Write-behind
+// -----------------------------------------------------------------------------
+
+void WarmCache::enqueue_unlocked(const std::string& key, std::shared_ptr<CacheEntry> entry) {
+    std::uint64_t seq = m_next_seq++;
+    m_pending[key] = PendingOp{entry, seq};
+    {
+        std::lock_guard lock(m_queue_mutex);
+        m_queue.push_back(QueuedOp{key, std::move(entry), seq});
+    }
+    m_queue_cv.notify_one();
+}
+
+void WarmCache::writer_loop() {
+    std::unique_lock lock(m_queue_mutex);
+    while (true) {
+        m_queue_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty()) {
+            break;  // Stopping with nothing left to write
+        }
+
+        // Give producers a moment to fill the batch
+        if (!m_stop && !m_flush_requested && m_queue.size() < m_config.write_batch_size &&
+            m_config.flush_interval.count() > 0) {
+            m_queue_cv.wait_for(lock, m_config.flush_interval, [this] {
+                return m_stop || m_flush_requested || m_queue.size() >= m_config.write_batch_size;
+            });
+        }
+
+        std::size_t take = std::min(m_queue.size(), std::max<std::size_t>(m_config.write_batch_size, 1));
+        std::vector<QueuedOp> batch(std::make_move_iterator(m_queue.begin()),
+                                    std::make_move_iterator(m_queue.begin() + static_cast<std::ptrdiff_t>(take)));
+        m_queue.erase(m_queue.begin(), m_queue.begin() + static_cast<std::ptrdiff_t>(take));
+        std::uint64_t generation = m_generation;
+        m_writer_busy = true;
+        lock.unlock();
+
+        {
+            std::lock_guard io_lock(m_io_mutex);
+            write_batch(batch, generation);
+        }
+
+        lock.lock();
+        m_writer_busy = false;
+        if (m_queue.empty()) {
+            m_idle_cv.notify_all();
+        }
+    }
+}
+
+void WarmCache::write_batch(std::vector<QueuedOp>& batch, std::uint64_t generation) {
+    {
+        // Batch taken before a clear(); its entries are gone
+        std::lock_guard lock(m_queue_mutex);
+        if (generation != m_generation) {
+            return;
+        }
+    }
+
+    struct Applied {
+        QueuedOp* op;
+        std::optional<IndexRecord> record;
+        bool failed = false;
+    };
+
+    std::vector<Applied> applied;
+    applied.reserve(batch.size());
+    std::vector<std::uint8_t> log_bytes;
+
+    for (auto& op : batch) {
+        if (!op.entry) {
+            encode_record(log_bytes, k_op_remove, op.key, nullptr, {});
+            applied.push_back(Applied{&op, std::nullopt});
+            continue;
+        }
+
+        // Blob name: content hash plus size, so equal payloads share storage.
+        // The hash is not collision-free, so an existing blob is only shared
+        // after a byte compare; a colliding payload probes a suffixed name.
+        const auto& data = op.entry->data;
+        std::ostringstream name;
+        name << compute_content_hash(data) << '-' << std::hex << data.size();
+        std::string base_name = name.str();
+
+        std::string blob = base_name;
+        std::filesystem::path path = blob_path(blob);
+        std::error_code ec;
+        bool stored = false;
+        for (std::uint32_t probe = 1; std::filesystem::exists(path, ec); ++probe) {
+            if (blob_matches(path, data)) {
+                stored = true;
+                break;
+            }
+            blob = base_name + "-c" + std::to_string(probe);
+            path = blob_path(blob);
+        }
+
+        if (stored) {
+            ++m_dedup_count;
+        } else {
+            std::filesystem::create_directories(path.parent_path(), ec);
+            auto tmp_path = path;
+            tmp_path += ".tmp";
+            {
+                std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+                out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+                stored = static_cast<bool>(out);
+            }
+            if (stored) {
+                std::filesystem::rename(tmp_path, path, ec);
+                stored = !ec;
+            }
+            if (!stored) {
+                std::filesystem::remove(tmp_path, ec);
+            }
+        }
+
+        if (!stored) {
+            // Keep the index consistent with disk: the key is dropped
+            encode_record(log_bytes, k_op_remove, op.key, nullptr, {});
+            applied.push_back(Applied{&op, std::nullopt, true});
+            continue;
+        }
+
+        IndexRecord record{op.entry->meta, std::move(blob)};
+        if (record.meta.content_hash.empty()) {
+            record.meta.content_hash = compute_content_hash(data);
+        }
+        encode_record(log_bytes, k_op_put, op.key, &record.meta, record.blob);
+        applied.push_back(Applied{&op, std::move(record)});
+        ++m_write_count;
+    }
+
+    // One append per batch
+    m_log.write(reinterpret_cast<const char*>(log_bytes.data()), static_cast<std::streamsize>(log_bytes.size()));
+    m_log.flush();
+
+    bool needs_compaction = false;
+    {
+        std::unique_lock lock(m_mutex);
+        for (auto& item : applied) {
+            auto pending = m_pending.find(item.op->key);
+            bool latest = pending != m_pending.end() && pending->second.seq == item.op->seq;
+            if (latest) {
+                if (item.failed) {
+                    --m_count;
+                    m_total_bytes -= item.op->entry->meta.size_bytes;
+                }
+                m_pending.erase(pending);
+            }
+            m_log_index[item.op->key] = std::move(item.record);
+            ++m_log_records;
+        }
+
+        std::size_t snapshot_count = m_count > m_log_index.size() ? m_count - m_log_index.size() : 0;
+        needs_compaction = m_log_records >= m_config.compaction_min_records &&
+            static_cast<float>(m_log_records) >= m_config.compaction_ratio * static_cast<float>(snapshot_count);
+    }
+
+    if (needs_compaction) {
+        compact_locked();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Compaction
+// -----------------------------------------------------------------------------
+
+void WarmCache::compact_locked() {
+    std::vector<std::pair<std::string, IndexRecord>> live;
+    std::unordered_set<std::string> live_blobs;
+    std::uint64_t total_bytes = 0;
+    {
+        std::shared_lock lock(m_mutex);
+
+        if (m_snapshot_buckets > 0) {
+            auto bytes = m_snapshot.bytes();
+            std::size_t offset = k_snapshot_header_size + m_snapshot_buckets * k_bucket_size;
+            while (auto record = decode_record(bytes, offset)) {
+                offset += record->size;
+                if (m_log_index.find(record->key) == m_log_index.end()) {
+                    live.emplace_back(std::move(record->key),
+                                      IndexRecord{std::move(record->meta), std::move(record->blob)});
+                }
+            }
+        }
+        for (const auto& [key, record] : m_log_index) {
+            if (record) {
+                live.emplace_back(key, *record);
+            }
+        }
+    }
+
+    // Build the new snapshot: header, bucket table, records
+    std::size_t buckets = 16;
+    while (buckets < live.size() * 2) {
+        buckets <<= 1;
+    }
+
+    std::vector<std::uint8_t> records;
+    std::vector<std::uint8_t> table(buckets * k_bucket_size, 0);
+    std::size_t records_base = k_snapshot_header_size + table.size();
+    for (const auto& [key, record] : live) {
+        std::uint64_t hash = key_hash(key);
+        std::uint64_t offset = records_base + records.size();
+        encode_record(records, k_op_put, key, &record.meta, record.blob);
+        total_bytes += record.meta.size_bytes;
+        live_blobs.insert(record.blob);
+
+        std::size_t slot = hash & (buckets - 1);
+        while (load_pod<std::uint64_t>(table.data() + slot * k_bucket_size + 8) != 0) {
+            slot = (slot + 1) & (buckets - 1);
+        }
+        std::memcpy(table.data() + slot * k_bucket_size, &hash, sizeof(hash));
+        std::memcpy(table.data() + slot * k_bucket_size + 8, &offset, sizeof(offset));
+    }
+
+    auto header = index_header(k_snapshot_magic);
+    append_pod<std::uint64_t>(header, live.size());
+    append_pod<std::uint64_t>(header, total_bytes);
+    append_pod<std::uint64_t>(header, buckets);
+
+    auto snapshot_path = m_cache_dir / "index.snap";
+    auto tmp_path = m_cache_dir / "index.snap.tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        out.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size()));
+        out.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size()));
+        if (!out) {
+            return;
+        }
+    }
+
+    {
+        std::unique_lock lock(m_mutex);
+
+        std::error_code ec;
+        // The old mapping stays valid across the rename (mmap keeps the
+        // replaced file alive; the fallback holds a copy), so it is only
+        // swapped once the new snapshot is in place
+        std::filesystem::rename(tmp_path, snapshot_path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp_path, ec);
+            return;
+        }
+
+        auto mapped = MappedFile::open(snapshot_path.string());
+        if (!mapped) {
+            m_snapshot = MappedFile();
+            m_snapshot_buckets = 0;
+            return;
+        }
+        m_snapshot = std::move(mapped).value();
+        m_snapshot_buckets = buckets;
+
+        // The snapshot now holds everything the log did
+        m_log_index.clear();
+        m_log_records = 0;
+        reset_log();
+    }
+
+    // Sweep blobs no key references; queued puts rewrite theirs if needed
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(m_cache_dir / "blobs", ec);
+         !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+        const auto& path = it->path();
+        if (path.extension() != ".bin" || live_blobs.count(path.stem().string()) == 0) {
+            std::error_code remove_ec;
+            std::filesystem::remove(path, remove_ec);
+        }
+    }
+}
+
 // =============================================================================
 // Validation Utilities
 // =============================================================================
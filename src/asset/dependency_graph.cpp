@@ -0,0 +1,338 @@
+/// @file dependency_graph.cpp
+/// @brief void_asset dependency graph implementation
+
+#include <void_engine/asset/dependency_graph.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+namespace void_asset {
+
+namespace {
+
+void sort_unique(std::vector<AssetId>& ids) {
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// Edges
+// =============================================================================
+
+void AssetDependencyGraph::set_dependencies(AssetId id, const AssetPath& path,
+                                            const std::vector<AssetId>& deps,
+                                            const std::vector<AssetPath>& file_deps) {
+    std::unique_lock lock(m_mutex);
+
+    auto it = m_nodes.find(id);
+    if (it != m_nodes.end()) {
+        unlink(id, it->second);
+    }
+
+    Node node;
+    node.path = path;
+    node.deps.reserve(deps.size());
+    for (const auto& dep : deps) {
+        if (dep.is_valid() && dep != id) {
+            node.deps.push_back(dep);
+        }
+    }
+    sort_unique(node.deps);
+
+    node.file_deps.reserve(file_deps.size());
+    for (const auto& file : file_deps) {
+        if (file.str() != path.str()) {
+            node.file_deps.push_back(file.str());
+        }
+    }
+    std::sort(node.file_deps.begin(), node.file_deps.end());
+    node.file_deps.erase(std::unique(node.file_deps.begin(), node.file_deps.end()),
+                         node.file_deps.end());
+
+    for (const auto& dep : node.deps) {
+        m_dependents[dep].insert(id);
+    }
+    for (const auto& file : node.file_deps) {
+        m_file_dependents[file].insert(id);
+    }
+
+    m_path_to_id[path.str()] = id;
+    m_nodes[id] = std::move(node);
+}
+
+void AssetDependencyGraph::remove(AssetId id) {
+    std::unique_lock lock(m_mutex);
+
+    auto it = m_nodes.find(id);
+    if (it == m_nodes.end()) {
+        return;
+    }
+
+    unlink(id, it->second);
+
+    auto path_it = m_path_to_id.find(it->second.path.str());
+    if (path_it != m_path_to_id.end() && path_it->second == id) {
+        m_path_to_id.erase(path_it);
+    }
+
+    // Dependents keep their file edge to our path, so they still cascade
+    // if the asset is loaded again under a new ID
+    m_dependents.erase(id);
+    m_nodes.erase(it);
+}
+
+void AssetDependencyGraph::clear() {
+    std::unique_lock lock(m_mutex);
+    m_nodes.clear();
+    m_dependents.clear();
+    m_file_dependents.clear();
+    m_path_to_id.clear();
+}
+
+void AssetDependencyGraph::unlink(AssetId id, const Node& node) {
+    for (const auto& dep : node.deps) {
+        auto it = m_dependents.find(dep);
+        if (it != m_dependents.end()) {
+            it->second.erase(id);
+            if (it->second.empty()) {
+                m_dependents.erase(it);
+            }
+        }
+    }
+    for (const auto& file : node.file_deps) {
+        auto it = m_file_dependents.find(file);
+        if (it != m_file_dependents.end()) {
+            it->second.erase(id);
+            if (it->second.empty()) {
+                m_file_dependents.erase(it);
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+bool AssetDependencyGraph::contains(AssetId id) const {
+    std::shared_lock lock(m_mutex);
+    return m_nodes.find(id) != m_nodes.end();
+}
+
+std::size_t AssetDependencyGraph::node_count() const {
+    std::shared_lock lock(m_mutex);
+    return m_nodes.size();
+}
+
+std::size_t AssetDependencyGraph::edge_count() const {
+    std::shared_lock lock(m_mutex);
+    std::size_t count = 0;
+    for (const auto& [id, node] : m_nodes) {
+        count += node.deps.size() + node.file_deps.size();
+    }
+    return count;
+}
+
+std::vector<AssetId> AssetDependencyGraph::dependencies(AssetId id) const {
+    std::shared_lock lock(m_mutex);
+
+    std::vector<AssetId> result;
+    auto it = m_nodes.find(id);
+    if (it != m_nodes.end()) {
+        collect_dependencies(it->second, result);
+        sort_unique(result);
+    }
+    return result;
+}
+
+std::vector<AssetId> AssetDependencyGraph::dependents(AssetId id) const {
+    std::shared_lock lock(m_mutex);
+
+    std::vector<AssetId> result;
+    collect_dependents(id, result);
+    sort_unique(result);
+    return result;
+}
+
+std::vector<AssetId> AssetDependencyGraph::file_dependents(const AssetPath& path) const {
+    std::shared_lock lock(m_mutex);
+
+    std::vector<AssetId> result;
+    auto it = m_file_dependents.find(path.str());
+    if (it != m_file_dependents.end()) {
+        result.assign(it->second.begin(), it->second.end());
+        sort_unique(result);
+    }
+    return result;
+}
+
+void AssetDependencyGraph::collect_dependents(AssetId id, std::vector<AssetId>& out) const {
+    auto it = m_dependents.find(id);
+    if (it != m_dependents.end()) {
+        out.insert(out.end(), it->second.begin(), it->second.end());
+    }
+
+    // Assets that referenced us by path before we had an ID
+    auto node_it = m_nodes.find(id);
+    if (node_it != m_nodes.end()) {
+        auto file_it = m_file_dependents.find(node_it->second.path.str());
+        if (file_it != m_file_dependents.end()) {
+            for (const auto& dependent : file_it->second) {
+                if (dependent != id) {
+                    out.push_back(dependent);
+                }
+            }
+        }
+    }
+}
+
+void AssetDependencyGraph::collect_dependencies(const Node& node, std::vector<AssetId>& out) const {
+    out.insert(out.end(), node.deps.begin(), node.deps.end());
+    for (const auto& file : node.file_deps) {
+        auto it = m_path_to_id.find(file);
+        if (it != m_path_to_id.end()) {
+            out.push_back(it->second);
+        }
+    }
+}
+
+// =============================================================================
+// Invalidation
+// =============================================================================
+
+std::unordered_set<AssetId> AssetDependencyGraph::invalidation_set(
+    const std::vector<AssetId>& changed,
+    const std::vector<AssetPath>& changed_files) const
+{
+    auto reload_plan = plan(changed, changed_files, true);
+
+    std::unordered_set<AssetId> result;
+    for (const auto& wave : reload_plan.waves) {
+        result.insert(wave.begin(), wave.end());
+    }
+    return result;
+}
+
+AssetReloadPlan AssetDependencyGraph::plan(
+    const std::vector<AssetId>& changed,
+    const std::vector<AssetPath>& changed_files,
+    bool cascade) const
+{
+    std::shared_lock lock(m_mutex);
+
+    AssetReloadPlan result;
+
+    // Seed with directly changed assets and anything that resolves from the
+    // changed files (either the asset at that path or assets including it)
+    std::vector<AssetId> stack;
+    for (const auto& id : changed) {
+        if (id.is_valid() && result.roots.insert(id).second) {
+            stack.push_back(id);
+        }
+    }
+    for (const auto& file : changed_files) {
+        auto path_it = m_path_to_id.find(file.str());
+        if (path_it != m_path_to_id.end() && result.roots.insert(path_it->second).second) {
+            stack.push_back(path_it->second);
+        }
+
+        auto file_it = m_file_dependents.find(file.str());
+        if (file_it != m_file_dependents.end()) {
+            for (const auto& dependent : file_it->second) {
+                if (result.roots.insert(dependent).second) {
+                    stack.push_back(dependent);
+                }
+            }
+        }
+    }
+
+    std::unordered_set<AssetId> affected(result.roots.begin(), result.roots.end());
+    if (cascade) {
+        std::vector<AssetId> next;
+        while (!stack.empty()) {
+            AssetId id = stack.back();
+            stack.pop_back();
+
+            next.clear();
+            collect_dependents(id, next);
+            for (const auto& dependent : next) {
+                if (affected.insert(dependent).second) {
+                    stack.push_back(dependent);
+                }
+            }
+        }
+    }
+
+    if (affected.empty()) {
+        return result;
+    }
+
+    // Kahn's algorithm restricted to the affected subgraph, level by level
+    std::unordered_map<AssetId, std::size_t> pending;
+    std::unordered_map<AssetId, std::vector<AssetId>> downstream;
+    std::vector<AssetId> deps;
+    for (const auto& id : affected) {
+        std::size_t count = 0;
+        auto node_it = m_nodes.find(id);
+        if (node_it != m_nodes.end()) {
+            deps.clear();
+            collect_dependencies(node_it->second, deps);
+            sort_unique(deps);
+            for (const auto& dep : deps) {
+                if (dep != id && affected.count(dep) != 0) {
+                    downstream[dep].push_back(id);
+                    ++count;
+                }
+            }
+        }
+        pending[id] = count;
+    }
+
+    std::vector<AssetId> wave;
+    for (const auto& [id, count] : pending) {
+        if (count == 0) {
+            wave.push_back(id);
+        }
+    }
+
+    std::size_t scheduled = 0;
+    while (!wave.empty()) {
+        std::sort(wave.begin(), wave.end());
+        scheduled += wave.size();
+
+        std::vector<AssetId> next_wave;
+        for (const auto& id : wave) {
+            auto it = downstream.find(id);
+            if (it == downstream.end()) {
+                continue;
+            }
+            for (const auto& dependent : it->second) {
+                if (--pending[dependent] == 0) {
+                    next_wave.push_back(dependent);
+                }
+            }
+        }
+
+        result.waves.push_back(std::move(wave));
+        wave = std::move(next_wave);
+    }
+
+    // Whatever is left sits on a cycle; reload it last, in ID order
+    if (scheduled < affected.size()) {
+        result.has_cycle = true;
+        std::vector<AssetId> cyclic;
+        for (const auto& [id, count] : pending) {
+            if (count != 0) {
+                cyclic.push_back(id);
+            }
+        }
+        std::sort(cyclic.begin(), cyclic.end());
+        result.waves.push_back(std::move(cyclic));
+    }
+
+    return result;
+}
+
+} // namespace void_asset
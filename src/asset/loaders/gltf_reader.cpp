@@ -0,0 +1,756 @@
+/// @file gltf_reader.cpp
+/// @brief Zero-copy glTF 2.0 / GLB reader implementation
+
+#include <void_engine/asset/loaders/gltf_reader.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace void_asset {
+
+using json = nlohmann::json;
+
+// =============================================================================
+// Accessor Unpacking
+// =============================================================================
+
+std::size_t gltf_component_size(GltfComponentType type) noexcept {
+    switch (type) {
+        case GltfComponentType::Byte:
+        case GltfComponentType::UnsignedByte: return 1;
+        case GltfComponentType::Short:
+        case GltfComponentType::UnsignedShort: return 2;
+        case GltfComponentType::UnsignedInt:
+        case GltfComponentType::Float: return 4;
+    }
+    return 0;
+}
+
+namespace {
+
+template<typename T>
+float normalize_component(T value) {
+    if constexpr (std::is_same_v<T, std::uint8_t>) {
+        return static_cast<float>(value) / 255.0f;
+    } else if constexpr (std::is_same_v<T, std::int8_t>) {
+        return std::max(static_cast<float>(value) / 127.0f, -1.0f);
+    } else if constexpr (std::is_same_v<T, std::uint16_t>) {
+        return static_cast<float>(value) / 65535.0f;
+    } else if constexpr (std::is_same_v<T, std::int16_t>) {
+        return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+    } else {
+        return static_cast<float>(value);
+    }
+}
+
+// N is the number of components written; fixed at compile time so the
+// inner loop unrolls and the element loop vectorizes
+template<typename T, std::uint32_t N, bool Normalized>
+void unpack_elements(const std::uint8_t* src, std::size_t src_stride, std::size_t count,
+                     std::uint8_t* dst, std::size_t dst_stride) {
+    for (std::size_t i = 0; i < count; ++i) {
+        T element[N];
+        std::memcpy(element, src, sizeof(element));
+
+        float out[N];
+        for (std::uint32_t c = 0; c < N; ++c) {
+            if constexpr (Normalized) {
+                out[c] = normalize_component(element[c]);
+            } else {
+                out[c] = static_cast<float>(element[c]);
+            }
+        }
+        std::memcpy(dst, out, sizeof(out));
+
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+template<typename T, bool Normalized>
+void unpack_typed(const GltfAccessorView& view, std::uint8_t* dst,
+                  std::size_t dst_stride, std::uint32_t n) {
+    switch (n) {
+        case 1: unpack_elements<T, 1, Normalized>(view.data, view.stride, view.count, dst, dst_stride); break;
+        case 2: unpack_elements<T, 2, Normalized>(view.data, view.stride, view.count, dst, dst_stride); break;
+        case 3: unpack_elements<T, 3, Normalized>(view.data, view.stride, view.count, dst, dst_stride); break;
+        case 4: unpack_elements<T, 4, Normalized>(view.data, view.stride, view.count, dst, dst_stride); break;
+        case 16: unpack_elements<T, 16, Normalized>(view.data, view.stride, view.count, dst, dst_stride); break;
+        default: {
+            // Uncommon widths (MAT2/MAT3): per-component loop
+            for (std::size_t i = 0; i < view.count; ++i) {
+                const std::uint8_t* src = view.data + i * view.stride;
+                auto* out = dst + i * dst_stride;
+                for (std::uint32_t c = 0; c < n; ++c) {
+                    T value;
+                    std::memcpy(&value, src + c * sizeof(T), sizeof(T));
+                    float f = Normalized ? normalize_component(value) : static_cast<float>(value);
+                    std::memcpy(out + c * sizeof(float), &f, sizeof(float));
+                }
+            }
+            break;
+        }
+    }
+}
+
+template<bool Normalized>
+void unpack_dispatch(const GltfAccessorView& view, std::uint8_t* dst,
+                     std::size_t dst_stride, std::uint32_t n) {
+    switch (view.component_type) {
+        case GltfComponentType::Byte: unpack_typed<std::int8_t, Normalized>(view, dst, dst_stride, n); break;
+        case GltfComponentType::UnsignedByte: unpack_typed<std::uint8_t, Normalized>(view, dst, dst_stride, n); break;
+        case GltfComponentType::Short: unpack_typed<std::int16_t, Normalized>(view, dst, dst_stride, n); break;
+        case GltfComponentType::UnsignedShort: unpack_typed<std::uint16_t, Normalized>(view, dst, dst_stride, n); break;
+        case GltfComponentType::UnsignedInt: unpack_typed<std::uint32_t, false>(view, dst, dst_stride, n); break;
+        case GltfComponentType::Float: unpack_typed<float, false>(view, dst, dst_stride, n); break;
+    }
+}
+
+// Reads n components per element; writes them `dst_components` apart
+template<typename Out, typename In>
+void unpack_integers(const GltfAccessorView& view, Out* dst, std::uint32_t n,
+                     std::uint32_t dst_components) {
+    const std::uint8_t* src = view.data;
+    for (std::size_t i = 0; i < view.count; ++i) {
+        In element[4] = {};
+        std::memcpy(element, src, sizeof(In) * n);
+        for (std::uint32_t c = 0; c < n; ++c) {
+            dst[i * dst_components + c] = static_cast<Out>(element[c]);
+        }
+        src += view.stride;
+    }
+}
+
+} // anonymous namespace
+
+void gltf_unpack_floats(const GltfAccessorView& view, float* dst,
+                        std::size_t dst_stride, std::uint32_t dst_components) {
+    std::uint32_t n = std::min(view.components, dst_components);
+    if (view.count == 0 || n == 0) {
+        return;
+    }
+
+    auto* out = reinterpret_cast<std::uint8_t*>(dst);
+
+    if (!view.data) {
+        for (std::size_t i = 0; i < view.count; ++i) {
+            std::memset(out + i * dst_stride, 0, n * sizeof(float));
+        }
+        return;
+    }
+
+    // Identical packed layouts: one bulk copy
+    if (view.is_packed_float() && n == view.components && dst_stride == n * sizeof(float)) {
+        std::memcpy(out, view.data, view.count * dst_stride);
+        return;
+    }
+
+    if (view.normalized) {
+        unpack_dispatch<true>(view, out, dst_stride, n);
+    } else {
+        unpack_dispatch<false>(view, out, dst_stride, n);
+    }
+}
+
+void gltf_unpack_indices(const GltfAccessorView& view, std::uint32_t* dst) {
+    if (!view.data) {
+        std::fill(dst, dst + view.count, 0u);
+        return;
+    }
+
+    switch (view.component_type) {
+        case GltfComponentType::UnsignedByte:
+            unpack_integers<std::uint32_t, std::uint8_t>(view, dst, 1, 1);
+            break;
+        case GltfComponentType::UnsignedShort:
+            unpack_integers<std::uint32_t, std::uint16_t>(view, dst, 1, 1);
+            break;
+        case GltfComponentType::UnsignedInt:
+            if (view.stride == sizeof(std::uint32_t)) {
+                std::memcpy(dst, view.data, view.count * sizeof(std::uint32_t));
+            } else {
+                unpack_integers<std::uint32_t, std::uint32_t>(view, dst, 1, 1);
+            }
+            break;
+        default:
+            std::fill(dst, dst + view.count, 0u);
+            break;
+    }
+}
+
+void gltf_unpack_joints(const GltfAccessorView& view, std::uint16_t* dst) {
+    // Joint indices are unsigned byte or short; anything else reads as joint 0
+    bool supported = view.component_type == GltfComponentType::UnsignedByte ||
+                     view.component_type == GltfComponentType::UnsignedShort;
+    std::uint32_t n = std::min<std::uint32_t>(view.components, 4);
+    if (!view.data || !supported || n < 4) {
+        std::fill(dst, dst + view.count * 4, std::uint16_t{0});
+        if (!view.data || !supported) {
+            return;
+        }
+    }
+
+    switch (view.component_type) {
+        case GltfComponentType::UnsignedByte:
+            unpack_integers<std::uint16_t, std::uint8_t>(view, dst, n, 4);
+            break;
+        case GltfComponentType::UnsignedShort:
+            unpack_integers<std::uint16_t, std::uint16_t>(view, dst, n, 4);
+            break;
+        default:
+            break;
+    }
+}
+
+// =============================================================================
+// JSON Helpers
+// =============================================================================
+
+namespace {
+
+constexpr std::uint32_t k_glb_magic = 0x46546C67;       // "glTF"
+constexpr std::uint32_t k_glb_chunk_json = 0x4E4F534A;  // "JSON"
+constexpr std::uint32_t k_glb_chunk_bin = 0x004E4942;   // "BIN\0"
+
+std::uint32_t read_u32(const std::uint8_t* p) {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+std::int32_t get_int(const json& j, const char* key, std::int32_t fallback = -1) {
+    auto it = j.find(key);
+    return (it != j.end() && it->is_number_integer()) ? it->get<std::int32_t>() : fallback;
+}
+
+std::size_t get_size(const json& j, const char* key, std::size_t fallback = 0) {
+    auto it = j.find(key);
+    return (it != j.end() && it->is_number_unsigned()) ? it->get<std::size_t>() : fallback;
+}
+
+float get_float(const json& j, const char* key, float fallback) {
+    auto it = j.find(key);
+    return (it != j.end() && it->is_number()) ? it->get<float>() : fallback;
+}
+
+std::optional<float> get_optional_float(const json& j, const char* key) {
+    auto it = j.find(key);
+    if (it != j.end() && it->is_number()) {
+        return it->get<float>();
+    }
+    return std::nullopt;
+}
+
+bool get_bool(const json& j, const char* key, bool fallback = false) {
+    auto it = j.find(key);
+    return (it != j.end() && it->is_boolean()) ? it->get<bool>() : fallback;
+}
+
+std::string get_string(const json& j, const char* key, const char* fallback = "") {
+    auto it = j.find(key);
+    return (it != j.end() && it->is_string()) ? it->get<std::string>() : std::string(fallback);
+}
+
+template<std::size_t N>
+bool get_floats(const json& j, const char* key, std::array<float, N>& out) {
+    auto it = j.find(key);
+    if (it == j.end() || !it->is_array() || it->size() < N) {
+        return false;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        out[i] = (*it)[i].is_number() ? (*it)[i].get<float>() : 0.0f;
+    }
+    return true;
+}
+
+std::vector<std::int32_t> get_ints(const json& j, const char* key) {
+    std::vector<std::int32_t> out;
+    auto it = j.find(key);
+    if (it != j.end() && it->is_array()) {
+        out.reserve(it->size());
+        for (const auto& value : *it) {
+            if (value.is_number_integer()) {
+                out.push_back(value.get<std::int32_t>());
+            }
+        }
+    }
+    return out;
+}
+
+std::vector<float> get_float_vector(const json& j, const char* key) {
+    std::vector<float> out;
+    auto it = j.find(key);
+    if (it != j.end() && it->is_array()) {
+        out.reserve(it->size());
+        for (const auto& value : *it) {
+            out.push_back(value.is_number() ? value.get<float>() : 0.0f);
+        }
+    }
+    return out;
+}
+
+const json& get_array(const json& j, const char* key) {
+    static const json empty = json::array();
+    auto it = j.find(key);
+    return (it != j.end() && it->is_array()) ? *it : empty;
+}
+
+GltfTextureRef get_texture_ref(const json& j, const char* key, const char* scale_key) {
+    GltfTextureRef ref;
+    auto it = j.find(key);
+    if (it != j.end() && it->is_object()) {
+        ref.index = get_int(*it, "index");
+        ref.tex_coord = get_int(*it, "texCoord", 0);
+        if (scale_key) {
+            ref.scale = get_float(*it, scale_key, 1.0f);
+        }
+    }
+    return ref;
+}
+
+std::uint32_t component_count(const std::string& type) {
+    if (type == "SCALAR") return 1;
+    if (type == "VEC2") return 2;
+    if (type == "VEC3") return 3;
+    if (type == "VEC4") return 4;
+    if (type == "MAT2") return 4;
+    if (type == "MAT3") return 9;
+    if (type == "MAT4") return 16;
+    return 0;
+}
+
+bool decode_base64(std::string_view input, std::vector<std::uint8_t>& out) {
+    auto decode = [](char c) -> int {
+        if (c >= 'A' && c <= 'Z') return c - 'A';
+        if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+        if (c >= '0' && c <= '9') return c - '0' + 52;
+        if (c == '+' || c == '-') return 62;
+        if (c == '/' || c == '_') return 63;
+        return -1;
+    };
+
+    out.clear();
+    out.reserve(input.size() / 4 * 3);
+
+    std::uint32_t buffer = 0;
+    int bits = 0;
+    for (char c : input) {
+        if (c == '=') {
+            break;
+        }
+        int value = decode(c);
+        if (value < 0) {
+            return false;
+        }
+        buffer = (buffer << 6) | static_cast<std::uint32_t>(value);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out.push_back(static_cast<std::uint8_t>((buffer >> bits) & 0xFF));
+        }
+    }
+    return true;
+}
+
+void_core::Error gltf_error(const std::string& reason) {
+    return void_core::Error(void_core::ErrorCode::ParseError, "Invalid glTF: " + reason);
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// GltfDocumentParser
+// =============================================================================
+
+/// Fills a GltfDocument from its JSON description
+struct GltfDocumentParser {
+    GltfDocument& doc;
+
+    void_core::Result<void> parse_buffers(const json& root,
+                                          std::span<const std::uint8_t> bin,
+                                          bool has_bin,
+                                          const GltfDocument::BufferResolver& resolver) {
+        const auto& buffers = get_array(root, "buffers");
+        doc.m_buffers.reserve(buffers.size());
+
+        for (std::size_t i = 0; i < buffers.size(); ++i) {
+            const auto& buffer = buffers[i];
+            std::size_t length = get_size(buffer, "byteLength");
+            std::string uri = get_string(buffer, "uri");
+
+            std::span<const std::uint8_t> bytes;
+            if (uri.empty()) {
+                if (i != 0 || !has_bin) {
+                    return void_core::Err(gltf_error("buffer " + std::to_string(i) + " has no data"));
+                }
+                bytes = bin;
+            } else if (uri.rfind("data:", 0) == 0) {
+                auto comma = uri.find(',');
+                if (comma == std::string::npos || uri.find(";base64") == std::string::npos) {
+                    return void_core::Err(gltf_error("unsupported data URI in buffer " + std::to_string(i)));
+                }
+                auto& owned = doc.m_owned_buffers.emplace_back();
+                if (!decode_base64(std::string_view(uri).substr(comma + 1), owned)) {
+                    return void_core::Err(gltf_error("bad base64 in buffer " + std::to_string(i)));
+                }
+                bytes = owned;
+            } else {
+                std::optional<std::span<const std::uint8_t>> resolved;
+                if (resolver) {
+                    resolved = resolver(uri);
+                }
+                if (!resolved) {
+                    return void_core::Err(gltf_error("cannot resolve buffer '" + uri + "'"));
+                }
+                doc.m_external_uris.push_back(uri);
+                bytes = *resolved;
+            }
+
+            if (bytes.size() < length) {
+                return void_core::Err(gltf_error("buffer " + std::to_string(i) + " is truncated"));
+            }
+            doc.m_buffers.push_back(bytes.first(length));
+        }
+
+        for (const auto& view : get_array(root, "bufferViews")) {
+            GltfDocument::BufferViewDesc desc;
+            desc.buffer = get_int(view, "buffer");
+            desc.offset = get_size(view, "byteOffset");
+            desc.length = get_size(view, "byteLength");
+            desc.stride = get_size(view, "byteStride");
+
+            if (desc.buffer < 0 || desc.buffer >= static_cast<std::int32_t>(doc.m_buffers.size())) {
+                return void_core::Err(gltf_error("buffer view out of range"));
+            }
+            std::size_t buffer_size = doc.m_buffers[static_cast<std::size_t>(desc.buffer)].size();
+            if (desc.offset > buffer_size || desc.length > buffer_size - desc.offset) {
+                return void_core::Err(gltf_error("buffer view out of range"));
+            }
+            doc.m_buffer_views.push_back(desc);
+        }
+
+        return void_core::Ok();
+    }
+
+    void_core::Result<void> parse_accessors(const json& root) {
+        for (const auto& accessor : get_array(root, "accessors")) {
+            GltfDocument::AccessorDesc desc;
+            desc.buffer_view = get_int(accessor, "bufferView");
+            desc.offset = get_size(accessor, "byteOffset");
+            desc.count = get_size(accessor, "count");
+            desc.component_type = static_cast<GltfComponentType>(get_int(accessor, "componentType", 5126));
+            desc.components = component_count(get_string(accessor, "type"));
+            desc.normalized = get_bool(accessor, "normalized");
+            desc.sparse = accessor.contains("sparse");
+            desc.min_values = get_float_vector(accessor, "min");
+            desc.max_values = get_float_vector(accessor, "max");
+
+            if (desc.components == 0 || gltf_component_size(desc.component_type) == 0) {
+                return void_core::Err(gltf_error("unsupported accessor type"));
+            }
+            doc.m_accessors.push_back(std::move(desc));
+        }
+        return void_core::Ok();
+    }
+
+    void parse_meshes(const json& root) {
+        for (const auto& mesh : get_array(root, "meshes")) {
+            GltfMeshDesc desc;
+            desc.name = get_string(mesh, "name");
+
+            for (const auto& prim : get_array(mesh, "primitives")) {
+                GltfPrimitiveDesc prim_desc;
+                prim_desc.mode = get_int(prim, "mode", 4);
+                prim_desc.material = get_int(prim, "material");
+                prim_desc.indices = get_int(prim, "indices");
+
+                auto attrs = prim.find("attributes");
+                if (attrs != prim.end() && attrs->is_object()) {
+                    for (auto it = attrs->begin(); it != attrs->end(); ++it) {
+                        if (it->is_number_integer()) {
+                            prim_desc.attributes.emplace_back(it.key(), it->get<std::int32_t>());
+                        }
+                    }
+                }
+                desc.primitives.push_back(std::move(prim_desc));
+            }
+            doc.m_meshes.push_back(std::move(desc));
+        }
+    }
+
+    void parse_materials(const json& root) {
+        for (const auto& material : get_array(root, "materials")) {
+            GltfMaterialDesc desc;
+            desc.name = get_string(material, "name");
+
+            auto pbr = material.find("pbrMetallicRoughness");
+            if (pbr != material.end() && pbr->is_object()) {
+                get_floats(*pbr, "baseColorFactor", desc.base_color_factor);
+                desc.metallic_factor = get_float(*pbr, "metallicFactor", 1.0f);
+                desc.roughness_factor = get_float(*pbr, "roughnessFactor", 1.0f);
+                desc.base_color_texture = get_texture_ref(*pbr, "baseColorTexture", nullptr);
+                desc.metallic_roughness_texture = get_texture_ref(*pbr, "metallicRoughnessTexture", nullptr);
+            }
+
+            desc.normal_texture = get_texture_ref(material, "normalTexture", "scale");
+            desc.occlusion_texture = get_texture_ref(material, "occlusionTexture", "strength");
+            desc.emissive_texture = get_texture_ref(material, "emissiveTexture", nullptr);
+            get_floats(material, "emissiveFactor", desc.emissive_factor);
+            desc.alpha_mode = get_string(material, "alphaMode", "OPAQUE");
+            desc.alpha_cutoff = get_float(material, "alphaCutoff", 0.5f);
+            desc.double_sided = get_bool(material, "doubleSided");
+
+            auto ext = material.find("extensions");
+            if (ext != material.end() && ext->is_object()) {
+                if (auto it = ext->find("KHR_materials_clearcoat"); it != ext->end()) {
+                    desc.clearcoat = get_optional_float(*it, "clearcoatFactor");
+                    desc.clearcoat_roughness = get_optional_float(*it, "clearcoatRoughnessFactor");
+                }
+                if (auto it = ext->find("KHR_materials_transmission"); it != ext->end()) {
+                    desc.transmission = get_optional_float(*it, "transmissionFactor");
+                }
+                if (auto it = ext->find("KHR_materials_ior"); it != ext->end()) {
+                    desc.ior = get_optional_float(*it, "ior");
+                }
+                if (auto it = ext->find("KHR_materials_sheen"); it != ext->end()) {
+                    std::array<float, 3> color{};
+                    if (get_floats(*it, "sheenColorFactor", color)) {
+                        desc.sheen_color = color;
+                    }
+                    desc.sheen_roughness = get_optional_float(*it, "sheenRoughnessFactor");
+                }
+                desc.unlit = ext->contains("KHR_materials_unlit");
+            }
+
+            doc.m_materials.push_back(std::move(desc));
+        }
+    }
+
+    void parse_textures(const json& root) {
+        for (const auto& image : get_array(root, "images")) {
+            GltfImageDesc desc;
+            desc.name = get_string(image, "name");
+            desc.uri = get_string(image, "uri");
+            desc.mime_type = get_string(image, "mimeType");
+            desc.buffer_view = get_int(image, "bufferView");
+            doc.m_images.push_back(std::move(desc));
+        }
+
+        for (const auto& texture : get_array(root, "textures")) {
+            GltfTextureDesc desc;
+            desc.name = get_string(texture, "name");
+            desc.source = get_int(texture, "source");
+            desc.sampler = get_int(texture, "sampler");
+            doc.m_textures.push_back(std::move(desc));
+        }
+
+        for (const auto& sampler : get_array(root, "samplers")) {
+            GltfSamplerDesc desc;
+            desc.mag_filter = get_int(sampler, "magFilter");
+            desc.min_filter = get_int(sampler, "minFilter");
+            desc.wrap_s = get_int(sampler, "wrapS", 10497);
+            desc.wrap_t = get_int(sampler, "wrapT", 10497);
+            doc.m_samplers.push_back(desc);
+        }
+    }
+
+    void parse_nodes(const json& root) {
+        for (const auto& node : get_array(root, "nodes")) {
+            GltfNodeDesc desc;
+            desc.name = get_string(node, "name");
+            desc.mesh = get_int(node, "mesh");
+            desc.skin = get_int(node, "skin");
+            desc.camera = get_int(node, "camera");
+            desc.children = get_ints(node, "children");
+            get_floats(node, "translation", desc.translation);
+            get_floats(node, "rotation", desc.rotation);
+            get_floats(node, "scale", desc.scale);
+
+            std::array<float, 16> matrix{};
+            if (get_floats(node, "matrix", matrix)) {
+                desc.matrix = matrix;
+            }
+            doc.m_nodes.push_back(std::move(desc));
+        }
+
+        for (const auto& skin : get_array(root, "skins")) {
+            GltfSkinDesc desc;
+            desc.name = get_string(skin, "name");
+            desc.joints = get_ints(skin, "joints");
+            desc.inverse_bind_matrices = get_int(skin, "inverseBindMatrices");
+            desc.skeleton = get_int(skin, "skeleton");
+            doc.m_skins.push_back(std::move(desc));
+        }
+
+        for (const auto& scene : get_array(root, "scenes")) {
+            GltfSceneDesc desc;
+            desc.name = get_string(scene, "name");
+            desc.nodes = get_ints(scene, "nodes");
+            doc.m_scenes.push_back(std::move(desc));
+        }
+        doc.m_default_scene = get_int(root, "scene");
+    }
+
+    void parse_animations(const json& root) {
+        for (const auto& animation : get_array(root, "animations")) {
+            GltfAnimationDesc desc;
+            desc.name = get_string(animation, "name");
+
+            for (const auto& sampler : get_array(animation, "samplers")) {
+                GltfAnimationSamplerDesc sampler_desc;
+                sampler_desc.input = get_int(sampler, "input");
+                sampler_desc.output = get_int(sampler, "output");
+                sampler_desc.interpolation = get_string(sampler, "interpolation", "LINEAR");
+                desc.samplers.push_back(std::move(sampler_desc));
+            }
+
+            for (const auto& channel : get_array(animation, "channels")) {
+                GltfAnimationChannelDesc channel_desc;
+                channel_desc.sampler = get_int(channel, "sampler");
+                auto target = channel.find("target");
+                if (target != channel.end() && target->is_object()) {
+                    channel_desc.target_node = get_int(*target, "node");
+                    channel_desc.target_path = get_string(*target, "path");
+                }
+                desc.channels.push_back(std::move(channel_desc));
+            }
+
+            doc.m_animations.push_back(std::move(desc));
+        }
+    }
+};
+
+// =============================================================================
+// GltfDocument
+// =============================================================================
+
+bool GltfDocument::is_glb(std::span<const std::uint8_t> bytes) noexcept {
+    return bytes.size() >= 12 && read_u32(bytes.data()) == k_glb_magic;
+}
+
+void_core::Result<GltfDocument> GltfDocument::parse(
+    std::span<const std::uint8_t> bytes,
+    const BufferResolver& resolver)
+{
+    std::string_view json_text;
+    std::span<const std::uint8_t> bin;
+    bool has_bin = false;
+
+    if (is_glb(bytes)) {
+        std::uint32_t version = read_u32(bytes.data() + 4);
+        std::uint32_t length = read_u32(bytes.data() + 8);
+        if (version != 2) {
+            return void_core::Err<GltfDocument>(gltf_error("unsupported GLB version " + std::to_string(version)));
+        }
+        if (length > bytes.size()) {
+            return void_core::Err<GltfDocument>(gltf_error("GLB is truncated"));
+        }
+
+        std::size_t offset = 12;
+        while (offset + 8 <= length) {
+            std::uint32_t chunk_length = read_u32(bytes.data() + offset);
+            std::uint32_t chunk_type = read_u32(bytes.data() + offset + 4);
+            offset += 8;
+            if (offset + chunk_length > length) {
+                return void_core::Err<GltfDocument>(gltf_error("GLB chunk out of range"));
+            }
+
+            if (chunk_type == k_glb_chunk_json && json_text.empty()) {
+                json_text = std::string_view(reinterpret_cast<const char*>(bytes.data() + offset), chunk_length);
+            } else if (chunk_type == k_glb_chunk_bin && !has_bin) {
+                bin = bytes.subspan(offset, chunk_length);
+                has_bin = true;
+            }
+            offset += (chunk_length + 3) & ~std::size_t{3};
+        }
+
+        if (json_text.empty()) {
+            return void_core::Err<GltfDocument>(gltf_error("GLB has no JSON chunk"));
+        }
+    } else {
+        json_text = std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    json root = json::parse(json_text.begin(), json_text.end(), nullptr, false);
+    if (root.is_discarded() || !root.is_object()) {
+        return void_core::Err<GltfDocument>(gltf_error("malformed JSON"));
+    }
+
+    GltfDocument doc;
+    GltfDocumentParser parser{doc};
+
+    if (auto result = parser.parse_buffers(root, bin, has_bin, resolver); !result) {
+        return void_core::Err<GltfDocument>(result.error());
+    }
+    if (auto result = parser.parse_accessors(root); !result) {
+        return void_core::Err<GltfDocument>(result.error());
+    }
+    parser.parse_meshes(root);
+    parser.parse_materials(root);
+    parser.parse_textures(root);
+    parser.parse_nodes(root);
+    parser.parse_animations(root);
+
+    return void_core::Ok(std::move(doc));
+}
+
+void_core::Result<GltfAccessorView> GltfDocument::accessor(std::int32_t index) const {
+    if (index < 0 || index >= static_cast<std::int32_t>(m_accessors.size())) {
+        return void_core::Err<GltfAccessorView>(gltf_error("accessor " + std::to_string(index) + " out of range"));
+    }
+
+    const auto& desc = m_accessors[static_cast<std::size_t>(index)];
+    if (desc.sparse) {
+        return void_core::Err<GltfAccessorView>(gltf_error("sparse accessors are not supported"));
+    }
+
+    GltfAccessorView view;
+    view.count = desc.count;
+    view.component_type = desc.component_type;
+    view.components = desc.components;
+    view.normalized = desc.normalized;
+    view.min_values = desc.min_values;
+    view.max_values = desc.max_values;
+    view.stride = view.element_size();
+
+    if (desc.buffer_view < 0) {
+        return void_core::Ok(std::move(view));  // Zero-initialized accessor
+    }
+    if (desc.buffer_view >= static_cast<std::int32_t>(m_buffer_views.size())) {
+        return void_core::Err<GltfAccessorView>(gltf_error("accessor buffer view out of range"));
+    }
+
+    const auto& buffer_view = m_buffer_views[static_cast<std::size_t>(desc.buffer_view)];
+    if (buffer_view.stride != 0) {
+        if (buffer_view.stride < view.element_size()) {
+            return void_core::Err<GltfAccessorView>(gltf_error("accessor " + std::to_string(index) + " is wider than its buffer view stride"));
+        }
+        view.stride = buffer_view.stride;
+    }
+
+    if (desc.count > 0) {
+        // offset + (count - 1) * stride + element_size <= length, without overflow
+        std::size_t element = view.element_size();
+        bool fits = desc.offset <= buffer_view.length &&
+                    element <= buffer_view.length - desc.offset &&
+                    desc.count - 1 <= (buffer_view.length - desc.offset - element) / view.stride;
+        if (!fits) {
+            return void_core::Err<GltfAccessorView>(gltf_error("accessor " + std::to_string(index) + " overruns its buffer view"));
+        }
+    }
+
+    view.data = m_buffers[static_cast<std::size_t>(buffer_view.buffer)].data() + buffer_view.offset + desc.offset;
+    return void_core::Ok(std::move(view));
+}
+
+std::span<const std::uint8_t> GltfDocument::buffer_view(std::int32_t index) const {
+    if (index < 0 || index >= static_cast<std::int32_t>(m_buffer_views.size())) {
+        return {};
+    }
+    const auto& view = m_buffer_views[static_cast<std::size_t>(index)];
+    return m_buffers[static_cast<std::size_t>(view.buffer)].subspan(view.offset, view.length);
+}
+
+} // namespace void_asset
@@ -2,21 +2,16 @@
 /// @brief 3D model asset loader implementation
 
 #include <void_engine/asset/loaders/model_loader.hpp>
+#include <void_engine/asset/loaders/gltf_reader.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <filesystem>
+#include <optional>
+#include <span>
 #include <sstream>
 
-// tinygltf forward declarations (assuming linked)
-#ifdef VOID_HAS_TINYGLTF
-#define TINYGLTF_IMPLEMENTATION
-#define TINYGLTF_NO_STB_IMAGE
-#define TINYGLTF_NO_STB_IMAGE_WRITE
-#include <tiny_gltf.h>
-#endif
-
 namespace void_asset {
 
 // =============================================================================
@@ -39,40 +34,65 @@ LoadResult<ModelAsset> ModelLoader::load(LoadContext& ctx) {
         void_core::Error("Unsupported model format: " + ext));
 }
 
-#ifdef VOID_HAS_TINYGLTF
-
 LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary) {
-    tinygltf::Model gltf_model;
-    tinygltf::TinyGLTF loader;
-    std::string err, warn;
+    using ModelPtr = std::unique_ptr<ModelAsset>;
 
     const auto& data = ctx.data();
-    bool success = false;
+    std::span<const std::uint8_t> bytes(data.data(), data.size());
+
+    if (is_binary && !GltfDocument::is_glb(bytes)) {
+        return void_core::Err<ModelPtr>(
+            AssetError::parse_error(ctx.path().str(), "missing GLB header"));
+    }
 
-    if (is_binary) {
-        success = loader.LoadBinaryFromMemory(
-            &gltf_model, &err, &warn,
-            data.data(), static_cast<unsigned int>(data.size()));
+    // External buffers are mapped, not read, and stay mapped until the
+    // conversion below has finished
+    std::filesystem::path base_dir;
+    if (const auto* source = ctx.get_metadata("source_file")) {
+        base_dir = std::filesystem::path(*source).parent_path();
     } else {
-        std::string content(data.begin(), data.end());
-        std::string base_dir = ctx.path().directory();
-        success = loader.LoadASCIIFromString(
-            &gltf_model, &err, &warn,
-            content.c_str(), static_cast<unsigned int>(content.size()),
-            base_dir);
+        base_dir = ctx.path().directory();
     }
+    std::vector<MappedFile> external_files;
+    auto resolver = [&](const std::string& uri) -> std::optional<std::span<const std::uint8_t>> {
+        auto mapped = MappedFile::open((base_dir / uri).string());
+        if (!mapped) {
+            return std::nullopt;
+        }
+        external_files.push_back(std::move(mapped).value());
+        return external_files.back().bytes();
+    };
+
+    auto parsed = GltfDocument::parse(bytes, resolver);
+    if (!parsed) {
+        return void_core::Err<ModelPtr>(
+            AssetError::parse_error(ctx.path().str(), parsed.error().message()));
+    }
+    const GltfDocument& doc = parsed.value();
 
-    if (!success) {
-        return void_core::Err<std::unique_ptr<ModelAsset>>(
-            void_core::Error("Failed to load glTF: " + err));
+    std::string dir = ctx.path().directory();
+    for (const auto& uri : doc.external_uris()) {
+        ctx.add_dependency(AssetPath(dir.empty() ? uri : dir + "/" + uri));
     }
 
     auto asset = std::make_unique<ModelAsset>();
     asset->name = ctx.path().filename();
     asset->source_path = ctx.path().str();
 
+    // Convert an accessor to tightly packed floats in one pass
+    std::string accessor_error;
+    auto extract_floats = [&](std::int32_t accessor_idx, std::vector<float>& out, std::uint32_t components) {
+        auto view = doc.accessor(accessor_idx);
+        if (!view) {
+            accessor_error = view.error().message();
+            return;
+        }
+        out.assign(view.value().count * components, 0.0f);
+        gltf_unpack_floats(view.value(), out.data(), components * sizeof(float), components);
+    };
+
     // Load meshes
-    for (const auto& gltf_mesh : gltf_model.meshes) {
+    for (const auto& gltf_mesh : doc.meshes()) {
         ModelMesh mesh;
         mesh.name = gltf_mesh.name;
 
@@ -82,45 +102,25 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
 
             // Set topology
             switch (gltf_prim.mode) {
-                case TINYGLTF_MODE_POINTS: prim.topology = PrimitiveTopology::Points; break;
-                case TINYGLTF_MODE_LINE: prim.topology = PrimitiveTopology::Lines; break;
-                case TINYGLTF_MODE_LINE_STRIP: prim.topology = PrimitiveTopology::LineStrip; break;
-                case TINYGLTF_MODE_TRIANGLES: prim.topology = PrimitiveTopology::Triangles; break;
-                case TINYGLTF_MODE_TRIANGLE_STRIP: prim.topology = PrimitiveTopology::TriangleStrip; break;
-                case TINYGLTF_MODE_TRIANGLE_FAN: prim.topology = PrimitiveTopology::TriangleFan; break;
+                case 0: prim.topology = PrimitiveTopology::Points; break;
+                case 1: prim.topology = PrimitiveTopology::Lines; break;
+                case 3: prim.topology = PrimitiveTopology::LineStrip; break;
+                case 4: prim.topology = PrimitiveTopology::Triangles; break;
+                case 5: prim.topology = PrimitiveTopology::TriangleStrip; break;
+                case 6: prim.topology = PrimitiveTopology::TriangleFan; break;
                 default: prim.topology = PrimitiveTopology::Triangles; break;
             }
 
-            // Helper to extract accessor data
-            auto extract_accessor = [&](int accessor_idx, std::vector<float>& out, int components) {
-                if (accessor_idx < 0) return;
-
-                const auto& accessor = gltf_model.accessors[accessor_idx];
-                const auto& view = gltf_model.bufferViews[accessor.bufferView];
-                const auto& buffer = gltf_model.buffers[view.buffer];
-
-                const std::uint8_t* base = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-                std::size_t stride = view.byteStride ? view.byteStride : (components * sizeof(float));
-
-                out.resize(accessor.count * components);
-                for (std::size_t i = 0; i < accessor.count; ++i) {
-                    const float* src = reinterpret_cast<const float*>(base + i * stride);
-                    for (int c = 0; c < components; ++c) {
-                        out[i * components + c] = src[c];
-                    }
-                }
-            };
-
             // Extract attributes
             for (const auto& [name, accessor_idx] : gltf_prim.attributes) {
                 if (name == "POSITION") {
-                    extract_accessor(accessor_idx, prim.positions, 3);
+                    extract_floats(accessor_idx, prim.positions, 3);
                 } else if (name == "NORMAL") {
-                    extract_accessor(accessor_idx, prim.normals, 3);
+                    extract_floats(accessor_idx, prim.normals, 3);
                 } else if (name == "TANGENT") {
-                    extract_accessor(accessor_idx, prim.tangents, 4);
+                    extract_floats(accessor_idx, prim.tangents, 4);
                 } else if (name == "TEXCOORD_0") {
-                    extract_accessor(accessor_idx, prim.texcoords0, 2);
+                    extract_floats(accessor_idx, prim.texcoords0, 2);
 
                     // Flip UVs if configured
                     if (m_config.flip_uvs) {
@@ -129,56 +129,55 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
                         }
                     }
                 } else if (name == "TEXCOORD_1") {
-                    extract_accessor(accessor_idx, prim.texcoords1, 2);
+                    extract_floats(accessor_idx, prim.texcoords1, 2);
                 } else if (name == "COLOR_0") {
-                    extract_accessor(accessor_idx, prim.colors0, 4);
+                    extract_floats(accessor_idx, prim.colors0, 4);
+
+                    // RGB colors get opaque alpha
+                    auto view = doc.accessor(accessor_idx);
+                    if (view && view.value().components == 3) {
+                        for (std::size_t i = 3; i < prim.colors0.size(); i += 4) {
+                            prim.colors0[i] = 1.0f;
+                        }
+                    }
                 } else if (name == "WEIGHTS_0") {
-                    extract_accessor(accessor_idx, prim.weights0, 4);
+                    extract_floats(accessor_idx, prim.weights0, 4);
                 } else if (name == "JOINTS_0") {
-                    // Joints are typically unsigned bytes
-                    const auto& accessor = gltf_model.accessors[accessor_idx];
-                    const auto& view = gltf_model.bufferViews[accessor.bufferView];
-                    const auto& buffer = gltf_model.buffers[view.buffer];
-
-                    const std::uint8_t* base = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-                    prim.joints0.resize(accessor.count * 4);
-
-                    if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
-                        std::memcpy(prim.joints0.data(), base, accessor.count * 4);
-                    } else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-                        const std::uint16_t* joints = reinterpret_cast<const std::uint16_t*>(base);
-                        for (std::size_t i = 0; i < accessor.count * 4; ++i) {
-                            prim.joints0[i] = static_cast<std::uint8_t>(joints[i]);
-                        }
+                    auto view = doc.accessor(accessor_idx);
+                    if (!view) {
+                        accessor_error = view.error().message();
+                        continue;
                     }
+                    if (view.value().component_type != GltfComponentType::UnsignedByte &&
+                        view.value().component_type != GltfComponentType::UnsignedShort) {
+                        accessor_error = "JOINTS_0 must use unsigned byte or unsigned short components";
+                        continue;
+                    }
+                    if (view.value().count > prim.joints0.max_size() / 4) {
+                        accessor_error = "JOINTS_0 accessor too large";
+                        continue;
+                    }
+                    prim.joints0.resize(view.value().count * 4);
+                    gltf_unpack_joints(view.value(), prim.joints0.data());
                 }
             }
 
             // Extract indices
             if (gltf_prim.indices >= 0) {
-                const auto& accessor = gltf_model.accessors[gltf_prim.indices];
-                const auto& view = gltf_model.bufferViews[accessor.bufferView];
-                const auto& buffer = gltf_model.buffers[view.buffer];
-
-                const std::uint8_t* base = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-                prim.indices.resize(accessor.count);
-
-                if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-                    const std::uint16_t* indices = reinterpret_cast<const std::uint16_t*>(base);
-                    for (std::size_t i = 0; i < accessor.count; ++i) {
-                        prim.indices[i] = indices[i];
-                    }
-                } else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) {
-                    const std::uint32_t* indices = reinterpret_cast<const std::uint32_t*>(base);
-                    std::memcpy(prim.indices.data(), indices, accessor.count * sizeof(std::uint32_t));
-                } else if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
-                    const std::uint8_t* indices = base;
-                    for (std::size_t i = 0; i < accessor.count; ++i) {
-                        prim.indices[i] = indices[i];
-                    }
+                auto view = doc.accessor(gltf_prim.indices);
+                if (!view) {
+                    accessor_error = view.error().message();
+                } else {
+                    prim.indices.resize(view.value().count);
+                    gltf_unpack_indices(view.value(), prim.indices.data());
                 }
             }
 
+            if (!accessor_error.empty()) {
+                return void_core::Err<ModelPtr>(
+                    AssetError::parse_error(ctx.path().str(), accessor_error));
+            }
+
             // Generate tangents if missing and requested
             if (m_config.generate_tangents && prim.tangents.empty() &&
                 !prim.normals.empty() && !prim.texcoords0.empty()) {
@@ -192,77 +191,62 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
     }
 
     // Load materials
-    for (const auto& gltf_mat : gltf_model.materials) {
+    for (const auto& gltf_mat : doc.materials()) {
         ModelMaterial mat;
         mat.name = gltf_mat.name;
 
         // PBR metallic-roughness
-        const auto& pbr = gltf_mat.pbrMetallicRoughness;
-        mat.base_color_factor = {
-            static_cast<float>(pbr.baseColorFactor[0]),
-            static_cast<float>(pbr.baseColorFactor[1]),
-            static_cast<float>(pbr.baseColorFactor[2]),
-            static_cast<float>(pbr.baseColorFactor[3])
-        };
-        mat.metallic_factor = static_cast<float>(pbr.metallicFactor);
-        mat.roughness_factor = static_cast<float>(pbr.roughnessFactor);
-
-        if (pbr.baseColorTexture.index >= 0) {
-            mat.base_color_texture = pbr.baseColorTexture.index;
-        }
-        if (pbr.metallicRoughnessTexture.index >= 0) {
-            mat.metallic_roughness_texture = pbr.metallicRoughnessTexture.index;
-        }
+        mat.base_color_factor = gltf_mat.base_color_factor;
+        mat.metallic_factor = gltf_mat.metallic_factor;
+        mat.roughness_factor = gltf_mat.roughness_factor;
+        mat.base_color_texture = gltf_mat.base_color_texture.index;
+        mat.metallic_roughness_texture = gltf_mat.metallic_roughness_texture.index;
 
         // Normal
-        if (gltf_mat.normalTexture.index >= 0) {
-            mat.normal_texture = gltf_mat.normalTexture.index;
-            mat.normal_scale = static_cast<float>(gltf_mat.normalTexture.scale);
+        if (gltf_mat.normal_texture.index >= 0) {
+            mat.normal_texture = gltf_mat.normal_texture.index;
+            mat.normal_scale = gltf_mat.normal_texture.scale;
         }
 
         // Occlusion
-        if (gltf_mat.occlusionTexture.index >= 0) {
-            mat.occlusion_texture = gltf_mat.occlusionTexture.index;
-            mat.occlusion_strength = static_cast<float>(gltf_mat.occlusionTexture.strength);
+        if (gltf_mat.occlusion_texture.index >= 0) {
+            mat.occlusion_texture = gltf_mat.occlusion_texture.index;
+            mat.occlusion_strength = gltf_mat.occlusion_texture.scale;
         }
 
         // Emissive
-        if (gltf_mat.emissiveTexture.index >= 0) {
-            mat.emissive_texture = gltf_mat.emissiveTexture.index;
-        }
-        mat.emissive_factor = {
-            static_cast<float>(gltf_mat.emissiveFactor[0]),
-            static_cast<float>(gltf_mat.emissiveFactor[1]),
-            static_cast<float>(gltf_mat.emissiveFactor[2])
-        };
+        mat.emissive_texture = gltf_mat.emissive_texture.index;
+        mat.emissive_factor = gltf_mat.emissive_factor;
 
         // Alpha
-        mat.alpha_cutoff = static_cast<float>(gltf_mat.alphaCutoff);
-        mat.double_sided = gltf_mat.doubleSided;
-        if (gltf_mat.alphaMode == "OPAQUE") {
-            mat.alpha_mode = ModelMaterial::AlphaMode::Opaque;
-        } else if (gltf_mat.alphaMode == "MASK") {
+        mat.alpha_cutoff = gltf_mat.alpha_cutoff;
+        mat.double_sided = gltf_mat.double_sided;
+        if (gltf_mat.alpha_mode == "MASK") {
             mat.alpha_mode = ModelMaterial::AlphaMode::Mask;
-        } else if (gltf_mat.alphaMode == "BLEND") {
+        } else if (gltf_mat.alpha_mode == "BLEND") {
             mat.alpha_mode = ModelMaterial::AlphaMode::Blend;
+        } else {
+            mat.alpha_mode = ModelMaterial::AlphaMode::Opaque;
         }
 
         asset->materials.push_back(std::move(mat));
     }
 
     // Load textures
-    for (const auto& gltf_tex : gltf_model.textures) {
+    for (const auto& gltf_tex : doc.textures()) {
         ModelTexture tex;
         tex.name = gltf_tex.name;
         tex.sampler_index = gltf_tex.sampler;
 
-        if (gltf_tex.source >= 0) {
-            const auto& img = gltf_model.images[gltf_tex.source];
+        if (gltf_tex.source >= 0 && gltf_tex.source < static_cast<std::int32_t>(doc.images().size())) {
+            const auto& img = doc.images()[static_cast<std::size_t>(gltf_tex.source)];
             tex.uri = img.uri;
 
-            // Store embedded texture data if present
-            if (!img.image.empty()) {
-                tex.embedded_data = img.image;
+            // Embedded images are copied out of the (mapped) buffer once;
+            // they are decoded later by the texture pipeline
+            if (img.buffer_view >= 0) {
+                auto encoded = doc.buffer_view(img.buffer_view);
+                tex.embedded_data.assign(encoded.begin(), encoded.end());
             }
         }
 
@@ -270,83 +254,59 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
     }
 
     // Load samplers
-    for (const auto& gltf_sampler : gltf_model.samplers) {
+    for (const auto& gltf_sampler : doc.samplers()) {
         ModelSampler sampler;
 
-        switch (gltf_sampler.magFilter) {
-            case TINYGLTF_TEXTURE_FILTER_NEAREST:
+        switch (gltf_sampler.mag_filter) {
+            case 9728:  // NEAREST
                 sampler.mag_filter = ModelSampler::Filter::Nearest; break;
             default:
                 sampler.mag_filter = ModelSampler::Filter::Linear; break;
         }
 
-        switch (gltf_sampler.minFilter) {
-            case TINYGLTF_TEXTURE_FILTER_NEAREST:
+        switch (gltf_sampler.min_filter) {
+            case 9728:  // NEAREST
                 sampler.min_filter = ModelSampler::Filter::Nearest; break;
-            case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_NEAREST:
+            case 9984:  // NEAREST_MIPMAP_NEAREST
                 sampler.min_filter = ModelSampler::Filter::NearestMipmapNearest; break;
-            case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_NEAREST:
+            case 9985:  // LINEAR_MIPMAP_NEAREST
                 sampler.min_filter = ModelSampler::Filter::LinearMipmapNearest; break;
-            case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_LINEAR:
+            case 9986:  // NEAREST_MIPMAP_LINEAR
                 sampler.min_filter = ModelSampler::Filter::NearestMipmapLinear; break;
             default:
                 sampler.min_filter = ModelSampler::Filter::LinearMipmapLinear; break;
         }
 
-        switch (gltf_sampler.wrapS) {
-            case TINYGLTF_TEXTURE_WRAP_CLAMP_TO_EDGE:
-                sampler.wrap_s = ModelSampler::Wrap::ClampToEdge; break;
-            case TINYGLTF_TEXTURE_WRAP_MIRRORED_REPEAT:
-                sampler.wrap_s = ModelSampler::Wrap::MirroredRepeat; break;
-            default:
-                sampler.wrap_s = ModelSampler::Wrap::Repeat; break;
-        }
-
-        switch (gltf_sampler.wrapT) {
-            case TINYGLTF_TEXTURE_WRAP_CLAMP_TO_EDGE:
-                sampler.wrap_t = ModelSampler::Wrap::ClampToEdge; break;
-            case TINYGLTF_TEXTURE_WRAP_MIRRORED_REPEAT:
-                sampler.wrap_t = ModelSampler::Wrap::MirroredRepeat; break;
-            default:
-                sampler.wrap_t = ModelSampler::Wrap::Repeat; break;
-        }
+        auto to_wrap = [](std::int32_t mode) {
+            switch (mode) {
+                case 33071: return ModelSampler::Wrap::ClampToEdge;
+                case 33648: return ModelSampler::Wrap::MirroredRepeat;
+                default: return ModelSampler::Wrap::Repeat;
+            }
+        };
+        sampler.wrap_s = to_wrap(gltf_sampler.wrap_s);
+        sampler.wrap_t = to_wrap(gltf_sampler.wrap_t);
 
         asset->samplers.push_back(sampler);
     }
 
     // Load nodes
-    for (const auto& gltf_node : gltf_model.nodes) {
+    for (const auto& gltf_node : doc.nodes()) {
         ModelNode node;
         node.name = gltf_node.name;
         node.mesh_index = gltf_node.mesh;
         node.skin_index = gltf_node.skin;
-
-        if (!gltf_node.translation.empty()) {
-            node.translation = {
-                static_cast<float>(gltf_node.translation[0]),
-                static_cast<float>(gltf_node.translation[1]),
-                static_cast<float>(gltf_node.translation[2])
-            };
+        node.translation = gltf_node.translation;
+        node.rotation = gltf_node.rotation;
+        node.scale = gltf_node.scale;
+
+        // Only the translation part of a matrix is representable here
+        if (gltf_node.matrix) {
+            const auto& m = *gltf_node.matrix;
+            node.translation = {m[12], m[13], m[14]};
         }
 
-        if (!gltf_node.rotation.empty()) {
-            node.rotation = {
-                static_cast<float>(gltf_node.rotation[0]),
-                static_cast<float>(gltf_node.rotation[1]),
-                static_cast<float>(gltf_node.rotation[2]),
-                static_cast<float>(gltf_node.rotation[3])
-            };
-        }
-
-        if (!gltf_node.scale.empty()) {
-            node.scale = {
-                static_cast<float>(gltf_node.scale[0]),
-                static_cast<float>(gltf_node.scale[1]),
-                static_cast<float>(gltf_node.scale[2])
-            };
-        }
-
-        for (int child : gltf_node.children) {
+        for (std::int32_t child : gltf_node.children) {
             node.children.push_back(static_cast<std::uint32_t>(child));
         }
 
@@ -354,28 +314,22 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
     }
 
     // Load skins
-    for (const auto& gltf_skin : gltf_model.skins) {
+    for (const auto& gltf_skin : doc.skins()) {
         ModelSkin skin;
         skin.name = gltf_skin.name;
         skin.skeleton_root = gltf_skin.skeleton;
 
-        for (int joint : gltf_skin.joints) {
+        for (std::int32_t joint : gltf_skin.joints) {
             skin.joints.push_back(static_cast<std::uint32_t>(joint));
         }
 
         // Load inverse bind matrices
-        if (gltf_skin.inverseBindMatrices >= 0) {
-            const auto& accessor = gltf_model.accessors[gltf_skin.inverseBindMatrices];
-            const auto& view = gltf_model.bufferViews[accessor.bufferView];
-            const auto& buffer = gltf_model.buffers[view.buffer];
-
-            const float* matrices = reinterpret_cast<const float*>(
-                buffer.data.data() + view.byteOffset + accessor.byteOffset);
-
-            skin.inverse_bind_matrices.resize(accessor.count);
-            for (std::size_t i = 0; i < accessor.count; ++i) {
-                std::memcpy(skin.inverse_bind_matrices[i].data(),
-                           matrices + i * 16, 16 * sizeof(float));
+        if (gltf_skin.inverse_bind_matrices >= 0) {
+            auto view = doc.accessor(gltf_skin.inverse_bind_matrices);
+            if (view && view.value().components == 16) {
+                skin.inverse_bind_matrices.resize(view.value().count);
+                gltf_unpack_floats(view.value(), skin.inverse_bind_matrices.front().data(),
+                                   sizeof(std::array<float, 16>), 16);
             }
         }
 
@@ -383,7 +337,7 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
     }
 
     // Load animations
-    for (const auto& gltf_anim : gltf_model.animations) {
+    for (const auto& gltf_anim : doc.animations()) {
         ModelAnimation anim;
         anim.name = gltf_anim.name;
 
@@ -391,34 +345,15 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
             AnimationSampler sampler;
 
             // Input (times)
-            {
-                const auto& accessor = gltf_model.accessors[gltf_sampler.input];
-                const auto& view = gltf_model.bufferViews[accessor.bufferView];
-                const auto& buffer = gltf_model.buffers[view.buffer];
-
-                const float* data = reinterpret_cast<const float*>(
-                    buffer.data.data() + view.byteOffset + accessor.byteOffset);
-                sampler.input.assign(data, data + accessor.count);
-
-                // Track max time for duration
-                if (!sampler.input.empty() && sampler.input.back() > anim.duration) {
-                    anim.duration = sampler.input.back();
-                }
+            extract_floats(gltf_sampler.input, sampler.input, 1);
+            if (!sampler.input.empty() && sampler.input.back() > anim.duration) {
+                anim.duration = sampler.input.back();
             }
 
-            // Output (values)
-            {
-                const auto& accessor = gltf_model.accessors[gltf_sampler.output];
-                const auto& view = gltf_model.bufferViews[accessor.bufferView];
-                const auto& buffer = gltf_model.buffers[view.buffer];
-
-                int components = 3;
-                if (accessor.type == TINYGLTF_TYPE_VEC4) components = 4;
-                else if (accessor.type == TINYGLTF_TYPE_SCALAR) components = 1;
-
-                const float* data = reinterpret_cast<const float*>(
-                    buffer.data.data() + view.byteOffset + accessor.byteOffset);
-                sampler.output.assign(data, data + accessor.count * components);
+            // Output (values; normalized integer rotations are widened)
+            auto output = doc.accessor(gltf_sampler.output);
+            if (output) {
+                extract_floats(gltf_sampler.output, sampler.output, output.value().components);
             }
 
             if (gltf_sampler.interpolation == "STEP") {
@@ -453,17 +388,22 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
         asset->animations.push_back(std::move(anim));
     }
 
+    if (!accessor_error.empty()) {
+        return void_core::Err<ModelPtr>(
+            AssetError::parse_error(ctx.path().str(), accessor_error));
+    }
+
     // Load scenes
-    for (const auto& gltf_scene : gltf_model.scenes) {
+    for (const auto& gltf_scene : doc.scenes()) {
         ModelScene scene;
         scene.name = gltf_scene.name;
-        for (int node : gltf_scene.nodes) {
+        for (std::int32_t node : gltf_scene.nodes) {
             scene.root_nodes.push_back(static_cast<std::uint32_t>(node));
         }
         asset->scenes.push_back(std::move(scene));
     }
 
-    asset->default_scene = gltf_model.defaultScene;
+    asset->default_scene = doc.default_scene();
 
     // Apply scale if configured
     if (std::abs(m_config.scale - 1.0f) > 0.0001f) {
@@ -473,16 +413,6 @@ LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool is_binary)
     return void_core::Ok(std::move(asset));
 }
 
-#else // !VOID_HAS_TINYGLTF
-
-LoadResult<ModelAsset> ModelLoader::load_gltf(LoadContext& ctx, bool) {
-    (void)ctx;
-    return void_core::Err<std::unique_ptr<ModelAsset>>(
-        void_core::Error("glTF loading requires tinygltf (VOID_HAS_TINYGLTF not defined)"));
-}
-
-#endif // VOID_HAS_TINYGLTF
-
 LoadResult<ModelAsset> ModelLoader::load_obj(LoadContext& ctx) {
     // Simple OBJ parser
     auto asset = std::make_unique<ModelAsset>();
@@ -0,0 +1,122 @@
+/// @file mapped_file.cpp
+/// @brief Read-only memory-mapped file implementation
+
+#include <void_engine/asset/mapped_file.hpp>
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define VOID_ASSET_HAS_MMAP 1
+#endif
+
+namespace void_asset {
+
+// =============================================================================
+// MappedFile
+// =============================================================================
+
+MappedFile::~MappedFile() {
+    reset();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(other.m_data)
+    , m_size(other.m_size)
+    , m_open(other.m_open)
+    , m_mapped(other.m_mapped)
+    , m_fallback(std::move(other.m_fallback))
+{
+    if (!m_mapped) {
+        m_data = m_fallback.data();
+    }
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_open = false;
+    other.m_mapped = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        reset();
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_open = other.m_open;
+        m_mapped = other.m_mapped;
+        m_fallback = std::move(other.m_fallback);
+        if (!m_mapped) {
+            m_data = m_fallback.data();
+        }
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_open = false;
+        other.m_mapped = false;
+    }
+    return *this;
+}
+
+void MappedFile::reset() noexcept {
+#ifdef VOID_ASSET_HAS_MMAP
+    if (m_mapped && m_data) {
+        ::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+    m_mapped = false;
+    m_fallback.clear();
+    m_fallback.shrink_to_fit();
+}
+
+void_core::Result<MappedFile> MappedFile::open(const std::string& path) {
+    MappedFile file;
+
+#ifdef VOID_ASSET_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return void_core::Err<MappedFile>(void_core::Error(void_core::ErrorCode::IOError, "Failed to map file: " + path));
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return void_core::Err<MappedFile>(void_core::Error(void_core::ErrorCode::IOError, "Failed to map file: " + path));
+    }
+
+    file.m_size = static_cast<std::size_t>(st.st_size);
+    file.m_open = true;
+    if (file.m_size > 0) {
+        void* ptr = ::mmap(nullptr, file.m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            ::close(fd);
+            return void_core::Err<MappedFile>(void_core::Error(void_core::ErrorCode::IOError, "Failed to map file: " + path));
+        }
+        ::madvise(ptr, file.m_size, MADV_SEQUENTIAL);
+        file.m_data = static_cast<const std::uint8_t*>(ptr);
+        file.m_mapped = true;
+    }
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return void_core::Err<MappedFile>(void_core::Error(void_core::ErrorCode::IOError, "Failed to map file: " + path));
+    }
+    auto size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    file.m_fallback.resize(static_cast<std::size_t>(size));
+    if (size > 0 && !in.read(reinterpret_cast<char*>(file.m_fallback.data()), size)) {
+        return void_core::Err<MappedFile>(void_core::Error(void_core::ErrorCode::IOError, "Failed to map file: " + path));
+    }
+    file.m_data = file.m_fallback.data();
+    file.m_size = file.m_fallback.size();
+    file.m_open = true;
+#endif
+
+    return void_core::Ok(std::move(file));
+}
+
+} // namespace void_asset
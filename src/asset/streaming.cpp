@@ -0,0 +1,489 @@
+/// @file streaming.cpp
+/// @brief void_asset residency manager implementation
+
+#include <void_engine/asset/streaming.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace void_asset {
+
+// =============================================================================
+// StreamableDesc
+// =============================================================================
+
+StreamableDesc StreamableDesc::texture(AssetId id, std::uint32_t width,
+                                       std::uint32_t height,
+                                       std::uint32_t bytes_per_pixel) {
+    StreamableDesc desc;
+    desc.id = id;
+    desc.category = StreamingCategory::Texture;
+
+    std::uint32_t w = std::max(width, 1u);
+    std::uint32_t h = std::max(height, 1u);
+    while (true) {
+        desc.level_bytes.push_back(static_cast<std::size_t>(w) * h * bytes_per_pixel);
+        if (w == 1 && h == 1) break;
+        w = std::max(w / 2, 1u);
+        h = std::max(h / 2, 1u);
+    }
+    return desc;
+}
+
+StreamableDesc StreamableDesc::mesh(AssetId id, std::vector<std::size_t> lod_bytes) {
+    StreamableDesc desc;
+    desc.id = id;
+    desc.category = StreamingCategory::Mesh;
+    desc.level_bytes = std::move(lod_bytes);
+    return desc;
+}
+
+// =============================================================================
+// ResidencyManager
+// =============================================================================
+
+ResidencyManager::ResidencyManager(ResidencyManagerConfig config)
+    : m_config(std::move(config)) {}
+
+void ResidencyManager::register_asset(StreamableDesc desc) {
+    std::lock_guard lock(m_mutex);
+
+    auto it = m_entries.find(desc.id);
+    if (it != m_entries.end()) {
+        // Keep runtime state only if the level layout is unchanged
+        if (it->second.desc.level_count() != desc.level_count()) {
+            it->second.resident = k_not_resident;
+            it->second.target = k_not_resident;
+            it->second.in_flight = k_not_resident;
+        }
+        it->second.desc = std::move(desc);
+        return;
+    }
+
+    Entry entry;
+    entry.desc = std::move(desc);
+    auto id = entry.desc.id;
+    m_entries.emplace(id, std::move(entry));
+}
+
+bool ResidencyManager::unregister_asset(AssetId id) {
+    bool was_resident = false;
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it == m_entries.end()) {
+            return false;
+        }
+        was_resident = it->second.resident != k_not_resident;
+        m_entries.erase(it);
+    }
+
+    if (was_resident && m_stream_out) {
+        m_stream_out(id, k_not_resident);
+    }
+    return true;
+}
+
+bool ResidencyManager::is_registered(AssetId id) const {
+    std::lock_guard lock(m_mutex);
+    return m_entries.find(id) != m_entries.end();
+}
+
+void ResidencyManager::request(const ResidencyRequest& req) {
+    std::lock_guard lock(m_request_mutex);
+    auto [it, inserted] = m_pending_requests.try_emplace(req.id, req);
+    if (!inserted) {
+        it->second.merge(req);
+    }
+}
+
+void ResidencyManager::request(const std::vector<ResidencyRequest>& reqs) {
+    std::lock_guard lock(m_request_mutex);
+    for (const auto& req : reqs) {
+        auto [it, inserted] = m_pending_requests.try_emplace(req.id, req);
+        if (!inserted) {
+            it->second.merge(req);
+        }
+    }
+}
+
+void ResidencyManager::complete_stream_in(AssetId id, std::uint32_t level, bool success) {
+    std::lock_guard lock(m_completion_mutex);
+    m_completions.push_back(Completion{id, level, success});
+}
+
+void ResidencyManager::update(float dt) {
+    (void)dt;
+
+    std::unordered_map<AssetId, ResidencyRequest> requests;
+    {
+        std::lock_guard lock(m_request_mutex);
+        std::swap(requests, m_pending_requests);
+    }
+
+    std::vector<Completion> completions;
+    {
+        std::lock_guard lock(m_completion_mutex);
+        std::swap(completions, m_completions);
+    }
+
+    std::vector<ResidencyEvent> events;
+    std::vector<StreamOp> outs;
+    std::vector<StreamOp> ins;
+
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_frame;
+        merge_requests_unlocked(requests);
+        apply_completions_unlocked(completions, events);
+        assign_targets_unlocked();
+        plan_stream_out_unlocked(outs, events);
+        plan_stream_in_unlocked(ins);
+    }
+
+    // Callbacks run without the lock so they may query the manager
+    if (m_stream_out) {
+        for (const auto& op : outs) {
+            m_stream_out(op.id, op.level);
+        }
+    }
+
+    for (const auto& op : ins) {
+        if (!m_stream_in) {
+            // No loader: levels are treated as immediately available
+            complete_stream_in(op.id, op.level, true);
+            continue;
+        }
+        if (!m_stream_in(op.id, op.level)) {
+            std::lock_guard lock(m_mutex);
+            auto it = m_entries.find(op.id);
+            if (it != m_entries.end() && it->second.in_flight == op.level) {
+                it->second.in_flight = k_not_resident;
+                --m_stream_ins;
+            }
+        }
+    }
+
+    if (events.empty()) {
+        return;
+    }
+
+    if (m_on_event) {
+        for (const auto& event : events) {
+            m_on_event(event);
+        }
+    }
+
+    std::lock_guard lock(m_mutex);
+    m_events.insert(m_events.end(), events.begin(), events.end());
+}
+
+std::uint32_t ResidencyManager::resident_level(AssetId id) const {
+    std::lock_guard lock(m_mutex);
+    auto it = m_entries.find(id);
+    return it != m_entries.end() ? it->second.resident : k_not_resident;
+}
+
+std::uint32_t ResidencyManager::target_level(AssetId id) const {
+    std::lock_guard lock(m_mutex);
+    auto it = m_entries.find(id);
+    return it != m_entries.end() ? it->second.target : k_not_resident;
+}
+
+bool ResidencyManager::is_streaming(AssetId id) const {
+    std::lock_guard lock(m_mutex);
+    auto it = m_entries.find(id);
+    return it != m_entries.end() && it->second.in_flight != k_not_resident;
+}
+
+std::vector<ResidencyEvent> ResidencyManager::drain_events() {
+    std::lock_guard lock(m_mutex);
+    std::vector<ResidencyEvent> events;
+    std::swap(events, m_events);
+    return events;
+}
+
+void ResidencyManager::set_budget(StreamingCategory category, std::size_t bytes) {
+    std::lock_guard lock(m_mutex);
+    m_config.with_budget(category, bytes);
+}
+
+StreamingStats ResidencyManager::stats() const {
+    std::lock_guard lock(m_mutex);
+
+    StreamingStats s;
+    s.budget_bytes = m_config.budgets;
+    s.tracked_assets = m_entries.size();
+    s.stream_ins = m_stream_ins;
+    s.stream_outs = m_stream_outs;
+    s.failures = m_failures;
+    s.frames = m_frame;
+    s.over_budget_frames = m_over_budget_frames;
+
+    for (const auto& [id, entry] : m_entries) {
+        auto cat = static_cast<std::size_t>(entry.desc.category);
+        if (entry.resident != k_not_resident) {
+            s.resident_bytes[cat] += entry.desc.resident_bytes(entry.resident);
+            ++s.resident_assets;
+        }
+        if (entry.in_flight != k_not_resident) {
+            s.in_flight_bytes[cat] += entry.desc.level_bytes[entry.in_flight];
+            ++s.in_flight;
+        }
+    }
+    return s;
+}
+
+// -----------------------------------------------------------------------------
+// Residency pass
+// -----------------------------------------------------------------------------
+
+float ResidencyManager::compute_priority(const Entry& entry) const {
+    if (!is_wanted(entry)) {
+        return 0.0f;
+    }
+    const auto& req = entry.last_request;
+    if (req.pinned) {
+        return std::numeric_limits<float>::max();
+    }
+    float half = std::max(m_config.priority_half_distance, 0.001f);
+    float distance = std::max(req.distance, 0.0f);
+    return req.importance * half / (half + distance);
+}
+
+bool ResidencyManager::is_wanted(const Entry& entry) const {
+    return entry.ever_requested &&
+           m_frame - entry.last_request_frame <= m_config.request_linger_frames;
+}
+
+void ResidencyManager::merge_requests_unlocked(
+    std::unordered_map<AssetId, ResidencyRequest>& requests) {
+    for (auto& [id, req] : requests) {
+        auto it = m_entries.find(id);
+        if (it == m_entries.end()) {
+            continue;
+        }
+        it->second.last_request = req;
+        it->second.last_request_frame = m_frame;
+        it->second.ever_requested = true;
+    }
+
+    for (auto& [id, entry] : m_entries) {
+        entry.priority = compute_priority(entry);
+    }
+}
+
+void ResidencyManager::apply_completions_unlocked(const std::vector<Completion>& completions,
+                                                  std::vector<ResidencyEvent>& events) {
+    for (const auto& done : completions) {
+        auto it = m_entries.find(done.id);
+        if (it == m_entries.end()) {
+            continue;
+        }
+        auto& entry = it->second;
+        if (entry.in_flight != done.level) {
+            continue;  // Stale completion (asset re-registered or cancelled)
+        }
+        entry.in_flight = k_not_resident;
+
+        ResidencyEvent event;
+        event.id = done.id;
+        event.category = entry.desc.category;
+        event.previous_level = entry.resident;
+
+        if (!done.success) {
+            ++m_failures;
+            event.type = ResidencyEventType::Failed;
+            event.level = entry.resident;
+            events.push_back(event);
+            continue;
+        }
+
+        if (entry.resident == k_not_resident || done.level < entry.resident) {
+            entry.resident = done.level;
+            event.type = ResidencyEventType::Refined;
+            event.level = entry.resident;
+            events.push_back(event);
+        }
+    }
+}
+
+void ResidencyManager::assign_targets_unlocked() {
+    std::array<std::vector<Entry*>, k_streaming_category_count> by_category;
+    for (auto& [id, entry] : m_entries) {
+        by_category[static_cast<std::size_t>(entry.desc.category)].push_back(&entry);
+    }
+
+    bool over_budget = false;
+
+    for (std::size_t cat = 0; cat < k_streaming_category_count; ++cat) {
+        auto& list = by_category[cat];
+
+        // Wanted assets by priority, then unwanted ones by recency so the
+        // least recently requested data is the first to go
+        std::sort(list.begin(), list.end(), [this](const Entry* a, const Entry* b) {
+            bool wa = is_wanted(*a);
+            bool wb = is_wanted(*b);
+            if (wa != wb) return wa;
+            if (wa && a->priority != b->priority) return a->priority > b->priority;
+            if (a->last_request_frame != b->last_request_frame) {
+                return a->last_request_frame > b->last_request_frame;
+            }
+            return a->desc.id < b->desc.id;
+        });
+
+        std::size_t remaining = m_config.budgets[cat];
+
+        for (auto* entry : list) {
+            const auto& desc = entry->desc;
+            if (desc.level_count() == 0) {
+                entry->target = k_not_resident;
+                continue;
+            }
+
+            std::uint32_t start;
+            if (is_wanted(*entry)) {
+                start = std::min(entry->last_request.level, desc.coarsest_level());
+                if (entry->last_request.pinned) {
+                    std::size_t cost = desc.resident_bytes(start);
+                    if (cost > remaining) {
+                        over_budget = true;
+                        remaining = 0;
+                    } else {
+                        remaining -= cost;
+                    }
+                    entry->target = start;
+                    continue;
+                }
+            } else if (entry->resident != k_not_resident) {
+                // Keep cached data while it fits, never refine it
+                start = entry->resident;
+            } else {
+                entry->target = k_not_resident;
+                continue;
+            }
+
+            std::uint32_t level = start;
+            while (level <= desc.coarsest_level() && desc.resident_bytes(level) > remaining) {
+                ++level;
+            }
+
+            if (level > desc.coarsest_level()) {
+                entry->target = k_not_resident;
+            } else {
+                entry->target = level;
+                remaining -= desc.resident_bytes(level);
+            }
+        }
+    }
+
+    if (over_budget) {
+        ++m_over_budget_frames;
+    }
+}
+
+void ResidencyManager::plan_stream_out_unlocked(std::vector<StreamOp>& ops,
+                                                std::vector<ResidencyEvent>& events) {
+    for (auto& [id, entry] : m_entries) {
+        if (entry.resident == k_not_resident) {
+            continue;
+        }
+        if (entry.target != k_not_resident && entry.target <= entry.resident) {
+            continue;
+        }
+
+        ResidencyEvent event;
+        event.type = entry.target == k_not_resident
+            ? ResidencyEventType::Evicted
+            : ResidencyEventType::Degraded;
+        event.id = id;
+        event.category = entry.desc.category;
+        event.previous_level = entry.resident;
+        event.level = entry.target;
+        events.push_back(event);
+
+        ops.push_back(StreamOp{id, entry.target});
+        entry.resident = entry.target;
+        ++m_stream_outs;
+    }
+}
+
+void ResidencyManager::plan_stream_in_unlocked(std::vector<StreamOp>& ops) {
+    std::vector<Entry*> candidates;
+    for (auto& [id, entry] : m_entries) {
+        if (entry.target == k_not_resident || entry.in_flight != k_not_resident) {
+            continue;
+        }
+        if (entry.resident != k_not_resident && entry.resident <= entry.target) {
+            continue;
+        }
+        candidates.push_back(&entry);
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Entry* a, const Entry* b) {
+        if (a->priority != b->priority) return a->priority > b->priority;
+        return a->desc.id < b->desc.id;
+    });
+
+    std::size_t started = 0;
+    std::size_t bytes = 0;
+
+    for (auto* entry : candidates) {
+        if (started >= m_config.max_stream_ins_per_frame) {
+            break;
+        }
+
+        // Step one level finer per load so coarse data arrives first
+        std::uint32_t next = entry->resident == k_not_resident
+            ? entry->desc.coarsest_level()
+            : entry->resident - 1;
+        std::size_t cost = entry->desc.level_bytes[next];
+
+        if (m_config.max_stream_in_bytes_per_frame > 0 && started > 0 &&
+            bytes + cost > m_config.max_stream_in_bytes_per_frame) {
+            break;
+        }
+
+        entry->in_flight = next;
+        ops.push_back(StreamOp{entry->desc.id, next});
+        bytes += cost;
+        ++started;
+        ++m_stream_ins;
+    }
+}
+
+// =============================================================================
+// Debug Utilities
+// =============================================================================
+
+namespace debug {
+
+std::string format_streaming_stats(const StreamingStats& stats) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "Streaming Statistics:\n";
+    auto to_mb = [](std::size_t bytes) { return static_cast<double>(bytes) / 1024.0 / 1024.0; };
+    for (std::size_t i = 0; i < k_streaming_category_count; ++i) {
+        auto cat = static_cast<StreamingCategory>(i);
+        oss << "  " << streaming_category_name(cat) << ": "
+            << to_mb(stats.resident_bytes[i]) << " / "
+            << to_mb(stats.budget_bytes[i]) << " MB";
+        if (stats.in_flight_bytes[i] > 0) {
+            oss << " (+" << to_mb(stats.in_flight_bytes[i]) << " MB in flight)";
+        }
+        oss << "\n";
+    }
+    oss << "  Tracked: " << stats.tracked_assets << "\n";
+    oss << "  Resident: " << stats.resident_assets << "\n";
+    oss << "  In Flight: " << stats.in_flight << "\n";
+    oss << "  Stream Ins: " << stats.stream_ins << "\n";
+    oss << "  Stream Outs: " << stats.stream_outs << "\n";
+    oss << "  Failures: " << stats.failures << "\n";
+    oss << "  Over-Budget Frames: " << stats.over_budget_frames << "\n";
+    return oss.str();
+}
+
+} // namespace debug
+
+} // namespace void_asset
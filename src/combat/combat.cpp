@@ -150,161 +150,452 @@ DamageResult DamageProcessor::apply_damage(const DamageInfo& info, VitalsCompone
 ProjectileSystem::ProjectileSystem() = default;
 ProjectileSystem::~ProjectileSystem() = default;
 
+namespace {
+
+template<typename T>
+void swap_remove(std::vector<T>& values, std::size_t index) {
+    if (index + 1 != values.size()) {
+        values[index] = std::move(values.back());
+    }
+    values.pop_back();
+}
+
+} // namespace
+
+ProjectileConfigId ProjectileSystem::register_config(const ProjectileConfig& config) {
+    std::uint32_t index = allocate_config(config, true);
+    return index != k_no_index ? config_id(index) : ProjectileConfigId{};
+}
+
+const ProjectileConfig* ProjectileSystem::get_config(ProjectileConfigId id) const {
+    std::uint32_t index = config_index(id);
+    return index != k_no_index ? &m_configs[index] : nullptr;
+}
+
+ProjectileConfigId ProjectileSystem::config_of(ProjectileId id) const {
+    std::uint32_t index = dense_index(id);
+    return index != k_no_index ? config_id(m_config_index[index]) : ProjectileConfigId{};
+}
+
+std::uint32_t ProjectileSystem::allocate_config(const ProjectileConfig& config, bool registered) {
+    std::uint32_t index;
+    if (!m_free_configs.empty()) {
+        index = m_free_configs.back();
+        m_free_configs.pop_back();
+        m_configs[index] = config;
+    } else {
+        index = static_cast<std::uint32_t>(m_configs.size());
+        if (index > k_slot_mask) {
+            return k_no_index;
+        }
+        m_configs.push_back(config);
+        m_config_refs.push_back(0);
+        m_config_registered.push_back(0);
+        m_config_generation.push_back(1);
+    }
+    m_config_refs[index] = 0;
+    m_config_registered[index] = registered ? 1 : 0;
+    return index;
+}
+
+ProjectileConfigId ProjectileSystem::config_id(std::uint32_t index) const {
+    return ProjectileConfigId{(m_config_generation[index] << k_slot_bits) | index};
+}
+
+std::uint32_t ProjectileSystem::config_index(ProjectileConfigId id) const {
+    std::uint32_t index = id.value & k_slot_mask;
+    if (!id || index >= m_configs.size() ||
+        m_config_generation[index] != (id.value >> k_slot_bits) ||
+        (!m_config_registered[index] && m_config_refs[index] == 0)) {
+        return k_no_index;
+    }
+    return index;
+}
+
+void ProjectileSystem::release_config(std::uint32_t config) {
+    if (--m_config_refs[config] == 0 && !m_config_registered[config]) {
+        // The new generation invalidates outstanding ids for this configuration
+        std::uint32_t generation = (m_config_generation[config] + 1) & (0xFFFFFFFFu >> k_slot_bits);
+        m_config_generation[config] = generation ? generation : 1;
+        m_free_configs.push_back(config);
+        if (m_last_config == config) {
+            m_last_config = k_no_index;
+        }
+    }
+}
+
 ProjectileId ProjectileSystem::spawn(const ProjectileConfig& config, const void_math::Vec3& origin,
                                      const void_math::Vec3& direction, EntityId owner) {
-    ProjectileId id{m_next_id++};
-
-    ProjectileData data;
-    data.id = id;
-    data.config = config;
-    data.state.position = origin;
-    data.state.direction = direction;
-    data.state.velocity = {
-        direction.x * config.speed,
-        direction.y * config.speed,
-        direction.z * config.speed
+    // Reuse a live configuration with the same values, checking the last one first
+    auto is_live = [this](std::uint32_t index) {
+        return m_config_registered[index] || m_config_refs[index] > 0;
     };
-    data.state.lifetime_remaining = config.lifetime;
-    data.state.owner = owner;
-    data.state.active = true;
 
-    m_projectiles.push_back(std::move(data));
+    std::uint32_t index = k_no_index;
+    if (m_last_config != k_no_index && is_live(m_last_config) &&
+        m_configs[m_last_config] == config) {
+        index = m_last_config;
+    } else {
+        for (std::uint32_t i = 0; i < m_configs.size(); ++i) {
+            if (is_live(i) && m_configs[i] == config) {
+                index = i;
+                break;
+            }
+        }
+    }
+
+    if (index == k_no_index) {
+        index = allocate_config(config, false);
+        if (index == k_no_index) {
+            return ProjectileId{};
+        }
+    }
 
+    m_last_config = index;
+
+    ProjectileId id = spawn_at(index, origin, direction, owner);
+    if (!id && m_config_refs[index] == 0 && !m_config_registered[index]) {
+        m_free_configs.push_back(index);
+        m_last_config = k_no_index;
+    }
     return id;
 }
 
-void ProjectileSystem::destroy(ProjectileId id) {
-    m_projectiles.erase(
-        std::remove_if(m_projectiles.begin(), m_projectiles.end(),
-            [id](const ProjectileData& p) { return p.id == id; }),
-        m_projectiles.end());
+ProjectileId ProjectileSystem::spawn(ProjectileConfigId config, const void_math::Vec3& origin,
+                                     const void_math::Vec3& direction, EntityId owner) {
+    std::uint32_t index = config_index(config);
+    if (index == k_no_index) {
+        return ProjectileId{};
+    }
+    return spawn_at(index, origin, direction, owner);
+}
+
+ProjectileId ProjectileSystem::spawn_at(std::uint32_t config_index, const void_math::Vec3& origin,
+                                        const void_math::Vec3& direction, EntityId owner) {
+    const ProjectileConfig* cfg = &m_configs[config_index];
+
+    // Allocate a pooled slot
+    std::uint32_t slot;
+    if (!m_free_slots.empty()) {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(m_slot_index.size());
+        if (slot > k_slot_mask) {
+            return ProjectileId{};
+        }
+        m_slot_index.push_back(k_no_index);
+        m_slot_generation.push_back(1);
+    }
+
+    ProjectileId id{(m_slot_generation[slot] << k_slot_bits) | slot};
+    m_slot_index[slot] = static_cast<std::uint32_t>(m_ids.size());
+    ++m_config_refs[config_index];
+
+    m_ids.push_back(id);
+    m_config_index.push_back(config_index);
+    m_pos_x.push_back(origin.x);
+    m_pos_y.push_back(origin.y);
+    m_pos_z.push_back(origin.z);
+    m_prev_x.push_back(origin.x);
+    m_prev_y.push_back(origin.y);
+    m_prev_z.push_back(origin.z);
+    m_vel_x.push_back(direction.x * cfg->speed);
+    m_vel_y.push_back(direction.y * cfg->speed);
+    m_vel_z.push_back(direction.z * cfg->speed);
+    m_gravity.push_back(cfg->gravity);
+    m_drag.push_back(cfg->drag);
+    m_lifetime.push_back(cfg->lifetime);
+    m_owner.push_back(owner);
+    m_target.push_back(EntityId{});
+    m_penetrations.push_back(0);
+
+    return id;
+}
+
+std::uint32_t ProjectileSystem::dense_index(ProjectileId id) const {
+    std::uint32_t slot = id.value & k_slot_mask;
+    if (!id || slot >= m_slot_index.size() ||
+        m_slot_generation[slot] != (id.value >> k_slot_bits)) {
+        return k_no_index;
+    }
+    return m_slot_index[slot];
+}
+
+void ProjectileSystem::remove_at(std::uint32_t index) {
+    std::uint32_t slot = m_ids[index].value & k_slot_mask;
+    release_config(m_config_index[index]);
+
+    // Recycle the slot; the new generation invalidates outstanding ids
+    std::uint32_t generation = (m_slot_generation[slot] + 1) & (0xFFFFFFFFu >> k_slot_bits);
+    m_slot_generation[slot] = generation ? generation : 1;
+    m_slot_index[slot] = k_no_index;
+    m_free_slots.push_back(slot);
+
+    std::size_t last = m_ids.size() - 1;
+    if (index != last) {
+        m_slot_index[m_ids[last].value & k_slot_mask] = index;
+    }
+
+    swap_remove(m_ids, index);
+    swap_remove(m_config_index, index);
+    swap_remove(m_pos_x, index);
+    swap_remove(m_pos_y, index);
+    swap_remove(m_pos_z, index);
+    swap_remove(m_prev_x, index);
+    swap_remove(m_prev_y, index);
+    swap_remove(m_prev_z, index);
+    swap_remove(m_vel_x, index);
+    swap_remove(m_vel_y, index);
+    swap_remove(m_vel_z, index);
+    swap_remove(m_gravity, index);
+    swap_remove(m_drag, index);
+    swap_remove(m_lifetime, index);
+    swap_remove(m_owner, index);
+    swap_remove(m_target, index);
+    swap_remove(m_penetrations, index);
 }
 
-const ProjectileState* ProjectileSystem::get_state(ProjectileId id) const {
-    for (const auto& proj : m_projectiles) {
-        if (proj.id == id) {
-            return &proj.state;
+void ProjectileSystem::destroy(ProjectileId id) {
+    std::uint32_t index = dense_index(id);
+    if (index == k_no_index) {
+        return;
+    }
+
+    if (m_updating) {
+        // Dense indices must stay stable while hits are being reported;
+        // the projectile's own hit, if not reported yet, is dropped
+        m_pending_destroy.push_back(id);
+        if (index < m_hits.size()) {
+            m_hits[index].hit = false;
         }
+        return;
+    }
+
+    remove_at(index);
+}
+
+std::optional<ProjectileState> ProjectileSystem::get_state(ProjectileId id) const {
+    std::uint32_t index = dense_index(id);
+    if (index == k_no_index) {
+        return std::nullopt;
+    }
+
+    ProjectileState state;
+    state.position = {m_pos_x[index], m_pos_y[index], m_pos_z[index]};
+    state.velocity = {m_vel_x[index], m_vel_y[index], m_vel_z[index]};
+    float speed = std::sqrt(state.velocity.x * state.velocity.x +
+                            state.velocity.y * state.velocity.y +
+                            state.velocity.z * state.velocity.z);
+    if (speed > 0.001f) {
+        state.direction = {state.velocity.x / speed, state.velocity.y / speed, state.velocity.z / speed};
     }
-    return nullptr;
+    state.lifetime_remaining = m_lifetime[index];
+    state.owner = m_owner[index];
+    state.target = m_target[index];
+    state.penetrations = m_penetrations[index];
+    state.active = true;
+    return state;
 }
 
 void ProjectileSystem::update(float dt) {
-    auto it = m_projectiles.begin();
-    while (it != m_projectiles.end()) {
-        auto& proj = *it;
+    // Update lifetime; expired projectiles are removed before they move
+    std::size_t count = m_ids.size();
+    float* lifetime = m_lifetime.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        lifetime[i] -= dt;
+    }
+    for (std::size_t i = count; i-- > 0;) {
+        if (m_lifetime[i] <= 0) {
+            remove_at(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    integrate(dt);
+    sweep();
+    apply_hits();
+    update_homing(dt);
+}
+
+void ProjectileSystem::integrate(float dt) {
+    std::size_t count = m_ids.size();
+
+    std::copy(m_pos_x.begin(), m_pos_x.end(), m_prev_x.begin());
+    std::copy(m_pos_y.begin(), m_pos_y.end(), m_prev_y.begin());
+    std::copy(m_pos_z.begin(), m_pos_z.end(), m_prev_z.begin());
+
+    // Plain loops over separate arrays so the compiler can vectorize them
+    float* vx = m_vel_x.data();
+    float* vy = m_vel_y.data();
+    float* vz = m_vel_z.data();
+    const float* gravity = m_gravity.data();
+    const float* drag = m_drag.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        float damping = 1.0f / (1.0f + drag[i] * dt);
+        vx[i] = vx[i] * damping;
+        vy[i] = (vy[i] - gravity[i] * dt) * damping;
+        vz[i] = vz[i] * damping;
+    }
+
+    float* px = m_pos_x.data();
+    float* py = m_pos_y.data();
+    float* pz = m_pos_z.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        pz[i] += vz[i] * dt;
+    }
+}
+
+void ProjectileSystem::sweep() {
+    std::size_t count = m_ids.size();
+    m_hits.clear();
+    if (count == 0 || (!m_batch_raycast && !m_raycast)) {
+        return;
+    }
 
-        if (!proj.state.active) {
-            it = m_projectiles.erase(it);
+    m_sweeps.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& sweep = m_sweeps[i];
+        sweep.from = {m_prev_x[i], m_prev_y[i], m_prev_z[i]};
+        sweep.to = {m_pos_x[i], m_pos_y[i], m_pos_z[i]};
+        sweep.radius = m_configs[m_config_index[i]].radius;
+        sweep.owner = m_owner[i];
+    }
+    m_hits.assign(count, ProjectileHit{});
+
+    if (m_batch_raycast) {
+        m_batch_raycast(m_sweeps, m_hits);
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& hit = m_hits[i];
+        hit.hit = m_raycast(m_sweeps[i].from, m_sweeps[i].to, hit.point, hit.normal, hit.entity);
+    }
+}
+
+void ProjectileSystem::apply_hits() {
+    // Only projectiles present at sweep time have hits; any spawned by
+    // callbacks are appended after them
+    m_updating = true;
+    for (std::size_t i = 0; i < m_hits.size(); ++i) {
+        const auto& hit = m_hits[i];
+        if (!hit.hit) {
             continue;
         }
 
-        // Update lifetime
-        proj.state.lifetime_remaining -= dt;
-        if (proj.state.lifetime_remaining <= 0) {
-            it = m_projectiles.erase(it);
-            continue;
+        // Copy what is needed first: the callback may spawn projectiles and
+        // grow m_configs
+        const ProjectileConfig& config = m_configs[m_config_index[i]];
+        const float damage = config.damage;
+        const bool destroy_on_hit = config.destroy_on_hit;
+        const std::uint32_t max_penetrations = config.max_penetrations;
+
+        if (m_on_hit) {
+            m_on_hit(m_ids[i], hit.entity, hit.point, damage);
         }
 
-        // Apply gravity
-        proj.state.velocity.y -= proj.config.gravity * dt;
-
-        // Store old position for raycast
-        void_math::Vec3 old_pos = proj.state.position;
-
-        // Update position
-        proj.state.position.x += proj.state.velocity.x * dt;
-        proj.state.position.y += proj.state.velocity.y * dt;
-        proj.state.position.z += proj.state.velocity.z * dt;
-
-        // Check for hits
-        if (m_raycast) {
-            void_math::Vec3 hit_point, hit_normal;
-            EntityId hit_entity;
-
-            if (m_raycast(old_pos, proj.state.position, hit_point, hit_normal, hit_entity)) {
-                // Hit something
-                if (m_on_hit) {
-                    m_on_hit(proj.id, hit_entity, hit_point, proj.config.damage);
-                }
-
-                if (proj.config.destroy_on_hit) {
-                    if (proj.state.penetrations >= proj.config.max_penetrations) {
-                        it = m_projectiles.erase(it);
-                        continue;
-                    }
-                    proj.state.penetrations++;
-                }
+        if (destroy_on_hit) {
+            if (m_penetrations[i] >= max_penetrations) {
+                m_pending_destroy.push_back(m_ids[i]);
+                continue;
             }
+            m_penetrations[i]++;
         }
+    }
+    m_updating = false;
 
-        // Homing behavior
-        if (proj.config.homing && proj.state.target && m_get_target_position) {
-            void_math::Vec3 target_pos = m_get_target_position(proj.state.target);
-
-            // Calculate direction to target
-            float dx = target_pos.x - proj.state.position.x;
-            float dy = target_pos.y - proj.state.position.y;
-            float dz = target_pos.z - proj.state.position.z;
-
-            float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
-            if (dist > 0.001f) {
-                // Normalize target direction
-                dx /= dist;
-                dy /= dist;
-                dz /= dist;
-
-                // Current speed
-                float speed = std::sqrt(
-                    proj.state.velocity.x * proj.state.velocity.x +
-                    proj.state.velocity.y * proj.state.velocity.y +
-                    proj.state.velocity.z * proj.state.velocity.z
-                );
-
-                if (speed > 0.001f) {
-                    float cur_dx = proj.state.velocity.x / speed;
-                    float cur_dy = proj.state.velocity.y / speed;
-                    float cur_dz = proj.state.velocity.z / speed;
-
-                    // Lerp towards target direction based on homing strength
-                    float t = proj.config.homing_strength * dt;
-                    t = std::min(t, 1.0f);
-
-                    float new_dx = cur_dx + (dx - cur_dx) * t;
-                    float new_dy = cur_dy + (dy - cur_dy) * t;
-                    float new_dz = cur_dz + (dz - cur_dz) * t;
-
-                    // Renormalize
-                    float new_len = std::sqrt(new_dx * new_dx + new_dy * new_dy + new_dz * new_dz);
-                    if (new_len > 0.001f) {
-                        new_dx /= new_len;
-                        new_dy /= new_len;
-                        new_dz /= new_len;
-
-                        // Apply new velocity
-                        proj.state.velocity.x = new_dx * speed;
-                        proj.state.velocity.y = new_dy * speed;
-                        proj.state.velocity.z = new_dz * speed;
-                        proj.state.direction = {new_dx, new_dy, new_dz};
-                    }
-                }
-            }
+    for (ProjectileId id : m_pending_destroy) {
+        destroy(id);
+    }
+    m_pending_destroy.clear();
+}
+
+void ProjectileSystem::update_homing(float dt) {
+    m_homing.clear();
+    m_homing_targets.clear();
+    for (std::uint32_t i = 0; i < m_ids.size(); ++i) {
+        if (m_configs[m_config_index[i]].homing && m_target[i]) {
+            m_homing.push_back(i);
+            m_homing_targets.push_back(m_target[i]);
         }
+    }
 
-        ++it;
+    if (m_homing.empty() || (!m_get_target_positions && !m_get_target_position)) {
+        return;
+    }
+
+    m_homing_positions.resize(m_homing.size());
+    if (m_get_target_positions) {
+        m_get_target_positions(m_homing_targets, m_homing_positions);
+    } else {
+        for (std::size_t h = 0; h < m_homing.size(); ++h) {
+            m_homing_positions[h] = m_get_target_position(m_homing_targets[h]);
+        }
+    }
+
+    for (std::size_t h = 0; h < m_homing.size(); ++h) {
+        std::uint32_t i = m_homing[h];
+        const void_math::Vec3& target_pos = m_homing_positions[h];
+
+        // Calculate direction to target
+        float dx = target_pos.x - m_pos_x[i];
+        float dy = target_pos.y - m_pos_y[i];
+        float dz = target_pos.z - m_pos_z[i];
+
+        float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (dist <= 0.001f) {
+            continue;
+        }
+        dx /= dist;
+        dy /= dist;
+        dz /= dist;
+
+        // Current speed
+        float speed = std::sqrt(m_vel_x[i] * m_vel_x[i] + m_vel_y[i] * m_vel_y[i] + m_vel_z[i] * m_vel_z[i]);
+        if (speed <= 0.001f) {
+            continue;
+        }
+        float cur_dx = m_vel_x[i] / speed;
+        float cur_dy = m_vel_y[i] / speed;
+        float cur_dz = m_vel_z[i] / speed;
+
+        // Lerp towards target direction based on homing strength
+        float t = std::min(m_configs[m_config_index[i]].homing_strength * dt, 1.0f);
+
+        float new_dx = cur_dx + (dx - cur_dx) * t;
+        float new_dy = cur_dy + (dy - cur_dy) * t;
+        float new_dz = cur_dz + (dz - cur_dz) * t;
+
+        // Renormalize and apply new velocity
+        float new_len = std::sqrt(new_dx * new_dx + new_dy * new_dy + new_dz * new_dz);
+        if (new_len > 0.001f) {
+            m_vel_x[i] = new_dx / new_len * speed;
+            m_vel_y[i] = new_dy / new_len * speed;
+            m_vel_z[i] = new_dz / new_len * speed;
+        }
     }
 }
 
 void ProjectileSystem::clear() {
-    m_projectiles.clear();
+    if (m_updating) {
+        // Called from a hit callback: destroy everything once hits are reported
+        for (ProjectileId id : m_ids) {
+            destroy(id);
+        }
+        return;
+    }
+
+    for (std::size_t i = m_ids.size(); i-- > 0;) {
+        remove_at(static_cast<std::uint32_t>(i));
+    }
 }
 
 void ProjectileSystem::set_projectile_target(ProjectileId projectile, EntityId target) {
-    for (auto& proj : m_projectiles) {
-        if (proj.id == projectile) {
-            proj.state.target = target;
-            return;
-        }
+    std::uint32_t index = dense_index(projectile);
+    if (index != k_no_index) {
+        m_target[index] = target;
     }
 }
 
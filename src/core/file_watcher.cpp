@@ -0,0 +1,681 @@
+/// @file file_watcher.cpp
+/// @brief Event-driven file watching (inotify) for void_core
+///
+/// One inotify descriptor and one dispatch thread serve every subscriber.
+/// Raw kernel events are folded into a per-path pending change and only
+/// dispatched once the path has been quiet for the debounce window, so an
+/// editor's write/truncate/rename burst arrives as a single event.
+
+#include <void_engine/core/file_watcher.hpp>
+#include <void_engine/core/log.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <thread>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#define VOID_HAS_INOTIFY 1
+#else
+#define VOID_HAS_INOTIFY 0
+#endif
+
+namespace void_core {
+
+namespace {
+
+std::string normalize_watch_path(const std::string& path) {
+    std::error_code ec;
+    auto abs = std::filesystem::absolute(path, ec);
+    std::string result = (ec ? std::filesystem::path(path) : abs).lexically_normal().string();
+    while (result.size() > 1 && result.back() == '/') {
+        result.pop_back();
+    }
+    return result;
+}
+
+std::string strip_trailing_separator(std::string path) {
+    while (path.size() > 1 && (path.back() == '/' || path.back() == '\\')) {
+        path.pop_back();
+    }
+    return path;
+}
+
+bool is_under(const std::string& path, const std::string& root) {
+    return path.size() > root.size() &&
+           path.compare(0, root.size(), root) == 0 &&
+           path[root.size()] == '/';
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// FileWatchService::Impl
+// =============================================================================
+
+struct FileWatchService::Impl {
+    struct Subscription {
+        std::string given;              ///< Path as passed by the caller
+        std::string root;               ///< Normalized absolute path
+        bool directory = false;
+        Listener listener;
+        std::vector<std::string> dirs;  ///< OS-level directory watches held
+    };
+
+    struct Pending {
+        ReloadEventType type = ReloadEventType::FileModified;
+        std::string old_path;
+        std::chrono::steady_clock::time_point last_change;
+    };
+
+    mutable std::mutex mutex;
+    std::map<SubscriptionId, Subscription> subscriptions;
+    SubscriptionId next_id = 1;
+    std::chrono::milliseconds debounce{50};
+    FileWatchStats counters;
+
+    // Owned by the dispatch thread
+    std::unordered_map<std::string, Pending> pending;
+
+#if VOID_HAS_INOTIFY
+    struct DirWatch {
+        int wd = -1;
+        std::size_t refs = 0;
+    };
+
+    int fd = -1;
+    int wake_pipe[2] = {-1, -1};
+    std::unordered_map<int, std::string> wd_to_dir;
+    std::unordered_map<std::string, DirWatch> dirs;
+    std::unordered_map<std::uint32_t, std::string> moved_from;
+    std::thread thread;
+    std::atomic<bool> running{false};
+    bool shut_down = false;
+
+    static constexpr std::uint32_t k_watch_mask =
+        IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE |
+        IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR | IN_EXCL_UNLINK;
+
+    Impl() {
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd >= 0 && pipe2(wake_pipe, O_NONBLOCK | O_CLOEXEC) != 0) {
+            close(fd);
+            fd = -1;
+        }
+        if (fd < 0) {
+            VOID_LOG_WARN("[FileWatchService] inotify unavailable, native watching disabled");
+        }
+    }
+
+    ~Impl() {
+        stop();
+        if (fd >= 0) close(fd);
+        if (wake_pipe[0] >= 0) close(wake_pipe[0]);
+        if (wake_pipe[1] >= 0) close(wake_pipe[1]);
+    }
+
+    [[nodiscard]] bool available() const { return fd >= 0; }
+
+    void start_unlocked() {
+        if (shut_down || running.exchange(true)) {
+            return;
+        }
+        thread = std::thread([this]() { run(); });
+    }
+
+    /// Stop dispatching for good (process exit)
+    void shutdown() {
+        {
+            std::lock_guard lock(mutex);
+            shut_down = true;
+        }
+        stop();
+    }
+
+    void stop() {
+        if (!running.exchange(false)) {
+            return;
+        }
+        wake();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void wake() {
+        char byte = 1;
+        [[maybe_unused]] auto n = write(wake_pipe[1], &byte, 1);
+    }
+
+    // -------------------------------------------------------------------------
+    // Directory watch bookkeeping (mutex held)
+    // -------------------------------------------------------------------------
+
+    bool add_dir_ref(const std::string& dir) {
+        auto it = dirs.find(dir);
+        if (it != dirs.end()) {
+            ++it->second.refs;
+            return true;
+        }
+        int wd = inotify_add_watch(fd, dir.c_str(), k_watch_mask);
+        if (wd < 0) {
+            return false;
+        }
+        dirs[dir] = DirWatch{wd, 1};
+        wd_to_dir[wd] = dir;
+        return true;
+    }
+
+    void release_dir(const std::string& dir) {
+        auto it = dirs.find(dir);
+        if (it == dirs.end()) {
+            return;
+        }
+        if (--it->second.refs > 0) {
+            return;
+        }
+        inotify_rm_watch(fd, it->second.wd);
+        wd_to_dir.erase(it->second.wd);
+        dirs.erase(it);
+    }
+
+    void add_tree(Subscription& sub, const std::string& dir) {
+        if (add_dir_ref(dir)) {
+            sub.dirs.push_back(dir);
+        }
+        std::error_code ec;
+        for (auto it = std::filesystem::recursive_directory_iterator(dir, ec);
+             !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+            if (it->is_directory(ec)) {
+                auto sub_dir = it->path().lexically_normal().string();
+                if (add_dir_ref(sub_dir)) {
+                    sub.dirs.push_back(sub_dir);
+                }
+            }
+        }
+    }
+
+    void forget_tree(const std::string& dir) {
+        for (auto& [id, sub] : subscriptions) {
+            auto& held = sub.dirs;
+            for (auto it = held.begin(); it != held.end();) {
+                if (*it == dir || is_under(*it, dir)) {
+                    release_dir(*it);
+                    it = held.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Dispatch thread
+    // -------------------------------------------------------------------------
+
+    void run() {
+        alignas(inotify_event) char buffer[64 * 1024];
+
+        while (running.load()) {
+            int timeout = -1;
+            if (!pending.empty()) {
+                std::lock_guard lock(mutex);
+                timeout = static_cast<int>(std::max<std::int64_t>(debounce.count(), 1));
+            }
+
+            pollfd fds[2] = {{fd, POLLIN, 0}, {wake_pipe[0], POLLIN, 0}};
+            int ready = ::poll(fds, 2, timeout);
+            if (!running.load()) {
+                break;
+            }
+
+            if (ready > 0 && (fds[1].revents & POLLIN)) {
+                char drain[64];
+                while (read(wake_pipe[0], drain, sizeof(drain)) > 0) {}
+            }
+
+            if (ready > 0 && (fds[0].revents & POLLIN)) {
+                std::lock_guard lock(mutex);
+                while (true) {
+                    auto len = read(fd, buffer, sizeof(buffer));
+                    if (len <= 0) {
+                        break;
+                    }
+                    for (char* ptr = buffer; ptr < buffer + len;) {
+                        const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                        process_raw(*event);
+                        ptr += sizeof(inotify_event) + event->len;
+                    }
+                }
+
+                // A move out of every watched directory never gets its pair
+                for (auto& [cookie, path] : moved_from) {
+                    record(path, ReloadEventType::FileDeleted);
+                }
+                moved_from.clear();
+            }
+
+            flush_due(false);
+        }
+    }
+
+    void process_raw(const inotify_event& event) {
+        ++counters.raw_events;
+
+        if (event.mask & IN_Q_OVERFLOW) {
+            ++counters.overflows;
+            for (const auto& [id, sub] : subscriptions) {
+                record(sub.root, ReloadEventType::ForceReload);
+            }
+            return;
+        }
+
+        auto dir_it = wd_to_dir.find(event.wd);
+        if (dir_it == wd_to_dir.end()) {
+            return;
+        }
+
+        if (event.mask & IN_IGNORED) {
+            dirs.erase(dir_it->second);
+            wd_to_dir.erase(dir_it);
+            return;
+        }
+
+        if (event.len == 0 || event.name[0] == '\0') {
+            return;
+        }
+
+        std::string path = dir_it->second + "/" + event.name;
+
+        if (event.mask & IN_ISDIR) {
+            if (event.mask & (IN_CREATE | IN_MOVED_TO)) {
+                watch_new_directory(dir_it->second, path);
+            } else if (event.mask & (IN_DELETE | IN_MOVED_FROM)) {
+                forget_tree(path);
+            }
+            return;
+        }
+
+        if (event.mask & IN_CREATE) {
+            record(path, ReloadEventType::FileCreated);
+        } else if (event.mask & (IN_MODIFY | IN_CLOSE_WRITE)) {
+            record(path, ReloadEventType::FileModified);
+        } else if (event.mask & IN_DELETE) {
+            record(path, ReloadEventType::FileDeleted);
+        } else if (event.mask & IN_MOVED_FROM) {
+            moved_from[event.cookie] = path;
+        } else if (event.mask & IN_MOVED_TO) {
+            auto from = moved_from.find(event.cookie);
+            if (from != moved_from.end()) {
+                record_rename(from->second, path);
+                moved_from.erase(from);
+            } else {
+                record(path, ReloadEventType::FileCreated);
+            }
+        }
+    }
+
+    void watch_new_directory(const std::string& parent, const std::string& dir) {
+        bool covered = false;
+        for (auto& [id, sub] : subscriptions) {
+            if (sub.directory && (sub.root == parent || is_under(parent, sub.root))) {
+                add_tree(sub, dir);
+                covered = true;
+            }
+        }
+        if (!covered) {
+            return;
+        }
+
+        // Files may have landed before the watch was in place
+        std::error_code ec;
+        for (auto it = std::filesystem::recursive_directory_iterator(dir, ec);
+             !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+            if (it->is_regular_file(ec)) {
+                record(it->path().lexically_normal().string(), ReloadEventType::FileCreated);
+            }
+        }
+    }
+
+    /// Fold a raw change into the pending change for the same path
+    void record(const std::string& path, ReloadEventType type) {
+        auto now = std::chrono::steady_clock::now();
+        auto it = pending.find(path);
+        if (it == pending.end()) {
+            pending[path] = Pending{type, {}, now};
+            return;
+        }
+
+        auto& p = it->second;
+        p.last_change = now;
+
+        switch (p.type) {
+            case ReloadEventType::FileCreated:
+                if (type == ReloadEventType::FileDeleted) {
+                    pending.erase(it);  // Transient file, nothing to report
+                }
+                break;
+            case ReloadEventType::FileDeleted:
+                if (type != ReloadEventType::FileDeleted) {
+                    p.type = ReloadEventType::FileModified;  // Replaced
+                }
+                break;
+            case ReloadEventType::FileRenamed:
+                if (type == ReloadEventType::FileDeleted) {
+                    record(p.old_path, ReloadEventType::FileDeleted);
+                    it = pending.find(path);
+                    if (it != pending.end()) {
+                        it->second.type = ReloadEventType::FileDeleted;
+                        it->second.old_path.clear();
+                    }
+                }
+                break;
+            case ReloadEventType::ForceReload:
+                break;
+            default:
+                if (type == ReloadEventType::FileDeleted) {
+                    p.type = ReloadEventType::FileDeleted;
+                }
+                break;
+        }
+    }
+
+    void record_rename(const std::string& old_path, const std::string& new_path) {
+        auto old_it = pending.find(old_path);
+        if (old_it != pending.end() && old_it->second.type == ReloadEventType::FileCreated) {
+            // Atomic save: temp file written then renamed over the target
+            pending.erase(old_it);
+            record(new_path, ReloadEventType::FileModified);
+            return;
+        }
+        if (old_it != pending.end()) {
+            pending.erase(old_it);
+        }
+        pending[new_path] = Pending{ReloadEventType::FileRenamed, old_path,
+                                    std::chrono::steady_clock::now()};
+    }
+
+    void flush_due(bool force) {
+        if (pending.empty()) {
+            return;
+        }
+
+        std::vector<std::pair<Listener, std::vector<ReloadEvent>>> batches;
+        {
+            std::lock_guard lock(mutex);
+            auto now = std::chrono::steady_clock::now();
+
+            std::vector<std::pair<std::string, Pending>> due;
+            for (auto it = pending.begin(); it != pending.end();) {
+                if (force || now - it->second.last_change >= debounce) {
+                    due.emplace_back(it->first, std::move(it->second));
+                    it = pending.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            if (due.empty()) {
+                return;
+            }
+
+            for (const auto& [id, sub] : subscriptions) {
+                std::vector<ReloadEvent> events;
+                for (const auto& [path, change] : due) {
+                    translate(sub, path, change, events);
+                }
+                if (!events.empty()) {
+                    counters.dispatched_events += events.size();
+                    batches.emplace_back(sub.listener, std::move(events));
+                }
+            }
+        }
+
+        for (auto& [listener, events] : batches) {
+            if (listener) {
+                listener(events);
+            }
+        }
+    }
+#else
+    Impl() = default;
+    [[nodiscard]] bool available() const { return false; }
+    void stop() {}
+    void shutdown() {}
+#endif
+
+    /// Map an absolute-path change onto one subscription's view of it
+    static void translate(const Subscription& sub, const std::string& path,
+                          const Pending& change, std::vector<ReloadEvent>& out) {
+        auto as_given = [&sub](const std::string& abs) {
+            return sub.given + abs.substr(sub.root.size());
+        };
+
+        if (change.type == ReloadEventType::ForceReload) {
+            if (path == sub.root || is_under(path, sub.root) || is_under(sub.root, path)) {
+                out.push_back(ReloadEvent::force_reload(sub.given));
+            }
+            return;
+        }
+
+        if (!sub.directory) {
+            if (path == sub.root) {
+                auto type = change.type == ReloadEventType::FileRenamed
+                    ? ReloadEventType::FileModified
+                    : change.type;
+                out.emplace_back(type, sub.given);
+            } else if (change.type == ReloadEventType::FileRenamed && change.old_path == sub.root) {
+                out.push_back(ReloadEvent::deleted(sub.given));
+            }
+            return;
+        }
+
+        bool new_inside = is_under(path, sub.root);
+        if (change.type == ReloadEventType::FileRenamed) {
+            bool old_inside = is_under(change.old_path, sub.root);
+            if (new_inside && old_inside) {
+                out.push_back(ReloadEvent::renamed(as_given(change.old_path), as_given(path)));
+            } else if (new_inside) {
+                out.push_back(ReloadEvent::created(as_given(path)));
+            } else if (old_inside) {
+                out.push_back(ReloadEvent::deleted(as_given(change.old_path)));
+            }
+            return;
+        }
+
+        if (new_inside) {
+            out.emplace_back(change.type, as_given(path));
+        }
+    }
+};
+
+// =============================================================================
+// FileWatchService
+// =============================================================================
+
+FileWatchService::FileWatchService()
+    : m_impl(std::make_unique<Impl>()) {}
+
+FileWatchService::~FileWatchService() {
+    m_impl->stop();
+}
+
+FileWatchService& FileWatchService::instance() {
+    // Never destroyed: watchers owned by other statics may unsubscribe
+    // during static destruction. Only the dispatch thread is stopped at exit,
+    // before any static created ahead of the service is torn down.
+    static FileWatchService* s_instance = [] {
+        auto* service = new FileWatchService();
+        std::atexit([] { instance().m_impl->shutdown(); });
+        return service;
+    }();
+    return *s_instance;
+}
+
+bool FileWatchService::is_supported() {
+    return instance().m_impl->available();
+}
+
+Result<FileWatchService::SubscriptionId> FileWatchService::subscribe(
+    const std::string& path, Listener listener)
+{
+#if VOID_HAS_INOTIFY
+    if (!m_impl->available()) {
+        return Err<SubscriptionId>("Native file watching unavailable");
+    }
+
+    Impl::Subscription sub;
+    sub.given = strip_trailing_separator(path);
+    sub.root = normalize_watch_path(path);
+    sub.listener = std::move(listener);
+
+    std::error_code ec;
+    sub.directory = std::filesystem::is_directory(sub.root, ec);
+
+    std::lock_guard lock(m_impl->mutex);
+
+    if (sub.directory) {
+        m_impl->add_tree(sub, sub.root);
+        if (sub.dirs.empty()) {
+            return Err<SubscriptionId>("Failed to watch directory: " + path);
+        }
+    } else {
+        auto parent = std::filesystem::path(sub.root).parent_path().string();
+        if (!m_impl->add_dir_ref(parent)) {
+            return Err<SubscriptionId>("Failed to watch parent directory of: " + path);
+        }
+        sub.dirs.push_back(parent);
+    }
+
+    SubscriptionId id = m_impl->next_id++;
+    m_impl->subscriptions.emplace(id, std::move(sub));
+    m_impl->start_unlocked();
+    return Ok(id);
+#else
+    (void)path;
+    (void)listener;
+    return Err<SubscriptionId>("Native file watching not supported on this platform");
+#endif
+}
+
+void FileWatchService::unsubscribe(SubscriptionId id) {
+    std::lock_guard lock(m_impl->mutex);
+    auto it = m_impl->subscriptions.find(id);
+    if (it == m_impl->subscriptions.end()) {
+        return;
+    }
+#if VOID_HAS_INOTIFY
+    for (const auto& dir : it->second.dirs) {
+        m_impl->release_dir(dir);
+    }
+#endif
+    m_impl->subscriptions.erase(it);
+}
+
+void FileWatchService::set_debounce(std::chrono::milliseconds window) {
+    std::lock_guard lock(m_impl->mutex);
+    m_impl->debounce = window;
+}
+
+std::chrono::milliseconds FileWatchService::debounce() const {
+    std::lock_guard lock(m_impl->mutex);
+    return m_impl->debounce;
+}
+
+FileWatchStats FileWatchService::stats() const {
+    std::lock_guard lock(m_impl->mutex);
+    FileWatchStats s = m_impl->counters;
+    s.subscriptions = m_impl->subscriptions.size();
+#if VOID_HAS_INOTIFY
+    s.os_watches = m_impl->dirs.size();
+#endif
+    return s;
+}
+
+// =============================================================================
+// NativeFileWatcher
+// =============================================================================
+
+NativeFileWatcher::NativeFileWatcher()
+    : m_queue(std::make_shared<Queue>()) {}
+
+NativeFileWatcher::~NativeFileWatcher() {
+    clear();
+}
+
+Result<void> NativeFileWatcher::watch(const std::string& path) {
+    std::lock_guard lock(m_mutex);
+    if (m_watches.find(path) != m_watches.end()) {
+        return Ok();
+    }
+
+    auto queue = m_queue;
+    auto result = FileWatchService::instance().subscribe(path,
+        [queue](const std::vector<ReloadEvent>& events) {
+            std::lock_guard queue_lock(queue->mutex);
+            queue->events.insert(queue->events.end(), events.begin(), events.end());
+        });
+    if (!result) {
+        return Err(result.error());
+    }
+
+    m_watches[path] = result.value();
+    return Ok();
+}
+
+Result<void> NativeFileWatcher::unwatch(const std::string& path) {
+    std::lock_guard lock(m_mutex);
+    auto it = m_watches.find(path);
+    if (it == m_watches.end()) {
+        return Err("Path not being watched: " + path);
+    }
+    FileWatchService::instance().unsubscribe(it->second);
+    m_watches.erase(it);
+    return Ok();
+}
+
+std::vector<ReloadEvent> NativeFileWatcher::poll() {
+    std::lock_guard lock(m_queue->mutex);
+    std::vector<ReloadEvent> events;
+    std::swap(events, m_queue->events);
+    return events;
+}
+
+bool NativeFileWatcher::is_watching(const std::string& path) const {
+    std::lock_guard lock(m_mutex);
+    return m_watches.find(path) != m_watches.end();
+}
+
+std::size_t NativeFileWatcher::watched_count() const {
+    std::lock_guard lock(m_mutex);
+    return m_watches.size();
+}
+
+void NativeFileWatcher::clear() {
+    {
+        std::lock_guard lock(m_mutex);
+        for (const auto& [path, id] : m_watches) {
+            FileWatchService::instance().unsubscribe(id);
+        }
+        m_watches.clear();
+    }
+    std::lock_guard queue_lock(m_queue->mutex);
+    m_queue->events.clear();
+}
+
+// =============================================================================
+// Factory
+// =============================================================================
+
+std::unique_ptr<FileWatcher> create_file_watcher(std::chrono::milliseconds poll_interval) {
+    if (FileWatchService::is_supported()) {
+        return std::make_unique<NativeFileWatcher>();
+    }
+    return std::make_unique<PollingFileWatcher>(poll_interval);
+}
+
+} // namespace void_core
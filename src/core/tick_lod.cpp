@@ -0,0 +1,213 @@
+/// @file tick_lod.cpp
+/// @brief Significance-based update rate scheduling for void_core
+
+#include <void_engine/core/tick_lod.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace void_core {
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+namespace {
+
+/// Per-entity tick phase, so entities of one tier spread over its interval
+std::uint32_t phase_of(EntityId entity) {
+    std::uint64_t x = entity.value + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<std::uint32_t>(x ^ (x >> 31));
+}
+
+} // namespace
+
+// =============================================================================
+// TickLodScheduler
+// =============================================================================
+
+TickLodScheduler::TickLodScheduler(TickLodConfig config) {
+    set_config(std::move(config));
+}
+
+void TickLodScheduler::set_config(TickLodConfig config) {
+    m_config = std::move(config);
+    if (m_config.tier_intervals.empty()) {
+        m_config.tier_intervals.push_back(1);
+    }
+    for (auto& interval : m_config.tier_intervals) {
+        interval = std::max<std::uint32_t>(interval, 1);
+    }
+
+    auto last = static_cast<std::uint32_t>(m_config.tier_intervals.size() - 1);
+    for (auto& tier : m_tiers) {
+        tier = std::min(tier, last);
+    }
+}
+
+void TickLodScheduler::set_observers(std::span<const void_math::Vec3> positions) {
+    m_observers.assign(positions.begin(), positions.end());
+}
+
+void TickLodScheduler::add_entity(EntityId entity, const TickLodEntity& desc) {
+    auto it = m_index.find(entity);
+    if (it != m_index.end()) {
+        m_descs[it->second] = desc;
+        return;
+    }
+
+    m_index.emplace(entity, static_cast<std::uint32_t>(m_entities.size()));
+    m_entities.push_back(entity);
+    m_descs.push_back(desc);
+    m_tiers.push_back(0);
+    m_phases.push_back(phase_of(entity));
+    m_accumulated.push_back(0.0f);
+    m_ticking.push_back(0);  // First tick is decided by the next begin_frame()
+}
+
+void TickLodScheduler::remove_entity(EntityId entity) {
+    auto it = m_index.find(entity);
+    if (it == m_index.end()) {
+        return;
+    }
+
+    std::uint32_t index = it->second;
+    std::uint32_t last = static_cast<std::uint32_t>(m_entities.size() - 1);
+    m_index.erase(it);
+
+    if (index != last) {
+        m_entities[index] = m_entities[last];
+        m_descs[index] = m_descs[last];
+        m_tiers[index] = m_tiers[last];
+        m_phases[index] = m_phases[last];
+        m_accumulated[index] = m_accumulated[last];
+        m_ticking[index] = m_ticking[last];
+        m_index[m_entities[index]] = index;
+    }
+
+    m_entities.pop_back();
+    m_descs.pop_back();
+    m_tiers.pop_back();
+    m_phases.pop_back();
+    m_accumulated.pop_back();
+    m_ticking.pop_back();
+}
+
+void TickLodScheduler::clear() {
+    m_entities.clear();
+    m_descs.clear();
+    m_tiers.clear();
+    m_phases.clear();
+    m_accumulated.clear();
+    m_ticking.clear();
+    m_index.clear();
+    m_ticking_count = 0;
+    m_tier_counts.clear();
+}
+
+bool TickLodScheduler::contains(EntityId entity) const {
+    return m_index.find(entity) != m_index.end();
+}
+
+void TickLodScheduler::set_position(EntityId entity, const void_math::Vec3& position) {
+    auto it = m_index.find(entity);
+    if (it != m_index.end()) {
+        m_descs[it->second].position = position;
+    }
+}
+
+void TickLodScheduler::set_visible(EntityId entity, bool visible) {
+    auto it = m_index.find(entity);
+    if (it != m_index.end()) {
+        m_descs[it->second].visible = visible;
+    }
+}
+
+void TickLodScheduler::set_importance(EntityId entity, float importance) {
+    auto it = m_index.find(entity);
+    if (it != m_index.end()) {
+        m_descs[it->second].importance = importance;
+    }
+}
+
+void TickLodScheduler::set_always_tick(EntityId entity, bool always_tick) {
+    auto it = m_index.find(entity);
+    if (it != m_index.end()) {
+        m_descs[it->second].always_tick = always_tick;
+    }
+}
+
+std::uint32_t TickLodScheduler::tier_for(float distance, float scale) const {
+    auto last = static_cast<std::uint32_t>(m_config.tier_intervals.size() - 1);
+    auto bounds = std::min<std::size_t>(m_config.tier_distances.size(), last);
+    for (std::uint32_t tier = 0; tier < bounds; ++tier) {
+        if (distance <= m_config.tier_distances[tier] * scale) {
+            return tier;
+        }
+    }
+    return last;
+}
+
+std::uint32_t TickLodScheduler::interval_of(std::uint32_t tier) const {
+    return m_config.tier_intervals[tier];
+}
+
+void TickLodScheduler::begin_frame(float dt) {
+    ++m_frame;
+    m_frame_dt = dt;
+    m_ticking_count = 0;
+    m_tier_counts.assign(m_config.tier_intervals.size(), 0);
+
+    for (std::size_t i = 0; i < m_entities.size(); ++i) {
+        const TickLodEntity& desc = m_descs[i];
+
+        // Time since the last tick: restart after ticking last frame
+        m_accumulated[i] = (m_ticking[i] ? 0.0f : m_accumulated[i]) + dt;
+
+        std::uint32_t tier = 0;
+        if (!desc.always_tick && !m_observers.empty()) {
+            float nearest = std::numeric_limits<float>::max();
+            for (const auto& observer : m_observers) {
+                float dx = desc.position.x - observer.x;
+                float dy = desc.position.y - observer.y;
+                float dz = desc.position.z - observer.z;
+                nearest = std::min(nearest, dx * dx + dy * dy + dz * dz);
+            }
+
+            float distance = std::sqrt(nearest) / std::max(desc.importance, 1e-3f);
+            if (!desc.visible) {
+                distance *= m_config.hidden_distance_scale;
+            }
+
+            // Speed up immediately, slow down only past the hysteresis band
+            tier = tier_for(distance, 1.0f);
+            std::uint32_t current = m_tiers[i];
+            if (tier > current) {
+                tier = std::max(current, tier_for(distance, 1.0f + m_config.hysteresis));
+            }
+        }
+
+        m_tiers[i] = tier;
+        bool ticking = (m_frame + m_phases[i]) % interval_of(tier) == 0;
+        m_ticking[i] = ticking ? 1 : 0;
+
+        m_tier_counts[tier]++;
+        if (ticking) {
+            m_ticking_count++;
+        }
+    }
+}
+
+TickLodDecision TickLodScheduler::decision(EntityId entity) const {
+    auto it = m_index.find(entity);
+    if (it == m_index.end()) {
+        return TickLodDecision{true, m_frame_dt, 0};
+    }
+
+    std::uint32_t index = it->second;
+    return TickLodDecision{m_ticking[index] != 0, m_accumulated[index], m_tiers[index]};
+}
+
+} // namespace void_core
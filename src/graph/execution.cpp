@@ -4,6 +4,103 @@
 
 namespace void_graph {
 
+namespace {
+
+/// Executed node limit for one run, to stop runaway flow
+constexpr std::size_t k_max_iterations = 10000;
+
+/// Nesting limit when pulling values through chains of pure nodes
+constexpr std::size_t k_max_pure_depth = 64;
+
+/// Store a pin value; an unset value removes the pin so nodes see it as missing
+void store_pin(ExecutionContext& ctx, PinId pin, PinValue value) {
+    if (std::holds_alternative<std::monostate>(value)) {
+        ctx.pin_values.erase(pin);
+    } else {
+        ctx.pin_values[pin] = std::move(value);
+    }
+}
+
+/// First connection leaving an output pin
+const Connection* first_outgoing(const Graph& graph, PinId output_pin) {
+    for (const Connection* conn : graph.get_connections_for_pin(output_pin)) {
+        if (conn->source == output_pin) return conn;
+    }
+    return nullptr;
+}
+
+/// Connection feeding an input pin
+const Connection* incoming(const Graph& graph, PinId input_pin) {
+    for (const Connection* conn : graph.get_connections_for_pin(input_pin)) {
+        if (conn->target == input_pin) return conn;
+    }
+    return nullptr;
+}
+
+/// Exec target of an Execute instruction for the pin its node returned
+const CompiledExecTarget* find_exec_target(const CompiledGraph& graph,
+                                           const CompiledInstruction& instr, PinId next) {
+    std::span<const CompiledExecTarget> targets = graph.exec_targets();
+    for (std::uint32_t t = instr.arg2; t < instr.arg2 + instr.arg3; ++t) {
+        if (targets[t].output == next) return &targets[t];
+    }
+    return nullptr;
+}
+
+/// Compare two values of the same alternative
+bool values_equal(const PinValue& lhs, const PinValue& rhs) {
+    if (lhs.index() != rhs.index()) return false;
+
+    if (std::holds_alternative<bool>(lhs)) {
+        return std::get<bool>(lhs) == std::get<bool>(rhs);
+    } else if (std::holds_alternative<std::int32_t>(lhs)) {
+        return std::get<std::int32_t>(lhs) == std::get<std::int32_t>(rhs);
+    } else if (std::holds_alternative<std::int64_t>(lhs)) {
+        return std::get<std::int64_t>(lhs) == std::get<std::int64_t>(rhs);
+    } else if (std::holds_alternative<float>(lhs)) {
+        return std::get<float>(lhs) == std::get<float>(rhs);
+    } else if (std::holds_alternative<double>(lhs)) {
+        return std::get<double>(lhs) == std::get<double>(rhs);
+    } else if (std::holds_alternative<std::string>(lhs)) {
+        return std::get<std::string>(lhs) == std::get<std::string>(rhs);
+    } else if (std::holds_alternative<std::uint64_t>(lhs)) {
+        return std::get<std::uint64_t>(lhs) == std::get<std::uint64_t>(rhs);
+    } else if (std::holds_alternative<std::monostate>(lhs)) {
+        return true;  // Both are monostate
+    }
+    // For arrays, vectors, and std::any - we can't easily compare, treat as not equal
+    return false;
+}
+
+/// Apply a register math op. Arithmetic and ordering need float operands
+/// and leave dst untouched otherwise, as does division by zero
+void apply_register_op(CompiledInstruction::OpCode op, PinValue& dst,
+                       const PinValue& lhs, const PinValue& rhs) {
+    if (op == CompiledInstruction::OpCode::Eq) {
+        dst = values_equal(lhs, rhs);
+        return;
+    }
+
+    if (!std::holds_alternative<float>(lhs) || !std::holds_alternative<float>(rhs)) {
+        return;
+    }
+
+    const float a = std::get<float>(lhs);
+    const float b = std::get<float>(rhs);
+    switch (op) {
+        case CompiledInstruction::OpCode::Add: dst = a + b; break;
+        case CompiledInstruction::OpCode::Sub: dst = a - b; break;
+        case CompiledInstruction::OpCode::Mul: dst = a * b; break;
+        case CompiledInstruction::OpCode::Div:
+            if (b != 0.0f) dst = a / b;
+            break;
+        case CompiledInstruction::OpCode::Lt: dst = a < b; break;
+        default: break;
+    }
+}
+
+} // anonymous namespace
+
 // =============================================================================
 // DefaultNodeExecutor Implementation
 // =============================================================================
@@ -26,7 +123,7 @@ ExecutionId GraphExecutor::start(GraphInstance& instance, EventNode& event) {
 }
 
 ExecutionId GraphExecutor::start(GraphInstance& instance, NodeId start_node) {
-    ExecutionId id = ExecutionId::from_bits(next_execution_id_++);
+    ExecutionId id = allocate_execution_id();
 
     ExecutionData data;
     data.id = id;
@@ -60,6 +157,13 @@ void GraphExecutor::update(float delta_time) {
             data.instance->context().total_time += delta_time;
             ++data.instance->context().frame_count;
 
+            // Latent nodes without a registered action poll through resume()
+            if (data.state == ExecutionState::Suspended &&
+                std::none_of(latent_actions_.begin(), latent_actions_.end(),
+                             [&](const LatentAction& action) { return action.execution_id == id; })) {
+                data.state = ExecutionState::Running;
+            }
+
             if (data.state == ExecutionState::Running) {
                 run_execution(data);
             }
@@ -116,11 +220,10 @@ const ExecutionResult* GraphExecutor::get_result(ExecutionId id) const {
 }
 
 void GraphExecutor::run_execution(ExecutionData& data) {
-    const std::size_t max_iterations = 10000;  // Prevent infinite loops
     std::size_t iterations = 0;
 
     while (!data.stack.empty() && data.state == ExecutionState::Running) {
-        if (++iterations > max_iterations) {
+        if (++iterations > k_max_iterations) {
             data.state = ExecutionState::Error;
             data.result.error_message = "Max iterations exceeded";
             break;
@@ -166,21 +269,15 @@ void GraphExecutor::run_execution(ExecutionData& data) {
             // Pop this node and continue
             data.stack.pop_back();
         } else {
-            // Follow the exec pin to next node
-            const Graph& graph = data.instance->graph();
-            std::vector<PinId> connected = graph.get_connected_inputs(next_exec);
+            // Follow the exec pin to the node it is wired to
+            const Connection* next = first_outgoing(data.instance->graph(), next_exec);
 
-            if (connected.empty()) {
+            if (!next) {
                 data.stack.pop_back();
             } else {
-                // Find the node that owns the connected pin
-                for (const auto& node_ptr : graph.nodes()) {
-                    if (node_ptr->find_pin(connected[0])) {
-                        frame.node_id = node_ptr->id();
-                        frame.is_resuming = false;
-                        break;
-                    }
-                }
+                frame.node_id = next->target_node;
+                frame.is_resuming = false;
+                data.instance->context().current_exec_pin = next->target;
             }
         }
     }
@@ -209,11 +306,9 @@ PinId GraphExecutor::execute_node(ExecutionData& data, INode& node) {
     executor->pre_execute(node, data.instance->context());
 
     // Pull input values for non-exec pins
-    [[maybe_unused]] const Graph& graph = data.instance->graph();
     for (const auto& pin : node.input_pins()) {
-        if (pin.type != PinType::Exec && pin.is_connected) {
-            PinValue value = compute_input_value(data.instance->context(), pin);
-            data.instance->context().pin_values[pin.id] = std::move(value);
+        if (pin.type != PinType::Exec) {
+            store_pin(data.instance->context(), pin.id, pull_input(data, pin, 0));
         }
     }
 
@@ -233,9 +328,33 @@ PinId GraphExecutor::execute_node(ExecutionData& data, INode& node) {
     return result;
 }
 
+PinValue GraphExecutor::pull_input(ExecutionData& data, const Pin& input_pin, std::size_t depth) {
+    const Graph& graph = data.instance->graph();
+    ExecutionContext& ctx = data.instance->context();
+
+    const Connection* conn = incoming(graph, input_pin.id);
+    if (!conn) {
+        return compute_input_value(ctx, input_pin);
+    }
+
+    // Pure sources are evaluated on every pull; impure ones hold the value
+    // they produced when they last executed
+    INode* source = const_cast<Graph&>(graph).get_node(conn->source_node);
+    if (source && source->purity() == NodePurity::Pure && depth < k_max_pure_depth) {
+        for (const auto& pin : source->input_pins()) {
+            if (pin.type != PinType::Exec) {
+                store_pin(ctx, pin.id, pull_input(data, pin, depth + 1));
+            }
+        }
+        source->execute(ctx);
+    }
+
+    auto it = ctx.pin_values.find(conn->source);
+    return it != ctx.pin_values.end() ? it->second : PinValue{};
+}
+
 PinValue GraphExecutor::compute_input_value([[maybe_unused]] ExecutionContext& ctx, const Pin& input_pin) {
-    // This would need access to the graph to find connected output
-    // For now, return default value
+    // Unconnected input: its default value
     return input_pin.default_value.value;
 }
 
@@ -262,6 +381,13 @@ void GraphExecutor::clear_breakpoints() {
     breakpoints_.clear();
 }
 
+bool GraphExecutor::has_breakpoints(GraphId graph) const {
+    if (!debug_enabled_) return false;
+
+    auto it = breakpoints_.find(graph);
+    return it != breakpoints_.end() && !it->second.empty();
+}
+
 void GraphExecutor::step_into(ExecutionId id) {
     auto it = executions_.find(id);
     if (it != executions_.end() && it->second.state == ExecutionState::Paused) {
@@ -332,6 +458,10 @@ void GraphExecutor::register_latent_action(ExecutionContext& ctx,
     latent_actions_.push_back(std::move(action));
 }
 
+ExecutionId GraphExecutor::allocate_execution_id() {
+    return ExecutionId::from_bits(next_execution_id_++);
+}
+
 void GraphExecutor::update_latent_actions(float delta_time) {
     auto it = latent_actions_.begin();
     while (it != latent_actions_.end()) {
@@ -396,18 +526,31 @@ GraphResult<CompiledGraph> GraphCompiler::compile(const Graph& graph) {
 }
 
 GraphResult<CompiledGraph> GraphCompiler::compile(const Graph& graph,
-                                                    [[maybe_unused]] std::span<const std::string> events) {
+                                                    std::span<const std::string> events) {
     errors_.clear();
     warnings_.clear();
     next_register_ = 0;
     node_addresses_.clear();
+    node_slots_.clear();
+    pin_slots_.clear();
+    pin_registers_.clear();
+    pending_targets_.clear();
+    pending_nodes_.clear();
 
     CompiledGraph output;
     output.source_graph_ = graph.id();
+    output.source_revision_ = graph.revision();
+
+    // Compile each requested event
+    for (EventNode* event_node : graph.get_event_nodes()) {
+        if (std::find(events.begin(), events.end(), event_node->event_name()) != events.end()) {
+            compile_event(graph, *event_node, output);
+        }
+    }
 
-    // Compile each event
-    for (const auto& event_node : graph.get_event_nodes()) {
-        compile_event(graph, *event_node, output);
+    // Every reachable node has an address now
+    for (const auto& [target, node_id] : pending_targets_) {
+        output.exec_targets_[target].address = static_cast<std::uint32_t>(node_addresses_[node_id]);
     }
 
     output.register_count_ = next_register_;
@@ -425,21 +568,137 @@ GraphResult<CompiledGraph> GraphCompiler::compile(const Graph& graph,
     return GraphResult<CompiledGraph>(std::move(output));
 }
 
-void GraphCompiler::compile_node([[maybe_unused]] const Graph& graph, INode& node, CompiledGraph& output) {
+void GraphCompiler::compile_node(const Graph& graph, INode& node, CompiledGraph& output) {
     node_addresses_[node.id()] = output.instructions_.size();
 
+    // Gather data inputs; a pure source feeding several inputs is evaluated once
+    std::unordered_set<NodeId> evaluated;
+    for (const auto& pin : node.input_pins()) {
+        if (pin.type != PinType::Exec) {
+            compile_input(graph, node, pin, output, evaluated);
+        }
+    }
+
     CompiledInstruction instr;
     instr.op = CompiledInstruction::OpCode::Execute;
-    instr.arg1 = node.id().to_bits();
+    instr.arg1 = node_slot(node, output);
+    instr.arg2 = static_cast<std::uint32_t>(output.exec_targets_.size());
+
+    // Resolve each exec output to the node it is wired to. Like the
+    // interpreter, an output with several wires follows the first
+    for (const auto& pin : node.output_pins()) {
+        if (pin.type != PinType::Exec) continue;
+
+        const Connection* conn = first_outgoing(graph, pin.id);
+        if (!conn) continue;
+
+        INode* target = const_cast<Graph&>(graph).get_node(conn->target_node);
+        if (!target) continue;
+
+        pending_targets_.emplace_back(output.exec_targets_.size(), target->id());
+        output.exec_targets_.push_back({pin.id, conn->target, 0});
+        pending_nodes_.push_back(target);
+    }
+
+    instr.arg3 = static_cast<std::uint32_t>(output.exec_targets_.size()) - instr.arg2;
     emit(output, instr);
 }
 
 void GraphCompiler::compile_event(const Graph& graph, EventNode& event, CompiledGraph& output) {
+    if (output.entry_points_.count(event.event_name())) {
+        warnings_.push_back("Duplicate event '" + event.event_name() + "', only the first is compiled");
+        return;
+    }
+
     output.entry_points_[event.event_name()] = output.instructions_.size();
-    compile_node(graph, event, output);
 
-    // Follow execution flow
-    // This is simplified - full implementation would traverse the graph
+    // Follow execution flow; each node is compiled once and shared by all
+    // paths reaching it
+    pending_nodes_.push_back(&event);
+    while (!pending_nodes_.empty()) {
+        INode* node = pending_nodes_.front();
+        pending_nodes_.pop_front();
+
+        if (!node_addresses_.count(node->id())) {
+            compile_node(graph, *node, output);
+        }
+    }
+}
+
+void GraphCompiler::compile_input(const Graph& graph, INode& node, const Pin& pin,
+                                  CompiledGraph& output, std::unordered_set<NodeId>& evaluated) {
+    const std::uint32_t target_slot = pin_slot(pin.id, node, output);
+
+    CompiledInstruction load;
+    CompiledInstruction store;
+    store.op = CompiledInstruction::OpCode::StorePin;
+    store.arg1 = target_slot;
+
+    const Connection* conn = incoming(graph, pin.id);
+    INode* source = conn ? const_cast<Graph&>(graph).get_node(conn->source_node) : nullptr;
+
+    if (source) {
+        if (source->purity() == NodePurity::Pure) {
+            compile_pure(graph, *source, output, evaluated);
+        }
+
+        // Each output pin has its own register
+        auto [it, inserted] = pin_registers_.try_emplace(conn->source, 0);
+        if (inserted) {
+            it->second = allocate_register();
+        }
+
+        load.op = CompiledInstruction::OpCode::LoadPin;
+        load.arg1 = it->second;
+        load.arg2 = pin_slot(conn->source, *source, output);
+    } else if (!std::holds_alternative<std::monostate>(pin.default_value.value)) {
+        load.op = CompiledInstruction::OpCode::LoadConst;
+        load.arg1 = allocate_register();
+        load.immediate = pin.default_value.value;
+    } else {
+        // Unconnected without a default: the node sees the pin as missing
+        return;
+    }
+
+    store.arg2 = load.arg1;
+    emit(output, std::move(load));
+    emit(output, std::move(store));
+}
+
+void GraphCompiler::compile_pure(const Graph& graph, INode& node, CompiledGraph& output,
+                                 std::unordered_set<NodeId>& evaluated) {
+    // Also stops on data cycles between pure nodes
+    if (!evaluated.insert(node.id()).second) return;
+
+    for (const auto& pin : node.input_pins()) {
+        if (pin.type != PinType::Exec) {
+            compile_input(graph, node, pin, output, evaluated);
+        }
+    }
+
+    CompiledInstruction instr;
+    instr.op = CompiledInstruction::OpCode::ExecutePure;
+    instr.arg1 = node_slot(node, output);
+    emit(output, instr);
+}
+
+std::uint32_t GraphCompiler::node_slot(INode& node, CompiledGraph& output) {
+    auto [it, inserted] = node_slots_.try_emplace(node.id(), 0);
+    if (inserted) {
+        it->second = static_cast<std::uint32_t>(output.nodes_.size());
+        output.nodes_.push_back(&node);
+    }
+    return it->second;
+}
+
+std::uint32_t GraphCompiler::pin_slot(PinId pin, INode& owner, CompiledGraph& output) {
+    auto [it, inserted] = pin_slots_.try_emplace(pin, 0);
+    if (inserted) {
+        it->second = static_cast<std::uint32_t>(output.pins_.size());
+        output.pins_.push_back(pin);
+        output.pin_owners_.push_back(node_slot(owner, output));
+    }
+    return it->second;
 }
 
 std::uint32_t GraphCompiler::allocate_register() {
@@ -459,14 +718,256 @@ void GraphCompiler::optimize(CompiledGraph& output) {
     }
 }
 
-void GraphCompiler::fold_constants([[maybe_unused]] CompiledGraph& output) {
-    // Identify sequences of constant operations and fold them
-    // This is a placeholder for the actual implementation
+bool GraphCompiler::is_foldable(const INode& node) {
+    // Built-in pure nodes whose result depends only on their inputs; pure
+    // functions and variable getters may read state that changes at runtime
+    return node.purity() == NodePurity::Pure &&
+           (dynamic_cast<const MathNode*>(&node) ||
+            dynamic_cast<const ConversionNode*>(&node) ||
+            dynamic_cast<const RerouteNode*>(&node));
 }
 
-void GraphCompiler::eliminate_dead_code([[maybe_unused]] CompiledGraph& output) {
-    // Remove unreachable instructions
-    // This is a placeholder for the actual implementation
+void GraphCompiler::fold_constants(CompiledGraph& output) {
+    using Op = CompiledInstruction::OpCode;
+    auto& code = output.instructions_;
+
+    // Register and pin values are only tracked within straight-line code
+    std::vector<bool> block_start(code.size() + 1, false);
+    for (const auto& [name, address] : output.entry_points_) {
+        block_start[address] = true;
+    }
+    for (const auto& target : output.exec_targets_) {
+        block_start[target.address] = true;
+    }
+    for (std::size_t i = 0; i < code.size(); ++i) {
+        switch (code[i].op) {
+            case Op::Jump:
+                block_start[std::min<std::size_t>(code[i].arg1, code.size())] = true;
+                break;
+            case Op::JumpIf:
+            case Op::JumpIfNot:
+                block_start[std::min<std::size_t>(code[i].arg2, code.size())] = true;
+                block_start[i + 1] = true;
+                break;
+            case Op::Execute:
+                block_start[i + 1] = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::unordered_map<std::uint32_t, PinValue> registers;                 // Register -> constant
+    std::unordered_map<std::uint32_t, std::optional<PinValue>> stored;     // Pin slot -> stored constant
+    std::unordered_map<std::uint32_t, PinValue> folded;                    // Pin slot -> folded output
+
+    for (std::size_t i = 0; i < code.size(); ++i) {
+        if (block_start[i]) {
+            registers.clear();
+            stored.clear();
+        }
+
+        CompiledInstruction& instr = code[i];
+        switch (instr.op) {
+            case Op::Nop:
+                break;
+
+            case Op::LoadConst:
+                registers[instr.arg1] = instr.immediate;
+                break;
+
+            case Op::LoadPin: {
+                // Outputs of folded nodes are the same wherever they are read
+                auto it = folded.find(instr.arg2);
+                if (it != folded.end()) {
+                    instr.op = Op::LoadConst;
+                    instr.arg2 = 0;
+                    instr.immediate = it->second;
+                    registers[instr.arg1] = it->second;
+                } else {
+                    registers.erase(instr.arg1);
+                }
+                break;
+            }
+
+            case Op::StorePin: {
+                auto it = registers.find(instr.arg2);
+                stored[instr.arg1] = it != registers.end() ? std::optional<PinValue>(it->second) : std::nullopt;
+                break;
+            }
+
+            case Op::ExecutePure: {
+                INode* node = output.nodes_[instr.arg1];
+                if (!is_foldable(*node)) break;
+
+                // Inputs are stored right before the node; one not stored in
+                // this block is unconnected and has no default
+                ExecutionContext scratch;
+                bool constant = true;
+                for (const auto& pin : node->input_pins()) {
+                    if (pin.type == PinType::Exec) continue;
+
+                    auto slot = pin_slots_.find(pin.id);
+                    if (slot == pin_slots_.end()) continue;
+
+                    auto it = stored.find(slot->second);
+                    if (it == stored.end()) continue;
+                    if (!it->second) {
+                        constant = false;
+                        break;
+                    }
+                    store_pin(scratch, pin.id, *it->second);
+                }
+                if (!constant) break;
+
+                node->execute(scratch);
+                for (const auto& pin : node->output_pins()) {
+                    auto slot = pin_slots_.find(pin.id);
+                    if (slot == pin_slots_.end()) continue;
+
+                    auto it = scratch.pin_values.find(pin.id);
+                    folded[slot->second] = it != scratch.pin_values.end() ? it->second : PinValue{};
+                }
+                instr.op = Op::Nop;
+                break;
+            }
+
+            default:
+                // Anything else may change registers or pins we cannot see
+                registers.clear();
+                stored.clear();
+                break;
+        }
+    }
+}
+
+void GraphCompiler::eliminate_dead_code(CompiledGraph& output) {
+    using Op = CompiledInstruction::OpCode;
+    auto& code = output.instructions_;
+    const std::size_t count = code.size();
+
+    // Keep only instructions reachable from an entry point
+    std::vector<bool> keep(count, false);
+    std::vector<std::size_t> work;
+    for (const auto& [name, address] : output.entry_points_) {
+        work.push_back(address);
+    }
+    while (!work.empty()) {
+        std::size_t ip = work.back();
+        work.pop_back();
+
+        while (ip < count && !keep[ip]) {
+            keep[ip] = true;
+            const CompiledInstruction& instr = code[ip];
+
+            if (instr.op == Op::Execute) {
+                for (std::uint32_t t = instr.arg2; t < instr.arg2 + instr.arg3; ++t) {
+                    work.push_back(output.exec_targets_[t].address);
+                }
+                break;
+            }
+            if (instr.op == Op::Return) break;
+            if (instr.op == Op::Jump) {
+                ip = instr.arg1;
+                continue;
+            }
+            if (instr.op == Op::JumpIf || instr.op == Op::JumpIfNot) {
+                work.push_back(instr.arg2);
+            }
+            ++ip;
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (code[i].op == Op::Nop) keep[i] = false;
+    }
+
+    // Drop stores to pins of nodes that are no longer executed, and loads
+    // into registers nothing reads, until neither changes
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        std::vector<bool> node_used(output.nodes_.size(), false);
+        std::vector<bool> register_read(next_register_, false);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!keep[i]) continue;
+
+            const CompiledInstruction& instr = code[i];
+            switch (instr.op) {
+                case Op::Execute:
+                case Op::ExecutePure:
+                    node_used[instr.arg1] = true;
+                    break;
+                case Op::StorePin:
+                    register_read[instr.arg2] = true;
+                    break;
+                case Op::JumpIf:
+                case Op::JumpIfNot:
+                    register_read[instr.arg1] = true;
+                    break;
+                case Op::Copy:
+                case Op::Neg:
+                case Op::Not:
+                    register_read[instr.arg2] = true;
+                    break;
+                case Op::Add: case Op::Sub: case Op::Mul: case Op::Div:
+                case Op::And: case Op::Or:
+                case Op::Eq: case Op::Ne: case Op::Lt: case Op::Le: case Op::Gt: case Op::Ge:
+                    register_read[instr.arg2] = true;
+                    register_read[instr.arg3] = true;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!keep[i]) continue;
+
+            const CompiledInstruction& instr = code[i];
+            bool dead = false;
+            if (instr.op == Op::StorePin) {
+                dead = !node_used[output.pin_owners_[instr.arg1]];
+            } else if (instr.op == Op::LoadConst || instr.op == Op::LoadPin || instr.op == Op::Copy) {
+                dead = !register_read[instr.arg1];
+            }
+            if (dead) {
+                keep[i] = false;
+                changed = true;
+            }
+        }
+    }
+
+    // Compact; a removed instruction maps to the next one kept
+    std::vector<std::uint32_t> remap(count + 1);
+    std::uint32_t kept = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        remap[i] = kept;
+        if (keep[i]) ++kept;
+    }
+    remap[count] = kept;
+
+    std::vector<CompiledInstruction> compacted;
+    compacted.reserve(kept);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!keep[i]) continue;
+
+        CompiledInstruction instr = std::move(code[i]);
+        if (instr.op == Op::Jump) {
+            instr.arg1 = remap[std::min<std::size_t>(instr.arg1, count)];
+        } else if (instr.op == Op::JumpIf || instr.op == Op::JumpIfNot) {
+            instr.arg2 = remap[std::min<std::size_t>(instr.arg2, count)];
+        }
+        compacted.push_back(std::move(instr));
+    }
+    code = std::move(compacted);
+
+    for (auto& [name, address] : output.entry_points_) {
+        address = remap[address];
+    }
+    for (auto& target : output.exec_targets_) {
+        target.address = remap[target.address];
+    }
 }
 
 // =============================================================================
@@ -478,52 +979,144 @@ CompiledGraphExecutor::CompiledGraphExecutor() = default;
 ExecutionResult CompiledGraphExecutor::execute(const CompiledGraph& graph,
                                                 const std::string& entry_point,
                                                 ExecutionContext& ctx) {
-    ExecutionResult result;
+    Run run = begin(graph, entry_point, ctx);
+    continue_run(run);
+
+    ExecutionResult result = run.result;
+    if (run.state == ExecutionState::Suspended) {
+        suspended_.push_back(std::move(run));
+    }
+    return result;
+}
+
+ExecutionId CompiledGraphExecutor::start(const CompiledGraph& graph,
+                                          const std::string& entry_point,
+                                          ExecutionContext& ctx) {
+    Run run = begin(graph, entry_point, ctx);
+    continue_run(run);
+
+    ExecutionId id = run.id;
+    if (run.state == ExecutionState::Suspended) {
+        suspended_.push_back(std::move(run));
+    }
+    return id;
+}
+
+void CompiledGraphExecutor::update(float delta_time) {
+    finished_.clear();
+
+    for (Run& run : suspended_) {
+        ExecutionContext& ctx = *run.ctx;
+        ctx.delta_time = delta_time;
+        ctx.total_time += delta_time;
+        ++ctx.frame_count;
+
+        // Suspended runs stop on the Execute of their latent node
+        const CompiledInstruction& instr = run.graph->instructions()[run.ip];
+        INode* node = run.graph->node(instr.arg1);
+
+        PinId next = node->resume(ctx);
+        if (!next.is_valid() && node->state() == NodeState::Suspended) {
+            continue;
+        }
+
+        if (node->state() != NodeState::Suspended) {
+            node->set_state(NodeState::Completed);
+        }
+        run.state = ExecutionState::Running;
+        dispatch(instr, next, run);
+        continue_run(run);
+    }
+
+    auto done = std::stable_partition(suspended_.begin(), suspended_.end(), [](const Run& run) {
+        return run.state == ExecutionState::Suspended;
+    });
+    finished_.insert(finished_.end(), std::make_move_iterator(done), std::make_move_iterator(suspended_.end()));
+    suspended_.erase(done, suspended_.end());
+}
+
+void CompiledGraphExecutor::abort(ExecutionId id) {
+    std::erase_if(suspended_, [id](const Run& run) { return run.id == id; });
+}
+
+void CompiledGraphExecutor::abort_all(const CompiledGraph& graph) {
+    std::erase_if(suspended_, [&graph](const Run& run) { return run.graph == &graph; });
+}
+
+bool CompiledGraphExecutor::is_running(ExecutionId id) const {
+    return std::any_of(suspended_.begin(), suspended_.end(),
+                       [id](const Run& run) { return run.id == id; });
+}
+
+const ExecutionResult* CompiledGraphExecutor::get_result(ExecutionId id) const {
+    for (const auto* runs : {&suspended_, &finished_}) {
+        for (const Run& run : *runs) {
+            if (run.id == id) return &run.result;
+        }
+    }
+    return nullptr;
+}
+
+CompiledGraphExecutor::Run CompiledGraphExecutor::begin(const CompiledGraph& graph,
+                                                        const std::string& entry_point,
+                                                        ExecutionContext& ctx) {
+    Run run;
+    run.id = GraphExecutor::allocate_execution_id();
+    run.graph = &graph;
+    run.ctx = &ctx;
+    run.started_at = std::chrono::steady_clock::now();
 
     auto entry = graph.get_entry_point(entry_point);
     if (!entry) {
-        result.final_state = ExecutionState::Error;
-        result.error_message = "Entry point not found: " + entry_point;
-        return result;
+        run.state = ExecutionState::Error;
+        run.result.final_state = ExecutionState::Error;
+        run.result.error_message = "Entry point not found: " + entry_point;
+        return run;
     }
 
-    std::size_t ip = *entry;
-    registers_.resize(graph.register_count());
+    run.ip = *entry;
+    run.registers.resize(graph.register_count());
+    ctx.id = run.id;
+    return run;
+}
 
-    auto start_time = std::chrono::steady_clock::now();
+void CompiledGraphExecutor::continue_run(Run& run) {
+    if (run.state != ExecutionState::Running) return;
 
-    while (ip < graph.instructions().size()) {
-        if (!execute_instruction(graph.instructions()[ip], ctx, ip)) {
+    std::span<const CompiledInstruction> code = run.graph->instructions();
+    while (run.ip < code.size()) {
+        if (!execute_instruction(code[run.ip], run)) {
             break;
         }
     }
 
-    auto end_time = std::chrono::steady_clock::now();
-    result.execution_time_ms = std::chrono::duration<float, std::milli>(
-        end_time - start_time).count();
+    if (run.state == ExecutionState::Running) {
+        run.state = ExecutionState::Completed;
+    }
+    run.result.final_state = run.state;
 
-    result.final_state = ExecutionState::Completed;
-    return result;
+    auto end_time = std::chrono::steady_clock::now();
+    run.result.execution_time_ms = std::chrono::duration<float, std::milli>(
+        end_time - run.started_at).count();
 }
 
-void CompiledGraphExecutor::update(float delta_time) {
-    auto it = latent_actions_.begin();
-    while (it != latent_actions_.end()) {
-        it->remaining_time -= delta_time;
-        if (it->remaining_time <= 0.0f) {
-            if (it->on_complete) {
-                it->on_complete();
-            }
-            it = latent_actions_.erase(it);
-        } else {
-            ++it;
-        }
+bool CompiledGraphExecutor::dispatch(const CompiledInstruction& instr, PinId next, Run& run) {
+    if (const CompiledExecTarget* target = find_exec_target(*run.graph, instr, next)) {
+        run.ctx->current_exec_pin = target->input;
+        run.ip = target->address;
+        return true;
     }
+
+    // Returned pin is unwired or no pin at all: the flow ends here
+    run.ip = run.graph->instructions().size();
+    return false;
 }
 
-bool CompiledGraphExecutor::execute_instruction(const CompiledInstruction& instr,
-                                                  [[maybe_unused]] ExecutionContext& ctx,
-                                                  std::size_t& ip) {
+bool CompiledGraphExecutor::execute_instruction(const CompiledInstruction& instr, Run& run) {
+    ExecutionContext& ctx = *run.ctx;
+    std::vector<PinValue>& registers = run.registers;
+    std::size_t& ip = run.ip;
+
     switch (instr.op) {
         case CompiledInstruction::OpCode::Nop:
             ++ip;
@@ -534,8 +1127,8 @@ bool CompiledGraphExecutor::execute_instruction(const CompiledInstruction& instr
             break;
 
         case CompiledInstruction::OpCode::JumpIf:
-            if (std::holds_alternative<bool>(registers_[instr.arg1]) &&
-                std::get<bool>(registers_[instr.arg1])) {
+            if (std::holds_alternative<bool>(registers[instr.arg1]) &&
+                std::get<bool>(registers[instr.arg1])) {
                 ip = instr.arg2;
             } else {
                 ++ip;
@@ -543,8 +1136,8 @@ bool CompiledGraphExecutor::execute_instruction(const CompiledInstruction& instr
             break;
 
         case CompiledInstruction::OpCode::JumpIfNot:
-            if (std::holds_alternative<bool>(registers_[instr.arg1]) &&
-                !std::get<bool>(registers_[instr.arg1])) {
+            if (std::holds_alternative<bool>(registers[instr.arg1]) &&
+                !std::get<bool>(registers[instr.arg1])) {
                 ip = instr.arg2;
             } else {
                 ++ip;
@@ -554,93 +1147,65 @@ bool CompiledGraphExecutor::execute_instruction(const CompiledInstruction& instr
         case CompiledInstruction::OpCode::Return:
             return false;
 
-        case CompiledInstruction::OpCode::LoadConst:
-            registers_[instr.arg1] = instr.immediate;
-            ++ip;
-            break;
+        case CompiledInstruction::OpCode::Execute: {
+            INode* node = run.graph->node(instr.arg1);
+            if (++run.result.nodes_executed > k_max_iterations) {
+                run.state = ExecutionState::Error;
+                run.result.error_message = "Max iterations exceeded";
+                run.result.error_node = node->id();
+                return false;
+            }
 
-        case CompiledInstruction::OpCode::Copy:
-            registers_[instr.arg1] = registers_[instr.arg2];
-            ++ip;
-            break;
+            ctx.current_node = node->id();
+            node->set_state(NodeState::Executing);
+            PinId next = node->execute(ctx);
 
-        case CompiledInstruction::OpCode::Add:
-            if (std::holds_alternative<float>(registers_[instr.arg2]) &&
-                std::holds_alternative<float>(registers_[instr.arg3])) {
-                registers_[instr.arg1] = std::get<float>(registers_[instr.arg2]) +
-                                          std::get<float>(registers_[instr.arg3]);
+            if (node->state() == NodeState::Suspended) {
+                if (!next.is_valid()) {
+                    // Latent node: resumed from update()
+                    run.state = ExecutionState::Suspended;
+                    return false;
+                }
+            } else {
+                node->set_state(NodeState::Completed);
             }
+            return dispatch(instr, next, run);
+        }
+
+        case CompiledInstruction::OpCode::ExecutePure:
+            run.graph->node(instr.arg1)->execute(ctx);
             ++ip;
             break;
 
-        case CompiledInstruction::OpCode::Sub:
-            if (std::holds_alternative<float>(registers_[instr.arg2]) &&
-                std::holds_alternative<float>(registers_[instr.arg3])) {
-                registers_[instr.arg1] = std::get<float>(registers_[instr.arg2]) -
-                                          std::get<float>(registers_[instr.arg3]);
-            }
+        case CompiledInstruction::OpCode::LoadConst:
+            registers[instr.arg1] = instr.immediate;
             ++ip;
             break;
 
-        case CompiledInstruction::OpCode::Mul:
-            if (std::holds_alternative<float>(registers_[instr.arg2]) &&
-                std::holds_alternative<float>(registers_[instr.arg3])) {
-                registers_[instr.arg1] = std::get<float>(registers_[instr.arg2]) *
-                                          std::get<float>(registers_[instr.arg3]);
-            }
+        case CompiledInstruction::OpCode::LoadPin: {
+            auto it = ctx.pin_values.find(run.graph->pin(instr.arg2));
+            registers[instr.arg1] = it != ctx.pin_values.end() ? it->second : PinValue{};
             ++ip;
             break;
+        }
 
-        case CompiledInstruction::OpCode::Div:
-            if (std::holds_alternative<float>(registers_[instr.arg2]) &&
-                std::holds_alternative<float>(registers_[instr.arg3])) {
-                float divisor = std::get<float>(registers_[instr.arg3]);
-                if (divisor != 0.0f) {
-                    registers_[instr.arg1] = std::get<float>(registers_[instr.arg2]) / divisor;
-                }
-            }
+        case CompiledInstruction::OpCode::StorePin:
+            store_pin(ctx, run.graph->pin(instr.arg1), registers[instr.arg2]);
             ++ip;
             break;
 
-        case CompiledInstruction::OpCode::Eq: {
-            // Handle equality comparison by checking types first
-            // std::any is not comparable, so we need type-specific comparison
-            const auto& lhs = registers_[instr.arg2];
-            const auto& rhs = registers_[instr.arg3];
-            bool result = false;
-
-            if (lhs.index() == rhs.index()) {
-                // Same type index - compare based on type
-                if (std::holds_alternative<bool>(lhs)) {
-                    result = std::get<bool>(lhs) == std::get<bool>(rhs);
-                } else if (std::holds_alternative<std::int32_t>(lhs)) {
-                    result = std::get<std::int32_t>(lhs) == std::get<std::int32_t>(rhs);
-                } else if (std::holds_alternative<std::int64_t>(lhs)) {
-                    result = std::get<std::int64_t>(lhs) == std::get<std::int64_t>(rhs);
-                } else if (std::holds_alternative<float>(lhs)) {
-                    result = std::get<float>(lhs) == std::get<float>(rhs);
-                } else if (std::holds_alternative<double>(lhs)) {
-                    result = std::get<double>(lhs) == std::get<double>(rhs);
-                } else if (std::holds_alternative<std::string>(lhs)) {
-                    result = std::get<std::string>(lhs) == std::get<std::string>(rhs);
-                } else if (std::holds_alternative<std::uint64_t>(lhs)) {
-                    result = std::get<std::uint64_t>(lhs) == std::get<std::uint64_t>(rhs);
-                } else if (std::holds_alternative<std::monostate>(lhs)) {
-                    result = true;  // Both are monostate
-                }
-                // For arrays, vectors, and std::any - we can't easily compare, treat as not equal
-            }
-            registers_[instr.arg1] = result;
+        case CompiledInstruction::OpCode::Copy:
+            registers[instr.arg1] = registers[instr.arg2];
             ++ip;
             break;
-        }
 
+        case CompiledInstruction::OpCode::Add:
+        case CompiledInstruction::OpCode::Sub:
+        case CompiledInstruction::OpCode::Mul:
+        case CompiledInstruction::OpCode::Div:
+        case CompiledInstruction::OpCode::Eq:
         case CompiledInstruction::OpCode::Lt:
-            if (std::holds_alternative<float>(registers_[instr.arg2]) &&
-                std::holds_alternative<float>(registers_[instr.arg3])) {
-                registers_[instr.arg1] = std::get<float>(registers_[instr.arg2]) <
-                                          std::get<float>(registers_[instr.arg3]);
-            }
+            apply_register_op(instr.op, registers[instr.arg1], registers[instr.arg2], registers[instr.arg3]);
             ++ip;
             break;
 
@@ -662,4 +1227,289 @@ bool CompiledGraphExecutor::execute_instruction(const CompiledInstruction& instr
     return true;
 }
 
+// =============================================================================
+// BatchedGraphExecutor Implementation
+// =============================================================================
+
+BatchedGraphExecutor::BatchedGraphExecutor() = default;
+
+std::vector<ExecutionId> BatchedGraphExecutor::start(const CompiledGraph& graph,
+                                                     const std::string& entry_point,
+                                                     std::span<ExecutionContext* const> contexts) {
+    auto entry = graph.get_entry_point(entry_point);
+    const std::size_t lanes = contexts.size();
+
+    Batch batch;
+    batch.graph = &graph;
+    batch.lane_count = lanes;
+    batch.contexts.assign(contexts.begin(), contexts.end());
+    batch.ips.assign(lanes, entry.value_or(graph.instructions().size()));
+    batch.states.assign(lanes, entry ? ExecutionState::Running : ExecutionState::Error);
+    batch.nodes_executed.assign(lanes, 0);
+    batch.registers.resize(graph.register_count() * lanes);
+
+    batch.ids.reserve(lanes);
+    for (ExecutionContext* ctx : contexts) {
+        batch.ids.push_back(GraphExecutor::allocate_execution_id());
+        ctx->id = batch.ids.back();
+    }
+
+    ++stats_.batches;
+    stats_.lanes += lanes;
+
+    run(batch);
+
+    std::vector<ExecutionId> ids = batch.ids;
+    if (has_suspended(batch)) {
+        batches_.push_back(std::move(batch));
+    }
+    return ids;
+}
+
+void BatchedGraphExecutor::update(float delta_time) {
+    for (Batch& batch : batches_) {
+        bool resumed = false;
+
+        for (std::uint32_t lane = 0; lane < batch.lane_count; ++lane) {
+            if (batch.states[lane] != ExecutionState::Suspended) continue;
+
+            ExecutionContext& ctx = *batch.contexts[lane];
+            ctx.delta_time = delta_time;
+            ctx.total_time += delta_time;
+            ++ctx.frame_count;
+
+            // Suspended lanes stop on the Execute of their latent node
+            const CompiledInstruction& instr = batch.graph->instructions()[batch.ips[lane]];
+            INode* node = batch.graph->node(instr.arg1);
+
+            PinId next = node->resume(ctx);
+            if (!next.is_valid() && node->state() == NodeState::Suspended) {
+                continue;
+            }
+
+            if (node->state() != NodeState::Suspended) {
+                node->set_state(NodeState::Completed);
+            }
+            batch.states[lane] = ExecutionState::Running;
+            dispatch(batch, lane, instr, next);
+            resumed = true;
+        }
+
+        if (resumed) {
+            run(batch);
+        }
+    }
+
+    std::erase_if(batches_, [](const Batch& batch) { return !has_suspended(batch); });
+}
+
+void BatchedGraphExecutor::abort(ExecutionId id) {
+    if (!suspended_.erase(id)) return;
+
+    for (Batch& batch : batches_) {
+        for (std::size_t lane = 0; lane < batch.lane_count; ++lane) {
+            if (batch.ids[lane] == id) {
+                batch.states[lane] = ExecutionState::Aborted;
+            }
+        }
+    }
+    std::erase_if(batches_, [](const Batch& batch) { return !has_suspended(batch); });
+}
+
+void BatchedGraphExecutor::abort_all(const CompiledGraph& graph) {
+    std::erase_if(batches_, [&](const Batch& batch) {
+        if (batch.graph != &graph) return false;
+        for (ExecutionId id : batch.ids) {
+            suspended_.erase(id);
+        }
+        return true;
+    });
+}
+
+bool BatchedGraphExecutor::is_running(ExecutionId id) const {
+    return suspended_.count(id) != 0;
+}
+
+void BatchedGraphExecutor::run(Batch& batch) {
+    std::span<const CompiledInstruction> code = batch.graph->instructions();
+
+    while (true) {
+        // Lowest address first, so lanes that diverged meet again where
+        // their flow joins
+        std::size_t pc = code.size();
+        for (std::uint32_t lane = 0; lane < batch.lane_count; ++lane) {
+            if (batch.states[lane] == ExecutionState::Running) {
+                pc = std::min(pc, batch.ips[lane]);
+            }
+        }
+        if (pc >= code.size()) break;
+
+        mask_.clear();
+        for (std::uint32_t lane = 0; lane < batch.lane_count; ++lane) {
+            if (batch.states[lane] == ExecutionState::Running && batch.ips[lane] == pc) {
+                mask_.push_back(lane);
+            }
+        }
+
+        execute_instruction(batch, code[pc], mask_);
+        ++stats_.instructions_issued;
+        stats_.lane_instructions += mask_.size();
+    }
+
+    for (std::uint32_t lane = 0; lane < batch.lane_count; ++lane) {
+        if (batch.states[lane] == ExecutionState::Running) {
+            batch.states[lane] = ExecutionState::Completed;
+        }
+        if (batch.states[lane] == ExecutionState::Suspended) {
+            suspended_.insert(batch.ids[lane]);
+        } else {
+            suspended_.erase(batch.ids[lane]);
+        }
+    }
+}
+
+void BatchedGraphExecutor::execute_instruction(Batch& batch, const CompiledInstruction& instr,
+                                               std::span<const std::uint32_t> mask) {
+    using Op = CompiledInstruction::OpCode;
+
+    const std::size_t lanes = batch.lane_count;
+    auto reg = [&](std::uint32_t r) { return batch.registers.data() + static_cast<std::size_t>(r) * lanes; };
+    auto advance = [&] {
+        for (std::uint32_t lane : mask) ++batch.ips[lane];
+    };
+
+    switch (instr.op) {
+        case Op::Execute: {
+            INode* node = batch.graph->node(instr.arg1);
+            for (std::uint32_t lane : mask) {
+                if (++batch.nodes_executed[lane] > k_max_iterations) {
+                    batch.states[lane] = ExecutionState::Error;
+                    continue;
+                }
+
+                ExecutionContext& ctx = *batch.contexts[lane];
+                ctx.current_node = node->id();
+                node->set_state(NodeState::Executing);
+                PinId next = node->execute(ctx);
+
+                if (node->state() == NodeState::Suspended) {
+                    if (!next.is_valid()) {
+                        batch.states[lane] = ExecutionState::Suspended;
+                        continue;
+                    }
+                } else {
+                    node->set_state(NodeState::Completed);
+                }
+                dispatch(batch, lane, instr, next);
+            }
+            break;
+        }
+
+        case Op::ExecutePure: {
+            INode* node = batch.graph->node(instr.arg1);
+            for (std::uint32_t lane : mask) {
+                node->execute(*batch.contexts[lane]);
+            }
+            advance();
+            break;
+        }
+
+        case Op::LoadConst: {
+            PinValue* dst = reg(instr.arg1);
+            for (std::uint32_t lane : mask) {
+                dst[lane] = instr.immediate;
+            }
+            advance();
+            break;
+        }
+
+        case Op::LoadPin: {
+            PinValue* dst = reg(instr.arg1);
+            const PinId pin = batch.graph->pin(instr.arg2);
+            for (std::uint32_t lane : mask) {
+                const auto& values = batch.contexts[lane]->pin_values;
+                auto it = values.find(pin);
+                dst[lane] = it != values.end() ? it->second : PinValue{};
+            }
+            advance();
+            break;
+        }
+
+        case Op::StorePin: {
+            const PinValue* src = reg(instr.arg2);
+            const PinId pin = batch.graph->pin(instr.arg1);
+            for (std::uint32_t lane : mask) {
+                store_pin(*batch.contexts[lane], pin, src[lane]);
+            }
+            advance();
+            break;
+        }
+
+        case Op::Copy: {
+            PinValue* dst = reg(instr.arg1);
+            const PinValue* src = reg(instr.arg2);
+            for (std::uint32_t lane : mask) {
+                dst[lane] = src[lane];
+            }
+            advance();
+            break;
+        }
+
+        case Op::Add:
+        case Op::Sub:
+        case Op::Mul:
+        case Op::Div:
+        case Op::Eq:
+        case Op::Lt: {
+            PinValue* dst = reg(instr.arg1);
+            const PinValue* lhs = reg(instr.arg2);
+            const PinValue* rhs = reg(instr.arg3);
+            for (std::uint32_t lane : mask) {
+                apply_register_op(instr.op, dst[lane], lhs[lane], rhs[lane]);
+            }
+            advance();
+            break;
+        }
+
+        case Op::Jump:
+            for (std::uint32_t lane : mask) batch.ips[lane] = instr.arg1;
+            break;
+
+        case Op::JumpIf:
+        case Op::JumpIfNot: {
+            const PinValue* cond = reg(instr.arg1);
+            const bool jump_on = instr.op == Op::JumpIf;
+            for (std::uint32_t lane : mask) {
+                const bool taken = std::holds_alternative<bool>(cond[lane]) &&
+                                   std::get<bool>(cond[lane]) == jump_on;
+                batch.ips[lane] = taken ? instr.arg2 : batch.ips[lane] + 1;
+            }
+            break;
+        }
+
+        case Op::Return:
+        case Op::Suspend:
+            for (std::uint32_t lane : mask) batch.states[lane] = ExecutionState::Completed;
+            break;
+
+        default:
+            advance();
+            break;
+    }
+}
+
+void BatchedGraphExecutor::dispatch(Batch& batch, std::uint32_t lane,
+                                    const CompiledInstruction& instr, PinId next) {
+    if (const CompiledExecTarget* target = find_exec_target(*batch.graph, instr, next)) {
+        batch.contexts[lane]->current_exec_pin = target->input;
+        batch.ips[lane] = target->address;
+    } else {
+        batch.ips[lane] = batch.graph->instructions().size();
+    }
+}
+
+bool BatchedGraphExecutor::has_suspended(const Batch& batch) {
+    return std::find(batch.states.begin(), batch.states.end(), ExecutionState::Suspended) != batch.states.end();
+}
+
 } // namespace void_graph
@@ -9,6 +9,7 @@
 #include <deque>
 #include <memory>
 #include <queue>
+#include <unordered_set>
 #include <vector>
 
 namespace void_graph {
@@ -150,6 +151,9 @@ public:
     /// @brief Clear all breakpoints
     void clear_breakpoints();
 
+    /// @brief Check if execution of a graph can stop at a breakpoint
+    [[nodiscard]] bool has_breakpoints(GraphId graph) const;
+
     /// @brief Step to next node (while paused at breakpoint)
     void step_into(ExecutionId id);
 
@@ -190,6 +194,9 @@ public:
                                  std::function<bool()> completion_predicate,
                                  std::function<void()> on_complete = nullptr);
 
+    /// @brief Allocate an execution ID, unique across interpreted and compiled runs
+    [[nodiscard]] static ExecutionId allocate_execution_id();
+
 private:
     /// @brief Internal execution data
     struct ExecutionData {
@@ -207,6 +214,9 @@ private:
     /// @brief Execute a single node
     PinId execute_node(ExecutionData& data, INode& node);
 
+    /// @brief Get the value of a data input, evaluating pure sources
+    PinValue pull_input(ExecutionData& data, const Pin& input_pin, std::size_t depth);
+
     /// @brief Handle latent actions
     void update_latent_actions(float delta_time);
 
@@ -233,6 +243,15 @@ private:
 // =============================================================================
 
 /// @brief A compiled instruction for the VM
+///
+/// Operands by opcode:
+/// - Execute: arg1 node slot, arg2 first exec target, arg3 exec target count
+/// - ExecutePure: arg1 node slot
+/// - LoadConst: arg1 register, value in immediate
+/// - LoadPin: arg1 register, arg2 pin slot
+/// - StorePin: arg1 pin slot, arg2 register
+/// - Jump: arg1 address; JumpIf/JumpIfNot: arg1 register, arg2 address
+/// - Copy and math: arg1 destination, arg2/arg3 source registers
 struct CompiledInstruction {
     enum class OpCode : std::uint8_t {
         // Flow control
@@ -244,7 +263,7 @@ struct CompiledInstruction {
         Return,         ///< Return from subgraph
 
         // Node execution
-        Execute,        ///< Execute node
+        Execute,        ///< Execute node and dispatch on the returned exec pin
         ExecutePure,    ///< Execute pure node (cacheable)
 
         // Value operations
@@ -290,6 +309,13 @@ struct CompiledInstruction {
     PinValue immediate;
 };
 
+/// @brief Resolved successor of an Execute instruction
+struct CompiledExecTarget {
+    PinId output;               ///< Exec output returned by the node
+    PinId input;                ///< Exec input it is wired to
+    std::uint32_t address = 0;  ///< First instruction of the target node
+};
+
 // =============================================================================
 // Compiled Graph
 // =============================================================================
@@ -316,6 +342,18 @@ public:
     /// @brief Get source graph ID
     [[nodiscard]] GraphId source_graph() const { return source_graph_; }
 
+    /// @brief Revision of the source graph this was compiled from
+    [[nodiscard]] std::uint64_t source_revision() const { return source_revision_; }
+
+    /// @brief Get the node in a slot
+    [[nodiscard]] INode* node(std::size_t slot) const { return nodes_[slot]; }
+
+    /// @brief Get the pin in a slot
+    [[nodiscard]] PinId pin(std::size_t slot) const { return pins_[slot]; }
+
+    /// @brief Get the exec targets of all Execute instructions
+    [[nodiscard]] std::span<const CompiledExecTarget> exec_targets() const { return exec_targets_; }
+
     /// @brief Validation info
     [[nodiscard]] bool is_valid() const { return is_valid_; }
     [[nodiscard]] const std::string& validation_error() const { return validation_error_; }
@@ -324,9 +362,14 @@ private:
     friend class GraphCompiler;
 
     GraphId source_graph_;
+    std::uint64_t source_revision_ = 0;
     std::vector<CompiledInstruction> instructions_;
     std::unordered_map<std::string, std::size_t> entry_points_;
     std::vector<PinValue> constants_;
+    std::vector<INode*> nodes_;                     ///< Node slots
+    std::vector<PinId> pins_;                       ///< Pin slots
+    std::vector<std::uint32_t> pin_owners_;         ///< Node slot owning each pin slot
+    std::vector<CompiledExecTarget> exec_targets_;
     std::size_t register_count_ = 0;
     bool is_valid_ = true;
     std::string validation_error_;
@@ -337,6 +380,12 @@ private:
 // =============================================================================
 
 /// @brief Compiles graphs to bytecode for faster execution
+///
+/// Exec flow is followed from each event and every reachable impure node is
+/// compiled once: its data inputs are gathered into registers and stored to
+/// its input pins, then an Execute instruction dispatches on the exec pin
+/// the node returns through a table of resolved jump targets. Pure nodes
+/// are evaluated on demand before the node that consumes them.
 class GraphCompiler {
 public:
     /// @brief Compilation options
@@ -371,12 +420,26 @@ public:
     [[nodiscard]] const Options& options() const { return options_; }
 
 private:
-    /// @brief Compile a node
+    /// @brief Compile a node: input gathering followed by Execute
     void compile_node(const Graph& graph, INode& node, CompiledGraph& output);
 
     /// @brief Compile flow from an event
     void compile_event(const Graph& graph, EventNode& event, CompiledGraph& output);
 
+    /// @brief Emit the value of a data input pin of node into the pin
+    void compile_input(const Graph& graph, INode& node, const Pin& pin, CompiledGraph& output,
+                       std::unordered_set<NodeId>& evaluated);
+
+    /// @brief Emit evaluation of a pure node and its inputs
+    void compile_pure(const Graph& graph, INode& node, CompiledGraph& output,
+                      std::unordered_set<NodeId>& evaluated);
+
+    /// @brief Get or assign the slot of a node
+    std::uint32_t node_slot(INode& node, CompiledGraph& output);
+
+    /// @brief Get or assign the slot of a pin owned by node
+    std::uint32_t pin_slot(PinId pin, INode& owner, CompiledGraph& output);
+
     /// @brief Allocate a register
     std::uint32_t allocate_register();
 
@@ -392,11 +455,19 @@ private:
     /// @brief Dead code elimination pass
     void eliminate_dead_code(CompiledGraph& output);
 
+    /// @brief Check whether a pure node may be evaluated at compile time
+    [[nodiscard]] static bool is_foldable(const INode& node);
+
     Options options_;
     std::vector<std::string> errors_;
     std::vector<std::string> warnings_;
     std::uint32_t next_register_ = 0;
     std::unordered_map<NodeId, std::size_t> node_addresses_;
+    std::unordered_map<NodeId, std::uint32_t> node_slots_;
+    std::unordered_map<PinId, std::uint32_t> pin_slots_;
+    std::unordered_map<PinId, std::uint32_t> pin_registers_;
+    std::vector<std::pair<std::size_t, NodeId>> pending_targets_;  ///< Exec target -> node
+    std::deque<INode*> pending_nodes_;
 };
 
 // =============================================================================
@@ -404,30 +475,149 @@ private:
 // =============================================================================
 
 /// @brief Fast executor for compiled graphs
+///
+/// Runs that reach a suspended latent node are kept and resumed from
+/// update(), like the interpreter does.
 class CompiledGraphExecutor {
 public:
     CompiledGraphExecutor();
 
     /// @brief Execute a compiled graph from an entry point
+    ///
+    /// Runs until the flow ends or a latent node suspends it; a suspended run
+    /// continues on update() and ctx must outlive it.
     ExecutionResult execute(const CompiledGraph& graph,
                             const std::string& entry_point,
                             ExecutionContext& ctx);
 
-    /// @brief Update latent actions
+    /// @brief Start a run and return its ID
+    ExecutionId start(const CompiledGraph& graph,
+                      const std::string& entry_point,
+                      ExecutionContext& ctx);
+
+    /// @brief Resume suspended runs
     void update(float delta_time);
 
+    /// @brief Abort a suspended run
+    void abort(ExecutionId id);
+
+    /// @brief Abort all suspended runs of a compiled graph
+    void abort_all(const CompiledGraph& graph);
+
+    /// @brief Check if a run is still suspended
+    [[nodiscard]] bool is_running(ExecutionId id) const;
+
+    /// @brief Get the result of a suspended run or one finished by the last update()
+    [[nodiscard]] const ExecutionResult* get_result(ExecutionId id) const;
+
     /// @brief Set debug enabled
     void set_debug_enabled(bool enabled) { debug_enabled_ = enabled; }
 
 private:
+    struct Run {
+        ExecutionId id;
+        const CompiledGraph* graph = nullptr;
+        ExecutionContext* ctx = nullptr;
+        std::vector<PinValue> registers;
+        std::size_t ip = 0;
+        ExecutionState state = ExecutionState::Running;
+        ExecutionResult result;
+        std::chrono::steady_clock::time_point started_at;
+    };
+
+    /// @brief Create a run positioned at an entry point
+    Run begin(const CompiledGraph& graph, const std::string& entry_point, ExecutionContext& ctx);
+
+    /// @brief Execute instructions until the run ends or suspends
+    void continue_run(Run& run);
+
     /// @brief Execute instruction
-    bool execute_instruction(const CompiledInstruction& instr,
-                             ExecutionContext& ctx,
-                             std::size_t& ip);
+    bool execute_instruction(const CompiledInstruction& instr, Run& run);
 
-    std::vector<PinValue> registers_;
-    std::deque<LatentAction> latent_actions_;
+    /// @brief Continue at the target of the exec pin a node returned
+    bool dispatch(const CompiledInstruction& instr, PinId next, Run& run);
+
+    std::vector<Run> suspended_;
+    std::vector<Run> finished_;         ///< Runs completed by the last update()
     bool debug_enabled_ = false;
 };
 
+// =============================================================================
+// Batched Graph Executor
+// =============================================================================
+
+/// @brief Runs one compiled graph over many instances in lock step
+///
+/// Each instance is a lane with its own context and instruction pointer.
+/// Registers are stored register-major, so a register's values for all
+/// lanes are contiguous. Every step picks the lowest instruction pointer
+/// among running lanes and executes that instruction once for the mask of
+/// lanes sitting on it; lanes that branch elsewhere wait until the lowest
+/// address reaches them, which reconverges flow that joins again. Lanes
+/// suspended on latent nodes drop out of the mask until update() resumes
+/// them.
+class BatchedGraphExecutor {
+public:
+    struct Stats {
+        std::size_t batches = 0;
+        std::size_t lanes = 0;
+        std::size_t instructions_issued = 0;    ///< Instructions executed for a mask
+        std::size_t lane_instructions = 0;      ///< Sum of mask sizes
+    };
+
+    BatchedGraphExecutor();
+
+    /// @brief Run an entry point for every context
+    ///
+    /// Contexts of lanes that suspend must outlive them.
+    /// @return Execution ID of each lane, in context order
+    std::vector<ExecutionId> start(const CompiledGraph& graph,
+                                   const std::string& entry_point,
+                                   std::span<ExecutionContext* const> contexts);
+
+    /// @brief Resume suspended lanes
+    void update(float delta_time);
+
+    /// @brief Abort a suspended lane
+    void abort(ExecutionId id);
+
+    /// @brief Abort all suspended lanes of a compiled graph
+    void abort_all(const CompiledGraph& graph);
+
+    /// @brief Check if a lane is still suspended
+    [[nodiscard]] bool is_running(ExecutionId id) const;
+
+    /// @brief Get statistics
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+
+private:
+    struct Batch {
+        const CompiledGraph* graph = nullptr;
+        std::size_t lane_count = 0;
+        std::vector<ExecutionContext*> contexts;
+        std::vector<ExecutionId> ids;
+        std::vector<std::size_t> ips;
+        std::vector<ExecutionState> states;
+        std::vector<std::size_t> nodes_executed;
+        std::vector<PinValue> registers;        ///< [register * lane_count + lane]
+    };
+
+    /// @brief Execute until every lane has finished or suspended
+    void run(Batch& batch);
+
+    /// @brief Execute one instruction for the lanes in the mask
+    void execute_instruction(Batch& batch, const CompiledInstruction& instr,
+                             std::span<const std::uint32_t> mask);
+
+    /// @brief Continue a lane at the target of the exec pin its node returned
+    static void dispatch(Batch& batch, std::uint32_t lane, const CompiledInstruction& instr, PinId next);
+
+    [[nodiscard]] static bool has_suspended(const Batch& batch);
+
+    std::vector<Batch> batches_;
+    std::unordered_set<ExecutionId> suspended_;     ///< Lanes waiting in batches_
+    std::vector<std::uint32_t> mask_;
+    Stats stats_;
+};
+
 } // namespace void_graph
@@ -26,6 +26,7 @@ INode* Graph::add_node(std::unique_ptr<INode> node) {
 
     node_index_[id] = nodes_.size();
     nodes_.push_back(std::move(node));
+    ++revision_;
 
     if (on_node_added_) {
         on_node_added_(ptr);
@@ -72,6 +73,7 @@ bool Graph::remove_node(NodeId id) {
     }
     nodes_.pop_back();
     node_index_.erase(id);
+    ++revision_;
 
     return true;
 }
@@ -176,6 +178,7 @@ GraphResult<ConnectionId> Graph::connect(PinId source, PinId target) {
     // Track pin connections
     pin_connections_[source].push_back(conn.id);
     pin_connections_[target].push_back(conn.id);
+    ++revision_;
 
     if (on_connection_added_) {
         on_connection_added_(conn);
@@ -209,6 +212,7 @@ bool Graph::disconnect(ConnectionId id) {
     }
     connections_.pop_back();
     connection_index_.erase(id);
+    ++revision_;
 
     return true;
 }
@@ -505,6 +509,7 @@ void Graph::clear() {
     variable_index_.clear();
     interface_inputs_.clear();
     interface_outputs_.clear();
+    ++revision_;
 }
 
 GraphResult<void> Graph::validate() const {
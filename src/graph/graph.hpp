@@ -36,6 +36,9 @@ public:
     [[nodiscard]] GraphType type() const { return type_; }
     void set_type(GraphType type) { type_ = type; }
 
+    /// @brief Counter bumped by every node or connection change
+    [[nodiscard]] std::uint64_t revision() const { return revision_; }
+
     // Metadata
     [[nodiscard]] GraphMetadata& metadata() { return metadata_; }
     [[nodiscard]] const GraphMetadata& metadata() const { return metadata_; }
@@ -225,6 +228,7 @@ private:
     std::string name_;
     GraphType type_ = GraphType::Event;
     GraphMetadata metadata_;
+    std::uint64_t revision_ = 0;
 
     std::vector<std::unique_ptr<INode>> nodes_;
     std::unordered_map<NodeId, std::size_t> node_index_;
@@ -47,7 +47,12 @@ void GraphSystem::shutdown() {
     if (!initialized_) return;
 
     // Clear all data
+    for (const auto& [id, compiled] : compiled_graphs_) {
+        compiled_executor_.abort_all(*compiled);
+        batched_executor_.abort_all(*compiled);
+    }
     compiled_graphs_.clear();
+    async_instances_.clear();
     entity_components_.clear();
     graph_paths_.clear();
     graph_timestamps_.clear();
@@ -93,7 +98,7 @@ Graph* GraphSystem::get_graph(GraphId id) {
 
 bool GraphSystem::delete_graph(GraphId id) {
     // Remove compiled version
-    compiled_graphs_.erase(id);
+    invalidate_compiled(id);
 
     // Remove path tracking
     graph_paths_.erase(id);
@@ -126,7 +131,7 @@ void GraphSystem::detach_graph(std::uint64_t entity_id) {
 
     // Abort any active executions
     for (ExecutionId exec_id : it->second.active_executions) {
-        executor_.abort(exec_id);
+        abort_execution(exec_id);
     }
 
     entity_components_.erase(it);
@@ -149,7 +154,12 @@ ExecutionId GraphSystem::trigger_event(std::uint64_t entity_id, const std::strin
         return ExecutionId{};
     }
 
-    ExecutionId id = executor_.start(*comp->instance, *it->second);
+    ExecutionId id;
+    if (CompiledGraph* compiled = runtime_graph(comp->graph_id, event_name)) {
+        id = compiled_executor_.start(*compiled, event_name, comp->instance->context());
+    } else {
+        id = executor_.start(*comp->instance, *it->second);
+    }
     comp->active_executions.push_back(id);
 
     // Emit event
@@ -171,23 +181,73 @@ void GraphSystem::update(float delta_time) {
     }
 
     // Tick all entities with auto_tick
+    tick_entities();
+
+    // Update executors
+    executor_.update(delta_time);
+    compiled_executor_.update(delta_time);
+    batched_executor_.update(delta_time);
+
+    // Clean up completed executions
+    auto finished = [this](ExecutionId id) {
+        return !executor_.is_running(id) && !compiled_executor_.is_running(id) &&
+               !batched_executor_.is_running(id);
+    };
     for (auto& [entity_id, comp] : entity_components_) {
-        if (comp.enabled && comp.auto_tick) {
+        std::erase_if(comp.active_executions, finished);
+    }
+    std::erase_if(async_instances_, [&finished](const auto& pair) {
+        return finished(pair.first);
+    });
+}
+
+void GraphSystem::tick_entities() {
+    // Entities running the same compiled graph tick as one batch
+    std::unordered_map<CompiledGraph*, std::vector<std::uint64_t>> batches;
+
+    for (auto& [entity_id, comp] : entity_components_) {
+        if (!comp.enabled || !comp.auto_tick) continue;
+
+        CompiledGraph* compiled = comp.instance && comp.event_bindings.count("Tick")
+            ? runtime_graph(comp.graph_id, "Tick")
+            : nullptr;
+        if (compiled) {
+            batches[compiled].push_back(entity_id);
+        } else {
             trigger_event(entity_id, "Tick");
         }
     }
 
-    // Update executor
-    executor_.update(delta_time);
+    std::vector<ExecutionContext*> contexts;
+    for (auto& [compiled, entities] : batches) {
+        contexts.clear();
+        for (std::uint64_t entity_id : entities) {
+            contexts.push_back(&entity_components_[entity_id].instance->context());
+        }
 
-    // Clean up completed executions
-    for (auto& [entity_id, comp] : entity_components_) {
-        std::erase_if(comp.active_executions, [this](ExecutionId id) {
-            return !executor_.is_running(id);
-        });
+        std::vector<ExecutionId> ids = batched_executor_.start(*compiled, "Tick", contexts);
+
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            GraphComponent& comp = entity_components_[entities[i]];
+            comp.active_executions.push_back(ids[i]);
+
+            if (event_bus_) {
+                GraphExecutionStartedEvent event;
+                event.graph_id = comp.graph_id;
+                event.execution_id = ids[i];
+                event.entity_id = entities[i];
+                event_bus_->publish(event);
+            }
+        }
     }
 }
 
+void GraphSystem::abort_execution(ExecutionId id) {
+    executor_.abort(id);
+    compiled_executor_.abort(id);
+    batched_executor_.abort(id);
+}
+
 ExecutionResult GraphSystem::execute_sync(GraphId graph_id, const std::string& entry_point) {
     Graph* graph = library_.get_graph(graph_id);
     if (!graph) {
@@ -197,19 +257,23 @@ ExecutionResult GraphSystem::execute_sync(GraphId graph_id, const std::string& e
         return result;
     }
 
-    // Try compiled execution first
-    CompiledGraph* compiled = compile_graph(graph_id);
-    if (compiled && compiled->is_valid()) {
-        ExecutionContext ctx;
-        ctx.graph = graph_id;
-        CompiledGraphExecutor compiled_executor;
-        return compiled_executor.execute(*compiled, entry_point, ctx);
+    GraphInstance instance(*graph);
+
+    if (CompiledGraph* compiled = runtime_graph(graph_id, entry_point)) {
+        ExecutionResult result = compiled_executor_.execute(*compiled, entry_point, instance.context());
+        ExecutionId id = instance.context().id;
+
+        // Wait for latent nodes
+        while (compiled_executor_.is_running(id)) {
+            compiled_executor_.update(0.016f);  // ~60 FPS
+            if (const ExecutionResult* latest = compiled_executor_.get_result(id)) {
+                result = *latest;
+            }
+        }
+        return result;
     }
 
     // Fall back to interpreter
-    GraphInstance instance(*graph);
-
-    // Find entry event
     for (EventNode* event : graph->get_event_nodes()) {
         if (event->event_name() == entry_point) {
             ExecutionId id = executor_.start(instance, *event);
@@ -238,28 +302,41 @@ ExecutionId GraphSystem::execute_async(GraphId graph_id, const std::string& entr
         return ExecutionId{};
     }
 
-    // Create temporary instance
+    // The instance lives until the execution finishes
     auto instance = std::make_unique<GraphInstance>(*graph);
-
-    // Find entry event
-    for (EventNode* event : graph->get_event_nodes()) {
-        if (event->event_name() == entry_point) {
-            return executor_.start(*instance, *event);
+    ExecutionId id;
+
+    if (CompiledGraph* compiled = runtime_graph(graph_id, entry_point)) {
+        id = compiled_executor_.start(*compiled, entry_point, instance->context());
+    } else {
+        // Find entry event
+        for (EventNode* event : graph->get_event_nodes()) {
+            if (event->event_name() == entry_point) {
+                id = executor_.start(*instance, *event);
+                break;
+            }
         }
     }
 
-    return ExecutionId{};
+    if (id.is_valid()) {
+        async_instances_[id] = std::move(instance);
+    }
+    return id;
 }
 
 CompiledGraph* GraphSystem::compile_graph(GraphId id) {
+    Graph* graph = library_.get_graph(id);
+    if (!graph) return nullptr;
+
     auto it = compiled_graphs_.find(id);
     if (it != compiled_graphs_.end()) {
-        return it->second.get();
+        if (it->second->source_revision() == graph->revision()) {
+            return it->second.get();
+        }
+        // Edited since it was compiled
+        invalidate_compiled(id);
     }
 
-    Graph* graph = library_.get_graph(id);
-    if (!graph) return nullptr;
-
     auto result = compiler_.compile(*graph);
     if (!result) return nullptr;
 
@@ -270,9 +347,31 @@ CompiledGraph* GraphSystem::compile_graph(GraphId id) {
     return ptr;
 }
 
+CompiledGraph* GraphSystem::runtime_graph(GraphId id, const std::string& entry_point) {
+    if (executor_.has_breakpoints(id)) {
+        return nullptr;
+    }
+
+    CompiledGraph* compiled = compile_graph(id);
+    if (!compiled || !compiled->is_valid() || !compiled->get_entry_point(entry_point)) {
+        return nullptr;
+    }
+    return compiled;
+}
+
+void GraphSystem::invalidate_compiled(GraphId id) {
+    auto it = compiled_graphs_.find(id);
+    if (it == compiled_graphs_.end()) return;
+
+    compiled_executor_.abort_all(*it->second);
+    batched_executor_.abort_all(*it->second);
+    compiled_graphs_.erase(it);
+}
+
 void GraphSystem::set_debug_mode(bool enabled) {
     debug_mode_ = enabled;
     executor_.set_debug_enabled(enabled);
+    compiled_executor_.set_debug_enabled(enabled);
 }
 
 void GraphSystem::toggle_breakpoint(GraphId graph, NodeId node) {
@@ -309,7 +408,7 @@ bool GraphSystem::hot_reload(GraphId id) {
     if (path_it == graph_paths_.end()) return false;
 
     // Remove old graph
-    compiled_graphs_.erase(id);
+    invalidate_compiled(id);
 
     // Reload
     Graph* graph = load_graph(path_it->second);
@@ -318,6 +417,11 @@ bool GraphSystem::hot_reload(GraphId id) {
     // Re-attach to entities using this graph
     for (auto& [entity_id, comp] : entity_components_) {
         if (comp.graph_id == id) {
+            // Running executions point at the old instance
+            for (ExecutionId exec_id : comp.active_executions) {
+                abort_execution(exec_id);
+            }
+            comp.active_executions.clear();
             comp.instance = std::make_unique<GraphInstance>(*graph, entity_id);
 
             // Rebuild event bindings
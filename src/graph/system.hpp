@@ -109,6 +109,14 @@ public:
     [[nodiscard]] GraphCompiler& compiler() { return compiler_; }
     [[nodiscard]] const GraphCompiler& compiler() const { return compiler_; }
 
+    /// @brief Get the executor for compiled graphs
+    [[nodiscard]] CompiledGraphExecutor& compiled_executor() { return compiled_executor_; }
+    [[nodiscard]] const CompiledGraphExecutor& compiled_executor() const { return compiled_executor_; }
+
+    /// @brief Get the executor that ticks entities sharing a graph together
+    [[nodiscard]] BatchedGraphExecutor& batched_executor() { return batched_executor_; }
+    [[nodiscard]] const BatchedGraphExecutor& batched_executor() const { return batched_executor_; }
+
     // ==========================================================================
     // Graph Management
     // ==========================================================================
@@ -161,6 +169,8 @@ public:
     ExecutionId execute_async(GraphId graph_id, const std::string& entry_point);
 
     /// @brief Compile a graph for faster execution
+    ///
+    /// The result is cached and recompiled once the graph is edited.
     [[nodiscard]] CompiledGraph* compile_graph(GraphId id);
 
     // ==========================================================================
@@ -236,12 +246,29 @@ public:
     [[nodiscard]] Stats stats() const;
 
 private:
+    /// @brief Compiled form to run a graph with, or null to interpret it
+    ///
+    /// Graphs are interpreted only while a breakpoint is set on them.
+    [[nodiscard]] CompiledGraph* runtime_graph(GraphId id, const std::string& entry_point);
+
+    /// @brief Drop the compiled form of a graph and abort its runs
+    void invalidate_compiled(GraphId id);
+
+    /// @brief Trigger Tick on all auto-ticking entities, batching shared graphs
+    void tick_entities();
+
+    /// @brief Abort an execution on whichever executor runs it
+    void abort_execution(ExecutionId id);
+
     NodeRegistry registry_;
     GraphLibrary library_;
     GraphExecutor executor_;
     GraphCompiler compiler_;
+    CompiledGraphExecutor compiled_executor_;
+    BatchedGraphExecutor batched_executor_;
 
     std::unordered_map<GraphId, std::unique_ptr<CompiledGraph>> compiled_graphs_;
+    std::unordered_map<ExecutionId, std::unique_ptr<GraphInstance>> async_instances_;
     std::unordered_map<std::uint64_t, GraphComponent> entity_components_;
 
     void_event::EventBus* event_bus_ = nullptr;
@@ -4,6 +4,7 @@
 #include <void_engine/ir/bus.hpp>
 #include <void_engine/ir/snapshot.hpp>
 #include <void_engine/core/hot_reload.hpp>
+#include <algorithm>
 #include <cstring>
 
 namespace void_ir {
@@ -272,7 +273,8 @@ public:
             return void_core::Err("Failed to deserialize AsyncPatchBus state");
         }
 
-        m_bus = std::make_shared<AsyncPatchBus>();
+        m_bus = std::make_shared<AsyncPatchBus>(
+            std::max(AsyncPatchBus::k_default_capacity, state->pending_events.size()));
 
         for (auto& event : state->pending_events) {
             m_bus->publish(std::move(event.patch), event.namespace_id, event.transaction_id);
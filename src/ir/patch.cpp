@@ -43,18 +43,18 @@ EntityPatch deserialize_entity_patch(BinaryReader& reader) {
 
 void serialize_component_patch(BinaryWriter& writer, const ComponentPatch& patch) {
     serialize_entity_ref(writer, patch.entity);
-    writer.write_string(patch.component_type);
+    writer.write_string(patch.component_type.str());
     writer.write_u8(static_cast<std::uint8_t>(patch.operation));
-    writer.write_string(patch.field_path);
+    writer.write_string(patch.field_path.str());
     serialize_value(writer, patch.value);
 }
 
 ComponentPatch deserialize_component_patch(BinaryReader& reader) {
     ComponentPatch patch;
     patch.entity = deserialize_entity_ref(reader);
-    patch.component_type = reader.read_string();
+    patch.component_type = Symbol(reader.read_string());
     patch.operation = static_cast<ComponentOp>(reader.read_u8());
-    patch.field_path = reader.read_string();
+    patch.field_path = Symbol(reader.read_string());
     patch.value = deserialize_value(reader);
     return patch;
 }
@@ -81,8 +81,8 @@ LayerPatch deserialize_layer_patch(BinaryReader& reader) {
 
 void serialize_asset_patch(BinaryWriter& writer, const AssetPatch& patch) {
     serialize_entity_ref(writer, patch.entity);
-    writer.write_string(patch.component_type);
-    writer.write_string(patch.field_path);
+    writer.write_string(patch.component_type.str());
+    writer.write_string(patch.field_path.str());
     writer.write_u8(static_cast<std::uint8_t>(patch.operation));
     writer.write_string(patch.asset.path);
     writer.write_u64(patch.asset.uuid);
@@ -91,8 +91,8 @@ void serialize_asset_patch(BinaryWriter& writer, const AssetPatch& patch) {
 AssetPatch deserialize_asset_patch(BinaryReader& reader) {
     AssetPatch patch;
     patch.entity = deserialize_entity_ref(reader);
-    patch.component_type = reader.read_string();
-    patch.field_path = reader.read_string();
+    patch.component_type = Symbol(reader.read_string());
+    patch.field_path = Symbol(reader.read_string());
     patch.operation = static_cast<AssetOp>(reader.read_u8());
     patch.asset.path = reader.read_string();
     patch.asset.uuid = reader.read_u64();
@@ -0,0 +1,720 @@
+/// @file snapshot.cpp
+/// @brief Compact SnapshotDelta encoding for void_ir
+
+#include <void_engine/ir/snapshot.hpp>
+
+#include <array>
+#include <cstring>
+
+namespace void_ir {
+
+namespace {
+    constexpr std::uint32_t DELTA_MAGIC = 0x53444C54;  // "SDLT"
+    constexpr std::uint32_t DELTA_VERSION = 1;
+
+    // Change record flags (low two bits hold the change type)
+    constexpr std::uint8_t FLAG_HAS_OLD = 1 << 2;
+    constexpr std::uint8_t FLAG_HAS_NEW = 1 << 3;
+    constexpr std::uint8_t FLAG_OLD_IN_BASELINE = 1 << 4;
+    constexpr std::uint8_t FLAG_NEW_IS_DIFF = 1 << 5;
+
+    /// Value diff tags
+    enum class DiffTag : std::uint8_t {
+        Same = 0,
+        Full,
+        Int,      // zigzag difference
+        Float,    // XOR of bit patterns
+        Lanes,    // changed-lane mask, then XOR of each changed float
+        Object,   // changed keys with nested diffs, then removed keys
+        Array     // changed indices with nested diffs (same length only)
+    };
+
+    using Lanes = std::array<std::uint32_t, 16>;
+
+    /// Get float lane count of a vector or matrix type (0 otherwise)
+    std::size_t lane_count(ValueType type) {
+        switch (type) {
+            case ValueType::Vec2: return 2;
+            case ValueType::Vec3: return 3;
+            case ValueType::Vec4: return 4;
+            case ValueType::Mat4: return 16;
+            default: return 0;
+        }
+    }
+
+    std::uint32_t float_bits(float f) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+    float bits_float(std::uint32_t bits) {
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    std::uint64_t double_bits(double d) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        return bits;
+    }
+
+    double bits_double(std::uint64_t bits) {
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        return d;
+    }
+
+    Lanes load_lanes(const Value& value) {
+        Lanes lanes{};
+        switch (value.type()) {
+            case ValueType::Vec2: {
+                const auto& v = value.as_vec2();
+                lanes[0] = float_bits(v.x);
+                lanes[1] = float_bits(v.y);
+                break;
+            }
+            case ValueType::Vec3: {
+                const auto& v = value.as_vec3();
+                lanes[0] = float_bits(v.x);
+                lanes[1] = float_bits(v.y);
+                lanes[2] = float_bits(v.z);
+                break;
+            }
+            case ValueType::Vec4: {
+                const auto& v = value.as_vec4();
+                lanes[0] = float_bits(v.x);
+                lanes[1] = float_bits(v.y);
+                lanes[2] = float_bits(v.z);
+                lanes[3] = float_bits(v.w);
+                break;
+            }
+            case ValueType::Mat4: {
+                const auto& m = value.as_mat4();
+                for (std::size_t i = 0; i < 16; ++i) {
+                    lanes[i] = float_bits(m.data[i]);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        return lanes;
+    }
+
+    Value store_lanes(ValueType type, const Lanes& lanes) {
+        switch (type) {
+            case ValueType::Vec2:
+                return Value(Vec2{bits_float(lanes[0]), bits_float(lanes[1])});
+            case ValueType::Vec3:
+                return Value(Vec3{bits_float(lanes[0]), bits_float(lanes[1]), bits_float(lanes[2])});
+            case ValueType::Vec4:
+                return Value(Vec4{bits_float(lanes[0]), bits_float(lanes[1]),
+                                  bits_float(lanes[2]), bits_float(lanes[3])});
+            case ValueType::Mat4: {
+                Mat4 m;
+                for (std::size_t i = 0; i < 16; ++i) {
+                    m.data[i] = bits_float(lanes[i]);
+                }
+                return Value(m);
+            }
+            default:
+                return Value::null();
+        }
+    }
+
+    bool same_entity(const EntitySnapshot& a, const EntitySnapshot& b) {
+        return a.name == b.name && a.enabled == b.enabled && a.components == b.components;
+    }
+
+    // -------------------------------------------------------------------------
+    // DeltaEncoder
+    // -------------------------------------------------------------------------
+
+    /// Writes delta records, interning symbols and entity ids per stream
+    class DeltaEncoder {
+    public:
+        explicit DeltaEncoder(BinaryWriter& writer) : m_writer(writer) {}
+
+        /// Write symbol: 0 + text on first use, otherwise index + 1
+        void symbol(Symbol s) {
+            auto [it, inserted] = m_symbols.try_emplace(s, static_cast<std::uint32_t>(m_symbols.size()));
+            if (inserted) {
+                m_writer.write_varint(0);
+                m_writer.write_compact_string(s.view());
+            } else {
+                m_writer.write_varint(it->second + 1);
+            }
+        }
+
+        /// Write entity: namespace + 1, then id relative to the previous one
+        void entity(EntityRef ref) {
+            m_writer.write_varint(ref.namespace_id.value + 1);
+            m_writer.write_zigzag(static_cast<std::int64_t>(ref.entity_id - m_last_entity));
+            m_last_entity = ref.entity_id;
+        }
+
+        void value(const Value& v) {
+            m_writer.write_u8(static_cast<std::uint8_t>(v.type()));
+
+            switch (v.type()) {
+                case ValueType::Null:
+                    break;
+                case ValueType::Bool:
+                    m_writer.write_bool(v.as_bool());
+                    break;
+                case ValueType::Int:
+                    m_writer.write_zigzag(v.as_int());
+                    break;
+                case ValueType::Float:
+                    m_writer.write_f64(v.as_float());
+                    break;
+                case ValueType::String:
+                    m_writer.write_compact_string(v.as_string());
+                    break;
+                case ValueType::Vec2:
+                case ValueType::Vec3:
+                case ValueType::Vec4:
+                case ValueType::Mat4: {
+                    Lanes lanes = load_lanes(v);
+                    for (std::size_t i = 0; i < lane_count(v.type()); ++i) {
+                        m_writer.write_u32(lanes[i]);
+                    }
+                    break;
+                }
+                case ValueType::Array: {
+                    const auto& arr = v.as_array();
+                    m_writer.write_varint(arr.size());
+                    for (const auto& elem : arr) {
+                        value(elem);
+                    }
+                    break;
+                }
+                case ValueType::Object: {
+                    const auto& obj = v.as_object();
+                    m_writer.write_varint(obj.size());
+                    for (const auto& [key, val] : obj) {
+                        symbol(key);
+                        value(val);
+                    }
+                    break;
+                }
+                case ValueType::Bytes:
+                    m_writer.write_compact_bytes(v.as_bytes());
+                    break;
+                case ValueType::EntityRef: {
+                    const auto& ref = v.as_entity_ref();
+                    m_writer.write_varint(ref.namespace_id + 1);
+                    m_writer.write_varint(ref.entity_id);
+                    break;
+                }
+                case ValueType::AssetRef: {
+                    const auto& ref = v.as_asset_ref();
+                    m_writer.write_compact_string(ref.path);
+                    m_writer.write_varint(ref.uuid);
+                    break;
+                }
+            }
+        }
+
+        /// Write value as a diff against base
+        void diff(const Value& base, const Value& v) {
+            if (base.type() != v.type()) {
+                full(v);
+                return;
+            }
+            if (base == v) {
+                m_writer.write_u8(static_cast<std::uint8_t>(DiffTag::Same));
+                return;
+            }
+
+            switch (v.type()) {
+                case ValueType::Int:
+                    m_writer.write_u8(static_cast<std::uint8_t>(DiffTag::Int));
+                    m_writer.write_zigzag(static_cast<std::int64_t>(
+                        static_cast<std::uint64_t>(v.as_int()) - static_cast<std::uint64_t>(base.as_int())));
+                    break;
+                case ValueType::Float:
+                    m_writer.write_u8(static_cast<std::uint8_t>(DiffTag::Float));
+                    m_writer.write_varint(double_bits(v.as_float()) ^ double_bits(base.as_float()));
+                    break;
+                case ValueType::Vec2:
+                case ValueType::Vec3:
+                case ValueType::Vec4:
+                case ValueType::Mat4: {
+                    Lanes old_lanes = load_lanes(base);
+                    Lanes new_lanes = load_lanes(v);
+                    std::size_t count = lane_count(v.type());
+                    std::uint32_t mask = 0;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        if (old_lanes[i] != new_lanes[i]) {
+                            mask |= 1u << i;
+                        }
+                    }
+                    m_writer.write_u8(static_cast<std::uint8_t>(DiffTag::Lanes));
+                    m_writer.write_varint(mask);
+                    for (std::size_t i = 0; i < count; ++i) {
+                        if (mask & (1u << i)) {
+                            m_writer.write_varint(old_lanes[i] ^ new_lanes[i]);
+                        }
+                    }
+                    break;
+                }
+                case ValueType::Object: {
+                    const auto& old_obj = base.as_object();
+                    const auto& new_obj = v.as_object();
+
+                    std::size_t changed = 0;
+                    std::size_t removed = 0;
+                    for (const auto& [key, val] : new_obj) {
+                        auto it = old_obj.find(key);
+                        if (it == old_obj.end() || it->second != val) {
+                            ++changed;
+                        }
+                    }
+                    for (const auto& [key, _] : old_obj) {
+                        if (new_obj.find(key) == new_obj.end()) {
+                            ++removed;
+                        }
+                    }
+
+                    m_writer.write_u8(static_cast<std::uint8_t>(DiffTag::Object));
+                    m_writer.write_varint(changed);
+                    for (const auto& [key, val] : new_obj) {
+                        auto it = old_obj.find(key);
+                        if (it == old_obj.end()) {
+                            symbol(key);
+                            full(val);
+                        } else if (it->second != val) {
+                            symbol(key);
+                            diff(it->second, val);
+                        }
+                    }
+                    m_writer.write_varint(removed);
+                    for (const auto& [key, _] : old_obj) {
+                        if (new_obj.find(key) == new_obj.end()) {
+                            symbol(key);
+                        }
+                    }
+                    break;
+                }
+                case ValueType::Array: {
+                    const auto& old_arr = base.as_array();
+                    const auto& new_arr = v.as_array();
+                    if (old_arr.size() != new_arr.size()) {
+                        full(v);
+                        break;
+                    }
+
+                    std::size_t changed = 0;
+                    for (std::size_t i = 0; i < new_arr.size(); ++i) {
+                        if (old_arr[i] != new_arr[i]) {
+                            ++changed;
+                        }
+                    }
+                    m_writer.write_u8(static_cast<std::uint8_t>(DiffTag::Array));
+                    m_writer.write_varint(changed);
+                    for (std::size_t i = 0; i < new_arr.size(); ++i) {
+                        if (old_arr[i] != new_arr[i]) {
+                            m_writer.write_varint(i);
+                            diff(old_arr[i], new_arr[i]);
+                        }
+                    }
+                    break;
+                }
+                default:
+                    full(v);
+                    break;
+            }
+        }
+
+        void entity_snapshot(const EntitySnapshot& e) {
+            m_writer.write_compact_string(e.name);
+            m_writer.write_bool(e.enabled);
+            m_writer.write_varint(e.components.size());
+            for (const auto& [type, val] : e.components) {
+                symbol(type);
+                value(val);
+            }
+        }
+
+    private:
+        void full(const Value& v) {
+            m_writer.write_u8(static_cast<std::uint8_t>(DiffTag::Full));
+            value(v);
+        }
+
+        BinaryWriter& m_writer;
+        std::unordered_map<Symbol, std::uint32_t> m_symbols;
+        std::uint64_t m_last_entity = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // DeltaDecoder
+    // -------------------------------------------------------------------------
+
+    /// Reads records written by DeltaEncoder; any malformed input sets failed
+    class DeltaDecoder {
+    public:
+        explicit DeltaDecoder(BinaryReader& reader) : m_reader(reader) {}
+
+        [[nodiscard]] bool ok() const {
+            return !m_failed && m_reader.valid();
+        }
+
+        /// Read an element count, rejecting counts larger than the input
+        std::size_t count() {
+            std::uint64_t n = m_reader.read_varint();
+            if (n > m_reader.remaining()) {
+                m_failed = true;
+                return 0;
+            }
+            return n;
+        }
+
+        Symbol symbol() {
+            std::uint64_t ref = m_reader.read_varint();
+            if (ref == 0) {
+                Symbol s(m_reader.read_compact_string());
+                m_symbols.push_back(s);
+                return s;
+            }
+            if (ref > m_symbols.size()) {
+                m_failed = true;
+                return Symbol();
+            }
+            return m_symbols[ref - 1];
+        }
+
+        EntityRef entity() {
+            EntityRef ref;
+            ref.namespace_id = NamespaceId{static_cast<std::uint32_t>(m_reader.read_varint() - 1)};
+            m_last_entity += static_cast<std::uint64_t>(m_reader.read_zigzag());
+            ref.entity_id = m_last_entity;
+            return ref;
+        }
+
+        Value value(int depth = 0) {
+            if (depth > k_max_depth) {
+                m_failed = true;
+                return Value::null();
+            }
+
+            auto type = static_cast<ValueType>(m_reader.read_u8());
+            switch (type) {
+                case ValueType::Null:
+                    return Value::null();
+                case ValueType::Bool:
+                    return Value(m_reader.read_bool());
+                case ValueType::Int:
+                    return Value(m_reader.read_zigzag());
+                case ValueType::Float:
+                    return Value(m_reader.read_f64());
+                case ValueType::String:
+                    return Value(m_reader.read_compact_string());
+                case ValueType::Vec2:
+                case ValueType::Vec3:
+                case ValueType::Vec4:
+                case ValueType::Mat4: {
+                    Lanes lanes{};
+                    for (std::size_t i = 0; i < lane_count(type); ++i) {
+                        lanes[i] = m_reader.read_u32();
+                    }
+                    return store_lanes(type, lanes);
+                }
+                case ValueType::Array: {
+                    std::size_t n = count();
+                    ValueArray arr;
+                    arr.reserve(n);
+                    for (std::size_t i = 0; i < n && ok(); ++i) {
+                        arr.push_back(value(depth + 1));
+                    }
+                    return Value(std::move(arr));
+                }
+                case ValueType::Object: {
+                    std::size_t n = count();
+                    ValueObject obj;
+                    for (std::size_t i = 0; i < n && ok(); ++i) {
+                        Symbol key = symbol();
+                        obj[key] = value(depth + 1);
+                    }
+                    return Value(std::move(obj));
+                }
+                case ValueType::Bytes:
+                    return Value(m_reader.read_compact_bytes());
+                case ValueType::EntityRef: {
+                    ValueEntityRef ref;
+                    ref.namespace_id = static_cast<std::uint32_t>(m_reader.read_varint() - 1);
+                    ref.entity_id = m_reader.read_varint();
+                    return Value(ref);
+                }
+                case ValueType::AssetRef: {
+                    ValueAssetRef ref;
+                    ref.path = m_reader.read_compact_string();
+                    ref.uuid = m_reader.read_varint();
+                    return Value(std::move(ref));
+                }
+            }
+
+            m_failed = true;
+            return Value::null();
+        }
+
+        Value diff(const Value& base, int depth = 0) {
+            if (depth > k_max_depth) {
+                m_failed = true;
+                return Value::null();
+            }
+
+            auto tag = static_cast<DiffTag>(m_reader.read_u8());
+            switch (tag) {
+                case DiffTag::Same:
+                    return base.clone();
+                case DiffTag::Full:
+                    return value(depth + 1);
+                case DiffTag::Int:
+                    if (base.type() != ValueType::Int) {
+                        break;
+                    }
+                    return Value(static_cast<std::int64_t>(
+                        static_cast<std::uint64_t>(base.as_int()) +
+                        static_cast<std::uint64_t>(m_reader.read_zigzag())));
+                case DiffTag::Float:
+                    if (base.type() != ValueType::Float) {
+                        break;
+                    }
+                    return Value(bits_double(double_bits(base.as_float()) ^ m_reader.read_varint()));
+                case DiffTag::Lanes: {
+                    std::size_t n = lane_count(base.type());
+                    if (n == 0) {
+                        break;
+                    }
+                    Lanes lanes = load_lanes(base);
+                    std::uint64_t mask = m_reader.read_varint();
+                    for (std::size_t i = 0; i < n; ++i) {
+                        if (mask & (1ull << i)) {
+                            lanes[i] ^= static_cast<std::uint32_t>(m_reader.read_varint());
+                        }
+                    }
+                    return store_lanes(base.type(), lanes);
+                }
+                case DiffTag::Object: {
+                    if (base.type() != ValueType::Object) {
+                        break;
+                    }
+                    const auto& old_obj = base.as_object();
+                    ValueObject obj = old_obj;
+                    std::size_t changed = count();
+                    for (std::size_t i = 0; i < changed && ok(); ++i) {
+                        Symbol key = symbol();
+                        auto it = old_obj.find(key);
+                        obj[key] = it != old_obj.end() ? diff(it->second, depth + 1)
+                                                       : diff(Value::null(), depth + 1);
+                    }
+                    std::size_t removed = count();
+                    for (std::size_t i = 0; i < removed && ok(); ++i) {
+                        obj.erase(symbol());
+                    }
+                    return Value(std::move(obj));
+                }
+                case DiffTag::Array: {
+                    if (base.type() != ValueType::Array) {
+                        break;
+                    }
+                    ValueArray arr = base.as_array();
+                    std::size_t changed = count();
+                    for (std::size_t i = 0; i < changed && ok(); ++i) {
+                        std::uint64_t index = m_reader.read_varint();
+                        if (index >= arr.size()) {
+                            m_failed = true;
+                            break;
+                        }
+                        arr[index] = diff(arr[index], depth + 1);
+                    }
+                    return Value(std::move(arr));
+                }
+            }
+
+            m_failed = true;
+            return Value::null();
+        }
+
+        EntitySnapshot entity_snapshot(EntityRef ref) {
+            EntitySnapshot e;
+            e.entity = ref;
+            e.name = m_reader.read_compact_string();
+            e.enabled = m_reader.read_bool();
+            std::size_t n = count();
+            for (std::size_t i = 0; i < n && ok(); ++i) {
+                Symbol type = symbol();
+                e.components[type] = value();
+            }
+            return e;
+        }
+
+        void fail() {
+            m_failed = true;
+        }
+
+    private:
+        static constexpr int k_max_depth = 64;
+
+        BinaryReader& m_reader;
+        std::vector<Symbol> m_symbols;
+        std::uint64_t m_last_entity = 0;
+        bool m_failed = false;
+    };
+}
+
+void SnapshotDelta::encode(BinaryWriter& writer, const Snapshot* baseline) const {
+    writer.write_u32(DELTA_MAGIC);
+    writer.write_varint(DELTA_VERSION);
+    writer.write_varint(baseline ? baseline->id().value + 1 : 0);
+
+    DeltaEncoder enc(writer);
+
+    writer.write_varint(m_entity_changes.size());
+    for (const auto& change : m_entity_changes) {
+        const EntitySnapshot* base = baseline ? baseline->get_entity(change.entity) : nullptr;
+        bool old_in_baseline = change.old_state && base && same_entity(*change.old_state, *base);
+
+        std::uint8_t flags = static_cast<std::uint8_t>(change.type);
+        if (change.old_state) {
+            flags |= FLAG_HAS_OLD;
+        }
+        if (change.new_state) {
+            flags |= FLAG_HAS_NEW;
+        }
+        if (old_in_baseline) {
+            flags |= FLAG_OLD_IN_BASELINE;
+        }
+        writer.write_u8(flags);
+        enc.entity(change.entity);
+
+        if (change.old_state && !old_in_baseline) {
+            enc.entity_snapshot(*change.old_state);
+        }
+        if (change.new_state) {
+            enc.entity_snapshot(*change.new_state);
+        }
+    }
+
+    writer.write_varint(m_component_changes.size());
+    for (const auto& change : m_component_changes) {
+        const Value* base = nullptr;
+        if (baseline) {
+            if (const EntitySnapshot* e = baseline->get_entity(change.entity)) {
+                base = e->get_component(change.component_type);
+            }
+        }
+        bool old_in_baseline = change.old_value && base && *base == *change.old_value;
+        bool new_is_diff = change.old_value && change.new_value;
+
+        std::uint8_t flags = static_cast<std::uint8_t>(change.type);
+        if (change.old_value) {
+            flags |= FLAG_HAS_OLD;
+        }
+        if (change.new_value) {
+            flags |= FLAG_HAS_NEW;
+        }
+        if (old_in_baseline) {
+            flags |= FLAG_OLD_IN_BASELINE;
+        }
+        if (new_is_diff) {
+            flags |= FLAG_NEW_IS_DIFF;
+        }
+        writer.write_u8(flags);
+        enc.entity(change.entity);
+        enc.symbol(change.component_type);
+
+        if (change.old_value && !old_in_baseline) {
+            enc.value(*change.old_value);
+        }
+        if (new_is_diff) {
+            enc.diff(*change.old_value, *change.new_value);
+        } else if (change.new_value) {
+            enc.value(*change.new_value);
+        }
+    }
+}
+
+std::optional<SnapshotDelta> SnapshotDelta::decode(BinaryReader& reader, const Snapshot* baseline) {
+    if (reader.read_u32() != DELTA_MAGIC || reader.read_varint() != DELTA_VERSION) {
+        return std::nullopt;
+    }
+    std::uint64_t baseline_id = reader.read_varint();
+    if (baseline_id != 0 && (!baseline || baseline->id().value + 1 != baseline_id)) {
+        return std::nullopt;
+    }
+
+    DeltaDecoder dec(reader);
+    SnapshotDelta delta;
+
+    std::size_t entity_count = dec.count();
+    delta.m_entity_changes.reserve(entity_count);
+    for (std::size_t i = 0; i < entity_count && dec.ok(); ++i) {
+        std::uint8_t flags = reader.read_u8();
+        if ((flags & 3) > 2) {
+            return std::nullopt;
+        }
+        EntityChange change;
+        change.type = static_cast<EntityChange::Type>(flags & 3);
+        change.entity = dec.entity();
+
+        if (flags & FLAG_OLD_IN_BASELINE) {
+            const EntitySnapshot* base = baseline ? baseline->get_entity(change.entity) : nullptr;
+            if (!base) {
+                return std::nullopt;
+            }
+            change.old_state = base->clone();
+        } else if (flags & FLAG_HAS_OLD) {
+            change.old_state = dec.entity_snapshot(change.entity);
+        }
+        if (flags & FLAG_HAS_NEW) {
+            change.new_state = dec.entity_snapshot(change.entity);
+        }
+        delta.m_entity_changes.push_back(std::move(change));
+    }
+
+    std::size_t component_count = dec.count();
+    delta.m_component_changes.reserve(component_count);
+    for (std::size_t i = 0; i < component_count && dec.ok(); ++i) {
+        std::uint8_t flags = reader.read_u8();
+        if ((flags & 3) > 2) {
+            return std::nullopt;
+        }
+        ComponentChange change;
+        change.type = static_cast<ComponentChange::Type>(flags & 3);
+        change.entity = dec.entity();
+        change.component_type = dec.symbol();
+
+        if (flags & FLAG_OLD_IN_BASELINE) {
+            const EntitySnapshot* e = baseline ? baseline->get_entity(change.entity) : nullptr;
+            const Value* base = e ? e->get_component(change.component_type) : nullptr;
+            if (!base) {
+                return std::nullopt;
+            }
+            change.old_value = base->clone();
+        } else if (flags & FLAG_HAS_OLD) {
+            change.old_value = dec.value();
+        }
+
+        if (flags & FLAG_NEW_IS_DIFF) {
+            if (!change.old_value) {
+                return std::nullopt;
+            }
+            change.new_value = dec.diff(*change.old_value);
+        } else if (flags & FLAG_HAS_NEW) {
+            change.new_value = dec.value();
+        }
+        delta.m_component_changes.push_back(std::move(change));
+    }
+
+    if (!dec.ok()) {
+        return std::nullopt;
+    }
+    return delta;
+}
+
+} // namespace void_ir
@@ -0,0 +1,66 @@
+/// @file symbol.cpp
+/// @brief Symbol table implementation for void_ir
+
+#include <void_engine/ir/symbol.hpp>
+
+#include <mutex>
+#include <stdexcept>
+
+namespace void_ir {
+
+SymbolTable& SymbolTable::instance() {
+    // Never destroyed: symbols may be used from static destructors
+    static auto* table = new SymbolTable();
+    return *table;
+}
+
+SymbolTable::SymbolTable() {
+    m_chunks[0].store(new std::string[k_chunk_size], std::memory_order_release);
+    m_index.emplace(std::string_view(), 0);
+    m_count.store(1, std::memory_order_release);
+}
+
+std::uint32_t SymbolTable::intern(std::string_view text) {
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_index.find(text);
+        if (it != m_index.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(m_mutex);
+    auto it = m_index.find(text);
+    if (it != m_index.end()) {
+        return it->second;
+    }
+
+    std::uint32_t id = m_count.load(std::memory_order_relaxed);
+    std::uint32_t chunk = id >> k_chunk_bits;
+    if (chunk >= k_max_chunks) {
+        throw std::length_error("void_ir symbol table is full");
+    }
+
+    std::string* strings = m_chunks[chunk].load(std::memory_order_relaxed);
+    if (!strings) {
+        strings = new std::string[k_chunk_size];
+        m_chunks[chunk].store(strings, std::memory_order_release);
+    }
+
+    std::string& slot = strings[id & (k_chunk_size - 1)];
+    slot.assign(text);
+    m_index.emplace(std::string_view(slot), id);
+    m_count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+std::optional<std::uint32_t> SymbolTable::find(std::string_view text) const {
+    std::shared_lock lock(m_mutex);
+    auto it = m_index.find(text);
+    if (it == m_index.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+} // namespace void_ir
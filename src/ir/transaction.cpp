@@ -6,6 +6,9 @@
 #include <void_engine/ir/snapshot.hpp>
 #include <void_engine/core/hot_reload.hpp>
 
+#include <atomic>
+#include <thread>
+
 namespace void_ir {
 
 // Forward declarations from patch.cpp
@@ -203,7 +206,7 @@ void serialize_conflict(BinaryWriter& writer, const Conflict& conflict) {
 
     writer.write_bool(conflict.component_type.has_value());
     if (conflict.component_type) {
-        writer.write_string(*conflict.component_type);
+        writer.write_string(conflict.component_type->str());
     }
 
     writer.write_bool(conflict.layer.has_value());
@@ -232,7 +235,7 @@ Conflict deserialize_conflict(BinaryReader& reader) {
     }
 
     if (reader.read_bool()) {
-        conflict.component_type = reader.read_string();
+        conflict.component_type = Symbol(reader.read_string());
     }
 
     if (reader.read_bool()) {
@@ -584,6 +587,285 @@ TransactionResult apply_transaction(Transaction& tx, const std::function<bool(co
     return TransactionResult::ok(applied);
 }
 
+namespace {
+
+/// Run fn(0..count) across up to workers threads, including the caller
+void run_partitions(std::size_t count, std::size_t workers,
+                    const std::function<void(std::size_t)>& fn) {
+    workers = std::min(workers, count);
+    if (workers <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    auto work = [&] {
+        for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            fn(i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (std::size_t w = 1; w < workers; ++w) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+/// Check if a patch adds or removes storage other entities share
+///
+/// With concurrent_structural, creates and component adds and removes only
+/// touch their target entity; deletes still reach its layers and children.
+bool is_structural(const Patch& patch, bool concurrent_structural) {
+    if (const auto* ep = patch.try_as<EntityPatch>()) {
+        return ep->operation == EntityOp::Delete ||
+               (ep->operation == EntityOp::Create && !concurrent_structural);
+    }
+    if (const auto* cp = patch.try_as<ComponentPatch>()) {
+        return (cp->operation == ComponentOp::Add || cp->operation == ComponentOp::Remove) &&
+               !concurrent_structural;
+    }
+    if (const auto* lp = patch.try_as<LayerPatch>()) {
+        return lp->operation == LayerOp::Create || lp->operation == LayerOp::Delete;
+    }
+    return false;
+}
+
+} // namespace
+
+ApplyPlan TransactionApplier::plan(const PatchBatch& patches, const ParentLookup& parent_of,
+                                   bool concurrent_structural) {
+    ApplyPlan plan;
+
+    // Union-find over one set per patch of the current phase
+    std::vector<std::size_t> phase_patches;
+    std::vector<std::uint32_t> parent;
+    std::unordered_map<EntityRef, std::uint32_t> entity_sets;
+    std::unordered_map<std::uint32_t, std::uint32_t> layer_sets;
+
+    // Parents assigned by earlier hierarchy patches; invalid when cleared
+    std::unordered_map<EntityRef, EntityRef> reparented;
+
+    auto find = [&](std::uint32_t set) {
+        while (parent[set] != set) {
+            parent[set] = parent[parent[set]];
+            set = parent[set];
+        }
+        return set;
+    };
+
+    auto flush = [&] {
+        if (phase_patches.empty()) {
+            return;
+        }
+        ApplyPlan::Phase phase;
+        std::vector<std::uint32_t> slot(parent.size(), UINT32_MAX);
+        for (std::uint32_t k = 0; k < phase_patches.size(); ++k) {
+            std::uint32_t root = find(k);
+            if (slot[root] == UINT32_MAX) {
+                slot[root] = static_cast<std::uint32_t>(phase.partitions.size());
+                phase.partitions.emplace_back();
+            }
+            phase.partitions[slot[root]].push_back(phase_patches[k]);
+        }
+        plan.phases.push_back(std::move(phase));
+        phase_patches.clear();
+        parent.clear();
+        entity_sets.clear();
+        layer_sets.clear();
+    };
+
+    auto old_parent = [&](EntityRef entity) -> std::optional<EntityRef> {
+        auto it = reparented.find(entity);
+        if (it != reparented.end()) {
+            return it->second;
+        }
+        return parent_of(entity);
+    };
+
+    const auto& list = patches.patches();
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        const Patch& patch = list[i];
+
+        std::optional<EntityRef> entity = patch.target_entity();
+        if (entity && !entity->is_valid()) {
+            entity.reset();
+        }
+        const auto* layer = patch.try_as<LayerPatch>();
+        const auto* hp = patch.try_as<HierarchyPatch>();
+
+        bool serial = (!entity && !layer) || is_structural(patch, concurrent_structural) ||
+                      (hp && !parent_of);
+        if (serial) {
+            flush();
+            if (plan.phases.empty() || !plan.phases.back().serial) {
+                ApplyPlan::Phase phase;
+                phase.serial = true;
+                phase.partitions.emplace_back();
+                plan.phases.push_back(std::move(phase));
+            }
+            plan.phases.back().partitions[0].push_back(i);
+            if (hp && hp->operation == HierarchyOp::SetParent) {
+                reparented[hp->entity] = hp->parent;
+            } else if (hp && hp->operation == HierarchyOp::ClearParent) {
+                reparented[hp->entity] = EntityRef();
+            }
+            continue;
+        }
+
+        auto set = static_cast<std::uint32_t>(parent.size());
+        parent.push_back(set);
+        phase_patches.push_back(i);
+
+        auto touch = [&](auto& sets, const auto& key) {
+            auto [it, inserted] = sets.try_emplace(key, set);
+            if (!inserted) {
+                parent[find(it->second)] = find(set);
+            }
+        };
+
+        if (entity) {
+            touch(entity_sets, *entity);
+        }
+        if (layer) {
+            touch(layer_sets, layer->layer.value);
+        }
+        if (hp) {
+            // Every op edits the child list of the parent it leaves or reorders
+            std::optional<EntityRef> previous = old_parent(hp->entity);
+            if (previous && previous->is_valid()) {
+                touch(entity_sets, *previous);
+            }
+            if (hp->operation == HierarchyOp::SetParent) {
+                if (hp->parent.is_valid()) {
+                    touch(entity_sets, hp->parent);
+                }
+                reparented[hp->entity] = hp->parent;
+            } else if (hp->operation == HierarchyOp::ClearParent) {
+                reparented[hp->entity] = EntityRef();
+            }
+        }
+    }
+    flush();
+
+    return plan;
+}
+
+TransactionResult TransactionApplier::apply(Transaction& tx, const ApplyHandler& apply,
+                                            const UndoHandler& undo,
+                                            const ParentLookup& parent_of) const {
+    if (tx.state() != TransactionState::Pending) {
+        return TransactionResult::failed("Transaction not in Pending state");
+    }
+
+    tx.begin_apply();
+
+    const auto& patches = tx.patches().patches();
+    std::size_t workers = m_config.max_workers != 0
+        ? m_config.max_workers
+        : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    if (patches.size() < m_config.min_parallel_patches || workers <= 1) {
+        for (std::size_t i = 0; i < patches.size(); ++i) {
+            if (!apply(patches[i])) {
+                for (std::size_t j = i; j-- > 0;) {
+                    undo(patches[j]);
+                }
+                tx.rollback();
+                return TransactionResult::partial(i, 1, {i});
+            }
+        }
+        tx.commit();
+        return TransactionResult::ok(patches.size());
+    }
+
+    ApplyPlan plan = TransactionApplier::plan(tx.patches(), parent_of, m_config.concurrent_structural);
+
+    auto run = [&](std::size_t count, const std::function<void(std::size_t)>& fn) {
+        if (count > 1 && m_config.parallel_for) {
+            m_config.parallel_for(count, fn);
+        } else {
+            run_partitions(count, workers, fn);
+        }
+    };
+
+    // Per partition: number of patches applied, and index of the failed patch
+    std::vector<std::vector<std::size_t>> applied(plan.phases.size());
+    std::vector<std::vector<std::size_t>> failed_at(plan.phases.size());
+    std::atomic<bool> abort{false};
+
+    std::size_t phases_run = 0;
+    for (std::size_t p = 0; p < plan.phases.size() && !abort.load(); ++p) {
+        const auto& partitions = plan.phases[p].partitions;
+        applied[p].assign(partitions.size(), 0);
+        failed_at[p].assign(partitions.size(), SIZE_MAX);
+
+        // Largest partitions first so one long partition does not run last
+        std::vector<std::size_t> order(partitions.size());
+        for (std::size_t k = 0; k < order.size(); ++k) {
+            order[k] = k;
+        }
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            return partitions[a].size() > partitions[b].size();
+        });
+
+        run(order.size(), [&](std::size_t n) {
+            std::size_t k = order[n];
+            for (std::size_t index : partitions[k]) {
+                if (abort.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                if (!apply(patches[index])) {
+                    failed_at[p][k] = index;
+                    abort.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                ++applied[p][k];
+            }
+        });
+        ++phases_run;
+    }
+
+    std::size_t applied_count = 0;
+    for (std::size_t p = 0; p < phases_run; ++p) {
+        for (std::size_t count : applied[p]) {
+            applied_count += count;
+        }
+    }
+
+    if (!abort.load()) {
+        tx.commit();
+        return TransactionResult::ok(applied_count);
+    }
+
+    // Undo later phases first; partitions of a phase are independent
+    std::vector<std::size_t> failed_indices;
+    for (std::size_t p = phases_run; p-- > 0;) {
+        const auto& partitions = plan.phases[p].partitions;
+        run(partitions.size(), [&](std::size_t k) {
+            for (std::size_t j = applied[p][k]; j-- > 0;) {
+                undo(patches[partitions[k][j]]);
+            }
+        });
+        for (std::size_t index : failed_at[p]) {
+            if (index != SIZE_MAX) {
+                failed_indices.push_back(index);
+            }
+        }
+    }
+    std::sort(failed_indices.begin(), failed_indices.end());
+
+    tx.rollback();
+    std::size_t failed_count = failed_indices.size();
+    return TransactionResult::partial(applied_count, failed_count, std::move(failed_indices));
+}
+
 bool transaction_affects_entity(const Transaction& tx, EntityRef entity) {
     for (const auto& patch : tx.patches()) {
         auto target = patch.target_entity();
@@ -608,9 +890,9 @@ std::vector<EntityRef> collect_affected_entities(const Transaction& tx) {
     return entities;
 }
 
-std::vector<std::string> collect_affected_components(const Transaction& tx) {
-    std::vector<std::string> components;
-    std::unordered_set<std::string> seen;
+std::vector<Symbol> collect_affected_components(const Transaction& tx) {
+    std::vector<Symbol> components;
+    std::unordered_set<Symbol> seen;
 
     for (const auto& patch : tx.patches()) {
         if (const auto* cp = patch.try_as<ComponentPatch>()) {
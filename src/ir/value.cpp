@@ -85,7 +85,7 @@ std::size_t estimate_value_size(const Value& value) {
         case ValueType::Object:
             size += 4;
             for (const auto& [key, val] : value.as_object()) {
-                size += 4 + key.size();
+                size += 4 + key.str().size();
                 size += estimate_value_size(val);
             }
             break;
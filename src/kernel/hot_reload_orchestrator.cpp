@@ -17,7 +17,7 @@ namespace void_kernel {
 // =============================================================================
 
 HotReloadOrchestrator::HotReloadOrchestrator()
-    : m_file_watcher(std::make_unique<void_core::PollingFileWatcher>())
+    : m_file_watcher(void_core::create_file_watcher())
     , m_start_time(std::chrono::steady_clock::now()) {
 }
 
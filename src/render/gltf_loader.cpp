@@ -1,10 +1,11 @@
 /// @file gltf_loader.cpp
-/// @brief glTF 2.0 model loading using tinygltf - implements pimpl from header
+/// @brief glTF 2.0 model loading on the zero-copy asset reader - implements pimpl from header
 
 #include <void_engine/render/gltf_loader.hpp>
 #include <void_engine/render/mesh.hpp>
 #include <void_engine/render/material.hpp>
 #include <void_engine/render/texture.hpp>
+#include <void_engine/asset/loaders/gltf_reader.hpp>
 
 #include <spdlog/spdlog.h>
 
@@ -17,15 +18,9 @@
 #include <cmath>
 #include <algorithm>
 #include <fstream>
+#include <span>
 #include <stdexcept>
 
-// tinygltf configuration
-#define TINYGLTF_IMPLEMENTATION
-#define TINYGLTF_NO_STB_IMAGE        // We use our own stb_image
-#define TINYGLTF_NO_STB_IMAGE_WRITE
-#define TINYGLTF_NO_EXTERNAL_IMAGE
-#include <tiny_gltf.h>
-
 namespace void_render {
 
 // =============================================================================
@@ -83,52 +78,60 @@ public:
 
     std::optional<GltfScene> load(const std::string& path, const LoadOptions& options) {
         m_options = options;
+        m_last_error.clear();
         m_base_path = std::filesystem::path(path).parent_path().string();
 
-        tinygltf::Model model;
-        tinygltf::TinyGLTF loader;
-        std::string err, warn;
-
-        bool ret = false;
-        std::string ext = std::filesystem::path(path).extension().string();
-
-        if (ext == ".glb" || ext == ".GLB") {
-            ret = loader.LoadBinaryFromFile(&model, &err, &warn, path);
-        } else {
-            ret = loader.LoadASCIIFromFile(&model, &err, &warn, path);
+        // The file and any external buffers are mapped; accessors read
+        // straight from the mapping while vertices are built
+        auto file = void_asset::MappedFile::open(path);
+        if (!file) {
+            m_last_error = file.error().message();
+            spdlog::error("glTF error [{}]: {}", path, m_last_error);
+            return std::nullopt;
         }
 
-        if (!warn.empty()) {
-            spdlog::warn("glTF warning [{}]: {}", path, warn);
-        }
+        std::vector<void_asset::MappedFile> external_files;
+        auto resolver = [&](const std::string& uri) -> std::optional<std::span<const std::uint8_t>> {
+            auto mapped = void_asset::MappedFile::open((std::filesystem::path(m_base_path) / uri).string());
+            if (!mapped) {
+                return std::nullopt;
+            }
+            external_files.push_back(std::move(mapped).value());
+            return external_files.back().bytes();
+        };
 
-        if (!ret || !err.empty()) {
-            m_last_error = err.empty() ? "Failed to load glTF file" : err;
+        auto parsed = void_asset::GltfDocument::parse(file.value().bytes(), resolver);
+        if (!parsed) {
+            m_last_error = parsed.error().message();
             spdlog::error("glTF error [{}]: {}", path, m_last_error);
             return std::nullopt;
         }
+        const auto& doc = parsed.value();
 
         GltfScene scene;
         scene.source_path = path;
 
         // Load textures first
         if (options.load_textures) {
-            load_textures(model, scene);
+            load_textures(doc, scene);
         }
 
         // Load materials
-        load_materials(model, scene);
+        load_materials(doc, scene);
 
         // Load meshes
-        load_meshes(model, scene);
+        if (!load_meshes(doc, scene)) {
+            spdlog::error("glTF error [{}]: {}", path, m_last_error);
+            return std::nullopt;
+        }
 
         // Load nodes
-        load_nodes(model, scene);
+        load_nodes(doc, scene);
 
         // Load default scene
-        int scene_index = model.defaultScene >= 0 ? model.defaultScene : 0;
-        if (scene_index < static_cast<int>(model.scenes.size())) {
-            const auto& gltf_scene = model.scenes[scene_index];
+        int scene_index = doc.default_scene() >= 0 ? doc.default_scene() : 0;
+        if (scene_index < static_cast<int>(doc.scenes().size())) {
+            const auto& gltf_scene = doc.scenes()[scene_index];
             scene.name = gltf_scene.name;
             for (int node_idx : gltf_scene.nodes) {
                 scene.root_nodes.push_back(node_idx);
@@ -159,36 +162,28 @@ public:
     // Texture loading
     // -------------------------------------------------------------------------
 
-    void load_textures(const tinygltf::Model& model, GltfScene& scene) {
-        scene.textures.reserve(model.textures.size());
+    void load_textures(const void_asset::GltfDocument& doc, GltfScene& scene) {
+        scene.textures.reserve(doc.textures().size());
 
-        for (const auto& tex : model.textures) {
+        for (const auto& tex : doc.textures()) {
             GltfTexture gltf_tex;
             gltf_tex.name = tex.name;
 
-            if (tex.source >= 0 && tex.source < static_cast<int>(model.images.size())) {
-                const auto& image = model.images[tex.source];
-
+            // Pixels are decoded by the texture pipeline, only the source is recorded
+            if (tex.source >= 0 && tex.source < static_cast<int>(doc.images().size())) {
+                const auto& image = doc.images()[tex.source];
                 if (!image.uri.empty()) {
                     gltf_tex.uri = image.uri;
                 }
-
-                // Copy image data
-                if (!image.image.empty()) {
-                    gltf_tex.data.width = image.width;
-                    gltf_tex.data.height = image.height;
-                    gltf_tex.data.channels = image.component;
-                    gltf_tex.data.pixels = image.image;
-                }
             }
 
             // Sampler settings
-            if (tex.sampler >= 0 && tex.sampler < static_cast<int>(model.samplers.size())) {
-                const auto& sampler = model.samplers[tex.sampler];
-                gltf_tex.min_filter = sampler.minFilter;
-                gltf_tex.mag_filter = sampler.magFilter;
-                gltf_tex.wrap_s = sampler.wrapS;
-                gltf_tex.wrap_t = sampler.wrapT;
+            if (tex.sampler >= 0 && tex.sampler < static_cast<int>(doc.samplers().size())) {
+                const auto& sampler = doc.samplers()[tex.sampler];
+                gltf_tex.min_filter = sampler.min_filter;
+                gltf_tex.mag_filter = sampler.mag_filter;
+                gltf_tex.wrap_s = sampler.wrap_s;
+                gltf_tex.wrap_t = sampler.wrap_t;
             }
 
             scene.textures.push_back(std::move(gltf_tex));
@@ -199,70 +194,58 @@ public:
     // Material loading
     // -------------------------------------------------------------------------
 
-    void load_materials(const tinygltf::Model& model, GltfScene& scene) {
-        scene.materials.reserve(model.materials.size());
+    void load_materials(const void_asset::GltfDocument& doc, GltfScene& scene) {
+        scene.materials.reserve(doc.materials().size());
 
-        for (const auto& mat : model.materials) {
+        for (const auto& mat : doc.materials()) {
             GltfMaterial gltf_mat;
             gltf_mat.name = mat.name;
 
             GpuMaterial& gpu = gltf_mat.gpu_material;
 
             // PBR Metallic Roughness
-            const auto& pbr = mat.pbrMetallicRoughness;
-
-            gpu.base_color = {{
-                static_cast<float>(pbr.baseColorFactor[0]),
-                static_cast<float>(pbr.baseColorFactor[1]),
-                static_cast<float>(pbr.baseColorFactor[2]),
-                static_cast<float>(pbr.baseColorFactor[3])
-            }};
-
-            gpu.metallic = static_cast<float>(pbr.metallicFactor);
-            gpu.roughness = static_cast<float>(pbr.roughnessFactor);
+            gpu.base_color = mat.base_color_factor;
+            gpu.metallic = mat.metallic_factor;
+            gpu.roughness = mat.roughness_factor;
 
             // Base color texture
-            if (pbr.baseColorTexture.index >= 0) {
-                gpu.tex_base_color = pbr.baseColorTexture.index;
+            if (mat.base_color_texture.index >= 0) {
+                gpu.tex_base_color = mat.base_color_texture.index;
             }
 
             // Metallic-roughness texture
-            if (pbr.metallicRoughnessTexture.index >= 0) {
-                gpu.tex_metallic_roughness = pbr.metallicRoughnessTexture.index;
+            if (mat.metallic_roughness_texture.index >= 0) {
+                gpu.tex_metallic_roughness = mat.metallic_roughness_texture.index;
             }
 
             // Normal map
-            if (mat.normalTexture.index >= 0) {
-                gpu.tex_normal = mat.normalTexture.index;
+            if (mat.normal_texture.index >= 0) {
+                gpu.tex_normal = mat.normal_texture.index;
                 gpu.set_flag(GpuMaterial::FLAG_HAS_NORMAL_MAP);
             }
 
             // Occlusion
-            if (mat.occlusionTexture.index >= 0) {
-                gpu.tex_occlusion = mat.occlusionTexture.index;
+            if (mat.occlusion_texture.index >= 0) {
+                gpu.tex_occlusion = mat.occlusion_texture.index;
             }
 
             // Emissive
-            gpu.emissive = {{
-                static_cast<float>(mat.emissiveFactor[0]),
-                static_cast<float>(mat.emissiveFactor[1]),
-                static_cast<float>(mat.emissiveFactor[2])
-            }};
+            gpu.emissive = mat.emissive_factor;
 
-            if (mat.emissiveTexture.index >= 0) {
-                gpu.tex_emissive = mat.emissiveTexture.index;
+            if (mat.emissive_texture.index >= 0) {
+                gpu.tex_emissive = mat.emissive_texture.index;
             }
 
             // Alpha mode
-            if (mat.alphaMode == "MASK") {
-                gpu.alpha_cutoff = static_cast<float>(mat.alphaCutoff);
+            if (mat.alpha_mode == "MASK") {
+                gpu.alpha_cutoff = mat.alpha_cutoff;
                 gpu.set_flag(GpuMaterial::FLAG_ALPHA_MASK);
-            } else if (mat.alphaMode == "BLEND") {
+            } else if (mat.alpha_mode == "BLEND") {
                 gpu.set_flag(GpuMaterial::FLAG_ALPHA_BLEND);
             }
 
             // Double-sided
-            if (mat.doubleSided) {
+            if (mat.double_sided) {
                 gpu.set_flag(GpuMaterial::FLAG_DOUBLE_SIDED);
             }
 
@@ -285,68 +268,45 @@ public:
         }
     }
 
-    void load_material_extensions(const tinygltf::Material& mat, GpuMaterial& gpu) {
+    void load_material_extensions(const void_asset::GltfMaterialDesc& mat, GpuMaterial& gpu) {
         // KHR_materials_clearcoat
-        auto clearcoat_it = mat.extensions.find("KHR_materials_clearcoat");
-        if (clearcoat_it != mat.extensions.end()) {
-            const auto& ext = clearcoat_it->second;
-            if (ext.Has("clearcoatFactor")) {
-                gpu.clearcoat = static_cast<float>(ext.Get("clearcoatFactor").GetNumberAsDouble());
-            }
-            if (ext.Has("clearcoatRoughnessFactor")) {
-                gpu.clearcoat_roughness = static_cast<float>(ext.Get("clearcoatRoughnessFactor").GetNumberAsDouble());
-            }
-            if (gpu.clearcoat > 0) {
-                gpu.set_flag(GpuMaterial::FLAG_HAS_CLEARCOAT);
-            }
+        if (mat.clearcoat) {
+            gpu.clearcoat = *mat.clearcoat;
+        }
+        if (mat.clearcoat_roughness) {
+            gpu.clearcoat_roughness = *mat.clearcoat_roughness;
+        }
+        if (gpu.clearcoat > 0) {
+            gpu.set_flag(GpuMaterial::FLAG_HAS_CLEARCOAT);
         }
 
         // KHR_materials_transmission
-        auto transmission_it = mat.extensions.find("KHR_materials_transmission");
-        if (transmission_it != mat.extensions.end()) {
-            const auto& ext = transmission_it->second;
-            if (ext.Has("transmissionFactor")) {
-                gpu.transmission = static_cast<float>(ext.Get("transmissionFactor").GetNumberAsDouble());
-            }
-            if (gpu.transmission > 0) {
-                gpu.set_flag(GpuMaterial::FLAG_HAS_TRANSMISSION);
-            }
+        if (mat.transmission) {
+            gpu.transmission = *mat.transmission;
+        }
+        if (gpu.transmission > 0) {
+            gpu.set_flag(GpuMaterial::FLAG_HAS_TRANSMISSION);
         }
 
         // KHR_materials_ior
-        auto ior_it = mat.extensions.find("KHR_materials_ior");
-        if (ior_it != mat.extensions.end()) {
-            const auto& ext = ior_it->second;
-            if (ext.Has("ior")) {
-                gpu.ior = static_cast<float>(ext.Get("ior").GetNumberAsDouble());
-            }
+        if (mat.ior) {
+            gpu.ior = *mat.ior;
         }
 
         // KHR_materials_sheen
-        auto sheen_it = mat.extensions.find("KHR_materials_sheen");
-        if (sheen_it != mat.extensions.end()) {
-            const auto& ext = sheen_it->second;
-            if (ext.Has("sheenColorFactor")) {
-                const auto& arr = ext.Get("sheenColorFactor");
-                if (arr.IsArray() && arr.ArrayLen() >= 3) {
-                    gpu.sheen_color = {{
-                        static_cast<float>(arr.Get(0).GetNumberAsDouble()),
-                        static_cast<float>(arr.Get(1).GetNumberAsDouble()),
-                        static_cast<float>(arr.Get(2).GetNumberAsDouble())
-                    }};
-                    gpu.sheen = 1.0f;  // Enable sheen if color is specified
-                }
-            }
-            if (ext.Has("sheenRoughnessFactor")) {
-                gpu.sheen_roughness = static_cast<float>(ext.Get("sheenRoughnessFactor").GetNumberAsDouble());
-            }
-            if (gpu.sheen > 0) {
-                gpu.set_flag(GpuMaterial::FLAG_HAS_SHEEN);
-            }
+        if (mat.sheen_color) {
+            gpu.sheen_color = *mat.sheen_color;
+            gpu.sheen = 1.0f;  // Enable sheen if color is specified
+        }
+        if (mat.sheen_roughness) {
+            gpu.sheen_roughness = *mat.sheen_roughness;
+        }
+        if (gpu.sheen > 0) {
+            gpu.set_flag(GpuMaterial::FLAG_HAS_SHEEN);
         }
 
         // KHR_materials_unlit
-        if (mat.extensions.find("KHR_materials_unlit") != mat.extensions.end()) {
+        if (mat.unlit) {
             gpu.set_flag(GpuMaterial::FLAG_UNLIT);
         }
     }
@@ -355,15 +315,15 @@ public:
     // Mesh loading
     // -------------------------------------------------------------------------
 
-    void load_meshes(const tinygltf::Model& model, GltfScene& scene) {
-        scene.meshes.reserve(model.meshes.size());
+    bool load_meshes(const void_asset::GltfDocument& doc, GltfScene& scene) {
+        scene.meshes.reserve(doc.meshes().size());
 
-        for (const auto& mesh : model.meshes) {
+        for (const auto& mesh : doc.meshes()) {
             GltfMesh gltf_mesh;
             gltf_mesh.name = mesh.name;
 
             for (const auto& prim : mesh.primitives) {
-                if (prim.mode != TINYGLTF_MODE_TRIANGLES) {
+                if (prim.mode != 4) {
                     continue;  // Only support triangles
                 }
 
@@ -371,11 +331,11 @@ public:
                 gltf_prim.material_index = prim.material;
                 gltf_prim.mesh_data.set_topology(PrimitiveTopology::TriangleList);
 
-                // Load vertices
-                load_primitive_vertices(model, prim, gltf_prim);
-
-                // Load indices
-                load_primitive_indices(model, prim, gltf_prim);
+                // Load vertices and indices
+                if (!load_primitive_vertices(doc, prim, gltf_prim) ||
+                    !load_primitive_indices(doc, prim, gltf_prim)) {
+                    return false;
+                }
 
                 // Generate tangents if needed
                 if (m_options.generate_tangents) {
@@ -401,191 +361,121 @@ public:
 
             scene.meshes.push_back(std::move(gltf_mesh));
         }
+        return true;
     }
 
-    void load_primitive_vertices(
-        const tinygltf::Model& model,
-        const tinygltf::Primitive& prim,
-        GltfPrimitive& gltf_prim) {
-
-        // Get accessors for each attribute
-        const float* positions = nullptr;
-        const float* normals = nullptr;
-        const float* tangents = nullptr;
-        const float* texcoords0 = nullptr;
-        const float* texcoords1 = nullptr;
-        const float* colors = nullptr;
+    /// Write one attribute straight into the interleaved vertex array
+    bool unpack_attribute(
+        const void_asset::GltfDocument& doc,
+        const void_asset::GltfPrimitiveDesc& prim,
+        std::string_view name,
+        std::vector<Vertex>& vertices,
+        float* first_dst,
+        std::uint32_t components) {
 
-        std::size_t vertex_count = 0;
-        int color_components = 0;
+        std::int32_t index = prim.attribute(name);
+        if (index < 0) {
+            return false;
+        }
 
-        // Position (required)
-        auto pos_it = prim.attributes.find("POSITION");
-        if (pos_it != prim.attributes.end()) {
-            const auto& accessor = model.accessors[pos_it->second];
-            const auto& view = model.bufferViews[accessor.bufferView];
-            const auto& buffer = model.buffers[view.buffer];
-            positions = reinterpret_cast<const float*>(
-                buffer.data.data() + view.byteOffset + accessor.byteOffset);
-            vertex_count = accessor.count;
-
-            // Bounds
-            if (accessor.minValues.size() >= 3) {
-                gltf_prim.min_bounds = {{
-                    static_cast<float>(accessor.minValues[0]),
-                    static_cast<float>(accessor.minValues[1]),
-                    static_cast<float>(accessor.minValues[2])
-                }};
-            }
-            if (accessor.maxValues.size() >= 3) {
-                gltf_prim.max_bounds = {{
-                    static_cast<float>(accessor.maxValues[0]),
-                    static_cast<float>(accessor.maxValues[1]),
-                    static_cast<float>(accessor.maxValues[2])
-                }};
-            }
+        auto view = doc.accessor(index);
+        if (!view) {
+            m_last_error = view.error().message();
+            return false;
         }
 
-        if (!positions || vertex_count == 0) return;
+        auto accessor = std::move(view).value();
+        accessor.count = std::min(accessor.count, vertices.size());
+        void_asset::gltf_unpack_floats(accessor, first_dst, sizeof(Vertex), components);
+        return true;
+    }
 
-        // Normal
-        auto norm_it = prim.attributes.find("NORMAL");
-        if (norm_it != prim.attributes.end()) {
-            const auto& accessor = model.accessors[norm_it->second];
-            const auto& view = model.bufferViews[accessor.bufferView];
-            const auto& buffer = model.buffers[view.buffer];
-            normals = reinterpret_cast<const float*>(
-                buffer.data.data() + view.byteOffset + accessor.byteOffset);
-        }
+    bool load_primitive_vertices(
+        const void_asset::GltfDocument& doc,
+        const void_asset::GltfPrimitiveDesc& prim,
+        GltfPrimitive& gltf_prim) {
 
-        // Tangent
-        auto tan_it = prim.attributes.find("TANGENT");
-        if (tan_it != prim.attributes.end()) {
-            const auto& accessor = model.accessors[tan_it->second];
-            const auto& view = model.bufferViews[accessor.bufferView];
-            const auto& buffer = model.buffers[view.buffer];
-            tangents = reinterpret_cast<const float*>(
-                buffer.data.data() + view.byteOffset + accessor.byteOffset);
+        // Position (required)
+        std::int32_t position_index = prim.attribute("POSITION");
+        if (position_index < 0) {
+            return true;
         }
 
-        // Texcoord 0
-        auto uv0_it = prim.attributes.find("TEXCOORD_0");
-        if (uv0_it != prim.attributes.end()) {
-            const auto& accessor = model.accessors[uv0_it->second];
-            const auto& view = model.bufferViews[accessor.bufferView];
-            const auto& buffer = model.buffers[view.buffer];
-            texcoords0 = reinterpret_cast<const float*>(
-                buffer.data.data() + view.byteOffset + accessor.byteOffset);
+        auto positions = doc.accessor(position_index);
+        if (!positions) {
+            m_last_error = positions.error().message();
+            return false;
         }
 
-        // Texcoord 1
-        auto uv1_it = prim.attributes.find("TEXCOORD_1");
-        if (uv1_it != prim.attributes.end()) {
-            const auto& accessor = model.accessors[uv1_it->second];
-            const auto& view = model.bufferViews[accessor.bufferView];
-            const auto& buffer = model.buffers[view.buffer];
-            texcoords1 = reinterpret_cast<const float*>(
-                buffer.data.data() + view.byteOffset + accessor.byteOffset);
+        const auto& position_view = positions.value();
+        std::size_t vertex_count = position_view.count;
+        if (vertex_count == 0) {
+            return true;
         }
 
-        // Vertex colors
-        auto color_it = prim.attributes.find("COLOR_0");
-        if (color_it != prim.attributes.end()) {
-            const auto& accessor = model.accessors[color_it->second];
-            const auto& view = model.bufferViews[accessor.bufferView];
-            const auto& buffer = model.buffers[view.buffer];
-            colors = reinterpret_cast<const float*>(
-                buffer.data.data() + view.byteOffset + accessor.byteOffset);
-            color_components = accessor.type == TINYGLTF_TYPE_VEC4 ? 4 : 3;
+        // Bounds
+        if (position_view.min_values.size() >= 3) {
+            gltf_prim.min_bounds = {{
+                position_view.min_values[0], position_view.min_values[1], position_view.min_values[2]
+            }};
+        }
+        if (position_view.max_values.size() >= 3) {
+            gltf_prim.max_bounds = {{
+                position_view.max_values[0], position_view.max_values[1], position_view.max_values[2]
+            }};
         }
 
-        // Build vertices
-        gltf_prim.mesh_data.reserve_vertices(vertex_count);
-
-        for (std::size_t i = 0; i < vertex_count; ++i) {
-            Vertex v;
+        // Default-constructed vertices supply the values of missing attributes;
+        // each present attribute is then converted in a single strided pass
+        auto& vertices = gltf_prim.mesh_data.vertices();
+        vertices.resize(vertex_count);
+        Vertex* first = vertices.data();
 
-            // Position
-            v.position = {{positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]}};
+        void_asset::gltf_unpack_floats(position_view, first->position.data(), sizeof(Vertex), 3);
+        unpack_attribute(doc, prim, "NORMAL", vertices, first->normal.data(), 3);
+        unpack_attribute(doc, prim, "TANGENT", vertices, first->tangent.data(), 4);
+        unpack_attribute(doc, prim, "COLOR_0", vertices, first->color.data(), 4);
 
-            // Normal
-            if (normals) {
-                v.normal = {{normals[i * 3], normals[i * 3 + 1], normals[i * 3 + 2]}};
-            }
-
-            // Tangent
-            if (tangents) {
-                v.tangent = {{tangents[i * 4], tangents[i * 4 + 1], tangents[i * 4 + 2], tangents[i * 4 + 3]}};
-            }
+        bool has_uv0 = unpack_attribute(doc, prim, "TEXCOORD_0", vertices, first->uv0.data(), 2);
+        bool has_uv1 = unpack_attribute(doc, prim, "TEXCOORD_1", vertices, first->uv1.data(), 2);
+        if (!m_last_error.empty()) {
+            return false;
+        }
 
-            // UV0
-            if (texcoords0) {
-                float u = texcoords0[i * 2];
-                float vv = texcoords0[i * 2 + 1];
-                if (m_options.flip_uvs) vv = 1.0f - vv;
-                v.uv0 = {{u, vv}};
+        if (m_options.flip_uvs) {
+            for (auto& v : vertices) {
+                if (has_uv0) v.uv0[1] = 1.0f - v.uv0[1];
+                if (has_uv1) v.uv1[1] = 1.0f - v.uv1[1];
             }
+        }
 
-            // UV1
-            if (texcoords1) {
-                float u = texcoords1[i * 2];
-                float vv = texcoords1[i * 2 + 1];
-                if (m_options.flip_uvs) vv = 1.0f - vv;
-                v.uv1 = {{u, vv}};
-            } else {
+        // UV1 falls back to UV0
+        if (!has_uv1 && has_uv0) {
+            for (auto& v : vertices) {
                 v.uv1 = v.uv0;
             }
-
-            // Color
-            if (colors) {
-                v.color[0] = colors[i * color_components];
-                v.color[1] = colors[i * color_components + 1];
-                v.color[2] = colors[i * color_components + 2];
-                v.color[3] = color_components == 4 ? colors[i * color_components + 3] : 1.0f;
-            }
-
-            gltf_prim.mesh_data.add_vertex(v);
         }
+
+        return true;
     }
 
-    void load_primitive_indices(
-        const tinygltf::Model& model,
-        const tinygltf::Primitive& prim,
+    bool load_primitive_indices(
+        const void_asset::GltfDocument& doc,
+        const void_asset::GltfPrimitiveDesc& prim,
         GltfPrimitive& gltf_prim) {
 
-        if (prim.indices < 0) return;
-
-        const auto& accessor = model.accessors[prim.indices];
-        const auto& view = model.bufferViews[accessor.bufferView];
-        const auto& buffer = model.buffers[view.buffer];
-
-        const std::uint8_t* data = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-
-        gltf_prim.mesh_data.reserve_indices(accessor.count);
-
-        switch (accessor.componentType) {
-            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
-                for (std::size_t i = 0; i < accessor.count; ++i) {
-                    gltf_prim.mesh_data.add_index(static_cast<std::uint32_t>(data[i]));
-                }
-                break;
-
-            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
-                const auto* indices16 = reinterpret_cast<const std::uint16_t*>(data);
-                for (std::size_t i = 0; i < accessor.count; ++i) {
-                    gltf_prim.mesh_data.add_index(static_cast<std::uint32_t>(indices16[i]));
-                }
-                break;
-            }
+        if (prim.indices < 0) return true;
 
-            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT: {
-                const auto* indices32 = reinterpret_cast<const std::uint32_t*>(data);
-                for (std::size_t i = 0; i < accessor.count; ++i) {
-                    gltf_prim.mesh_data.add_index(indices32[i]);
-                }
-                break;
-            }
+        auto view = doc.accessor(prim.indices);
+        if (!view) {
+            m_last_error = view.error().message();
+            return false;
         }
+
+        auto& indices = gltf_prim.mesh_data.indices();
+        indices.resize(view.value().count);
+        void_asset::gltf_unpack_indices(view.value(), indices.data());
+        return true;
     }
 
     // -------------------------------------------------------------------------
@@ -694,10 +584,10 @@ public:
     // Node loading
     // -------------------------------------------------------------------------
 
-    void load_nodes(const tinygltf::Model& model, GltfScene& scene) {
-        scene.nodes.reserve(model.nodes.size());
+    void load_nodes(const void_asset::GltfDocument& doc, GltfScene& scene) {
+        scene.nodes.reserve(doc.nodes().size());
 
-        for (const auto& node : model.nodes) {
+        for (const auto& node : doc.nodes()) {
             GltfNode gltf_node;
             gltf_node.name = node.name;
             gltf_node.mesh_index = node.mesh;
@@ -705,37 +595,15 @@ public:
             gltf_node.camera_index = node.camera;
 
             // Transform
-            if (!node.matrix.empty()) {
+            if (node.matrix) {
                 // Decompose matrix to TRS (simplified - assumes valid TRS matrix)
-                gltf_node.local_transform.translation = {{
-                    static_cast<float>(node.matrix[12]),
-                    static_cast<float>(node.matrix[13]),
-                    static_cast<float>(node.matrix[14])
-                }};
+                const auto& m = *node.matrix;
+                gltf_node.local_transform.translation = {{m[12], m[13], m[14]}};
                 // Would decompose rotation/scale properly in production
             } else {
-                if (!node.translation.empty()) {
-                    gltf_node.local_transform.translation = {{
-                        static_cast<float>(node.translation[0]),
-                        static_cast<float>(node.translation[1]),
-                        static_cast<float>(node.translation[2])
-                    }};
-                }
-                if (!node.rotation.empty()) {
-                    gltf_node.local_transform.rotation = {{
-                        static_cast<float>(node.rotation[0]),
-                        static_cast<float>(node.rotation[1]),
-                        static_cast<float>(node.rotation[2]),
-                        static_cast<float>(node.rotation[3])
-                    }};
-                }
-                if (!node.scale.empty()) {
-                    gltf_node.local_transform.scale = {{
-                        static_cast<float>(node.scale[0]),
-                        static_cast<float>(node.scale[1]),
-                        static_cast<float>(node.scale[2])
-                    }};
-                }
+                gltf_node.local_transform.translation = node.translation;
+                gltf_node.local_transform.rotation = node.rotation;
+                gltf_node.local_transform.scale = node.scale;
             }
 
             // Children
@@ -10,6 +10,7 @@
 #include <void_engine/event/event_bus.hpp>
 #include <void_engine/scene/world.hpp>
 #include <void_engine/ecs/world.hpp>
+#include <void_engine/asset/streaming.hpp>
 
 // Package system
 #include <void_engine/package/package.hpp>
@@ -151,6 +152,11 @@ void_core::Result<void> Runtime::initialize() {
         return result;
     }
 
+    if (auto result = init_streaming(); !result) {
+        m_state = RuntimeState::Uninitialized;
+        return result;
+    }
+
     if (!m_config.initial_world.empty()) {
         if (auto result = load_world(m_config.initial_world); !result) {
             spdlog::warn("Failed to load initial world '{}': {}",
@@ -261,6 +267,7 @@ void Runtime::shutdown() {
         unload_world(false);
     }
 
+    shutdown_streaming();
     shutdown_simulation();
     shutdown_io();
 
@@ -693,6 +700,28 @@ void_core::Result<void> Runtime::init_simulation() {
     return void_core::Ok();
 }
 
+void_core::Result<void> Runtime::init_streaming() {
+    spdlog::info("  [streaming] Initializing...");
+
+    constexpr std::size_t mb = 1024 * 1024;
+    auto config = void_asset::ResidencyManagerConfig()
+        .with_budget(void_asset::StreamingCategory::Texture,
+                     static_cast<std::size_t>(m_config.texture_streaming_budget_mb) * mb)
+        .with_budget(void_asset::StreamingCategory::Mesh,
+                     static_cast<std::size_t>(m_config.mesh_streaming_budget_mb) * mb);
+    m_residency = std::make_unique<void_asset::ResidencyManager>(std::move(config));
+
+    // Residency pass runs after rendering so it sees this frame's requests
+    m_kernel->register_system(void_kernel::Stage::Streaming, "asset_residency",
+        [this](float dt) {
+            m_residency->update(dt);
+        }, 0);
+
+    spdlog::info("  [streaming] Initialized (texture budget: {} MB, mesh budget: {} MB)",
+                 m_config.texture_streaming_budget_mb, m_config.mesh_streaming_budget_mb);
+    return void_core::Ok();
+}
+
 // =============================================================================
 // Accessors
 // =============================================================================
@@ -829,6 +858,15 @@ void Runtime::handle_platform_event(const PlatformEvent& evt) {
 // Shutdown Phases
 // =============================================================================
 
+void Runtime::shutdown_streaming() {
+    spdlog::info("  [streaming] Shutting down...");
+
+    m_kernel->unregister_system(void_kernel::Stage::Streaming, "asset_residency");
+    m_residency.reset();
+
+    spdlog::info("  [streaming] Shutdown complete");
+}
+
 void Runtime::shutdown_simulation() {
     spdlog::info("  [simulation] Shutting down...");
 
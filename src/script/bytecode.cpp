@@ -0,0 +1,120 @@
+#include "bytecode.hpp"
+
+#include <sstream>
+
+namespace void_script {
+
+const char* opcode_name(OpCode op) {
+    switch (op) {
+        case OpCode::LoadConst: return "LOADK";
+        case OpCode::LoadNull: return "LOADNULL";
+        case OpCode::LoadBool: return "LOADBOOL";
+        case OpCode::Move: return "MOVE";
+        case OpCode::GetGlobal: return "GETGLOBAL";
+        case OpCode::SetGlobal: return "SETGLOBAL";
+        case OpCode::DefineGlobal: return "DEFGLOBAL";
+        case OpCode::GetUpvalue: return "GETUPVAL";
+        case OpCode::SetUpvalue: return "SETUPVAL";
+        case OpCode::NewCell: return "NEWCELL";
+        case OpCode::GetCell: return "GETCELL";
+        case OpCode::SetCell: return "SETCELL";
+        case OpCode::Add: return "ADD";
+        case OpCode::Sub: return "SUB";
+        case OpCode::Mul: return "MUL";
+        case OpCode::Div: return "DIV";
+        case OpCode::Mod: return "MOD";
+        case OpCode::Pow: return "POW";
+        case OpCode::BitAnd: return "BAND";
+        case OpCode::BitOr: return "BOR";
+        case OpCode::BitXor: return "BXOR";
+        case OpCode::Shl: return "SHL";
+        case OpCode::Shr: return "SHR";
+        case OpCode::Eq: return "EQ";
+        case OpCode::Ne: return "NE";
+        case OpCode::Lt: return "LT";
+        case OpCode::Le: return "LE";
+        case OpCode::Gt: return "GT";
+        case OpCode::Ge: return "GE";
+        case OpCode::Coalesce: return "COALESCE";
+        case OpCode::Neg: return "NEG";
+        case OpCode::Not: return "NOT";
+        case OpCode::BitNot: return "BNOT";
+        case OpCode::ToBool: return "TOBOOL";
+        case OpCode::Inc: return "INC";
+        case OpCode::Dec: return "DEC";
+        case OpCode::Jump: return "JMP";
+        case OpCode::Loop: return "LOOP";
+        case OpCode::JumpIfFalse: return "JMPF";
+        case OpCode::JumpIfTrue: return "JMPT";
+        case OpCode::JumpIfArg: return "JMPARG";
+        case OpCode::Call: return "CALL";
+        case OpCode::GetMethod: return "GETMETHOD";
+        case OpCode::CallMethod: return "CALLMETHOD";
+        case OpCode::Return: return "RET";
+        case OpCode::ReturnNull: return "RETNULL";
+        case OpCode::Closure: return "CLOSURE";
+        case OpCode::Throw: return "THROW";
+        case OpCode::NewArray: return "NEWARRAY";
+        case OpCode::NewMap: return "NEWMAP";
+        case OpCode::NewRange: return "NEWRANGE";
+        case OpCode::GetMember: return "GETMEMBER";
+        case OpCode::GetMemberOpt: return "GETMEMBEROPT";
+        case OpCode::SetMember: return "SETMEMBER";
+        case OpCode::GetIndex: return "GETINDEX";
+        case OpCode::GetIndexOpt: return "GETINDEXOPT";
+        case OpCode::IterPrep: return "ITERPREP";
+        case OpCode::IterNext: return "ITERNEXT";
+        case OpCode::Exec: return "EXEC";
+        default: return "?";
+    }
+}
+
+namespace {
+
+void disassemble_into(const Chunk& chunk, std::ostringstream& ss) {
+    ss << "== " << (chunk.name.empty() ? "<script>" : chunk.name)
+       << " (params " << chunk.parameter_count
+       << ", registers " << chunk.register_count
+       << ", cells " << chunk.cell_count << ") ==\n";
+
+    for (std::size_t pc = 0; pc < chunk.code.size(); ++pc) {
+        const Instruction& ins = chunk.code[pc];
+        ss << pc << "\t" << opcode_name(ins.op) << "\t"
+           << static_cast<unsigned>(ins.a) << " " << ins.b << " " << ins.c;
+
+        switch (ins.op) {
+            case OpCode::LoadConst:
+                ss << "\t; " << chunk.constants[ins.b].to_string();
+                break;
+            case OpCode::GetGlobal:
+            case OpCode::SetGlobal:
+            case OpCode::DefineGlobal:
+                ss << "\t; " << chunk.globals[ins.b];
+                break;
+            case OpCode::GetMember:
+            case OpCode::GetMemberOpt:
+            case OpCode::SetMember:
+            case OpCode::GetMethod:
+                ss << "\t; ." << chunk.constants[ins.c].to_string() << " ic" << ins.d;
+                break;
+            default:
+                break;
+        }
+        ss << "\n";
+    }
+
+    for (const auto& function : chunk.functions) {
+        ss << "\n";
+        disassemble_into(*function, ss);
+    }
+}
+
+} // anonymous namespace
+
+std::string Chunk::disassemble() const {
+    std::ostringstream ss;
+    disassemble_into(*this, ss);
+    return ss.str();
+}
+
+} // namespace void_script
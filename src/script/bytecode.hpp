@@ -0,0 +1,174 @@
+#pragma once
+
+/// @file bytecode.hpp
+/// @brief Register bytecode for VoidScript
+///
+/// Functions compile to a Chunk: a flat array of fixed-size instructions
+/// over a per-call register window, a constant pool and a table of nested
+/// function prototypes. Locals live in registers resolved at compile time;
+/// locals captured by closures are moved into heap cells so closures share
+/// them. Globals are looked up by name once per chunk and then cached.
+
+#include "types.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace void_script {
+
+class Environment;
+
+// =============================================================================
+// Opcodes
+// =============================================================================
+
+/// @brief Bytecode operations
+///
+/// R[x] is register x of the current frame, K[x] constant x, C[x] cell x of
+/// the current frame, U[x] upvalue x of the running closure, G[x] global
+/// name x and P[x] nested prototype x. Operands marked RK are a register,
+/// or a constant when k_rk_constant is set. IC[d] is the property cache
+/// selected by the instruction's d operand.
+enum class OpCode : std::uint8_t {
+    // Loads
+    LoadConst,      ///< R[a] = K[b]
+    LoadNull,       ///< R[a] = null
+    LoadBool,       ///< R[a] = b != 0
+    Move,           ///< R[a] = R[b]
+
+    // Variables
+    GetGlobal,      ///< R[a] = G[b]
+    SetGlobal,      ///< G[b] = R[a] (must already exist)
+    DefineGlobal,   ///< define G[b] = R[a]
+    GetUpvalue,     ///< R[a] = *U[b]
+    SetUpvalue,     ///< *U[b] = R[a]
+    NewCell,        ///< C[b] = new cell holding R[a]
+    GetCell,        ///< R[a] = *C[b]
+    SetCell,        ///< *C[b] = R[a]
+
+    // Arithmetic and comparison (R[a] = RK[b] op RK[c])
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Mod,
+    Pow,
+    BitAnd,
+    BitOr,
+    BitXor,
+    Shl,
+    Shr,
+    Eq,
+    Ne,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+    Coalesce,       ///< R[a] = RK[b] ?? RK[c]
+
+    // Unary (R[a] = op R[b])
+    Neg,
+    Not,
+    BitNot,
+    ToBool,
+    Inc,            ///< R[a] = number(R[b]) + 1
+    Dec,            ///< R[a] = number(R[b]) - 1
+
+    // Control flow
+    Jump,           ///< pc = b
+    Loop,           ///< pc = b (backward edge; checks the timeout)
+    JumpIfFalse,    ///< if !truthy(R[a]) pc = b
+    JumpIfTrue,     ///< if truthy(R[a]) pc = b
+    JumpIfArg,      ///< if argument a was passed pc = b
+
+    // Calls
+    Call,           ///< R[a] = R[a](R[a+1] .. R[a+b])
+    GetMethod,      ///< R[a] = R[b].K[c]; R[b] = receiver if a class method, else null (IC[d])
+    CallMethod,     ///< R[a] = R[a](R[a+2] .. R[a+1+b]), bound to R[a+1] if not null
+    Return,         ///< return R[a]
+    ReturnNull,     ///< return null
+    Closure,        ///< R[a] = closure over P[b]
+    Throw,          ///< throw R[a] as a user exception
+
+    // Collections
+    NewArray,       ///< R[a] = [R[b] .. R[b+c-1]]
+    NewMap,         ///< R[a] = {R[b]: R[b+1], ...} with c entries
+    NewRange,       ///< R[a] = R[b] .. R[b+1] (inclusive if c != 0)
+    GetMember,      ///< R[a] = R[b].K[c] (IC[d])
+    GetMemberOpt,   ///< R[a] = R[b]?.K[c] (IC[d])
+    SetMember,      ///< R[b].K[c] = R[a] (IC[d])
+    GetIndex,       ///< R[a] = R[b][R[c]]
+    GetIndexOpt,    ///< R[a] = R[b]?[R[c]]
+    IterPrep,       ///< check R[a] is iterable, R[a+1] = 0
+    IterNext,       ///< if R[a+1] == len(R[a]) pc = b, else R[c] = R[a][R[a+1]++]
+
+    // Tree-walker fallback
+    Exec,           ///< interpreter.execute(S[b]) in the chunk environment; R[a] = result if c
+
+    Count
+};
+
+/// @brief Get opcode mnemonic
+[[nodiscard]] const char* opcode_name(OpCode op);
+
+/// Marks an RK operand as a constant index
+inline constexpr std::uint16_t k_rk_constant = 0x8000;
+
+/// Registers available to a single function
+inline constexpr std::uint32_t k_max_registers = 250;
+
+// =============================================================================
+// Instruction
+// =============================================================================
+
+/// @brief Fixed-size bytecode instruction
+struct Instruction {
+    OpCode op = OpCode::LoadNull;
+    std::uint8_t a = 0;
+    std::uint16_t b = 0;
+    std::uint16_t c = 0;
+    std::uint16_t d = 0;
+};
+
+static_assert(sizeof(Instruction) == 8, "Instruction should stay compact");
+
+// =============================================================================
+// Chunk
+// =============================================================================
+
+/// @brief Where a closure finds an upvalue when it is created
+struct UpvalueDesc {
+    bool from_cell = true;      ///< true: enclosing frame's cell, false: enclosing closure's upvalue
+    std::uint16_t index = 0;
+};
+
+/// @brief Compiled function prototype
+class Chunk {
+public:
+    std::string name;
+    std::uint32_t parameter_count = 0;
+    std::uint32_t required_count = 0;   ///< Parameters without a default value
+    std::uint32_t register_count = 0;
+    std::uint32_t cell_count = 0;
+
+    std::vector<Instruction> code;
+    std::vector<Value> constants;
+    std::vector<std::string> globals;   ///< Global names referenced by G[x]
+    std::vector<UpvalueDesc> upvalues;
+    std::vector<std::shared_ptr<Chunk>> functions;
+    std::vector<const Statement*> fallbacks;  ///< Statements run by the tree-walker
+
+    /// Inline caches for member access sites (indexed by the d operand)
+    mutable std::vector<PropertyCache> property_caches;
+
+    /// Global slot cache (parallel to globals, filled by the VM)
+    mutable std::vector<Value*> global_slots;
+    mutable const Environment* global_slots_env = nullptr;
+
+    /// @brief Human-readable listing of this chunk and its nested functions
+    [[nodiscard]] std::string disassemble() const;
+};
+
+} // namespace void_script
@@ -0,0 +1,1058 @@
+#include "compiler.hpp"
+
+#include <bit>
+#include <limits>
+
+namespace void_script {
+
+namespace {
+
+/// Constant pool indices must fit an RK operand
+constexpr std::size_t k_max_constants = k_rk_constant;
+
+OpCode binary_opcode(TokenType op) {
+    switch (op) {
+        case TokenType::Plus: case TokenType::PlusAssign: return OpCode::Add;
+        case TokenType::Minus: case TokenType::MinusAssign: return OpCode::Sub;
+        case TokenType::Star: case TokenType::StarAssign: return OpCode::Mul;
+        case TokenType::Slash: case TokenType::SlashAssign: return OpCode::Div;
+        case TokenType::Percent: case TokenType::PercentAssign: return OpCode::Mod;
+        case TokenType::Power: return OpCode::Pow;
+        case TokenType::Ampersand: case TokenType::AmpersandAssign: return OpCode::BitAnd;
+        case TokenType::Pipe: case TokenType::PipeAssign: return OpCode::BitOr;
+        case TokenType::Caret: case TokenType::CaretAssign: return OpCode::BitXor;
+        case TokenType::ShiftLeft: case TokenType::ShiftLeftAssign: return OpCode::Shl;
+        case TokenType::ShiftRight: case TokenType::ShiftRightAssign: return OpCode::Shr;
+        case TokenType::Equal: return OpCode::Eq;
+        case TokenType::NotEqual: return OpCode::Ne;
+        case TokenType::Less: return OpCode::Lt;
+        case TokenType::LessEqual: return OpCode::Le;
+        case TokenType::Greater: return OpCode::Gt;
+        case TokenType::GreaterEqual: return OpCode::Ge;
+        case TokenType::QuestionQuestion: return OpCode::Coalesce;
+        default: return OpCode::Count;
+    }
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// Entry Points
+// =============================================================================
+
+std::shared_ptr<Chunk> Compiler::compile(const Program& program) {
+    Compiler compiler;
+    return compiler.compile_program(program);
+}
+
+std::shared_ptr<Chunk> Compiler::compile_program(const Program& program) {
+    std::unordered_set<const void*> captured;
+
+    for (;;) {
+        FunctionState fs;
+        fs.chunk = std::make_shared<Chunk>();
+        fs.captured = std::move(captured);
+        fs.top_level = true;
+        fs_ = &fs;
+
+        for (const auto& stmt : program.statements) {
+            const std::size_t code_size = fs.chunk->code.size();
+            const std::size_t function_count = fs.chunk->functions.size();
+            const std::size_t local_count = fs.locals.size();
+            const std::uint32_t free_reg = fs.free_reg;
+            const std::uint32_t local_top = fs.local_top;
+            const std::uint32_t free_cell = fs.free_cell;
+
+            // The last statement's value is the program's result
+            const bool last = &stmt == &program.statements.back();
+            const auto* result_expr = last ? dynamic_cast<const ExprStatement*>(stmt.get()) : nullptr;
+
+            try {
+                if (result_expr) {
+                    emit(OpCode::Return, expr_any(*result_expr->expression, true));
+                } else {
+                    statement(*stmt);
+                }
+            } catch (const Unsupported&) {
+                // Hand the whole top-level statement to the tree-walker
+                fs_ = &fs;
+                fs.chunk->code.resize(code_size);
+                fs.chunk->functions.resize(function_count);
+                fs.locals.resize(local_count);
+                fs.scopes.clear();
+                fs.loops.clear();
+                fs.free_reg = free_reg;
+                fs.local_top = local_top;
+                fs.free_cell = free_cell;
+
+                fs.chunk->fallbacks.push_back(stmt.get());
+                if (last) {
+                    std::uint8_t reg = alloc_reg();
+                    emit(OpCode::Exec, reg, static_cast<std::uint32_t>(fs.chunk->fallbacks.size() - 1), 1);
+                    emit(OpCode::Return, reg);
+                } else {
+                    emit(OpCode::Exec, 0, static_cast<std::uint32_t>(fs.chunk->fallbacks.size() - 1));
+                }
+            }
+        }
+        emit(OpCode::ReturnNull);
+
+        fs_ = nullptr;
+        if (!fs.recompile) {
+            return fs.chunk;
+        }
+        captured = std::move(fs.captured);
+    }
+}
+
+std::shared_ptr<Chunk> Compiler::compile_function(const std::string& name, const std::vector<Param>& params,
+                                                  const Statement& body) {
+    if (params.size() > k_max_registers) {
+        throw Unsupported{};
+    }
+
+    FunctionState* parent = fs_;
+    std::unordered_set<const void*> captured;
+
+    for (;;) {
+        FunctionState fs;
+        fs.parent = parent;
+        fs.chunk = std::make_shared<Chunk>();
+        fs.chunk->name = name;
+        fs.chunk->parameter_count = static_cast<std::uint32_t>(params.size());
+        fs.captured = std::move(captured);
+        fs_ = &fs;
+
+        // Parameters arrive in registers 0..n-1; defaults fill the missing ones
+        std::uint32_t required = 0;
+        for (std::size_t i = 0; i < params.size(); ++i) {
+            std::uint8_t reg = alloc_reg();
+            if (params[i].default_value) {
+                std::size_t skip = emit(OpCode::JumpIfArg, static_cast<std::uint32_t>(i));
+                expr_to(*params[i].default_value, reg);
+                patch(skip);
+            } else if (required == i) {
+                ++required;
+            }
+        }
+        fs.chunk->required_count = required;
+
+        // Declare parameters (captured ones move into cells)
+        fs.free_reg = 0;
+        for (std::size_t i = 0; i < params.size(); ++i) {
+            std::uint8_t reg = alloc_reg();
+            declare_local(params[i].name, params[i].key, reg);
+        }
+
+        if (const auto* body_block = dynamic_cast<const BlockStatement*>(&body)) {
+            block(body_block->statements);
+        } else {
+            statement(body);
+        }
+        emit(OpCode::ReturnNull);
+
+        fs_ = parent;
+        if (!fs.recompile) {
+            return fs.chunk;
+        }
+        captured = std::move(fs.captured);
+    }
+}
+
+// =============================================================================
+// Statements
+// =============================================================================
+
+void Compiler::statement(const Statement& stmt) {
+    if (auto* expr_stmt = dynamic_cast<const ExprStatement*>(&stmt)) {
+        effect(*expr_stmt->expression);
+    } else if (auto* block_stmt = dynamic_cast<const BlockStatement*>(&stmt)) {
+        begin_scope();
+        block(block_stmt->statements);
+        end_scope();
+    } else if (auto* if_stmt = dynamic_cast<const IfStatement*>(&stmt)) {
+        if_statement(*if_stmt);
+    } else if (auto* while_stmt = dynamic_cast<const WhileStatement*>(&stmt)) {
+        while_statement(*while_stmt);
+    } else if (auto* for_stmt = dynamic_cast<const ForStatement*>(&stmt)) {
+        for_statement(*for_stmt);
+    } else if (auto* foreach_stmt = dynamic_cast<const ForEachStatement*>(&stmt)) {
+        foreach_statement(*foreach_stmt);
+    } else if (auto* ret = dynamic_cast<const ReturnStatement*>(&stmt)) {
+        if (fs_->top_level) {
+            throw Unsupported{};
+        }
+        if (ret->value) {
+            std::uint32_t mark = fs_->free_reg;
+            emit(OpCode::Return, expr_any(*ret->value));
+            fs_->free_reg = mark;
+        } else {
+            emit(OpCode::ReturnNull);
+        }
+    } else if (dynamic_cast<const BreakStatement*>(&stmt)) {
+        jump_out(true);
+    } else if (dynamic_cast<const ContinueStatement*>(&stmt)) {
+        jump_out(false);
+    } else if (auto* var = dynamic_cast<const VarDecl*>(&stmt)) {
+        var_declaration(*var);
+    } else if (auto* func = dynamic_cast<const FunctionDecl*>(&stmt)) {
+        function_declaration(*func);
+    } else if (auto* match = dynamic_cast<const MatchStatement*>(&stmt)) {
+        match_statement(*match);
+    } else if (auto* throw_stmt = dynamic_cast<const ThrowStatement*>(&stmt)) {
+        std::uint32_t mark = fs_->free_reg;
+        emit(OpCode::Throw, expr_any(*throw_stmt->value));
+        fs_->free_reg = mark;
+    } else if (dynamic_cast<const ModuleDecl*>(&stmt)) {
+        // Module declarations are not executed by the interpreter either
+    } else {
+        // ClassDecl, TryCatchStatement, ImportDecl, ExportDecl
+        throw Unsupported{};
+    }
+}
+
+void Compiler::block(const std::vector<StmtPtr>& statements) {
+    for (const auto& stmt : statements) {
+        statement(*stmt);
+    }
+}
+
+void Compiler::if_statement(const IfStatement& stmt) {
+    std::uint32_t mark = fs_->free_reg;
+    std::size_t to_else = emit(OpCode::JumpIfFalse, expr_any(*stmt.condition));
+    fs_->free_reg = mark;
+
+    statement(*stmt.then_branch);
+
+    if (stmt.else_branch) {
+        std::size_t to_end = emit(OpCode::Jump);
+        patch(to_else);
+        statement(*stmt.else_branch);
+        patch(to_end);
+    } else {
+        patch(to_else);
+    }
+}
+
+void Compiler::while_statement(const WhileStatement& stmt) {
+    std::size_t start = here();
+
+    std::uint32_t mark = fs_->free_reg;
+    std::size_t to_exit = emit(OpCode::JumpIfFalse, expr_any(*stmt.condition));
+    fs_->free_reg = mark;
+
+    fs_->loops.emplace_back();
+    statement(*stmt.body);
+    emit(OpCode::Loop, 0, static_cast<std::uint32_t>(start));
+
+    LoopState loop = std::move(fs_->loops.back());
+    fs_->loops.pop_back();
+    patch(to_exit);
+    for (std::size_t at : loop.breaks) {
+        patch(at);
+    }
+    for (std::size_t at : loop.continues) {
+        fs_->chunk->code[at].b = static_cast<std::uint16_t>(start);
+    }
+}
+
+void Compiler::for_statement(const ForStatement& stmt) {
+    begin_scope();
+    if (stmt.initializer) {
+        statement(*stmt.initializer);
+    }
+
+    std::size_t start = here();
+    std::optional<std::size_t> to_exit;
+    if (stmt.condition) {
+        std::uint32_t mark = fs_->free_reg;
+        to_exit = emit(OpCode::JumpIfFalse, expr_any(*stmt.condition));
+        fs_->free_reg = mark;
+    }
+
+    fs_->loops.emplace_back();
+    statement(*stmt.body);
+
+    LoopState loop = std::move(fs_->loops.back());
+    fs_->loops.pop_back();
+    for (std::size_t at : loop.continues) {
+        patch(at);
+    }
+    if (stmt.increment) {
+        effect(*stmt.increment);
+    }
+    emit(OpCode::Loop, 0, static_cast<std::uint32_t>(start));
+
+    if (to_exit) {
+        patch(*to_exit);
+    }
+    for (std::size_t at : loop.breaks) {
+        patch(at);
+    }
+    end_scope();
+}
+
+void Compiler::foreach_statement(const ForEachStatement& stmt) {
+    begin_scope();
+
+    // Hidden locals: iterable and cursor in consecutive registers
+    std::uint8_t iterable = declare_hidden();
+    declare_hidden();
+    expr_to(*stmt.iterable, iterable);
+    emit(OpCode::IterPrep, iterable);
+
+    std::size_t start = here();
+    std::size_t to_exit = emit(OpCode::IterNext, iterable);
+
+    // Fresh binding per iteration so closures see the item they captured
+    begin_scope();
+    std::uint8_t item = alloc_reg();
+    fs_->chunk->code[to_exit].c = item;
+    declare_local(&stmt.variable, &stmt, item);
+
+    fs_->loops.emplace_back();
+    statement(*stmt.body);
+    end_scope();
+
+    emit(OpCode::Loop, 0, static_cast<std::uint32_t>(start));
+
+    LoopState loop = std::move(fs_->loops.back());
+    fs_->loops.pop_back();
+    patch(to_exit);
+    for (std::size_t at : loop.breaks) {
+        patch(at);
+    }
+    for (std::size_t at : loop.continues) {
+        fs_->chunk->code[at].b = static_cast<std::uint16_t>(start);
+    }
+    end_scope();
+}
+
+void Compiler::match_statement(const MatchStatement& stmt) {
+    std::uint32_t mark = fs_->free_reg;
+    std::uint8_t subject = alloc_reg();
+    expr_to(*stmt.subject, subject);
+
+    std::vector<std::size_t> to_end;
+    for (const auto& arm : stmt.arms) {
+        std::vector<std::size_t> to_next;
+
+        if (arm.pattern) {
+            std::uint32_t arm_mark = fs_->free_reg;
+            std::uint8_t test = alloc_reg();
+            std::uint16_t pattern = expr_rk(*arm.pattern);
+            emit(OpCode::Eq, test, subject, pattern);
+            to_next.push_back(emit(OpCode::JumpIfFalse, test));
+            fs_->free_reg = arm_mark;
+        }
+        if (arm.guard) {
+            std::uint32_t arm_mark = fs_->free_reg;
+            to_next.push_back(emit(OpCode::JumpIfFalse, expr_any(*arm.guard)));
+            fs_->free_reg = arm_mark;
+        }
+
+        statement(*arm.body);
+        to_end.push_back(emit(OpCode::Jump));
+        for (std::size_t at : to_next) {
+            patch(at);
+        }
+    }
+
+    for (std::size_t at : to_end) {
+        patch(at);
+    }
+    fs_->free_reg = mark;
+}
+
+void Compiler::var_declaration(const VarDecl& decl) {
+    if (fs_->top_level && fs_->scopes.empty()) {
+        std::uint32_t mark = fs_->free_reg;
+        std::uint8_t value = alloc_reg();
+        if (decl.initializer) {
+            expr_to(*decl.initializer, value);
+        } else {
+            emit(OpCode::LoadNull, value);
+        }
+        emit(OpCode::DefineGlobal, value, global(decl.name));
+        fs_->free_reg = mark;
+        return;
+    }
+
+    std::uint8_t reg = alloc_reg();
+    if (decl.initializer) {
+        expr_to(*decl.initializer, reg);
+    } else {
+        emit(OpCode::LoadNull, reg);
+    }
+    declare_local(&decl.name, &decl, reg);
+}
+
+void Compiler::function_declaration(const FunctionDecl& decl) {
+    std::vector<Param> params;
+    params.reserve(decl.parameters.size());
+    for (const auto& param : decl.parameters) {
+        params.push_back({&param.name, &param, param.default_value.get()});
+    }
+
+    if (fs_->top_level && fs_->scopes.empty()) {
+        std::uint32_t mark = fs_->free_reg;
+        std::uint8_t reg = alloc_reg();
+        fs_->chunk->functions.push_back(compile_function(decl.name, params, *decl.body));
+        emit(OpCode::Closure, reg, static_cast<std::uint32_t>(fs_->chunk->functions.size() - 1));
+        emit(OpCode::DefineGlobal, reg, global(decl.name));
+        fs_->free_reg = mark;
+        return;
+    }
+
+    // Declare first so the body can refer to itself
+    std::uint8_t reg = alloc_reg();
+    emit(OpCode::LoadNull, reg);
+    std::uint8_t local = declare_local(&decl.name, &decl, reg);
+    const Local& declared = fs_->locals.back();
+
+    std::uint32_t mark = fs_->free_reg;
+    std::uint8_t closure = declared.cell >= 0 ? alloc_reg() : local;
+    std::int32_t cell = declared.cell;
+    fs_->chunk->functions.push_back(compile_function(decl.name, params, *decl.body));
+    emit(OpCode::Closure, closure, static_cast<std::uint32_t>(fs_->chunk->functions.size() - 1));
+    if (cell >= 0) {
+        emit(OpCode::SetCell, closure, static_cast<std::uint32_t>(cell));
+    }
+    fs_->free_reg = mark;
+}
+
+void Compiler::jump_out(bool is_break) {
+    if (fs_->loops.empty()) {
+        throw Unsupported{};
+    }
+    std::size_t at = emit(OpCode::Jump);
+    if (is_break) {
+        fs_->loops.back().breaks.push_back(at);
+    } else {
+        fs_->loops.back().continues.push_back(at);
+    }
+}
+
+// =============================================================================
+// Expressions
+// =============================================================================
+
+void Compiler::expr_to(const Expression& expr, std::uint8_t dst) {
+    std::uint32_t mark = fs_->free_reg;
+
+    if (auto* lit = dynamic_cast<const LiteralExpr*>(&expr)) {
+        if (lit->value.is_null()) {
+            emit(OpCode::LoadNull, dst);
+        } else if (lit->value.is_bool()) {
+            emit(OpCode::LoadBool, dst, lit->value.as_bool() ? 1 : 0);
+        } else {
+            emit(OpCode::LoadConst, dst, constant(lit->value));
+        }
+    } else if (auto* id = dynamic_cast<const IdentifierExpr*>(&expr)) {
+        load_var(resolve(id->name), id->name, dst);
+    } else if (auto* bin = dynamic_cast<const BinaryExpr*>(&expr)) {
+        if (bin->op == TokenType::And || bin->op == TokenType::Or) {
+            logical(*bin, dst);
+        } else {
+            binary(*bin, dst);
+        }
+    } else if (auto* un = dynamic_cast<const UnaryExpr*>(&expr)) {
+        unary(*un, dst);
+    } else if (auto* call_expr = dynamic_cast<const CallExpr*>(&expr)) {
+        call(*call_expr->callee, call_expr->arguments, dst);
+    } else if (auto* new_expr = dynamic_cast<const NewExpr*>(&expr)) {
+        call(*new_expr->class_expr, new_expr->arguments, dst);
+    } else if (auto* mem = dynamic_cast<const MemberExpr*>(&expr)) {
+        std::uint8_t object = expr_any(*mem->object);
+        emit(mem->optional ? OpCode::GetMemberOpt : OpCode::GetMember, dst, object,
+             constant(Value(mem->member)), property_cache());
+    } else if (auto* idx = dynamic_cast<const IndexExpr*>(&expr)) {
+        std::uint8_t object = expr_any(*idx->object, may_assign(*idx->index));
+        std::uint8_t index = expr_any(*idx->index);
+        emit(idx->optional ? OpCode::GetIndexOpt : OpCode::GetIndex, dst, object, index);
+    } else if (auto* asg = dynamic_cast<const AssignExpr*>(&expr)) {
+        assign(*asg, dst);
+    } else if (auto* ternary = dynamic_cast<const TernaryExpr*>(&expr)) {
+        std::size_t to_else = emit(OpCode::JumpIfFalse, expr_any(*ternary->condition));
+        fs_->free_reg = mark;
+        expr_to(*ternary->then_expr, dst);
+        std::size_t to_end = emit(OpCode::Jump);
+        patch(to_else);
+        expr_to(*ternary->else_expr, dst);
+        patch(to_end);
+    } else if (auto* arr = dynamic_cast<const ArrayExpr*>(&expr)) {
+        std::uint32_t base = fs_->free_reg;
+        for (const auto& elem : arr->elements) {
+            expr_to(*elem, alloc_reg());
+        }
+        emit(OpCode::NewArray, dst, base, static_cast<std::uint32_t>(arr->elements.size()));
+    } else if (auto* map = dynamic_cast<const MapExpr*>(&expr)) {
+        std::uint32_t base = fs_->free_reg;
+        for (const auto& entry : map->entries) {
+            std::uint8_t key = alloc_reg();
+            if (auto* key_lit = dynamic_cast<const LiteralExpr*>(entry.key.get())) {
+                emit(OpCode::LoadConst, key, constant(Value(key_lit->value.to_string())));
+            } else {
+                expr_to(*entry.key, key);
+            }
+            expr_to(*entry.value, alloc_reg());
+        }
+        emit(OpCode::NewMap, dst, base, static_cast<std::uint32_t>(map->entries.size()));
+    } else if (auto* lam = dynamic_cast<const LambdaExpr*>(&expr)) {
+        lambda(*lam, dst);
+    } else if (auto* range = dynamic_cast<const RangeExpr*>(&expr)) {
+        std::uint8_t base = alloc_reg();
+        expr_to(*range->start, base);
+        expr_to(*range->end, alloc_reg());
+        emit(OpCode::NewRange, dst, base, range->inclusive ? 1 : 0);
+    } else if (auto* await_expr = dynamic_cast<const AwaitExpr*>(&expr)) {
+        // Evaluated synchronously, as in the tree-walker
+        expr_to(*await_expr->operand, dst);
+    } else if (auto* yield_expr = dynamic_cast<const YieldExpr*>(&expr)) {
+        if (yield_expr->value) {
+            expr_to(*yield_expr->value, dst);
+        } else {
+            emit(OpCode::LoadNull, dst);
+        }
+    } else {
+        // ThisExpr, SuperExpr
+        throw Unsupported{};
+    }
+
+    fs_->free_reg = mark;
+}
+
+void Compiler::effect(const Expression& expr) {
+    if (auto* asg = dynamic_cast<const AssignExpr*>(&expr)) {
+        assign(*asg, std::nullopt);
+        return;
+    }
+    if (auto* un = dynamic_cast<const UnaryExpr*>(&expr)) {
+        if (un->op == TokenType::Increment || un->op == TokenType::Decrement) {
+            step(*un, std::nullopt);
+            return;
+        }
+    }
+
+    std::uint32_t mark = fs_->free_reg;
+    expr_to(expr, alloc_reg());
+    fs_->free_reg = mark;
+}
+
+std::uint8_t Compiler::expr_any(const Expression& expr, bool protect) {
+    if (!protect) {
+        if (auto* id = dynamic_cast<const IdentifierExpr*>(&expr)) {
+            VarRef ref = resolve(id->name);
+            if (ref.kind == VarKind::Register) {
+                return static_cast<std::uint8_t>(ref.index);
+            }
+        }
+    }
+    std::uint8_t reg = alloc_reg();
+    expr_to(expr, reg);
+    return reg;
+}
+
+std::uint16_t Compiler::expr_rk(const Expression& expr, bool protect) {
+    if (auto* lit = dynamic_cast<const LiteralExpr*>(&expr)) {
+        if (!lit->value.is_null() && !lit->value.is_bool()) {
+            return static_cast<std::uint16_t>(constant(lit->value) | k_rk_constant);
+        }
+    }
+    return expr_any(expr, protect);
+}
+
+void Compiler::binary(const BinaryExpr& expr, std::uint8_t dst) {
+    OpCode op = binary_opcode(expr.op);
+    if (op == OpCode::Count) {
+        throw Unsupported{};
+    }
+    // A local read on the left must not observe an assignment on the right
+    std::uint16_t left = expr_rk(*expr.left, may_assign(*expr.right));
+    std::uint16_t right = expr_rk(*expr.right);
+    emit(op, dst, left, right);
+}
+
+void Compiler::logical(const BinaryExpr& expr, std::uint8_t dst) {
+    // The left value lands in the target before the right side runs, so
+    // never use a local's own register as the scratch target
+    std::uint8_t target = dst < fs_->local_top ? alloc_reg() : dst;
+    bool is_and = expr.op == TokenType::And;
+
+    expr_to(*expr.left, target);
+    std::size_t short_circuit = emit(is_and ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, target);
+    expr_to(*expr.right, target);
+    emit(OpCode::ToBool, target, target);
+    std::size_t to_end = emit(OpCode::Jump);
+    patch(short_circuit);
+    emit(OpCode::LoadBool, target, is_and ? 0 : 1);
+    patch(to_end);
+
+    if (target != dst) {
+        emit(OpCode::Move, dst, target);
+    }
+}
+
+void Compiler::unary(const UnaryExpr& expr, std::uint8_t dst) {
+    switch (expr.op) {
+        case TokenType::Minus:
+            emit(OpCode::Neg, dst, expr_any(*expr.operand));
+            break;
+        case TokenType::Not:
+            emit(OpCode::Not, dst, expr_any(*expr.operand));
+            break;
+        case TokenType::Tilde:
+            emit(OpCode::BitNot, dst, expr_any(*expr.operand));
+            break;
+        case TokenType::Increment:
+        case TokenType::Decrement:
+            step(expr, dst);
+            break;
+        default:
+            throw Unsupported{};
+    }
+}
+
+void Compiler::step(const UnaryExpr& expr, std::optional<std::uint8_t> dst) {
+    OpCode op = expr.op == TokenType::Increment ? OpCode::Inc : OpCode::Dec;
+    std::uint32_t mark = fs_->free_reg;
+
+    auto* id = dynamic_cast<const IdentifierExpr*>(expr.operand.get());
+    if (!id) {
+        // Only identifiers are written back; other operands just yield the value
+        std::uint8_t operand = expr_any(*expr.operand);
+        if (dst) {
+            emit(expr.prefix ? op : OpCode::Move, *dst, operand);
+        }
+        fs_->free_reg = mark;
+        return;
+    }
+
+    VarRef ref = resolve(id->name);
+    if (ref.kind == VarKind::Register) {
+        auto reg = static_cast<std::uint8_t>(ref.index);
+        if (dst && !expr.prefix && *dst != reg) {
+            emit(OpCode::Move, *dst, reg);
+        }
+        emit(op, reg, reg);
+        if (dst && expr.prefix && *dst != reg) {
+            emit(OpCode::Move, *dst, reg);
+        }
+        return;
+    }
+
+    std::uint8_t old_value = alloc_reg();
+    std::uint8_t new_value = alloc_reg();
+    load_var(ref, id->name, old_value);
+    emit(op, new_value, old_value);
+    store_var(ref, id->name, new_value);
+    if (dst) {
+        emit(OpCode::Move, *dst, expr.prefix ? new_value : old_value);
+    }
+    fs_->free_reg = mark;
+}
+
+void Compiler::assign(const AssignExpr& expr, std::optional<std::uint8_t> dst) {
+    std::uint32_t mark = fs_->free_reg;
+    OpCode op = expr.op == TokenType::Assign ? OpCode::Count : binary_opcode(expr.op);
+
+    if (auto* member = dynamic_cast<const MemberExpr*>(expr.target.get())) {
+        std::uint8_t object = expr_any(*member->object, may_assign(*expr.value));
+        std::uint16_t name = constant(Value(member->member));
+        std::uint8_t value = alloc_reg();
+        if (op == OpCode::Count) {
+            expr_to(*expr.value, value);
+        } else {
+            std::uint16_t rhs = expr_rk(*expr.value);
+            emit(OpCode::GetMember, value, object, name, property_cache());
+            emit(op, value, value, rhs);
+        }
+        emit(OpCode::SetMember, value, object, name, property_cache());
+        if (dst) {
+            emit(OpCode::Move, *dst, value);
+        }
+        fs_->free_reg = mark;
+        return;
+    }
+
+    auto* id = dynamic_cast<const IdentifierExpr*>(expr.target.get());
+    if (!id) {
+        // Index assignment is not supported by the interpreter
+        throw Unsupported{};
+    }
+
+    VarRef ref = resolve(id->name);
+
+    if (ref.kind == VarKind::Register) {
+        auto reg = static_cast<std::uint8_t>(ref.index);
+        if (op == OpCode::Count) {
+            expr_to(*expr.value, reg);
+        } else {
+            emit(op, reg, reg, expr_rk(*expr.value));
+        }
+        if (dst && *dst != reg) {
+            emit(OpCode::Move, *dst, reg);
+        }
+        fs_->free_reg = mark;
+        return;
+    }
+
+    std::uint8_t value = alloc_reg();
+    if (op == OpCode::Count) {
+        expr_to(*expr.value, value);
+    } else {
+        // The right side runs before the variable is read, as in the interpreter
+        std::uint16_t rhs = expr_rk(*expr.value);
+        load_var(ref, id->name, value);
+        emit(op, value, value, rhs);
+    }
+    store_var(ref, id->name, value);
+    if (dst) {
+        emit(OpCode::Move, *dst, value);
+    }
+    fs_->free_reg = mark;
+}
+
+void Compiler::call(const Expression& callee, const std::vector<ExprPtr>& arguments, std::uint8_t dst) {
+    // Callee and arguments occupy a fresh window at the top of the frame;
+    // the callee's registers start at the first argument
+    std::uint8_t base = alloc_reg();
+
+    auto* member = dynamic_cast<const MemberExpr*>(&callee);
+    if (member && !member->optional) {
+        // obj.name(args): the receiver sits between callee and arguments
+        std::uint8_t receiver = alloc_reg();
+        expr_to(*member->object, receiver);
+        emit(OpCode::GetMethod, base, receiver, constant(Value(member->member)), property_cache());
+        for (const auto& arg : arguments) {
+            expr_to(*arg, alloc_reg());
+        }
+        emit(OpCode::CallMethod, base, static_cast<std::uint32_t>(arguments.size()));
+    } else {
+        expr_to(callee, base);
+        for (const auto& arg : arguments) {
+            expr_to(*arg, alloc_reg());
+        }
+        emit(OpCode::Call, base, static_cast<std::uint32_t>(arguments.size()));
+    }
+    if (dst != base) {
+        emit(OpCode::Move, dst, base);
+    }
+}
+
+void Compiler::lambda(const LambdaExpr& expr, std::uint8_t dst) {
+    std::vector<Param> params;
+    params.reserve(expr.parameters.size());
+    for (const auto& param : expr.parameters) {
+        params.push_back({&param.name, &param,
+                          param.default_value ? param.default_value->get() : nullptr});
+    }
+    fs_->chunk->functions.push_back(compile_function("<lambda>", params, *expr.body));
+    emit(OpCode::Closure, dst, static_cast<std::uint32_t>(fs_->chunk->functions.size() - 1));
+}
+
+bool Compiler::may_assign(const Expression& expr) {
+    if (dynamic_cast<const AssignExpr*>(&expr)) {
+        return true;
+    }
+    if (auto* un = dynamic_cast<const UnaryExpr*>(&expr)) {
+        if (un->op == TokenType::Increment || un->op == TokenType::Decrement) {
+            return true;
+        }
+        return may_assign(*un->operand);
+    }
+    if (auto* bin = dynamic_cast<const BinaryExpr*>(&expr)) {
+        return may_assign(*bin->left) || may_assign(*bin->right);
+    }
+    if (auto* call_expr = dynamic_cast<const CallExpr*>(&expr)) {
+        if (may_assign(*call_expr->callee)) return true;
+        for (const auto& arg : call_expr->arguments) {
+            if (may_assign(*arg)) return true;
+        }
+        return false;
+    }
+    if (auto* new_expr = dynamic_cast<const NewExpr*>(&expr)) {
+        if (may_assign(*new_expr->class_expr)) return true;
+        for (const auto& arg : new_expr->arguments) {
+            if (may_assign(*arg)) return true;
+        }
+        return false;
+    }
+    if (auto* mem = dynamic_cast<const MemberExpr*>(&expr)) {
+        return may_assign(*mem->object);
+    }
+    if (auto* idx = dynamic_cast<const IndexExpr*>(&expr)) {
+        return may_assign(*idx->object) || may_assign(*idx->index);
+    }
+    if (auto* ternary = dynamic_cast<const TernaryExpr*>(&expr)) {
+        return may_assign(*ternary->condition) || may_assign(*ternary->then_expr) ||
+               may_assign(*ternary->else_expr);
+    }
+    if (auto* arr = dynamic_cast<const ArrayExpr*>(&expr)) {
+        for (const auto& elem : arr->elements) {
+            if (may_assign(*elem)) return true;
+        }
+        return false;
+    }
+    if (auto* map = dynamic_cast<const MapExpr*>(&expr)) {
+        for (const auto& entry : map->entries) {
+            if (may_assign(*entry.key) || may_assign(*entry.value)) return true;
+        }
+        return false;
+    }
+    if (auto* range = dynamic_cast<const RangeExpr*>(&expr)) {
+        return may_assign(*range->start) || may_assign(*range->end);
+    }
+    if (auto* await_expr = dynamic_cast<const AwaitExpr*>(&expr)) {
+        return may_assign(*await_expr->operand);
+    }
+    if (auto* yield_expr = dynamic_cast<const YieldExpr*>(&expr)) {
+        return yield_expr->value && may_assign(*yield_expr->value);
+    }
+    // Literals, identifiers and lambdas (closures only reach locals through cells)
+    return false;
+}
+
+// =============================================================================
+// Variables
+// =============================================================================
+
+Compiler::Local* Compiler::find_local(FunctionState& fs, const std::string& name) {
+    for (auto it = fs.locals.rbegin(); it != fs.locals.rend(); ++it) {
+        if (it->name && *it->name == name) {
+            return &*it;
+        }
+    }
+    return nullptr;
+}
+
+Compiler::VarRef Compiler::resolve(const std::string& name) {
+    if (Local* local = find_local(*fs_, name)) {
+        if (local->cell >= 0) {
+            return {VarKind::Cell, static_cast<std::uint16_t>(local->cell)};
+        }
+        return {VarKind::Register, local->reg};
+    }
+    if (auto upvalue = resolve_upvalue(*fs_, name)) {
+        return {VarKind::Upvalue, *upvalue};
+    }
+    return {VarKind::Global, global(name)};
+}
+
+std::optional<std::uint16_t> Compiler::resolve_upvalue(FunctionState& fs, const std::string& name) {
+    if (!fs.parent) {
+        return std::nullopt;
+    }
+
+    UpvalueDesc desc;
+    if (Local* local = find_local(*fs.parent, name)) {
+        if (local->cell < 0) {
+            // Captured register local: recompile the owner with it in a cell
+            fs.parent->captured.insert(local->key);
+            fs.parent->recompile = true;
+        }
+        desc = {true, static_cast<std::uint16_t>(std::max(local->cell, 0))};
+    } else if (auto outer = resolve_upvalue(*fs.parent, name)) {
+        desc = {false, *outer};
+    } else {
+        return std::nullopt;
+    }
+
+    auto& upvalues = fs.chunk->upvalues;
+    for (std::size_t i = 0; i < upvalues.size(); ++i) {
+        if (upvalues[i].from_cell == desc.from_cell && upvalues[i].index == desc.index) {
+            return static_cast<std::uint16_t>(i);
+        }
+    }
+    if (upvalues.size() >= std::numeric_limits<std::uint16_t>::max()) {
+        throw Unsupported{};
+    }
+    upvalues.push_back(desc);
+    return static_cast<std::uint16_t>(upvalues.size() - 1);
+}
+
+void Compiler::load_var(const VarRef& ref, const std::string& name, std::uint8_t dst) {
+    switch (ref.kind) {
+        case VarKind::Register:
+            if (ref.index != dst) {
+                emit(OpCode::Move, dst, ref.index);
+            }
+            break;
+        case VarKind::Cell:
+            emit(OpCode::GetCell, dst, ref.index);
+            break;
+        case VarKind::Upvalue:
+            emit(OpCode::GetUpvalue, dst, ref.index);
+            break;
+        case VarKind::Global:
+            emit(OpCode::GetGlobal, dst, global(name));
+            break;
+    }
+}
+
+void Compiler::store_var(const VarRef& ref, const std::string& name, std::uint8_t src) {
+    switch (ref.kind) {
+        case VarKind::Register:
+            if (ref.index != src) {
+                emit(OpCode::Move, ref.index, src);
+            }
+            break;
+        case VarKind::Cell:
+            emit(OpCode::SetCell, src, ref.index);
+            break;
+        case VarKind::Upvalue:
+            emit(OpCode::SetUpvalue, src, ref.index);
+            break;
+        case VarKind::Global:
+            emit(OpCode::SetGlobal, src, global(name));
+            break;
+    }
+}
+
+std::uint8_t Compiler::declare_local(const std::string* name, const void* key, std::uint8_t value_reg) {
+    // value_reg is the most recently allocated register and holds the value
+    Local local;
+    local.name = name;
+    local.key = key;
+    local.depth = static_cast<std::uint32_t>(fs_->scopes.size());
+
+    if (fs_->captured.count(key)) {
+        local.cell = alloc_cell();
+        emit(OpCode::NewCell, value_reg, static_cast<std::uint32_t>(local.cell));
+        fs_->free_reg = value_reg;
+    } else {
+        local.reg = value_reg;
+        fs_->free_reg = value_reg + 1u;
+        fs_->local_top = fs_->free_reg;
+    }
+
+    fs_->locals.push_back(local);
+    return value_reg;
+}
+
+std::uint8_t Compiler::declare_hidden() {
+    std::uint8_t reg = alloc_reg();
+    Local local;
+    local.depth = static_cast<std::uint32_t>(fs_->scopes.size());
+    local.reg = reg;
+    fs_->locals.push_back(local);
+    fs_->local_top = fs_->free_reg;
+    return reg;
+}
+
+void Compiler::begin_scope() {
+    fs_->scopes.push_back({fs_->locals.size(), fs_->free_reg, fs_->local_top, fs_->free_cell});
+}
+
+void Compiler::end_scope() {
+    Scope scope = fs_->scopes.back();
+    fs_->scopes.pop_back();
+    fs_->locals.resize(scope.local_count);
+    fs_->free_reg = scope.free_reg;
+    fs_->local_top = scope.local_top;
+    fs_->free_cell = scope.free_cell;
+}
+
+// =============================================================================
+// Emission
+// =============================================================================
+
+std::size_t Compiler::emit(OpCode op, std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t d) {
+    auto& code = fs_->chunk->code;
+    if (code.size() >= std::numeric_limits<std::uint16_t>::max()) {
+        // Jump targets are 16-bit
+        throw Unsupported{};
+    }
+    code.push_back({op, static_cast<std::uint8_t>(a), static_cast<std::uint16_t>(b),
+                    static_cast<std::uint16_t>(c), static_cast<std::uint16_t>(d)});
+    return code.size() - 1;
+}
+
+void Compiler::patch(std::size_t at) {
+    fs_->chunk->code[at].b = static_cast<std::uint16_t>(here());
+}
+
+std::size_t Compiler::here() const {
+    return fs_->chunk->code.size();
+}
+
+std::uint8_t Compiler::alloc_reg() {
+    if (fs_->free_reg >= k_max_registers) {
+        throw Unsupported{};
+    }
+    std::uint32_t reg = fs_->free_reg++;
+    if (fs_->free_reg > fs_->chunk->register_count) {
+        fs_->chunk->register_count = fs_->free_reg;
+    }
+    return static_cast<std::uint8_t>(reg);
+}
+
+std::uint16_t Compiler::alloc_cell() {
+    if (fs_->free_cell >= std::numeric_limits<std::uint16_t>::max()) {
+        throw Unsupported{};
+    }
+    std::uint32_t cell = fs_->free_cell++;
+    if (fs_->free_cell > fs_->chunk->cell_count) {
+        fs_->chunk->cell_count = fs_->free_cell;
+    }
+    return static_cast<std::uint16_t>(cell);
+}
+
+std::uint16_t Compiler::constant(const Value& value) {
+    auto& constants = fs_->chunk->constants;
+
+    auto intern = [&](auto& table, const auto& key) -> std::uint16_t {
+        auto it = table.find(key);
+        if (it != table.end()) {
+            return it->second;
+        }
+        if (constants.size() >= k_max_constants) {
+            throw Unsupported{};
+        }
+        constants.push_back(value);
+        auto index = static_cast<std::uint16_t>(constants.size() - 1);
+        table.emplace(key, index);
+        return index;
+    };
+
+    if (value.is_int()) {
+        return intern(fs_->int_constants, value.as_int());
+    }
+    if (value.is_float()) {
+        return intern(fs_->float_constants, std::bit_cast<std::uint64_t>(value.as_float()));
+    }
+    if (value.is_string()) {
+        return intern(fs_->string_constants, value.as_string());
+    }
+    if (constants.size() >= k_max_constants) {
+        throw Unsupported{};
+    }
+    constants.push_back(value);
+    return static_cast<std::uint16_t>(constants.size() - 1);
+}
+
+std::uint16_t Compiler::global(const std::string& name) {
+    auto it = fs_->global_indices.find(name);
+    if (it != fs_->global_indices.end()) {
+        return it->second;
+    }
+    auto& globals = fs_->chunk->globals;
+    if (globals.size() >= std::numeric_limits<std::uint16_t>::max()) {
+        throw Unsupported{};
+    }
+    globals.push_back(name);
+    auto index = static_cast<std::uint16_t>(globals.size() - 1);
+    fs_->global_indices.emplace(name, index);
+    return index;
+}
+
+std::uint16_t Compiler::property_cache() {
+    auto& caches = fs_->chunk->property_caches;
+    if (caches.size() >= std::numeric_limits<std::uint16_t>::max()) {
+        throw Unsupported{};
+    }
+    caches.emplace_back();
+    return static_cast<std::uint16_t>(caches.size() - 1);
+}
+
+} // namespace void_script
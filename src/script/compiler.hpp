@@ -0,0 +1,146 @@
+#pragma once
+
+/// @file compiler.hpp
+/// @brief AST to register bytecode compiler for VoidScript
+
+#include "ast.hpp"
+#include "bytecode.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace void_script {
+
+// =============================================================================
+// Compiler
+// =============================================================================
+
+/// @brief Compiles VoidScript programs to register bytecode
+///
+/// Each top-level statement is compiled on its own. Statements that use
+/// constructs the bytecode does not cover (classes, this/super, try/catch,
+/// imports, index assignment) are emitted as Exec instructions and run by
+/// the tree-walking interpreter, so every program still executes.
+class Compiler {
+public:
+    /// @brief Compile a program into its top-level chunk
+    [[nodiscard]] static std::shared_ptr<Chunk> compile(const Program& program);
+
+private:
+    /// Thrown when a statement cannot be compiled
+    struct Unsupported {};
+
+    /// Function parameter description shared by declarations and lambdas
+    struct Param {
+        const std::string* name = nullptr;
+        const void* key = nullptr;
+        const Expression* default_value = nullptr;
+    };
+
+    struct Local {
+        const std::string* name = nullptr;  ///< nullptr for hidden locals
+        const void* key = nullptr;          ///< Declaring AST node
+        std::uint32_t depth = 0;
+        std::uint8_t reg = 0;
+        std::int32_t cell = -1;             ///< Cell index when captured by a closure
+    };
+
+    struct Scope {
+        std::size_t local_count = 0;
+        std::uint32_t free_reg = 0;
+        std::uint32_t local_top = 0;
+        std::uint32_t free_cell = 0;
+    };
+
+    struct LoopState {
+        std::vector<std::size_t> breaks;
+        std::vector<std::size_t> continues;
+    };
+
+    struct FunctionState {
+        FunctionState* parent = nullptr;
+        std::shared_ptr<Chunk> chunk;
+        std::vector<Local> locals;
+        std::vector<Scope> scopes;
+        std::vector<LoopState> loops;
+        std::unordered_set<const void*> captured;   ///< Locals that must live in cells
+        std::unordered_map<std::string, std::uint16_t> global_indices;
+        std::unordered_map<std::string, std::uint16_t> string_constants;
+        std::unordered_map<std::int64_t, std::uint16_t> int_constants;
+        std::unordered_map<std::uint64_t, std::uint16_t> float_constants;
+        std::uint32_t free_reg = 0;
+        std::uint32_t local_top = 0;        ///< Registers below this hold locals
+        std::uint32_t free_cell = 0;
+        bool top_level = false;
+        bool recompile = false;             ///< A closure captured a register local
+    };
+
+    enum class VarKind : std::uint8_t { Register, Cell, Upvalue, Global };
+
+    struct VarRef {
+        VarKind kind = VarKind::Global;
+        std::uint16_t index = 0;
+    };
+
+    // Functions
+    std::shared_ptr<Chunk> compile_program(const Program& program);
+    std::shared_ptr<Chunk> compile_function(const std::string& name, const std::vector<Param>& params,
+                                            const Statement& body);
+
+    // Statements
+    void statement(const Statement& stmt);
+    void block(const std::vector<StmtPtr>& statements);
+    void if_statement(const IfStatement& stmt);
+    void while_statement(const WhileStatement& stmt);
+    void for_statement(const ForStatement& stmt);
+    void foreach_statement(const ForEachStatement& stmt);
+    void match_statement(const MatchStatement& stmt);
+    void var_declaration(const VarDecl& decl);
+    void function_declaration(const FunctionDecl& decl);
+    void jump_out(bool is_break);
+
+    // Expressions
+    void expr_to(const Expression& expr, std::uint8_t dst);
+    void effect(const Expression& expr);
+    std::uint8_t expr_any(const Expression& expr, bool protect = false);
+    std::uint16_t expr_rk(const Expression& expr, bool protect = false);
+    void binary(const BinaryExpr& expr, std::uint8_t dst);
+    void logical(const BinaryExpr& expr, std::uint8_t dst);
+    void unary(const UnaryExpr& expr, std::uint8_t dst);
+    void step(const UnaryExpr& expr, std::optional<std::uint8_t> dst);
+    void assign(const AssignExpr& expr, std::optional<std::uint8_t> dst);
+    void call(const Expression& callee, const std::vector<ExprPtr>& arguments, std::uint8_t dst);
+    void lambda(const LambdaExpr& expr, std::uint8_t dst);
+    [[nodiscard]] static bool may_assign(const Expression& expr);
+
+    // Variables
+    [[nodiscard]] VarRef resolve(const std::string& name);
+    [[nodiscard]] std::optional<std::uint16_t> resolve_upvalue(FunctionState& fs, const std::string& name);
+    [[nodiscard]] static Local* find_local(FunctionState& fs, const std::string& name);
+    void load_var(const VarRef& ref, const std::string& name, std::uint8_t dst);
+    void store_var(const VarRef& ref, const std::string& name, std::uint8_t src);
+    std::uint8_t declare_local(const std::string* name, const void* key, std::uint8_t value_reg);
+    std::uint8_t declare_hidden();
+    void begin_scope();
+    void end_scope();
+
+    // Emission
+    std::size_t emit(OpCode op, std::uint32_t a = 0, std::uint32_t b = 0, std::uint32_t c = 0,
+                     std::uint32_t d = 0);
+    void patch(std::size_t at);
+    [[nodiscard]] std::size_t here() const;
+    std::uint8_t alloc_reg();
+    std::uint16_t alloc_cell();
+    std::uint16_t constant(const Value& value);
+    std::uint16_t global(const std::string& name);
+    std::uint16_t property_cache();
+
+    FunctionState* fs_ = nullptr;
+};
+
+} // namespace void_script
@@ -1,4 +1,5 @@
 #include "engine.hpp"
+#include "gc.hpp"
 
 #include <fstream>
 #include <sstream>
@@ -39,6 +40,7 @@ void ScriptEngine::initialize() {
     if (initialized_) return;
 
     global_interpreter_ = std::make_unique<Interpreter>();
+    global_interpreter_->set_collector(&gc_);
     register_engine_api();
 
     initialized_ = true;
@@ -56,6 +58,11 @@ void ScriptEngine::shutdown() {
 
     global_interpreter_.reset();
     bindings_.clear();
+    event_listeners_.clear();
+    once_listeners_.clear();
+
+    // Free cycles the released scripts left behind
+    gc_.collect();
 
     initialized_ = false;
 }
@@ -195,6 +202,7 @@ ScriptComponent* ScriptEngine::attach_script(std::uint64_t entity_id, ScriptId s
     ScriptComponent& comp = entity_components_[entity_id];
     comp.script_id = script_id;
     comp.context = std::make_unique<ScriptContext>();
+    comp.context->interpreter().set_collector(&gc_);
     comp.enabled = true;
     comp.auto_tick = true;
 
@@ -262,6 +270,13 @@ void ScriptEngine::update(float delta_time) {
             }
         }
     }
+
+    // None of this engine's scripts run between frames, so its cycles can be collected
+    gc_.step(gc_budget_ms_);
+}
+
+void ScriptEngine::collect_garbage() {
+    gc_.collect();
 }
 
 void ScriptEngine::register_binding(const std::string& name, const NativeBinding& binding) {
@@ -911,6 +926,18 @@ ScriptEngine::Stats ScriptEngine::stats() const {
     Stats s;
     s.loaded_scripts = scripts_.size();
     s.active_contexts = entity_components_.size();
+
+    auto gc = gc_.stats();
+    s.gc_young_objects = gc.young_objects;
+    s.gc_old_objects = gc.old_objects;
+    s.gc_young_collections = gc.young_collections;
+    s.gc_old_cycles = gc.old_cycles;
+    s.gc_freed_objects = gc.freed_objects;
+    s.gc_last_pause_ms = static_cast<float>(gc.last_pause_ms);
+
+    auto heap = ValueArena::instance().stats();
+    s.heap_reserved_bytes = heap.reserved_bytes;
+    s.heap_used_bytes = heap.used_bytes;
     return s;
 }
 
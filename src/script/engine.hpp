@@ -251,10 +251,31 @@ public:
         std::size_t active_contexts = 0;
         std::size_t total_executions = 0;
         float average_execution_time_ms = 0.0f;
+
+        // Garbage collector
+        std::size_t gc_young_objects = 0;
+        std::size_t gc_old_objects = 0;
+        std::uint64_t gc_young_collections = 0;
+        std::uint64_t gc_old_cycles = 0;
+        std::uint64_t gc_freed_objects = 0;
+        float gc_last_pause_ms = 0.0f;
+        std::size_t heap_reserved_bytes = 0;
+        std::size_t heap_used_bytes = 0;
     };
 
     [[nodiscard]] Stats stats() const;
 
+    // ==========================================================================
+    // Garbage Collection
+    // ==========================================================================
+
+    /// @brief Time update() may spend collecting script garbage per frame
+    void set_gc_budget_ms(float budget_ms) { gc_budget_ms_ = budget_ms; }
+    [[nodiscard]] float gc_budget_ms() const { return gc_budget_ms_; }
+
+    /// @brief Collect all unreachable script values now (e.g. after a level unload)
+    void collect_garbage();
+
     // ==========================================================================
     // Engine Integration Callbacks
     // ==========================================================================
@@ -346,6 +367,9 @@ public:
     }
 
 private:
+    // Declared first: script values may be released until the interpreters are gone
+    GarbageCollector gc_;
+
     std::unordered_map<ScriptId, std::unique_ptr<ScriptAsset>> scripts_;
     std::unordered_map<std::string, ScriptId> script_names_;
     std::unordered_map<std::uint64_t, ScriptComponent> entity_components_;
@@ -358,6 +382,7 @@ private:
     bool initialized_ = false;
     bool debug_mode_ = false;
     bool hot_reload_enabled_ = false;
+    float gc_budget_ms_ = 1.0f;
 
     inline static std::uint32_t next_script_id_ = 1;
     std::uint64_t next_entity_id_ = 1;
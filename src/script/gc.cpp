@@ -0,0 +1,395 @@
+#include "gc.hpp"
+#include "interpreter.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace void_script {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+/// Adapts a callable to the Tracer interface
+template <typename F>
+class FnTracer final : public Tracer {
+public:
+    explicit FnTracer(F fn) : fn_(std::move(fn)) {}
+    void visit_heap(const void* heap) override { fn_(heap); }
+
+private:
+    F fn_;
+};
+
+template <typename F>
+FnTracer<F> make_tracer(F fn) {
+    return FnTracer<F>(std::move(fn));
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// ValueArena Implementation
+// =============================================================================
+
+ValueArena& ValueArena::instance() {
+    // Never destroyed: values in static storage may outlive any other static
+    static auto* arena = new ValueArena();
+    return *arena;
+}
+
+void* ValueArena::allocate(std::size_t size) {
+    if (size > k_max_block) {
+        return ::operator new(size);
+    }
+
+    const std::size_t size_class = size == 0 ? 0 : (size - 1) / k_granule;
+    const std::size_t block = (size_class + 1) * k_granule;
+
+    std::lock_guard lock(mutex_);
+    used_bytes_ += block;
+
+    if (FreeBlock* free = free_lists_[size_class]) {
+        free_lists_[size_class] = free->next;
+        return free;
+    }
+
+    if (static_cast<std::size_t>(bump_end_ - bump_) < block) {
+        // The tail of the previous chunk is abandoned
+        chunks_.push_back(std::unique_ptr<std::byte[]>(new std::byte[k_chunk_size]));
+        bump_ = chunks_.back().get();
+        bump_end_ = bump_ + k_chunk_size;
+    }
+
+    void* ptr = bump_;
+    bump_ += block;
+    return ptr;
+}
+
+void ValueArena::deallocate(void* ptr, std::size_t size) noexcept {
+    if (size > k_max_block) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    const std::size_t size_class = size == 0 ? 0 : (size - 1) / k_granule;
+
+    std::lock_guard lock(mutex_);
+    used_bytes_ -= (size_class + 1) * k_granule;
+    auto* block = static_cast<FreeBlock*>(ptr);
+    block->next = free_lists_[size_class];
+    free_lists_[size_class] = block;
+}
+
+ValueArena::Stats ValueArena::stats() const {
+    std::lock_guard lock(mutex_);
+    Stats s;
+    s.reserved_bytes = chunks_.size() * k_chunk_size;
+    s.used_bytes = used_bytes_;
+    return s;
+}
+
+ValuePtr make_cell(Value value) {
+    auto cell = std::allocate_shared<Value>(ArenaAllocator<Value>{}, std::move(value));
+    GarbageCollector::current().track(cell, HeapKind::Cell);
+    return cell;
+}
+
+// =============================================================================
+// GarbageCollector Implementation
+// =============================================================================
+
+GarbageCollector& GarbageCollector::current() {
+    if (active_) {
+        return *active_;
+    }
+    // Never destroyed, like the arena its entries point into
+    static auto* fallback = new GarbageCollector();
+    return *fallback;
+}
+
+void GarbageCollector::track(const std::shared_ptr<void>& heap, HeapKind kind) {
+    std::lock_guard lock(mutex_);
+    young_.push_back({heap, heap.get(), kind});
+
+    if (young_.size() >= young_prune_at_) {
+        // Dropping entries of already freed values is safe at any time and
+        // releases the memory their weak references keep allocated
+        prune(young_);
+        young_prune_at_ = std::max(2 * k_young_threshold, 2 * young_.size());
+    }
+}
+
+void GarbageCollector::step(double budget_ms) {
+    const auto start = Clock::now();
+
+    bool young_due = false;
+    {
+        std::lock_guard lock(mutex_);
+        young_due = young_.size() >= k_young_threshold;
+
+        if (pass_.empty() && old_.size() >= std::max(k_old_min, 2 * old_live_)) {
+            // Start a pass over everything promoted so far
+            pass_ = std::move(old_);
+            old_.clear();
+            pass_index_.clear();
+            pass_index_.reserve(pass_.size());
+            for (std::uint32_t i = 0; i < pass_.size(); ++i) {
+                pass_index_.emplace(pass_[i].ptr, i);
+            }
+            pass_done_.assign(pass_.size(), false);
+            pass_cursor_ = 0;
+        }
+    }
+
+    if (young_due) {
+        collect_young();
+    }
+    while (!pass_.empty() && elapsed_ms(start) < budget_ms) {
+        if (!collect_increment()) break;
+    }
+
+    const double pause = elapsed_ms(start);
+    std::lock_guard lock(mutex_);
+    stats_.last_pause_ms = pause;
+    stats_.total_pause_ms += pause;
+}
+
+void GarbageCollector::collect() {
+    const auto start = Clock::now();
+
+    std::vector<Entry> all;
+    {
+        std::lock_guard lock(mutex_);
+        all = std::move(pass_);
+        all.insert(all.end(), std::make_move_iterator(old_.begin()), std::make_move_iterator(old_.end()));
+        all.insert(all.end(), std::make_move_iterator(young_.begin()), std::make_move_iterator(young_.end()));
+        pass_.clear();
+        pass_index_.clear();
+        pass_done_.clear();
+        old_.clear();
+        young_.clear();
+        young_prune_at_ = 2 * k_young_threshold;
+    }
+
+    std::vector<Entry> survivors = collect_set(std::move(all));
+
+    const double pause = elapsed_ms(start);
+    std::lock_guard lock(mutex_);
+    old_.insert(old_.end(), std::make_move_iterator(survivors.begin()), std::make_move_iterator(survivors.end()));
+    old_live_ = old_.size();
+    ++stats_.young_collections;
+    ++stats_.old_cycles;
+    stats_.last_pause_ms = pause;
+    stats_.total_pause_ms += pause;
+}
+
+GarbageCollector::Stats GarbageCollector::stats() const {
+    std::lock_guard lock(mutex_);
+    Stats s = stats_;
+    s.young_objects = young_.size();
+    s.old_objects = old_.size() + pass_.size();
+    return s;
+}
+
+void GarbageCollector::collect_young() {
+    std::vector<Entry> young;
+    {
+        std::lock_guard lock(mutex_);
+        young.swap(young_);
+        young_prune_at_ = 2 * k_young_threshold;
+    }
+
+    std::vector<Entry> survivors = collect_set(std::move(young));
+
+    std::lock_guard lock(mutex_);
+    old_.insert(old_.end(), std::make_move_iterator(survivors.begin()), std::make_move_iterator(survivors.end()));
+    ++stats_.young_collections;
+}
+
+bool GarbageCollector::collect_increment() {
+    while (pass_cursor_ < pass_.size() && pass_done_[pass_cursor_]) {
+        ++pass_cursor_;
+    }
+
+    if (pass_cursor_ == pass_.size()) {
+        // Pass complete: survivors return to the old generation
+        prune(pass_);
+        std::lock_guard lock(mutex_);
+        old_.insert(old_.end(), std::make_move_iterator(pass_.begin()), std::make_move_iterator(pass_.end()));
+        old_live_ = old_.size();
+        pass_.clear();
+        pass_index_.clear();
+        pass_done_.clear();
+        ++stats_.old_cycles;
+        return false;
+    }
+
+    // Seed with the next batch and pull in what it reaches, so cycles
+    // through the batch are collected whole
+    std::vector<std::uint32_t> members;
+    for (std::size_t i = pass_cursor_; i < pass_.size() && members.size() < k_increment_seeds; ++i) {
+        if (!pass_done_[i]) {
+            pass_done_[i] = true;
+            members.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    auto expand = make_tracer([&](const void* heap) {
+        if (members.size() >= k_increment_limit) return;
+        auto it = pass_index_.find(heap);
+        if (it != pass_index_.end() && !pass_done_[it->second]) {
+            pass_done_[it->second] = true;
+            members.push_back(it->second);
+        }
+    });
+    for (std::size_t i = 0; i < members.size(); ++i) {
+        const Entry& entry = pass_[members[i]];
+        if (!entry.ref.expired()) {
+            trace(entry.kind, entry.ptr, expand);
+        }
+    }
+
+    std::vector<Entry> set;
+    set.reserve(members.size());
+    for (std::uint32_t index : members) {
+        set.push_back(pass_[index]);
+    }
+    (void)collect_set(std::move(set));
+
+    std::lock_guard lock(mutex_);
+    ++stats_.old_increments;
+    return true;
+}
+
+std::vector<GarbageCollector::Entry> GarbageCollector::collect_set(std::vector<Entry> entries) {
+    const std::size_t count = entries.size();
+
+    // Reference counts, minus the references the set holds on itself
+    std::unordered_map<const void*, std::uint32_t> index;
+    index.reserve(count);
+    std::vector<long> refs(count, 0);
+    std::vector<bool> live(count, false);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        refs[i] = entries[i].ref.use_count();
+        if (refs[i] > 0) {
+            live[i] = true;
+            index.emplace(entries[i].ptr, i);
+        }
+    }
+
+    auto subtract = make_tracer([&](const void* heap) {
+        auto it = index.find(heap);
+        if (it != index.end()) --refs[it->second];
+    });
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (live[i]) trace(entries[i].kind, entries[i].ptr, subtract);
+    }
+
+    // Values still referenced from outside are roots; mark what they reach
+    std::vector<bool> reachable(count, false);
+    std::vector<std::uint32_t> stack;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (refs[i] > 0) {
+            reachable[i] = true;
+            stack.push_back(i);
+        }
+    }
+
+    auto mark = make_tracer([&](const void* heap) {
+        auto it = index.find(heap);
+        if (it != index.end() && !reachable[it->second]) {
+            reachable[it->second] = true;
+            stack.push_back(it->second);
+        }
+    });
+    while (!stack.empty()) {
+        std::uint32_t i = stack.back();
+        stack.pop_back();
+        trace(entries[i].kind, entries[i].ptr, mark);
+    }
+
+    // Everything else is only kept alive by dead cycles. Hold the values
+    // while clearing so none is destroyed mid-way
+    std::vector<std::pair<std::shared_ptr<void>, HeapKind>> dead;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (live[i] && !reachable[i]) {
+            if (auto strong = entries[i].ref.lock()) {
+                dead.emplace_back(std::move(strong), entries[i].kind);
+            }
+        }
+    }
+    for (auto& [heap, kind] : dead) {
+        clear(kind, heap.get());
+    }
+
+    std::vector<Entry> survivors;
+    survivors.reserve(count - dead.size());
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (reachable[i]) survivors.push_back(std::move(entries[i]));
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        stats_.freed_objects += dead.size();
+    }
+    dead.clear();
+
+    // Clearing may have freed survivors that were only reachable from garbage
+    prune(survivors);
+    return survivors;
+}
+
+void GarbageCollector::trace(HeapKind kind, const void* heap, Tracer& tracer) {
+    switch (kind) {
+        case HeapKind::Array:
+            for (const auto& value : *static_cast<const ValueArray*>(heap)) {
+                tracer.visit(value);
+            }
+            break;
+        case HeapKind::Map:
+            for (const auto& [key, value] : *static_cast<const ValueMap*>(heap)) {
+                tracer.visit(value);
+            }
+            break;
+        case HeapKind::Object:
+            static_cast<const Object*>(heap)->trace(tracer);
+            break;
+        case HeapKind::Cell:
+            tracer.visit(*static_cast<const Value*>(heap));
+            break;
+        case HeapKind::Environment:
+            static_cast<const Environment*>(heap)->trace(tracer);
+            break;
+    }
+}
+
+void GarbageCollector::clear(HeapKind kind, void* heap) {
+    switch (kind) {
+        case HeapKind::Array:
+            static_cast<ValueArray*>(heap)->clear();
+            break;
+        case HeapKind::Map:
+            static_cast<ValueMap*>(heap)->clear();
+            break;
+        case HeapKind::Object:
+            static_cast<Object*>(heap)->clear_references();
+            break;
+        case HeapKind::Cell:
+            *static_cast<Value*>(heap) = Value(nullptr);
+            break;
+        case HeapKind::Environment:
+            static_cast<Environment*>(heap)->clear();
+            break;
+    }
+}
+
+void GarbageCollector::prune(std::vector<Entry>& entries) {
+    std::erase_if(entries, [](const Entry& entry) { return entry.ref.expired(); });
+}
+
+} // namespace void_script
@@ -0,0 +1,217 @@
+#pragma once
+
+/// @file gc.hpp
+/// @brief Heap arena and cycle collector for VoidScript values
+
+#include "types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace void_script {
+
+// =============================================================================
+// Value Arena
+// =============================================================================
+
+/// @brief Size-class arena for small script heap blocks
+///
+/// Arrays, maps and closure cells are allocated together with their
+/// reference count block from here. Fresh blocks are bump-allocated from
+/// 64 KiB chunks; freed blocks go to a per-size free list and are reused
+/// first. Requests above k_max_block use the global allocator.
+class ValueArena {
+public:
+    struct Stats {
+        std::size_t reserved_bytes = 0;     ///< Chunk memory owned by the arena
+        std::size_t used_bytes = 0;         ///< Bytes in live blocks
+    };
+
+    [[nodiscard]] static ValueArena& instance();
+
+    [[nodiscard]] void* allocate(std::size_t size);
+    void deallocate(void* ptr, std::size_t size) noexcept;
+
+    [[nodiscard]] Stats stats() const;
+
+private:
+    ValueArena() = default;
+
+    static constexpr std::size_t k_granule = 16;
+    static constexpr std::size_t k_max_block = 256;
+    static constexpr std::size_t k_chunk_size = 64 * 1024;
+    static constexpr std::size_t k_class_count = k_max_block / k_granule;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+    std::byte* bump_ = nullptr;
+    std::byte* bump_end_ = nullptr;
+    std::array<FreeBlock*, k_class_count> free_lists_{};
+    std::size_t used_bytes_ = 0;
+};
+
+/// @brief Standard allocator over the value arena
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() = default;
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        return static_cast<T*>(ValueArena::instance().allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        ValueArena::instance().deallocate(ptr, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>&) const noexcept { return true; }
+};
+
+/// @brief Allocate a tracked closure cell holding value
+[[nodiscard]] ValuePtr make_cell(Value value);
+
+// =============================================================================
+// Garbage Collector
+// =============================================================================
+
+/// @brief Kind of tracked heap payload
+enum class HeapKind : std::uint8_t {
+    Array,
+    Map,
+    Object,
+    Cell,
+    Environment,        ///< Scope captured by a tree-walker closure
+};
+
+/// @brief Generational cycle collector for script values
+///
+/// Script values stay reference counted; the collector only reclaims
+/// reference cycles, which counting alone never frees (closures capturing
+/// themselves, objects pointing at each other, containers holding
+/// themselves).
+///
+/// Every array, map, object and closure cell is registered when created.
+/// A collection over a set of tracked values subtracts the references the
+/// set holds on itself from each value's reference count; values with
+/// references left over are held from outside the set (environments,
+/// registers, host code) and are roots. Values the roots cannot reach are
+/// dead cycles and have their contents cleared, which frees them. Because
+/// roots are derived from reference counts, any set may be collected on its
+/// own and untraced owners only make the collector more conservative.
+///
+/// New values start in the young generation, which is collected as a whole
+/// once it grows past a threshold. Survivors are promoted to the old
+/// generation, which is collected incrementally: each increment takes a
+/// batch of old values plus what they reach and collects that set, and
+/// step() runs increments until its time budget is spent.
+///
+/// Each ScriptEngine owns a collector and steps it from update(). New values
+/// register with the collector made current on the creating thread by a
+/// Scope (interpreters open one for their collector), or with a process-wide
+/// fallback outside any. A collection must run while no script using that
+/// collector is executing; registration is safe at any time.
+class GarbageCollector {
+public:
+    struct Stats {
+        std::size_t young_objects = 0;
+        std::size_t old_objects = 0;
+        std::uint64_t young_collections = 0;
+        std::uint64_t old_increments = 0;
+        std::uint64_t old_cycles = 0;            ///< Completed passes over the old generation
+        std::uint64_t freed_objects = 0;         ///< Values reclaimed from dead cycles
+        double last_pause_ms = 0.0;
+        double total_pause_ms = 0.0;
+    };
+
+    /// @brief Makes a collector current on this thread for the scope's lifetime
+    class Scope {
+    public:
+        /// A null collector keeps the current one
+        explicit Scope(GarbageCollector* collector) : previous_(active_) {
+            if (collector) active_ = collector;
+        }
+        ~Scope() { active_ = previous_; }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        GarbageCollector* previous_;
+    };
+
+    GarbageCollector() = default;
+    GarbageCollector(const GarbageCollector&) = delete;
+    GarbageCollector& operator=(const GarbageCollector&) = delete;
+
+    /// @brief Collector new values on this thread register with
+    [[nodiscard]] static GarbageCollector& current();
+
+    /// @brief Register a new heap payload
+    void track(const std::shared_ptr<void>& heap, HeapKind kind);
+
+    /// @brief Run young and incremental old collection for up to budget_ms
+    void step(double budget_ms);
+
+    /// @brief Collect both generations completely
+    void collect();
+
+    [[nodiscard]] Stats stats() const;
+
+private:
+    struct Entry {
+        std::weak_ptr<void> ref;
+        const void* ptr = nullptr;
+        HeapKind kind = HeapKind::Array;
+    };
+
+    /// Young size that triggers a collection from step()
+    static constexpr std::size_t k_young_threshold = 4096;
+    /// Old generation size below which no old pass is started
+    static constexpr std::size_t k_old_min = 16384;
+    /// Seeds and maximum set size of one old increment
+    static constexpr std::size_t k_increment_seeds = 256;
+    static constexpr std::size_t k_increment_limit = 8192;
+
+    void collect_young();
+    bool collect_increment();
+
+    /// Collect the given entries; returns survivors in the same order
+    std::vector<Entry> collect_set(std::vector<Entry> entries);
+
+    static void trace(HeapKind kind, const void* heap, Tracer& tracer);
+    static void clear(HeapKind kind, void* heap);
+    static void prune(std::vector<Entry>& entries);
+
+    static inline thread_local GarbageCollector* active_ = nullptr;
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> young_;
+    std::vector<Entry> old_;
+    std::size_t young_prune_at_ = 2 * k_young_threshold;
+
+    // Incremental old pass over a snapshot of the old generation
+    std::vector<Entry> pass_;
+    std::unordered_map<const void*, std::uint32_t> pass_index_;
+    std::vector<bool> pass_done_;
+    std::size_t pass_cursor_ = 0;
+    std::size_t old_live_ = 0;          ///< Old generation size after the last pass
+
+    Stats stats_;
+};
+
+} // namespace void_script
@@ -1,6 +1,9 @@
 #include "interpreter.hpp"
+#include "compiler.hpp"
 #include "parser.hpp"
 
+#include <void_engine/core/log.hpp>
+
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -17,8 +20,8 @@ namespace void_script {
 // Environment Implementation
 // =============================================================================
 
-Environment::Environment(Environment* enclosing)
-    : enclosing_(enclosing) {}
+Environment::Environment(std::shared_ptr<Environment> enclosing)
+    : enclosing_(std::move(enclosing)) {}
 
 void Environment::define(const std::string& name, Value value) {
     variables_[name] = std::move(value);
@@ -54,15 +57,49 @@ bool Environment::contains(const std::string& name) const {
     return false;
 }
 
+Value* Environment::find(const std::string& name) {
+    auto it = variables_.find(name);
+    return it != variables_.end() ? &it->second : nullptr;
+}
+
+std::shared_ptr<Environment> Environment::capture() {
+    // Only captured scopes can be part of a closure cycle
+    for (Environment* env = this; env && !env->gc_tracked_; env = env->enclosing()) {
+        env->gc_tracked_ = true;
+        GarbageCollector::current().track(env->shared_from_this(), HeapKind::Environment);
+    }
+    return shared_from_this();
+}
+
+void Environment::trace(Tracer& tracer) const {
+    for (const auto& [name, value] : variables_) {
+        tracer.visit(value);
+    }
+    if (enclosing_) {
+        tracer.visit_heap(enclosing_.get());
+    }
+}
+
+void Environment::clear() {
+    variables_.clear();
+    enclosing_.reset();
+}
+
 // =============================================================================
 // ScriptFunction Implementation
 // =============================================================================
 
-ScriptFunction::ScriptFunction(const FunctionDecl* decl, Environment* closure, bool is_method)
-    : declaration_(decl), closure_(closure), is_method_(is_method) {}
+ScriptFunction::ScriptFunction(const FunctionDecl* decl, std::shared_ptr<Environment> closure, bool is_method)
+    : declaration_(decl), closure_(std::move(closure)), is_method_(is_method) {}
 
 std::size_t ScriptFunction::arity() const {
-    return declaration_->parameters.size();
+    // Parameters from the first default onwards are optional
+    std::size_t required = 0;
+    for (const auto& param : declaration_->parameters) {
+        if (param.default_value) break;
+        ++required;
+    }
+    return required;
 }
 
 std::string ScriptFunction::name() const {
@@ -74,7 +111,13 @@ std::string ScriptFunction::to_string() const {
 }
 
 Value ScriptFunction::call(Interpreter& interp, const std::vector<Value>& args) {
-    Environment env(closure_);
+    return call_bound(interp, bound_instance_, args);
+}
+
+Value ScriptFunction::call_bound(Interpreter& interp, const std::shared_ptr<ClassInstance>& instance,
+                                 const std::vector<Value>& args) {
+    GarbageCollector::Scope gc_scope(interp.collector());
+    auto env = std::make_shared<Environment>(closure_);
 
     // Bind parameters
     for (std::size_t i = 0; i < declaration_->parameters.size(); ++i) {
@@ -87,18 +130,21 @@ Value ScriptFunction::call(Interpreter& interp, const std::vector<Value>& args)
             value = interp.evaluate(*param.default_value);
         }
 
-        env.define(param.name, std::move(value));
+        env->define(param.name, std::move(value));
     }
 
     // Bind 'this' for methods
-    if (bound_instance_) {
-        env.define("this", Value::make_object(bound_instance_));
+    if (instance) {
+        env->define("this", Value::make_object(instance));
     }
 
     try {
-        interp.execute_block(
-            static_cast<const BlockStatement*>(declaration_->body.get())->statements,
-            &env);
+        if (auto* block = dynamic_cast<const BlockStatement*>(declaration_->body.get())) {
+            interp.execute_block(block->statements, env.get());
+        } else {
+            // Expression-bodied lambdas ('=> expr') have a bare return statement
+            interp.execute_in(*declaration_->body, env.get());
+        }
     } catch (const ReturnException& ret) {
         return ret.value;
     }
@@ -106,6 +152,22 @@ Value ScriptFunction::call(Interpreter& interp, const std::vector<Value>& args)
     return Value(nullptr);
 }
 
+void ScriptFunction::trace(Tracer& tracer) const {
+    Callable::trace(tracer);
+    if (bound_instance_) {
+        tracer.visit_heap(static_cast<const Object*>(bound_instance_.get()));
+    }
+    if (closure_) {
+        tracer.visit_heap(closure_.get());
+    }
+}
+
+void ScriptFunction::clear_references() {
+    Callable::clear_references();
+    bound_instance_.reset();
+    closure_.reset();
+}
+
 std::shared_ptr<ScriptFunction> ScriptFunction::bind(std::shared_ptr<ClassInstance> instance) {
     auto bound = std::make_shared<ScriptFunction>(declaration_, closure_, true);
     bound->bound_instance_ = std::move(instance);
@@ -117,7 +179,8 @@ std::shared_ptr<ScriptFunction> ScriptFunction::bind(std::shared_ptr<ClassInstan
 // =============================================================================
 
 ScriptClass::ScriptClass(const ClassDecl* decl, std::shared_ptr<ScriptClass> superclass)
-    : name_(decl->name), declaration_(decl), superclass_(std::move(superclass)) {}
+    : name_(decl->name), declaration_(decl), superclass_(std::move(superclass)),
+      instance_shape_(Shape::make_root()) {}
 
 std::size_t ScriptClass::arity() const {
     auto init = find_method("init");
@@ -161,20 +224,52 @@ std::shared_ptr<ScriptFunction> ScriptClass::find_method(const std::string& name
 }
 
 void ScriptClass::add_method(const std::string& name, std::shared_ptr<ScriptFunction> method) {
+    // Methods are traced as separate values, so they must be tracked too
+    Value::track_object(method);
     methods_[name] = std::move(method);
 }
 
+void ScriptClass::trace(Tracer& tracer) const {
+    Callable::trace(tracer);
+    if (superclass_) {
+        tracer.visit_heap(static_cast<const Object*>(superclass_.get()));
+    }
+    for (const auto& [name, method] : methods_) {
+        tracer.visit_heap(static_cast<const Object*>(method.get()));
+    }
+}
+
+void ScriptClass::clear_references() {
+    Callable::clear_references();
+    superclass_.reset();
+    methods_.clear();
+}
+
 // =============================================================================
 // ClassInstance Implementation
 // =============================================================================
 
 ClassInstance::ClassInstance(std::shared_ptr<ScriptClass> klass)
-    : class_(std::move(klass)) {}
+    : class_(std::move(klass)) {
+    // A per-class root keeps shape -> class unique, so cached method
+    // lookups keyed on shape stay valid
+    shape_ = class_->instance_shape();
+}
 
 std::string ClassInstance::to_string() const {
     return "<" + class_->name() + " instance>";
 }
 
+void ClassInstance::trace(Tracer& tracer) const {
+    Object::trace(tracer);
+    tracer.visit_heap(static_cast<const Object*>(class_.get()));
+}
+
+void ClassInstance::clear_references() {
+    Object::clear_references();
+    class_.reset();
+}
+
 bool ClassInstance::has_property(const std::string& name) const {
     if (Object::has_property(name)) return true;
     return class_->find_method(name) != nullptr;
@@ -205,15 +300,37 @@ void ClassInstance::set_property(const std::string& name, Value value) {
 // =============================================================================
 
 Interpreter::Interpreter() {
-    globals_ = std::make_unique<Environment>();
+    globals_ = std::make_shared<Environment>();
     current_env_ = globals_.get();
+    vm_ = std::make_unique<VirtualMachine>(*this);
     register_stdlib();
 }
 
-Interpreter::~Interpreter() = default;
+Interpreter::~Interpreter() {
+    // Functions stored in the global or a module scope own that scope
+    globals_->clear();
+    for (auto& [path, module_env] : modules_) {
+        module_env->clear();
+    }
+
+    // Lambda declarations borrow their body from the LambdaExpr
+    for (auto& decl : lambda_storage_) {
+        (void)decl->body.release();
+    }
+}
 
 Value Interpreter::execute(const Program& program) {
+    GarbageCollector::Scope gc_scope(collector_);
     start_time_ = std::chrono::steady_clock::now();
+
+    if (bytecode_enabled_) {
+        auto chunk = Compiler::compile(program);
+        if (debug_mode_) {
+            VOID_LOG_DEBUG("[Script] bytecode:\n{}", chunk->disassemble());
+        }
+        return vm_->run(std::move(chunk), *current_env_);
+    }
+
     Value result;
 
     for (const auto& stmt : program.statements) {
@@ -227,7 +344,8 @@ Value Interpreter::execute(const Statement& stmt) {
     check_timeout();
 
     if (auto* expr_stmt = dynamic_cast<const ExprStatement*>(&stmt)) {
-        visit(*expr_stmt);
+        // An expression statement yields its value (the result of a program)
+        return evaluate(*expr_stmt->expression);
     } else if (auto* block = dynamic_cast<const BlockStatement*>(&stmt)) {
         visit(*block);
     } else if (auto* if_stmt = dynamic_cast<const IfStatement*>(&stmt)) {
@@ -337,7 +455,7 @@ Value Interpreter::run_file(const std::string& path) {
 }
 
 void Interpreter::push_scope() {
-    auto env = std::make_unique<Environment>(current_env_);
+    auto env = std::make_shared<Environment>(current_env_->shared_from_this());
     current_env_ = env.get();
     scopes_.push_back(std::move(env));
 }
@@ -349,6 +467,22 @@ void Interpreter::pop_scope() {
     }
 }
 
+Value Interpreter::execute_in(const Statement& stmt, Environment* env) {
+    Environment* previous = current_env_;
+    current_env_ = env;
+
+    Value result;
+    try {
+        result = execute(stmt);
+    } catch (...) {
+        current_env_ = previous;
+        throw;
+    }
+
+    current_env_ = previous;
+    return result;
+}
+
 Value Interpreter::execute_block(const std::vector<StmtPtr>& statements, Environment* env) {
     Environment* previous = current_env_;
     current_env_ = env;
@@ -1531,8 +1665,11 @@ Value Interpreter::visit(const BinaryExpr& expr) {
     }
 
     Value right = evaluate(*expr.right);
+    return binary_op(expr.op, left, right);
+}
 
-    switch (expr.op) {
+Value Interpreter::binary_op(TokenType op, const Value& left, const Value& right) {
+    switch (op) {
         // Arithmetic
         case TokenType::Plus:
             if (left.is_string() || right.is_string()) {
@@ -1673,21 +1810,58 @@ Value Interpreter::visit(const MemberExpr& expr) {
         return Value(nullptr);
     }
 
+    return get_member(object, expr.member);
+}
+
+Value Interpreter::get_member(const Value& object, const std::string& name) {
     if (object.is_map()) {
-        auto& map = object.as_map();
-        auto it = map.find(expr.member);
+        const auto& map = object.as_map();
+        auto it = map.find(name);
         if (it != map.end()) {
             return it->second;
         }
         return Value(nullptr);
     }
 
-    Object* obj = object.as_object();
+    const Object* obj = object.as_object();
     if (!obj) {
         throw ScriptException(ScriptError::NullReference, "Cannot access property of null");
     }
 
-    return obj->get_property(expr.member);
+    return obj->get_property(name);
+}
+
+void Interpreter::set_member(Value& object, const std::string& name, Value value) {
+    if (object.is_map()) {
+        object.as_map()[name] = std::move(value);
+        return;
+    }
+
+    Object* obj = object.as_object();
+    if (!obj) {
+        if (object.is_null()) {
+            throw ScriptException(ScriptError::NullReference, "Cannot set property of null");
+        }
+        throw ScriptException(ScriptError::TypeError, "Cannot set property on " + object.type_name());
+    }
+
+    obj->set_property(name, std::move(value));
+}
+
+TokenType Interpreter::compound_operator(TokenType op) {
+    switch (op) {
+        case TokenType::PlusAssign: return TokenType::Plus;
+        case TokenType::MinusAssign: return TokenType::Minus;
+        case TokenType::StarAssign: return TokenType::Star;
+        case TokenType::SlashAssign: return TokenType::Slash;
+        case TokenType::PercentAssign: return TokenType::Percent;
+        case TokenType::AmpersandAssign: return TokenType::Ampersand;
+        case TokenType::PipeAssign: return TokenType::Pipe;
+        case TokenType::CaretAssign: return TokenType::Caret;
+        case TokenType::ShiftLeftAssign: return TokenType::ShiftLeft;
+        case TokenType::ShiftRightAssign: return TokenType::ShiftRight;
+        default: return TokenType::Error;
+    }
 }
 
 Value Interpreter::visit(const IndexExpr& expr) {
@@ -1729,26 +1903,25 @@ Value Interpreter::visit(const IndexExpr& expr) {
 }
 
 Value Interpreter::visit(const AssignExpr& expr) {
+    if (auto* member = dynamic_cast<const MemberExpr*>(expr.target.get())) {
+        Value object = evaluate(*member->object);
+        Value value = evaluate(*expr.value);
+        TokenType op = compound_operator(expr.op);
+        if (op != TokenType::Error) {
+            value = binary_op(op, get_member(object, member->member), value);
+        }
+        set_member(object, member->member, value);
+        return value;
+    }
+
     Value value = evaluate(*expr.value);
 
     if (auto* id = dynamic_cast<const IdentifierExpr*>(expr.target.get())) {
         if (expr.op != TokenType::Assign) {
-            Value current = current_env_->get(id->name);
-            switch (expr.op) {
-                case TokenType::PlusAssign:
-                    value = Value(current.as_number() + value.as_number());
-                    break;
-                case TokenType::MinusAssign:
-                    value = Value(current.as_number() - value.as_number());
-                    break;
-                case TokenType::StarAssign:
-                    value = Value(current.as_number() * value.as_number());
-                    break;
-                case TokenType::SlashAssign:
-                    value = Value(current.as_number() / value.as_number());
-                    break;
-                default:
-                    break;
+            // Compound assignment applies the matching binary operator
+            TokenType op = compound_operator(expr.op);
+            if (op != TokenType::Error) {
+                value = binary_op(op, current_env_->get(id->name), value);
             }
         }
         current_env_->assign(id->name, value);
@@ -1789,6 +1962,10 @@ Value Interpreter::visit(const MapExpr& expr) {
 }
 
 Value Interpreter::visit(const ThisExpr& expr) {
+    // Bound methods define 'this' in their call environment
+    if (current_env_->contains("this")) {
+        return current_env_->get("this");
+    }
     if (!current_instance_) {
         throw ScriptException(ScriptError::InvalidOperation, "'this' used outside of method");
     }
@@ -1917,7 +2094,7 @@ void Interpreter::visit(const VarDecl& decl) {
 }
 
 void Interpreter::visit(const FunctionDecl& decl) {
-    auto function = std::make_shared<ScriptFunction>(&decl, current_env_);
+    auto function = std::make_shared<ScriptFunction>(&decl, current_env_->capture());
     current_env_->define(decl.name, Value::make_function(function));
 }
 
@@ -1940,7 +2117,7 @@ void Interpreter::visit(const ClassDecl& decl) {
 
     // Add methods
     for (const auto& method : decl.methods) {
-        auto func = std::make_shared<ScriptFunction>(method.func.get(), current_env_, true);
+        auto func = std::make_shared<ScriptFunction>(method.func.get(), current_env_->capture(), true);
         klass->add_method(method.func->name, func);
     }
 
@@ -1969,7 +2146,7 @@ Value Interpreter::visit(const LambdaExpr& expr) {
     const FunctionDecl* raw_decl = func_decl.get();
     lambda_storage_.push_back(std::move(func_decl));
 
-    auto function = std::make_shared<ScriptFunction>(raw_decl, current_env_);
+    auto function = std::make_shared<ScriptFunction>(raw_decl, current_env_->capture());
     return Value::make_function(function);
 }
 
@@ -2139,7 +2316,7 @@ void Interpreter::visit(const ImportDecl& decl) {
             buffer << file.rdbuf();
 
             // Create a new environment for the module
-            auto module_env = std::make_unique<Environment>(globals_.get());
+            auto module_env = std::make_shared<Environment>(globals_);
             Environment* prev_env = current_env_;
             current_env_ = module_env.get();
 
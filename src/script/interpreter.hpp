@@ -4,7 +4,9 @@
 /// @brief Tree-walking interpreter for VoidScript
 
 #include "ast.hpp"
+#include "gc.hpp"
 #include "parser.hpp"
+#include "vm.hpp"
 
 #include <chrono>
 #include <functional>
@@ -22,9 +24,13 @@ namespace void_script {
 // =============================================================================
 
 /// @brief Variable environment scope
-class Environment {
+///
+/// Environments are always shared: closures own the scope they capture
+/// (and through it the enclosing scopes), so it outlives the block or call
+/// that created it.
+class Environment : public std::enable_shared_from_this<Environment> {
 public:
-    explicit Environment(Environment* enclosing = nullptr);
+    explicit Environment(std::shared_ptr<Environment> enclosing = nullptr);
 
     /// @brief Define a new variable
     void define(const std::string& name, Value value);
@@ -38,15 +44,28 @@ public:
     /// @brief Check if variable exists
     [[nodiscard]] bool contains(const std::string& name) const;
 
+    /// @brief Find a variable in this scope only (nullptr if not defined here)
+    [[nodiscard]] Value* find(const std::string& name);
+
     /// @brief Get enclosing environment
-    [[nodiscard]] Environment* enclosing() const { return enclosing_; }
+    [[nodiscard]] Environment* enclosing() const { return enclosing_.get(); }
 
     /// @brief Get all variables
     [[nodiscard]] const std::unordered_map<std::string, Value>& variables() const { return variables_; }
 
+    /// @brief Owning handle for a closure; registers this scope chain with the collector
+    [[nodiscard]] std::shared_ptr<Environment> capture();
+
+    /// @brief Report the variables and enclosing scope to the collector
+    void trace(Tracer& tracer) const;
+
+    /// @brief Drop all variables and the enclosing scope
+    void clear();
+
 private:
     std::unordered_map<std::string, Value> variables_;
-    Environment* enclosing_;
+    std::shared_ptr<Environment> enclosing_;
+    bool gc_tracked_ = false;
 };
 
 // =============================================================================
@@ -56,7 +75,7 @@ private:
 /// @brief User-defined script function
 class ScriptFunction : public Callable {
 public:
-    ScriptFunction(const FunctionDecl* decl, Environment* closure, bool is_method = false);
+    ScriptFunction(const FunctionDecl* decl, std::shared_ptr<Environment> closure, bool is_method = false);
 
     [[nodiscard]] std::size_t arity() const override;
     [[nodiscard]] std::string name() const override;
@@ -66,9 +85,16 @@ public:
     /// @brief Bind 'this' for methods
     [[nodiscard]] std::shared_ptr<ScriptFunction> bind(std::shared_ptr<ClassInstance> instance);
 
+    /// @brief Call as a method of instance without creating a bound copy
+    [[nodiscard]] Value call_bound(Interpreter& interp, const std::shared_ptr<ClassInstance>& instance,
+                                   const std::vector<Value>& args);
+
+    void trace(Tracer& tracer) const override;
+    void clear_references() override;
+
 private:
     const FunctionDecl* declaration_;
-    Environment* closure_;
+    std::shared_ptr<Environment> closure_;
     bool is_method_;
     std::shared_ptr<ClassInstance> bound_instance_;
 };
@@ -96,10 +122,17 @@ public:
     /// @brief Add a method
     void add_method(const std::string& name, std::shared_ptr<ScriptFunction> method);
 
+    /// @brief Root shape of this class's instances
+    [[nodiscard]] const std::shared_ptr<Shape>& instance_shape() const { return instance_shape_; }
+
+    void trace(Tracer& tracer) const override;
+    void clear_references() override;
+
 private:
     std::string name_;
     const ClassDecl* declaration_;
     std::shared_ptr<ScriptClass> superclass_;
+    std::shared_ptr<Shape> instance_shape_;
     std::unordered_map<std::string, std::shared_ptr<ScriptFunction>> methods_;
 };
 
@@ -121,6 +154,9 @@ public:
 
     [[nodiscard]] std::shared_ptr<ScriptClass> get_class() const { return class_; }
 
+    void trace(Tracer& tracer) const override;
+    void clear_references() override;
+
 private:
     std::shared_ptr<ScriptClass> class_;
 };
@@ -208,6 +244,9 @@ public:
     /// @brief Execute block in new scope
     Value execute_block(const std::vector<StmtPtr>& statements, Environment* env);
 
+    /// @brief Execute a single statement in the given environment
+    Value execute_in(const Statement& stmt, Environment* env);
+
     // ==========================================================================
     // Native Bindings
     // ==========================================================================
@@ -244,9 +283,27 @@ public:
     /// @brief Set execution timeout
     void set_timeout(std::chrono::milliseconds timeout) { timeout_ = timeout; }
 
-    /// @brief Enable/disable debug mode
+    /// @brief Enable/disable debug mode (also logs compiled bytecode)
     void set_debug(bool enabled) { debug_mode_ = enabled; }
 
+    /// @brief Run programs on the bytecode VM (default) or the tree-walker
+    void set_bytecode_enabled(bool enabled) { bytecode_enabled_ = enabled; }
+
+    /// @brief Check if programs run on the bytecode VM
+    [[nodiscard]] bool bytecode_enabled() const { return bytecode_enabled_; }
+
+    /// @brief Get the bytecode VM
+    [[nodiscard]] VirtualMachine& vm() { return *vm_; }
+
+    /// @brief Collector that values created by this interpreter register with
+    ///
+    /// Null (the default) uses whichever collector is current on the thread.
+    /// The collector must outlive the interpreter.
+    void set_collector(GarbageCollector* collector) { collector_ = collector; }
+
+    /// @brief Get the collector (may be null)
+    [[nodiscard]] GarbageCollector* collector() const { return collector_; }
+
     // ==========================================================================
     // Callbacks
     // ==========================================================================
@@ -276,6 +333,8 @@ public:
     void apply_snapshot(const Snapshot& snapshot);
 
 private:
+    friend class VirtualMachine;
+
     // Expression evaluation
     Value visit(const LiteralExpr& expr);
     Value visit(const IdentifierExpr& expr);
@@ -319,13 +378,18 @@ private:
 
     // Helpers
     Value call_value(Value callee, const std::vector<Value>& args);
+    Value binary_op(TokenType op, const Value& left, const Value& right);
+    Value get_member(const Value& object, const std::string& name);
+    void set_member(Value& object, const std::string& name, Value value);
+    static TokenType compound_operator(TokenType op);
     void check_operands(TokenType op, const Value& left, const Value& right);
     void check_timeout();
 
     // State
-    std::unique_ptr<Environment> globals_;
+    std::shared_ptr<Environment> globals_;
     Environment* current_env_;
-    std::vector<std::unique_ptr<Environment>> scopes_;
+    std::vector<std::shared_ptr<Environment>> scopes_;
+    GarbageCollector* collector_ = nullptr;
 
     std::vector<CallFrame> call_stack_;
     std::size_t max_depth_ = 1000;
@@ -334,6 +398,9 @@ private:
     std::chrono::steady_clock::time_point start_time_;
 
     bool debug_mode_ = false;
+    bool bytecode_enabled_ = true;
+
+    std::unique_ptr<VirtualMachine> vm_;
 
     PrintCallback print_callback_;
     ErrorCallback error_callback_;
@@ -345,7 +412,7 @@ private:
     std::vector<std::unique_ptr<FunctionDecl>> lambda_storage_;
 
     // Module cache
-    std::unordered_map<std::string, std::unique_ptr<Environment>> modules_;
+    std::unordered_map<std::string, std::shared_ptr<Environment>> modules_;
 };
 
 // =============================================================================
@@ -1,5 +1,7 @@
 #include "types.hpp"
+#include "gc.hpp"
 
+#include <mutex>
 #include <sstream>
 
 namespace void_script {
@@ -58,11 +60,28 @@ std::string Token::to_string() const {
 // Value Implementation
 // =============================================================================
 
+Value::Value(ValueArray arr)
+    : type_(ValueType::Array), heap_(std::allocate_shared<ValueArray>(ArenaAllocator<ValueArray>{}, std::move(arr))) {
+    GarbageCollector::current().track(heap_, HeapKind::Array);
+}
+
+Value::Value(ValueMap map)
+    : type_(ValueType::Map), heap_(std::allocate_shared<ValueMap>(ArenaAllocator<ValueMap>{}, std::move(map))) {
+    GarbageCollector::current().track(heap_, HeapKind::Map);
+}
+
+void Value::track_object(const std::shared_ptr<Object>& obj) {
+    if (obj && !obj->gc_tracked_) {
+        obj->gc_tracked_ = true;
+        GarbageCollector::current().track(obj, HeapKind::Object);
+    }
+}
+
 bool Value::is_callable() const {
     if (type_ == ValueType::Function) return true;
     if (type_ == ValueType::Class) return true;
-    if (object_value_) {
-        return dynamic_cast<Callable*>(object_value_.get()) != nullptr;
+    if (holds_object()) {
+        return dynamic_cast<Callable*>(static_cast<Object*>(heap_.get())) != nullptr;
     }
     return false;
 }
@@ -71,142 +90,123 @@ bool Value::as_bool() const {
     if (type_ != ValueType::Bool) {
         throw ScriptException(ScriptError::TypeMismatch, "Expected bool");
     }
-    return bool_value_;
-}
-
-std::int64_t Value::as_int() const {
-    if (type_ == ValueType::Int) return int_value_;
-    if (type_ == ValueType::Float) return static_cast<std::int64_t>(float_value_);
-    throw ScriptException(ScriptError::TypeMismatch, "Expected integer");
-}
-
-double Value::as_float() const {
-    if (type_ == ValueType::Float) return float_value_;
-    if (type_ == ValueType::Int) return static_cast<double>(int_value_);
-    throw ScriptException(ScriptError::TypeMismatch, "Expected float");
-}
-
-double Value::as_number() const {
-    if (type_ == ValueType::Float) return float_value_;
-    if (type_ == ValueType::Int) return static_cast<double>(int_value_);
-    throw ScriptException(ScriptError::TypeMismatch, "Expected number");
+    return scalar_.b;
 }
 
 const std::string& Value::as_string() const {
-    if (type_ != ValueType::String || !string_value_) {
+    if (type_ != ValueType::String) {
         throw ScriptException(ScriptError::TypeMismatch, "Expected string");
     }
-    return *string_value_;
+    return *static_cast<const std::string*>(heap_.get());
 }
 
 ValueArray& Value::as_array() {
-    if (type_ != ValueType::Array || !array_value_) {
+    if (type_ != ValueType::Array) {
         throw ScriptException(ScriptError::TypeMismatch, "Expected array");
     }
-    return *array_value_;
+    return *static_cast<ValueArray*>(heap_.get());
 }
 
 const ValueArray& Value::as_array() const {
-    if (type_ != ValueType::Array || !array_value_) {
+    if (type_ != ValueType::Array) {
         throw ScriptException(ScriptError::TypeMismatch, "Expected array");
     }
-    return *array_value_;
+    return *static_cast<const ValueArray*>(heap_.get());
 }
 
 ValueMap& Value::as_map() {
-    if (type_ != ValueType::Map || !map_value_) {
+    if (type_ != ValueType::Map) {
         throw ScriptException(ScriptError::TypeMismatch, "Expected map");
     }
-    return *map_value_;
+    return *static_cast<ValueMap*>(heap_.get());
 }
 
 const ValueMap& Value::as_map() const {
-    if (type_ != ValueType::Map || !map_value_) {
+    if (type_ != ValueType::Map) {
         throw ScriptException(ScriptError::TypeMismatch, "Expected map");
     }
-    return *map_value_;
+    return *static_cast<const ValueMap*>(heap_.get());
 }
 
 Object* Value::as_object() {
-    return object_value_.get();
+    return holds_object() ? static_cast<Object*>(heap_.get()) : nullptr;
 }
 
 const Object* Value::as_object() const {
-    return object_value_.get();
+    return holds_object() ? static_cast<const Object*>(heap_.get()) : nullptr;
 }
 
 Callable* Value::as_callable() {
-    if (!object_value_) return nullptr;
-    return dynamic_cast<Callable*>(object_value_.get());
+    if (!holds_object()) return nullptr;
+    return dynamic_cast<Callable*>(static_cast<Object*>(heap_.get()));
 }
 
 Callable* Value::as_callable() const {
-    if (!object_value_) return nullptr;
-    return dynamic_cast<Callable*>(object_value_.get());
+    if (!holds_object()) return nullptr;
+    return dynamic_cast<Callable*>(static_cast<Object*>(heap_.get()));
 }
 
 void Value::set_object(std::shared_ptr<Object> obj) {
-    object_value_ = std::move(obj);
+    track_object(obj);
     type_ = obj ? obj->object_type() : ValueType::Null;
+    heap_ = std::move(obj);
 }
 
-bool Value::is_truthy() const {
-    switch (type_) {
-        case ValueType::Null: return false;
-        case ValueType::Bool: return bool_value_;
-        case ValueType::Int: return int_value_ != 0;
-        case ValueType::Float: return float_value_ != 0.0;
-        case ValueType::String: return string_value_ && !string_value_->empty();
-        case ValueType::Array: return array_value_ && !array_value_->empty();
-        case ValueType::Map: return map_value_ && !map_value_->empty();
-        default: return true;
-    }
+std::shared_ptr<Object> Value::get_object_ptr() const {
+    if (!holds_object()) return nullptr;
+    return std::static_pointer_cast<Object>(heap_);
 }
 
 bool Value::equals(const Value& other) const {
-    if (type_ != other.type_) return false;
+    if (type_ != other.type_) {
+        // Mixed int/float compare by numeric value
+        return is_number() && other.is_number() && as_float() == other.as_float();
+    }
 
     switch (type_) {
         case ValueType::Null: return true;
-        case ValueType::Bool: return bool_value_ == other.bool_value_;
-        case ValueType::Int: return int_value_ == other.int_value_;
-        case ValueType::Float: return float_value_ == other.float_value_;
+        case ValueType::Bool: return scalar_.b == other.scalar_.b;
+        case ValueType::Int: return scalar_.i == other.scalar_.i;
+        case ValueType::Float: return scalar_.f == other.scalar_.f;
         case ValueType::String:
-            return string_value_ && other.string_value_ &&
-                   *string_value_ == *other.string_value_;
-        case ValueType::Array:
-            if (!array_value_ || !other.array_value_) return false;
-            if (array_value_->size() != other.array_value_->size()) return false;
-            for (std::size_t i = 0; i < array_value_->size(); ++i) {
-                if (!(*array_value_)[i].equals((*other.array_value_)[i])) return false;
+            return as_string() == other.as_string();
+        case ValueType::Array: {
+            const auto& lhs = as_array();
+            const auto& rhs = other.as_array();
+            if (lhs.size() != rhs.size()) return false;
+            for (std::size_t i = 0; i < lhs.size(); ++i) {
+                if (!lhs[i].equals(rhs[i])) return false;
             }
             return true;
+        }
         default:
-            return object_value_.get() == other.object_value_.get();
+            return heap_.get() == other.heap_.get();
     }
 }
 
 int Value::compare(const Value& other) const {
     if (type_ != other.type_) {
+        if (is_number() && other.is_number()) {
+            double lhs = as_float();
+            double rhs = other.as_float();
+            return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+        }
         return static_cast<int>(type_) - static_cast<int>(other.type_);
     }
 
     switch (type_) {
         case ValueType::Null: return 0;
-        case ValueType::Bool: return static_cast<int>(bool_value_) - static_cast<int>(other.bool_value_);
+        case ValueType::Bool: return static_cast<int>(scalar_.b) - static_cast<int>(other.scalar_.b);
         case ValueType::Int:
-            if (int_value_ < other.int_value_) return -1;
-            if (int_value_ > other.int_value_) return 1;
+            if (scalar_.i < other.scalar_.i) return -1;
+            if (scalar_.i > other.scalar_.i) return 1;
             return 0;
         case ValueType::Float:
-            if (float_value_ < other.float_value_) return -1;
-            if (float_value_ > other.float_value_) return 1;
+            if (scalar_.f < other.scalar_.f) return -1;
+            if (scalar_.f > other.scalar_.f) return 1;
             return 0;
         case ValueType::String:
-            if (string_value_ && other.string_value_) {
-                return string_value_->compare(*other.string_value_);
-            }
-            return 0;
+            return as_string().compare(other.as_string());
         default:
             return 0;
     }
@@ -220,45 +220,44 @@ std::string Value::to_string() const {
             ss << "null";
             break;
         case ValueType::Bool:
-            ss << (bool_value_ ? "true" : "false");
+            ss << (scalar_.b ? "true" : "false");
             break;
         case ValueType::Int:
-            ss << int_value_;
+            ss << scalar_.i;
             break;
         case ValueType::Float:
-            ss << float_value_;
+            ss << scalar_.f;
             break;
         case ValueType::String:
-            if (string_value_) ss << *string_value_;
+            ss << as_string();
             break;
-        case ValueType::Array:
-            if (array_value_) {
-                ss << "[";
-                for (std::size_t i = 0; i < array_value_->size(); ++i) {
-                    if (i > 0) ss << ", ";
-                    ss << (*array_value_)[i].to_string();
-                }
-                ss << "]";
+        case ValueType::Array: {
+            const auto& arr = as_array();
+            ss << "[";
+            for (std::size_t i = 0; i < arr.size(); ++i) {
+                if (i > 0) ss << ", ";
+                ss << arr[i].to_string();
             }
+            ss << "]";
             break;
-        case ValueType::Map:
-            if (map_value_) {
-                ss << "{";
-                bool first = true;
-                for (const auto& [key, val] : *map_value_) {
-                    if (!first) ss << ", ";
-                    ss << key << ": " << val.to_string();
-                    first = false;
-                }
-                ss << "}";
+        }
+        case ValueType::Map: {
+            ss << "{";
+            bool first = true;
+            for (const auto& [key, val] : as_map()) {
+                if (!first) ss << ", ";
+                ss << key << ": " << val.to_string();
+                first = false;
             }
+            ss << "}";
             break;
+        }
         case ValueType::Function:
-            if (object_value_) ss << object_value_->to_string();
+            if (holds_object()) ss << as_object()->to_string();
             else ss << "<function>";
             break;
         case ValueType::Object:
-            if (object_value_) ss << object_value_->to_string();
+            if (holds_object()) ss << as_object()->to_string();
             else ss << "<object>";
             break;
         default:
@@ -290,45 +289,136 @@ Value Value::make_object(std::shared_ptr<Object> obj) {
 Value Value::make_function(std::shared_ptr<Callable> fn) {
     Value v;
     v.type_ = ValueType::Function;
-    v.object_value_ = std::move(fn);
+    std::shared_ptr<Object> obj = std::move(fn);
+    track_object(obj);
+    v.heap_ = std::move(obj);
     return v;
 }
 
+// =============================================================================
+// Shape Implementation
+// =============================================================================
+
+const std::shared_ptr<Shape>& Shape::root() {
+    static const std::shared_ptr<Shape> shared = make_root();
+    return shared;
+}
+
+std::shared_ptr<Shape> Shape::make_root() {
+    return std::shared_ptr<Shape>(new Shape());
+}
+
+std::int32_t Shape::find(const std::string& name) const {
+    if (names_.size() <= k_linear_lookup) {
+        for (std::size_t i = 0; i < names_.size(); ++i) {
+            if (names_[i] == name) return static_cast<std::int32_t>(i);
+        }
+        return -1;
+    }
+    auto it = index_.find(name);
+    return it != index_.end() ? static_cast<std::int32_t>(it->second) : -1;
+}
+
+void Shape::append(const std::string& name) {
+    names_.push_back(name);
+    if (names_.size() == k_linear_lookup + 1) {
+        for (std::size_t i = 0; i < names_.size(); ++i) {
+            index_.emplace(names_[i], static_cast<std::uint32_t>(i));
+        }
+    } else if (names_.size() > k_linear_lookup) {
+        index_.emplace(name, static_cast<std::uint32_t>(names_.size() - 1));
+    }
+}
+
+std::shared_ptr<Shape> Shape::with_property(const std::string& name) {
+    if (dictionary_) {
+        append(name);
+        return shared_from_this();
+    }
+
+    std::lock_guard lock(transitions_mutex_);
+
+    auto it = transitions_.find(name);
+    if (it != transitions_.end()) {
+        if (auto next = it->second.lock()) {
+            return next;
+        }
+        transitions_.erase(it);
+    }
+
+    if (transitions_.size() >= k_max_transitions) {
+        std::erase_if(transitions_, [](const auto& entry) { return entry.second.expired(); });
+    }
+
+    std::shared_ptr<Shape> next(new Shape());
+    next->names_ = names_;
+    next->index_ = index_;
+    next->append(name);
+
+    if (names_.size() >= k_max_shared_properties || transitions_.size() >= k_max_transitions) {
+        next->dictionary_ = true;
+        return next;
+    }
+
+    next->parent_ = shared_from_this();
+    transitions_.emplace(name, next);
+    return next;
+}
+
 // =============================================================================
 // Object Implementation
 // =============================================================================
 
 bool Object::has_property(const std::string& name) const {
-    return properties_.count(name) > 0;
+    return shape_->find(name) >= 0;
 }
 
 Value Object::get_property(const std::string& name) const {
-    auto it = properties_.find(name);
-    if (it == properties_.end()) {
+    std::int32_t index = shape_->find(name);
+    if (index < 0) {
         throw ScriptException(ScriptError::UndefinedProperty, "Undefined property: " + name);
     }
-    return it->second;
+    return slots_[static_cast<std::size_t>(index)];
 }
 
 void Object::set_property(const std::string& name, Value value) {
-    properties_[name] = std::move(value);
+    std::int32_t index = shape_->find(name);
+    if (index >= 0) {
+        slots_[static_cast<std::size_t>(index)] = std::move(value);
+        return;
+    }
+    add_slot(shape_->with_property(name), std::move(value));
 }
 
 bool Object::has_method(const std::string& name) const {
-    auto it = properties_.find(name);
-    return it != properties_.end() && it->second.is_callable();
+    std::int32_t index = shape_->find(name);
+    return index >= 0 && slots_[static_cast<std::size_t>(index)].is_callable();
 }
 
 Value Object::call_method(const std::string& name, const std::vector<Value>& args, Interpreter& interp) {
-    auto it = properties_.find(name);
-    if (it == properties_.end() || !it->second.is_callable()) {
+    std::int32_t index = shape_->find(name);
+    const Value* slot = index >= 0 ? &slots_[static_cast<std::size_t>(index)] : nullptr;
+    if (!slot || !slot->is_callable()) {
         throw ScriptException(ScriptError::UndefinedProperty, "Undefined method: " + name);
     }
 
-    Callable* callable = it->second.as_callable();
+    Callable* callable = slot->as_callable();
     return callable->call(interp, args);
 }
 
+void Object::trace(Tracer& tracer) const {
+    for (const auto& value : slots_) {
+        tracer.visit(value);
+    }
+}
+
+void Object::clear_references() {
+    // Slots stay allocated so they keep matching the shape
+    for (auto& value : slots_) {
+        value = Value(nullptr);
+    }
+}
+
 // =============================================================================
 // NativeFunction Implementation
 // =============================================================================
@@ -7,9 +7,11 @@
 #include <void_engine/core/error.hpp>
 
 #include <any>
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -227,20 +229,24 @@ using ValueArray = std::vector<Value>;
 using ValueMap = std::unordered_map<std::string, Value>;
 
 /// @brief Runtime value
+///
+/// Small tagged representation: a type tag, an inline scalar for
+/// bool/int/float and a single reference for heap types (string, array,
+/// map and objects). sizeof(Value) is 32 bytes on 64-bit targets.
 class Value {
 public:
     // Constructors
     Value() : type_(ValueType::Null) {}
     Value(std::nullptr_t) : type_(ValueType::Null) {}
-    Value(bool v) : type_(ValueType::Bool), bool_value_(v) {}
-    Value(std::int64_t v) : type_(ValueType::Int), int_value_(v) {}
-    Value(int v) : type_(ValueType::Int), int_value_(v) {}
-    Value(double v) : type_(ValueType::Float), float_value_(v) {}
-    Value(const std::string& v) : type_(ValueType::String), string_value_(std::make_shared<std::string>(v)) {}
-    Value(std::string&& v) : type_(ValueType::String), string_value_(std::make_shared<std::string>(std::move(v))) {}
-    Value(const char* v) : type_(ValueType::String), string_value_(std::make_shared<std::string>(v)) {}
-    Value(ValueArray arr) : type_(ValueType::Array), array_value_(std::make_shared<ValueArray>(std::move(arr))) {}
-    Value(ValueMap map) : type_(ValueType::Map), map_value_(std::make_shared<ValueMap>(std::move(map))) {}
+    Value(bool v) : type_(ValueType::Bool) { scalar_.b = v; }
+    Value(std::int64_t v) : type_(ValueType::Int) { scalar_.i = v; }
+    Value(int v) : type_(ValueType::Int) { scalar_.i = v; }
+    Value(double v) : type_(ValueType::Float) { scalar_.f = v; }
+    Value(const std::string& v) : type_(ValueType::String), heap_(std::make_shared<std::string>(v)) {}
+    Value(std::string&& v) : type_(ValueType::String), heap_(std::make_shared<std::string>(std::move(v))) {}
+    Value(const char* v) : type_(ValueType::String), heap_(std::make_shared<std::string>(v)) {}
+    Value(ValueArray arr);
+    Value(ValueMap map);
 
     // Type checking
     [[nodiscard]] ValueType type() const { return type_; }
@@ -273,7 +279,13 @@ public:
 
     // Object storage
     void set_object(std::shared_ptr<Object> obj);
-    [[nodiscard]] std::shared_ptr<Object> get_object_ptr() const { return object_value_; }
+    [[nodiscard]] std::shared_ptr<Object> get_object_ptr() const;
+
+    /// @brief Address of the heap payload (nullptr for scalars)
+    [[nodiscard]] const void* heap_identity() const { return heap_.get(); }
+
+    /// @brief Register an object with the collector (once; storing it in a Value does this)
+    static void track_object(const std::shared_ptr<Object>& obj);
 
     // Truthiness
     [[nodiscard]] bool is_truthy() const;
@@ -301,16 +313,137 @@ public:
     static Value make_function(std::shared_ptr<Callable> fn);
 
 private:
+    /// Heap payload is an Object (Object, Function, Class, Module, Native)
+    [[nodiscard]] bool holds_object() const { return type_ >= ValueType::Object && heap_ != nullptr; }
+
+    union Scalar {
+        std::int64_t i = 0;
+        double f;
+        bool b;
+    };
+
     ValueType type_;
+    Scalar scalar_;
+    std::shared_ptr<void> heap_;  ///< std::string, ValueArray, ValueMap or Object
+};
+
+// =============================================================================
+// Shapes
+// =============================================================================
+
+/// @brief Hidden class describing an object's property layout
+///
+/// Objects that gained the same properties in the same order from the same
+/// root share a Shape, and keep property values in a slot vector indexed by
+/// the shape. Shared shapes are immutable; a shape is owned by the objects
+/// and caches that use it and by its transitions, so layouts nothing refers
+/// to any more are freed.
+///
+/// Objects that outgrow k_max_shared_properties, or add a property to a
+/// shape that already has k_max_transitions, switch to a dictionary shape:
+/// an unshared shape owned by that object alone, which grows in place.
+class Shape : public std::enable_shared_from_this<Shape> {
+public:
+    /// Shared shapes with more properties than this become dictionaries
+    static constexpr std::size_t k_max_shared_properties = 32;
+
+    /// Shapes with this many transitions send further properties to dictionaries
+    static constexpr std::size_t k_max_transitions = 32;
+
+    Shape(const Shape&) = delete;
+    Shape& operator=(const Shape&) = delete;
+
+    /// @brief Shared root for plain objects
+    [[nodiscard]] static const std::shared_ptr<Shape>& root();
+
+    /// @brief Fresh root for a separate layout family (one per script class)
+    [[nodiscard]] static std::shared_ptr<Shape> make_root();
+
+    /// @brief Slot index of a property, or -1
+    [[nodiscard]] std::int32_t find(const std::string& name) const;
 
-    // Value storage (union-like)
-    bool bool_value_ = false;
-    std::int64_t int_value_ = 0;
-    double float_value_ = 0.0;
-    std::shared_ptr<std::string> string_value_;
-    std::shared_ptr<ValueArray> array_value_;
-    std::shared_ptr<ValueMap> map_value_;
-    std::shared_ptr<Object> object_value_;
+    /// @brief Shape after appending a property
+    ///
+    /// Shared shapes return the (cached) transition; a dictionary shape
+    /// appends the property to itself and returns itself.
+    [[nodiscard]] std::shared_ptr<Shape> with_property(const std::string& name);
+
+    /// @brief Whether this shape is unshared and mutable (never cache it)
+    [[nodiscard]] bool is_dictionary() const { return dictionary_; }
+
+    /// @brief Number of properties
+    [[nodiscard]] std::size_t size() const { return names_.size(); }
+
+    /// @brief Property names in slot order
+    [[nodiscard]] const std::vector<std::string>& names() const { return names_; }
+
+private:
+    Shape() = default;
+
+    /// Shapes with more properties than this also get a hash index
+    static constexpr std::size_t k_linear_lookup = 8;
+
+    void append(const std::string& name);
+
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, std::uint32_t> index_;
+    bool dictionary_ = false;
+
+    std::shared_ptr<Shape> parent_;     ///< Keeps the layout prefix unique while in use
+    std::mutex transitions_mutex_;
+    std::unordered_map<std::string, std::weak_ptr<Shape>> transitions_;
+};
+
+/// @brief Polymorphic inline cache for one property access site
+///
+/// Holds up to k_ways shapes seen at the site. A full cache stops learning
+/// and the site falls back to the generic lookup for new shapes. Entries
+/// keep their shapes alive, so a freed shape's address is never matched.
+struct PropertyCache {
+    static constexpr std::size_t k_ways = 4;
+
+    struct Entry {
+        std::shared_ptr<const Shape> shape;
+        std::shared_ptr<Shape> next;        ///< Shape after adding the property (stores only)
+        std::uint32_t slot = 0;
+        std::shared_ptr<Callable> method;   ///< Class method found for this shape (method lookups)
+    };
+
+    std::array<Entry, k_ways> entries;
+    std::uint32_t count = 0;
+
+    [[nodiscard]] const Entry* find(const Shape* shape) const {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (entries[i].shape.get() == shape) return &entries[i];
+        }
+        return nullptr;
+    }
+
+    void insert(Entry entry) {
+        if (count < k_ways) {
+            entries[count++] = std::move(entry);
+        }
+    }
+};
+
+// =============================================================================
+// Tracing
+// =============================================================================
+
+/// @brief Receives the strong references held by a heap value
+///
+/// Each reported reference must correspond to exactly one owning pointer;
+/// references that are not reported are treated as roots by the collector.
+class Tracer {
+public:
+    virtual ~Tracer() = default;
+
+    /// @brief Report an owning reference to a heap payload or cell
+    virtual void visit_heap(const void* heap) = 0;
+
+    void visit(const Value& value) {
+        if (const void* heap = value.heap_identity()) visit_heap(heap);
+    }
 };
 
 // =============================================================================
@@ -318,6 +451,11 @@ private:
 // =============================================================================
 
 /// @brief Base class for script objects
+///
+/// Own properties live in shape-indexed slots. Subclasses may add computed
+/// properties by overriding get_property/set_property, but names present in
+/// the shape must read and write the slots: compiled code accesses those
+/// slots directly through inline caches.
 class Object {
 public:
     virtual ~Object() = default;
@@ -336,8 +474,33 @@ public:
                                              const std::vector<Value>& args,
                                              Interpreter& interp);
 
+    // Slot access
+    [[nodiscard]] const std::shared_ptr<Shape>& shape() const { return shape_; }
+    [[nodiscard]] Value& slot(std::uint32_t index) { return slots_[index]; }
+    [[nodiscard]] const Value& slot(std::uint32_t index) const { return slots_[index]; }
+
+    /// @brief Append a slot; next must be shape()->with_property(name)
+    void add_slot(std::shared_ptr<Shape> next, Value value) {
+        shape_ = std::move(next);
+        slots_.push_back(std::move(value));
+    }
+
+    // Garbage collection
+
+    /// @brief Report the script values this object owns
+    virtual void trace(Tracer& tracer) const;
+
+    /// @brief Drop owned script values (the object is part of a dead cycle)
+    virtual void clear_references();
+
 protected:
-    std::unordered_map<std::string, Value> properties_;
+    std::shared_ptr<Shape> shape_ = Shape::root();
+    std::vector<Value> slots_;
+
+private:
+    friend class Value;
+
+    bool gc_tracked_ = false;
 };
 
 // =============================================================================
@@ -609,4 +772,39 @@ constexpr const char* script_error_name(ScriptError error) {
     }
 }
 
+// =============================================================================
+// Value Inline Accessors
+// =============================================================================
+
+inline std::int64_t Value::as_int() const {
+    if (type_ == ValueType::Int) return scalar_.i;
+    if (type_ == ValueType::Float) return static_cast<std::int64_t>(scalar_.f);
+    throw ScriptException(ScriptError::TypeMismatch, "Expected integer");
+}
+
+inline double Value::as_float() const {
+    if (type_ == ValueType::Float) return scalar_.f;
+    if (type_ == ValueType::Int) return static_cast<double>(scalar_.i);
+    throw ScriptException(ScriptError::TypeMismatch, "Expected float");
+}
+
+inline double Value::as_number() const {
+    if (type_ == ValueType::Float) return scalar_.f;
+    if (type_ == ValueType::Int) return static_cast<double>(scalar_.i);
+    throw ScriptException(ScriptError::TypeMismatch, "Expected number");
+}
+
+inline bool Value::is_truthy() const {
+    switch (type_) {
+        case ValueType::Null: return false;
+        case ValueType::Bool: return scalar_.b;
+        case ValueType::Int: return scalar_.i != 0;
+        case ValueType::Float: return scalar_.f != 0.0;
+        case ValueType::String: return !static_cast<const std::string*>(heap_.get())->empty();
+        case ValueType::Array: return !static_cast<const ValueArray*>(heap_.get())->empty();
+        case ValueType::Map: return !static_cast<const ValueMap*>(heap_.get())->empty();
+        default: return true;
+    }
+}
+
 } // namespace void_script
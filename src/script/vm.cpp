@@ -0,0 +1,689 @@
+#include "vm.hpp"
+#include "gc.hpp"
+#include "interpreter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace void_script {
+
+namespace {
+
+/// Binary opcodes share the interpreter's operator semantics
+TokenType binary_token(OpCode op) {
+    switch (op) {
+        case OpCode::Add: return TokenType::Plus;
+        case OpCode::Sub: return TokenType::Minus;
+        case OpCode::Mul: return TokenType::Star;
+        case OpCode::Div: return TokenType::Slash;
+        case OpCode::Mod: return TokenType::Percent;
+        case OpCode::Pow: return TokenType::Power;
+        case OpCode::BitAnd: return TokenType::Ampersand;
+        case OpCode::BitOr: return TokenType::Pipe;
+        case OpCode::BitXor: return TokenType::Caret;
+        case OpCode::Shl: return TokenType::ShiftLeft;
+        case OpCode::Shr: return TokenType::ShiftRight;
+        case OpCode::Eq: return TokenType::Equal;
+        case OpCode::Ne: return TokenType::NotEqual;
+        case OpCode::Lt: return TokenType::Less;
+        case OpCode::Le: return TokenType::LessEqual;
+        case OpCode::Gt: return TokenType::Greater;
+        case OpCode::Ge: return TokenType::GreaterEqual;
+        case OpCode::Coalesce: return TokenType::QuestionQuestion;
+        default: return TokenType::Error;
+    }
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// CompiledFunction Implementation
+// =============================================================================
+
+CompiledFunction::CompiledFunction(std::shared_ptr<const Chunk> chunk, Environment* globals,
+                                   std::vector<std::shared_ptr<Value>> upvalues)
+    : chunk_(std::move(chunk)), globals_(globals), upvalues_(std::move(upvalues)) {}
+
+std::string CompiledFunction::to_string() const {
+    return "<fn " + chunk_->name + ">";
+}
+
+Value CompiledFunction::call(Interpreter& interp, const std::vector<Value>& args) {
+    return interp.vm().call(*this, args);
+}
+
+void CompiledFunction::trace(Tracer& tracer) const {
+    Callable::trace(tracer);
+    for (const auto& cell : upvalues_) {
+        tracer.visit_heap(cell.get());
+    }
+}
+
+void CompiledFunction::clear_references() {
+    Callable::clear_references();
+    upvalues_.clear();
+}
+
+// =============================================================================
+// VirtualMachine Implementation
+// =============================================================================
+
+VirtualMachine::VirtualMachine(Interpreter& interp)
+    : interp_(interp) {}
+
+Value VirtualMachine::run(std::shared_ptr<const Chunk> chunk, Environment& env) {
+    CompiledFunction main(std::move(chunk), &env);
+    return execute(main, top_, 0);
+}
+
+Value VirtualMachine::call(CompiledFunction& fn, const std::vector<Value>& args) {
+    GarbageCollector::Scope gc_scope(interp_.collector());
+    std::size_t base = top_;
+    if (registers_.size() < base + args.size()) {
+        registers_.resize(base + args.size());
+    }
+    std::copy(args.begin(), args.end(), registers_.begin() + static_cast<std::ptrdiff_t>(base));
+    return execute(fn, base, args.size());
+}
+
+Value* VirtualMachine::global_slot(const Chunk& chunk, Environment* env, std::uint16_t index) {
+    if (chunk.global_slots_env != env) {
+        chunk.global_slots.assign(chunk.globals.size(), nullptr);
+        chunk.global_slots_env = env;
+    }
+    Value*& slot = chunk.global_slots[index];
+    if (!slot) {
+        // Map nodes are stable, so the slot stays valid once the name exists
+        slot = env->find(chunk.globals[index]);
+    }
+    return slot;
+}
+
+Value VirtualMachine::get_global(const Chunk& chunk, Environment* env, std::uint16_t index) {
+    if (Value* slot = global_slot(chunk, env, index)) {
+        return *slot;
+    }
+    return env->get(chunk.globals[index]);
+}
+
+void VirtualMachine::set_global(const Chunk& chunk, Environment* env, std::uint16_t index, Value value) {
+    if (Value* slot = global_slot(chunk, env, index)) {
+        *slot = std::move(value);
+        return;
+    }
+    env->assign(chunk.globals[index], std::move(value));
+}
+
+Value VirtualMachine::binary(OpCode op, const Value& left, const Value& right) {
+    return interp_.binary_op(binary_token(op), left, right);
+}
+
+Value VirtualMachine::call_registers(std::size_t callee, std::size_t args, std::size_t argc) {
+    const Value& function = registers_[callee];
+    Callable* callable = function.is_callable() ? function.as_callable() : nullptr;
+    if (!callable) {
+        throw ScriptException(ScriptError::NotCallable, "Value is not callable");
+    }
+
+    auto* compiled = dynamic_cast<CompiledFunction*>(callable);
+    if (!compiled) {
+        auto first = registers_.begin() + static_cast<std::ptrdiff_t>(args);
+        std::vector<Value> values(first, first + static_cast<std::ptrdiff_t>(argc));
+        return interp_.call_value(function, values);
+    }
+
+    // Same checks as Interpreter::call_value, with the arguments left in
+    // place as the callee's registers
+    if (argc < compiled->arity()) {
+        throw ScriptException(ScriptError::WrongArgumentCount,
+                              "Expected " + std::to_string(compiled->arity()) +
+                              " arguments but got " + std::to_string(argc));
+    }
+    if (interp_.call_stack_.size() >= interp_.max_depth_) {
+        throw ScriptException(ScriptError::StackOverflow, "Stack overflow");
+    }
+
+    CallFrame frame;
+    frame.function_name = compiled->chunk_->name;
+    interp_.call_stack_.push_back(std::move(frame));
+    Value result;
+    try {
+        result = execute(*compiled, args, argc);
+    } catch (...) {
+        interp_.call_stack_.pop_back();
+        throw;
+    }
+    interp_.call_stack_.pop_back();
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+// Member access
+//
+// Objects keep their properties in slots laid out by a Shape, so a site that
+// has seen an object's shape before reads or writes the slot directly.
+// Maps are keyed by string and bypass the caches.
+// -----------------------------------------------------------------------------
+
+Value VirtualMachine::get_member(PropertyCache& cache, const Value& object, const std::string& name) {
+    if (object.is_map()) {
+        const auto& map = object.as_map();
+        auto it = map.find(name);
+        return it != map.end() ? it->second : Value(nullptr);
+    }
+
+    const Object* obj = object.as_object();
+    if (!obj) {
+        throw ScriptException(ScriptError::NullReference, "Cannot access property of null");
+    }
+
+    const auto& shape = obj->shape();
+    if (const auto* entry = cache.find(shape.get())) {
+        return obj->slot(entry->slot);
+    }
+    std::int32_t slot = shape->find(name);
+    if (slot < 0) {
+        // Methods and missing properties take the object's own path
+        return obj->get_property(name);
+    }
+    if (!shape->is_dictionary()) {
+        cache.insert({shape, nullptr, static_cast<std::uint32_t>(slot), nullptr});
+    }
+    return obj->slot(static_cast<std::uint32_t>(slot));
+}
+
+void VirtualMachine::set_member(PropertyCache& cache, Value& object, const std::string& name, Value value) {
+    if (object.is_map()) {
+        object.as_map()[name] = std::move(value);
+        return;
+    }
+
+    Object* obj = object.as_object();
+    if (!obj) {
+        if (object.is_null()) {
+            throw ScriptException(ScriptError::NullReference, "Cannot set property of null");
+        }
+        throw ScriptException(ScriptError::TypeError, "Cannot set property on " + object.type_name());
+    }
+
+    if (obj->shape()->is_dictionary()) {
+        obj->set_property(name, std::move(value));
+        return;
+    }
+
+    std::shared_ptr<Shape> shape = obj->shape();
+    const auto* entry = cache.find(shape.get());
+    if (!entry) {
+        std::int32_t slot = shape->find(name);
+        if (slot >= 0) {
+            cache.insert({shape, nullptr, static_cast<std::uint32_t>(slot), nullptr});
+        } else {
+            cache.insert({shape, shape->with_property(name), static_cast<std::uint32_t>(shape->size()), nullptr});
+        }
+        entry = cache.find(shape.get());
+        if (!entry) {
+            // Cache is full
+            obj->set_property(name, std::move(value));
+            return;
+        }
+    }
+
+    if (entry->next) {
+        obj->add_slot(entry->next, std::move(value));
+    } else {
+        obj->slot(entry->slot) = std::move(value);
+    }
+}
+
+void VirtualMachine::get_method(PropertyCache& cache, Value& callee, Value& receiver, const std::string& name) {
+    // The receiver stays in place only for class methods, which CallMethod
+    // binds without creating a bound function
+    if (receiver.is_map()) {
+        callee = get_member(cache, receiver, name);
+        receiver = Value(nullptr);
+        return;
+    }
+
+    const Object* obj = receiver.as_object();
+    if (!obj) {
+        throw ScriptException(ScriptError::NullReference, "Cannot access property of null");
+    }
+
+    const auto& shape = obj->shape();
+    PropertyCache::Entry uncached;
+    const auto* entry = shape->is_dictionary() ? nullptr : cache.find(shape.get());
+    if (!entry) {
+        std::int32_t slot = shape->find(name);
+        std::shared_ptr<Callable> method;
+        if (slot < 0) {
+            // Shapes of class instances are never shared between classes
+            if (const auto* instance = dynamic_cast<const ClassInstance*>(obj)) {
+                method = instance->get_class()->find_method(name);
+            }
+            if (!method) {
+                callee = obj->get_property(name);
+                receiver = Value(nullptr);
+                return;
+            }
+        }
+        PropertyCache::Entry found{shape, nullptr, static_cast<std::uint32_t>(std::max(slot, 0)), std::move(method)};
+        if (shape->is_dictionary()) {
+            // Dictionary shapes change in place and are never cached
+            uncached = std::move(found);
+            entry = &uncached;
+        } else {
+            cache.insert(std::move(found));
+            entry = cache.find(shape.get());
+        }
+        if (!entry) {
+            // Cache is full
+            callee = obj->get_property(name);
+            receiver = Value(nullptr);
+            return;
+        }
+    }
+
+    if (entry->method) {
+        callee = Value::make_function(entry->method);
+    } else {
+        callee = obj->slot(entry->slot);
+        receiver = Value(nullptr);
+    }
+}
+
+Value VirtualMachine::execute(CompiledFunction& fn, std::size_t base, std::size_t argc) {
+    const Chunk& chunk = *fn.chunk_;
+    Environment* env = fn.globals_;
+
+    const std::size_t frame_top = base + chunk.register_count;
+    if (registers_.size() < frame_top) {
+        registers_.resize(std::max(frame_top, registers_.size() * 2));
+    }
+    for (std::size_t i = argc; i < chunk.parameter_count; ++i) {
+        registers_[base + i] = Value(nullptr);
+    }
+
+    const std::size_t cell_base = cell_top_;
+    if (cells_.size() < cell_base + chunk.cell_count) {
+        cells_.resize(std::max(cell_base + chunk.cell_count, cells_.size() * 2));
+    }
+
+    // Release the frame's registers and cells however it exits
+    struct FrameGuard {
+        VirtualMachine& vm;
+        std::size_t base, top, saved_top;
+        std::size_t cell_base, cell_top, saved_cell_top;
+
+        ~FrameGuard() {
+            for (std::size_t i = base; i < top; ++i) {
+                vm.registers_[i] = Value(nullptr);
+            }
+            for (std::size_t i = cell_base; i < cell_top; ++i) {
+                vm.cells_[i].reset();
+            }
+            vm.top_ = saved_top;
+            vm.cell_top_ = saved_cell_top;
+        }
+    } guard{*this, base, frame_top, top_, cell_base, cell_base + chunk.cell_count, cell_top_};
+
+    top_ = frame_top;
+    cell_top_ = cell_base + chunk.cell_count;
+
+    const Instruction* code = chunk.code.data();
+    const Value* K = chunk.constants.data();
+    Value* R = registers_.data() + base;
+    std::size_t pc = 0;
+
+    auto rk = [&](std::uint16_t operand) -> const Value& {
+        return (operand & k_rk_constant) ? K[operand & ~k_rk_constant] : R[operand];
+    };
+
+    for (;;) {
+        const Instruction ins = code[pc++];
+
+        switch (ins.op) {
+            // Loads
+            case OpCode::LoadConst:
+                R[ins.a] = K[ins.b];
+                break;
+            case OpCode::LoadNull:
+                R[ins.a] = Value(nullptr);
+                break;
+            case OpCode::LoadBool:
+                R[ins.a] = Value(ins.b != 0);
+                break;
+            case OpCode::Move:
+                R[ins.a] = R[ins.b];
+                break;
+
+            // Variables
+            case OpCode::GetGlobal:
+                R[ins.a] = get_global(chunk, env, ins.b);
+                break;
+            case OpCode::SetGlobal:
+                set_global(chunk, env, ins.b, R[ins.a]);
+                break;
+            case OpCode::DefineGlobal:
+                env->define(chunk.globals[ins.b], R[ins.a]);
+                break;
+            case OpCode::GetUpvalue:
+                R[ins.a] = *fn.upvalues_[ins.b];
+                break;
+            case OpCode::SetUpvalue:
+                *fn.upvalues_[ins.b] = R[ins.a];
+                break;
+            case OpCode::NewCell:
+                cells_[cell_base + ins.b] = make_cell(R[ins.a]);
+                break;
+            case OpCode::GetCell:
+                R[ins.a] = *cells_[cell_base + ins.b];
+                break;
+            case OpCode::SetCell:
+                *cells_[cell_base + ins.b] = R[ins.a];
+                break;
+
+            // Arithmetic: numbers take the fast path, everything else
+            // goes through the interpreter's operator implementation
+            case OpCode::Add: {
+                const Value& l = rk(ins.b);
+                const Value& r = rk(ins.c);
+                if (l.is_number() && r.is_number()) {
+                    R[ins.a] = Value(l.as_number() + r.as_number());
+                } else {
+                    R[ins.a] = binary(ins.op, l, r);
+                }
+                break;
+            }
+            case OpCode::Sub: {
+                const Value& l = rk(ins.b);
+                const Value& r = rk(ins.c);
+                if (l.is_number() && r.is_number()) {
+                    R[ins.a] = Value(l.as_number() - r.as_number());
+                } else {
+                    R[ins.a] = binary(ins.op, l, r);
+                }
+                break;
+            }
+            case OpCode::Mul: {
+                const Value& l = rk(ins.b);
+                const Value& r = rk(ins.c);
+                if (l.is_number() && r.is_number()) {
+                    R[ins.a] = Value(l.as_number() * r.as_number());
+                } else {
+                    R[ins.a] = binary(ins.op, l, r);
+                }
+                break;
+            }
+            case OpCode::Lt: {
+                const Value& l = rk(ins.b);
+                const Value& r = rk(ins.c);
+                if (l.is_number() && r.is_number()) {
+                    R[ins.a] = Value(l.as_number() < r.as_number());
+                } else {
+                    R[ins.a] = Value(l < r);
+                }
+                break;
+            }
+            case OpCode::Le: {
+                const Value& l = rk(ins.b);
+                const Value& r = rk(ins.c);
+                if (l.is_number() && r.is_number()) {
+                    R[ins.a] = Value(l.as_number() <= r.as_number());
+                } else {
+                    R[ins.a] = Value(l <= r);
+                }
+                break;
+            }
+            case OpCode::Gt: {
+                const Value& l = rk(ins.b);
+                const Value& r = rk(ins.c);
+                if (l.is_number() && r.is_number()) {
+                    R[ins.a] = Value(l.as_number() > r.as_number());
+                } else {
+                    R[ins.a] = Value(l > r);
+                }
+                break;
+            }
+            case OpCode::Ge: {
+                const Value& l = rk(ins.b);
+                const Value& r = rk(ins.c);
+                if (l.is_number() && r.is_number()) {
+                    R[ins.a] = Value(l.as_number() >= r.as_number());
+                } else {
+                    R[ins.a] = Value(l >= r);
+                }
+                break;
+            }
+            case OpCode::Eq:
+                R[ins.a] = Value(rk(ins.b).equals(rk(ins.c)));
+                break;
+            case OpCode::Ne:
+                R[ins.a] = Value(!rk(ins.b).equals(rk(ins.c)));
+                break;
+            case OpCode::Coalesce: {
+                const Value& l = rk(ins.b);
+                R[ins.a] = l.is_null() ? rk(ins.c) : l;
+                break;
+            }
+            case OpCode::Div:
+            case OpCode::Mod:
+            case OpCode::Pow:
+            case OpCode::BitAnd:
+            case OpCode::BitOr:
+            case OpCode::BitXor:
+            case OpCode::Shl:
+            case OpCode::Shr:
+                R[ins.a] = binary(ins.op, rk(ins.b), rk(ins.c));
+                break;
+
+            // Unary
+            case OpCode::Neg:
+                R[ins.a] = Value(-R[ins.b].as_number());
+                break;
+            case OpCode::Not:
+                R[ins.a] = Value(!R[ins.b].is_truthy());
+                break;
+            case OpCode::BitNot:
+                R[ins.a] = Value(~R[ins.b].as_int());
+                break;
+            case OpCode::ToBool:
+                R[ins.a] = Value(R[ins.b].is_truthy());
+                break;
+            case OpCode::Inc:
+                R[ins.a] = Value(R[ins.b].as_number() + 1);
+                break;
+            case OpCode::Dec:
+                R[ins.a] = Value(R[ins.b].as_number() - 1);
+                break;
+
+            // Control flow
+            case OpCode::Jump:
+                pc = ins.b;
+                break;
+            case OpCode::Loop:
+                interp_.check_timeout();
+                pc = ins.b;
+                break;
+            case OpCode::JumpIfFalse:
+                if (!R[ins.a].is_truthy()) pc = ins.b;
+                break;
+            case OpCode::JumpIfTrue:
+                if (R[ins.a].is_truthy()) pc = ins.b;
+                break;
+            case OpCode::JumpIfArg:
+                if (ins.a < argc) pc = ins.b;
+                break;
+
+            // Calls
+            case OpCode::Call: {
+                Value result = call_registers(base + ins.a, base + ins.a + 1, ins.b);
+                // The callee may have grown the register stack
+                R = registers_.data() + base;
+                R[ins.a] = std::move(result);
+                break;
+            }
+            case OpCode::GetMethod:
+                get_method(chunk.property_caches[ins.d], R[ins.a], R[ins.b], K[ins.c].as_string());
+                break;
+            case OpCode::CallMethod: {
+                Value result;
+                if (R[ins.a + 1].is_null()) {
+                    result = call_registers(base + ins.a, base + ins.a + 2, ins.b);
+                } else {
+                    // Class method: call it bound to the receiver without
+                    // materialising a bound function
+                    auto* method = static_cast<ScriptFunction*>(R[ins.a].as_callable());
+                    if (ins.b < method->arity()) {
+                        throw ScriptException(ScriptError::WrongArgumentCount,
+                                              "Expected " + std::to_string(method->arity()) +
+                                              " arguments but got " + std::to_string(ins.b));
+                    }
+                    if (interp_.call_stack_.size() >= interp_.max_depth_) {
+                        throw ScriptException(ScriptError::StackOverflow, "Stack overflow");
+                    }
+
+                    auto instance = std::static_pointer_cast<ClassInstance>(R[ins.a + 1].get_object_ptr());
+                    std::vector<Value> args(R + ins.a + 2, R + ins.a + 2 + ins.b);
+                    CallFrame frame;
+                    frame.function_name = method->name();
+                    interp_.call_stack_.push_back(std::move(frame));
+                    try {
+                        result = method->call_bound(interp_, instance, args);
+                    } catch (...) {
+                        interp_.call_stack_.pop_back();
+                        throw;
+                    }
+                    interp_.call_stack_.pop_back();
+                }
+                R = registers_.data() + base;
+                R[ins.a] = std::move(result);
+                break;
+            }
+            case OpCode::Return:
+                return std::move(R[ins.a]);
+            case OpCode::ReturnNull:
+                return Value(nullptr);
+            case OpCode::Closure: {
+                const auto& proto = chunk.functions[ins.b];
+                std::vector<std::shared_ptr<Value>> upvalues;
+                upvalues.reserve(proto->upvalues.size());
+                for (const auto& desc : proto->upvalues) {
+                    upvalues.push_back(desc.from_cell ? cells_[cell_base + desc.index]
+                                                      : fn.upvalues_[desc.index]);
+                }
+                R[ins.a] = Value::make_function(
+                    std::make_shared<CompiledFunction>(proto, env, std::move(upvalues)));
+                break;
+            }
+            case OpCode::Throw:
+                throw ScriptException(ScriptError::UserException, R[ins.a].to_string());
+
+            // Collections
+            case OpCode::NewArray:
+                R[ins.a] = Value::make_array(ValueArray(R + ins.b, R + ins.b + ins.c));
+                break;
+            case OpCode::NewMap: {
+                ValueMap map;
+                for (std::size_t i = 0; i < ins.c; ++i) {
+                    const Value& key = R[ins.b + 2 * i];
+                    map[key.is_string() ? key.as_string() : key.to_string()] = R[ins.b + 2 * i + 1];
+                }
+                R[ins.a] = Value::make_map(std::move(map));
+                break;
+            }
+            case OpCode::NewRange: {
+                std::int64_t start = R[ins.b].as_int();
+                std::int64_t end = R[ins.b + 1].as_int();
+                if (ins.c != 0) ++end;
+                ValueArray arr;
+                if (end > start) {
+                    arr.reserve(static_cast<std::size_t>(end - start));
+                }
+                for (std::int64_t i = start; i < end; ++i) {
+                    arr.push_back(Value(i));
+                }
+                R[ins.a] = Value::make_array(std::move(arr));
+                break;
+            }
+            case OpCode::GetMember:
+            case OpCode::GetMemberOpt: {
+                const Value& object = R[ins.b];
+                if (ins.op == OpCode::GetMemberOpt && object.is_null()) {
+                    R[ins.a] = Value(nullptr);
+                    break;
+                }
+                R[ins.a] = get_member(chunk.property_caches[ins.d], object, K[ins.c].as_string());
+                break;
+            }
+            case OpCode::SetMember:
+                set_member(chunk.property_caches[ins.d], R[ins.b], K[ins.c].as_string(), R[ins.a]);
+                break;
+            case OpCode::GetIndex:
+            case OpCode::GetIndexOpt: {
+                const Value& object = R[ins.b];
+                const Value& index = R[ins.c];
+                if (ins.op == OpCode::GetIndexOpt && object.is_null()) {
+                    R[ins.a] = Value(nullptr);
+                    break;
+                }
+                if (object.is_array()) {
+                    std::int64_t idx = index.as_int();
+                    const auto& arr = object.as_array();
+                    if (idx < 0 || static_cast<std::size_t>(idx) >= arr.size()) {
+                        throw ScriptException(ScriptError::IndexOutOfBounds, "Index out of bounds");
+                    }
+                    R[ins.a] = arr[static_cast<std::size_t>(idx)];
+                    break;
+                }
+                if (object.is_map() && index.is_string()) {
+                    const auto& map = object.as_map();
+                    auto it = map.find(index.as_string());
+                    R[ins.a] = it != map.end() ? it->second : Value(nullptr);
+                    break;
+                }
+                if (object.is_string()) {
+                    std::int64_t idx = index.as_int();
+                    const auto& str = object.as_string();
+                    if (idx < 0 || static_cast<std::size_t>(idx) >= str.size()) {
+                        throw ScriptException(ScriptError::IndexOutOfBounds, "Index out of bounds");
+                    }
+                    R[ins.a] = Value(std::string(1, str[static_cast<std::size_t>(idx)]));
+                    break;
+                }
+                throw ScriptException(ScriptError::NotIndexable, "Value is not indexable");
+            }
+            case OpCode::IterPrep:
+                if (!R[ins.a].is_array()) {
+                    throw ScriptException(ScriptError::NotIterable, "Value is not iterable");
+                }
+                R[ins.a + 1] = Value(std::int64_t{0});
+                break;
+            case OpCode::IterNext: {
+                const auto& arr = R[ins.a].as_array();
+                std::int64_t i = R[ins.a + 1].as_int();
+                if (static_cast<std::size_t>(i) >= arr.size()) {
+                    pc = ins.b;
+                } else {
+                    R[ins.c] = arr[static_cast<std::size_t>(i)];
+                    R[ins.a + 1] = Value(i + 1);
+                }
+                break;
+            }
+
+            // Tree-walker fallback
+            case OpCode::Exec: {
+                Value result = interp_.execute(*chunk.fallbacks[ins.b]);
+                R = registers_.data() + base;
+                if (ins.c != 0) {
+                    R[ins.a] = std::move(result);
+                }
+                break;
+            }
+
+            case OpCode::Count:
+                throw ScriptException(ScriptError::InvalidOperation, "Invalid bytecode");
+        }
+    }
+}
+
+} // namespace void_script
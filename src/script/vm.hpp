@@ -0,0 +1,93 @@
+#pragma once
+
+/// @file vm.hpp
+/// @brief Register bytecode virtual machine for VoidScript
+
+#include "bytecode.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace void_script {
+
+class Environment;
+class Interpreter;
+class VirtualMachine;
+
+// =============================================================================
+// Compiled Function
+// =============================================================================
+
+/// @brief Closure over a compiled chunk
+class CompiledFunction : public Callable {
+public:
+    CompiledFunction(std::shared_ptr<const Chunk> chunk, Environment* globals,
+                     std::vector<std::shared_ptr<Value>> upvalues = {});
+
+    [[nodiscard]] std::size_t arity() const override { return chunk_->required_count; }
+    [[nodiscard]] std::string name() const override { return chunk_->name; }
+    [[nodiscard]] std::string to_string() const override;
+    [[nodiscard]] Value call(Interpreter& interp, const std::vector<Value>& args) override;
+
+    void trace(Tracer& tracer) const override;
+    void clear_references() override;
+
+    [[nodiscard]] const Chunk& chunk() const { return *chunk_; }
+    [[nodiscard]] Environment* globals() const { return globals_; }
+
+private:
+    friend class VirtualMachine;
+
+    std::shared_ptr<const Chunk> chunk_;
+    Environment* globals_;
+    std::vector<std::shared_ptr<Value>> upvalues_;
+};
+
+// =============================================================================
+// Virtual Machine
+// =============================================================================
+
+/// @brief Executes compiled chunks
+///
+/// All frames share one register stack. A call places the callee and its
+/// arguments in consecutive registers of the caller, and the callee's frame
+/// starts at the first argument, so compiled-to-compiled calls copy nothing.
+/// Statements the compiler could not lower are run by the owning
+/// interpreter, which also supplies natives, objects and error reporting.
+class VirtualMachine {
+public:
+    explicit VirtualMachine(Interpreter& interp);
+
+    /// @brief Run a top-level chunk with globals in env
+    Value run(std::shared_ptr<const Chunk> chunk, Environment& env);
+
+    /// @brief Call a compiled function with the given arguments
+    Value call(CompiledFunction& fn, const std::vector<Value>& args);
+
+private:
+    Value execute(CompiledFunction& fn, std::size_t base, std::size_t argc);
+
+    Value* global_slot(const Chunk& chunk, Environment* env, std::uint16_t index);
+    Value get_global(const Chunk& chunk, Environment* env, std::uint16_t index);
+    void set_global(const Chunk& chunk, Environment* env, std::uint16_t index, Value value);
+
+    Value binary(OpCode op, const Value& left, const Value& right);
+
+    /// Call registers_[callee] with argc arguments starting at registers_[args]
+    Value call_registers(std::size_t callee, std::size_t args, std::size_t argc);
+
+    // Member access through a site's inline cache
+    Value get_member(PropertyCache& cache, const Value& object, const std::string& name);
+    void set_member(PropertyCache& cache, Value& object, const std::string& name, Value value);
+    void get_method(PropertyCache& cache, Value& callee, Value& receiver, const std::string& name);
+
+    Interpreter& interp_;
+    std::vector<Value> registers_;
+    std::vector<std::shared_ptr<Value>> cells_;
+    std::size_t top_ = 0;       ///< First register not owned by a frame
+    std::size_t cell_top_ = 0;
+};
+
+} // namespace void_script
@@ -773,9 +773,9 @@ WasmResult<Plugin*> PluginRegistry::load_plugin(const std::filesystem::path& pat
     plugins_[id] = std::move(plugin);
     plugin_names_[name] = id;
 
-    // Track file timestamp for hot reload
+    // Watch source file for hot reload
     if (hot_reload_enabled_) {
-        file_timestamps_[id] = std::filesystem::last_write_time(path);
+        watch_source(id, path);
     }
 
     VOID_LOG_INFO("[PluginRegistry] Loaded plugin '{}' from {}", name, path.string());
@@ -814,7 +814,7 @@ bool PluginRegistry::unload_plugin(PluginId id) {
 
     it->second->unload();
     plugin_names_.erase(name);
-    file_timestamps_.erase(id);
+    unwatch_source(id);
     plugins_.erase(it);
 
     VOID_LOG_INFO("[PluginRegistry] Unloaded plugin '{}'", name);
@@ -957,47 +957,57 @@ void PluginRegistry::enable_hot_reload(bool enabled) {
     hot_reload_enabled_ = enabled;
 
     if (enabled) {
-        // Capture current timestamps for all plugins with source paths
+        // Event-driven watcher shared with the rest of the engine
+        if (!file_watcher_) {
+            file_watcher_ = void_core::create_file_watcher();
+        }
         for (auto& [id, plugin] : plugins_) {
-            const auto& source_path = plugin->source_path();
-            if (!source_path.empty() && std::filesystem::exists(source_path)) {
-                try {
-                    file_timestamps_[id] = std::filesystem::last_write_time(source_path);
-                } catch (const std::filesystem::filesystem_error&) {
-                    // Ignore errors
-                }
-            }
+            watch_source(id, plugin->source_path());
         }
         VOID_LOG_INFO("[PluginRegistry] Hot reload enabled, tracking {} plugins",
-                      file_timestamps_.size());
+                      watched_sources_.size());
     } else {
-        file_timestamps_.clear();
+        file_watcher_.reset();
+        watched_sources_.clear();
         VOID_LOG_INFO("[PluginRegistry] Hot reload disabled");
     }
 }
 
+void PluginRegistry::watch_source(PluginId id, const std::filesystem::path& path) {
+    if (!file_watcher_ || path.empty()) return;
+
+    auto key = path.string();
+    if (file_watcher_->watch(key)) {
+        watched_sources_[key] = id;
+    }
+}
+
+void PluginRegistry::unwatch_source(PluginId id) {
+    for (auto it = watched_sources_.begin(); it != watched_sources_.end(); ++it) {
+        if (it->second == id) {
+            if (file_watcher_) {
+                (void)file_watcher_->unwatch(it->first);
+            }
+            watched_sources_.erase(it);
+            return;
+        }
+    }
+}
+
 void PluginRegistry::check_hot_reload() {
-    if (!hot_reload_enabled_) return;
+    if (!hot_reload_enabled_ || !file_watcher_) return;
 
     std::vector<PluginId> plugins_to_reload;
 
-    for (auto& [id, timestamp] : file_timestamps_) {
-        auto* plugin = get_plugin(id);
-        if (!plugin) continue;
-
-        const auto& source_path = plugin->source_path();
-        if (source_path.empty()) continue;
+    for (const auto& event : file_watcher_->poll()) {
+        if (event.type == void_core::ReloadEventType::FileDeleted) continue;
 
-        try {
-            if (!std::filesystem::exists(source_path)) continue;
+        auto it = watched_sources_.find(event.path);
+        if (it == watched_sources_.end()) continue;
 
-            auto current_time = std::filesystem::last_write_time(source_path);
-            if (current_time > timestamp) {
-                plugins_to_reload.push_back(id);
-                timestamp = current_time;
-            }
-        } catch (const std::filesystem::filesystem_error&) {
-            // Ignore errors during file checks
+        if (std::find(plugins_to_reload.begin(), plugins_to_reload.end(), it->second) ==
+            plugins_to_reload.end()) {
+            plugins_to_reload.push_back(it->second);
         }
     }
 
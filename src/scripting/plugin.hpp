@@ -6,6 +6,7 @@
 #include "wasm.hpp"
 
 #include <void_engine/event/event.hpp>
+#include <void_engine/core/hot_reload.hpp>
 
 #include <chrono>
 #include <filesystem>
@@ -348,8 +349,12 @@ private:
     std::unordered_map<PluginId, std::unique_ptr<Plugin>> plugins_;
     std::unordered_map<std::string, PluginId> plugin_names_;
 
+    void watch_source(PluginId id, const std::filesystem::path& path);
+    void unwatch_source(PluginId id);
+
     bool hot_reload_enabled_ = false;
-    std::unordered_map<PluginId, std::filesystem::file_time_type> file_timestamps_;
+    std::unique_ptr<void_core::FileWatcher> file_watcher_;
+    std::unordered_map<std::string, PluginId> watched_sources_;
 
     inline static std::uint32_t next_plugin_id_ = 1;
 };
@@ -5,6 +5,8 @@
 
 #include <void_engine/core/log.hpp>
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cmath>
 #include <cstring>
@@ -102,6 +104,107 @@ inline int popcnt64(std::uint64_t v) {
 #endif
 }
 
+
+inline StackValue to_stack_value(const WasmValue& v) {
+    StackValue sv;
+    switch (v.type) {
+        case WasmValType::I32: sv.i32 = v.i32; break;
+        case WasmValType::I64: sv.i64 = v.i64; break;
+        case WasmValType::F32: sv.f32 = v.f32; break;
+        case WasmValType::F64: sv.f64 = v.f64; break;
+        default: break;
+    }
+    return sv;
+}
+
+inline WasmValue to_wasm_value(StackValue v, WasmValType type) {
+    WasmValue wv;
+    wv.type = type;
+    switch (type) {
+        case WasmValType::I32: wv.i32 = v.i32; break;
+        case WasmValType::I64: wv.i64 = v.i64; break;
+        case WasmValType::F32: wv.f32 = v.f32; break;
+        case WasmValType::F64: wv.f64 = v.f64; break;
+        default: break;
+    }
+    return wv;
+}
+
+// =============================================================================
+// Dispatch table
+// =============================================================================
+
+// Every opcode the interpreter executes, in dispatch-table order
+#define VOID_WASM_OPCODES(X)                                                    \
+    X(Unreachable) X(Nop) X(Block) X(Loop) X(If) X(Else) X(End) X(Br) X(BrIf)   \
+    X(BrTable) X(Return) X(Call) X(CallIndirect) X(Drop) X(Select)              \
+    X(LocalGet) X(LocalSet) X(LocalTee) X(GlobalGet) X(GlobalSet)               \
+    X(I32Load) X(I64Load) X(F32Load) X(F64Load) X(I32Load8S) X(I32Load8U)       \
+    X(I32Load16S) X(I32Load16U) X(I64Load8S) X(I64Load8U) X(I64Load16S)         \
+    X(I64Load16U) X(I64Load32S) X(I64Load32U) X(I32Store) X(I64Store)           \
+    X(F32Store) X(F64Store) X(I32Store8) X(I32Store16) X(I64Store8)             \
+    X(I64Store16) X(I64Store32) X(MemorySize) X(MemoryGrow)                     \
+    X(I32Const) X(I64Const) X(F32Const) X(F64Const)                             \
+    X(I32Eqz) X(I32Eq) X(I32Ne) X(I32LtS) X(I32LtU) X(I32GtS) X(I32GtU)         \
+    X(I32LeS) X(I32LeU) X(I32GeS) X(I32GeU)                                     \
+    X(I64Eqz) X(I64Eq) X(I64Ne) X(I64LtS) X(I64LtU) X(I64GtS) X(I64GtU)         \
+    X(I64LeS) X(I64LeU) X(I64GeS) X(I64GeU)                                     \
+    X(F32Eq) X(F32Ne) X(F32Lt) X(F32Gt) X(F32Le) X(F32Ge)                       \
+    X(F64Eq) X(F64Ne) X(F64Lt) X(F64Gt) X(F64Le) X(F64Ge)                       \
+    X(I32Clz) X(I32Ctz) X(I32Popcnt) X(I32Add) X(I32Sub) X(I32Mul) X(I32DivS)   \
+    X(I32DivU) X(I32RemS) X(I32RemU) X(I32And) X(I32Or) X(I32Xor) X(I32Shl)     \
+    X(I32ShrS) X(I32ShrU) X(I32Rotl) X(I32Rotr)                                 \
+    X(I64Clz) X(I64Ctz) X(I64Popcnt) X(I64Add) X(I64Sub) X(I64Mul) X(I64DivS)   \
+    X(I64DivU) X(I64RemS) X(I64RemU) X(I64And) X(I64Or) X(I64Xor) X(I64Shl)     \
+    X(I64ShrS) X(I64ShrU) X(I64Rotl) X(I64Rotr)                                 \
+    X(F32Abs) X(F32Neg) X(F32Ceil) X(F32Floor) X(F32Trunc) X(F32Nearest)        \
+    X(F32Sqrt) X(F32Add) X(F32Sub) X(F32Mul) X(F32Div) X(F32Min) X(F32Max)      \
+    X(F32Copysign)                                                              \
+    X(F64Abs) X(F64Neg) X(F64Ceil) X(F64Floor) X(F64Trunc) X(F64Nearest)        \
+    X(F64Sqrt) X(F64Add) X(F64Sub) X(F64Mul) X(F64Div) X(F64Min) X(F64Max)      \
+    X(F64Copysign)                                                              \
+    X(I32WrapI64) X(I32TruncF32S) X(I32TruncF32U) X(I32TruncF64S)               \
+    X(I32TruncF64U) X(I64ExtendI32S) X(I64ExtendI32U) X(I64TruncF32S)           \
+    X(I64TruncF32U) X(I64TruncF64S) X(I64TruncF64U) X(F32ConvertI32S)           \
+    X(F32ConvertI32U) X(F32ConvertI64S) X(F32ConvertI64U) X(F32DemoteF64)       \
+    X(F64ConvertI32S) X(F64ConvertI32U) X(F64ConvertI64S) X(F64ConvertI64U)     \
+    X(F64PromoteF32) X(I32ReinterpretF32) X(I64ReinterpretF64)                  \
+    X(F32ReinterpretI32) X(F64ReinterpretI64)                                   \
+    X(I32Extend8S) X(I32Extend16S) X(I64Extend8S) X(I64Extend16S)               \
+    X(I64Extend32S) X(PrefixFC)
+
+// Opcode byte -> dense handler index (0 = unsupported)
+constexpr std::array<std::uint8_t, 256> k_handler_index = [] {
+    std::array<std::uint8_t, 256> table{};
+    std::uint8_t next = 1;
+#define VOID_WASM_HANDLER_INDEX(name) table[static_cast<std::uint8_t>(WasmOpcode::name)] = next++;
+    VOID_WASM_OPCODES(VOID_WASM_HANDLER_INDEX)
+#undef VOID_WASM_HANDLER_INDEX
+    return table;
+}();
+
+// Instructions after which a new basic block starts
+inline bool ends_basic_block(WasmOpcode op) {
+    switch (op) {
+        case WasmOpcode::Unreachable:
+        case WasmOpcode::Block:
+        case WasmOpcode::Loop:
+        case WasmOpcode::If:
+        case WasmOpcode::Else:
+        case WasmOpcode::End:
+        case WasmOpcode::Br:
+        case WasmOpcode::BrIf:
+        case WasmOpcode::BrTable:
+        case WasmOpcode::Return:
+        case WasmOpcode::Call:
+        case WasmOpcode::CallIndirect:
+            return true;
+        default:
+            return false;
+    }
+}
+
+constexpr std::size_t k_max_call_depth = 1024;
 } // anonymous namespace
 
 // =============================================================================
@@ -111,6 +214,8 @@ inline int popcnt64(std::uint64_t v) {
 WasmInterpreter::WasmInterpreter() {
     stack_.reserve(1024);
     call_stack_.reserve(64);
+    locals_.reserve(1024);
+    labels_.reserve(256);
 }
 
 WasmInterpreter::~WasmInterpreter() = default;
@@ -258,6 +363,7 @@ void WasmInterpreter::parse_import_section(ParsedModule& module) {
                 if (type_idx < module.types.size()) {
                     import.func_type = module.types[type_idx];
                 }
+                module.function_imports.push_back(module.imports.size());
                 module.num_imported_functions++;
                 break;
             }
@@ -425,6 +531,9 @@ void WasmInterpreter::parse_code_section(ParsedModule& module) {
     module.functions.reserve(count);
 
     for (std::uint32_t i = 0; i < count; ++i) {
+        if (i >= module.function_type_indices.size()) {
+            throw WasmException(WasmError::InvalidModule, "Code section does not match function section");
+        }
         WasmFunction func;
         func.type_index = module.function_type_indices[i];
 
@@ -443,8 +552,8 @@ void WasmInterpreter::parse_code_section(ParsedModule& module) {
 
         // Function code
         func.code_offset = pos_;
-        std::size_t code_size = body_end - pos_;
         func.code.assign(binary_.data() + pos_, binary_.data() + body_end);
+        translate_function(module, func, body_end);
         pos_ = body_end;
 
         module.functions.push_back(std::move(func));
@@ -479,6 +588,303 @@ void WasmInterpreter::parse_data_section(ParsedModule& module) {
     }
 }
 
+// =============================================================================
+// Translation
+// =============================================================================
+
+void WasmInterpreter::translate_function(const ParsedModule& module, WasmFunction& func, std::size_t body_end) {
+    struct Fixup {
+        bool table;            // Patch branch_tables[index] instead of instructions[index].b
+        std::uint32_t index;
+    };
+
+    struct Control {
+        WasmOpcode opcode;
+        std::uint32_t start;          // Index of the Block/Loop/If instruction
+        std::vector<Fixup> fixups;    // Forward branches waiting for the matching End
+    };
+
+    if (func.type_index >= module.types.size()) {
+        throw WasmException(WasmError::InvalidModule, "Invalid function type index");
+    }
+    const WasmFunctionType& func_type = module.types[func.type_index];
+    const std::size_t local_count = func_type.params.size() + func.locals.size();
+    const std::size_t function_count = module.num_imported_functions + module.function_type_indices.size();
+
+    auto& out = func.instructions;
+    out.clear();
+    out.reserve((body_end - pos_) / 2);
+    func.branch_tables.clear();
+
+    std::vector<Control> controls;
+    controls.push_back(Control{WasmOpcode::Block, 0, {}});  // Function body
+
+    auto patch = [&](Fixup fixup, std::uint32_t target) {
+        if (fixup.table) {
+            func.branch_tables[fixup.index] = target;
+        } else {
+            out[fixup.index].b = target;
+        }
+    };
+
+    // Loops branch backwards to their first body instruction; everything else
+    // lands on its End, which is only known once that End is reached
+    auto resolve_branch = [&](std::uint32_t depth, Fixup fixup) -> std::uint32_t {
+        if (depth >= controls.size()) {
+            throw WasmException(WasmError::InvalidModule, "Invalid branch depth");
+        }
+        Control& target = controls[controls.size() - 1 - depth];
+        if (target.opcode == WasmOpcode::Loop) {
+            return target.start + 1;
+        }
+        target.fixups.push_back(fixup);
+        return 0;
+    };
+
+    auto read_block_arity = [&](WasmOpcode op) -> std::uint8_t {
+        if (pos_ >= body_end) {
+            throw WasmException(WasmError::InvalidModule, "Unexpected end of function body");
+        }
+        std::uint8_t type = binary_[pos_];
+        if (type == 0x40) {
+            ++pos_;
+            return 0;
+        }
+        if ((type >= 0x7b && type <= 0x7f) || type == 0x70 || type == 0x6f) {
+            ++pos_;
+            return 1;
+        }
+        std::int64_t type_idx = read_i64_leb128();
+        if (type_idx < 0 || static_cast<std::size_t>(type_idx) >= module.types.size()) {
+            throw WasmException(WasmError::InvalidModule, "Invalid block type");
+        }
+        const auto& block_type = module.types[static_cast<std::size_t>(type_idx)];
+        std::size_t arity = (op == WasmOpcode::Loop) ? block_type.params.size() : block_type.results.size();
+        if (arity > 0xFF) {
+            throw WasmException(WasmError::InvalidModule, "Block type has too many values");
+        }
+        return static_cast<std::uint8_t>(arity);
+    };
+
+    while (!controls.empty()) {
+        if (pos_ >= body_end) {
+            throw WasmException(WasmError::InvalidModule, "Unterminated function body");
+        }
+
+        WasmInstr ins;
+        ins.opcode = static_cast<WasmOpcode>(read_byte());
+        ins.handler = k_handler_index[static_cast<std::uint8_t>(ins.opcode)];
+        if (ins.handler == 0) {
+            throw WasmException(WasmError::InvalidModule, "Unsupported opcode");
+        }
+        const auto index = static_cast<std::uint32_t>(out.size());
+
+        switch (ins.opcode) {
+            case WasmOpcode::Block:
+            case WasmOpcode::Loop:
+            case WasmOpcode::If:
+                ins.arity = read_block_arity(ins.opcode);
+                controls.push_back(Control{ins.opcode, index, {}});
+                break;
+
+            case WasmOpcode::Else: {
+                Control& control = controls.back();
+                if (control.opcode != WasmOpcode::If || out[control.start].a != 0) {
+                    throw WasmException(WasmError::InvalidModule, "Else without matching If");
+                }
+                out[control.start].a = index + 1;
+                control.fixups.push_back(Fixup{false, index});
+                break;
+            }
+
+            case WasmOpcode::End: {
+                Control control = std::move(controls.back());
+                controls.pop_back();
+                for (const Fixup& fixup : control.fixups) {
+                    patch(fixup, index);
+                }
+                if (control.opcode == WasmOpcode::If) {
+                    out[control.start].b = index;
+                }
+                if (controls.empty()) {
+                    // End of the function body
+                    ins.opcode = WasmOpcode::Return;
+                    ins.handler = k_handler_index[static_cast<std::uint8_t>(WasmOpcode::Return)];
+                }
+                break;
+            }
+
+            case WasmOpcode::Br:
+            case WasmOpcode::BrIf:
+                ins.a = read_u32_leb128();
+                ins.b = resolve_branch(ins.a, Fixup{false, index});
+                break;
+
+            case WasmOpcode::BrTable: {
+                ins.a = read_u32_leb128();
+                if (ins.a > body_end - pos_) {
+                    throw WasmException(WasmError::InvalidModule, "Branch table too large");
+                }
+                ins.b = static_cast<std::uint32_t>(func.branch_tables.size());
+                for (std::uint32_t i = 0; i <= ins.a; ++i) {
+                    std::uint32_t depth = read_u32_leb128();
+                    auto slot = static_cast<std::uint32_t>(func.branch_tables.size());
+                    func.branch_tables.push_back(depth);
+                    func.branch_tables.push_back(0);
+                    func.branch_tables[slot + 1] = resolve_branch(depth, Fixup{true, slot + 1});
+                }
+                break;
+            }
+
+            case WasmOpcode::Call:
+                ins.a = read_u32_leb128();
+                if (ins.a >= function_count) {
+                    throw WasmException(WasmError::InvalidModule, "Invalid function index");
+                }
+                break;
+
+            case WasmOpcode::CallIndirect:
+                ins.a = read_u32_leb128();
+                ins.b = read_u32_leb128();
+                if (ins.a >= module.types.size()) {
+                    throw WasmException(WasmError::InvalidModule, "Invalid type index");
+                }
+                break;
+
+            case WasmOpcode::LocalGet:
+            case WasmOpcode::LocalSet:
+            case WasmOpcode::LocalTee:
+                ins.a = read_u32_leb128();
+                if (ins.a >= local_count) {
+                    throw WasmException(WasmError::InvalidModule, "Invalid local index");
+                }
+                break;
+
+            case WasmOpcode::GlobalGet:
+            case WasmOpcode::GlobalSet:
+                ins.a = read_u32_leb128();
+                if (ins.a >= module.globals.size()) {
+                    throw WasmException(WasmError::InvalidModule, "Invalid global index");
+                }
+                break;
+
+            case WasmOpcode::MemorySize:
+            case WasmOpcode::MemoryGrow:
+                read_byte();  // memory index (always 0)
+                break;
+
+            case WasmOpcode::I32Const:
+                ins.value = StackValue{read_i32_leb128()};
+                break;
+
+            case WasmOpcode::I64Const:
+                ins.value = StackValue{read_i64_leb128()};
+                break;
+
+            case WasmOpcode::F32Const:
+                if (body_end - pos_ < 4) {
+                    throw WasmException(WasmError::InvalidModule, "Unexpected end of function body");
+                }
+                ins.value = StackValue{read_f32()};
+                break;
+
+            case WasmOpcode::F64Const:
+                if (body_end - pos_ < 8) {
+                    throw WasmException(WasmError::InvalidModule, "Unexpected end of function body");
+                }
+                ins.value = StackValue{read_f64()};
+                break;
+
+            case WasmOpcode::PrefixFC:
+                ins.a = read_u32_leb128();
+                switch (ins.a) {
+                    case 0: case 1: case 2: case 3:
+                    case 4: case 5: case 6: case 7:
+                        break;
+                    case 8:  // memory.init
+                        read_u32_leb128();
+                        read_byte();
+                        break;
+                    case 10: // memory.copy
+                        read_byte();
+                        read_byte();
+                        break;
+                    case 11: // memory.fill
+                        read_byte();
+                        break;
+                    case 12: // table.init
+                    case 14: // table.copy
+                        read_u32_leb128();
+                        read_u32_leb128();
+                        break;
+                    case 9:  // data.drop
+                    case 13: // elem.drop
+                    case 15: // table.grow
+                    case 16: // table.size
+                    case 17: // table.fill
+                        read_u32_leb128();
+                        break;
+                    default:
+                        throw WasmException(WasmError::InvalidModule, "Unsupported opcode");
+                }
+                break;
+
+            default:
+                if (ins.opcode >= WasmOpcode::I32Load && ins.opcode <= WasmOpcode::I64Store32) {
+                    read_u32_leb128();  // align
+                    ins.a = read_u32_leb128();
+                }
+                break;
+        }
+
+        out.push_back(ins);
+    }
+
+    if (pos_ != body_end) {
+        throw WasmException(WasmError::InvalidModule, "Function body size mismatch");
+    }
+
+    // Split into basic blocks; each block's leader carries the fuel for the
+    // whole block so metering costs one check per block instead of per opcode
+    std::vector<bool> leader(out.size() + 1, false);
+    leader[0] = true;
+    leader[out.size()] = true;
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        const WasmInstr& ins = out[i];
+        if (ends_basic_block(ins.opcode)) {
+            leader[i + 1] = true;
+        }
+        switch (ins.opcode) {
+            case WasmOpcode::If:
+                if (ins.a != 0) {
+                    leader[ins.a] = true;
+                }
+                leader[ins.b] = true;
+                break;
+            case WasmOpcode::Else:
+            case WasmOpcode::Br:
+            case WasmOpcode::BrIf:
+                leader[ins.b] = true;
+                break;
+            default:
+                break;
+        }
+    }
+    for (std::size_t i = 1; i < func.branch_tables.size(); i += 2) {
+        leader[func.branch_tables[i]] = true;
+    }
+
+    std::size_t block_start = 0;
+    for (std::size_t i = 1; i <= out.size(); ++i) {
+        if (leader[i]) {
+            out[block_start].fuel = static_cast<std::uint32_t>(i - block_start);
+            block_start = i;
+        }
+    }
+
+    out.shrink_to_fit();
+}
+
 // =============================================================================
 // Module Parsing
 // =============================================================================
@@ -641,45 +1047,19 @@ StackValue WasmInterpreter::pop() {
 // Label Operations
 // =============================================================================
 
-void WasmInterpreter::push_label(LabelKind kind, std::size_t pc, std::size_t arity, std::size_t end_pc) {
-    Label label;
-    label.kind = kind;
-    label.pc = pc;
-    label.stack_height = stack_.size();
-    label.arity = arity;
-    label.end_pc = end_pc;
-    call_stack_.back().labels.push_back(label);
-}
-
-void WasmInterpreter::pop_label() {
-    call_stack_.back().labels.pop_back();
-}
-
-Label& WasmInterpreter::get_label(std::uint32_t depth) {
-    auto& labels = call_stack_.back().labels;
-    return labels[labels.size() - 1 - depth];
-}
-
 void WasmInterpreter::branch(std::uint32_t depth) {
-    Label& label = get_label(depth);
-
-    // Save result values
-    std::vector<StackValue> results;
-    for (std::size_t i = 0; i < label.arity; ++i) {
-        results.push_back(pop());
+    const Label label = labels_[labels_.size() - 1 - depth];
+    if (stack_.size() < label.stack_height + label.arity) {
+        throw WasmException(WasmError::StackUnderflow, "Stack underflow");
     }
 
-    // Unwind stack to label height
-    stack_.resize(label.stack_height);
+    // Move the label's result values down to its entry height
+    std::copy(stack_.end() - static_cast<std::ptrdiff_t>(label.arity), stack_.end(),
+              stack_.begin() + static_cast<std::ptrdiff_t>(label.stack_height));
+    stack_.resize(label.stack_height + label.arity);
 
-    // Push results back
-    for (auto it = results.rbegin(); it != results.rend(); ++it) {
-        push(*it);
-    }
-
-    // Pop labels up to and including target
-    auto& labels = call_stack_.back().labels;
-    labels.resize(labels.size() - depth);
+    // Pop labels up to (but not including) the target
+    labels_.resize(labels_.size() - depth);
 }
 
 // =============================================================================
@@ -709,10 +1089,13 @@ WasmResult<std::vector<WasmValue>> WasmInterpreter::call_host_function(
 // Fuel
 // =============================================================================
 
-bool WasmInterpreter::consume_fuel() {
+bool WasmInterpreter::consume_fuel(std::uint32_t amount) {
     if (!fuel_enabled_) return true;
-    if (fuel_ == 0) return false;
-    --fuel_;
+    if (fuel_ < amount) {
+        fuel_ = 0;
+        return false;
+    }
+    fuel_ -= amount;
     return true;
 }
 
@@ -758,20 +1141,13 @@ WasmResult<std::vector<WasmValue>> WasmInterpreter::execute(
     // Clear execution state
     stack_.clear();
     call_stack_.clear();
+    locals_.clear();
+    labels_.clear();
 
     // Check if it's an imported function
     if (function_index < module.num_imported_functions) {
-        // Find the import
-        std::uint32_t import_idx = 0;
-        for (const auto& imp : module.imports) {
-            if (imp.kind == WasmExternKind::Func) {
-                if (import_idx == function_index) {
-                    return call_host_function(imp.module, imp.name, args);
-                }
-                ++import_idx;
-            }
-        }
-        return void_core::Error{void_core::ErrorCode::NotFound, "WASM export not found"};
+        const WasmImport& imp = module.imports[module.function_imports[function_index]];
+        return call_host_function(imp.module, imp.name, args);
     }
 
     // Get the function
@@ -782,783 +1158,512 @@ WasmResult<std::vector<WasmValue>> WasmInterpreter::execute(
 
     const WasmFunction& func = module.functions[local_func_idx];
     const WasmFunctionType& func_type = module.types[func.type_index];
-
-    // Create call frame
-    CallFrame frame;
-    frame.function_index = function_index;
-    frame.return_pc = 0;
-    frame.stack_base = 0;
-
-    // Initialize locals from parameters
-    for (std::size_t i = 0; i < args.size(); ++i) {
-        StackValue v;
-        switch (args[i].type) {
-            case WasmValType::I32: v.i32 = args[i].i32; break;
-            case WasmValType::I64: v.i64 = args[i].i64; break;
-            case WasmValType::F32: v.f32 = args[i].f32; break;
-            case WasmValType::F64: v.f64 = args[i].f64; break;
-            default: v.i64 = 0; break;
-        }
-        frame.locals.push_back(v);
+    if (args.size() != func_type.params.size()) {
+        return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM argument count mismatch"};
     }
 
-    // Add declared locals (initialized to 0)
-    for (const auto& local_type : func.locals) {
-        frame.locals.push_back(StackValue{});
+    // Arguments are passed on the operand stack
+    for (const auto& arg : args) {
+        push(to_stack_value(arg));
     }
 
-    call_stack_.push_back(std::move(frame));
-
-    // Push function label
-    push_label(LabelKind::Function, 0, func_type.results.size(), func.code.size());
-
-    // Execute the code
-    auto result = execute_code(module, memory, func.code);
+    auto result = execute_function(module, memory, function_index);
     if (!result) {
         return result.error();
     }
 
-    // Collect results
+    // Collect results (execute_function leaves exactly the results on the stack)
     std::vector<WasmValue> results;
+    results.reserve(func_type.results.size());
     for (std::size_t i = 0; i < func_type.results.size(); ++i) {
-        if (stack_.empty()) {
-            return void_core::Error{void_core::ErrorCode::InvalidState, "WASM stack underflow"};
-        }
-        StackValue v = pop();
-        WasmValue wv;
-        wv.type = func_type.results[func_type.results.size() - 1 - i];
-        switch (wv.type) {
-            case WasmValType::I32: wv.i32 = v.i32; break;
-            case WasmValType::I64: wv.i64 = v.i64; break;
-            case WasmValType::F32: wv.f32 = v.f32; break;
-            case WasmValType::F64: wv.f64 = v.f64; break;
-            default: break;
-        }
-        results.push_back(wv);
+        results.push_back(to_wasm_value(stack_[i], func_type.results[i]));
     }
 
-    std::reverse(results.begin(), results.end());
     return std::move(results);
 }
 
-WasmResult<void> WasmInterpreter::execute_code(
+WasmResult<void> WasmInterpreter::execute_function(
     const ParsedModule& module,
     WasmMemory& memory,
-    const std::vector<std::uint8_t>& code) {
+    std::uint32_t func_index) {
 
-    std::size_t pc = 0;
-    CallFrame* frame = &call_stack_.back();
+    if (func_index < module.num_imported_functions) {
+        return call_import(module, func_index);
+    }
 
-    auto read_byte_local = [&]() -> std::uint8_t {
-        return code[pc++];
-    };
+    std::uint32_t local_func_idx = func_index - module.num_imported_functions;
+    if (local_func_idx >= module.functions.size()) {
+        return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM invalid function"};
+    }
+    if (call_stack_.size() >= k_max_call_depth) {
+        return void_core::Error{void_core::ErrorCode::InvalidState, "WASM call stack exhausted"};
+    }
 
-    auto read_u32_leb_local = [&]() -> std::uint32_t {
-        std::uint32_t result = 0;
-        std::uint32_t shift = 0;
-        std::uint8_t byte;
-        do {
-            byte = code[pc++];
-            result |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
-            shift += 7;
-        } while (byte & 0x80);
-        return result;
-    };
+    const WasmFunction& func = module.functions[local_func_idx];
+    const WasmFunctionType& func_type = module.types[func.type_index];
+    const std::size_t param_count = func_type.params.size();
+    const std::size_t arity = func_type.results.size();
+    if (stack_.size() < param_count) {
+        return void_core::Error{void_core::ErrorCode::InvalidState, "WASM stack underflow"};
+    }
 
-    auto read_i32_leb_local = [&]() -> std::int32_t {
-        std::int32_t result = 0;
-        std::uint32_t shift = 0;
-        std::uint8_t byte;
-        do {
-            byte = code[pc++];
-            result |= static_cast<std::int32_t>(byte & 0x7f) << shift;
-            shift += 7;
-        } while (byte & 0x80);
-        if (shift < 32 && (byte & 0x40)) result |= (~0u << shift);
-        return result;
-    };
+    // Parameters move from the operand stack into the frame's locals;
+    // declared locals start zeroed
+    CallFrame frame;
+    frame.function_index = func_index;
+    frame.stack_base = stack_.size() - param_count;
+    frame.locals_base = locals_.size();
+    frame.label_base = labels_.size();
+
+    locals_.insert(locals_.end(), stack_.begin() + static_cast<std::ptrdiff_t>(frame.stack_base), stack_.end());
+    locals_.resize(frame.locals_base + param_count + func.locals.size());
+    stack_.resize(frame.stack_base);
+    call_stack_.push_back(frame);
+
+    // Function label (branches to it return)
+    push_label(arity);
+
+    auto result = execute_code(module, memory, func);
+
+    locals_.resize(frame.locals_base);
+    labels_.resize(frame.label_base);
+    call_stack_.pop_back();
 
-    auto read_i64_leb_local = [&]() -> std::int64_t {
-        std::int64_t result = 0;
-        std::uint64_t shift = 0;
-        std::uint8_t byte;
-        do {
-            byte = code[pc++];
-            result |= static_cast<std::int64_t>(byte & 0x7f) << shift;
-            shift += 7;
-        } while (byte & 0x80);
-        if (shift < 64 && (byte & 0x40)) result |= (~0ull << shift);
+    if (!result) {
         return result;
-    };
+    }
+    if (stack_.size() < frame.stack_base + arity) {
+        return void_core::Error{void_core::ErrorCode::InvalidState, "WASM stack underflow"};
+    }
 
-    auto read_f32_local = [&]() -> float {
-        float v;
-        std::memcpy(&v, code.data() + pc, 4);
-        pc += 4;
-        return v;
-    };
+    // Leave exactly the results on the stack
+    std::copy(stack_.end() - static_cast<std::ptrdiff_t>(arity), stack_.end(),
+              stack_.begin() + static_cast<std::ptrdiff_t>(frame.stack_base));
+    stack_.resize(frame.stack_base + arity);
+    return void_core::Ok();
+}
 
-    auto read_f64_local = [&]() -> double {
-        double v;
-        std::memcpy(&v, code.data() + pc, 8);
-        pc += 8;
-        return v;
-    };
+WasmResult<void> WasmInterpreter::call_import(
+    const ParsedModule& module,
+    std::uint32_t func_index) {
 
-    // Find matching end for block/loop/if
-    auto find_end = [&](std::size_t start) -> std::size_t {
-        std::size_t depth = 1;
-        std::size_t i = start;
-        while (i < code.size() && depth > 0) {
-            std::uint8_t op = code[i++];
-            switch (static_cast<WasmOpcode>(op)) {
-                case WasmOpcode::Block:
-                case WasmOpcode::Loop:
-                case WasmOpcode::If:
-                    ++depth;
-                    // Skip block type
-                    if (code[i] == 0x40 || (code[i] >= 0x7c && code[i] <= 0x7f)) {
-                        ++i;
-                    } else {
-                        while (code[i++] & 0x80) {}
-                    }
-                    break;
-                case WasmOpcode::End:
-                    --depth;
-                    break;
-                default:
-                    // Skip instruction operands (simplified)
-                    break;
-            }
-        }
-        return i;
+    const WasmImport& imp = module.imports[module.function_imports[func_index]];
+    const std::size_t param_count = imp.func_type ? imp.func_type->params.size() : 0;
+    if (stack_.size() < param_count) {
+        return void_core::Error{void_core::ErrorCode::InvalidState, "WASM stack underflow"};
+    }
+
+    // Pop arguments
+    const std::size_t base = stack_.size() - param_count;
+    std::vector<WasmValue> args;
+    args.reserve(param_count);
+    for (std::size_t i = 0; i < param_count; ++i) {
+        args.push_back(to_wasm_value(stack_[base + i], imp.func_type->params[i]));
+    }
+    stack_.resize(base);
+
+    auto result = call_host_function(imp.module, imp.name, args);
+    if (!result) {
+        return result.error();
+    }
+
+    // Push results
+    for (const auto& rv : result.value()) {
+        push(to_stack_value(rv));
+    }
+    return void_core::Ok();
+}
+
+// Computed-goto dispatch on GCC/Clang: every handler ends with its own
+// indirect jump, which predicts far better than a single shared switch
+#if defined(__GNUC__)
+#define VOID_WASM_THREADED_DISPATCH 1
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#else
+#define VOID_WASM_THREADED_DISPATCH 0
+#endif
+
+WasmResult<void> WasmInterpreter::execute_code(
+    const ParsedModule& module,
+    WasmMemory& memory,
+    const WasmFunction& func) {
+
+    const WasmInstr* const code = func.instructions.data();
+    const WasmInstr* ip = code;
+    const WasmInstr* in = nullptr;
+    const bool metered = fuel_enabled_;
+    const std::size_t locals_base = call_stack_.back().locals_base;
+    StackValue* locals = locals_.data() + locals_base;
+
+#if VOID_WASM_THREADED_DISPATCH
+    static const void* const handlers[] = {
+        &&op_invalid,
+#define VOID_WASM_LABEL_ADDRESS(name) &&op_##name,
+        VOID_WASM_OPCODES(VOID_WASM_LABEL_ADDRESS)
+#undef VOID_WASM_LABEL_ADDRESS
     };
 
-    while (pc < code.size()) {
-        if (!consume_fuel()) {
-            return void_core::Error{void_core::ErrorCode::Timeout, "WASM fuel exhausted"};
-        }
+#define VOID_WASM_OP(name) op_##name:
+#define VOID_WASM_NEXT()                                                        \
+    do {                                                                        \
+        in = ip++;                                                              \
+        if (metered && in->fuel != 0 && !consume_fuel(in->fuel)) goto out_of_fuel; \
+        goto *handlers[in->handler];                                            \
+    } while (0)
+
+    VOID_WASM_NEXT();
+#else
+#define VOID_WASM_OP(name) case WasmOpcode::name:
+#define VOID_WASM_NEXT() continue
 
-        std::uint8_t opcode = read_byte_local();
-        WasmOpcode op = static_cast<WasmOpcode>(opcode);
+    for (;;) {
+        in = ip++;
+        if (metered && in->fuel != 0 && !consume_fuel(in->fuel)) goto out_of_fuel;
 
-        switch (op) {
+        switch (in->opcode) {
+#endif
             // ================================================================
             // Control Flow
             // ================================================================
-            case WasmOpcode::Unreachable:
+            VOID_WASM_OP(Unreachable)
                 return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
 
-            case WasmOpcode::Nop:
-                break;
+            VOID_WASM_OP(Nop)
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::Block: {
-                std::uint8_t block_type = read_byte_local();
-                std::size_t arity = (block_type == 0x40) ? 0 : 1;
-                std::size_t end_pc = find_end(pc);
-                push_label(LabelKind::Block, pc, arity, end_pc);
-                break;
-            }
+            VOID_WASM_OP(Block)
+            VOID_WASM_OP(Loop)
+                push_label(in->arity);
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::Loop: {
-                std::uint8_t block_type = read_byte_local();
-                std::size_t arity = 0;  // Loop branches don't pass values
-                std::size_t end_pc = find_end(pc);
-                push_label(LabelKind::Loop, pc, arity, end_pc);
-                break;
-            }
-
-            case WasmOpcode::If: {
-                std::uint8_t block_type = read_byte_local();
-                std::size_t arity = (block_type == 0x40) ? 0 : 1;
+            VOID_WASM_OP(If) {
                 StackValue cond = pop();
-                std::size_t end_pc = find_end(pc);
-
-                if (cond.i32) {
-                    push_label(LabelKind::If, pc, arity, end_pc);
-                } else {
-                    // Find else or end
-                    std::size_t depth = 1;
-                    while (pc < code.size() && depth > 0) {
-                        std::uint8_t byte = code[pc++];
-                        WasmOpcode inner_op = static_cast<WasmOpcode>(byte);
-                        if (inner_op == WasmOpcode::Block || inner_op == WasmOpcode::Loop ||
-                            inner_op == WasmOpcode::If) {
-                            ++depth;
-                            pc++;  // Skip block type
-                        } else if (inner_op == WasmOpcode::End) {
-                            --depth;
-                        } else if (inner_op == WasmOpcode::Else && depth == 1) {
-                            push_label(LabelKind::Else, pc, arity, end_pc);
-                            break;
-                        }
-                    }
+                push_label(in->arity);
+                if (!cond.i32) {
+                    // Else body, or the End (which pops the label)
+                    ip = code + (in->a != 0 ? in->a : in->b);
                 }
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::Else: {
-                // Jump to end
-                Label& label = get_label(0);
-                pc = label.end_pc - 1;
-                break;
-            }
+            VOID_WASM_OP(Else)
+                // End of the then-body: skip the else-body
+                ip = code + in->b;
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::End: {
-                if (frame->labels.empty()) {
-                    return void_core::Ok();  // Function end
-                }
+            VOID_WASM_OP(End)
                 pop_label();
-                break;
-            }
-
-            case WasmOpcode::Br: {
-                std::uint32_t depth = read_u32_leb_local();
-                Label& target = get_label(depth);
-                if (target.kind == LabelKind::Loop) {
-                    pc = target.pc;
-                } else {
-                    pc = target.end_pc - 1;
-                }
-                branch(depth);
-                break;
-            }
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::BrIf: {
-                std::uint32_t depth = read_u32_leb_local();
-                StackValue cond = pop();
-                if (cond.i32) {
-                    Label& target = get_label(depth);
-                    if (target.kind == LabelKind::Loop) {
-                        pc = target.pc;
-                    } else {
-                        pc = target.end_pc - 1;
-                    }
-                    branch(depth);
-                }
-                break;
-            }
+            VOID_WASM_OP(Br)
+                branch(in->a);
+                ip = code + in->b;
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::BrTable: {
-                std::uint32_t count = read_u32_leb_local();
-                std::vector<std::uint32_t> targets(count);
-                for (std::uint32_t i = 0; i < count; ++i) {
-                    targets[i] = read_u32_leb_local();
+            VOID_WASM_OP(BrIf)
+                if (pop().i32) {
+                    branch(in->a);
+                    ip = code + in->b;
                 }
-                std::uint32_t default_target = read_u32_leb_local();
-
-                StackValue idx = pop();
-                std::uint32_t target = (static_cast<std::uint32_t>(idx.i32) < count)
-                    ? targets[idx.i32] : default_target;
+                VOID_WASM_NEXT();
 
-                Label& label = get_label(target);
-                if (label.kind == LabelKind::Loop) {
-                    pc = label.pc;
-                } else {
-                    pc = label.end_pc - 1;
-                }
-                branch(target);
-                break;
+            VOID_WASM_OP(BrTable) {
+                std::uint32_t idx = pop().u32;
+                const std::uint32_t* entry = func.branch_tables.data() + in->b + 2 * std::min(idx, in->a);
+                branch(entry[0]);
+                ip = code + entry[1];
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::Return:
+            VOID_WASM_OP(Return)
                 return void_core::Ok();
 
-            case WasmOpcode::Call: {
-                std::uint32_t func_idx = read_u32_leb_local();
-
-                // Check if imported function
-                if (func_idx < module.num_imported_functions) {
-                    std::uint32_t imp_idx = 0;
-                    for (const auto& imp : module.imports) {
-                        if (imp.kind == WasmExternKind::Func) {
-                            if (imp_idx == func_idx) {
-                                // Pop arguments
-                                std::vector<WasmValue> args;
-                                for (std::size_t i = 0; i < imp.func_type->params.size(); ++i) {
-                                    StackValue v = pop();
-                                    WasmValue wv;
-                                    wv.type = imp.func_type->params[imp.func_type->params.size() - 1 - i];
-                                    switch (wv.type) {
-                                        case WasmValType::I32: wv.i32 = v.i32; break;
-                                        case WasmValType::I64: wv.i64 = v.i64; break;
-                                        case WasmValType::F32: wv.f32 = v.f32; break;
-                                        case WasmValType::F64: wv.f64 = v.f64; break;
-                                        default: break;
-                                    }
-                                    args.push_back(wv);
-                                }
-                                std::reverse(args.begin(), args.end());
-
-                                auto result = call_host_function(imp.module, imp.name, args);
-                                if (!result) {
-                                    return result.error();
-                                }
-
-                                // Push results
-                                for (const auto& rv : result.value()) {
-                                    StackValue sv;
-                                    switch (rv.type) {
-                                        case WasmValType::I32: sv.i32 = rv.i32; break;
-                                        case WasmValType::I64: sv.i64 = rv.i64; break;
-                                        case WasmValType::F32: sv.f32 = rv.f32; break;
-                                        case WasmValType::F64: sv.f64 = rv.f64; break;
-                                        default: break;
-                                    }
-                                    push(sv);
-                                }
-                                break;
-                            }
-                            ++imp_idx;
-                        }
-                    }
-                } else {
-                    // Local function call
-                    std::uint32_t local_idx = func_idx - module.num_imported_functions;
-                    const WasmFunction& callee = module.functions[local_idx];
-                    const WasmFunctionType& callee_type = module.types[callee.type_index];
-
-                    // Pop arguments
-                    std::vector<WasmValue> args;
-                    for (std::size_t i = 0; i < callee_type.params.size(); ++i) {
-                        StackValue v = pop();
-                        WasmValue wv;
-                        wv.type = callee_type.params[callee_type.params.size() - 1 - i];
-                        switch (wv.type) {
-                            case WasmValType::I32: wv.i32 = v.i32; break;
-                            case WasmValType::I64: wv.i64 = v.i64; break;
-                            case WasmValType::F32: wv.f32 = v.f32; break;
-                            case WasmValType::F64: wv.f64 = v.f64; break;
-                            default: break;
-                        }
-                        args.push_back(wv);
-                    }
-                    std::reverse(args.begin(), args.end());
-
-                    // Recursive call
-                    auto result = execute(module, memory, func_idx, args);
-                    if (!result) {
-                        return result.error();
-                    }
-
-                    // Push results
-                    for (const auto& rv : result.value()) {
-                        StackValue sv;
-                        switch (rv.type) {
-                            case WasmValType::I32: sv.i32 = rv.i32; break;
-                            case WasmValType::I64: sv.i64 = rv.i64; break;
-                            case WasmValType::F32: sv.f32 = rv.f32; break;
-                            case WasmValType::F64: sv.f64 = rv.f64; break;
-                            default: break;
-                        }
-                        push(sv);
-                    }
+            VOID_WASM_OP(Call) {
+                auto result = execute_function(module, memory, in->a);
+                if (!result) {
+                    return result;
                 }
-                break;
+                locals = locals_.data() + locals_base;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::CallIndirect: {
-                std::uint32_t type_idx = read_u32_leb_local();
-                std::uint32_t table_idx = read_u32_leb_local();
-
-                StackValue idx = pop();
-                if (table_idx >= tables_.size() ||
-                    static_cast<std::uint32_t>(idx.u32) >= tables_[table_idx].size()) {
+            VOID_WASM_OP(CallIndirect) {
+                std::uint32_t idx = pop().u32;
+                if (in->b >= tables_.size() || idx >= tables_[in->b].size()) {
                     return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM out of bounds"};
                 }
 
-                std::uint32_t func_idx = tables_[table_idx][idx.u32];
+                std::uint32_t func_idx = tables_[in->b][idx];
                 if (func_idx == 0xFFFFFFFF) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
 
                 // Validate function type matches
-                if (type_idx >= module.types.size()) {
-                    return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM invalid type index"};
-                }
-                const WasmFunctionType& expected_type = module.types[type_idx];
-
-                // Check if imported function
+                const WasmFunctionType& expected_type = module.types[in->a];
+                const WasmFunctionType* actual_type = nullptr;
                 if (func_idx < module.num_imported_functions) {
-                    std::uint32_t imp_idx = 0;
-                    for (const auto& imp : module.imports) {
-                        if (imp.kind == WasmExternKind::Func) {
-                            if (imp_idx == func_idx) {
-                                // Verify type
-                                if (imp.func_type &&
-                                    (imp.func_type->params != expected_type.params ||
-                                     imp.func_type->results != expected_type.results)) {
-                                    return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM type mismatch"};
-                                }
-
-                                // Pop arguments
-                                std::vector<WasmValue> args;
-                                for (std::size_t i = 0; i < expected_type.params.size(); ++i) {
-                                    StackValue v = pop();
-                                    WasmValue wv;
-                                    wv.type = expected_type.params[expected_type.params.size() - 1 - i];
-                                    switch (wv.type) {
-                                        case WasmValType::I32: wv.i32 = v.i32; break;
-                                        case WasmValType::I64: wv.i64 = v.i64; break;
-                                        case WasmValType::F32: wv.f32 = v.f32; break;
-                                        case WasmValType::F64: wv.f64 = v.f64; break;
-                                        default: break;
-                                    }
-                                    args.push_back(wv);
-                                }
-                                std::reverse(args.begin(), args.end());
-
-                                auto result = call_host_function(imp.module, imp.name, args);
-                                if (!result) {
-                                    return result.error();
-                                }
-
-                                // Push results
-                                for (const auto& rv : result.value()) {
-                                    StackValue sv;
-                                    switch (rv.type) {
-                                        case WasmValType::I32: sv.i32 = rv.i32; break;
-                                        case WasmValType::I64: sv.i64 = rv.i64; break;
-                                        case WasmValType::F32: sv.f32 = rv.f32; break;
-                                        case WasmValType::F64: sv.f64 = rv.f64; break;
-                                        default: break;
-                                    }
-                                    push(sv);
-                                }
-                                break;
-                            }
-                            ++imp_idx;
-                        }
+                    const WasmImport& imp = module.imports[module.function_imports[func_idx]];
+                    if (imp.func_type) {
+                        actual_type = &*imp.func_type;
                     }
+                } else if (func_idx - module.num_imported_functions < module.functions.size()) {
+                    actual_type = &module.types[module.functions[func_idx - module.num_imported_functions].type_index];
                 } else {
-                    // Local function call
-                    std::uint32_t local_idx = func_idx - module.num_imported_functions;
-                    if (local_idx >= module.functions.size()) {
-                        return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM invalid function"};
-                    }
-
-                    const WasmFunction& callee = module.functions[local_idx];
-                    const WasmFunctionType& callee_type = module.types[callee.type_index];
-
-                    // Verify type
-                    if (callee_type.params != expected_type.params ||
-                        callee_type.results != expected_type.results) {
-                        return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM type mismatch"};
-                    }
-
-                    // Pop arguments
-                    std::vector<WasmValue> args;
-                    for (std::size_t i = 0; i < callee_type.params.size(); ++i) {
-                        StackValue v = pop();
-                        WasmValue wv;
-                        wv.type = callee_type.params[callee_type.params.size() - 1 - i];
-                        switch (wv.type) {
-                            case WasmValType::I32: wv.i32 = v.i32; break;
-                            case WasmValType::I64: wv.i64 = v.i64; break;
-                            case WasmValType::F32: wv.f32 = v.f32; break;
-                            case WasmValType::F64: wv.f64 = v.f64; break;
-                            default: break;
-                        }
-                        args.push_back(wv);
-                    }
-                    std::reverse(args.begin(), args.end());
-
-                    // Recursive call
-                    auto result = execute(module, memory, func_idx, args);
-                    if (!result) {
-                        return result.error();
-                    }
+                    return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM invalid function"};
+                }
+                if (actual_type &&
+                    (actual_type->params != expected_type.params ||
+                     actual_type->results != expected_type.results)) {
+                    return void_core::Error{void_core::ErrorCode::InvalidArgument, "WASM type mismatch"};
+                }
 
-                    // Push results
-                    for (const auto& rv : result.value()) {
-                        StackValue sv;
-                        switch (rv.type) {
-                            case WasmValType::I32: sv.i32 = rv.i32; break;
-                            case WasmValType::I64: sv.i64 = rv.i64; break;
-                            case WasmValType::F32: sv.f32 = rv.f32; break;
-                            case WasmValType::F64: sv.f64 = rv.f64; break;
-                            default: break;
-                        }
-                        push(sv);
-                    }
+                auto result = execute_function(module, memory, func_idx);
+                if (!result) {
+                    return result;
                 }
-                break;
+                locals = locals_.data() + locals_base;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // Parametric
             // ================================================================
-            case WasmOpcode::Drop:
+            VOID_WASM_OP(Drop)
                 pop();
-                break;
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::Select: {
+            VOID_WASM_OP(Select) {
                 StackValue cond = pop();
                 StackValue val2 = pop();
                 StackValue val1 = pop();
                 push(cond.i32 ? val1 : val2);
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
-            // Variables
+            // Variables (indices validated at translation)
             // ================================================================
-            case WasmOpcode::LocalGet: {
-                std::uint32_t idx = read_u32_leb_local();
-                push(frame->locals[idx]);
-                break;
-            }
+            VOID_WASM_OP(LocalGet)
+                push(locals[in->a]);
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::LocalSet: {
-                std::uint32_t idx = read_u32_leb_local();
-                frame->locals[idx] = pop();
-                break;
-            }
+            VOID_WASM_OP(LocalSet)
+                locals[in->a] = pop();
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::LocalTee: {
-                std::uint32_t idx = read_u32_leb_local();
-                frame->locals[idx] = top();
-                break;
-            }
+            VOID_WASM_OP(LocalTee)
+                locals[in->a] = top();
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::GlobalGet: {
-                std::uint32_t idx = read_u32_leb_local();
-                push(globals_[idx]);
-                break;
-            }
-
-            case WasmOpcode::GlobalSet: {
-                std::uint32_t idx = read_u32_leb_local();
-                globals_[idx] = pop();
-                break;
-            }
+            VOID_WASM_OP(GlobalGet)
+                push(globals_[in->a]);
+                VOID_WASM_NEXT();
 
+            VOID_WASM_OP(GlobalSet)
+                globals_[in->a] = pop();
+                VOID_WASM_NEXT();
             // ================================================================
             // Memory
             // ================================================================
-            case WasmOpcode::I32Load: {
-                read_u32_leb_local();  // align
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Load) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{memory.read<std::int32_t>(ea)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Load: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Load) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{memory.read<std::int64_t>(ea)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Load: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(F32Load) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{memory.read<float>(ea)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Load: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(F64Load) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{memory.read<double>(ea)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Load8S: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Load8S) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int32_t>(memory.read<std::int8_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Load8U: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Load8U) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int32_t>(memory.read<std::uint8_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Load16S: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Load16S) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int32_t>(memory.read<std::int16_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Load16U: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Load16U) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int32_t>(memory.read<std::uint16_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Load8S: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Load8S) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int64_t>(memory.read<std::int8_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Load8U: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Load8U) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int64_t>(memory.read<std::uint8_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Load16S: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Load16S) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int64_t>(memory.read<std::int16_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Load16U: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Load16U) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int64_t>(memory.read<std::uint16_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Load32S: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Load32S) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int64_t>(memory.read<std::int32_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Load32U: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Load32U) {
+                std::uint32_t offset = in->a;
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 push(StackValue{static_cast<std::int64_t>(memory.read<std::uint32_t>(ea))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Store: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Store) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<std::int32_t>(ea, val.i32);
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Store: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Store) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<std::int64_t>(ea, val.i64);
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Store: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(F32Store) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<float>(ea, val.f32);
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Store: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(F64Store) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<double>(ea, val.f64);
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Store8: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Store8) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<std::uint8_t>(ea, static_cast<std::uint8_t>(val.i32));
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Store16: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I32Store16) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<std::uint16_t>(ea, static_cast<std::uint16_t>(val.i32));
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Store8: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Store8) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<std::uint8_t>(ea, static_cast<std::uint8_t>(val.i64));
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Store16: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Store16) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<std::uint16_t>(ea, static_cast<std::uint16_t>(val.i64));
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Store32: {
-                read_u32_leb_local();
-                std::uint32_t offset = read_u32_leb_local();
+            VOID_WASM_OP(I64Store32) {
+                std::uint32_t offset = in->a;
                 StackValue val = pop();
                 StackValue addr = pop();
                 std::uint32_t ea = addr.u32 + offset;
                 memory.write<std::uint32_t>(ea, static_cast<std::uint32_t>(val.i64));
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::MemorySize:
-                read_byte_local();  // memory index (always 0)
+            VOID_WASM_OP(MemorySize)
                 push(StackValue{static_cast<std::int32_t>(memory.pages())});
-                break;
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::MemoryGrow: {
-                read_byte_local();
+            VOID_WASM_OP(MemoryGrow) {
                 StackValue delta = pop();
                 auto result = memory.grow(delta.u32);
                 if (result) {
@@ -1566,319 +1671,319 @@ WasmResult<void> WasmInterpreter::execute_code(
                 } else {
                     push(StackValue{static_cast<std::int32_t>(-1)});
                 }
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // Constants
             // ================================================================
-            case WasmOpcode::I32Const:
-                push(StackValue{read_i32_leb_local()});
-                break;
+            VOID_WASM_OP(I32Const)
+                push(in->value);
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::I64Const:
-                push(StackValue{read_i64_leb_local()});
-                break;
+            VOID_WASM_OP(I64Const)
+                push(in->value);
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::F32Const:
-                push(StackValue{read_f32_local()});
-                break;
+            VOID_WASM_OP(F32Const)
+                push(in->value);
+                VOID_WASM_NEXT();
 
-            case WasmOpcode::F64Const:
-                push(StackValue{read_f64_local()});
-                break;
+            VOID_WASM_OP(F64Const)
+                push(in->value);
+                VOID_WASM_NEXT();
 
             // ================================================================
             // i32 Comparison
             // ================================================================
-            case WasmOpcode::I32Eqz: {
+            VOID_WASM_OP(I32Eqz) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i32 == 0)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Eq: {
+            VOID_WASM_OP(I32Eq) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i32 == b.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Ne: {
+            VOID_WASM_OP(I32Ne) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i32 != b.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32LtS: {
+            VOID_WASM_OP(I32LtS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i32 < b.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32LtU: {
+            VOID_WASM_OP(I32LtU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u32 < b.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32GtS: {
+            VOID_WASM_OP(I32GtS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i32 > b.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32GtU: {
+            VOID_WASM_OP(I32GtU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u32 > b.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32LeS: {
+            VOID_WASM_OP(I32LeS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i32 <= b.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32LeU: {
+            VOID_WASM_OP(I32LeU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u32 <= b.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32GeS: {
+            VOID_WASM_OP(I32GeS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i32 >= b.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32GeU: {
+            VOID_WASM_OP(I32GeU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u32 >= b.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // i64 Comparison
             // ================================================================
-            case WasmOpcode::I64Eqz: {
+            VOID_WASM_OP(I64Eqz) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64 == 0)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Eq: {
+            VOID_WASM_OP(I64Eq) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64 == b.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Ne: {
+            VOID_WASM_OP(I64Ne) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64 != b.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64LtS: {
+            VOID_WASM_OP(I64LtS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64 < b.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64LtU: {
+            VOID_WASM_OP(I64LtU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u64 < b.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64GtS: {
+            VOID_WASM_OP(I64GtS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64 > b.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64GtU: {
+            VOID_WASM_OP(I64GtU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u64 > b.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64LeS: {
+            VOID_WASM_OP(I64LeS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64 <= b.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64LeU: {
+            VOID_WASM_OP(I64LeU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u64 <= b.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64GeS: {
+            VOID_WASM_OP(I64GeS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64 >= b.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64GeU: {
+            VOID_WASM_OP(I64GeU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u64 >= b.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // f32 Comparison
             // ================================================================
-            case WasmOpcode::F32Eq: {
+            VOID_WASM_OP(F32Eq) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f32 == b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Ne: {
+            VOID_WASM_OP(F32Ne) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f32 != b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Lt: {
+            VOID_WASM_OP(F32Lt) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f32 < b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Gt: {
+            VOID_WASM_OP(F32Gt) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f32 > b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Le: {
+            VOID_WASM_OP(F32Le) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f32 <= b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Ge: {
+            VOID_WASM_OP(F32Ge) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f32 >= b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // f64 Comparison
             // ================================================================
-            case WasmOpcode::F64Eq: {
+            VOID_WASM_OP(F64Eq) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f64 == b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Ne: {
+            VOID_WASM_OP(F64Ne) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f64 != b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Lt: {
+            VOID_WASM_OP(F64Lt) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f64 < b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Gt: {
+            VOID_WASM_OP(F64Gt) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f64 > b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Le: {
+            VOID_WASM_OP(F64Le) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f64 <= b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Ge: {
+            VOID_WASM_OP(F64Ge) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.f64 >= b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // i32 Arithmetic
             // ================================================================
-            case WasmOpcode::I32Clz: {
+            VOID_WASM_OP(I32Clz) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(clz32(a.u32))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Ctz: {
+            VOID_WASM_OP(I32Ctz) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(ctz32(a.u32))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Popcnt: {
+            VOID_WASM_OP(I32Popcnt) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(popcnt32(a.u32))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Add: {
+            VOID_WASM_OP(I32Add) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 + b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Sub: {
+            VOID_WASM_OP(I32Sub) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 - b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Mul: {
+            VOID_WASM_OP(I32Mul) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 * b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32DivS: {
+            VOID_WASM_OP(I32DivS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.i32 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
@@ -1886,132 +1991,132 @@ WasmResult<void> WasmInterpreter::execute_code(
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{a.i32 / b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32DivU: {
+            VOID_WASM_OP(I32DivU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.u32 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 push(StackValue{static_cast<std::int32_t>(a.u32 / b.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32RemS: {
+            VOID_WASM_OP(I32RemS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.i32 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 push(StackValue{a.i32 % b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32RemU: {
+            VOID_WASM_OP(I32RemU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.u32 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 push(StackValue{static_cast<std::int32_t>(a.u32 % b.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32And: {
+            VOID_WASM_OP(I32And) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 & b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Or: {
+            VOID_WASM_OP(I32Or) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 | b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Xor: {
+            VOID_WASM_OP(I32Xor) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 ^ b.i32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Shl: {
+            VOID_WASM_OP(I32Shl) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 << (b.i32 & 31)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32ShrS: {
+            VOID_WASM_OP(I32ShrS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i32 >> (b.i32 & 31)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32ShrU: {
+            VOID_WASM_OP(I32ShrU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.u32 >> (b.u32 & 31))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Rotl: {
+            VOID_WASM_OP(I32Rotl) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(rotl32(a.u32, b.u32))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Rotr: {
+            VOID_WASM_OP(I32Rotr) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(rotr32(a.u32, b.u32))});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // i64 Arithmetic
             // ================================================================
-            case WasmOpcode::I64Clz: {
+            VOID_WASM_OP(I64Clz) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(clz64(a.u64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Ctz: {
+            VOID_WASM_OP(I64Ctz) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(ctz64(a.u64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Popcnt: {
+            VOID_WASM_OP(I64Popcnt) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(popcnt64(a.u64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Add: {
+            VOID_WASM_OP(I64Add) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 + b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Sub: {
+            VOID_WASM_OP(I64Sub) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 - b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Mul: {
+            VOID_WASM_OP(I64Mul) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 * b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64DivS: {
+            VOID_WASM_OP(I64DivS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.i64 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
@@ -2019,542 +2124,531 @@ WasmResult<void> WasmInterpreter::execute_code(
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{a.i64 / b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64DivU: {
+            VOID_WASM_OP(I64DivU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.u64 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 push(StackValue{static_cast<std::int64_t>(a.u64 / b.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64RemS: {
+            VOID_WASM_OP(I64RemS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.i64 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 push(StackValue{a.i64 % b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64RemU: {
+            VOID_WASM_OP(I64RemU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 if (b.u64 == 0) return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 push(StackValue{static_cast<std::int64_t>(a.u64 % b.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64And: {
+            VOID_WASM_OP(I64And) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 & b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Or: {
+            VOID_WASM_OP(I64Or) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 | b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Xor: {
+            VOID_WASM_OP(I64Xor) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 ^ b.i64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Shl: {
+            VOID_WASM_OP(I64Shl) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 << (b.i64 & 63)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64ShrS: {
+            VOID_WASM_OP(I64ShrS) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.i64 >> (b.i64 & 63)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64ShrU: {
+            VOID_WASM_OP(I64ShrU) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(a.u64 >> (b.u64 & 63))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Rotl: {
+            VOID_WASM_OP(I64Rotl) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(rotl64(a.u64, b.u64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Rotr: {
+            VOID_WASM_OP(I64Rotr) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(rotr64(a.u64, b.u64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // f32 Arithmetic
             // ================================================================
-            case WasmOpcode::F32Abs: {
+            VOID_WASM_OP(F32Abs) {
                 StackValue a = pop();
                 push(StackValue{std::abs(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Neg: {
+            VOID_WASM_OP(F32Neg) {
                 StackValue a = pop();
                 push(StackValue{-a.f32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Ceil: {
+            VOID_WASM_OP(F32Ceil) {
                 StackValue a = pop();
                 push(StackValue{std::ceil(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Floor: {
+            VOID_WASM_OP(F32Floor) {
                 StackValue a = pop();
                 push(StackValue{std::floor(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Trunc: {
+            VOID_WASM_OP(F32Trunc) {
                 StackValue a = pop();
                 push(StackValue{std::trunc(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Nearest: {
+            VOID_WASM_OP(F32Nearest) {
                 StackValue a = pop();
                 push(StackValue{std::nearbyint(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Sqrt: {
+            VOID_WASM_OP(F32Sqrt) {
                 StackValue a = pop();
                 push(StackValue{std::sqrt(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Add: {
+            VOID_WASM_OP(F32Add) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f32 + b.f32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Sub: {
+            VOID_WASM_OP(F32Sub) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f32 - b.f32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Mul: {
+            VOID_WASM_OP(F32Mul) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f32 * b.f32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Div: {
+            VOID_WASM_OP(F32Div) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f32 / b.f32});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Min: {
+            VOID_WASM_OP(F32Min) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{std::fmin(a.f32, b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Max: {
+            VOID_WASM_OP(F32Max) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{std::fmax(a.f32, b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32Copysign: {
+            VOID_WASM_OP(F32Copysign) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{std::copysign(a.f32, b.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // f64 Arithmetic
             // ================================================================
-            case WasmOpcode::F64Abs: {
+            VOID_WASM_OP(F64Abs) {
                 StackValue a = pop();
                 push(StackValue{std::abs(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Neg: {
+            VOID_WASM_OP(F64Neg) {
                 StackValue a = pop();
                 push(StackValue{-a.f64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Ceil: {
+            VOID_WASM_OP(F64Ceil) {
                 StackValue a = pop();
                 push(StackValue{std::ceil(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Floor: {
+            VOID_WASM_OP(F64Floor) {
                 StackValue a = pop();
                 push(StackValue{std::floor(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Trunc: {
+            VOID_WASM_OP(F64Trunc) {
                 StackValue a = pop();
                 push(StackValue{std::trunc(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Nearest: {
+            VOID_WASM_OP(F64Nearest) {
                 StackValue a = pop();
                 push(StackValue{std::nearbyint(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Sqrt: {
+            VOID_WASM_OP(F64Sqrt) {
                 StackValue a = pop();
                 push(StackValue{std::sqrt(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Add: {
+            VOID_WASM_OP(F64Add) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f64 + b.f64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Sub: {
+            VOID_WASM_OP(F64Sub) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f64 - b.f64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Mul: {
+            VOID_WASM_OP(F64Mul) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f64 * b.f64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Div: {
+            VOID_WASM_OP(F64Div) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{a.f64 / b.f64});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Min: {
+            VOID_WASM_OP(F64Min) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{std::fmin(a.f64, b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Max: {
+            VOID_WASM_OP(F64Max) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{std::fmax(a.f64, b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64Copysign: {
+            VOID_WASM_OP(F64Copysign) {
                 StackValue b = pop();
                 StackValue a = pop();
                 push(StackValue{std::copysign(a.f64, b.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // Conversions
             // ================================================================
-            case WasmOpcode::I32WrapI64: {
+            VOID_WASM_OP(I32WrapI64) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(a.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32TruncF32S: {
+            VOID_WASM_OP(I32TruncF32S) {
                 StackValue a = pop();
                 if (std::isnan(a.f32) || a.f32 < static_cast<float>(std::numeric_limits<std::int32_t>::min()) ||
                     a.f32 >= static_cast<float>(std::numeric_limits<std::int32_t>::max()) + 1.0f) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::int32_t>(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32TruncF32U: {
+            VOID_WASM_OP(I32TruncF32U) {
                 StackValue a = pop();
                 if (std::isnan(a.f32) || a.f32 < 0.0f ||
                     a.f32 >= static_cast<float>(std::numeric_limits<std::uint32_t>::max()) + 1.0f) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::uint32_t>(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32TruncF64S: {
+            VOID_WASM_OP(I32TruncF64S) {
                 StackValue a = pop();
                 if (std::isnan(a.f64) || a.f64 < static_cast<double>(std::numeric_limits<std::int32_t>::min()) ||
                     a.f64 >= static_cast<double>(std::numeric_limits<std::int32_t>::max()) + 1.0) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::int32_t>(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32TruncF64U: {
+            VOID_WASM_OP(I32TruncF64U) {
                 StackValue a = pop();
                 if (std::isnan(a.f64) || a.f64 < 0.0 ||
                     a.f64 >= static_cast<double>(std::numeric_limits<std::uint32_t>::max()) + 1.0) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::uint32_t>(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64ExtendI32S: {
+            VOID_WASM_OP(I64ExtendI32S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(a.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64ExtendI32U: {
+            VOID_WASM_OP(I64ExtendI32U) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(a.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64TruncF32S: {
+            VOID_WASM_OP(I64TruncF32S) {
                 StackValue a = pop();
                 if (std::isnan(a.f32)) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::int64_t>(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64TruncF32U: {
+            VOID_WASM_OP(I64TruncF32U) {
                 StackValue a = pop();
                 if (std::isnan(a.f32) || a.f32 < 0.0f) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::uint64_t>(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64TruncF64S: {
+            VOID_WASM_OP(I64TruncF64S) {
                 StackValue a = pop();
                 if (std::isnan(a.f64)) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::int64_t>(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64TruncF64U: {
+            VOID_WASM_OP(I64TruncF64U) {
                 StackValue a = pop();
                 if (std::isnan(a.f64) || a.f64 < 0.0) {
                     return void_core::Error{void_core::ErrorCode::InvalidState, "WASM trap"};
                 }
                 push(StackValue{static_cast<std::uint64_t>(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32ConvertI32S: {
+            VOID_WASM_OP(F32ConvertI32S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<float>(a.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32ConvertI32U: {
+            VOID_WASM_OP(F32ConvertI32U) {
                 StackValue a = pop();
                 push(StackValue{static_cast<float>(a.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32ConvertI64S: {
+            VOID_WASM_OP(F32ConvertI64S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<float>(a.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32ConvertI64U: {
+            VOID_WASM_OP(F32ConvertI64U) {
                 StackValue a = pop();
                 push(StackValue{static_cast<float>(a.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32DemoteF64: {
+            VOID_WASM_OP(F32DemoteF64) {
                 StackValue a = pop();
                 push(StackValue{static_cast<float>(a.f64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64ConvertI32S: {
+            VOID_WASM_OP(F64ConvertI32S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<double>(a.i32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64ConvertI32U: {
+            VOID_WASM_OP(F64ConvertI32U) {
                 StackValue a = pop();
                 push(StackValue{static_cast<double>(a.u32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64ConvertI64S: {
+            VOID_WASM_OP(F64ConvertI64S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<double>(a.i64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64ConvertI64U: {
+            VOID_WASM_OP(F64ConvertI64U) {
                 StackValue a = pop();
                 push(StackValue{static_cast<double>(a.u64)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64PromoteF32: {
+            VOID_WASM_OP(F64PromoteF32) {
                 StackValue a = pop();
                 push(StackValue{static_cast<double>(a.f32)});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32ReinterpretF32: {
+            VOID_WASM_OP(I32ReinterpretF32) {
                 StackValue a = pop();
                 std::int32_t v;
                 std::memcpy(&v, &a.f32, 4);
                 push(StackValue{v});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64ReinterpretF64: {
+            VOID_WASM_OP(I64ReinterpretF64) {
                 StackValue a = pop();
                 std::int64_t v;
                 std::memcpy(&v, &a.f64, 8);
                 push(StackValue{v});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F32ReinterpretI32: {
+            VOID_WASM_OP(F32ReinterpretI32) {
                 StackValue a = pop();
                 float v;
                 std::memcpy(&v, &a.i32, 4);
                 push(StackValue{v});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::F64ReinterpretI64: {
+            VOID_WASM_OP(F64ReinterpretI64) {
                 StackValue a = pop();
                 double v;
                 std::memcpy(&v, &a.i64, 8);
                 push(StackValue{v});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // Sign Extension
             // ================================================================
-            case WasmOpcode::I32Extend8S: {
+            VOID_WASM_OP(I32Extend8S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(static_cast<std::int8_t>(a.i32))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I32Extend16S: {
+            VOID_WASM_OP(I32Extend16S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int32_t>(static_cast<std::int16_t>(a.i32))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Extend8S: {
+            VOID_WASM_OP(I64Extend8S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(static_cast<std::int8_t>(a.i64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Extend16S: {
+            VOID_WASM_OP(I64Extend16S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(static_cast<std::int16_t>(a.i64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
-            case WasmOpcode::I64Extend32S: {
+            VOID_WASM_OP(I64Extend32S) {
                 StackValue a = pop();
                 push(StackValue{static_cast<std::int64_t>(static_cast<std::int32_t>(a.i64))});
-                break;
+                VOID_WASM_NEXT();
             }
 
             // ================================================================
             // Multi-byte opcodes
             // ================================================================
-            case WasmOpcode::PrefixFC: {
-                std::uint32_t sub_op = read_u32_leb_local();
-                switch (sub_op) {
-                    case 0: // i32.trunc_sat_f32_s
-                    case 1: // i32.trunc_sat_f32_u
-                    case 2: // i32.trunc_sat_f64_s
-                    case 3: // i32.trunc_sat_f64_u
-                    case 4: // i64.trunc_sat_f32_s
-                    case 5: // i64.trunc_sat_f32_u
-                    case 6: // i64.trunc_sat_f64_s
-                    case 7: // i64.trunc_sat_f64_u
-                        // Saturating truncation - similar to regular trunc but clamped
-                        // Simplified implementation
-                        break;
-                    case 8: // memory.init
-                    case 9: // data.drop
-                    case 10: // memory.copy
-                    case 11: // memory.fill
-                    case 12: // table.init
-                    case 13: // elem.drop
-                    case 14: // table.copy
-                    case 15: // table.grow
-                    case 16: // table.size
-                    case 17: // table.fill
-                        // Bulk memory operations - skip for now
-                        break;
-                    default:
-                        break;
-                }
-                break;
-            }
-
+            VOID_WASM_OP(PrefixFC)
+                // Saturating truncation (0-7) and bulk memory/table operations
+                // (8-17) are not implemented yet; their immediates were
+                // consumed during translation
+                VOID_WASM_NEXT();
+
+#if VOID_WASM_THREADED_DISPATCH
+            op_invalid:
+#else
             default:
-                // Unknown opcode
-                VOID_LOG_WARN("[WasmInterpreter] Unknown opcode: 0x{:02X}", opcode);
-                break;
+#endif
+                // Unreachable for translated code
+                VOID_LOG_WARN("[WasmInterpreter] Unknown opcode: 0x{:02X}", static_cast<unsigned>(in->opcode));
+                return void_core::Error{void_core::ErrorCode::InvalidState, "WASM invalid instruction"};
+#if !VOID_WASM_THREADED_DISPATCH
         }
     }
+#endif
 
-    return void_core::Ok();
+out_of_fuel:
+    return void_core::Error{void_core::ErrorCode::Timeout, "WASM fuel exhausted"};
+
+#undef VOID_WASM_OP
+#undef VOID_WASM_NEXT
 }
 
+#if VOID_WASM_THREADED_DISPATCH
+#pragma GCC diagnostic pop
+#endif
+#undef VOID_WASM_THREADED_DISPATCH
+
 } // namespace void_scripting
@@ -255,23 +255,45 @@ union StackValue {
 };
 
 // =============================================================================
-// Control Frame
+// Translated Instructions
 // =============================================================================
 
-enum class LabelKind {
-    Block,
-    Loop,
-    If,
-    Else,
-    Function
+/// @brief Pre-decoded instruction
+///
+/// Function bodies are translated once, when the module is parsed, into a
+/// stream of fixed-width instructions: LEB128 immediates are decoded, block
+/// types are resolved to arities and every branch carries the index of the
+/// instruction it lands on. Operand meaning by opcode:
+///   Block/Loop:       arity = label arity
+///   If:               arity, a = else-body start (0 = no else), b = matching End
+///   Else:             b = matching End
+///   Br/BrIf:          a = label depth, b = target instruction
+///   BrTable:          a = label count, b = offset of (depth, target) pairs in
+///                     WasmFunction::branch_tables (count + 1 pairs, default last)
+///   Call:             a = function index
+///   CallIndirect:     a = type index, b = table index
+///   Local*/Global*:   a = index
+///   Loads/Stores:     a = static offset
+///   Constants:        value
+///   PrefixFC:         a = sub-opcode
+struct WasmInstr {
+    WasmOpcode opcode = WasmOpcode::Nop;
+    std::uint8_t handler = 0;    // Dense dispatch index
+    std::uint8_t arity = 0;
+    std::uint32_t fuel = 0;      // Instructions in the basic block starting here (0 = not a leader)
+    std::uint32_t a = 0;
+    std::uint32_t b = 0;
+    StackValue value;
 };
 
+// =============================================================================
+// Control Frame
+// =============================================================================
+
+/// @brief Runtime control label (branch targets are resolved at translation)
 struct Label {
-    LabelKind kind;
-    std::size_t pc;              // Program counter (for loop continuation)
     std::size_t stack_height;    // Stack height at entry
-    std::size_t arity;           // Number of results
-    std::size_t end_pc;          // PC of matching end
+    std::size_t arity;           // Values carried by a branch to this label
 };
 
 // =============================================================================
@@ -280,10 +302,9 @@ struct Label {
 
 struct CallFrame {
     std::uint32_t function_index;
-    std::size_t return_pc;
-    std::size_t stack_base;
-    std::vector<StackValue> locals;
-    std::vector<Label> labels;
+    std::size_t stack_base;      // Operand stack height below the frame
+    std::size_t locals_base;     // Offset of the frame's locals in the locals stack
+    std::size_t label_base;      // Offset of the frame's labels in the label stack
 };
 
 // =============================================================================
@@ -295,6 +316,9 @@ struct WasmFunction {
     std::vector<WasmValType> locals;
     std::vector<std::uint8_t> code;
     std::size_t code_offset;  // Offset in module binary
+
+    std::vector<WasmInstr> instructions;         // Translated body
+    std::vector<std::uint32_t> branch_tables;    // br_table (depth, target) pairs
 };
 
 // =============================================================================
@@ -333,6 +357,7 @@ struct ParsedModule {
 
     // Count imported functions (to offset function indices)
     std::uint32_t num_imported_functions = 0;
+    std::vector<std::size_t> function_imports;  // Import index per imported function
 };
 
 // =============================================================================
@@ -378,6 +403,8 @@ private:
     // Execution state
     std::vector<StackValue> stack_;
     std::vector<CallFrame> call_stack_;
+    std::vector<StackValue> locals_;
+    std::vector<Label> labels_;
     std::vector<StackValue> globals_;
     std::vector<std::vector<std::uint32_t>> tables_;
 
@@ -414,7 +441,10 @@ private:
     void parse_code_section(ParsedModule& module);
     void parse_data_section(ParsedModule& module);
 
-    // Execution
+    // Translation (reads the body at pos_ up to body_end)
+    void translate_function(const ParsedModule& module, WasmFunction& func, std::size_t body_end);
+
+    // Execution (arguments and results are passed on the operand stack)
     WasmResult<void> execute_function(
         const ParsedModule& module,
         WasmMemory& memory,
@@ -423,7 +453,11 @@ private:
     WasmResult<void> execute_code(
         const ParsedModule& module,
         WasmMemory& memory,
-        const std::vector<std::uint8_t>& code);
+        const WasmFunction& func);
+
+    WasmResult<void> call_import(
+        const ParsedModule& module,
+        std::uint32_t func_index);
 
     // Stack operations
     void push(StackValue v) { stack_.push_back(v); }
@@ -431,9 +465,8 @@ private:
     StackValue& top() { return stack_.back(); }
 
     // Label operations
-    void push_label(LabelKind kind, std::size_t pc, std::size_t arity, std::size_t end_pc);
-    void pop_label();
-    Label& get_label(std::uint32_t depth);
+    void push_label(std::size_t arity) { labels_.push_back(Label{stack_.size(), arity}); }
+    void pop_label() { labels_.pop_back(); }
 
     // Branch
     void branch(std::uint32_t depth);
@@ -445,7 +478,7 @@ private:
         std::span<const WasmValue> args);
 
     // Helpers
-    bool consume_fuel();
+    bool consume_fuel(std::uint32_t amount);
     StackValue evaluate_init_expr(std::span<const std::uint8_t> code);
 };
 
@@ -5,10 +5,51 @@
 #include <void_engine/event/event_bus.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <thread>
 
 namespace void_triggers {
 
+namespace {
+
+/// Triggers spanning more grid cells than this are tested for every entity
+constexpr std::int64_t k_max_trigger_cells = 256;
+
+/// Entities per work item of a batched update
+constexpr std::size_t k_entity_chunk = 32;
+
+std::int32_t grid_coord(float value, float cell_size) {
+    return static_cast<std::int32_t>(std::floor(value / cell_size));
+}
+
+std::int64_t grid_key(std::int32_t x, std::int32_t z) {
+    return (static_cast<std::int64_t>(x) << 32) | static_cast<std::uint32_t>(z);
+}
+
+bool same_bounds(const AABB& a, const AABB& b) {
+    return a.min.x == b.min.x && a.min.y == b.min.y && a.min.z == b.min.z &&
+           a.max.x == b.max.x && a.max.y == b.max.y && a.max.z == b.max.z;
+}
+
+bool id_less(TriggerId a, TriggerId b) {
+    return a.value < b.value;
+}
+
+void erase_from_cell(std::vector<TriggerId>& triggers, std::vector<AABB>& bounds, TriggerId id) {
+    auto it = std::find(triggers.begin(), triggers.end(), id);
+    if (it == triggers.end()) {
+        return;
+    }
+    auto index = static_cast<std::size_t>(it - triggers.begin());
+    triggers[index] = triggers.back();
+    bounds[index] = bounds.back();
+    triggers.pop_back();
+    bounds.pop_back();
+}
+
+} // namespace
+
 // =============================================================================
 // Trigger Implementation
 // =============================================================================
@@ -264,6 +305,7 @@ TriggerSystem::~TriggerSystem() = default;
 
 void TriggerSystem::set_config(const TriggerSystemConfig& config) {
     m_config = config;
+    m_spatial_dirty = true;
 }
 
 TriggerId TriggerSystem::create_trigger(const TriggerConfig& config) {
@@ -278,6 +320,7 @@ TriggerId TriggerSystem::create_trigger(const TriggerConfig& config) {
 
     m_triggers[id] = std::move(trigger);
     m_stats.total_triggers = m_triggers.size();
+    m_spatial_dirty = true;
 
     // Emit creation event via EventBus
     if (m_event_bus) {
@@ -320,11 +363,14 @@ bool TriggerSystem::remove_trigger(TriggerId id) {
 
     // Remove from entity tracking and stay times
     for (auto& [entity, triggers] : m_entity_triggers) {
-        if (triggers.erase(id)) {
+        auto pos = std::lower_bound(triggers.begin(), triggers.end(), id, id_less);
+        if (pos != triggers.end() && *pos == id) {
+            triggers.erase(pos);
             m_entity_stay_times.erase({entity, id});
         }
     }
 
+    remove_spatial(id);
     m_triggers.erase(it);
     m_stats.total_triggers = m_triggers.size();
 
@@ -439,43 +485,285 @@ TriggerZone* TriggerSystem::find_zone(const std::string& name) {
     return nullptr;
 }
 
-void TriggerSystem::update_entity(EntityId entity, const Vec3& position) {
-    Vec3 old_position = m_entity_positions[entity];
-    m_entity_positions[entity] = position;
+void TriggerSystem::refresh_spatial_index() {
+    m_spatial_dirty = true;
+    sync_spatial_index();
+}
+
+void TriggerSystem::sync_spatial_index() {
+    if (!m_spatial_dirty && m_spatial_sync_time == m_current_time) {
+        return;
+    }
+    m_spatial_dirty = false;
+    m_spatial_sync_time = m_current_time;
 
-    auto& entity_triggers = m_entity_triggers[entity];
+    float cell_size = std::max(m_config.spatial_cell_size, 0.01f);
+    if (cell_size != m_spatial_cell_size) {
+        m_spatial_cell_size = cell_size;
+        m_spatial_grid.clear();
+        m_spatial_entries.clear();
+        m_oversized_triggers = SpatialCell{};
+    }
 
-    // Check all triggers
-    for (auto& [id, trigger] : m_triggers) {
-        if (!trigger->is_enabled()) {
+    // Re-insert triggers whose volume or bounds changed
+    for (const auto& [id, trigger] : m_triggers) {
+        const ITriggerVolume* volume = trigger->volume();
+        auto it = m_spatial_entries.find(id);
+
+        if (!volume) {
+            if (it != m_spatial_entries.end()) {
+                remove_spatial(id);
+            }
             continue;
         }
 
-        ITriggerVolume* volume = trigger->volume();
+        AABB bounds = volume->bounds();
+        if (it != m_spatial_entries.end()) {
+            const SpatialEntry& entry = it->second;
+            if (entry.volume == volume && same_bounds(entry.bounds, bounds)) {
+                continue;
+            }
+            remove_spatial(id);
+        }
+        insert_spatial(id, volume, bounds);
+    }
+}
+
+void TriggerSystem::insert_spatial(TriggerId id, const ITriggerVolume* volume, const AABB& bounds) {
+    SpatialEntry entry{volume, bounds, false};
+
+    std::int32_t x0 = grid_coord(bounds.min.x, m_spatial_cell_size);
+    std::int32_t x1 = grid_coord(bounds.max.x, m_spatial_cell_size);
+    std::int32_t z0 = grid_coord(bounds.min.z, m_spatial_cell_size);
+    std::int32_t z1 = grid_coord(bounds.max.z, m_spatial_cell_size);
+    std::int64_t cells = (static_cast<std::int64_t>(x1) - x0 + 1) *
+                         (static_cast<std::int64_t>(z1) - z0 + 1);
+
+    if (!std::isfinite(bounds.min.x) || !std::isfinite(bounds.max.x) ||
+        !std::isfinite(bounds.min.z) || !std::isfinite(bounds.max.z) ||
+        cells > k_max_trigger_cells) {
+        entry.oversized = true;
+        m_oversized_triggers.triggers.push_back(id);
+        m_oversized_triggers.bounds.push_back(bounds);
+    } else {
+        for (std::int32_t x = x0; x <= x1; ++x) {
+            for (std::int32_t z = z0; z <= z1; ++z) {
+                auto& cell = m_spatial_grid[grid_key(x, z)];
+                cell.triggers.push_back(id);
+                cell.bounds.push_back(bounds);
+            }
+        }
+    }
+
+    m_spatial_entries[id] = entry;
+}
+
+void TriggerSystem::remove_spatial(TriggerId id) {
+    auto it = m_spatial_entries.find(id);
+    if (it == m_spatial_entries.end()) {
+        return;
+    }
+
+    const SpatialEntry& entry = it->second;
+    if (entry.oversized) {
+        erase_from_cell(m_oversized_triggers.triggers, m_oversized_triggers.bounds, id);
+    } else {
+        std::int32_t x0 = grid_coord(entry.bounds.min.x, m_spatial_cell_size);
+        std::int32_t x1 = grid_coord(entry.bounds.max.x, m_spatial_cell_size);
+        std::int32_t z0 = grid_coord(entry.bounds.min.z, m_spatial_cell_size);
+        std::int32_t z1 = grid_coord(entry.bounds.max.z, m_spatial_cell_size);
+        for (std::int32_t x = x0; x <= x1; ++x) {
+            for (std::int32_t z = z0; z <= z1; ++z) {
+                auto cell = m_spatial_grid.find(grid_key(x, z));
+                if (cell == m_spatial_grid.end()) {
+                    continue;
+                }
+                erase_from_cell(cell->second.triggers, cell->second.bounds, id);
+                if (cell->second.triggers.empty()) {
+                    m_spatial_grid.erase(cell);
+                }
+            }
+        }
+    }
+
+    m_spatial_entries.erase(it);
+}
+
+std::uint64_t TriggerSystem::find_transitions(const Vec3& position,
+                                              const std::vector<TriggerId>& inside,
+                                              std::vector<TriggerId>& candidates,
+                                              EntityTransitions& out) const {
+    std::uint64_t checks = 0;
+    candidates.clear();
+    out.exits.clear();
+    out.enters.clear();
+
+    auto test = [&](TriggerId id) {
+        auto it = m_triggers.find(id);
+        if (it == m_triggers.end() || !it->second->is_enabled()) {
+            return;
+        }
+        const ITriggerVolume* volume = it->second->volume();
         if (!volume) {
+            return;
+        }
+        ++checks;
+        if (volume->contains(position)) {
+            candidates.push_back(id);
+        }
+    };
+
+    auto test_cell = [&](const SpatialCell& cell) {
+        for (std::size_t i = 0; i < cell.triggers.size(); ++i) {
+            if (cell.bounds[i].contains(position)) {
+                test(cell.triggers[i]);
+            }
+        }
+    };
+
+    if (m_config.spatial_hashing) {
+        // A point lies in exactly one cell, so candidates are unique
+        auto cell = m_spatial_grid.find(grid_key(grid_coord(position.x, m_spatial_cell_size),
+                                                 grid_coord(position.z, m_spatial_cell_size)));
+        if (cell != m_spatial_grid.end()) {
+            test_cell(cell->second);
+        }
+        test_cell(m_oversized_triggers);
+    } else {
+        for (const auto& [id, trigger] : m_triggers) {
+            test(id);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), id_less);
+
+    // Triggers the entity is now inside but was not
+    std::set_difference(candidates.begin(), candidates.end(), inside.begin(), inside.end(),
+                        std::back_inserter(out.enters), id_less);
+
+    // Triggers the entity was inside and is no longer. Disabled or
+    // volume-less triggers keep their members, as they are not tested.
+    for (TriggerId id : inside) {
+        if (std::binary_search(candidates.begin(), candidates.end(), id, id_less)) {
             continue;
         }
+        auto it = m_triggers.find(id);
+        if (it != m_triggers.end() && it->second->is_enabled() && it->second->volume()) {
+            out.exits.push_back(id);
+        }
+    }
 
-        m_stats.collision_checks++;
+    return checks;
+}
 
-        bool was_inside = entity_triggers.find(id) != entity_triggers.end();
-        bool is_inside = volume->contains(position);
+void TriggerSystem::apply_transitions(EntityId entity, const EntityTransitions& transitions) {
+    // Callbacks may add or remove entities and triggers, so look everything up again
+    for (TriggerId id : transitions.exits) {
+        Trigger* trigger = get_trigger(id);
+        auto it = m_entity_triggers.find(entity);
+        if (!trigger || it == m_entity_triggers.end() || !check_entity_filter(entity, *trigger)) {
+            continue;
+        }
+        auto& inside = it->second;
+        auto pos = std::lower_bound(inside.begin(), inside.end(), id, id_less);
+        if (pos == inside.end() || *pos != id) {
+            continue;
+        }
+        inside.erase(pos);
+        process_entity_exit(entity, *trigger);
+    }
 
-        if (!check_entity_filter(entity, *trigger)) {
+    for (TriggerId id : transitions.enters) {
+        Trigger* trigger = get_trigger(id);
+        auto it = m_entity_triggers.find(entity);
+        if (!trigger || it == m_entity_triggers.end() || !check_entity_filter(entity, *trigger)) {
+            continue;
+        }
+        auto& inside = it->second;
+        auto pos = std::lower_bound(inside.begin(), inside.end(), id, id_less);
+        if (pos != inside.end() && *pos == id) {
             continue;
         }
+        inside.insert(pos, id);
+        process_entity_enter(entity, *trigger);
+    }
+}
+
+void TriggerSystem::update_entity(EntityId entity, const Vec3& position) {
+    sync_spatial_index();
+
+    m_entity_positions[entity] = position;
+    const auto& inside = m_entity_triggers[entity];
+
+    m_stats.collision_checks += find_transitions(position, inside, m_scratch_candidates,
+                                                 m_scratch_transitions);
+    apply_transitions(entity, m_scratch_transitions);
+
+    m_stats.entities_tracked = m_entity_positions.size();
+}
+
+void TriggerSystem::update_entities(std::span<const EntityUpdate> updates) {
+    if (updates.empty()) {
+        return;
+    }
+
+    sync_spatial_index();
+
+    // Register every entity first so the parallel pass only reads the maps
+    m_batch_inside.resize(updates.size());
+    for (std::size_t i = 0; i < updates.size(); ++i) {
+        m_entity_positions[updates[i].entity] = updates[i].position;
+        m_batch_inside[i] = &m_entity_triggers[updates[i].entity];
+    }
+    if (m_batch_transitions.size() < updates.size()) {
+        m_batch_transitions.resize(updates.size());
+    }
+
+    std::size_t hw = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    std::size_t max_workers = m_config.max_workers ? m_config.max_workers : hw;
+    std::size_t workers = std::min(max_workers, updates.size() / (k_entity_chunk * 4));
+
+    std::atomic<std::size_t> next_chunk{0};
+    std::atomic<std::uint64_t> total_checks{0};
+
+    auto run = [&]() {
+        std::vector<TriggerId> candidates;
+        std::uint64_t checks = 0;
+        for (;;) {
+            std::size_t begin = next_chunk.fetch_add(k_entity_chunk, std::memory_order_relaxed);
+            if (begin >= updates.size()) {
+                break;
+            }
+            std::size_t end = std::min(begin + k_entity_chunk, updates.size());
+            for (std::size_t i = begin; i < end; ++i) {
+                checks += find_transitions(updates[i].position, *m_batch_inside[i],
+                                           candidates, m_batch_transitions[i]);
+            }
+        }
+        total_checks.fetch_add(checks, std::memory_order_relaxed);
+    };
 
-        if (is_inside && !was_inside) {
-            // Enter
-            entity_triggers.insert(id);
-            process_entity_enter(entity, *trigger);
-        } else if (!is_inside && was_inside) {
-            // Exit
-            entity_triggers.erase(id);
-            process_entity_exit(entity, *trigger);
+    if (workers <= 1) {
+        run();
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (std::size_t i = 1; i < workers; ++i) {
+            threads.emplace_back(run);
+        }
+        run();
+        for (auto& thread : threads) {
+            thread.join();
         }
     }
 
+    m_stats.collision_checks += total_checks.load(std::memory_order_relaxed);
+
+    // Apply in input order so events do not depend on the worker count
+    for (std::size_t i = 0; i < updates.size(); ++i) {
+        apply_transitions(updates[i].entity, m_batch_transitions[i]);
+    }
+
     m_stats.entities_tracked = m_entity_positions.size();
 }
 
@@ -792,6 +1080,9 @@ void TriggerSystem::clear() {
     m_entity_triggers.clear();
     m_entity_stay_times.clear();
     m_spatial_grid.clear();
+    m_spatial_entries.clear();
+    m_oversized_triggers = SpatialCell{};
+    m_spatial_dirty = true;
     m_stats = Stats{};
 }
 
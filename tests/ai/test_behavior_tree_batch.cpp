@@ -0,0 +1,356 @@
+/// @file test_behavior_tree_batch.cpp
+/// @brief Tests for batched behavior tree agent ids, abort semantics and object tree equivalence
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ai/behavior_tree.hpp>
+#include <void_engine/ai/behavior_tree_asset.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace void_ai;
+
+namespace {
+
+/// Switches and counters shared by the callbacks of one agent
+struct Flags {
+    bool guard = false;
+    int guarded_calls = 0;
+    int fallback_calls = 0;
+};
+
+Flags& flags(const BehaviorContext& context) {
+    return *static_cast<Flags*>(context.user_data);
+}
+
+/// selector(0) { conditional(1, abort) { action(2) }, action(3) }
+///
+/// The guarded action succeeds, the fallback action keeps running.
+std::shared_ptr<const BehaviorTreeAsset> guarded_selector(AbortType abort) {
+    return BehaviorTreeAssetBuilder()
+        .selector()
+            .conditional([](const BehaviorContext& c) { return flags(c).guard; }, abort)
+                .action([](const BehaviorContext& c, float) {
+                    ++flags(c).guarded_calls;
+                    return NodeStatus::Success;
+                })
+            .action([](const BehaviorContext& c, float) {
+                ++flags(c).fallback_calls;
+                return NodeStatus::Running;
+            })
+        .end()
+        .build();
+}
+
+/// conditional(0, abort) { action(1) } with a running action
+std::shared_ptr<const BehaviorTreeAsset> guarded_action(AbortType abort) {
+    return BehaviorTreeAssetBuilder()
+        .conditional([](const BehaviorContext& c) { return flags(c).guard; }, abort)
+            .action([](const BehaviorContext& c, float) {
+                ++flags(c).guarded_calls;
+                return NodeStatus::Running;
+            })
+        .build();
+}
+
+// -----------------------------------------------------------------------------
+// Equivalence scenario
+// -----------------------------------------------------------------------------
+
+/// World state and action log of one agent, driven by the tick number
+struct World {
+    int index = 0;
+    int tick = 0;
+    int flee_ticks = 0;
+    int step_ticks = 0;
+    std::vector<std::string> log;
+
+    bool hurt() const { return (tick + index * 7) % 53 < 11; }
+    bool enemy_visible() const { return (tick / 3 + index) % 5 == 0; }
+    bool at_goal() const { return (tick + index) % 13 == 0; }
+
+    NodeStatus flee() {
+        log.push_back(std::to_string(tick) + " flee");
+        return ++flee_ticks % 4 == 0 ? NodeStatus::Success : NodeStatus::Running;
+    }
+    NodeStatus attack() {
+        log.push_back(std::to_string(tick) + " attack");
+        return NodeStatus::Success;
+    }
+    NodeStatus step() {
+        log.push_back(std::to_string(tick) + " step");
+        return ++step_ticks % 3 == 0 ? NodeStatus::Success : NodeStatus::Running;
+    }
+    NodeStatus idle() {
+        log.push_back(std::to_string(tick) + " idle");
+        return NodeStatus::Success;
+    }
+};
+
+World& world(const BehaviorContext& context) {
+    return *static_cast<World*>(context.user_data);
+}
+
+/// selector
+///   conditional(hurt, Self) -> sequence { flee, wait 0.5 }
+///   sequence { enemy_visible, cooldown 1.0 -> attack }
+///   cooldown 2.0 -> repeater 3 -> sequence { step, inverter -> at_goal }
+///   idle
+BehaviorTreePtr object_tree(World& w) {
+    return BehaviorTreeBuilder()
+        .selector()
+            .conditional([&w] { return w.hurt(); }, AbortType::Self)
+                .sequence()
+                    .action([&w](float) { return w.flee(); })
+                    .wait(0.5f)
+                .end()
+            .sequence()
+                .condition([&w] { return w.enemy_visible(); })
+                .cooldown(1.0f)
+                    .action([&w](float) { return w.attack(); })
+            .end()
+            .cooldown(2.0f)
+            .repeater(3)
+                .sequence()
+                    .action([&w](float) { return w.step(); })
+                    .inverter()
+                        .condition([&w] { return w.at_goal(); })
+                .end()
+            .action([&w](float) { return w.idle(); })
+        .end()
+        .build();
+}
+
+std::shared_ptr<const BehaviorTreeAsset> flat_tree() {
+    return BehaviorTreeAssetBuilder()
+        .selector()
+            .conditional([](const BehaviorContext& c) { return world(c).hurt(); }, AbortType::Self)
+                .sequence()
+                    .action([](const BehaviorContext& c, float) { return world(c).flee(); })
+                    .wait(0.5f)
+                .end()
+            .sequence()
+                .condition([](const BehaviorContext& c) { return world(c).enemy_visible(); })
+                .cooldown(1.0f)
+                    .action([](const BehaviorContext& c, float) { return world(c).attack(); })
+            .end()
+            .cooldown(2.0f)
+            .repeater(3)
+                .sequence()
+                    .action([](const BehaviorContext& c, float) { return world(c).step(); })
+                    .inverter()
+                        .condition([](const BehaviorContext& c) { return world(c).at_goal(); })
+                .end()
+            .action([](const BehaviorContext& c, float) { return world(c).idle(); })
+        .end()
+        .build();
+}
+
+} // namespace
+
+// =============================================================================
+// Agent Id Tests
+// =============================================================================
+
+TEST_CASE("BehaviorTreeBatch: stale agent ids do not alias reused slots", "[ai][behavior_tree]") {
+    BehaviorTreeBatch batch(guarded_action(AbortType::None), 1);
+    Flags a;
+    Flags b;
+    a.guard = true;
+    b.guard = true;
+
+    BehaviorAgentId first = batch.add_agent(nullptr, &a);
+    REQUIRE(batch.is_valid(first));
+    REQUIRE(batch.context(first)->agent == first);
+
+    batch.remove_agent(first);
+    BehaviorAgentId second = batch.add_agent(nullptr, &b);
+    REQUIRE(second != first);
+    REQUIRE(batch.agent_count() == 1);
+
+    // The old id fails every lookup instead of reaching the new agent
+    REQUIRE_FALSE(batch.is_valid(first));
+    REQUIRE(batch.context(first) == nullptr);
+    REQUIRE(batch.tick(first, 0.1f) == NodeStatus::Invalid);
+    REQUIRE(batch.status(first) == NodeStatus::Invalid);
+    batch.remove_agent(first);
+    REQUIRE(batch.is_valid(second));
+    REQUIRE(b.guarded_calls == 0);
+
+    REQUIRE(batch.tick(second, 0.1f) == NodeStatus::Running);
+    REQUIRE(batch.context(second)->agent == second);
+    REQUIRE(b.guarded_calls == 1);
+    REQUIRE(a.guarded_calls == 0);
+
+    SECTION("ids issued before clear stay invalid") {
+        batch.clear();
+        BehaviorAgentId third = batch.add_agent(nullptr, &a);
+        REQUIRE(third != second);
+        REQUIRE_FALSE(batch.is_valid(second));
+        REQUIRE(batch.is_valid(third));
+    }
+}
+
+// =============================================================================
+// Abort Tests
+// =============================================================================
+
+TEST_CASE("BehaviorTreeBatch: lower priority aborts wait for notify", "[ai][behavior_tree]") {
+    BehaviorTreeBatch batch(guarded_selector(AbortType::LowerPriority), 1);
+    Flags f;
+    BehaviorAgentId agent = batch.add_agent(nullptr, &f);
+
+    REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+    REQUIRE(batch.node_status(agent, 3) == NodeStatus::Running);
+
+    // The guard now passes, but the running branch resumes until notified
+    f.guard = true;
+    REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+    REQUIRE(f.guarded_calls == 0);
+    REQUIRE(f.fallback_calls == 2);
+
+    batch.notify(agent);
+    REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Success);
+    REQUIRE(f.guarded_calls == 1);
+    REQUIRE(f.fallback_calls == 2);
+    REQUIRE(batch.node_status(agent, 3) == NodeStatus::Invalid);
+
+    SECTION("notifications are consumed by the tick") {
+        f.guard = false;
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        f.guard = true;
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        REQUIRE(f.guarded_calls == 1);
+    }
+
+    SECTION("a failing guard leaves the running branch alone") {
+        f.guard = false;
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        batch.notify_all();
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        REQUIRE(f.fallback_calls == 4);
+    }
+}
+
+TEST_CASE("BehaviorTreeBatch: guards without LowerPriority ignore notify", "[ai][behavior_tree]") {
+    for (AbortType abort : {AbortType::None, AbortType::Self}) {
+        BehaviorTreeBatch batch(guarded_selector(abort), 1);
+        Flags f;
+        BehaviorAgentId agent = batch.add_agent(nullptr, &f);
+
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        f.guard = true;
+        batch.notify(agent);
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        REQUIRE(f.guarded_calls == 0);
+        REQUIRE(f.fallback_calls == 2);
+    }
+}
+
+TEST_CASE("BehaviorTreeBatch: self aborts re-check a running child every tick", "[ai][behavior_tree]") {
+    for (AbortType abort : {AbortType::Self, AbortType::Both}) {
+        BehaviorTreeBatch batch(guarded_action(abort), 1);
+        Flags f;
+        f.guard = true;
+        BehaviorAgentId agent = batch.add_agent(nullptr, &f);
+
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        REQUIRE(f.guarded_calls == 2);
+
+        // No notify needed: the guard is checked before resuming its child
+        f.guard = false;
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Failure);
+        REQUIRE(f.guarded_calls == 2);
+        REQUIRE(batch.node_status(agent, 1) == NodeStatus::Invalid);
+
+        f.guard = true;
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        REQUIRE(f.guarded_calls == 3);
+    }
+}
+
+TEST_CASE("BehaviorTreeBatch: guards without Self keep a running child", "[ai][behavior_tree]") {
+    for (AbortType abort : {AbortType::None, AbortType::LowerPriority}) {
+        BehaviorTreeBatch batch(guarded_action(abort), 1);
+        Flags f;
+        f.guard = true;
+        BehaviorAgentId agent = batch.add_agent(nullptr, &f);
+
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        f.guard = false;
+        batch.notify(agent);
+        REQUIRE(batch.tick(agent, 0.1f) == NodeStatus::Running);
+        REQUIRE(f.guarded_calls == 2);
+    }
+}
+
+TEST_CASE("BehaviorTreeBatch: both aborts switch branches after notify", "[ai][behavior_tree]") {
+    BehaviorTreeBatch batch(guarded_selector(AbortType::Both), 1);
+    Flags f;
+    BehaviorAgentId agent = batch.add_agent(nullptr, &f);
+    BehaviorAgentId other = batch.add_agent(nullptr, &f);
+
+    batch.tick_all(0.1f);
+    REQUIRE(f.fallback_calls == 2);
+
+    // Only the notified agent re-checks its guard
+    f.guard = true;
+    batch.notify(agent);
+    batch.notify(BehaviorAgentId{});
+    batch.tick_all(0.1f);
+    REQUIRE(batch.status(agent) == NodeStatus::Success);
+    REQUIRE(batch.status(other) == NodeStatus::Running);
+    REQUIRE(f.guarded_calls == 1);
+    REQUIRE(f.fallback_calls == 3);
+}
+
+// =============================================================================
+// Equivalence Tests
+// =============================================================================
+
+TEST_CASE("BehaviorTreeBatch: matches per-agent object trees over 400 ticks", "[ai][behavior_tree]") {
+    constexpr std::size_t k_agents = 12;
+    constexpr int k_ticks = 400;
+    constexpr float k_dt = 0.1f;
+
+    std::vector<World> object_worlds(k_agents);
+    std::vector<World> batch_worlds(k_agents);
+    std::vector<BehaviorTreePtr> trees;
+    BehaviorTreeBatch batch(flat_tree(), 1);
+    std::vector<BehaviorAgentId> agents;
+
+    for (std::size_t i = 0; i < k_agents; ++i) {
+        object_worlds[i].index = static_cast<int>(i);
+        batch_worlds[i].index = static_cast<int>(i);
+        trees.push_back(object_tree(object_worlds[i]));
+        agents.push_back(batch.add_agent(nullptr, &batch_worlds[i]));
+    }
+
+    for (int tick = 0; tick < k_ticks; ++tick) {
+        for (std::size_t i = 0; i < k_agents; ++i) {
+            object_worlds[i].tick = tick;
+            batch_worlds[i].tick = tick;
+        }
+
+        batch.tick_all(k_dt);
+        for (std::size_t i = 0; i < k_agents; ++i) {
+            NodeStatus expected = trees[i]->tick(k_dt);
+            REQUIRE(batch.status(agents[i]) == expected);
+        }
+    }
+
+    // Every branch of the tree was exercised
+    std::map<std::string, std::size_t> actions;
+    for (std::size_t i = 0; i < k_agents; ++i) {
+        REQUIRE(batch_worlds[i].log == object_worlds[i].log);
+        for (const auto& entry : batch_worlds[i].log) {
+            ++actions[entry.substr(entry.find(' ') + 1)];
+        }
+    }
+    REQUIRE(actions.size() == 4);
+    for (const auto& [action, count] : actions) {
+        REQUIRE(count > 10);
+    }
+}
@@ -0,0 +1,159 @@
+/// @file test_blackboard.cpp
+/// @brief Tests for schema-compiled blackboard snapshots
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ai/blackboard.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace void_ai;
+
+namespace {
+
+std::shared_ptr<BlackboardSchema> soldier_schema() {
+    auto schema = std::make_shared<BlackboardSchema>();
+    schema->add<bool>("alert");
+    schema->add<int>("ammo", 30);
+    schema->add<float>("health", 100.0f);
+    schema->add<std::string>("target", std::string("none"));
+    return schema;
+}
+
+} // namespace
+
+// =============================================================================
+// Snapshot Tests
+// =============================================================================
+
+TEST_CASE("CompiledBlackboard: snapshots restore every slot", "[ai][blackboard]") {
+    auto schema = soldier_schema();
+    auto alert = schema->find<bool>("alert");
+    auto ammo = schema->find<int>("ammo");
+    auto health = schema->find<float>("health");
+    auto target = schema->find<std::string>("target");
+
+    CompiledBlackboard source(schema);
+    source.set(alert, true);
+    source.set(ammo, 7);
+    source.set(health, 42.5f);
+    source.set(target, std::string("player"));
+
+    std::vector<std::uint8_t> data;
+    std::vector<std::string> strings;
+    std::uint64_t hash = source.write_snapshot(data, &strings);
+    REQUIRE(hash == schema->layout_hash());
+
+    CompiledBlackboard restored(schema);
+    REQUIRE(restored.read_snapshot(hash, data, strings));
+    REQUIRE(restored.get(alert));
+    REQUIRE(restored.get(ammo) == 7);
+    REQUIRE(restored.get(health) == 42.5f);
+    REQUIRE(restored.get(target) == "player");
+    REQUIRE(restored.is_changed(ammo.index));
+    REQUIRE(restored.is_changed(target.index));
+
+    SECTION("without strings, string slots are left alone") {
+        CompiledBlackboard partial(schema);
+        REQUIRE(partial.read_snapshot(hash, data));
+        REQUIRE(partial.get(ammo) == 7);
+        REQUIRE(partial.get(target) == "none");
+        REQUIRE_FALSE(partial.is_changed(target.index));
+    }
+}
+
+TEST_CASE("CompiledBlackboard: snapshots of another layout are rejected", "[ai][blackboard]") {
+    auto schema = soldier_schema();
+    CompiledBlackboard source(schema);
+    source.set(schema->find<int>("ammo"), 7);
+
+    std::vector<std::uint8_t> data;
+    std::vector<std::string> strings;
+    std::uint64_t hash = source.write_snapshot(data, &strings);
+
+    // Same sizes, but ammo and health swap places
+    auto swapped = std::make_shared<BlackboardSchema>();
+    swapped->add<bool>("alert");
+    swapped->add<float>("health", 100.0f);
+    swapped->add<int>("ammo", 30);
+    swapped->add<std::string>("target", std::string("none"));
+    REQUIRE(swapped->data_size() == schema->data_size());
+    REQUIRE(swapped->layout_hash() != hash);
+
+    CompiledBlackboard other(swapped);
+    REQUIRE_FALSE(other.read_snapshot(hash, data, strings));
+    REQUIRE(other.get(swapped->find<int>("ammo")) == 30);
+    REQUIRE(other.get(swapped->find<float>("health")) == 100.0f);
+    REQUIRE_FALSE(other.changes().any());
+
+    SECTION("renamed slots change the hash") {
+        auto renamed = std::make_shared<BlackboardSchema>();
+        renamed->add<bool>("alert");
+        renamed->add<int>("rounds", 30);
+        renamed->add<float>("health", 100.0f);
+        renamed->add<std::string>("target", std::string("none"));
+
+        CompiledBlackboard board(renamed);
+        REQUIRE_FALSE(board.read_snapshot(hash, data, strings));
+        REQUIRE(board.read_snapshot(renamed->layout_hash(), data, strings));
+        REQUIRE(board.get(renamed->find<int>("rounds")) == 7);
+    }
+
+    SECTION("a matching hash still needs matching sizes") {
+        CompiledBlackboard board(schema);
+        data.pop_back();
+        REQUIRE_FALSE(board.read_snapshot(hash, data, strings));
+        strings.pop_back();
+        REQUIRE_FALSE(board.read_snapshot(hash, std::span<const std::uint8_t>(), strings));
+    }
+}
+
+// =============================================================================
+// Observer Tests
+// =============================================================================
+
+TEST_CASE("CompiledBlackboard: observers may unobserve and observe from a callback", "[ai][blackboard]") {
+    auto schema = soldier_schema();
+    auto ammo = schema->find<int>("ammo");
+    CompiledBlackboard board(schema);
+
+    int first_calls = 0;
+    int second_calls = 0;
+    int late_calls = 0;
+    board.observe("ammo", [&](std::string_view, const BlackboardValue&) {
+        ++first_calls;
+        board.unobserve("ammo");
+        for (int i = 0; i < 8; ++i) {
+            board.observe("health", [&](std::string_view, const BlackboardValue&) { ++late_calls; });
+        }
+    });
+    board.observe("ammo", [&](std::string_view key, const BlackboardValue& value) {
+        REQUIRE(key == "ammo");
+        REQUIRE(std::get<int>(value) == 5);
+        ++second_calls;
+    });
+
+    // Both observers see the change that triggered the unobserve
+    board.set(ammo, 5);
+    REQUIRE(first_calls == 1);
+    REQUIRE(second_calls == 1);
+
+    board.set(ammo, 6);
+    REQUIRE(first_calls == 1);
+    REQUIRE(second_calls == 1);
+
+    board.set(schema->find<float>("health"), 50.0f);
+    REQUIRE(late_calls == 8);
+
+    SECTION("overflow keys too") {
+        int calls = 0;
+        board.observe("extra", [&](std::string_view, const BlackboardValue&) {
+            ++calls;
+            board.unobserve("extra");
+        });
+        board.set_int("extra", 1);
+        board.set_int("extra", 2);
+        REQUIRE(calls == 1);
+    }
+}
@@ -0,0 +1,97 @@
+/// @file test_crowd.cpp
+/// @brief Tests for crowd agent ids and collision avoidance
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ai/crowd.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace void_ai;
+using void_math::Vec3;
+
+namespace {
+
+float planar_distance(const Vec3& a, const Vec3& b) {
+    return std::hypot(a.x - b.x, a.z - b.z);
+}
+
+} // namespace
+
+// =============================================================================
+// Agent Id Tests
+// =============================================================================
+
+TEST_CASE("CrowdSystem: removed ids stay invalid after slot reuse", "[ai][crowd]") {
+    CrowdSystem crowd;
+    CrowdAgentId a = crowd.add_agent({1, 0, 0});
+    CrowdAgentId b = crowd.add_agent({2, 0, 0});
+    REQUIRE(crowd.is_valid(a));
+    REQUIRE(crowd.agent_count() == 2);
+
+    crowd.remove_agent(a);
+    REQUIRE_FALSE(crowd.is_valid(a));
+
+    // The new agent takes a's slot with a new generation
+    CrowdAgentId c = crowd.add_agent({5, 0, 5});
+    REQUIRE(crowd.is_valid(c));
+    REQUIRE(c != a);
+    REQUIRE_FALSE(crowd.is_valid(a));
+
+    // Stale ids neither read nor write the new occupant
+    crowd.set_position(a, {-9, 0, -9});
+    crowd.remove_agent(a);
+    REQUIRE(crowd.is_valid(c));
+    REQUIRE(crowd.position(c).x == 5.0f);
+    REQUIRE(crowd.agent_count() == 2);
+    REQUIRE(crowd.is_valid(b));
+}
+
+TEST_CASE("CrowdSystem: clear invalidates every id", "[ai][crowd]") {
+    CrowdSystem crowd;
+    CrowdAgentId a = crowd.add_agent({0, 0, 0});
+    crowd.clear();
+    REQUIRE(crowd.agent_count() == 0);
+    REQUIRE_FALSE(crowd.is_valid(a));
+
+    CrowdAgentId b = crowd.add_agent({0, 0, 0});
+    REQUIRE(crowd.is_valid(b));
+    REQUIRE_FALSE(crowd.is_valid(a));
+}
+
+TEST_CASE("CrowdSystem: neighbours carry current ids", "[ai][crowd]") {
+    CrowdSystem crowd;
+    CrowdAgentId a = crowd.add_agent({0, 0, 0});
+    CrowdAgentId old = crowd.add_agent({1, 0, 0});
+    crowd.remove_agent(old);
+    CrowdAgentId b = crowd.add_agent({1, 0, 0});
+    crowd.update(1.0f / 60.0f);
+
+    auto neighbors = crowd.neighbors(a);
+    REQUIRE(neighbors.size() == 1);
+    REQUIRE(neighbors[0] == b);
+    REQUIRE(crowd.neighbor_states(a).size() == 1);
+}
+
+// =============================================================================
+// Avoidance Tests
+// =============================================================================
+
+TEST_CASE("CrowdSystem: agents moving head-on do not overlap", "[ai][crowd]") {
+    CrowdSystem crowd;
+    CrowdAgentId a = crowd.add_agent({-5, 0, 0});
+    CrowdAgentId b = crowd.add_agent({5, 0, 0.01f});
+    crowd.set_preferred_velocity(a, {2, 0, 0});
+    crowd.set_preferred_velocity(b, {-2, 0, 0});
+
+    float closest = planar_distance(crowd.position(a), crowd.position(b));
+    for (int step = 0; step < 300; ++step) {
+        crowd.update(1.0f / 60.0f);
+        closest = std::min(closest, planar_distance(crowd.position(a), crowd.position(b)));
+    }
+
+    CrowdAgentParams params;
+    REQUIRE(closest >= 2.0f * params.radius * 0.95f);
+    REQUIRE(crowd.position(a).x > 3.0f);
+    REQUIRE(crowd.position(b).x < -3.0f);
+}
@@ -0,0 +1,255 @@
+/// @file test_navmesh.cpp
+/// @brief Tests for tiled navmesh generation and the polygon grid
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ai/navmesh.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace void_ai;
+using void_math::Vec3;
+
+namespace {
+
+/// Flat square floor from the origin to (size, 0, size)
+NavMeshBuilder floor_builder(float size, std::uint32_t tile_size) {
+    NavMeshBuildConfig config;
+    config.cell_size = 0.25f;
+    config.tile_size = tile_size;
+    config.agent_radius = 0.25f;
+
+    NavMeshBuilder builder(config);
+    builder.add_triangle({0, 0, 0}, {0, 0, size}, {size, 0, size});
+    builder.add_triangle({0, 0, 0}, {size, 0, size}, {size, 0, 0});
+    return builder;
+}
+
+/// Jittered triangle grid with a few holes; indexed unless linear is set
+void triangle_grid(NavMesh& mesh, bool linear) {
+    constexpr int k_cells = 16;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+
+    for (int z = 0; z <= k_cells; ++z) {
+        for (int x = 0; x <= k_cells; ++x) {
+            mesh.add_vertex({static_cast<float>(x) + jitter(rng), 0, static_cast<float>(z) + jitter(rng)});
+        }
+    }
+    auto vertex = [](int x, int z) { return static_cast<std::uint32_t>(z * (k_cells + 1) + x); };
+    for (int z = 0; z < k_cells; ++z) {
+        for (int x = 0; x < k_cells; ++x) {
+            if ((x * 7 + z * 3) % 11 == 0) continue;
+            mesh.add_polygon({vertex(x, z), vertex(x, z + 1), vertex(x + 1, z + 1)});
+            mesh.add_polygon({vertex(x, z), vertex(x + 1, z + 1), vertex(x + 1, z)});
+        }
+    }
+    if (!linear) {
+        mesh.build_connectivity();
+    }
+}
+
+float distance(const Vec3& a, const Vec3& b) {
+    return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z));
+}
+
+std::uint32_t polygon_at(const NavMesh& mesh, const Vec3& point) {
+    std::int32_t polygon = mesh.find_polygon_containing(point);
+    REQUIRE(polygon >= 0);
+    return static_cast<std::uint32_t>(polygon);
+}
+
+} // namespace
+
+// =============================================================================
+// Tile Generation Tests
+// =============================================================================
+
+TEST_CASE("NavMeshBuilder: floors are split into linked tiles", "[ai][navmesh]") {
+    // 24 units at 0.25 per cell and 32 cells per tile: 3 x 3 tiles of 8 units
+    auto builder = floor_builder(24.0f, 32);
+    auto mesh = builder.build();
+    REQUIRE(mesh->tile_count() == 9);
+    for (std::int32_t z = 0; z < 3; ++z) {
+        for (std::int32_t x = 0; x < 3; ++x) {
+            REQUIRE(mesh->has_tile(x, z));
+        }
+    }
+
+    // Every tile covers its area away from the eroded outer edge
+    for (float x = 1.0f; x < 24.0f; x += 2.0f) {
+        for (float z = 1.0f; z < 24.0f; z += 2.0f) {
+            INFO("x " << x << " z " << z);
+            REQUIRE(mesh->find_polygon_containing({x, 0, z}) >= 0);
+        }
+    }
+    REQUIRE(mesh->find_polygon_containing({30.0f, 0, 12.0f}) < 0);
+
+    // Border edges link tiles, so paths cross tile seams
+    NavMeshQuery query(mesh.get());
+    auto path = query.find_path({1, 0, 1}, {23, 0, 23});
+    REQUIRE(path.complete);
+    REQUIRE(path.points.front().polygon_index == polygon_at(*mesh, {1, 0, 1}));
+    REQUIRE(path.points.back().polygon_index == polygon_at(*mesh, {23, 0, 23}));
+}
+
+TEST_CASE("NavMeshBuilder: rebuilt tiles carve new obstacles", "[ai][navmesh]") {
+    auto builder = floor_builder(24.0f, 32);
+    auto mesh = builder.build();
+    REQUIRE(mesh->find_polygon_containing({12, 0, 12}) >= 0);
+
+    // A wall across the middle column, open at both ends
+    Vec3 wall_min{10, -1, 2};
+    Vec3 wall_max{14, 3, 22};
+    builder.add_box_obstacle(wall_min, wall_max);
+
+    auto tiles = builder.tiles_overlapping(wall_min, wall_max);
+    REQUIRE(tiles.size() == 3);
+    for (auto [x, z] : tiles) {
+        REQUIRE(x == 1);
+        builder.rebuild_tile(*mesh, x, z);
+    }
+    REQUIRE(mesh->tile_count() == 9);
+    REQUIRE(mesh->find_polygon_containing({12, 0, 12}) < 0);
+
+    // The detour goes around an end of the wall
+    NavMeshQuery query(mesh.get());
+    auto path = query.find_path({1, 0, 12}, {23, 0, 12});
+    REQUIRE(path.complete);
+    REQUIRE(path.total_distance > 24.0f);
+}
+
+TEST_CASE("NavMesh: tiles can be removed and restored", "[ai][navmesh]") {
+    auto builder = floor_builder(24.0f, 32);
+    auto mesh = builder.build();
+    std::size_t polygons = mesh->polygon_count();
+
+    REQUIRE(mesh->remove_tile(1, 1));
+    REQUIRE_FALSE(mesh->remove_tile(1, 1));
+    REQUIRE_FALSE(mesh->has_tile(1, 1));
+    REQUIRE(mesh->tile_count() == 8);
+    REQUIRE(mesh->find_polygon_containing({12, 0, 12}) < 0);
+
+    // The ring of remaining tiles is still connected
+    NavMeshQuery query(mesh.get());
+    auto around = query.find_path({1, 0, 12}, {23, 0, 12});
+    REQUIRE(around.complete);
+    for (const auto& point : around.points) {
+        const NavPolygon* polygon = mesh->polygon(point.polygon_index);
+        REQUIRE(polygon != nullptr);
+        REQUIRE_FALSE(polygon->vertices.empty());
+    }
+
+    mesh->set_tile(builder.build_tile(1, 1));
+    REQUIRE(mesh->has_tile(1, 1));
+    REQUIRE(mesh->polygon_count() == polygons);
+    REQUIRE(mesh->find_polygon_containing({12, 0, 12}) >= 0);
+
+    auto through = query.find_path({1, 0, 12}, {23, 0, 12});
+    REQUIRE(through.complete);
+    REQUIRE(through.total_distance < around.total_distance);
+}
+
+TEST_CASE("NavMesh: serialization keeps tiles", "[ai][navmesh]") {
+    auto builder = floor_builder(24.0f, 32);
+    auto mesh = builder.build();
+    REQUIRE(mesh->remove_tile(2, 0));
+
+    NavMesh copy;
+    REQUIRE(copy.deserialize(mesh->serialize()));
+    REQUIRE(copy.polygon_count() == mesh->polygon_count());
+    REQUIRE(copy.tile_count() == mesh->tile_count());
+    REQUIRE_FALSE(copy.has_tile(2, 0));
+    REQUIRE(copy.find_polygon_containing({12, 0, 12}) == mesh->find_polygon_containing({12, 0, 12}));
+
+    // Restored tiles still link to the deserialized ones
+    copy.set_tile(builder.build_tile(2, 0));
+    NavMeshQuery query(&copy);
+    REQUIRE(query.find_path({1, 0, 1}, {23, 0, 1}).complete);
+}
+
+// =============================================================================
+// Polygon Grid Tests
+// =============================================================================
+
+TEST_CASE("NavMesh: grid queries match a linear scan", "[ai][navmesh]") {
+    NavMesh indexed;
+    triangle_grid(indexed, false);
+    NavMesh linear;
+    triangle_grid(linear, true);
+    REQUIRE(indexed.has_spatial_index());
+    REQUIRE_FALSE(linear.has_spatial_index());
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coord(-4.0f, 20.0f);
+    for (int i = 0; i < 500; ++i) {
+        Vec3 point{coord(rng), 0, coord(rng)};
+        INFO("point " << point.x << ", " << point.z);
+
+        REQUIRE(indexed.find_polygon_containing(point) == linear.find_polygon_containing(point));
+
+        Vec3 a{}, b{};
+        std::uint32_t pa = 0, pb = 0;
+        REQUIRE(indexed.find_nearest_point(point, a, pa));
+        REQUIRE(linear.find_nearest_point(point, b, pb));
+        REQUIRE(std::abs(distance(point, a) - distance(point, b)) < 1e-4f);
+
+        Vec3 end{coord(rng), 0, coord(rng)};
+        Vec3 hit_a{}, hit_b{};
+        bool ha = indexed.raycast(point, end, hit_a, pa);
+        bool hb = linear.raycast(point, end, hit_b, pb);
+        REQUIRE(ha == hb);
+        if (ha) {
+            REQUIRE(distance(hit_a, hit_b) < 1e-3f);
+        }
+    }
+}
+
+TEST_CASE("NavMesh: batched nearest points match single queries", "[ai][navmesh]") {
+    NavMesh mesh;
+    triangle_grid(mesh, false);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coord(-2.0f, 18.0f);
+    std::vector<Vec3> positions(2000);
+    for (auto& position : positions) {
+        position = {coord(rng), 0, coord(rng)};
+    }
+
+    std::vector<NearestPolygonResult> results(positions.size());
+    mesh.find_nearest_points(positions, results);
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        Vec3 point{};
+        std::uint32_t polygon = 0;
+        REQUIRE(results[i].found == mesh.find_nearest_point(positions[i], point, polygon));
+        REQUIRE(results[i].polygon == polygon);
+        REQUIRE(distance(results[i].point, point) < 1e-5f);
+    }
+}
+
+TEST_CASE("NavMesh: grid follows polygons added after indexing", "[ai][navmesh]") {
+    NavMesh mesh;
+    triangle_grid(mesh, false);
+    REQUIRE(mesh.find_polygon_containing({40.5f, 0, 40.5f}) < 0);
+
+    auto base = static_cast<std::uint32_t>(mesh.vertex_count());
+    mesh.add_vertex({40, 0, 40});
+    mesh.add_vertex({40, 0, 42});
+    mesh.add_vertex({42, 0, 40});
+    mesh.add_polygon({base, base + 1, base + 2});
+    auto added = static_cast<std::int32_t>(mesh.polygon_count() - 1);
+    REQUIRE(mesh.find_polygon_containing({40.5f, 0, 40.5f}) == added);
+
+    // Far outside the old bounds, the nearest polygon is the new one
+    Vec3 nearest{};
+    std::uint32_t polygon = 0;
+    REQUIRE(mesh.find_nearest_point({45, 0, 45}, nearest, polygon));
+    REQUIRE(polygon == static_cast<std::uint32_t>(added));
+
+    // Rebuilding with an explicit cell size keeps the answers
+    mesh.build_spatial_index(4.0f);
+    REQUIRE(mesh.find_polygon_containing({40.5f, 0, 40.5f}) == added);
+    REQUIRE(mesh.find_polygon_containing({100, 0, 100}) < 0);
+}
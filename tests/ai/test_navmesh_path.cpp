@@ -0,0 +1,229 @@
+/// @file test_navmesh_path.cpp
+/// @brief Tests for hierarchical and time-sliced pathfinding
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ai/navmesh.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace void_ai;
+using void_math::Vec3;
+
+namespace {
+
+constexpr int k_cells = 24;
+
+/// Grid of unit quads with walls that leave gaps, so paths have to wind
+bool is_wall(int x, int z) {
+    return (x % 6 == 3 && z % 12 != 1) || (z % 8 == 5 && x % 10 == 2);
+}
+
+NavMesh maze() {
+    NavMesh mesh;
+    for (int z = 0; z <= k_cells; ++z) {
+        for (int x = 0; x <= k_cells; ++x) {
+            mesh.add_vertex({static_cast<float>(x), 0, static_cast<float>(z)});
+        }
+    }
+    auto vertex = [](int x, int z) { return static_cast<std::uint32_t>(z * (k_cells + 1) + x); };
+    for (int z = 0; z < k_cells; ++z) {
+        for (int x = 0; x < k_cells; ++x) {
+            if (is_wall(x, z)) continue;
+            mesh.add_polygon({vertex(x, z), vertex(x, z + 1), vertex(x + 1, z + 1), vertex(x + 1, z)});
+        }
+    }
+    mesh.build_connectivity();
+    return mesh;
+}
+
+/// Random cell centers that are not walls
+std::vector<std::pair<Vec3, Vec3>> endpoints(std::size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> cell(0, k_cells - 1);
+    auto open_cell = [&] {
+        for (;;) {
+            int x = cell(rng);
+            int z = cell(rng);
+            if (!is_wall(x, z)) return Vec3{static_cast<float>(x) + 0.5f, 0, static_cast<float>(z) + 0.5f};
+        }
+    };
+
+    std::vector<std::pair<Vec3, Vec3>> pairs;
+    for (std::size_t i = 0; i < count; ++i) {
+        Vec3 start = open_cell();
+        pairs.emplace_back(start, open_cell());
+    }
+    return pairs;
+}
+
+PathResult smoothed_path(const NavMeshQuery& query, const Vec3& start, const Vec3& end) {
+    PathResult result = query.find_path(start, end);
+    if (result.complete || result.partial) {
+        query.smooth_path(result);
+    }
+    return result;
+}
+
+} // namespace
+
+// =============================================================================
+// Hierarchical Search Tests
+// =============================================================================
+
+TEST_CASE("NavClusterGraph: corridors cover every reachable goal", "[ai][navmesh][path]") {
+    NavMesh mesh = maze();
+    NavClusterGraph clusters(6.0f);
+    clusters.build(mesh);
+    REQUIRE(clusters.cluster_count() == 16);
+    REQUIRE(clusters.portal_count() > 0);
+
+    NavMeshQuery flat(&mesh);
+    NavCorridorCache cache;
+    NavMeshQuery hierarchical(&mesh);
+    hierarchical.set_cluster_graph(&clusters);
+    hierarchical.set_corridor_cache(&cache);
+
+    for (const auto& [start, end] : endpoints(64, 5)) {
+        INFO("from " << start.x << ", " << start.z << " to " << end.x << ", " << end.z);
+        PathResult expected = flat.find_path(start, end);
+        PathResult actual = hierarchical.find_path(start, end);
+        REQUIRE(actual.complete == expected.complete);
+
+        // Restricting the search to a corridor may cost a little length
+        if (expected.complete) {
+            REQUIRE(actual.total_distance <= expected.total_distance * 1.5f + 1.0f);
+        }
+    }
+
+    // Repeating the same cluster pairs is served from the cache
+    std::size_t hits = cache.hits();
+    for (const auto& [start, end] : endpoints(64, 5)) {
+        (void)hierarchical.find_path(start, end);
+    }
+    REQUIRE(cache.hits() > hits);
+    REQUIRE(cache.size() <= cache.capacity());
+}
+
+TEST_CASE("NavCorridorCache: evicts the least recently used corridor", "[ai][navmesh][path]") {
+    NavCorridorCache cache(2);
+    cache.store(0, 1, {0, 1});
+    cache.store(1, 2, {1, 2});
+
+    std::vector<std::uint32_t> corridor;
+    REQUIRE(cache.find(0, 1, corridor));
+    REQUIRE(corridor == std::vector<std::uint32_t>{0, 1});
+
+    cache.store(2, 3, {2, 3});
+    REQUIRE(cache.size() == 2);
+    REQUIRE_FALSE(cache.find(1, 2, corridor));
+    REQUIRE(cache.find(0, 1, corridor));
+    REQUIRE(cache.find(2, 3, corridor));
+
+    cache.set_capacity(1);
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.find(2, 3, corridor));
+}
+
+// =============================================================================
+// Time-Sliced Search Tests
+// =============================================================================
+
+TEST_CASE("NavMeshQuery: sliced searches match a single search", "[ai][navmesh][path]") {
+    NavMesh mesh = maze();
+    NavMeshQuery query(&mesh);
+
+    for (const auto& [start, end] : endpoints(16, 9)) {
+        PathResult expected = query.find_path(start, end);
+
+        auto search = query.begin_search(start, end);
+        std::size_t slices = 0;
+        std::size_t total = 0;
+        for (;;) {
+            std::size_t used = 0;
+            bool finished = query.continue_search(*search, 3, &used);
+            REQUIRE(used <= 3);
+            total += used;
+            ++slices;
+            if (finished) break;
+        }
+        if (total > 3) {
+            REQUIRE(slices > 1);
+        }
+
+        PathResult actual = query.finish_search(*search);
+        REQUIRE(actual.complete == expected.complete);
+        REQUIRE(actual.points.size() == expected.points.size());
+        REQUIRE(std::abs(actual.total_distance - expected.total_distance) < 1e-4f);
+    }
+}
+
+TEST_CASE("NavPathQueue: a small budget spreads requests over several calls", "[ai][navmesh][path]") {
+    NavMesh mesh = maze();
+    NavMeshQuery query(&mesh);
+    NavPathQueue queue;
+    queue.bind(&mesh);
+    queue.set_max_workers(4);
+
+    auto pairs = endpoints(32, 21);
+    std::vector<PathId> ids;
+    for (const auto& [start, end] : pairs) {
+        ids.push_back(queue.request(start, end));
+    }
+    REQUIRE(queue.pending_count() == pairs.size());
+
+    std::size_t calls = 0;
+    std::size_t finished = 0;
+    while (queue.pending_count() > 0) {
+        finished += queue.process(64);
+        ++calls;
+        REQUIRE(calls < 10000);
+    }
+    REQUIRE(calls > 1);
+    REQUIRE(finished == pairs.size());
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        REQUIRE_FALSE(queue.is_pending(ids[i]));
+        PathResult result;
+        REQUIRE(queue.poll(ids[i], result));
+        PathResult expected = smoothed_path(query, pairs[i].first, pairs[i].second);
+        REQUIRE(result.complete == expected.complete);
+        REQUIRE(std::abs(result.total_distance - expected.total_distance) < 1e-3f);
+
+        // A result is taken once
+        REQUIRE_FALSE(queue.poll(ids[i], result));
+    }
+    REQUIRE(queue.completed_count() == 0);
+}
+
+TEST_CASE("NavPathQueue: cancelled and rebound requests", "[ai][navmesh][path]") {
+    NavMesh mesh = maze();
+    NavPathQueue queue;
+    queue.bind(&mesh);
+
+    PathId kept = queue.request({0.5f, 0, 0.5f}, {23.5f, 0, 23.5f});
+    PathId dropped = queue.request({0.5f, 0, 23.5f}, {23.5f, 0, 0.5f});
+    REQUIRE(queue.is_pending(dropped));
+
+    queue.process(8);
+    queue.cancel(dropped);
+    REQUIRE_FALSE(queue.is_pending(dropped));
+
+    // Rebinding restarts searches that hold polygons of the old mesh
+    NavMesh other = maze();
+    queue.bind(&other);
+    while (queue.pending_count() > 0) {
+        queue.process(1024);
+    }
+
+    PathResult result;
+    REQUIRE_FALSE(queue.poll(dropped, result));
+    REQUIRE(queue.poll(kept, result));
+    REQUIRE(result.complete);
+
+    queue.request({0.5f, 0, 0.5f}, {1.5f, 0, 0.5f});
+    queue.clear();
+    REQUIRE(queue.pending_count() == 0);
+    REQUIRE(queue.completed_count() == 0);
+}
@@ -0,0 +1,240 @@
+/// @file test_perception.cpp
+/// @brief Tests for the perception system's source hash, batched LOS and sight staggering
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ai/perception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace void_ai;
+using void_math::Vec3;
+
+namespace {
+
+using TargetList = std::vector<std::pair<PerceptionTargetId, Vec3>>;
+
+SightConfig sight_config(bool los) {
+    SightConfig config;
+    config.view_distance = 20.0f;
+    config.peripheral_distance = 10.0f;
+    config.use_los_check = los;
+    return config;
+}
+
+void add_sight(PerceptionComponent& perceiver, bool los) {
+    perceiver.add_sense(std::make_unique<SightSense>(sight_config(los)));
+    perceiver.set_max_known_targets(10000);
+}
+
+std::vector<std::uint32_t> known_ids(const PerceptionComponent& perceiver) {
+    std::vector<std::uint32_t> ids;
+    for (const auto& target : perceiver.known_targets()) {
+        ids.push_back(target.target_id.value);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+Vec3 random_forward(std::mt19937& rng) {
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    float a = angle(rng);
+    return {std::cos(a), 0.0f, std::sin(a)};
+}
+
+} // namespace
+
+// =============================================================================
+// Source Hash Tests
+// =============================================================================
+
+TEST_CASE("PerceptionSystem: hashed sight matches a scan over every source", "[ai][perception]") {
+    PerceptionSystemConfig config;
+    config.cell_size = 8.0f;
+    config.max_workers = 4;
+    PerceptionSystem system(config);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+
+    TargetList all_targets;
+    std::vector<StimulusSource*> sources;
+    for (int i = 0; i < 600; ++i) {
+        StimulusSource* source = system.create_stimulus_source();
+        source->set_position({coord(rng), 0.0f, coord(rng)});
+        source->set_visible(i % 7 != 0);
+        PerceptionTargetId id = system.register_target(source);
+        if (source->is_visible()) {
+            all_targets.emplace_back(id, source->position());
+        }
+        sources.push_back(source);
+    }
+
+    std::vector<PerceptionComponent*> perceivers;
+    std::vector<std::unique_ptr<PerceptionComponent>> references;
+    for (int i = 0; i < 150; ++i) {
+        Vec3 position{coord(rng), 0.0f, coord(rng)};
+        Vec3 forward = random_forward(rng);
+
+        PerceptionComponent* perceiver = system.create_perceiver();
+        add_sight(*perceiver, false);
+        perceiver->set_position(position);
+        perceiver->set_forward(forward);
+        perceivers.push_back(perceiver);
+
+        auto reference = std::make_unique<PerceptionComponent>();
+        add_sight(*reference, false);
+        reference->set_position(position);
+        reference->set_forward(forward);
+        references.push_back(std::move(reference));
+    }
+
+    system.update(0.1f);
+    for (auto& reference : references) {
+        reference->update(0.1f, all_targets);
+    }
+
+    std::size_t total_known = 0;
+    for (std::size_t i = 0; i < perceivers.size(); ++i) {
+        REQUIRE(known_ids(*perceivers[i]) == known_ids(*references[i]));
+        total_known += perceivers[i]->known_targets().size();
+    }
+    REQUIRE(total_known > 0);
+
+    SECTION("radius queries match a linear scan") {
+        for (int q = 0; q < 20; ++q) {
+            Vec3 center{coord(rng), 0.0f, coord(rng)};
+            float radius = 5.0f + static_cast<float>(q) * 2.0f;
+
+            auto found = system.get_sources_in_radius(center, radius);
+            std::sort(found.begin(), found.end());
+
+            std::vector<StimulusSource*> expected;
+            for (StimulusSource* source : sources) {
+                float dx = source->position().x - center.x;
+                float dz = source->position().z - center.z;
+                if (dx * dx + dz * dz <= radius * radius) {
+                    expected.push_back(source);
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+            REQUIRE(found == expected);
+        }
+    }
+}
+
+// =============================================================================
+// Batched Line Of Sight Tests
+// =============================================================================
+
+TEST_CASE("PerceptionSystem: batched LOS resolves every ray in one call", "[ai][perception]") {
+    PerceptionSystemConfig config;
+    config.max_workers = 2;
+    PerceptionSystem system(config);
+
+    // A wall along x = 0 blocks every ray that crosses it
+    int calls = 0;
+    std::size_t ray_count = 0;
+    system.set_los_batch_check([&](std::span<const LineOfSightRay> rays, std::span<std::uint8_t> visible) {
+        ++calls;
+        ray_count = rays.size();
+        REQUIRE(visible.size() == rays.size());
+        for (std::size_t i = 0; i < rays.size(); ++i) {
+            visible[i] = (rays[i].from.x < 0.0f) == (rays[i].to.x < 0.0f) ? 1 : 0;
+        }
+    });
+
+    PerceptionComponent* left = system.create_perceiver();
+    add_sight(*left, true);
+    left->set_position({-5.0f, 0.0f, 0.0f});
+    left->set_forward({1.0f, 0.0f, 0.0f});
+
+    PerceptionComponent* right = system.create_perceiver();
+    add_sight(*right, true);
+    right->set_position({5.0f, 0.0f, 0.0f});
+    right->set_forward({-1.0f, 0.0f, 0.0f});
+
+    StimulusSource* near_left = system.create_stimulus_source();
+    near_left->set_position({-2.0f, 0.0f, 1.0f});
+    PerceptionTargetId near_left_id = system.register_target(near_left);
+
+    StimulusSource* near_right = system.create_stimulus_source();
+    near_right->set_position({2.0f, 0.0f, -1.0f});
+    PerceptionTargetId near_right_id = system.register_target(near_right);
+
+    system.update(0.1f);
+
+    REQUIRE(calls == 1);
+    REQUIRE(ray_count == 4);
+    REQUIRE(left->knows_target(near_left_id));
+    REQUIRE_FALSE(left->knows_target(near_right_id));
+    REQUIRE(right->knows_target(near_right_id));
+    REQUIRE_FALSE(right->knows_target(near_left_id));
+
+    SECTION("updates without rays skip the batch") {
+        near_left->set_visible(false);
+        near_right->set_visible(false);
+        system.update(0.1f);
+        REQUIRE(calls == 1);
+    }
+}
+
+// =============================================================================
+// Staggering Tests
+// =============================================================================
+
+TEST_CASE("PerceptionSystem: sight refreshes less often away from the focus", "[ai][perception]") {
+    PerceptionSystemConfig config;
+    config.near_distance = 30.0f;
+    config.far_distance = 120.0f;
+    config.near_interval = 0.0f;
+    config.far_interval = 0.5f;
+    config.max_workers = 1;
+    PerceptionSystem system(config);
+    system.set_focus({0.0f, 0.0f, 0.0f});
+
+    // Rays come only from perceivers whose sight refreshed this update
+    std::vector<float> ray_origins;
+    system.set_los_batch_check([&](std::span<const LineOfSightRay> rays, std::span<std::uint8_t> visible) {
+        for (const auto& ray : rays) {
+            ray_origins.push_back(ray.from.x);
+        }
+        std::fill(visible.begin(), visible.end(), std::uint8_t{1});
+    });
+
+    auto place = [&](float x) {
+        PerceptionComponent* perceiver = system.create_perceiver();
+        add_sight(*perceiver, true);
+        perceiver->set_position({x, 0.0f, 0.0f});
+        perceiver->set_forward({1.0f, 0.0f, 0.0f});
+
+        StimulusSource* source = system.create_stimulus_source();
+        source->set_position({x + 5.0f, 0.0f, 0.0f});
+        system.register_target(source);
+        return perceiver;
+    };
+
+    place(0.0f);
+    PerceptionComponent* far = place(300.0f);
+    PerceptionComponent* urgent = place(600.0f);
+    urgent->set_priority(1000.0f);
+
+    for (int i = 0; i < 20; ++i) {
+        system.update(0.1f);
+    }
+
+    auto refreshes = [&](float x) {
+        return std::count(ray_origins.begin(), ray_origins.end(), x);
+    };
+    REQUIRE(refreshes(0.0f) == 20);
+    REQUIRE(refreshes(300.0f) >= 3);
+    REQUIRE(refreshes(300.0f) <= 5);
+    REQUIRE(refreshes(600.0f) == 20);
+
+    // Between refreshes the far perceiver keeps its last sight results
+    REQUIRE(far->known_targets().size() == 1);
+    REQUIRE(far->known_targets().front().currently_sensed);
+}
@@ -0,0 +1,255 @@
+/// @file test_cache.cpp
+/// @brief Tests for void_asset warm (disk) cache
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/asset/cache.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace void_asset;
+
+namespace {
+
+struct TempCacheDir {
+    std::filesystem::path path;
+
+    TempCacheDir() {
+        path = std::filesystem::temp_directory_path() /
+            ("void_warm_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    }
+
+    ~TempCacheDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    std::size_t blob_files() const {
+        std::size_t count = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path / "blobs")) {
+            if (entry.is_regular_file()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+};
+
+std::shared_ptr<CacheEntry> make_entry(const std::string& text,
+                                       CachePriority priority = CachePriority::Normal) {
+    return std::make_shared<CacheEntry>(create_cache_entry(
+        std::vector<std::uint8_t>(text.begin(), text.end()), priority, "txt"));
+}
+
+std::string as_string(const std::shared_ptr<CacheEntry>& entry) {
+    return std::string(entry->data.begin(), entry->data.end());
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// WarmCache Tests
+// =============================================================================
+
+TEST_CASE("WarmCache: entries persist across reopen", "[asset][cache]") {
+    TempCacheDir dir;
+    {
+        WarmCache cache(dir.path);
+        cache.put("a", make_entry("alpha", CachePriority::High));
+        cache.put("b", make_entry("beta"));
+
+        // Visible before the writer has run
+        REQUIRE(cache.contains("a"));
+        REQUIRE(as_string(cache.get("a")) == "alpha");
+        REQUIRE(cache.count() == 2);
+        REQUIRE(cache.size_bytes() == 9);
+    }
+
+    WarmCache cache(dir.path);
+    REQUIRE(cache.count() == 2);
+    REQUIRE(cache.size_bytes() == 9);
+    auto entry = cache.get("a");
+    REQUIRE(entry);
+    REQUIRE(as_string(entry) == "alpha");
+    REQUIRE(entry->meta.priority == CachePriority::High);
+    REQUIRE(entry->meta.asset_type == "txt");
+    REQUIRE(cache.read_count() == 1);
+}
+
+TEST_CASE("WarmCache: identical payloads share one blob", "[asset][cache]") {
+    TempCacheDir dir;
+    WarmCache cache(dir.path);
+
+    cache.put("one", make_entry("same bytes"));
+    cache.flush();
+    cache.put("two", make_entry("same bytes"));
+    cache.put("three", make_entry("other bytes"));
+    cache.flush();
+
+    REQUIRE(cache.count() == 3);
+    REQUIRE(cache.dedup_count() == 1);
+    REQUIRE(dir.blob_files() == 2);
+    REQUIRE(as_string(cache.get("two")) == "same bytes");
+}
+
+TEST_CASE("WarmCache: hash collisions are not deduplicated", "[asset][cache]") {
+    TempCacheDir dir;
+    std::string payload = "real payload";
+    std::string impostor = "fake payload";  // Same size, different bytes
+
+    // Plant a different payload under the name the real one hashes to
+    std::vector<std::uint8_t> bytes(payload.begin(), payload.end());
+    std::ostringstream name;
+    name << compute_content_hash(bytes) << '-' << std::hex << bytes.size();
+    auto planted = dir.path / "blobs" / name.str().substr(0, 2) / (name.str() + ".bin");
+    std::filesystem::create_directories(planted.parent_path());
+    std::ofstream(planted, std::ios::binary) << impostor;
+
+    {
+        WarmCache cache(dir.path);
+        cache.put("key", make_entry(payload));
+        cache.flush();
+        REQUIRE(cache.dedup_count() == 0);
+    }
+
+    WarmCache cache(dir.path);
+    REQUIRE(as_string(cache.get("key")) == payload);
+}
+
+TEST_CASE("WarmCache: long metadata strings round-trip", "[asset][cache]") {
+    TempCacheDir dir;
+    std::string long_url(70000, 'u');
+    {
+        WarmCache cache(dir.path);
+        auto entry = make_entry("data");
+        entry->meta.source_url = long_url;
+        cache.put("key", entry);
+    }
+
+    WarmCache cache(dir.path);
+    auto entry = cache.get("key");
+    REQUIRE(entry);
+    REQUIRE(entry->meta.source_url == long_url);
+}
+
+TEST_CASE("WarmCache: overwrite and remove keep totals exact", "[asset][cache]") {
+    TempCacheDir dir;
+    {
+        WarmCache cache(dir.path);
+        cache.put("k", make_entry("1234"));
+        cache.put("k", make_entry("12345678"));
+        REQUIRE(cache.count() == 1);
+        REQUIRE(cache.size_bytes() == 8);
+
+        cache.put("gone", make_entry("x"));
+        REQUIRE(cache.remove("gone"));
+        REQUIRE_FALSE(cache.remove("gone"));
+        REQUIRE_FALSE(cache.contains("gone"));
+        REQUIRE(cache.count() == 1);
+    }
+
+    WarmCache cache(dir.path);
+    REQUIRE(cache.count() == 1);
+    REQUIRE(cache.size_bytes() == 8);
+    REQUIRE(as_string(cache.get("k")) == "12345678");
+    REQUIRE_FALSE(cache.get("gone"));
+}
+
+TEST_CASE("WarmCache: compaction folds the log and drops dead blobs", "[asset][cache]") {
+    TempCacheDir dir;
+    {
+        WarmCache cache(dir.path);
+        for (int i = 0; i < 20; ++i) {
+            cache.put("key" + std::to_string(i), make_entry("value" + std::to_string(i)));
+        }
+        for (int i = 0; i < 10; ++i) {
+            cache.remove("key" + std::to_string(i));
+        }
+        cache.flush();
+        REQUIRE(cache.log_record_count() == 30);
+        REQUIRE(dir.blob_files() == 20);
+
+        cache.compact();
+        REQUIRE(cache.log_record_count() == 0);
+        REQUIRE(dir.blob_files() == 10);
+        REQUIRE(cache.count() == 10);
+
+        // Writes after compaction go to the fresh log
+        cache.put("key0", make_entry("again"));
+        cache.flush();
+        REQUIRE(cache.log_record_count() == 1);
+    }
+
+    WarmCache cache(dir.path);
+    REQUIRE(cache.count() == 11);
+    REQUIRE(as_string(cache.get("key15")) == "value15");
+    REQUIRE(as_string(cache.get("key0")) == "again");
+    REQUIRE_FALSE(cache.contains("key5"));
+}
+
+TEST_CASE("WarmCache: a failed compaction keeps serving the old snapshot", "[asset][cache]") {
+    TempCacheDir dir;
+    WarmCache cache(dir.path);
+    for (int i = 0; i < 8; ++i) {
+        cache.put("key" + std::to_string(i), make_entry("value" + std::to_string(i)));
+    }
+    cache.compact();
+    REQUIRE(cache.log_record_count() == 0);
+
+    // A non-empty directory in place of the snapshot makes the rename fail;
+    // the mapped snapshot outlives its unlinked file
+    std::filesystem::remove(dir.path / "index.snap");
+    std::filesystem::create_directories(dir.path / "index.snap" / "blocker");
+
+    cache.put("extra", make_entry("extra"));
+    cache.compact();
+
+    REQUIRE(cache.log_record_count() == 1);
+    REQUIRE(cache.count() == 9);
+    REQUIRE(as_string(cache.get("key3")) == "value3");
+    REQUIRE(as_string(cache.get("extra")) == "extra");
+    REQUIRE_FALSE(std::filesystem::exists(dir.path / "index.snap.tmp"));
+}
+
+TEST_CASE("WarmCache: torn log tail is ignored", "[asset][cache]") {
+    TempCacheDir dir;
+    {
+        WarmCache cache(dir.path);
+        cache.put("kept", make_entry("data"));
+    }
+    {
+        std::ofstream log(dir.path / "index.log", std::ios::binary | std::ios::app);
+        log << "\x40\x00\x00\x00partial";
+    }
+
+    {
+        WarmCache cache(dir.path);
+        REQUIRE(cache.count() == 1);
+        REQUIRE(as_string(cache.get("kept")) == "data");
+
+        // Appends continue after the last valid record
+        cache.put("next", make_entry("more"));
+    }
+
+    WarmCache cache(dir.path);
+    REQUIRE(cache.count() == 2);
+    REQUIRE(as_string(cache.get("next")) == "more");
+}
+
+TEST_CASE("WarmCache: synchronous mode and clear", "[asset][cache]") {
+    TempCacheDir dir;
+    WarmCache cache(dir.path, WarmCacheConfig().with_write_behind(false));
+
+    cache.put("a", make_entry("alpha"));
+    REQUIRE(cache.write_count() == 1);
+    REQUIRE(dir.blob_files() == 1);
+
+    cache.clear();
+    REQUIRE(cache.count() == 0);
+    REQUIRE(cache.size_bytes() == 0);
+    REQUIRE_FALSE(cache.get("a"));
+    REQUIRE(dir.blob_files() == 0);
+}
@@ -0,0 +1,306 @@
+/// @file test_dependency_graph.cpp
+/// @brief Tests for void_asset dependency graph and cascading reload
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/asset/dependency_graph.hpp>
+#include <void_engine/asset/hot_reload.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace void_asset;
+
+namespace {
+
+AssetId id(std::uint64_t raw) {
+    return AssetId{raw};
+}
+
+std::size_t wave_of(const AssetReloadPlan& plan, AssetId asset) {
+    for (std::size_t i = 0; i < plan.waves.size(); ++i) {
+        for (const auto& entry : plan.waves[i]) {
+            if (entry == asset) {
+                return i;
+            }
+        }
+    }
+    return static_cast<std::size_t>(-1);
+}
+
+// Text asset whose lines of the form "dep <path>" are recorded as dependencies
+struct DepAsset {
+    std::string content;
+};
+
+class DepAssetLoader : public AssetLoader<DepAsset> {
+public:
+    std::vector<std::string> extensions() const override {
+        return {"dep"};
+    }
+
+    LoadResult<DepAsset> load(LoadContext& ctx) override {
+        auto text = ctx.data_as_string();
+        std::istringstream lines(text);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.rfind("dep ", 0) == 0) {
+                ctx.add_dependency(AssetPath(line.substr(4)));
+            }
+        }
+        if (text.find("broken") != std::string::npos) {
+            return void_core::Err<std::unique_ptr<DepAsset>>(
+                AssetError::parse_error(ctx.path().str(), "broken"));
+        }
+        return void_core::Ok(std::make_unique<DepAsset>(DepAsset{text}));
+    }
+};
+
+struct TempAssetDir {
+    std::filesystem::path path;
+
+    TempAssetDir() {
+        path = std::filesystem::temp_directory_path() /
+            ("void_deps_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        std::filesystem::create_directories(path);
+    }
+
+    ~TempAssetDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    void write(const std::string& name, const std::string& content) const {
+        std::ofstream out(path / name, std::ios::trunc);
+        out << content;
+    }
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// AssetDependencyGraph Tests
+// =============================================================================
+
+TEST_CASE("AssetDependencyGraph: records forward and reverse edges", "[asset][dependency]") {
+    AssetDependencyGraph graph;
+    graph.set_dependencies(id(1), AssetPath("atlas.png"), {}, {});
+    graph.set_dependencies(id(2), AssetPath("rock.mat"), {id(1)}, {});
+    graph.set_dependencies(id(3), AssetPath("wood.mat"), {id(1)}, {});
+
+    REQUIRE(graph.node_count() == 3);
+    REQUIRE(graph.edge_count() == 2);
+    REQUIRE(graph.dependencies(id(2)) == std::vector<AssetId>{id(1)});
+    REQUIRE(graph.dependents(id(1)) == std::vector<AssetId>{id(2), id(3)});
+
+    // Re-recording replaces old edges
+    graph.set_dependencies(id(3), AssetPath("wood.mat"), {}, {});
+    REQUIRE(graph.dependents(id(1)) == std::vector<AssetId>{id(2)});
+}
+
+TEST_CASE("AssetDependencyGraph: invalidation set is minimal", "[asset][dependency]") {
+    AssetDependencyGraph graph;
+    graph.set_dependencies(id(1), AssetPath("atlas.png"), {}, {});
+    graph.set_dependencies(id(2), AssetPath("other.png"), {}, {});
+    graph.set_dependencies(id(3), AssetPath("rock.mat"), {id(1)}, {});
+    graph.set_dependencies(id(4), AssetPath("grass.mat"), {id(2)}, {});
+    graph.set_dependencies(id(5), AssetPath("cliff.prefab"), {id(3)}, {});
+
+    auto affected = graph.invalidation_set({id(1)});
+    REQUIRE(affected.size() == 3);
+    REQUIRE(affected.count(id(1)) == 1);
+    REQUIRE(affected.count(id(3)) == 1);
+    REQUIRE(affected.count(id(5)) == 1);
+    REQUIRE(affected.count(id(4)) == 0);
+}
+
+TEST_CASE("AssetDependencyGraph: plan is topologically ordered", "[asset][dependency]") {
+    AssetDependencyGraph graph;
+    // Diamond: 1 <- 2, 1 <- 3, {2, 3} <- 4
+    graph.set_dependencies(id(1), AssetPath("a"), {}, {});
+    graph.set_dependencies(id(2), AssetPath("b"), {id(1)}, {});
+    graph.set_dependencies(id(3), AssetPath("c"), {id(1)}, {});
+    graph.set_dependencies(id(4), AssetPath("d"), {id(2), id(3)}, {});
+
+    auto plan = graph.plan({id(1)});
+    REQUIRE(plan.size() == 4);
+    REQUIRE_FALSE(plan.has_cycle);
+    REQUIRE(plan.waves.size() == 3);
+    REQUIRE(plan.waves[1] == std::vector<AssetId>{id(2), id(3)});
+    REQUIRE(wave_of(plan, id(4)) == 2);
+    REQUIRE(plan.is_root(id(1)));
+    REQUIRE_FALSE(plan.is_root(id(4)));
+
+    // Without cascade only the change itself is planned
+    auto direct = graph.plan({id(1)}, {}, false);
+    REQUIRE(direct.size() == 1);
+}
+
+TEST_CASE("AssetDependencyGraph: file dependencies cascade", "[asset][dependency]") {
+    AssetDependencyGraph graph;
+    graph.set_dependencies(id(1), AssetPath("lit.shader"), {}, {AssetPath("common.glsl")});
+    graph.set_dependencies(id(2), AssetPath("rock.mat"), {}, {AssetPath("lit.shader")});
+
+    REQUIRE(graph.file_dependents(AssetPath("common.glsl")) == std::vector<AssetId>{id(1)});
+
+    // Include file that is not an asset
+    auto plan = graph.plan({}, {AssetPath("common.glsl")});
+    REQUIRE(plan.size() == 2);
+    REQUIRE(wave_of(plan, id(1)) < wave_of(plan, id(2)));
+
+    // Path dependency resolves to the asset registered at that path
+    REQUIRE(graph.dependencies(id(2)) == std::vector<AssetId>{id(1)});
+}
+
+TEST_CASE("AssetDependencyGraph: cycles are reported and still planned", "[asset][dependency]") {
+    AssetDependencyGraph graph;
+    graph.set_dependencies(id(1), AssetPath("a"), {id(2)}, {});
+    graph.set_dependencies(id(2), AssetPath("b"), {id(1)}, {});
+
+    auto plan = graph.plan({id(1)});
+    REQUIRE(plan.has_cycle);
+    REQUIRE(plan.size() == 2);
+}
+
+TEST_CASE("AssetDependencyGraph: remove drops outgoing edges", "[asset][dependency]") {
+    AssetDependencyGraph graph;
+    graph.set_dependencies(id(1), AssetPath("a"), {}, {});
+    graph.set_dependencies(id(2), AssetPath("b"), {id(1)}, {});
+
+    graph.remove(id(2));
+    REQUIRE_FALSE(graph.contains(id(2)));
+    REQUIRE(graph.dependents(id(1)).empty());
+}
+
+// =============================================================================
+// Cascading Reload Tests
+// =============================================================================
+
+TEST_CASE("AssetHotReloadManager: manual reload queues dependents", "[asset][dependency]") {
+    TempAssetDir dir;
+    dir.write("atlas.dep", "atlas v1");
+    dir.write("rock.dep", "dep atlas.dep\nrock");
+    dir.write("wood.dep", "dep atlas.dep\nwood");
+    dir.write("other.dep", "other");
+
+    AssetServer server(AssetServerConfig().with_asset_dir(dir.path.string()));
+    server.register_loader(std::make_unique<DepAssetLoader>());
+
+    // Load the atlas first so path dependencies resolve to asset edges
+    auto atlas = server.load<DepAsset>("atlas.dep");
+    server.process();
+    auto rock = server.load<DepAsset>("rock.dep");
+    auto wood = server.load<DepAsset>("wood.dep");
+    auto other = server.load<DepAsset>("other.dep");
+    server.process();
+
+    REQUIRE(server.dependency_graph().dependents(atlas.id()).size() == 2);
+    REQUIRE(server.get_metadata(atlas.id())->dependents.size() == 2);
+
+    AssetHotReloadManager manager(server);
+
+    std::vector<AssetReloadBatch> batches;
+    manager.set_batch_callback([&](const AssetReloadBatch& batch) {
+        batches.push_back(batch);
+    });
+
+    auto result = manager.reload(atlas.id());
+    REQUIRE(result.success);
+    REQUIRE(batches.empty());
+    REQUIRE(manager.drain_results().size() == 1);
+    REQUIRE(manager.pending_count() == 2);
+
+    manager.start();
+    manager.process();
+
+    REQUIRE(batches.size() == 1);
+    REQUIRE(batches[0].results.size() == 2);
+    REQUIRE(batches[0].wave_count == 1);
+    REQUIRE(batches[0].all_succeeded());
+    REQUIRE(manager.pending_count() == 0);
+
+    auto results = manager.drain_results();
+    REQUIRE(results.size() == 2);
+    for (const auto& entry : results) {
+        REQUIRE(entry.id != other.id());
+        REQUIRE(entry.id != atlas.id());
+    }
+    (void)rock;
+    (void)wood;
+}
+
+TEST_CASE("AssetHotReloadManager: diamond reloads once in dependency order", "[asset][dependency]") {
+    TempAssetDir dir;
+    dir.write("base.dep", "base");
+    dir.write("left.dep", "dep base.dep\nleft");
+    dir.write("right.dep", "dep base.dep\nright");
+    dir.write("top.dep", "dep left.dep\ndep right.dep\ntop");
+
+    AssetServer server(AssetServerConfig().with_asset_dir(dir.path.string()));
+    server.register_loader(std::make_unique<DepAssetLoader>());
+
+    auto base = server.load<DepAsset>("base.dep");
+    server.process();
+    auto left = server.load<DepAsset>("left.dep");
+    auto right = server.load<DepAsset>("right.dep");
+    server.process();
+    auto top = server.load<DepAsset>("top.dep");
+    server.process();
+
+    AssetHotReloadManager manager(server);
+
+    std::vector<AssetReloadBatch> batches;
+    manager.set_batch_callback([&](const AssetReloadBatch& batch) {
+        batches.push_back(batch);
+    });
+
+    auto top_generation = server.get_metadata(top.id())->generation;
+
+    manager.start();
+    manager.queue_reload(base.id());
+    manager.process();
+
+    REQUIRE(batches.size() == 1);
+    const auto& batch = batches[0];
+    REQUIRE(batch.results.size() == 4);
+    REQUIRE(batch.wave_count == 3);
+    REQUIRE(batch.cascaded_count == 3);
+    REQUIRE(batch.all_succeeded());
+    // Waves reload one after another: base, then left and right, then top
+    REQUIRE(batch.results[0].id == base.id());
+    std::set<AssetId> middle{batch.results[1].id, batch.results[2].id};
+    REQUIRE(middle == std::set<AssetId>{left.id(), right.id()});
+    REQUIRE(batch.results[3].id == top.id());
+    REQUIRE(server.get_metadata(top.id())->generation == top_generation + 1);
+}
+
+TEST_CASE("AssetHotReloadManager: failed dependency skips dependents", "[asset][dependency]") {
+    TempAssetDir dir;
+    dir.write("atlas.dep", "atlas v1");
+    dir.write("rock.dep", "dep atlas.dep\nrock");
+
+    AssetServer server(AssetServerConfig().with_asset_dir(dir.path.string()));
+    server.register_loader(std::make_unique<DepAssetLoader>());
+
+    auto atlas = server.load<DepAsset>("atlas.dep");
+    server.process();
+    auto rock = server.load<DepAsset>("rock.dep");
+    server.process();
+
+    AssetHotReloadManager manager(server);
+    manager.start();
+
+    dir.write("atlas.dep", "broken");
+    manager.queue_reload(atlas.id());
+    manager.process();
+
+    auto results = manager.drain_results();
+    REQUIRE(results.size() == 2);
+    REQUIRE_FALSE(results[0].success);
+    REQUIRE(results[1].id == rock.id());
+    REQUIRE_FALSE(results[1].success);
+    REQUIRE(results[1].error.find("Dependency") != std::string::npos);
+}
@@ -0,0 +1,336 @@
+/// @file test_gltf_reader.cpp
+/// @brief Tests for the zero-copy glTF/GLB reader
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <void_engine/asset/loaders/gltf_reader.hpp>
+#include <void_engine/asset/loaders/model_loader.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace void_asset;
+using Catch::Approx;
+
+namespace {
+
+template<typename T>
+void append(std::vector<std::uint8_t>& out, const T& value) {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void pad(std::vector<std::uint8_t>& out, std::uint8_t fill) {
+    while (out.size() % 4 != 0) {
+        out.push_back(fill);
+    }
+}
+
+std::vector<std::uint8_t> make_glb(std::string json, std::vector<std::uint8_t> bin) {
+    std::vector<std::uint8_t> json_bytes(json.begin(), json.end());
+    pad(json_bytes, ' ');
+    pad(bin, 0);
+
+    std::vector<std::uint8_t> glb;
+    append(glb, std::uint32_t{0x46546C67});
+    append(glb, std::uint32_t{2});
+    append(glb, static_cast<std::uint32_t>(12 + 8 + json_bytes.size() + 8 + bin.size()));
+    append(glb, static_cast<std::uint32_t>(json_bytes.size()));
+    append(glb, std::uint32_t{0x4E4F534A});
+    glb.insert(glb.end(), json_bytes.begin(), json_bytes.end());
+    append(glb, static_cast<std::uint32_t>(bin.size()));
+    append(glb, std::uint32_t{0x004E4942});
+    glb.insert(glb.end(), bin.begin(), bin.end());
+    return glb;
+}
+
+// Triangle: interleaved float POSITION + normalized u8 COLOR_0 (stride 16),
+// followed by u16 indices
+std::vector<std::uint8_t> make_triangle_glb(const std::string& attributes = R"("POSITION": 0, "COLOR_0": 1)") {
+    std::vector<std::uint8_t> bin;
+    const float positions[3][3] = {{0, 0, 0}, {1, 0, 0}, {0, 2, 0}};
+    for (int v = 0; v < 3; ++v) {
+        for (float p : positions[v]) {
+            append(bin, p);
+        }
+        bin.push_back(255);
+        bin.push_back(0);
+        bin.push_back(0);
+        bin.push_back(static_cast<std::uint8_t>(v == 2 ? 0 : 255));
+    }
+    for (std::uint16_t index : {std::uint16_t{0}, std::uint16_t{1}, std::uint16_t{2}}) {
+        append(bin, index);
+    }
+
+    std::string json = R"({
+        "asset": {"version": "2.0"},
+        "buffers": [{"byteLength": 54}],
+        "bufferViews": [
+            {"buffer": 0, "byteOffset": 0, "byteLength": 48, "byteStride": 16},
+            {"buffer": 0, "byteOffset": 48, "byteLength": 6}
+        ],
+        "accessors": [
+            {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3",
+             "min": [0, 0, 0], "max": [1, 2, 0]},
+            {"bufferView": 0, "byteOffset": 12, "componentType": 5121, "normalized": true,
+             "count": 3, "type": "VEC4"},
+            {"bufferView": 1, "componentType": 5123, "count": 3, "type": "SCALAR"}
+        ],
+        "meshes": [{"name": "tri", "primitives": [
+            {"attributes": {)" + attributes + R"(}, "indices": 2}
+        ]}],
+        "materials": [{"name": "red", "pbrMetallicRoughness": {"baseColorFactor": [1, 0, 0, 1]},
+                       "extensions": {"KHR_materials_ior": {"ior": 1.33}}}],
+        "nodes": [{"name": "root", "mesh": 0, "translation": [1, 2, 3]}],
+        "scenes": [{"nodes": [0]}],
+        "scene": 0
+    })";
+    return make_glb(json, bin);
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// GltfDocument Tests
+// =============================================================================
+
+TEST_CASE("GltfDocument: parses GLB descriptors", "[asset][gltf]") {
+    auto glb = make_triangle_glb();
+    REQUIRE(GltfDocument::is_glb(glb));
+
+    auto doc = GltfDocument::parse(glb);
+    REQUIRE(doc);
+
+    REQUIRE(doc.value().meshes().size() == 1);
+    REQUIRE(doc.value().meshes()[0].primitives[0].attribute("COLOR_0") == 1);
+    REQUIRE(doc.value().meshes()[0].primitives[0].attribute("NORMAL") == -1);
+    REQUIRE(doc.value().materials()[0].metallic_factor == Approx(1.0f));
+    REQUIRE(doc.value().materials()[0].ior);
+    REQUIRE(*doc.value().materials()[0].ior == Approx(1.33f));
+    REQUIRE(doc.value().nodes()[0].translation[2] == Approx(3.0f));
+    REQUIRE(doc.value().default_scene() == 0);
+}
+
+TEST_CASE("GltfDocument: accessors point into the BIN chunk", "[asset][gltf]") {
+    auto glb = make_triangle_glb();
+    auto doc = GltfDocument::parse(glb);
+    REQUIRE(doc);
+
+    auto positions = doc.value().accessor(0);
+    REQUIRE(positions);
+    REQUIRE(positions.value().stride == 16);
+    REQUIRE(positions.value().data >= glb.data());
+    REQUIRE(positions.value().data < glb.data() + glb.size());
+    REQUIRE(positions.value().max_values[1] == Approx(2.0f));
+
+    std::vector<float> unpacked(9);
+    gltf_unpack_floats(positions.value(), unpacked.data(), 3 * sizeof(float), 3);
+    REQUIRE(unpacked[3] == Approx(1.0f));
+    REQUIRE(unpacked[7] == Approx(2.0f));
+}
+
+TEST_CASE("GltfDocument: normalized and index conversion", "[asset][gltf]") {
+    auto glb = make_triangle_glb();
+    auto doc = GltfDocument::parse(glb);
+    REQUIRE(doc);
+
+    auto colors = doc.value().accessor(1);
+    REQUIRE(colors);
+    std::vector<float> rgba(12);
+    gltf_unpack_floats(colors.value(), rgba.data(), 4 * sizeof(float), 4);
+    REQUIRE(rgba[0] == Approx(1.0f));
+    REQUIRE(rgba[1] == Approx(0.0f));
+    REQUIRE(rgba[3] == Approx(1.0f));
+    REQUIRE(rgba[11] == Approx(0.0f));
+
+    auto indices = doc.value().accessor(2);
+    REQUIRE(indices);
+    std::vector<std::uint32_t> out(3);
+    gltf_unpack_indices(indices.value(), out.data());
+    REQUIRE(out == std::vector<std::uint32_t>{0, 1, 2});
+}
+
+TEST_CASE("GltfDocument: rejects out-of-range data", "[asset][gltf]") {
+    std::vector<std::uint8_t> bin(12, 0);
+
+    // Accessor reads past the end of its buffer view
+    auto overrun = make_glb(R"({
+        "buffers": [{"byteLength": 12}],
+        "bufferViews": [{"buffer": 0, "byteLength": 12}],
+        "accessors": [{"bufferView": 0, "componentType": 5126, "count": 2, "type": "VEC3"}]
+    })", bin);
+    auto doc = GltfDocument::parse(overrun);
+    REQUIRE(doc);
+    REQUIRE_FALSE(doc.value().accessor(0));
+    REQUIRE_FALSE(doc.value().accessor(5));
+
+    // Buffer view past the end of its buffer
+    auto bad_view = make_glb(R"({
+        "buffers": [{"byteLength": 12}],
+        "bufferViews": [{"buffer": 0, "byteOffset": 8, "byteLength": 8}]
+    })", bin);
+    REQUIRE_FALSE(GltfDocument::parse(bad_view));
+
+    // Truncated container
+    auto truncated = make_triangle_glb();
+    truncated.resize(40);
+    REQUIRE_FALSE(GltfDocument::parse(truncated));
+}
+
+TEST_CASE("GltfDocument: rejects bad strides and overflowing counts", "[asset][gltf]") {
+    std::vector<std::uint8_t> bin(48, 0);
+
+    // Byte stride smaller than a VEC3 float element
+    auto narrow = make_glb(R"({
+        "buffers": [{"byteLength": 48}],
+        "bufferViews": [{"buffer": 0, "byteLength": 48, "byteStride": 4}],
+        "accessors": [{"bufferView": 0, "componentType": 5126, "count": 2, "type": "VEC3"}]
+    })", bin);
+    auto doc = GltfDocument::parse(narrow);
+    REQUIRE(doc);
+    REQUIRE_FALSE(doc.value().accessor(0));
+
+    // count * stride wraps around size_t
+    auto huge = make_glb(R"({
+        "buffers": [{"byteLength": 48}],
+        "bufferViews": [{"buffer": 0, "byteLength": 48, "byteStride": 16}],
+        "accessors": [{"bufferView": 0, "componentType": 5126, "count": 1152921504606846977, "type": "VEC3"}]
+    })", bin);
+    doc = GltfDocument::parse(huge);
+    REQUIRE(doc);
+    REQUIRE_FALSE(doc.value().accessor(0));
+
+    // byteOffset + byteLength wraps around size_t
+    auto wrapped = make_glb(R"({
+        "buffers": [{"byteLength": 48}],
+        "bufferViews": [{"buffer": 0, "byteOffset": 8, "byteLength": 18446744073709551612}]
+    })", bin);
+    REQUIRE_FALSE(GltfDocument::parse(wrapped));
+}
+
+TEST_CASE("GltfDocument: tolerates wrongly typed flags", "[asset][gltf]") {
+    std::vector<std::uint8_t> bin(12, 0);
+    auto glb = make_glb(R"({
+        "buffers": [{"byteLength": 12}],
+        "bufferViews": [{"buffer": 0, "byteLength": 12}],
+        "accessors": [{"bufferView": 0, "componentType": 5126, "count": 1, "type": "VEC3", "normalized": "yes"}],
+        "materials": [{"doubleSided": 1}]
+    })", bin);
+    auto doc = GltfDocument::parse(glb);
+    REQUIRE(doc);
+    REQUIRE_FALSE(doc.value().accessor(0).value().normalized);
+    REQUIRE_FALSE(doc.value().materials()[0].double_sided);
+}
+
+TEST_CASE("gltf_unpack_joints: widens and pads to four joints", "[asset][gltf]") {
+    SECTION("unsigned short joints above 255 are kept") {
+        const std::uint16_t joints[8] = {1, 300, 65535, 0, 4, 5, 6, 7};
+        GltfAccessorView view;
+        view.data = reinterpret_cast<const std::uint8_t*>(joints);
+        view.count = 2;
+        view.component_type = GltfComponentType::UnsignedShort;
+        view.components = 4;
+        view.stride = view.element_size();
+
+        std::vector<std::uint16_t> out(8);
+        gltf_unpack_joints(view, out.data());
+        REQUIRE(out == std::vector<std::uint16_t>{1, 300, 65535, 0, 4, 5, 6, 7});
+    }
+
+    SECTION("fewer than four components keep a stride of four") {
+        const std::uint8_t joints[6] = {1, 2, 3, 4, 5, 6};
+        GltfAccessorView view;
+        view.data = joints;
+        view.count = 3;
+        view.component_type = GltfComponentType::UnsignedByte;
+        view.components = 2;
+        view.stride = view.element_size();
+
+        std::vector<std::uint16_t> out(12, 99);
+        gltf_unpack_joints(view, out.data());
+        REQUIRE(out == std::vector<std::uint16_t>{1, 2, 0, 0, 3, 4, 0, 0, 5, 6, 0, 0});
+    }
+
+    SECTION("unsupported component types are zero-filled") {
+        const float joints[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+        GltfAccessorView view;
+        view.data = reinterpret_cast<const std::uint8_t*>(joints);
+        view.count = 1;
+        view.component_type = GltfComponentType::Float;
+        view.components = 4;
+        view.stride = view.element_size();
+
+        std::vector<std::uint16_t> out(4, 99);
+        gltf_unpack_joints(view, out.data());
+        REQUIRE(out == std::vector<std::uint16_t>{0, 0, 0, 0});
+    }
+}
+
+TEST_CASE("GltfDocument: resolves data URIs and external buffers", "[asset][gltf]") {
+    // "AACAPwAAAEA=" is {1.0f, 2.0f}
+    std::string embedded = R"({
+        "buffers": [{"byteLength": 8, "uri": "data:application/octet-stream;base64,AACAPwAAAEA="}],
+        "bufferViews": [{"buffer": 0, "byteLength": 8}],
+        "accessors": [{"bufferView": 0, "componentType": 5126, "count": 2, "type": "SCALAR"}]
+    })";
+    auto doc = GltfDocument::parse({reinterpret_cast<const std::uint8_t*>(embedded.data()), embedded.size()});
+    REQUIRE(doc);
+    auto values = doc.value().accessor(0);
+    REQUIRE(values);
+    float out[2] = {};
+    gltf_unpack_floats(values.value(), out, sizeof(float), 1);
+    REQUIRE(out[1] == Approx(2.0f));
+
+    std::string external = R"({
+        "buffers": [{"byteLength": 4, "uri": "mesh.bin"}],
+        "bufferViews": [{"buffer": 0, "byteLength": 4}]
+    })";
+    std::span<const std::uint8_t> external_bytes(reinterpret_cast<const std::uint8_t*>(external.data()), external.size());
+    REQUIRE_FALSE(GltfDocument::parse(external_bytes));
+
+    std::vector<std::uint8_t> mesh_bin = {1, 2, 3, 4};
+    auto resolved = GltfDocument::parse(external_bytes, [&](const std::string& uri)
+        -> std::optional<std::span<const std::uint8_t>> {
+        if (uri == "mesh.bin") {
+            return std::span<const std::uint8_t>(mesh_bin);
+        }
+        return std::nullopt;
+    });
+    REQUIRE(resolved);
+    REQUIRE(resolved.value().external_uris() == std::vector<std::string>{"mesh.bin"});
+    REQUIRE(resolved.value().buffer_view(0).data() == mesh_bin.data());
+}
+
+// =============================================================================
+// ModelLoader Tests
+// =============================================================================
+
+TEST_CASE("ModelLoader: loads GLB through the zero-copy reader", "[asset][gltf]") {
+    auto glb = make_triangle_glb();
+    AssetPath path("models/tri.glb");
+    LoadContext ctx(glb, path, AssetId{1});
+
+    ModelLoader loader(ModelLoadConfig{});
+    auto result = loader.load(ctx);
+    REQUIRE(result);
+
+    const auto& model = *result.value();
+    REQUIRE(model.meshes.size() == 1);
+    const auto& prim = model.meshes[0].primitives[0];
+    REQUIRE(prim.vertex_count() == 3);
+    REQUIRE(prim.positions[7] == Approx(2.0f));
+    REQUIRE(prim.colors0.size() == 12);
+    REQUIRE(prim.indices.size() == 3);
+    REQUIRE(model.materials[0].base_color_factor[1] == Approx(0.0f));
+    REQUIRE(model.nodes[0].translation[0] == Approx(1.0f));
+}
+
+TEST_CASE("ModelLoader: rejects JOINTS_0 with float components", "[asset][gltf]") {
+    // Accessor 0 holds float positions
+    auto glb = make_triangle_glb(R"("POSITION": 0, "JOINTS_0": 0)");
+    AssetPath path("models/tri.glb");
+    LoadContext ctx(glb, path, AssetId{1});
+
+    ModelLoader loader(ModelLoadConfig{});
+    REQUIRE_FALSE(loader.load(ctx));
+}
@@ -3,6 +3,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <void_engine/asset/hot_reload.hpp>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <thread>
@@ -195,6 +198,46 @@ TEST_CASE("PollingAssetWatcher: add and remove paths", "[asset][hot_reload]") {
     watcher.remove_path("nonexistent/path");
 }
 
+// =============================================================================
+// NativeAssetWatcher Tests
+// =============================================================================
+
+TEST_CASE("NativeAssetWatcher: callback may poll and remove paths", "[asset][hot_reload]") {
+    if (!void_core::FileWatchService::is_supported()) {
+        return;  // Native file watching not supported
+    }
+
+    namespace fs = std::filesystem;
+    auto dir = fs::temp_directory_path() /
+        ("void_aw_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    fs::create_directories(dir);
+
+    NativeAssetWatcher watcher;
+    std::atomic<int> calls{0};
+    std::atomic<std::size_t> polled{0};
+    watcher.set_callback([&](const AssetChangeEvent&) {
+        polled += watcher.poll().size();
+        watcher.remove_path(dir.string());
+        ++calls;
+    });
+    watcher.add_path(dir.string());
+    watcher.start();
+
+    { std::ofstream(dir / "a.txt") << "a"; }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (calls.load() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    REQUIRE(calls.load() == 1);
+    REQUIRE(polled.load() == 1);
+    watcher.stop();
+
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+}
+
 // =============================================================================
 // AssetHotReloadManager Tests
 // =============================================================================
@@ -0,0 +1,209 @@
+/// @file test_streaming.cpp
+/// @brief Tests for void_asset residency manager
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/asset/streaming.hpp>
+#include <vector>
+
+using namespace void_asset;
+
+namespace {
+
+StreamableDesc make_desc(std::uint64_t id, StreamingCategory category,
+                         std::vector<std::size_t> levels) {
+    StreamableDesc desc;
+    desc.id = AssetId{id};
+    desc.category = category;
+    desc.level_bytes = std::move(levels);
+    return desc;
+}
+
+// Run frames until no more loads are started
+void settle(ResidencyManager& mgr, int frames = 16) {
+    for (int i = 0; i < frames; ++i) {
+        mgr.update(0.016f);
+    }
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// StreamableDesc Tests
+// =============================================================================
+
+TEST_CASE("StreamableDesc: texture mip chain", "[asset][streaming]") {
+    auto desc = StreamableDesc::texture(AssetId{1}, 8, 4, 4);
+
+    REQUIRE(desc.category == StreamingCategory::Texture);
+    REQUIRE(desc.level_count() == 4);  // 8x4, 4x2, 2x1, 1x1
+    REQUIRE(desc.level_bytes[0] == 8 * 4 * 4);
+    REQUIRE(desc.level_bytes[3] == 4);
+    REQUIRE(desc.resident_bytes(2) == 2 * 4 + 4);
+}
+
+TEST_CASE("ResidencyRequest: merge keeps most demanding", "[asset][streaming]") {
+    auto a = ResidencyRequest::at_distance(AssetId{1}, 100.0f, 3);
+    auto b = ResidencyRequest::at_distance(AssetId{1}, 10.0f, 1);
+    a.merge(b);
+
+    REQUIRE(a.distance == 10.0f);
+    REQUIRE(a.level == 1);
+    REQUIRE_FALSE(a.pinned);
+
+    a.merge(ResidencyRequest::pin(AssetId{1}, 2));
+    REQUIRE(a.pinned);
+    REQUIRE(a.level == 1);
+}
+
+// =============================================================================
+// ResidencyManager Tests
+// =============================================================================
+
+TEST_CASE("ResidencyManager: streams coarse to fine", "[asset][streaming]") {
+    ResidencyManager mgr;
+    mgr.register_asset(make_desc(1, StreamingCategory::Mesh, {400, 200, 100}));
+
+    std::vector<std::uint32_t> loaded;
+    mgr.set_stream_in([&](AssetId id, std::uint32_t level) {
+        loaded.push_back(level);
+        mgr.complete_stream_in(id, level);
+        return true;
+    });
+
+    for (int i = 0; i < 8; ++i) {
+        mgr.request(ResidencyRequest::at_distance(AssetId{1}, 5.0f, 0));
+        mgr.update(0.016f);
+    }
+
+    REQUIRE(loaded == std::vector<std::uint32_t>{2, 1, 0});
+    REQUIRE(mgr.resident_level(AssetId{1}) == 0);
+
+    auto events = mgr.drain_events();
+    REQUIRE(events.size() == 3);
+    REQUIRE(events.back().type == ResidencyEventType::Refined);
+    REQUIRE(events.back().level == 0);
+    REQUIRE(events.back().previous_level == 1);
+}
+
+TEST_CASE("ResidencyManager: budget favours closer assets", "[asset][streaming]") {
+    ResidencyManager mgr(ResidencyManagerConfig()
+        .with_budget(StreamingCategory::Texture, 1000));
+
+    mgr.register_asset(make_desc(1, StreamingCategory::Texture, {600, 150, 50}));
+    mgr.register_asset(make_desc(2, StreamingCategory::Texture, {600, 150, 50}));
+
+    for (int i = 0; i < 10; ++i) {
+        mgr.request(ResidencyRequest::at_distance(AssetId{1}, 1.0f));
+        mgr.request(ResidencyRequest::at_distance(AssetId{2}, 500.0f));
+        mgr.update(0.016f);
+    }
+
+    REQUIRE(mgr.resident_level(AssetId{1}) == 0);
+    REQUIRE(mgr.resident_level(AssetId{2}) == 1);
+
+    auto stats = mgr.stats();
+    REQUIRE(stats.resident_bytes[0] <= 1000);
+}
+
+TEST_CASE("ResidencyManager: pinned assets ignore budget", "[asset][streaming]") {
+    ResidencyManager mgr(ResidencyManagerConfig()
+        .with_budget(StreamingCategory::Mesh, 100));
+
+    mgr.register_asset(make_desc(1, StreamingCategory::Mesh, {500, 100}));
+
+    for (int i = 0; i < 4; ++i) {
+        mgr.request(ResidencyRequest::pin(AssetId{1}));
+        mgr.update(0.016f);
+    }
+
+    REQUIRE(mgr.resident_level(AssetId{1}) == 0);
+    REQUIRE(mgr.stats().over_budget_frames > 0);
+}
+
+TEST_CASE("ResidencyManager: unrequested assets are evicted under pressure", "[asset][streaming]") {
+    ResidencyManager mgr(ResidencyManagerConfig()
+        .with_budget(StreamingCategory::Other, 300)
+        .with_request_linger_frames(2));
+
+    mgr.register_asset(make_desc(1, StreamingCategory::Other, {200, 100}));
+    mgr.register_asset(make_desc(2, StreamingCategory::Other, {200, 100}));
+
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> dropped;
+    mgr.set_stream_out([&](AssetId id, std::uint32_t keep) {
+        dropped.emplace_back(id.raw(), keep);
+    });
+
+    for (int i = 0; i < 6; ++i) {
+        mgr.request(ResidencyRequest::at_distance(AssetId{1}, 1.0f));
+        mgr.update(0.016f);
+    }
+    REQUIRE(mgr.resident_level(AssetId{1}) == 0);
+
+    // Asset 1 falls out of view, asset 2 comes in
+    for (int i = 0; i < 10; ++i) {
+        mgr.request(ResidencyRequest::at_distance(AssetId{2}, 1.0f));
+        mgr.update(0.016f);
+    }
+
+    REQUIRE(mgr.resident_level(AssetId{2}) == 0);
+    REQUIRE(mgr.resident_level(AssetId{1}) == k_not_resident);
+    REQUIRE_FALSE(dropped.empty());
+    REQUIRE(dropped.front().first == 1);
+}
+
+TEST_CASE("ResidencyManager: respects per-frame stream-in limit", "[asset][streaming]") {
+    ResidencyManager mgr(ResidencyManagerConfig().with_max_stream_ins_per_frame(2));
+
+    std::size_t started = 0;
+    mgr.set_stream_in([&](AssetId, std::uint32_t) {
+        ++started;
+        return true;  // Never completes
+    });
+
+    for (std::uint64_t id = 1; id <= 5; ++id) {
+        mgr.register_asset(make_desc(id, StreamingCategory::Mesh, {10}));
+        mgr.request(ResidencyRequest::at_distance(AssetId{id}, static_cast<float>(id)));
+    }
+    mgr.update(0.016f);
+
+    REQUIRE(started == 2);
+    REQUIRE(mgr.is_streaming(AssetId{1}));
+    REQUIRE(mgr.is_streaming(AssetId{2}));
+    REQUIRE_FALSE(mgr.is_streaming(AssetId{5}));
+}
+
+TEST_CASE("ResidencyManager: failed loads are reported", "[asset][streaming]") {
+    ResidencyManager mgr;
+    mgr.register_asset(make_desc(1, StreamingCategory::Audio, {64}));
+    mgr.set_stream_in([&](AssetId id, std::uint32_t level) {
+        mgr.complete_stream_in(id, level, false);
+        return true;
+    });
+
+    mgr.request(ResidencyRequest::at_distance(AssetId{1}, 1.0f));
+    settle(mgr, 2);
+
+    auto events = mgr.drain_events();
+    REQUIRE_FALSE(events.empty());
+    REQUIRE(events.front().type == ResidencyEventType::Failed);
+    REQUIRE(mgr.resident_level(AssetId{1}) == k_not_resident);
+    REQUIRE(mgr.stats().failures >= 1);
+}
+
+TEST_CASE("ResidencyManager: unregister streams out", "[asset][streaming]") {
+    ResidencyManager mgr;
+    mgr.register_asset(make_desc(1, StreamingCategory::Mesh, {10, 5}));
+
+    mgr.request(ResidencyRequest::pin(AssetId{1}, 1));
+    settle(mgr, 3);
+    REQUIRE(mgr.resident_level(AssetId{1}) == 1);
+
+    bool dropped = false;
+    mgr.set_stream_out([&](AssetId, std::uint32_t keep) {
+        dropped = keep == k_not_resident;
+    });
+
+    REQUIRE(mgr.unregister_asset(AssetId{1}));
+    REQUIRE(dropped);
+    REQUIRE_FALSE(mgr.is_registered(AssetId{1}));
+}
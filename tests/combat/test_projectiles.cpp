@@ -0,0 +1,254 @@
+/// @file test_projectiles.cpp
+/// @brief Tests for pooled projectiles, configuration ids and hit handling
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/combat/combat.hpp>
+
+#include <vector>
+
+using namespace void_combat;
+using void_math::Vec3;
+
+namespace {
+
+const EntityId k_shooter = EntityId::create(1, 0);
+const EntityId k_wall = EntityId::create(2, 0);
+
+ProjectileConfig bullet(float damage = 10.0f) {
+    ProjectileConfig config;
+    config.speed = 10.0f;
+    config.damage = damage;
+    return config;
+}
+
+/// Every sweep hits the wall
+void hit_everything(ProjectileSystem& system) {
+    system.set_batch_raycast_func([](std::span<const ProjectileSweep> sweeps, std::span<ProjectileHit> hits) {
+        for (std::size_t i = 0; i < sweeps.size(); ++i) {
+            hits[i].hit = true;
+            hits[i].point = sweeps[i].to;
+            hits[i].entity = k_wall;
+        }
+    });
+}
+
+ProjectileId fire(ProjectileSystem& system, const ProjectileConfig& config) {
+    return system.spawn(config, Vec3{0.0f, 0.0f, 0.0f}, Vec3{1.0f, 0.0f, 0.0f}, k_shooter);
+}
+
+} // namespace
+
+// =============================================================================
+// Pool Tests
+// =============================================================================
+
+TEST_CASE("ProjectileSystem: destroyed ids go stale when their slot is reused", "[combat][projectiles]") {
+    ProjectileSystem system;
+
+    ProjectileId first = fire(system, bullet());
+    ProjectileId second = fire(system, bullet());
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(first.value != second.value);
+    REQUIRE(system.active_count() == 2);
+
+    system.destroy(first);
+    REQUIRE(system.active_count() == 1);
+    REQUIRE_FALSE(system.get_state(first));
+    REQUIRE(system.get_state(second));
+
+    ProjectileId reused = fire(system, bullet());
+    REQUIRE(reused);
+    REQUIRE(reused.value != first.value);
+    REQUIRE_FALSE(system.get_state(first));
+
+    // Destroying a stale id leaves the projectile in its slot alone
+    system.destroy(first);
+    REQUIRE(system.active_count() == 2);
+    REQUIRE(system.get_state(reused));
+
+    SECTION("clear invalidates every id") {
+        system.clear();
+        REQUIRE(system.active_count() == 0);
+        REQUIRE_FALSE(system.get_state(second));
+        REQUIRE_FALSE(system.get_state(reused));
+
+        ProjectileId fresh = fire(system, bullet());
+        REQUIRE_FALSE(system.get_state(second));
+        REQUIRE_FALSE(system.get_state(reused));
+        REQUIRE(system.get_state(fresh));
+    }
+}
+
+TEST_CASE("ProjectileSystem: expired projectiles are removed before they move", "[combat][projectiles]") {
+    ProjectileSystem system;
+    ProjectileConfig config = bullet();
+    config.lifetime = 0.25f;
+
+    ProjectileId id = fire(system, config);
+    system.update(0.1f);
+    REQUIRE(system.get_state(id)->position.x > 0.9f);
+
+    system.update(0.1f);
+    system.update(0.1f);
+    REQUIRE_FALSE(system.get_state(id));
+    REQUIRE(system.active_count() == 0);
+}
+
+// =============================================================================
+// Configuration Id Tests
+// =============================================================================
+
+TEST_CASE("ProjectileSystem: configurations used on spawn share one id", "[combat][projectiles]") {
+    ProjectileSystem system;
+
+    ProjectileId a = fire(system, bullet());
+    ProjectileId b = fire(system, bullet());
+    ProjectileId c = fire(system, bullet(25.0f));
+
+    ProjectileConfigId shared = system.config_of(a);
+    REQUIRE(shared);
+    REQUIRE(system.config_of(b).value == shared.value);
+    REQUIRE(system.config_of(c).value != shared.value);
+    REQUIRE(system.get_config(shared)->damage == 10.0f);
+
+    // The id can spawn more projectiles while one still references it
+    ProjectileId d = system.spawn(shared, Vec3{}, Vec3{0.0f, 1.0f, 0.0f}, k_shooter);
+    REQUIRE(d);
+    REQUIRE(system.config_of(d).value == shared.value);
+
+    system.destroy(a);
+    system.destroy(b);
+    REQUIRE(system.get_config(shared));
+    system.destroy(d);
+
+    // Released with its last projectile
+    REQUIRE_FALSE(system.get_config(shared));
+    REQUIRE_FALSE(system.spawn(shared, Vec3{}, Vec3{1.0f, 0.0f, 0.0f}, k_shooter));
+    REQUIRE(system.active_count() == 1);
+
+    SECTION("a reused index gets a new generation") {
+        ProjectileConfigId registered = system.register_config(bullet(99.0f));
+        REQUIRE((registered.value & 0xFFFFF) == (shared.value & 0xFFFFF));
+        REQUIRE(registered.value != shared.value);
+
+        REQUIRE_FALSE(system.get_config(shared));
+        REQUIRE_FALSE(system.spawn(shared, Vec3{}, Vec3{1.0f, 0.0f, 0.0f}, k_shooter));
+        REQUIRE(system.get_config(registered)->damage == 99.0f);
+    }
+
+    SECTION("a reinterned configuration gets a new id") {
+        ProjectileId e = fire(system, bullet());
+        REQUIRE(system.config_of(e).value != shared.value);
+        REQUIRE_FALSE(system.get_config(shared));
+    }
+}
+
+TEST_CASE("ProjectileSystem: registered configurations outlive their projectiles", "[combat][projectiles]") {
+    ProjectileSystem system;
+    ProjectileConfigId id = system.register_config(bullet(40.0f));
+    REQUIRE(id);
+
+    ProjectileId shot = system.spawn(id, Vec3{}, Vec3{1.0f, 0.0f, 0.0f}, k_shooter);
+    REQUIRE(system.config_of(shot).value == id.value);
+    system.destroy(shot);
+
+    REQUIRE(system.get_config(id)->damage == 40.0f);
+    REQUIRE(system.spawn(id, Vec3{}, Vec3{1.0f, 0.0f, 0.0f}, k_shooter));
+
+    REQUIRE_FALSE(system.get_config(ProjectileConfigId{}));
+    REQUIRE_FALSE(system.spawn(ProjectileConfigId{id.value + 1}, Vec3{}, Vec3{}, k_shooter));
+}
+
+// =============================================================================
+// Hit Tests
+// =============================================================================
+
+TEST_CASE("ProjectileSystem: hits destroy projectiles after their penetrations", "[combat][projectiles]") {
+    ProjectileSystem system;
+    hit_everything(system);
+
+    std::vector<float> damage;
+    system.on_hit([&](ProjectileId, EntityId entity, const Vec3&, float amount) {
+        REQUIRE(entity == k_wall);
+        damage.push_back(amount);
+    });
+
+    ProjectileConfig piercing = bullet(5.0f);
+    piercing.max_penetrations = 2;
+    ProjectileConfig bouncing = bullet(7.0f);
+    bouncing.destroy_on_hit = false;
+
+    ProjectileId pierce = fire(system, piercing);
+    ProjectileId bounce = fire(system, bouncing);
+    ProjectileId plain = fire(system, bullet());
+
+    system.update(0.1f);
+    REQUIRE(damage == std::vector<float>{5.0f, 7.0f, 10.0f});
+    REQUIRE_FALSE(system.get_state(plain));
+    REQUIRE(system.get_state(pierce)->penetrations == 1);
+
+    system.update(0.1f);
+    system.update(0.1f);
+    REQUIRE_FALSE(system.get_state(pierce));
+    REQUIRE(system.get_state(bounce));
+    REQUIRE(damage.size() == 7);
+}
+
+TEST_CASE("ProjectileSystem: hit callbacks may destroy and spawn projectiles", "[combat][projectiles]") {
+    ProjectileSystem system;
+    hit_everything(system);
+
+    ProjectileConfig bouncing = bullet();
+    bouncing.destroy_on_hit = false;
+
+    std::vector<ProjectileId> shots;
+    for (int i = 0; i < 8; ++i) {
+        shots.push_back(fire(system, bouncing));
+    }
+
+    SECTION("destroyed projectiles report no later hits") {
+        std::vector<ProjectileId> reported;
+        system.on_hit([&](ProjectileId projectile, EntityId, const Vec3&, float) {
+            reported.push_back(projectile);
+            system.destroy(shots[7]);
+            REQUIRE(system.active_count() == 8);
+        });
+
+        system.update(0.1f);
+        REQUIRE(reported.size() == 7);
+        REQUIRE(system.active_count() == 7);
+        REQUIRE_FALSE(system.get_state(shots[7]));
+    }
+
+    SECTION("spawns with new configurations don't corrupt the reported hits") {
+        // Each hit interns a new configuration, growing the configuration storage
+        std::vector<float> damage;
+        float next = 100.0f;
+        system.on_hit([&](ProjectileId, EntityId, const Vec3&, float amount) {
+            damage.push_back(amount);
+            for (int i = 0; i < 16; ++i) {
+                fire(system, bullet(next++));
+            }
+        });
+
+        system.update(0.1f);
+        REQUIRE(damage == std::vector<float>(8, 10.0f));
+        REQUIRE(system.active_count() == 8 + 8 * 16);
+    }
+
+    SECTION("clear is deferred until the hits are reported") {
+        int hits = 0;
+        system.on_hit([&](ProjectileId, EntityId, const Vec3&, float) {
+            ++hits;
+            system.clear();
+        });
+
+        system.update(0.1f);
+        REQUIRE(hits == 1);
+        REQUIRE(system.active_count() == 0);
+        for (ProjectileId id : shots) {
+            REQUIRE_FALSE(system.get_state(id));
+        }
+    }
+}
@@ -0,0 +1,201 @@
+// void_core event-driven file watcher tests
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/core/file_watcher.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace void_core;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+struct TempDir {
+    fs::path path;
+
+    TempDir() {
+        path = fs::temp_directory_path() /
+            ("void_fw_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        fs::create_directories(path);
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+};
+
+void write_file(const fs::path& path, const std::string& content) {
+    std::ofstream out(path, std::ios::trunc);
+    out << content;
+}
+
+// Poll until at least one event arrives or the timeout elapses
+std::vector<ReloadEvent> wait_for_events(FileWatcher& watcher,
+                                         std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+    std::vector<ReloadEvent> all;
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        auto events = watcher.poll();
+        all.insert(all.end(), events.begin(), events.end());
+        if (!all.empty()) {
+            // Give the debounce window a chance to deliver stragglers
+            std::this_thread::sleep_for(std::chrono::milliseconds(150));
+            events = watcher.poll();
+            all.insert(all.end(), events.begin(), events.end());
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return all;
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// Factory
+// =============================================================================
+
+TEST_CASE("create_file_watcher returns a usable watcher", "[core][file_watcher]") {
+    auto watcher = create_file_watcher();
+    REQUIRE(watcher != nullptr);
+    REQUIRE(watcher->watched_count() == 0);
+}
+
+// =============================================================================
+// NativeFileWatcher
+// =============================================================================
+
+TEST_CASE("NativeFileWatcher watch and unwatch", "[core][file_watcher]") {
+    if (!FileWatchService::is_supported()) {
+        return;  // Native file watching not supported
+    }
+
+    TempDir dir;
+    NativeFileWatcher watcher;
+
+    REQUIRE(watcher.watch(dir.path.string()));
+    REQUIRE(watcher.is_watching(dir.path.string()));
+    REQUIRE(watcher.watched_count() == 1);
+
+    REQUIRE(watcher.unwatch(dir.path.string()));
+    REQUIRE_FALSE(watcher.is_watching(dir.path.string()));
+    REQUIRE_FALSE(watcher.unwatch(dir.path.string()));
+}
+
+TEST_CASE("NativeFileWatcher coalesces a write burst", "[core][file_watcher]") {
+    if (!FileWatchService::is_supported()) {
+        return;  // Native file watching not supported
+    }
+
+    TempDir dir;
+    auto file = dir.path / "data.txt";
+    write_file(file, "initial");
+
+    NativeFileWatcher watcher;
+    REQUIRE(watcher.watch(file.string()));
+
+    for (int i = 0; i < 10; ++i) {
+        write_file(file, "burst " + std::to_string(i));
+    }
+
+    auto events = wait_for_events(watcher);
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].type == ReloadEventType::FileModified);
+    REQUIRE(events[0].path == file.string());
+}
+
+TEST_CASE("NativeFileWatcher reports atomic save as modification", "[core][file_watcher]") {
+    if (!FileWatchService::is_supported()) {
+        return;  // Native file watching not supported
+    }
+
+    TempDir dir;
+    auto file = dir.path / "shader.glsl";
+    write_file(file, "v1");
+
+    NativeFileWatcher watcher;
+    REQUIRE(watcher.watch(file.string()));
+
+    auto temp = dir.path / "shader.glsl.tmp";
+    write_file(temp, "v2");
+    fs::rename(temp, file);
+
+    auto events = wait_for_events(watcher);
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].type == ReloadEventType::FileModified);
+    REQUIRE(events[0].path == file.string());
+}
+
+TEST_CASE("NativeFileWatcher watches directories recursively", "[core][file_watcher]") {
+    if (!FileWatchService::is_supported()) {
+        return;  // Native file watching not supported
+    }
+
+    TempDir dir;
+    fs::create_directories(dir.path / "textures");
+
+    NativeFileWatcher watcher;
+    REQUIRE(watcher.watch(dir.path.string()));
+
+    SECTION("existing subdirectory") {
+        write_file(dir.path / "textures" / "a.png", "png");
+
+        auto events = wait_for_events(watcher);
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].type == ReloadEventType::FileCreated);
+        REQUIRE(events[0].path == (dir.path / "textures" / "a.png").string());
+    }
+
+    SECTION("subdirectory created after watch") {
+        fs::create_directories(dir.path / "meshes");
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        write_file(dir.path / "meshes" / "b.glb", "glb");
+
+        auto events = wait_for_events(watcher);
+        REQUIRE_FALSE(events.empty());
+        REQUIRE(events.back().path == (dir.path / "meshes" / "b.glb").string());
+    }
+
+    SECTION("rename inside tree") {
+        write_file(dir.path / "old.txt", "x");
+        (void)wait_for_events(watcher);
+
+        fs::rename(dir.path / "old.txt", dir.path / "new.txt");
+
+        auto events = wait_for_events(watcher);
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].type == ReloadEventType::FileRenamed);
+        REQUIRE(events[0].old_path == (dir.path / "old.txt").string());
+        REQUIRE(events[0].path == (dir.path / "new.txt").string());
+    }
+}
+
+TEST_CASE("FileWatchService shares OS watches between subscribers", "[core][file_watcher]") {
+    if (!FileWatchService::is_supported()) {
+        return;  // Native file watching not supported
+    }
+
+    TempDir dir;
+    write_file(dir.path / "a.txt", "a");
+    write_file(dir.path / "b.txt", "b");
+
+    auto& service = FileWatchService::instance();
+    auto before = service.stats().os_watches;
+
+    NativeFileWatcher first;
+    NativeFileWatcher second;
+    REQUIRE(first.watch((dir.path / "a.txt").string()));
+    REQUIRE(second.watch((dir.path / "b.txt").string()));
+
+    REQUIRE(service.stats().os_watches == before + 1);
+
+    first.clear();
+    second.clear();
+    REQUIRE(service.stats().os_watches == before);
+}
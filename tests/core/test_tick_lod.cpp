@@ -0,0 +1,152 @@
+// void_core TickLodScheduler tests
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <void_engine/core/tick_lod.hpp>
+#include <vector>
+
+using namespace void_core;
+
+namespace {
+
+TickLodConfig test_config() {
+    TickLodConfig config;
+    config.tier_distances = {10.0f, 50.0f};
+    config.tier_intervals = {1, 4, 8};
+    config.hidden_distance_scale = 2.0f;
+    config.hysteresis = 0.1f;
+    return config;
+}
+
+} // namespace
+
+// =============================================================================
+// TickLodScheduler Tests
+// =============================================================================
+
+TEST_CASE("TickLodScheduler without observers", "[core][tick_lod]") {
+    TickLodScheduler scheduler(test_config());
+    EntityId entity = EntityId::create(1, 0);
+    scheduler.add_entity(entity, TickLodEntity{{500.0f, 0.0f, 0.0f}});
+
+    SECTION("every entity ticks every frame") {
+        for (int frame = 0; frame < 8; ++frame) {
+            scheduler.begin_frame(0.016f);
+            auto decision = scheduler.decision(entity);
+            REQUIRE(decision.tick);
+            REQUIRE(decision.tier == 0);
+            REQUIRE(decision.dt == Catch::Approx(0.016f));
+        }
+    }
+
+    SECTION("unregistered entities tick with the frame dt") {
+        scheduler.begin_frame(0.02f);
+        auto decision = scheduler.decision(EntityId::create(99, 0));
+        REQUIRE(decision.tick);
+        REQUIRE(decision.dt == Catch::Approx(0.02f));
+    }
+}
+
+TEST_CASE("TickLodScheduler tiers", "[core][tick_lod]") {
+    TickLodScheduler scheduler(test_config());
+    std::vector<void_math::Vec3> observers{{0.0f, 0.0f, 0.0f}};
+    scheduler.set_observers(observers);
+
+    EntityId near = EntityId::create(1, 0);
+    EntityId mid = EntityId::create(2, 0);
+    EntityId far = EntityId::create(3, 0);
+    scheduler.add_entity(near, TickLodEntity{{5.0f, 0.0f, 0.0f}});
+    scheduler.add_entity(mid, TickLodEntity{{30.0f, 0.0f, 0.0f}});
+    scheduler.add_entity(far, TickLodEntity{{200.0f, 0.0f, 0.0f}});
+
+    SECTION("tiers follow distance") {
+        scheduler.begin_frame(0.016f);
+        REQUIRE(scheduler.decision(near).tier == 0);
+        REQUIRE(scheduler.decision(mid).tier == 1);
+        REQUIRE(scheduler.decision(far).tier == 2);
+        REQUIRE(scheduler.tier_counts() == std::vector<std::size_t>{1, 1, 1});
+    }
+
+    SECTION("entities tick once per interval with accumulated dt") {
+        int ticks = 0;
+        for (int frame = 0; frame < 16; ++frame) {
+            scheduler.begin_frame(0.01f);
+            auto decision = scheduler.decision(far);
+            if (decision.tick) {
+                ++ticks;
+                if (ticks > 1) {
+                    REQUIRE(decision.dt == Catch::Approx(0.08f));
+                }
+            }
+        }
+        REQUIRE(ticks == 2);
+    }
+
+    SECTION("importance and visibility scale distance") {
+        scheduler.set_importance(mid, 4.0f);
+        scheduler.set_visible(near, false);
+        scheduler.begin_frame(0.016f);
+        REQUIRE(scheduler.decision(mid).tier == 0);
+        REQUIRE(scheduler.decision(near).tier == 0);
+
+        scheduler.set_position(near, {8.0f, 0.0f, 0.0f});
+        scheduler.begin_frame(0.016f);
+        REQUIRE(scheduler.decision(near).tier == 1);
+    }
+
+    SECTION("always_tick pins the first tier") {
+        scheduler.set_always_tick(far, true);
+        scheduler.begin_frame(0.016f);
+        REQUIRE(scheduler.decision(far).tier == 0);
+        REQUIRE(scheduler.decision(far).tick);
+    }
+
+    SECTION("hysteresis delays slowing down") {
+        scheduler.begin_frame(0.016f);
+        scheduler.set_position(near, {10.5f, 0.0f, 0.0f});
+        scheduler.begin_frame(0.016f);
+        REQUIRE(scheduler.decision(near).tier == 0);
+
+        scheduler.set_position(near, {11.5f, 0.0f, 0.0f});
+        scheduler.begin_frame(0.016f);
+        REQUIRE(scheduler.decision(near).tier == 1);
+    }
+}
+
+TEST_CASE("TickLodScheduler staggers phases", "[core][tick_lod]") {
+    TickLodScheduler scheduler(test_config());
+    std::vector<void_math::Vec3> observers{{0.0f, 0.0f, 0.0f}};
+    scheduler.set_observers(observers);
+
+    for (std::uint32_t i = 0; i < 800; ++i) {
+        scheduler.add_entity(EntityId::create(i, 0), TickLodEntity{{100.0f, 0.0f, 0.0f}});
+    }
+
+    std::size_t total = 0;
+    for (int frame = 0; frame < 8; ++frame) {
+        scheduler.begin_frame(0.016f);
+        REQUIRE(scheduler.ticking_count() > 50);
+        REQUIRE(scheduler.ticking_count() < 150);
+        total += scheduler.ticking_count();
+    }
+    REQUIRE(total == 800);
+}
+
+TEST_CASE("TickLodScheduler registration", "[core][tick_lod]") {
+    TickLodScheduler scheduler;
+    EntityId a = EntityId::create(1, 0);
+    EntityId b = EntityId::create(2, 0);
+    scheduler.add_entity(a);
+    scheduler.add_entity(b);
+    REQUIRE(scheduler.entity_count() == 2);
+
+    scheduler.remove_entity(a);
+    REQUIRE_FALSE(scheduler.contains(a));
+    REQUIRE(scheduler.contains(b));
+
+    scheduler.begin_frame(0.016f);
+    REQUIRE(scheduler.decision(b).tick);
+
+    scheduler.clear();
+    REQUIRE(scheduler.entity_count() == 0);
+}
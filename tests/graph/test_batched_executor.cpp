@@ -0,0 +1,240 @@
+/// @file test_batched_executor.cpp
+/// @brief Tests for running one compiled graph over many instances
+
+#include <catch2/catch_test_macros.hpp>
+#include "execution.hpp"
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace void_graph;
+
+namespace {
+
+/// Pure node reporting whether the owning entity is even
+class IsEvenNode : public NodeBase {
+public:
+    explicit IsEvenNode(std::uint32_t id)
+        : NodeBase(NodeId::create(id, 0), NodeTypeId{}, "IsEven") {
+        purity_ = NodePurity::Pure;
+        add_output_pin("Even", PinType::Bool);
+    }
+
+    PinId execute(ExecutionContext& ctx) override {
+        ctx.pin_values[output_pins_[0].id] = ctx.owner_entity % 2 == 0;
+        return PinId{};
+    }
+
+    [[nodiscard]] PinId even() const { return output_pins_[0].id; }
+};
+
+/// Impure node recording which entities passed through it
+class VisitNode : public NodeBase {
+public:
+    explicit VisitNode(std::uint32_t id)
+        : NodeBase(NodeId::create(id, 0), NodeTypeId{}, "Visit") {
+        purity_ = NodePurity::Impure;
+        add_exec_input();
+        add_exec_output();
+    }
+
+    PinId execute(ExecutionContext& ctx) override {
+        visits.push_back(ctx.owner_entity);
+        return output_pins_[0].id;
+    }
+
+    [[nodiscard]] PinId exec_in() const { return input_pins_[0].id; }
+    [[nodiscard]] PinId exec_out() const { return output_pins_[0].id; }
+
+    std::vector<std::uint64_t> visits;
+};
+
+/// Latent node that waits until its context has run for a given time
+class WaitNode : public NodeBase {
+public:
+    WaitNode(std::uint32_t id, float seconds)
+        : NodeBase(NodeId::create(id, 0), NodeTypeId{}, "Wait"), seconds_(seconds) {
+        purity_ = NodePurity::Latent;
+        add_exec_input();
+        add_exec_output();
+    }
+
+    PinId execute(ExecutionContext&) override {
+        state_ = NodeState::Suspended;
+        return PinId{};
+    }
+
+    PinId resume(ExecutionContext& ctx) override {
+        if (ctx.total_time < seconds_) {
+            state_ = NodeState::Suspended;
+            return PinId{};
+        }
+        state_ = NodeState::Completed;
+        return output_pins_[0].id;
+    }
+
+    [[nodiscard]] PinId exec_in() const { return input_pins_[0].id; }
+    [[nodiscard]] PinId exec_out() const { return output_pins_[0].id; }
+
+private:
+    float seconds_;
+};
+
+/// Tick -> Branch(IsEven) -> Even | Odd -> Join
+struct BranchGraph {
+    Graph graph;
+    VisitNode* even = nullptr;
+    VisitNode* odd = nullptr;
+    VisitNode* join = nullptr;
+
+    BranchGraph() {
+        auto* tick = graph.add_node(std::make_unique<EventNode>(NodeId::create(1, 0), NodeTypeId{}, "Tick"));
+        auto* branch = graph.add_node(std::make_unique<BranchNode>(NodeId::create(2, 0), NodeTypeId{}));
+        auto* is_even = static_cast<IsEvenNode*>(graph.add_node(std::make_unique<IsEvenNode>(3)));
+        even = static_cast<VisitNode*>(graph.add_node(std::make_unique<VisitNode>(4)));
+        odd = static_cast<VisitNode*>(graph.add_node(std::make_unique<VisitNode>(5)));
+        join = static_cast<VisitNode*>(graph.add_node(std::make_unique<VisitNode>(6)));
+
+        REQUIRE(graph.connect(tick->output_pins()[0].id, branch->input_pins()[0].id));
+        REQUIRE(graph.connect(is_even->even(), branch->input_pins()[1].id));
+        REQUIRE(graph.connect(branch->output_pins()[0].id, even->exec_in()));
+        REQUIRE(graph.connect(branch->output_pins()[1].id, odd->exec_in()));
+        REQUIRE(graph.connect(even->exec_out(), join->exec_in()));
+        REQUIRE(graph.connect(odd->exec_out(), join->exec_in()));
+    }
+};
+
+CompiledGraph compile(const Graph& graph) {
+    GraphCompiler compiler;
+    auto result = compiler.compile(graph);
+    REQUIRE(result);
+    REQUIRE(result.value().is_valid());
+    return std::move(result).value();
+}
+
+std::vector<ExecutionContext*> pointers(std::vector<ExecutionContext>& contexts) {
+    std::vector<ExecutionContext*> out;
+    for (auto& ctx : contexts) out.push_back(&ctx);
+    return out;
+}
+
+} // namespace
+
+// =============================================================================
+// Batched Execution Tests
+// =============================================================================
+
+TEST_CASE("BatchedGraphExecutor: divergent lanes take their own branch", "[graph][batched]") {
+    BranchGraph g;
+    CompiledGraph compiled = compile(g.graph);
+
+    std::vector<ExecutionContext> contexts(8);
+    for (std::size_t i = 0; i < contexts.size(); ++i) {
+        contexts[i].owner_entity = i;
+    }
+
+    BatchedGraphExecutor executor;
+    auto ids = executor.start(compiled, "Tick", pointers(contexts));
+    REQUIRE(ids.size() == 8);
+    for (auto id : ids) {
+        REQUIRE_FALSE(executor.is_running(id));
+    }
+
+    REQUIRE(g.even->visits == std::vector<std::uint64_t>{0, 2, 4, 6});
+    REQUIRE(g.odd->visits == std::vector<std::uint64_t>{1, 3, 5, 7});
+    REQUIRE(g.join->visits.size() == 8);
+}
+
+TEST_CASE("BatchedGraphExecutor: lanes reconverge where flow joins", "[graph][batched]") {
+    BranchGraph g;
+    CompiledGraph compiled = compile(g.graph);
+
+    std::vector<ExecutionContext> contexts(16);
+    for (std::size_t i = 0; i < contexts.size(); ++i) {
+        contexts[i].owner_entity = i;
+    }
+
+    BatchedGraphExecutor executor;
+    executor.start(compiled, "Tick", pointers(contexts));
+
+    // Every instruction is issued once for its mask; the join is issued
+    // once for all 16 lanes rather than once per branch
+    const auto& stats = executor.stats();
+    REQUIRE(stats.batches == 1);
+    REQUIRE(stats.lanes == 16);
+    REQUIRE(stats.instructions_issued == compiled.instructions().size());
+    REQUIRE(stats.lane_instructions > stats.instructions_issued);
+}
+
+TEST_CASE("BatchedGraphExecutor: matches per-instance execution", "[graph][batched]") {
+    BranchGraph batched;
+    BranchGraph single;
+    CompiledGraph batched_code = compile(batched.graph);
+    CompiledGraph single_code = compile(single.graph);
+
+    std::vector<ExecutionContext> contexts(5);
+    for (std::size_t i = 0; i < contexts.size(); ++i) {
+        contexts[i].owner_entity = 10 + i;
+    }
+    BatchedGraphExecutor executor;
+    executor.start(batched_code, "Tick", pointers(contexts));
+
+    CompiledGraphExecutor reference;
+    for (std::size_t i = 0; i < contexts.size(); ++i) {
+        ExecutionContext ctx;
+        ctx.owner_entity = 10 + i;
+        reference.execute(single_code, "Tick", ctx);
+    }
+
+    REQUIRE(batched.even->visits == single.even->visits);
+    REQUIRE(batched.odd->visits == single.odd->visits);
+    REQUIRE(batched.join->visits == single.join->visits);
+}
+
+TEST_CASE("BatchedGraphExecutor: suspended lanes resume on update", "[graph][batched]") {
+    Graph graph;
+    auto* tick = graph.add_node(std::make_unique<EventNode>(NodeId::create(1, 0), NodeTypeId{}, "Tick"));
+    auto* wait = static_cast<WaitNode*>(graph.add_node(std::make_unique<WaitNode>(2, 1.0f)));
+    auto* done = static_cast<VisitNode*>(graph.add_node(std::make_unique<VisitNode>(3)));
+    REQUIRE(graph.connect(tick->output_pins()[0].id, wait->exec_in()));
+    REQUIRE(graph.connect(wait->exec_out(), done->exec_in()));
+    CompiledGraph compiled = compile(graph);
+
+    std::vector<ExecutionContext> contexts(3);
+    for (std::size_t i = 0; i < contexts.size(); ++i) {
+        contexts[i].owner_entity = i;
+    }
+    // Lane 2 started earlier and finishes its wait one update sooner
+    contexts[2].total_time = 0.5f;
+
+    BatchedGraphExecutor executor;
+    auto ids = executor.start(compiled, "Tick", pointers(contexts));
+    for (auto id : ids) {
+        REQUIRE(executor.is_running(id));
+    }
+    REQUIRE(done->visits.empty());
+
+    executor.update(0.6f);
+    REQUIRE(done->visits == std::vector<std::uint64_t>{2});
+    REQUIRE(executor.is_running(ids[0]));
+    REQUIRE_FALSE(executor.is_running(ids[2]));
+
+    executor.abort(ids[1]);
+    REQUIRE_FALSE(executor.is_running(ids[1]));
+
+    executor.update(0.6f);
+    REQUIRE(done->visits == std::vector<std::uint64_t>{2, 0});
+    REQUIRE_FALSE(executor.is_running(ids[0]));
+}
+
+TEST_CASE("BatchedGraphExecutor: unknown entry points fail every lane", "[graph][batched]") {
+    BranchGraph g;
+    CompiledGraph compiled = compile(g.graph);
+
+    std::vector<ExecutionContext> contexts(2);
+    BatchedGraphExecutor executor;
+    auto ids = executor.start(compiled, "Missing", pointers(contexts));
+    REQUIRE(ids.size() == 2);
+    REQUIRE(g.join->visits.empty());
+    REQUIRE_FALSE(executor.is_running(ids[0]));
+}
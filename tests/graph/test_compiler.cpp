@@ -0,0 +1,212 @@
+/// @file test_compiler.cpp
+/// @brief Tests for void_graph compilation, constant folding and dead code elimination
+
+#include <catch2/catch_test_macros.hpp>
+#include "execution.hpp"
+#include <memory>
+#include <vector>
+
+using namespace void_graph;
+
+namespace {
+
+using Op = CompiledInstruction::OpCode;
+
+/// Math node whose inputs have defaults, so it folds without wiring
+class ConstMathNode : public MathNode {
+public:
+    ConstMathNode(std::uint32_t id, Operation op, float a, float b)
+        : MathNode(NodeId::create(id, 0), NodeTypeId{}, op) {
+        input_pins_[0].default_value.value = a;
+        input_pins_[1].default_value.value = b;
+    }
+
+    PinId execute(ExecutionContext& ctx) override {
+        ++calls;
+        return MathNode::execute(ctx);
+    }
+
+    [[nodiscard]] PinId a() const { return input_pins_[0].id; }
+    [[nodiscard]] PinId result() const { return output_pins_[0].id; }
+
+    int calls = 0;
+};
+
+/// Impure node that records the Float on its input
+class SinkNode : public NodeBase {
+public:
+    explicit SinkNode(std::uint32_t id)
+        : NodeBase(NodeId::create(id, 0), NodeTypeId{}, "Sink") {
+        purity_ = NodePurity::Impure;
+        add_exec_input();
+        add_input_pin("Value", PinType::Float);
+        add_exec_output();
+    }
+
+    PinId execute(ExecutionContext& ctx) override {
+        auto it = ctx.pin_values.find(input_pins_[1].id);
+        received.push_back(it != ctx.pin_values.end() && std::holds_alternative<float>(it->second)
+                               ? std::get<float>(it->second) : -1.0f);
+        return output_pins_[0].id;
+    }
+
+    [[nodiscard]] PinId exec_in() const { return input_pins_[0].id; }
+    [[nodiscard]] PinId value() const { return input_pins_[1].id; }
+    [[nodiscard]] PinId exec_out() const { return output_pins_[0].id; }
+
+    std::vector<float> received;
+};
+
+/// Tick -> Sink(Value = (2 + 3) * 4)
+struct FoldGraph {
+    Graph graph;
+    EventNode* tick = nullptr;
+    ConstMathNode* add = nullptr;
+    ConstMathNode* mul = nullptr;
+    SinkNode* sink = nullptr;
+
+    FoldGraph() {
+        tick = static_cast<EventNode*>(graph.add_node(
+            std::make_unique<EventNode>(NodeId::create(1, 0), NodeTypeId{}, "Tick")));
+        add = static_cast<ConstMathNode*>(graph.add_node(
+            std::make_unique<ConstMathNode>(2, MathNode::Operation::Add, 2.0f, 3.0f)));
+        mul = static_cast<ConstMathNode*>(graph.add_node(
+            std::make_unique<ConstMathNode>(3, MathNode::Operation::Multiply, 0.0f, 4.0f)));
+        sink = static_cast<SinkNode*>(graph.add_node(std::make_unique<SinkNode>(4)));
+
+        REQUIRE(graph.connect(tick->output_pins()[0].id, sink->exec_in()));
+        REQUIRE(graph.connect(add->result(), mul->a()));
+        REQUIRE(graph.connect(mul->result(), sink->value()));
+    }
+};
+
+std::size_t count_ops(const CompiledGraph& compiled, Op op) {
+    std::size_t count = 0;
+    for (const auto& instr : compiled.instructions()) {
+        if (instr.op == op) ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+// =============================================================================
+// Compilation Tests
+// =============================================================================
+
+TEST_CASE("GraphCompiler: unoptimized code evaluates pure nodes at runtime", "[graph][compiler]") {
+    FoldGraph g;
+
+    GraphCompiler::Options options;
+    options.fold_constants = false;
+    options.eliminate_dead_code = false;
+    GraphCompiler compiler(options);
+
+    auto result = compiler.compile(g.graph);
+    REQUIRE(result);
+    const CompiledGraph& compiled = result.value();
+    REQUIRE(compiled.is_valid());
+    REQUIRE(compiled.get_entry_point("Tick").has_value());
+    REQUIRE(count_ops(compiled, Op::Execute) == 2);
+    REQUIRE(count_ops(compiled, Op::ExecutePure) == 2);
+
+    ExecutionContext ctx;
+    CompiledGraphExecutor executor;
+    auto run = executor.execute(compiled, "Tick", ctx);
+    REQUIRE(run.final_state == ExecutionState::Completed);
+    REQUIRE(g.sink->received == std::vector<float>{20.0f});
+    REQUIRE(g.add->calls == 1);
+    REQUIRE(g.mul->calls == 1);
+}
+
+TEST_CASE("GraphCompiler: folds constant math chains", "[graph][compiler]") {
+    FoldGraph g;
+
+    GraphCompiler::Options options;
+    options.eliminate_dead_code = false;
+    GraphCompiler compiler(options);
+
+    auto result = compiler.compile(g.graph);
+    REQUIRE(result);
+    const CompiledGraph& compiled = result.value();
+
+    // Both evaluations become Nops; the sink reads the folded result
+    REQUIRE(count_ops(compiled, Op::ExecutePure) == 0);
+    bool loads_result = false;
+    for (const auto& instr : compiled.instructions()) {
+        if (instr.op == Op::LoadConst && std::holds_alternative<float>(instr.immediate) &&
+            std::get<float>(instr.immediate) == 20.0f) {
+            loads_result = true;
+        }
+    }
+    REQUIRE(loads_result);
+
+    const int calls_after_compile = g.add->calls;
+    ExecutionContext ctx;
+    CompiledGraphExecutor executor;
+    executor.execute(compiled, "Tick", ctx);
+    REQUIRE(g.sink->received == std::vector<float>{20.0f});
+    REQUIRE(g.add->calls == calls_after_compile);
+}
+
+TEST_CASE("GraphCompiler: dead code elimination drops folded inputs", "[graph][compiler]") {
+    FoldGraph g;
+    GraphCompiler compiler;
+
+    auto result = compiler.compile(g.graph);
+    REQUIRE(result);
+    const CompiledGraph& compiled = result.value();
+
+    // Execute(Tick), LoadConst 20, StorePin Sink.Value, Execute(Sink)
+    auto code = compiled.instructions();
+    REQUIRE(code.size() == 4);
+    REQUIRE(code[0].op == Op::Execute);
+    REQUIRE(code[1].op == Op::LoadConst);
+    REQUIRE(code[2].op == Op::StorePin);
+    REQUIRE(compiled.pin(code[2].arg1) == g.sink->value());
+    REQUIRE(code[3].op == Op::Execute);
+    REQUIRE(count_ops(compiled, Op::Nop) == 0);
+
+    // Exec targets were remapped onto the compacted code
+    REQUIRE(compiled.exec_targets().size() == 1);
+    REQUIRE(compiled.exec_targets()[0].address == 1);
+
+    ExecutionContext ctx;
+    CompiledGraphExecutor executor;
+    executor.execute(compiled, "Tick", ctx);
+    executor.execute(compiled, "Tick", ctx);
+    REQUIRE(g.sink->received == std::vector<float>{20.0f, 20.0f});
+}
+
+TEST_CASE("GraphCompiler: nodes off the exec flow are not compiled", "[graph][compiler]") {
+    FoldGraph g;
+    auto* orphan = static_cast<SinkNode*>(g.graph.add_node(std::make_unique<SinkNode>(5)));
+    REQUIRE(g.graph.connect(g.add->result(), orphan->value()));
+
+    GraphCompiler compiler;
+    auto result = compiler.compile(g.graph);
+    REQUIRE(result);
+    REQUIRE(count_ops(result.value(), Op::Execute) == 2);
+
+    ExecutionContext ctx;
+    CompiledGraphExecutor executor;
+    executor.execute(result.value(), "Tick", ctx);
+    REQUIRE(orphan->received.empty());
+}
+
+TEST_CASE("GraphCompiler: edits bump the graph revision", "[graph][compiler]") {
+    FoldGraph g;
+    GraphCompiler compiler;
+
+    auto before = compiler.compile(g.graph);
+    REQUIRE(before);
+    REQUIRE(before.value().source_revision() == g.graph.revision());
+
+    auto* second = static_cast<SinkNode*>(g.graph.add_node(std::make_unique<SinkNode>(6)));
+    REQUIRE(g.graph.connect(g.sink->exec_out(), second->exec_in()));
+    REQUIRE(g.graph.revision() != before.value().source_revision());
+
+    auto after = compiler.compile(g.graph);
+    REQUIRE(after);
+    REQUIRE(count_ops(after.value(), Op::Execute) == 3);
+}
@@ -0,0 +1,265 @@
+// void_ir PatchBus tests
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ir/ir.hpp>
+
+#include <thread>
+
+using namespace void_ir;
+
+namespace {
+
+Patch health(EntityRef ref, std::int64_t value) {
+    return ComponentPatch::set(ref, "Health", Value(value));
+}
+
+Patch position(EntityRef ref) {
+    return ComponentPatch::set(ref, "Position", Value(0.0));
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// PatchBus Tests
+// =============================================================================
+
+TEST_CASE("PatchBus routing", "[ir][bus]") {
+    PatchBus bus;
+    NamespaceId ns{1};
+    NamespaceId other_ns{2};
+    EntityRef a(ns, 1);
+    EntityRef b(ns, 2);
+
+    int all = 0;
+    int by_ns = 0;
+    int by_entity = 0;
+    int by_kind = 0;
+    int by_type = 0;
+    int multi_type = 0;
+
+    (void)bus.subscribe(PatchFilter::all(), [&](const PatchEventRef&) { ++all; });
+    (void)bus.subscribe(PatchFilter::for_namespace(ns), [&](const PatchEventRef&) { ++by_ns; });
+    (void)bus.subscribe(PatchFilter::for_entity(a), [&](const PatchEventRef&) { ++by_entity; });
+    (void)bus.subscribe(PatchFilter::for_kinds({PatchKind::Entity}), [&](const PatchEventRef&) { ++by_kind; });
+    (void)bus.subscribe(PatchFilter::for_components({"Health"}), [&](const PatchEventRef&) { ++by_type; });
+    (void)bus.subscribe(PatchFilter::for_components({"Health", "Position"}),
+                        [&](const PatchEventRef&) { ++multi_type; });
+
+    bus.publish(health(a, 10), ns);
+    bus.publish(position(b), ns);
+    bus.publish(EntityPatch::create(b, "b"), other_ns);
+
+    REQUIRE(all == 3);
+    REQUIRE(by_ns == 2);
+    REQUIRE(by_entity == 1);
+    REQUIRE(by_kind == 1);
+    REQUIRE(by_type == 1);
+    REQUIRE(multi_type == 2);
+}
+
+TEST_CASE("PatchBus component filter without kinds", "[ir][bus]") {
+    PatchBus bus;
+    NamespaceId ns{1};
+    EntityRef a(ns, 1);
+
+    // Component types alone only restrict component patches
+    PatchFilter filter;
+    filter.component_types = {"Health"};
+
+    int count = 0;
+    (void)bus.subscribe(filter, [&](const PatchEventRef&) { ++count; });
+
+    bus.publish(health(a, 1), ns);
+    bus.publish(position(a), ns);
+    bus.publish(EntityPatch::create(a, "a"), ns);
+
+    REQUIRE(count == 2);
+}
+
+TEST_CASE("PatchBus delivers batches without copying", "[ir][bus]") {
+    PatchBus bus;
+    NamespaceId ns{1};
+    EntityRef a(ns, 1);
+    EntityRef b(ns, 2);
+
+    PatchBatch batch;
+    batch.push(health(a, 1));
+    batch.push(health(b, 2));
+    batch.push(position(a));
+    batch.push(health(a, 3));
+
+    std::vector<const Patch*> seen;
+    std::vector<std::size_t> sequences;
+    (void)bus.subscribe(PatchFilter::for_entity(a), [&](const PatchEventRef& event) {
+        seen.push_back(&event.patch);
+        sequences.push_back(event.sequence_number);
+    });
+
+    std::vector<std::pair<std::size_t, std::size_t>> runs;
+    std::vector<const Patch*> run_starts;
+    (void)bus.subscribe_batch(PatchFilter::for_components({"Health"}), [&](const PatchBatchEvent& event) {
+        runs.emplace_back(event.first_sequence, event.patches.size());
+        run_starts.push_back(event.patches.data());
+    });
+
+    bus.publish_batch(batch, ns, TransactionId(7));
+
+    REQUIRE(seen.size() == 3);
+    REQUIRE(seen[0] == &batch.patches()[0]);
+    REQUIRE(seen[1] == &batch.patches()[2]);
+    REQUIRE(seen[2] == &batch.patches()[3]);
+    REQUIRE(sequences == std::vector<std::size_t>{0, 2, 3});
+
+    REQUIRE(runs.size() == 2);
+    REQUIRE(runs[0] == std::pair<std::size_t, std::size_t>{0, 2});
+    REQUIRE(runs[1] == std::pair<std::size_t, std::size_t>{3, 1});
+    REQUIRE(run_starts[0] == &batch.patches()[0]);
+    REQUIRE(run_starts[1] == &batch.patches()[3]);
+
+    REQUIRE(bus.sequence_number() == 4);
+}
+
+TEST_CASE("PatchBus unsubscribe", "[ir][bus]") {
+    PatchBus bus;
+    NamespaceId ns{1};
+    EntityRef a(ns, 1);
+
+    int first = 0;
+    int second = 0;
+    auto id1 = bus.subscribe(PatchFilter::for_entity(a), [&](const PatchEventRef&) { ++first; });
+    auto id2 = bus.subscribe(PatchFilter::for_entity(a), [&](const PatchEventRef&) { ++second; });
+    auto id3 = bus.subscribe_batch(PatchFilter::all(), [&](const PatchBatchEvent&) {});
+    REQUIRE(bus.subscription_count() == 3);
+
+    REQUIRE(bus.unsubscribe(id1));
+    REQUIRE_FALSE(bus.unsubscribe(id1));
+    REQUIRE(bus.unsubscribe(id3));
+
+    bus.publish(health(a, 1), ns);
+    REQUIRE(first == 0);
+    REQUIRE(second == 1);
+    REQUIRE(bus.subscription_count() == 1);
+
+    REQUIRE(bus.unsubscribe(id2));
+    REQUIRE(bus.subscription_count() == 0);
+}
+
+// =============================================================================
+// AsyncPatchBus Tests
+// =============================================================================
+
+TEST_CASE("AsyncPatchBus queue", "[ir][bus]") {
+    AsyncPatchBus bus(4);
+    NamespaceId ns{1};
+    EntityRef a(ns, 1);
+
+    REQUIRE(bus.capacity() == 4);
+    REQUIRE(bus.empty());
+    REQUIRE_FALSE(bus.try_consume().has_value());
+
+    bus.publish(health(a, 1), ns);
+    bus.publish(health(a, 2), ns);
+    REQUIRE(bus.queue_size() == 2);
+
+    auto event = bus.try_consume();
+    REQUIRE(event.has_value());
+    REQUIRE(event->sequence_number == 0);
+    REQUIRE(event->patch.as<ComponentPatch>().value.as_int() == 1);
+
+    // Wrap around the ring several times
+    for (int i = 0; i < 10; ++i) {
+        bus.publish(health(a, i), ns);
+        auto all = bus.consume_all();
+        REQUIRE(all.size() == (i == 0 ? 2 : 1));
+        REQUIRE(all.back().patch.as<ComponentPatch>().value.as_int() == i);
+    }
+    REQUIRE(bus.empty());
+
+    auto timed = bus.consume_timeout(std::chrono::milliseconds(1));
+    REQUIRE_FALSE(timed.has_value());
+}
+
+TEST_CASE("AsyncPatchBus overflow from a single publisher", "[ir][bus]") {
+    AsyncPatchBus bus(8);
+    NamespaceId ns{1};
+    EntityRef a(ns, 1);
+
+    // Publishing past the capacity before anything consumes must not block
+    for (int i = 0; i < 100; ++i) {
+        bus.publish(health(a, i), ns);
+    }
+    REQUIRE(bus.queue_size() == 100);
+    REQUIRE(bus.overflow_count() == 92);
+
+    PatchBatch more;
+    for (int i = 100; i < 110; ++i) {
+        more.push(health(a, i));
+    }
+    bus.publish_batch(std::move(more), ns);
+
+    auto all = bus.consume_all();
+    REQUIRE(all.size() == 110);
+    for (std::size_t i = 0; i < all.size(); ++i) {
+        REQUIRE(all[i].sequence_number == i);
+        REQUIRE(all[i].patch.as<ComponentPatch>().value.as_int() == static_cast<int>(i));
+    }
+    REQUIRE(bus.empty());
+
+    // Once drained, the ring is used again
+    bus.publish(health(a, 0), ns);
+    REQUIRE(bus.overflow_count() == 102);
+    REQUIRE(bus.try_consume().has_value());
+    REQUIRE(bus.empty());
+}
+
+TEST_CASE("AsyncPatchBus multiple producers", "[ir][bus]") {
+    AsyncPatchBus bus(64);
+    NamespaceId ns{1};
+    constexpr int k_producers = 4;
+    constexpr int k_per_producer = 2000;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < k_producers; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < k_per_producer; ++i) {
+                bus.publish(health(EntityRef(ns, static_cast<std::uint64_t>(p)), i), ns);
+            }
+        });
+    }
+
+    std::vector<int> next(k_producers, 0);
+    int received = 0;
+    bool ordered = true;
+    while (received < k_producers * k_per_producer) {
+        auto event = bus.consume();
+        REQUIRE(event.has_value());
+        const auto& cp = event->patch.as<ComponentPatch>();
+        auto p = static_cast<std::size_t>(cp.entity.entity_id);
+        ordered = ordered && cp.value.as_int() == next[p];
+        ++next[p];
+        ++received;
+    }
+
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    REQUIRE(ordered);
+    REQUIRE(bus.empty());
+}
+
+TEST_CASE("AsyncPatchBus shutdown wakes consumer", "[ir][bus]") {
+    AsyncPatchBus bus;
+
+    bool received = true;
+    std::thread consumer([&] {
+        received = bus.consume().has_value();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    bus.shutdown();
+    consumer.join();
+
+    REQUIRE_FALSE(received);
+    REQUIRE(bus.is_shutdown());
+}
@@ -293,6 +293,127 @@ TEST_CASE("SnapshotDelta", "[ir][snapshot]") {
     }
 }
 
+TEST_CASE("SnapshotDelta encoding", "[ir][snapshot]") {
+    NamespaceId ns(0);
+
+    auto make_component = [](std::uint64_t id, float x) {
+        Value c = Value::empty_object();
+        c["position"] = Value(Vec3{x, 1.0f, 2.0f});
+        c["rotation"] = Value(Vec4{0.0f, 0.0f, 0.0f, 1.0f});
+        c["health"] = Value(static_cast<std::int64_t>(100 + id));
+        c["tags"] = Value(ValueArray{Value("enemy"), Value(0.5)});
+        return c;
+    };
+
+    Snapshot before(SnapshotId(3), ns);
+    for (std::uint64_t id = 0; id < 200; ++id) {
+        EntitySnapshot e;
+        e.entity = EntityRef(ns, id);
+        e.name = "Entity";
+        e.components["Transform"] = make_component(id, static_cast<float>(id));
+        before.add_entity(std::move(e));
+    }
+
+    Snapshot after = before.clone();
+    for (std::uint64_t id = 0; id < 200; id += 10) {
+        EntitySnapshot e = after.get_entity(EntityRef(ns, id))->clone();
+        Value c = make_component(id, static_cast<float>(id) + 0.25f);
+        c["health"] = Value(static_cast<std::int64_t>(90));
+        c.as_object_mut().erase(Symbol("tags"));
+        e.components["Transform"] = std::move(c);
+        after.add_entity(std::move(e));
+    }
+    after.remove_entity(EntityRef(ns, 5));
+    EntitySnapshot added;
+    added.entity = EntityRef(ns, 1000);
+    added.name = "Spawned";
+    added.components["Health"] = Value(10);
+    after.add_entity(std::move(added));
+
+    auto delta = SnapshotDelta::compute(before, after);
+    REQUIRE(delta.component_changes().size() == 20);
+    REQUIRE(delta.entity_changes().size() == 2);
+
+    auto check_round_trip = [&](const std::optional<SnapshotDelta>& decoded) {
+        REQUIRE(decoded.has_value());
+        REQUIRE(decoded->entity_changes().size() == delta.entity_changes().size());
+        REQUIRE(decoded->component_changes().size() == delta.component_changes().size());
+        for (std::size_t i = 0; i < delta.component_changes().size(); ++i) {
+            const auto& a = delta.component_changes()[i];
+            const auto& b = decoded->component_changes()[i];
+            REQUIRE(a.entity == b.entity);
+            REQUIRE(a.component_type == b.component_type);
+            REQUIRE(a.type == b.type);
+            REQUIRE(*a.old_value == *b.old_value);
+            REQUIRE(*a.new_value == *b.new_value);
+        }
+        for (std::size_t i = 0; i < delta.entity_changes().size(); ++i) {
+            const auto& a = delta.entity_changes()[i];
+            const auto& b = decoded->entity_changes()[i];
+            REQUIRE(a.entity == b.entity);
+            REQUIRE(a.type == b.type);
+            REQUIRE(a.old_state.has_value() == b.old_state.has_value());
+            REQUIRE(a.new_state.has_value() == b.new_state.has_value());
+            if (a.new_state) {
+                REQUIRE(a.new_state->name == b.new_state->name);
+                REQUIRE(a.new_state->components == b.new_state->components);
+            }
+            if (a.old_state) {
+                REQUIRE(a.old_state->components == b.old_state->components);
+            }
+        }
+    };
+
+    SECTION("round trip without baseline") {
+        auto data = serialize_delta(delta);
+        check_round_trip(deserialize_delta(data));
+    }
+
+    SECTION("round trip against baseline") {
+        auto data = serialize_delta(delta, &before);
+        check_round_trip(deserialize_delta(data, &before));
+    }
+
+    SECTION("baseline omits old values") {
+        auto standalone = serialize_delta(delta);
+        auto with_baseline = serialize_delta(delta, &before);
+        REQUIRE(with_baseline.size() < standalone.size());
+        REQUIRE(with_baseline.size() < serialize_snapshot(after).size() / 20);
+    }
+
+    SECTION("baseline is required when used") {
+        auto data = serialize_delta(delta, &before);
+        REQUIRE_FALSE(deserialize_delta(data).has_value());
+        REQUIRE_FALSE(deserialize_delta(data, &after).has_value());
+    }
+
+    SECTION("truncated input is rejected") {
+        auto data = serialize_delta(delta);
+        data.resize(data.size() / 2);
+        REQUIRE_FALSE(deserialize_delta(data).has_value());
+    }
+
+    SECTION("varint and zigzag") {
+        BinaryWriter writer;
+        writer.write_varint(0);
+        writer.write_varint(300);
+        writer.write_varint(UINT64_MAX);
+        writer.write_zigzag(-1);
+        writer.write_zigzag(INT64_MIN);
+        REQUIRE(writer.buffer().size() == 1 + 2 + 10 + 1 + 10);
+
+        BinaryReader reader(writer.buffer());
+        REQUIRE(reader.read_varint() == 0);
+        REQUIRE(reader.read_varint() == 300);
+        REQUIRE(reader.read_varint() == UINT64_MAX);
+        REQUIRE(reader.read_zigzag() == -1);
+        REQUIRE(reader.read_zigzag() == INT64_MIN);
+        REQUIRE(reader.valid());
+        (void)reader.read_varint();
+        REQUIRE_FALSE(reader.valid());
+    }
+}
+
 // =============================================================================
 // SnapshotManager Tests
 // =============================================================================
@@ -0,0 +1,132 @@
+// void_ir Symbol tests
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/ir/ir.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace void_ir;
+
+// =============================================================================
+// Symbol Tests
+// =============================================================================
+
+TEST_CASE("Symbol interning", "[ir][symbol]") {
+    SECTION("empty symbol has id zero") {
+        Symbol s;
+        REQUIRE(s.empty());
+        REQUIRE(s.id() == 0);
+        REQUIRE(s.str().empty());
+        REQUIRE(Symbol("") == s);
+    }
+
+    SECTION("same text gives same id") {
+        Symbol a("Transform");
+        Symbol b(std::string("Transform"));
+        REQUIRE(a == b);
+        REQUIRE(a.id() == b.id());
+        REQUIRE_FALSE(a.empty());
+    }
+
+    SECTION("different text gives different id") {
+        Symbol a("position");
+        Symbol b("rotation");
+        REQUIRE(a != b);
+    }
+
+    SECTION("text round-trips") {
+        Symbol s("velocity");
+        REQUIRE(s.str() == "velocity");
+        REQUIRE(s.view() == "velocity");
+        REQUIRE(s == "velocity");
+        REQUIRE(Symbol::from_id(s.id()) == s);
+        REQUIRE(Symbol::from_id(0) == Symbol());
+    }
+
+    SECTION("find does not intern") {
+        auto before = SymbolTable::instance().size();
+        REQUIRE_FALSE(Symbol::find("symbol_test_never_interned").has_value());
+        REQUIRE(SymbolTable::instance().size() == before);
+
+        Symbol s("symbol_test_interned");
+        auto found = Symbol::find("symbol_test_interned");
+        REQUIRE(found.has_value());
+        REQUIRE(*found == s);
+    }
+
+    SECTION("from_id rejects ids that were never interned") {
+        auto next = static_cast<std::uint32_t>(SymbolTable::instance().size());
+        REQUIRE_FALSE(SymbolTable::instance().contains(next));
+        REQUIRE_FALSE(Symbol::from_id(next).has_value());
+        REQUIRE_FALSE(Symbol::from_id(0xFFFFFFFFu).has_value());
+
+        // The table reads unknown ids as the empty string
+        REQUIRE(SymbolTable::instance().text(0xFFFFFFFFu).empty());
+    }
+
+    SECTION("hash uses id") {
+        Symbol a("Health");
+        Symbol b("Health");
+        REQUIRE(std::hash<Symbol>{}(a) == std::hash<Symbol>{}(b));
+    }
+}
+
+TEST_CASE("Symbol concurrent interning", "[ir][symbol]") {
+    constexpr int k_threads = 4;
+    constexpr int k_names = 2000;
+
+    std::vector<std::vector<std::uint32_t>> ids(k_threads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < k_threads; ++t) {
+        threads.emplace_back([t, &ids] {
+            for (int i = 0; i < k_names; ++i) {
+                ids[t].push_back(Symbol("concurrent_" + std::to_string(i)).id());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 1; t < k_threads; ++t) {
+        REQUIRE(ids[t] == ids[0]);
+    }
+    for (int i = 0; i < k_names; ++i) {
+        REQUIRE(Symbol::from_id(ids[0][i])->str() == "concurrent_" + std::to_string(i));
+    }
+}
+
+TEST_CASE("Symbol keys in values and patches", "[ir][symbol]") {
+    SECTION("object keys are interned") {
+        Value obj = Value::empty_object();
+        obj["health"] = Value(100);
+
+        Symbol key("health");
+        REQUIRE(obj.contains(key));
+        REQUIRE(obj.get(key)->as_int() == 100);
+        REQUIRE(obj.as_object().begin()->first == key);
+    }
+
+    SECTION("object keys survive serialization") {
+        Value obj = Value::empty_object();
+        obj["position"] = Value(Vec3{1, 2, 3});
+
+        BinaryWriter writer;
+        serialize_value(writer, obj);
+        BinaryReader reader(writer.buffer());
+        Value restored = deserialize_value(reader);
+
+        REQUIRE(restored.contains(Symbol("position")));
+        REQUIRE(restored == obj);
+    }
+
+    SECTION("patch fields compare by id") {
+        auto patch = ComponentPatch::set_field(
+            EntityRef(NamespaceId(1), 5), "Transform", "position", Value(1.0));
+
+        REQUIRE(patch.component_type == Symbol("Transform"));
+        REQUIRE(patch.field_path == Symbol("position"));
+        REQUIRE(patch.component_type.str() == "Transform");
+    }
+}
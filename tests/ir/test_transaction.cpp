@@ -3,6 +3,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <void_engine/ir/ir.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 using namespace void_ir;
 
 // =============================================================================
@@ -368,3 +371,303 @@ TEST_CASE("TransactionQueue", "[ir][transaction]") {
         REQUIRE(queue.total_patch_count() == 3);
     }
 }
+
+TEST_CASE("TransactionApplier plan", "[ir][transaction]") {
+    NamespaceId ns(0);
+    auto no_parents = [](EntityRef) -> std::optional<EntityRef> { return std::nullopt; };
+
+    SECTION("partitions by entity in transaction order") {
+        PatchBatch batch;
+        batch.push(ComponentPatch::set(EntityRef(ns, 1), "Health", Value(100)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 2), "Health", Value(50)));
+        batch.push(ComponentPatch::set_field(EntityRef(ns, 1), "Transform", "position", Value(1.0)));
+
+        auto plan = TransactionApplier::plan(batch);
+        REQUIRE(plan.phases.size() == 1);
+        REQUIRE_FALSE(plan.phases[0].serial);
+        REQUIRE(plan.partition_count() == 2);
+        REQUIRE(plan.phases[0].partitions[0] == std::vector<std::size_t>{0, 2});
+        REQUIRE(plan.phases[0].partitions[1] == std::vector<std::size_t>{1});
+    }
+
+    SECTION("hierarchy patch joins child and parent") {
+        PatchBatch batch;
+        batch.push(ComponentPatch::set(EntityRef(ns, 1), "Name", Value("Parent")));
+        batch.push(ComponentPatch::set(EntityRef(ns, 2), "Name", Value("Child")));
+        batch.push(ComponentPatch::set(EntityRef(ns, 3), "Name", Value("Other")));
+        batch.push(HierarchyPatch::set_parent(EntityRef(ns, 2), EntityRef(ns, 1)));
+
+        auto plan = TransactionApplier::plan(batch, no_parents);
+        REQUIRE(plan.partition_count() == 2);
+        REQUIRE(plan.largest_partition() == 3);
+    }
+
+    SECTION("hierarchy patches touch the old parent") {
+        // 2 and 3 are children of 1; 5 is a child of 4
+        auto parent_of = [&](EntityRef e) -> std::optional<EntityRef> {
+            if (e.entity_id == 2 || e.entity_id == 3) return EntityRef(ns, 1);
+            if (e.entity_id == 5) return EntityRef(ns, 4);
+            return std::nullopt;
+        };
+
+        PatchBatch batch;
+        batch.push(HierarchyPatch::clear_parent(EntityRef(ns, 2)));
+        batch.push(HierarchyPatch::set_sibling_index(EntityRef(ns, 3), 0));
+        batch.push(HierarchyPatch::set_parent(EntityRef(ns, 5), EntityRef(ns, 6)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 4), "Health", Value(1)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 7), "Health", Value(1)));
+
+        auto plan = TransactionApplier::plan(batch, parent_of);
+        REQUIRE(plan.phases.size() == 1);
+        REQUIRE(plan.phases[0].partitions.size() == 3);
+        REQUIRE(plan.phases[0].partitions[0] == std::vector<std::size_t>{0, 1});
+        REQUIRE(plan.phases[0].partitions[1] == std::vector<std::size_t>{2, 3});
+        REQUIRE(plan.phases[0].partitions[2] == std::vector<std::size_t>{4});
+    }
+
+    SECTION("earlier reparenting decides the old parent") {
+        PatchBatch batch;
+        batch.push(HierarchyPatch::set_parent(EntityRef(ns, 2), EntityRef(ns, 1)));
+        batch.push(EntityPatch::create(EntityRef(ns, 8), "Barrier"));
+        batch.push(HierarchyPatch::clear_parent(EntityRef(ns, 2)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 1), "Health", Value(1)));
+
+        auto plan = TransactionApplier::plan(batch, no_parents);
+        REQUIRE(plan.phases.size() == 3);
+        REQUIRE(plan.phases[2].partitions.size() == 1);
+        REQUIRE(plan.phases[2].partitions[0] == std::vector<std::size_t>{2, 3});
+    }
+
+    SECTION("hierarchy patches without a parent lookup are serial") {
+        PatchBatch batch;
+        batch.push(ComponentPatch::set(EntityRef(ns, 1), "Health", Value(1)));
+        batch.push(HierarchyPatch::clear_parent(EntityRef(ns, 2)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 3), "Health", Value(1)));
+
+        auto plan = TransactionApplier::plan(batch);
+        REQUIRE(plan.phases.size() == 3);
+        REQUIRE(plan.phases[1].serial);
+        REQUIRE(plan.phases[1].partitions[0] == std::vector<std::size_t>{1});
+    }
+
+    SECTION("structural patches run in serial phases") {
+        PatchBatch batch;
+        batch.push(EntityPatch::create(EntityRef(ns, 1), "A"));
+        batch.push(EntityPatch::create(EntityRef(ns, 2), "B"));
+        batch.push(ComponentPatch::add(EntityRef(ns, 1), "Health", Value(100)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 1), "Health", Value(90)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 2), "Health", Value(80)));
+        batch.push(ComponentPatch::remove(EntityRef(ns, 2), "Health"));
+        batch.push(EntityPatch::destroy(EntityRef(ns, 1)));
+
+        auto plan = TransactionApplier::plan(batch);
+        REQUIRE(plan.phases.size() == 3);
+        REQUIRE(plan.phases[0].serial);
+        REQUIRE(plan.phases[0].partitions[0] == std::vector<std::size_t>{0, 1, 2});
+        REQUIRE_FALSE(plan.phases[1].serial);
+        REQUIRE(plan.phases[1].partitions.size() == 2);
+        REQUIRE(plan.phases[2].serial);
+        REQUIRE(plan.phases[2].partitions[0] == std::vector<std::size_t>{5, 6});
+    }
+
+    SECTION("concurrent structural patches partition by entity") {
+        PatchBatch batch;
+        for (std::uint64_t e = 1; e <= 3; ++e) {
+            batch.push(EntityPatch::create(EntityRef(ns, e), "Streamed"));
+            batch.push(ComponentPatch::add(EntityRef(ns, e), "Health", Value(100)));
+        }
+        batch.push(ComponentPatch::remove(EntityRef(ns, 2), "Health"));
+        batch.push(EntityPatch::destroy(EntityRef(ns, 3)));
+        batch.push(LayerPatch::create(LayerId(1), "Streamed"));
+
+        auto plan = TransactionApplier::plan(batch, {}, true);
+        REQUIRE(plan.phases.size() == 2);
+        REQUIRE_FALSE(plan.phases[0].serial);
+        REQUIRE(plan.phases[0].partitions.size() == 3);
+        REQUIRE(plan.phases[0].partitions[0] == std::vector<std::size_t>{0, 1});
+        REQUIRE(plan.phases[0].partitions[1] == std::vector<std::size_t>{2, 3, 6});
+        REQUIRE(plan.phases[0].partitions[2] == std::vector<std::size_t>{4, 5});
+        REQUIRE(plan.phases[1].serial);
+        REQUIRE(plan.phases[1].partitions[0] == std::vector<std::size_t>{7, 8});
+    }
+
+    SECTION("layer patches share a partition") {
+        PatchBatch batch;
+        batch.push(LayerPatch::add_entity(LayerId(1), EntityRef(ns, 1)));
+        batch.push(LayerPatch::add_entity(LayerId(1), EntityRef(ns, 2)));
+        batch.push(ComponentPatch::set(EntityRef(ns, 3), "Health", Value(1)));
+
+        auto plan = TransactionApplier::plan(batch);
+        REQUIRE(plan.partition_count() == 2);
+        REQUIRE(plan.largest_partition() == 2);
+    }
+
+    SECTION("untargeted patch splits phases") {
+        PatchBatch batch;
+        batch.push(ComponentPatch::set(EntityRef(ns, 1), "Health", Value(1)));
+        batch.push(CustomPatch::create("Global", EntityRef(), Value::null()));
+        batch.push(ComponentPatch::set(EntityRef(ns, 2), "Health", Value(1)));
+
+        auto plan = TransactionApplier::plan(batch);
+        REQUIRE(plan.phases.size() == 3);
+        REQUIRE(plan.phases[1].serial);
+        REQUIRE(plan.phases[1].partitions[0] == std::vector<std::size_t>{1});
+    }
+}
+
+TEST_CASE("TransactionApplier apply", "[ir][transaction]") {
+    NamespaceId ns(0);
+    constexpr std::uint64_t k_entities = 64;
+    constexpr int k_patches_per_entity = 50;
+
+    auto build = [&] {
+        TransactionBuilder builder(ns);
+        for (int n = 0; n < k_patches_per_entity; ++n) {
+            for (std::uint64_t e = 0; e < k_entities; ++e) {
+                builder.set_component(EntityRef(ns, e), "Counter", Value(n));
+            }
+        }
+        Transaction tx = builder.build(TransactionId(1));
+        tx.submit();
+        return tx;
+    };
+
+    TransactionApplierConfig config;
+    config.max_workers = 4;
+    config.min_parallel_patches = 0;
+    TransactionApplier applier(config);
+
+    SECTION("applies every patch in order per entity") {
+        std::vector<std::int64_t> last(k_entities, -1);
+        std::vector<bool> ordered(k_entities, true);
+
+        Transaction tx = build();
+        auto result = applier.apply(tx,
+            [&](const Patch& patch) {
+                const auto& cp = patch.as<ComponentPatch>();
+                auto e = cp.entity.entity_id;
+                if (cp.value.as_int() != last[e] + 1) {
+                    ordered[e] = false;
+                }
+                last[e] = cp.value.as_int();
+                return true;
+            },
+            [](const Patch&) {});
+
+        REQUIRE(result.success);
+        REQUIRE(result.patches_applied == k_entities * k_patches_per_entity);
+        REQUIRE(tx.state() == TransactionState::Committed);
+        for (std::uint64_t e = 0; e < k_entities; ++e) {
+            REQUIRE(ordered[e]);
+            REQUIRE(last[e] == k_patches_per_entity - 1);
+        }
+    }
+
+    SECTION("failure rolls back every applied patch") {
+        std::atomic<int> applied{0};
+        std::atomic<int> undone{0};
+
+        Transaction tx = build();
+        auto result = applier.apply(tx,
+            [&](const Patch& patch) {
+                const auto& cp = patch.as<ComponentPatch>();
+                if (cp.entity.entity_id == 7 && cp.value.as_int() == 10) {
+                    return false;
+                }
+                ++applied;
+                return true;
+            },
+            [&](const Patch&) { ++undone; });
+
+        REQUIRE_FALSE(result.success);
+        REQUIRE(result.patches_failed == 1);
+        REQUIRE(result.failed_indices.size() == 1);
+        REQUIRE(result.patches_applied == static_cast<std::size_t>(applied.load()));
+        REQUIRE(undone.load() == applied.load());
+        REQUIRE(tx.state() == TransactionState::RolledBack);
+    }
+
+    SECTION("partitions run through the configured parallel_for") {
+        std::atomic<std::size_t> dispatched{0};
+        TransactionApplierConfig pooled = config;
+        pooled.parallel_for = [&](std::size_t count, const std::function<void(std::size_t)>& fn) {
+            dispatched += count;
+            for (std::size_t i = count; i-- > 0;) {
+                fn(i);
+            }
+        };
+        TransactionApplier pooled_applier(pooled);
+
+        Transaction tx = build();
+        std::atomic<std::size_t> applied{0};
+        auto result = pooled_applier.apply(tx,
+            [&](const Patch&) { ++applied; return true; },
+            [](const Patch&) {});
+
+        REQUIRE(result.success);
+        REQUIRE(dispatched.load() == k_entities);
+        REQUIRE(applied.load() == k_entities * k_patches_per_entity);
+    }
+
+    SECTION("streamed-in entities apply in parallel with concurrent_structural") {
+        TransactionApplierConfig streaming = config;
+        streaming.concurrent_structural = true;
+        std::atomic<std::size_t> dispatched{0};
+        streaming.parallel_for = [&](std::size_t count, const std::function<void(std::size_t)>& fn) {
+            dispatched += count;
+            for (std::size_t i = 0; i < count; ++i) {
+                fn(i);
+            }
+        };
+        TransactionApplier streaming_applier(streaming);
+
+        TransactionBuilder builder(ns);
+        for (std::uint64_t e = 0; e < k_entities; ++e) {
+            builder
+                .create_entity(EntityRef(ns, e), "Streamed")
+                .add_component(EntityRef(ns, e), "Health", Value(100));
+        }
+        Transaction tx = builder.build(TransactionId(3));
+        tx.submit();
+
+        // Each entity is created before its component is added
+        std::vector<int> steps(k_entities, 0);
+        auto result = streaming_applier.apply(tx,
+            [&](const Patch& patch) {
+                auto e = patch.target_entity()->entity_id;
+                bool create = patch.try_as<EntityPatch>() != nullptr;
+                if (steps[e] != (create ? 0 : 1)) {
+                    return false;
+                }
+                ++steps[e];
+                return true;
+            },
+            [](const Patch&) {});
+
+        REQUIRE(result.success);
+        REQUIRE(dispatched.load() == k_entities);
+        REQUIRE(std::count(steps.begin(), steps.end(), 2) == static_cast<std::ptrdiff_t>(k_entities));
+    }
+
+    SECTION("small transactions apply on the calling thread") {
+        TransactionApplier serial;
+        std::vector<std::uint64_t> undone;
+
+        TransactionBuilder builder(ns);
+        builder
+            .create_entity(EntityRef(ns, 1), "A")
+            .create_entity(EntityRef(ns, 2), "B")
+            .create_entity(EntityRef(ns, 3), "C");
+        Transaction tx = builder.build(TransactionId(2));
+        tx.submit();
+
+        std::size_t calls = 0;
+        auto result = serial.apply(tx,
+            [&](const Patch&) { return ++calls < 3; },
+            [&](const Patch& patch) { undone.push_back(patch.target_entity()->entity_id); });
+
+        REQUIRE_FALSE(result.success);
+        REQUIRE(result.failed_indices == std::vector<std::size_t>{2});
+        REQUIRE(undone == std::vector<std::uint64_t>{2, 1});
+    }
+}
@@ -91,6 +91,24 @@ TEST_CASE("ComponentSchema", "[ir][validation]") {
         REQUIRE(schema.find_field("unknown") == nullptr);
     }
 
+    SECTION("field accessor") {
+        ComponentSchema schema("Health");
+        schema
+            .field(FieldDescriptor::integer("current"))
+            .field(FieldDescriptor::integer("max"));
+
+        FieldAccessor max = schema.accessor(Symbol("max"));
+        REQUIRE(max);
+        REQUIRE(max.index == 1);
+        REQUIRE(max.descriptor->name == "max");
+        REQUIRE_FALSE(schema.accessor(Symbol("unknown")));
+
+        Value component = Value::empty_object();
+        REQUIRE(max.get(component) == nullptr);
+        max.set(component, Value(200));
+        REQUIRE(max.get(component)->as_int() == 200);
+    }
+
     SECTION("validate valid object") {
         ComponentSchema schema("Health");
         schema
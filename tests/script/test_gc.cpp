@@ -0,0 +1,125 @@
+/// @file test_gc.cpp
+/// @brief Tests for the void_script cycle collector
+
+#include <catch2/catch_test_macros.hpp>
+#include "gc.hpp"
+#include "interpreter.hpp"
+
+using namespace void_script;
+
+// =============================================================================
+// Collector Ownership Tests
+// =============================================================================
+
+TEST_CASE("GarbageCollector: values register with the current collector", "[script][gc]") {
+    GarbageCollector a;
+    GarbageCollector b;
+
+    {
+        GarbageCollector::Scope scope(&a);
+        Value array(ValueArray{});
+        REQUIRE(&GarbageCollector::current() == &a);
+
+        {
+            // A null collector keeps the current one
+            GarbageCollector::Scope inner(nullptr);
+            REQUIRE(&GarbageCollector::current() == &a);
+        }
+    }
+    REQUIRE(&GarbageCollector::current() != &a);
+
+    REQUIRE(a.stats().young_objects == 1);
+    REQUIRE(b.stats().young_objects == 0);
+}
+
+TEST_CASE("GarbageCollector: interpreters register with their collector", "[script][gc]") {
+    GarbageCollector a;
+    GarbageCollector b;
+
+    Interpreter first;
+    first.set_collector(&a);
+    Interpreter second;
+    second.set_collector(&b);
+
+    (void)first.run("var list = [[1], [2], [3]];");
+    REQUIRE(a.stats().young_objects >= 4);
+    REQUIRE(b.stats().young_objects == 0);
+}
+
+// =============================================================================
+// Cycle Collection Tests
+// =============================================================================
+
+TEST_CASE("GarbageCollector: collects closure cycles through captured scopes", "[script][gc]") {
+    GarbageCollector gc;
+    Interpreter interp;
+    interp.set_collector(&gc);
+    interp.set_bytecode_enabled(false);
+
+    // inner's closure is make's call scope, which holds inner
+    auto result = interp.run(R"(
+        fn make(n) {
+            var self = null;
+            fn inner() { return self; }
+            self = inner;
+            return n;
+        }
+        var total = 0;
+        for (var i = 0; i < 10; i = i + 1) { total = total + make(i); }
+        total;
+    )");
+    REQUIRE(result.as_number() == 45.0);
+
+    gc.collect();
+    REQUIRE(gc.stats().freed_objects >= 10);
+}
+
+TEST_CASE("GarbageCollector: collects class and method cycles", "[script][gc]") {
+    GarbageCollector gc;
+    Interpreter interp;
+    interp.set_collector(&gc);
+    interp.set_bytecode_enabled(false);
+
+    // The class's methods close over the scope that holds the class
+    auto result = interp.run(R"(
+        fn make(n) {
+            class Node { fn kind() { return Node; } }
+            var node = Node();
+            return n;
+        }
+        make(1) + make(2);
+    )");
+    REQUIRE(result.as_number() == 3.0);
+
+    gc.collect();
+    REQUIRE(gc.stats().freed_objects >= 2);
+}
+
+TEST_CASE("GarbageCollector: keeps closures that are still referenced", "[script][gc]") {
+    GarbageCollector gc;
+    Interpreter interp;
+    interp.set_collector(&gc);
+    interp.set_bytecode_enabled(false);
+
+    // The program owns the declarations, so it must outlive the functions
+    Parser parser(R"(
+        fn counter() {
+            var count = 0;
+            fn next() { count = count + 1; return count; }
+            return next;
+        }
+        var tick = counter();
+        tick();
+    )");
+    auto program = parser.parse_program();
+    REQUIRE_FALSE(parser.has_errors());
+    REQUIRE(interp.execute(*program).as_number() == 1.0);
+
+    gc.collect();
+    REQUIRE(interp.run("tick();").as_number() == 2.0);
+
+    // Dropping the global leaves the counter scope and next as a dead cycle
+    interp.globals().clear();
+    gc.collect();
+    REQUIRE(gc.stats().freed_objects >= 1);
+}
@@ -0,0 +1,59 @@
+/// @file test_interpreter.cpp
+/// @brief Tests for void_script program execution on the VM and tree-walker
+
+#include <catch2/catch_test_macros.hpp>
+#include "interpreter.hpp"
+#include <string>
+#include <vector>
+
+using namespace void_script;
+
+// =============================================================================
+// Program Result Tests
+// =============================================================================
+
+namespace {
+
+void check_program_results(Interpreter& interp) {
+    auto result = interp.run("fn sq(x) { return x * x; } let a = 3; sq(a) + 1;");
+    REQUIRE(result.is_number());
+    REQUIRE(result.as_number() == 10.0);
+
+    REQUIRE(interp.run("let b = 1;").is_null());
+}
+
+} // namespace
+
+TEST_CASE("Interpreter: program result on the bytecode VM", "[script][interpreter]") {
+    Interpreter interp;
+    REQUIRE(interp.bytecode_enabled());
+    check_program_results(interp);
+}
+
+TEST_CASE("Interpreter: program result on the tree-walker", "[script][interpreter]") {
+    Interpreter interp;
+    interp.set_bytecode_enabled(false);
+    check_program_results(interp);
+}
+
+TEST_CASE("Interpreter: programs with fallback statements", "[script][interpreter]") {
+    Interpreter interp;
+
+    // Class declarations are run by the tree-walker from inside the VM
+    auto result = interp.run("class C { fn get() { return 5; } } C().get() + 1;");
+    REQUIRE(result.as_number() == 6.0);
+
+    REQUIRE(interp.run("let a = 5; class D { }").is_null());
+    REQUIRE(interp.run("a;").as_number() == 5.0);
+}
+
+TEST_CASE("Interpreter: debug bytecode listing bypasses the print callback", "[script][interpreter]") {
+    Interpreter interp;
+    std::vector<std::string> printed;
+    interp.set_print_callback([&](const std::string& text) { printed.push_back(text); });
+    interp.set_debug(true);
+
+    auto result = interp.run("let x = 2; x * 21;");
+    REQUIRE(result.as_number() == 42.0);
+    REQUIRE(printed.empty());
+}
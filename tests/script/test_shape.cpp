@@ -0,0 +1,125 @@
+/// @file test_shape.cpp
+/// @brief Tests for void_script shapes (hidden classes)
+
+#include <catch2/catch_test_macros.hpp>
+#include "interpreter.hpp"
+#include <memory>
+#include <string>
+
+using namespace void_script;
+
+namespace {
+
+class PlainObject : public Object {
+public:
+    [[nodiscard]] ValueType object_type() const override { return ValueType::Object; }
+    [[nodiscard]] std::string to_string() const override { return "<object>"; }
+};
+
+std::string field(std::size_t i) {
+    return "f" + std::to_string(i);
+}
+
+} // namespace
+
+// =============================================================================
+// Shape Tests
+// =============================================================================
+
+TEST_CASE("Shape: objects with the same layout share a shape", "[script][shape]") {
+    auto root = Shape::make_root();
+    auto a = root->with_property("x")->with_property("y");
+    auto b = root->with_property("x")->with_property("y");
+    REQUIRE(a == b);
+    REQUIRE(a->size() == 2);
+    REQUIRE(a->find("y") == 1);
+    REQUIRE(a->find("z") == -1);
+    REQUIRE_FALSE(a->is_dictionary());
+
+    auto c = root->with_property("y")->with_property("x");
+    REQUIRE(c != a);
+}
+
+TEST_CASE("Shape: unreachable shapes are freed", "[script][shape]") {
+    auto root = Shape::make_root();
+    std::weak_ptr<Shape> observed;
+    {
+        auto object = std::make_shared<PlainObject>();
+        object->add_slot(root->with_property("x"), Value(1.0));
+        object->add_slot(object->shape()->with_property("y"), Value(2.0));
+        observed = object->shape();
+        REQUIRE_FALSE(observed.expired());
+    }
+    REQUIRE(observed.expired());
+
+    // The transition is rebuilt on demand
+    REQUIRE(root->with_property("x")->find("x") == 0);
+
+    std::weak_ptr<Shape> observed_root = root;
+    root.reset();
+    REQUIRE(observed_root.expired());
+}
+
+TEST_CASE("Shape: large objects switch to dictionary mode", "[script][shape]") {
+    PlainObject object;
+    for (std::size_t i = 0; i < Shape::k_max_shared_properties; ++i) {
+        object.set_property(field(i), Value(static_cast<double>(i)));
+    }
+    REQUIRE_FALSE(object.shape()->is_dictionary());
+
+    object.set_property(field(Shape::k_max_shared_properties), Value(-1.0));
+    auto dictionary = object.shape();
+    REQUIRE(dictionary->is_dictionary());
+
+    // Further properties grow the dictionary in place
+    for (std::size_t i = Shape::k_max_shared_properties + 1; i < 200; ++i) {
+        object.set_property(field(i), Value(static_cast<double>(i)));
+    }
+    REQUIRE(object.shape() == dictionary);
+    REQUIRE(dictionary->size() == 200);
+    REQUIRE(object.get_property(field(5)).as_number() == 5.0);
+    REQUIRE(object.get_property(field(150)).as_number() == 150.0);
+    REQUIRE(object.get_property(field(Shape::k_max_shared_properties)).as_number() == -1.0);
+
+    // Other objects never see the dictionary shape
+    PlainObject other;
+    for (std::size_t i = 0; i <= Shape::k_max_shared_properties; ++i) {
+        other.set_property(field(i), Value(0.0));
+    }
+    REQUIRE(other.shape() != dictionary);
+}
+
+TEST_CASE("Shape: transition-heavy shapes hand out dictionaries", "[script][shape]") {
+    auto root = Shape::make_root();
+    std::vector<std::shared_ptr<Shape>> live;
+    for (std::size_t i = 0; i < Shape::k_max_transitions; ++i) {
+        live.push_back(root->with_property(field(i)));
+        REQUIRE_FALSE(live.back()->is_dictionary());
+    }
+
+    auto overflow = root->with_property("extra");
+    REQUIRE(overflow->is_dictionary());
+    REQUIRE(overflow->find("extra") == 0);
+
+    // Dropping transitions frees room for shared shapes again
+    live.clear();
+    REQUIRE_FALSE(root->with_property("extra")->is_dictionary());
+}
+
+TEST_CASE("Shape: dictionary objects work through the VM caches", "[script][shape]") {
+    std::string init;
+    std::string sum = "0";
+    for (std::size_t i = 0; i < 40; ++i) {
+        init += "this." + field(i) + " = " + std::to_string(i) + "; ";
+        sum += " + o." + field(i);
+    }
+
+    Interpreter interp;
+    auto result = interp.run(
+        "class Wide { fn init() { " + init + "} fn first() { return this.f0; } }"
+        "fn total(o) { return " + sum + "; }"
+        "var t = 0;"
+        "for (var i = 0; i < 3; i = i + 1) { var o = Wide(); o.f39 += i; t = t + total(o) + o.first(); }"
+        "t;");
+    REQUIRE(result.as_number() == 3.0 * 780.0 + 3.0);
+}
@@ -0,0 +1,193 @@
+/// @file test_wasm_interpreter.cpp
+/// @brief Tests for the pre-decoding WASM interpreter
+
+#include <catch2/catch_test_macros.hpp>
+#include "wasm_interpreter.hpp"
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+using namespace void_scripting;
+
+namespace {
+
+using Bytes = std::vector<std::uint8_t>;
+
+void append(Bytes& out, std::initializer_list<std::uint8_t> bytes) {
+    out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+void append_section(Bytes& out, std::uint8_t id, const Bytes& body) {
+    out.push_back(id);
+    out.push_back(static_cast<std::uint8_t>(body.size()));  // All test sections are < 128 bytes
+    out.insert(out.end(), body.begin(), body.end());
+}
+
+// Module with four functions:
+//   0: fact(i64) -> i64      recursive, if/else with a result
+//   1: sum(i32) -> i32       loop with br_if out of the enclosing block
+//   2: select(i32) -> i32    br_table over three nested blocks
+//   3: offset_sum(i32) -> i32  100 + sum(n), with 100 left on the caller's stack
+Bytes make_module() {
+    Bytes module;
+    append(module, {0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00});
+
+    append_section(module, 1, {0x02,
+                               0x60, 0x01, 0x7E, 0x01, 0x7E,    // (i64) -> i64
+                               0x60, 0x01, 0x7F, 0x01, 0x7F});  // (i32) -> i32
+    append_section(module, 3, {0x04, 0x00, 0x01, 0x01, 0x01});
+
+    Bytes fact = {0x00,
+                  0x20, 0x00, 0x50, 0x04, 0x7E,             // local.get 0; i64.eqz; if (result i64)
+                  0x42, 0x01,                               //   i64.const 1
+                  0x05,                                     // else
+                  0x20, 0x00, 0x20, 0x00, 0x42, 0x01, 0x7D, //   n, n - 1
+                  0x10, 0x00, 0x7E,                         //   call fact; i64.mul
+                  0x0B, 0x0B};
+    Bytes sum = {0x01, 0x01, 0x7F,                          // one i32 accumulator
+                 0x02, 0x40, 0x03, 0x40,                    // block; loop
+                 0x20, 0x00, 0x45, 0x0D, 0x01,              //   br_if 1 when n == 0
+                 0x20, 0x01, 0x20, 0x00, 0x6A, 0x21, 0x01,  //   acc += n
+                 0x20, 0x00, 0x41, 0x01, 0x6B, 0x21, 0x00,  //   n -= 1
+                 0x0C, 0x00,                                //   br 0
+                 0x0B, 0x0B,
+                 0x20, 0x01, 0x0B};
+    Bytes select = {0x00,
+                    0x02, 0x40, 0x02, 0x40, 0x02, 0x40,
+                    0x20, 0x00, 0x0E, 0x02, 0x00, 0x01, 0x02,  // br_table 0 1 (default 2)
+                    0x0B, 0x41, 0x0A, 0x0F,                    // case 0: return 10
+                    0x0B, 0x41, 0x14, 0x0F,                    // case 1: return 20
+                    0x0B, 0x41, 0x1E, 0x0B};                   // default: 30
+    Bytes offset_sum = {0x00,
+                        0x41, 0xE4, 0x00,                      // i32.const 100
+                        0x20, 0x00, 0x10, 0x01, 0x6A,          // call sum; i32.add
+                        0x0B};
+
+    Bytes code = {0x04};
+    for (const Bytes* body : {&fact, &sum, &select, &offset_sum}) {
+        code.push_back(static_cast<std::uint8_t>(body->size()));
+        code.insert(code.end(), body->begin(), body->end());
+    }
+    append_section(module, 10, code);
+    return module;
+}
+
+} // anonymous namespace
+
+// =============================================================================
+// Translation Tests
+// =============================================================================
+
+TEST_CASE("WasmInterpreter: bodies are pre-decoded with resolved branches", "[scripting][wasm]") {
+    WasmInterpreter interp;
+    auto module = make_module();
+    auto parsed = interp.parse_module(module);
+    REQUIRE(parsed);
+    REQUIRE(parsed.value().functions.size() == 4);
+
+    const auto& sum = parsed.value().functions[1];
+    REQUIRE_FALSE(sum.instructions.empty());
+
+    // br_if leaves the block: it lands on the block's End.
+    // br 0 repeats the loop: it lands on the loop's first body instruction.
+    std::size_t branches = 0;
+    for (const auto& instr : sum.instructions) {
+        if (instr.opcode == WasmOpcode::BrIf) {
+            REQUIRE(instr.b < sum.instructions.size());
+            REQUIRE(sum.instructions[instr.b].opcode == WasmOpcode::End);
+            ++branches;
+        } else if (instr.opcode == WasmOpcode::Br) {
+            REQUIRE(instr.b > 0);
+            REQUIRE(sum.instructions[instr.b - 1].opcode == WasmOpcode::Loop);
+            ++branches;
+        }
+    }
+    REQUIRE(branches == 2);
+
+    // The i32.const immediate is decoded once
+    bool found_const = false;
+    for (const auto& instr : sum.instructions) {
+        if (instr.opcode == WasmOpcode::I32Const) {
+            REQUIRE(instr.value.i32 == 1);
+            found_const = true;
+        }
+    }
+    REQUIRE(found_const);
+
+    const auto& select = parsed.value().functions[2];
+    REQUIRE(select.branch_tables.size() == 6);  // (depth, target) for two labels plus the default
+}
+
+TEST_CASE("WasmInterpreter: rejects branches past the function body", "[scripting][wasm]") {
+    Bytes module;
+    append(module, {0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00});
+    append_section(module, 1, {0x01, 0x60, 0x00, 0x00});
+    append_section(module, 3, {0x01, 0x00});
+    append_section(module, 10, {0x01, 0x04, 0x00, 0x0C, 0x05, 0x0B});  // br 5
+
+    WasmInterpreter interp;
+    REQUIRE_FALSE(interp.parse_module(module));
+}
+
+// =============================================================================
+// Execution Tests
+// =============================================================================
+
+TEST_CASE("WasmInterpreter: executes control flow", "[scripting][wasm]") {
+    WasmInterpreter interp;
+    auto module = make_module();
+    auto parsed = interp.parse_module(module);
+    REQUIRE(parsed);
+    WasmMemory memory(0);
+
+    SECTION("recursive calls with if/else") {
+        WasmValue arg(std::int64_t{10});
+        auto result = interp.execute(parsed.value(), memory, 0, {&arg, 1});
+        REQUIRE(result);
+        REQUIRE(result.value().size() == 1);
+        REQUIRE(result.value()[0].i64 == 3628800);
+    }
+
+    SECTION("loop with backward and forward branches") {
+        WasmValue arg(std::int32_t{100});
+        auto result = interp.execute(parsed.value(), memory, 1, {&arg, 1});
+        REQUIRE(result);
+        REQUIRE(result.value()[0].i32 == 5050);
+    }
+
+    SECTION("br_table picks each case and the default") {
+        const std::int32_t expected[] = {10, 20, 30, 30};
+        for (std::int32_t i = 0; i < 4; ++i) {
+            WasmValue arg(i);
+            auto result = interp.execute(parsed.value(), memory, 2, {&arg, 1});
+            REQUIRE(result);
+            REQUIRE(result.value()[0].i32 == expected[i]);
+        }
+    }
+
+    SECTION("nested calls keep the caller's operand stack") {
+        WasmValue arg(std::int32_t{10});
+        auto result = interp.execute(parsed.value(), memory, 3, {&arg, 1});
+        REQUIRE(result);
+        REQUIRE(result.value()[0].i32 == 155);
+    }
+}
+
+TEST_CASE("WasmInterpreter: fuel stops long loops", "[scripting][wasm]") {
+    WasmInterpreter interp;
+    auto module = make_module();
+    auto parsed = interp.parse_module(module);
+    REQUIRE(parsed);
+    WasmMemory memory(0);
+
+    interp.set_fuel(50);
+    WasmValue arg(std::int32_t{100000});
+    REQUIRE_FALSE(interp.execute(parsed.value(), memory, 1, {&arg, 1}));
+
+    interp.set_fuel(1000000);
+    WasmValue small(std::int32_t{10});
+    auto result = interp.execute(parsed.value(), memory, 1, {&small, 1});
+    REQUIRE(result);
+    REQUIRE(result.value()[0].i32 == 55);
+    REQUIRE(interp.remaining_fuel() < 1000000);
+}
@@ -0,0 +1,219 @@
+/// @file test_trigger_grid.cpp
+/// @brief Tests for the trigger spatial grid and batched entity updates
+
+#include <catch2/catch_test_macros.hpp>
+#include <void_engine/triggers/triggers.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace void_triggers;
+
+namespace {
+
+/// Enter/exit callbacks in the order they fired
+struct EventLog {
+    std::vector<std::string> events;
+
+    void attach(TriggerSystem& system) {
+        system.set_on_trigger_enter([this](const TriggerEvent& e) { record("enter", e); });
+        system.set_on_trigger_exit([this](const TriggerEvent& e) { record("exit", e); });
+    }
+
+    void record(const char* kind, const TriggerEvent& e) {
+        events.push_back(std::string(kind) + " " + std::to_string(e.entity.to_bits()) +
+                         " " + std::to_string(e.trigger.value));
+    }
+};
+
+TriggerSystem make_system(bool hashing, std::uint32_t workers) {
+    TriggerSystemConfig config;
+    config.spatial_hashing = hashing;
+    config.spatial_cell_size = 4.0f;
+    config.max_workers = workers;
+    return TriggerSystem(config);
+}
+
+/// Boxes and spheres scattered over [-50, 50], one trigger covering the
+/// whole area (too large for the grid) and one without a volume
+void populate(TriggerSystem& system) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.5f, 6.0f);
+
+    TriggerConfig config;
+    config.type = TriggerType::EnterExit;
+
+    for (int i = 0; i < 80; ++i) {
+        Vec3 center{coord(rng), 0.0f, coord(rng)};
+        TriggerId id = system.create_trigger(config);
+        if (i % 2 == 0) {
+            float h = size(rng);
+            system.get_trigger(id)->set_volume(VolumeFactory::create_box(center, {h, 2.0f, size(rng)}));
+        } else {
+            system.get_trigger(id)->set_volume(VolumeFactory::create_sphere(center, size(rng)));
+        }
+    }
+
+    TriggerId world = system.create_trigger(config);
+    system.get_trigger(world)->set_volume(VolumeFactory::create_box({0, 0, 0}, {100.0f, 10.0f, 100.0f}));
+    system.create_trigger(config);
+}
+
+std::vector<TriggerSystem::EntityUpdate> random_updates(std::mt19937& rng, std::size_t count) {
+    std::uniform_real_distribution<float> coord(-55.0f, 55.0f);
+    std::uniform_real_distribution<float> height(-1.0f, 1.0f);
+
+    std::vector<TriggerSystem::EntityUpdate> updates;
+    for (std::size_t i = 0; i < count; ++i) {
+        updates.push_back({EntityId::create(static_cast<std::uint32_t>(i), 0),
+                           Vec3{coord(rng), height(rng), coord(rng)}});
+    }
+    return updates;
+}
+
+} // namespace
+
+// =============================================================================
+// Spatial Grid Tests
+// =============================================================================
+
+TEST_CASE("TriggerSystem: grid broadphase matches a scan over every trigger", "[triggers][grid]") {
+    TriggerSystem grid = make_system(true, 1);
+    TriggerSystem scan = make_system(false, 1);
+    populate(grid);
+    populate(scan);
+
+    EventLog grid_log;
+    EventLog scan_log;
+    grid_log.attach(grid);
+    scan_log.attach(scan);
+
+    std::mt19937 rng(3);
+    for (int frame = 0; frame < 8; ++frame) {
+        for (const auto& update : random_updates(rng, 300)) {
+            grid.update_entity(update.entity, update.position);
+            scan.update_entity(update.entity, update.position);
+        }
+        grid.update(0.016f);
+        scan.update(0.016f);
+    }
+
+    REQUIRE(grid_log.events == scan_log.events);
+    REQUIRE(grid_log.events.size() > 300);
+    for (std::uint32_t i = 0; i < 300; ++i) {
+        EntityId entity = EntityId::create(i, 0);
+        REQUIRE(grid.triggers_containing(entity) == scan.triggers_containing(entity));
+        REQUIRE_FALSE(grid.triggers_containing(entity).empty());
+    }
+
+    // The grid only tests triggers whose cell bounds hold the entity
+    REQUIRE(grid.stats().collision_checks * 10 < scan.stats().collision_checks);
+}
+
+TEST_CASE("TriggerSystem: moved and removed volumes are re-indexed", "[triggers][grid]") {
+    TriggerSystem system = make_system(true, 1);
+    TriggerConfig config;
+    config.type = TriggerType::EnterExit;
+
+    TriggerId id = system.create_trigger(config);
+    system.get_trigger(id)->set_volume(VolumeFactory::create_box({0, 0, 0}, {1, 1, 1}));
+
+    EntityId entity = EntityId::create(1, 0);
+    system.update_entity(entity, {20.0f, 0.0f, 0.0f});
+    REQUIRE(system.triggers_containing(entity).empty());
+
+    system.get_trigger(id)->volume()->set_center({20.0f, 0.0f, 0.0f});
+
+    SECTION("within a frame after refresh_spatial_index") {
+        system.refresh_spatial_index();
+        system.update_entity(entity, {20.0f, 0.0f, 0.0f});
+        REQUIRE(system.triggers_containing(entity) == std::vector<TriggerId>{id});
+    }
+
+    SECTION("on the next frame") {
+        system.update(0.016f);
+        system.update_entity(entity, {20.0f, 0.0f, 0.0f});
+        REQUIRE(system.triggers_containing(entity) == std::vector<TriggerId>{id});
+    }
+
+    SECTION("after a new volume is assigned") {
+        system.get_trigger(id)->set_volume(VolumeFactory::create_sphere({-30.0f, 0.0f, 5.0f}, 2.0f));
+        system.update(0.016f);
+        system.update_entity(entity, {-30.0f, 0.0f, 5.5f});
+        REQUIRE(system.triggers_containing(entity) == std::vector<TriggerId>{id});
+    }
+
+    SECTION("after the trigger is removed") {
+        REQUIRE(system.remove_trigger(id));
+        system.update_entity(entity, {20.0f, 0.0f, 0.0f});
+        REQUIRE(system.triggers_containing(entity).empty());
+    }
+}
+
+// =============================================================================
+// Batched Update Tests
+// =============================================================================
+
+TEST_CASE("TriggerSystem: update_entities matches per-entity updates", "[triggers][grid]") {
+    TriggerSystem single = make_system(true, 1);
+    TriggerSystem serial = make_system(true, 1);
+    TriggerSystem parallel = make_system(true, 8);
+    populate(single);
+    populate(serial);
+    populate(parallel);
+
+    EventLog single_log;
+    EventLog serial_log;
+    EventLog parallel_log;
+    single_log.attach(single);
+    serial_log.attach(serial);
+    parallel_log.attach(parallel);
+
+    std::mt19937 rng(5);
+    for (int frame = 0; frame < 6; ++frame) {
+        auto updates = random_updates(rng, 2048);
+        for (const auto& update : updates) {
+            single.update_entity(update.entity, update.position);
+        }
+        serial.update_entities(updates);
+        parallel.update_entities(updates);
+
+        single.update(0.016f);
+        serial.update(0.016f);
+        parallel.update(0.016f);
+    }
+
+    // Events fire in input order, exits before enters, for any worker count
+    REQUIRE(serial_log.events == single_log.events);
+    REQUIRE(parallel_log.events == single_log.events);
+    REQUIRE(parallel.stats().collision_checks == single.stats().collision_checks);
+    REQUIRE(parallel.stats().entities_tracked == 2048);
+
+    for (std::uint32_t i = 0; i < 2048; i += 7) {
+        EntityId entity = EntityId::create(i, 0);
+        REQUIRE(parallel.triggers_containing(entity) == single.triggers_containing(entity));
+    }
+
+    SECTION("callbacks may remove entities mid-batch") {
+        EntityId victim = EntityId::create(1, 0);
+        parallel.set_on_trigger_enter([&](const TriggerEvent& e) {
+            if (e.entity != victim) {
+                parallel.remove_entity(victim);
+            }
+        });
+
+        std::vector<TriggerSystem::EntityUpdate> updates{
+            {EntityId::create(0, 0), Vec3{200.0f, 0.0f, 200.0f}},
+            {victim, Vec3{200.0f, 0.0f, 200.0f}},
+        };
+        parallel.update_entities(updates);
+        updates[0].position = Vec3{0.0f, 0.0f, 0.0f};
+        updates[1].position = Vec3{0.0f, 0.0f, 0.0f};
+        parallel.update_entities(updates);
+
+        REQUIRE(parallel.triggers_containing(victim).empty());
+        REQUIRE_FALSE(parallel.triggers_containing(EntityId::create(0, 0)).empty());
+    }
+}